@@ -0,0 +1,608 @@
+#!/usr/bin/env python3
+"""
+Generates interposer shims for every glad_gl* function pointer in glad.h.
+
+    python3 lib/glad/gen_shims.py profile > lib/glad/src/glad_profile.c
+    python3 lib/glad/gen_shims.py trace > lib/glad/src/glad_trace_calls.h
+
+Re-run whenever glad.h is regenerated.
+"""
+
+import os
+import re
+import sys
+
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+GLAD_H = os.path.join(HERE, "include", "glad", "glad.h")
+
+TYPEDEF_RE = re.compile(
+    r"^typedef (?P<ret>.+?) \(APIENTRYP (?P<pfn>PFN\w+PROC)\)\((?P<params>.*)\);$")
+GLAPI_RE = re.compile(r"^GLAPI (?P<pfn>PFN\w+PROC) glad_(?P<name>\w+);$")
+
+
+class Param:
+    def __init__(self, decl):
+        self.decl = decl.strip()
+        match = re.match(r"^(?P<type>.*?)(?P<name>\w+)$", self.decl)
+        self.type = match.group("type").strip()
+        self.name = match.group("name")
+
+
+class Function:
+    def __init__(self, name, pfn, ret, params):
+        self.name = name
+        self.pfn = pfn
+        self.ret = ret.strip()
+        if params.strip() in ("", "void"):
+            self.params = []
+        else:
+            self.params = [Param(p) for p in params.split(",")]
+
+    def returns(self):
+        return self.ret != "void"
+
+    def signature(self):
+        if not self.params:
+            return "void"
+        return ", ".join(p.decl for p in self.params)
+
+    def arguments(self):
+        return ", ".join(p.name for p in self.params)
+
+
+def parse_functions(path):
+    typedefs = {}
+    functions = []
+    seen = set()
+    with open(path) as f:
+        for line in f:
+            line = line.rstrip("\n")
+            match = TYPEDEF_RE.match(line)
+            if match:
+                typedefs[match.group("pfn")] = match
+                continue
+            match = GLAPI_RE.match(line)
+            if match and match.group("name") not in seen:
+                typedef = typedefs[match.group("pfn")]
+                functions.append(Function(
+                    match.group("name"),
+                    match.group("pfn"),
+                    typedef.group("ret"),
+                    typedef.group("params")))
+                seen.add(match.group("name"))
+    return functions
+
+
+def emit_profile(functions, out):
+    w = out.write
+    w("/*\n\n    GL call profiling shims, generated by lib/glad/gen_shims.py from glad.h.\n")
+    w("    Do not edit by hand.\n\n*/\n\n")
+    w("#include <stddef.h>\n#include <glad/glad_profile.h>\n\n")
+    w("#ifdef GLAD_PROFILE\n\n")
+    w("#if defined(_WIN32) || defined(__CYGWIN__)\n")
+    w("#include <windows.h>\n")
+    w("static unsigned long long glad_profile_now(void) {\n")
+    w("    static LARGE_INTEGER frequency;\n")
+    w("    LARGE_INTEGER counter;\n")
+    w("    if(frequency.QuadPart == 0) QueryPerformanceFrequency(&frequency);\n")
+    w("    QueryPerformanceCounter(&counter);\n")
+    w("    return (unsigned long long)(counter.QuadPart * 1000000000.0 / frequency.QuadPart);\n")
+    w("}\n")
+    w("#else\n")
+    w("#include <time.h>\n")
+    w("static unsigned long long glad_profile_now(void) {\n")
+    w("    struct timespec ts;\n")
+    w("    clock_gettime(CLOCK_MONOTONIC, &ts);\n")
+    w("    return (unsigned long long)ts.tv_sec * 1000000000ull + (unsigned long long)ts.tv_nsec;\n")
+    w("}\n")
+    w("#endif\n\n")
+
+    w("unsigned int gladProfileScope = 0;\n")
+    w("static int profile_enabled = 0;\n")
+    w("static struct gladProfileScopeStat scope_stats[GLAD_PROFILE_MAX_SCOPES];\n")
+    w("static struct gladProfileStat stats[%d] = {\n" % len(functions))
+    for fn in functions:
+        w("\t{\"%s\", 0, 0},\n" % fn.name)
+    w("};\n\n")
+
+    w("static void glad_profile_record(unsigned int id, unsigned long long start) {\n")
+    w("    unsigned long long elapsed = glad_profile_now() - start;\n")
+    w("    unsigned int scope = gladProfileScope < GLAD_PROFILE_MAX_SCOPES ? gladProfileScope : 0;\n")
+    w("    stats[id].calls++;\n")
+    w("    stats[id].nanoseconds += elapsed;\n")
+    w("    scope_stats[scope].calls++;\n")
+    w("    scope_stats[scope].nanoseconds += elapsed;\n")
+    w("}\n\n")
+
+    for id, fn in enumerate(functions):
+        w("static %s real_%s = NULL;\n" % (fn.pfn, fn.name))
+        w("static %s APIENTRY profile_%s(%s) {\n" % (fn.ret, fn.name, fn.signature()))
+        if fn.returns():
+            w("\t%s glad_result;\n" % fn.ret)
+        w("\tunsigned long long glad_start = glad_profile_now();\n")
+        if fn.returns():
+            w("\tglad_result = real_%s(%s);\n" % (fn.name, fn.arguments()))
+        else:
+            w("\treal_%s(%s);\n" % (fn.name, fn.arguments()))
+        w("\tglad_profile_record(%d, glad_start);\n" % id)
+        if fn.returns():
+            w("\treturn glad_result;\n")
+        w("}\n")
+    w("\n")
+
+    w("int gladProfileEnable(void) {\n")
+    w("\tif(profile_enabled) return 1;\n")
+    for fn in functions:
+        w("\treal_%s = glad_%s;\n" % (fn.name, fn.name))
+        w("\tif(real_%s != NULL) glad_%s = profile_%s;\n" % (fn.name, fn.name, fn.name))
+    w("\tprofile_enabled = 1;\n")
+    w("\treturn 1;\n")
+    w("}\n\n")
+
+    w("void gladProfileDisable(void) {\n")
+    w("\tif(!profile_enabled) return;\n")
+    for fn in functions:
+        w("\tif(glad_%s == profile_%s) glad_%s = real_%s;\n"
+          % (fn.name, fn.name, fn.name, fn.name))
+    w("\tprofile_enabled = 0;\n")
+    w("}\n\n")
+
+    w("int gladProfileEnabled(void) {\n")
+    w("    return profile_enabled;\n")
+    w("}\n\n")
+
+    w("void gladProfileReset(void) {\n")
+    w("    unsigned int index;\n")
+    w("    for(index = 0; index < sizeof(stats) / sizeof(stats[0]); index++) {\n")
+    w("        stats[index].calls = 0;\n")
+    w("        stats[index].nanoseconds = 0;\n")
+    w("    }\n")
+    w("    for(index = 0; index < GLAD_PROFILE_MAX_SCOPES; index++) {\n")
+    w("        scope_stats[index].calls = 0;\n")
+    w("        scope_stats[index].nanoseconds = 0;\n")
+    w("    }\n")
+    w("}\n\n")
+
+    w("unsigned int gladProfileStats(const struct gladProfileStat **out) {\n")
+    w("    *out = stats;\n")
+    w("    return sizeof(stats) / sizeof(stats[0]);\n")
+    w("}\n\n")
+
+    w("const struct gladProfileScopeStat *gladProfileScopeStats(void) {\n")
+    w("    return scope_stats;\n")
+    w("}\n\n")
+
+    w("#else\n\n")
+    w("unsigned int gladProfileScope = 0;\n\n")
+    w("int gladProfileEnable(void) {\n    return 0;\n}\n\n")
+    w("void gladProfileDisable(void) {\n}\n\n")
+    w("int gladProfileEnabled(void) {\n    return 0;\n}\n\n")
+    w("void gladProfileReset(void) {\n}\n\n")
+    w("unsigned int gladProfileStats(const struct gladProfileStat **out) {\n")
+    w("    *out = NULL;\n    return 0;\n}\n\n")
+    w("const struct gladProfileScopeStat *gladProfileScopeStats(void) {\n")
+    w("    return NULL;\n}\n\n")
+    w("#endif\n")
+
+
+# Trace capture/replay ########################################################
+#
+# Every parameter is classified once into a kind that decides how it is
+# serialized by the capture shim and decoded by the replayer. Pointers with no
+# known size are recorded as unsupported and the call is skipped on replay.
+
+NAMESPACES = {
+    "buffer": "TRACE_NS_BUFFER",
+    "buffers": "TRACE_NS_BUFFER",
+    "texture": "TRACE_NS_TEXTURE",
+    "textures": "TRACE_NS_TEXTURE",
+    "array": "TRACE_NS_VERTEX_ARRAY",
+    "arrays": "TRACE_NS_VERTEX_ARRAY",
+    "framebuffer": "TRACE_NS_FRAMEBUFFER",
+    "framebuffers": "TRACE_NS_FRAMEBUFFER",
+    "renderbuffer": "TRACE_NS_RENDERBUFFER",
+    "renderbuffers": "TRACE_NS_RENDERBUFFER",
+    "sampler": "TRACE_NS_SAMPLER",
+    "samplers": "TRACE_NS_SAMPLER",
+    "program": "TRACE_NS_PROGRAM",
+    "shader": "TRACE_NS_PROGRAM",
+}
+
+BLOB_SIZES = {
+    ("glBufferData", "data"): "size",
+    ("glBufferSubData", "data"): "size",
+    ("glBufferStorage", "data"): "size",
+    ("glDrawBuffers", "bufs"): "n * sizeof(GLenum)",
+    ("glProgramBinary", "binary"): "length",
+    ("glDebugMessageControl", "ids"): "count * sizeof(GLuint)",
+    ("glDebugMessageControlARB", "ids"): "count * sizeof(GLuint)",
+    ("glMultiDrawArrays", "first"): "drawcount * sizeof(GLint)",
+    ("glMultiDrawArrays", "count"): "drawcount * sizeof(GLsizei)",
+    ("glClearBufferiv", "value"): "(buffer == GL_COLOR ? 4 : 1) * sizeof(GLint)",
+    ("glClearBufferuiv", "value"): "(buffer == GL_COLOR ? 4 : 1) * sizeof(GLuint)",
+    ("glClearBufferfv", "value"): "(buffer == GL_COLOR ? 4 : 1) * sizeof(GLfloat)",
+    ("glTexParameterfv", "params"): "trace_param_count(pname) * sizeof(GLfloat)",
+    ("glTexParameteriv", "params"): "trace_param_count(pname) * sizeof(GLint)",
+    ("glTexParameterIiv", "params"): "trace_param_count(pname) * sizeof(GLint)",
+    ("glTexParameterIuiv", "params"): "trace_param_count(pname) * sizeof(GLuint)",
+    ("glSamplerParameterfv", "param"): "trace_param_count(pname) * sizeof(GLfloat)",
+    ("glSamplerParameteriv", "param"): "trace_param_count(pname) * sizeof(GLint)",
+    ("glSamplerParameterIiv", "param"): "trace_param_count(pname) * sizeof(GLint)",
+    ("glSamplerParameterIuiv", "param"): "trace_param_count(pname) * sizeof(GLuint)",
+    ("glPointParameterfv", "params"): "trace_param_count(pname) * sizeof(GLfloat)",
+    ("glPointParameteriv", "params"): "trace_param_count(pname) * sizeof(GLint)",
+    ("glGetActiveUniformsiv", "uniformIndices"): "uniformCount * sizeof(GLuint)",
+}
+
+PIXELS = {
+    "glTexImage1D": "trace_image_size(format, type, width, 1, 1, 1)",
+    "glTexImage2D": "trace_image_size(format, type, width, height, 1, 2)",
+    "glTexImage3D": "trace_image_size(format, type, width, height, depth, 3)",
+    "glTexSubImage1D": "trace_image_size(format, type, width, 1, 1, 1)",
+    "glTexSubImage2D": "trace_image_size(format, type, width, height, 1, 2)",
+    "glTexSubImage3D": "trace_image_size(format, type, width, height, depth, 3)",
+    "glCompressedTexImage1D": "imageSize",
+    "glCompressedTexImage2D": "imageSize",
+    "glCompressedTexImage3D": "imageSize",
+    "glCompressedTexSubImage1D": "imageSize",
+    "glCompressedTexSubImage2D": "imageSize",
+    "glCompressedTexSubImage3D": "imageSize",
+}
+
+OFFSETS = {
+    ("glDrawElements", "indices"),
+    ("glDrawElementsBaseVertex", "indices"),
+    ("glDrawElementsInstanced", "indices"),
+    ("glDrawElementsInstancedBaseVertex", "indices"),
+    ("glDrawRangeElements", "indices"),
+    ("glDrawRangeElementsBaseVertex", "indices"),
+    ("glVertexAttribPointer", "pointer"),
+    ("glVertexAttribIPointer", "pointer"),
+}
+
+# (function, param) -> name of the length parameter, or None for NUL-terminated
+STRINGS = {
+    ("glBindAttribLocation", "name"): None,
+    ("glGetAttribLocation", "name"): None,
+    ("glGetUniformLocation", "name"): None,
+    ("glBindFragDataLocation", "name"): None,
+    ("glGetFragDataLocation", "name"): None,
+    ("glBindFragDataLocationIndexed", "name"): None,
+    ("glGetFragDataIndex", "name"): None,
+    ("glGetUniformBlockIndex", "uniformBlockName"): None,
+    ("glDebugMessageInsert", "buf"): "length",
+    ("glDebugMessageInsertARB", "buf"): "length",
+    ("glPushDebugGroup", "message"): "length",
+    ("glObjectLabel", "label"): "length",
+}
+
+# (function, param) -> (count parameter, lengths parameter or None)
+STRING_ARRAYS = {
+    ("glShaderSource", "string"): ("count", "length"),
+    ("glTransformFeedbackVaryings", "varyings"): ("count", None),
+    ("glGetUniformIndices", "uniformNames"): ("uniformCount", None),
+}
+
+OUT_SIZES = {
+    ("glReadPixels", "pixels"): "(size_t)width * (size_t)height * 16 + 64",
+    ("glGetBufferSubData", "data"): "(size_t)size",
+    ("glGetProgramBinary", "binary"): "(size_t)bufSize",
+    ("glGetDebugMessageLog", "messageLog"): "(size_t)bufSize",
+    ("glGetDebugMessageLogARB", "messageLog"): "(size_t)bufSize",
+    ("glGetSynciv", "values"): "(size_t)count * sizeof(GLint)",
+    ("glGetAttachedShaders", "shaders"): "(size_t)maxCount * sizeof(GLuint)",
+    ("glGetActiveUniformsiv", "params"): "(size_t)uniformCount * sizeof(GLint)",
+    ("glGetUniformIndices", "uniformIndices"): "(size_t)uniformCount * sizeof(GLuint)",
+}
+for fn, param in (("glGetDebugMessageLog", "sources"), ("glGetDebugMessageLog", "types"),
+                  ("glGetDebugMessageLog", "ids"), ("glGetDebugMessageLog", "severities"),
+                  ("glGetDebugMessageLog", "lengths")):
+    OUT_SIZES[(fn, param)] = "(size_t)count * 4"
+    OUT_SIZES[(fn + "ARB", param)] = "(size_t)count * 4"
+
+OUT_UNSIZED = {"glGetTexImage", "glGetCompressedTexImage", "glGetPointerv",
+               "glGetBufferPointerv", "glGetVertexAttribPointerv"}
+
+CAPTURE_PRE = {
+    "glUnmapBuffer": "trace_hook_unmap(target);",
+}
+
+CAPTURE_POST = {
+    "glBindBuffer": "trace_hook_bind_buffer(target, buffer);",
+    "glPixelStorei": "trace_hook_pixel_store(pname, param);",
+    "glMapBuffer": "trace_hook_map(target, glad_result, 0, -1, access == GL_READ_ONLY ? GL_MAP_READ_BIT : GL_MAP_WRITE_BIT);",
+    "glMapBufferRange": "trace_hook_map(target, glad_result, offset, length, access);",
+}
+
+REPLAY_ARGS = {
+    ("glMapBufferRange", "access"): "access & ~(GLbitfield)GL_MAP_FLUSH_EXPLICIT_BIT",
+}
+
+REPLAY_POST = {
+    "glCreateProgram": "trace_bind_name(glad_replay, TRACE_NS_PROGRAM, recorded_result, glad_result);",
+    "glCreateShader": "trace_bind_name(glad_replay, TRACE_NS_PROGRAM, recorded_result, glad_result);",
+    "glGetUniformLocation": "trace_bind_location(glad_replay, program, recorded_result, glad_result);",
+    "glFenceSync": "trace_bind_sync(glad_replay, recorded_result, glad_result);",
+    "glUseProgram": "glad_replay->program = program;",
+    "glMapBuffer": "trace_replay_map(glad_replay, target, glad_result);",
+    "glMapBufferRange": "trace_replay_map(glad_replay, target, glad_result);",
+    "glUnmapBuffer": "trace_replay_unmap(glad_replay, target);",
+}
+
+# Explicit flushes are dropped on replay because mapped writes are replayed
+# at unmap time with GL_MAP_FLUSH_EXPLICIT_BIT stripped.
+REPLAY_SKIP = {"glFlushMappedBufferRange", "glDebugMessageCallback",
+               "glDebugMessageCallbackARB"}
+
+FIXED_VECTOR_RE = re.compile(r"^gl\w*?(?P<n>[1-4])N?(?P<t>b|s|i|f|d|ub|us|ui)v$")
+UNIFORM_VECTOR_RE = re.compile(r"^glUniform(?P<n>[1-4])(?P<t>f|i|ui)v$")
+UNIFORM_MATRIX_RE = re.compile(r"^glUniformMatrix(?P<c>[2-4])(x(?P<r>[2-4]))?fv$")
+PACKED_VECTOR_RE = re.compile(r"^gl\w+P[1-4]uiv$")
+
+
+def pointee(param):
+    return param.type.replace("const", "").replace("*", "").strip()
+
+
+def is_pointer(param):
+    return "*" in param.type
+
+
+class Kind:
+    def __init__(self, kind, **args):
+        self.kind = kind
+        self.__dict__.update(args)
+
+
+def classify(fn, param):
+    key = (fn.name, param.name)
+    if param.type in ("GLDEBUGPROC", "GLDEBUGPROCARB"):
+        return Kind("unsupported_scalar")
+    if not is_pointer(param):
+        if param.type == "GLuint" and param.name in NAMESPACES:
+            return Kind("name", ns=NAMESPACES[param.name])
+        if param.type == "GLuint" and param.name == "id" and "Quer" in fn.name:
+            return Kind("name", ns="TRACE_NS_QUERY")
+        if param.type == "GLint" and param.name == "location" \
+                and fn.name.startswith("glUniform"):
+            return Kind("location")
+        if param.type == "GLsync":
+            return Kind("sync")
+        return Kind("scalar")
+
+    count = fn.params[0].name
+    ns = NAMESPACES.get(param.name)
+    if ns is None and param.name == "ids" and "Quer" in fn.name:
+        ns = "TRACE_NS_QUERY"
+
+    if param.type.startswith("const"):
+        if ns and fn.name.startswith("glDelete"):
+            return Kind("names", ns=ns, count=count)
+        if key in OFFSETS:
+            return Kind("offset")
+        if fn.name in PIXELS and param.name in ("pixels", "data"):
+            return Kind("pixels", size=PIXELS[fn.name])
+        if key in BLOB_SIZES:
+            return Kind("blob", size=BLOB_SIZES[key])
+        if key in STRINGS:
+            return Kind("string", length=STRINGS[key])
+        if key in STRING_ARRAYS:
+            count, lengths = STRING_ARRAYS[key]
+            return Kind("strings", count=count, lengths=lengths)
+        for (name, array), (count, lengths) in STRING_ARRAYS.items():
+            if name == fn.name and lengths == param.name:
+                return Kind("strings_lengths")
+        match = UNIFORM_VECTOR_RE.match(fn.name)
+        if match:
+            return Kind("blob", size="count * %s * sizeof(%s)"
+                        % (match.group("n"), pointee(param)))
+        match = UNIFORM_MATRIX_RE.match(fn.name)
+        if match:
+            columns = match.group("c")
+            rows = match.group("r") or columns
+            return Kind("blob", size="count * %s * %s * sizeof(GLfloat)" % (columns, rows))
+        if PACKED_VECTOR_RE.match(fn.name):
+            return Kind("blob", size="sizeof(GLuint)")
+        match = FIXED_VECTOR_RE.match(fn.name)
+        if match and len([p for p in fn.params if is_pointer(p)]) == 1:
+            return Kind("blob", size="%s * sizeof(%s)" % (match.group("n"), pointee(param)))
+        return Kind("unsupported")
+
+    if fn.name.startswith("glGen") and ns:
+        return Kind("gen", ns=ns, count=count)
+    if fn.name in OUT_UNSIZED:
+        return Kind("out_unsupported")
+    return Kind("out", size=OUT_SIZES.get(key, "TRACE_SCRATCH_DEFAULT"))
+
+
+def emit_capture(fn, id, w):
+    kinds = [classify(fn, p) for p in fn.params]
+    w("static %s trace_real_%s = NULL;\n" % (fn.pfn, fn.name))
+    w("static %s APIENTRY trace_%s(%s) {\n" % (fn.ret, fn.name, fn.signature()))
+    if fn.returns():
+        w("\t%s glad_result;\n" % fn.ret)
+    if fn.name in CAPTURE_PRE:
+        w("\t%s\n" % CAPTURE_PRE[fn.name])
+    call = "trace_real_%s(%s)" % (fn.name, fn.arguments())
+    w("\t%s%s;\n" % ("glad_result = " if fn.returns() else "", call))
+    w("\ttrace_begin_call(%d);\n" % id)
+    for p, k in zip(fn.params, kinds):
+        if k.kind in ("scalar", "name", "location", "sync"):
+            w("\ttrace_put(&%s, sizeof(%s));\n" % (p.name, p.name))
+        elif k.kind in ("blob", "pixels"):
+            helper = "trace_put_pixels" if k.kind == "pixels" else "trace_put_data"
+            w("\t%s(%s, %s == NULL ? 0 : (size_t)(%s));\n" % (helper, p.name, p.name, k.size))
+        elif k.kind in ("names", "gen"):
+            w("\ttrace_put_data(%s, %s == NULL ? 0 : (size_t)%s * sizeof(GLuint));\n"
+              % (p.name, p.name, k.count))
+        elif k.kind == "offset":
+            w("\ttrace_put_offset(%s);\n" % p.name)
+        elif k.kind == "string":
+            w("\ttrace_put_string(%s, %s);\n" % (p.name, k.length or "-1"))
+        elif k.kind == "strings":
+            w("\ttrace_put_strings(%s, (const GLchar *const*)%s, %s);\n"
+              % (k.count, p.name, k.lengths or "NULL"))
+        elif k.kind in ("unsupported", "unsupported_scalar"):
+            w("\ttrace_put_unsupported(%s != NULL);\n" % p.name)
+    if fn.returns() and "*" not in fn.ret:
+        w("\ttrace_put(&glad_result, sizeof(glad_result));\n")
+    w("\ttrace_end_call();\n")
+    if fn.name in CAPTURE_POST:
+        w("\t%s\n" % CAPTURE_POST[fn.name])
+    if fn.returns():
+        w("\treturn glad_result;\n")
+    w("}\n")
+
+
+def emit_replay(fn, id, w):
+    kinds = [classify(fn, p) for p in fn.params]
+    w("\tcase %d: {\n" % id)
+    for p, k in zip(fn.params, kinds):
+        if k.kind in ("scalar", "name", "location", "sync"):
+            w("\t\t%s %s;\n" % (p.type, p.name))
+        elif k.kind in ("names", "gen"):
+            w("\t\tconst GLuint *recorded_%s;\n" % p.name)
+            w("\t\tGLuint *%s;\n" % p.name)
+        elif k.kind == "strings":
+            w("\t\tconst GLchar *const*%s;\n" % p.name)
+        elif k.kind in ("unsupported_scalar",):
+            w("\t\t%s %s = NULL;\n" % (p.type, p.name))
+        elif k.kind == "out":
+            w("\t\t%s%s;\n" % (p.type, p.name))
+        else:
+            w("\t\t%s%s;\n" % (p.type if p.type.endswith("*") else p.type + " ", p.name))
+    if fn.returns():
+        w("\t\t%s glad_result;\n" % fn.ret)
+        if "*" not in fn.ret:
+            w("\t\t%s recorded_result;\n" % fn.ret)
+
+    slot = 0
+    for p, k in zip(fn.params, kinds):
+        if k.kind == "scalar":
+            w("\t\ttrace_get(glad_replay, &%s, sizeof(%s));\n" % (p.name, p.name))
+        elif k.kind == "name":
+            w("\t\ttrace_get(glad_replay, &%s, sizeof(%s));\n" % (p.name, p.name))
+            w("\t\t%s = trace_map_name(glad_replay, %s, %s);\n" % (p.name, k.ns, p.name))
+        elif k.kind == "location":
+            w("\t\ttrace_get(glad_replay, &%s, sizeof(%s));\n" % (p.name, p.name))
+            w("\t\t%s = trace_map_location(glad_replay, %s);\n" % (p.name, p.name))
+        elif k.kind == "sync":
+            w("\t\ttrace_get(glad_replay, &%s, sizeof(%s));\n" % (p.name, p.name))
+            w("\t\t%s = trace_map_sync(glad_replay, %s);\n" % (p.name, p.name))
+        elif k.kind in ("blob", "pixels", "string"):
+            w("\t\t%s = (%s)trace_get_data(glad_replay);\n" % (p.name, p.type))
+        elif k.kind == "names":
+            w("\t\trecorded_%s = (const GLuint *)trace_get_data(glad_replay);\n" % p.name)
+            w("\t\t%s = trace_map_names(glad_replay, %d, %s, recorded_%s, %s);\n"
+              % (p.name, slot, k.ns, p.name, k.count))
+            slot += 1
+        elif k.kind == "gen":
+            w("\t\trecorded_%s = (const GLuint *)trace_get_data(glad_replay);\n" % p.name)
+            w("\t\t%s = (GLuint *)trace_scratch(glad_replay, %d, (size_t)%s * sizeof(GLuint));\n"
+              % (p.name, slot, k.count))
+            slot += 1
+        elif k.kind == "offset":
+            w("\t\t%s = trace_get_offset(glad_replay);\n" % p.name)
+        elif k.kind == "strings":
+            w("\t\t%s = trace_get_strings(glad_replay, %d, %s);\n" % (p.name, slot, k.count))
+            slot += 1
+        elif k.kind == "strings_lengths":
+            w("\t\t%s = NULL;\n" % p.name)
+        elif k.kind in ("unsupported", "unsupported_scalar"):
+            w("\t\ttrace_get_unsupported(glad_replay);\n")
+            if k.kind == "unsupported":
+                w("\t\t%s = NULL;\n" % p.name)
+        elif k.kind == "out":
+            w("\t\t%s = (%s)trace_scratch(glad_replay, %d, %s);\n" % (p.name, p.type, slot, k.size))
+            slot += 1
+        elif k.kind == "out_unsupported":
+            w("\t\t%s = NULL;\n" % p.name)
+            w("\t\tglad_replay->unsupported = 1;\n")
+    if fn.returns() and "*" not in fn.ret:
+        w("\t\ttrace_get(glad_replay, &recorded_result, sizeof(recorded_result));\n")
+    if fn.name in REPLAY_SKIP:
+        w("\t\tglad_replay->unsupported = 1;\n")
+    w("\t\tif(glad_replay->unsupported) return 0;\n")
+
+    args = []
+    for p in fn.params:
+        args.append(REPLAY_ARGS.get((fn.name, p.name), p.name))
+    call = "glad_%s(%s)" % (fn.name, ", ".join(args))
+    gen = [(p, k) for p, k in zip(fn.params, kinds) if k.kind == "gen"]
+    if gen:
+        # Names still bound from an earlier --loops pass are reused
+        p, k = gen[0]
+        w("\t\tif(!trace_names_bound(glad_replay, %s, recorded_%s, %s)) {\n"
+          % (k.ns, p.name, k.count))
+        w("\t\t\t%s;\n" % call)
+        w("\t\t\ttrace_bind_names(glad_replay, %s, recorded_%s, %s, %s);\n"
+          % (k.ns, p.name, p.name, k.count))
+        w("\t\t}\n")
+    else:
+        w("\t\t%s%s;\n" % ("glad_result = " if fn.returns() else "", call))
+    for p, k in zip(fn.params, kinds):
+        if k.kind == "names":
+            w("\t\ttrace_unbind_names(glad_replay, %s, recorded_%s, %s);\n"
+              % (k.ns, p.name, k.count))
+    if fn.returns():
+        w("\t\t(void)glad_result;\n")
+        if "*" not in fn.ret:
+            w("\t\t(void)recorded_result;\n")
+    if fn.name in REPLAY_POST:
+        w("\t\t%s\n" % REPLAY_POST[fn.name])
+    w("\t} break;\n")
+
+
+def emit_trace(functions, out):
+    w = out.write
+    w("/*\n\n    GL call trace shims, generated by lib/glad/gen_shims.py from glad.h.\n")
+    w("    Do not edit by hand; included by glad_trace.c.\n\n*/\n\n")
+    w("#define TRACE_FUNCTION_COUNT %d\n\n" % len(functions))
+    w("static const char *trace_names[TRACE_FUNCTION_COUNT] = {\n")
+    for fn in functions:
+        w("\t\"%s\",\n" % fn.name)
+    w("};\n\n")
+
+    for id, fn in enumerate(functions):
+        emit_capture(fn, id, w)
+    w("\n")
+
+    w("static void trace_install(void) {\n")
+    for fn in functions:
+        w("\ttrace_real_%s = glad_%s;\n" % (fn.name, fn.name))
+        w("\tif(trace_real_%s != NULL) glad_%s = trace_%s;\n" % (fn.name, fn.name, fn.name))
+    w("}\n\n")
+
+    w("static void trace_uninstall(void) {\n")
+    for fn in functions:
+        w("\tif(glad_%s == trace_%s) glad_%s = trace_real_%s;\n"
+          % (fn.name, fn.name, fn.name, fn.name))
+    w("}\n\n")
+
+    w("static int trace_replay_call(struct gladTraceReplay *glad_replay, unsigned int id) {\n")
+    w("\tswitch(id) {\n")
+    for id, fn in enumerate(functions):
+        emit_replay(fn, id, w)
+    w("\tdefault:\n")
+    w("\t\treturn 0;\n")
+    w("\t}\n")
+    w("\treturn 1;\n")
+    w("}\n")
+
+
+def main():
+    if len(sys.argv) != 2 or sys.argv[1] not in ("profile", "trace"):
+        sys.stderr.write("usage: gen_shims.py profile|trace\n")
+        return 1
+
+    functions = parse_functions(GLAD_H)
+    if sys.argv[1] == "profile":
+        emit_profile(functions, sys.stdout)
+    else:
+        emit_trace(functions, sys.stdout)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,56 @@
+/*
+
+    GL call profiling interposer for glad.
+
+    Built with GLAD_PROFILE defined, gladProfileEnable() swaps every loaded
+    glad_gl* pointer for a shim that counts calls and CPU time per entry point
+    and charges them to gladProfileScope. gladProfileDisable() puts the raw
+    driver pointers back, so a disabled interposer costs nothing per call.
+    Without GLAD_PROFILE the API is present but inert.
+
+    Call gladProfileEnable() after gladLoadGL(); reloading replaces the shims.
+
+*/
+
+#ifndef __glad_profile_h_
+#define __glad_profile_h_
+
+#include <glad/glad.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define GLAD_PROFILE_MAX_SCOPES 64
+
+struct gladProfileStat {
+    const char *name;
+    unsigned long long calls;
+    unsigned long long nanoseconds;
+};
+
+struct gladProfileScopeStat {
+    unsigned long long calls;
+    unsigned long long nanoseconds;
+};
+
+/* Index of the scope GL calls are attributed to, 0 when outside any scope. */
+GLAPI unsigned int gladProfileScope;
+
+GLAPI int gladProfileEnable(void);
+
+GLAPI void gladProfileDisable(void);
+
+GLAPI int gladProfileEnabled(void);
+
+GLAPI void gladProfileReset(void);
+
+GLAPI unsigned int gladProfileStats(const struct gladProfileStat **stats);
+
+GLAPI const struct gladProfileScopeStat *gladProfileScopeStats(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
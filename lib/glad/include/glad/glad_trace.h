@@ -0,0 +1,82 @@
+/*
+
+    GL call trace capture and replay for glad.
+
+    gladTraceBegin() swaps every loaded glad_gl* pointer for a shim that
+    appends the call and its arguments to a compact binary trace. Buffer,
+    texture and shader data referenced by pointers is written once, later
+    calls with the same bytes refer to it by id. Everything recorded before the first
+    gladTraceFrame() is the setup segment, followed by one segment per frame.
+    The trace stops itself after the requested number of frames.
+
+    The replayer loads a trace into memory and issues the calls against the
+    current context, remapping object names, uniform locations and syncs.
+    Calls whose pointer arguments cannot be sized (client-side arrays,
+    persistent mappings, debug callbacks) are recorded as unsupported and
+    skipped on replay. Frames replayed again after a rewind reuse the names
+    their glGen* calls got the first time, names are only generated again
+    after the trace deleted them.
+
+    Trace layout, all values in host byte order:
+
+        "GLTR" u32 version u32 function_count { u16 length, name }*
+        record*
+
+        call:        u16 id    u32 size  arguments
+        blob:        u16 0xFFFE u32 id   u32 size  pad  bytes
+        buffer data: u16 0xFFFD u32 target u32 blob_id
+        frame:       u16 0xFFFF
+
+    Blob bytes start at a 16-byte aligned file offset, `pad` is the zero
+    filler before them. Pointer arguments are u32 tags: 0 for NULL, a blob
+    id, 0xFFFFFFFE followed by a u64 buffer offset, or 0xFFFFFFFF when
+    unsupported.
+
+*/
+
+#ifndef __glad_trace_h_
+#define __glad_trace_h_
+
+#include <glad/glad.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define GLAD_TRACE_VERSION 1
+
+struct gladTraceReplay;
+
+struct gladTraceReplayStats {
+    unsigned long long calls;
+    unsigned long long skipped;
+    unsigned int frames;
+};
+
+/* Call after gladLoadGL(). Records the setup segment plus `frames` frames. */
+GLAPI int gladTraceBegin(const char *path, unsigned int frames);
+
+/* Marks the end of a frame, ends the trace once enough frames are recorded. */
+GLAPI void gladTraceFrame(void);
+
+GLAPI void gladTraceEnd(void);
+
+GLAPI int gladTraceActive(void);
+
+GLAPI struct gladTraceReplay *gladTraceReplayOpen(const char *path);
+
+/* Plays the next segment, returns 0 at the end of the trace. */
+GLAPI int gladTraceReplayFrame(struct gladTraceReplay *replay);
+
+/* Seeks back to the first frame after the setup segment. */
+GLAPI void gladTraceReplayRewind(struct gladTraceReplay *replay);
+
+GLAPI struct gladTraceReplayStats gladTraceReplayGetStats(const struct gladTraceReplay *replay);
+
+GLAPI void gladTraceReplayClose(struct gladTraceReplay *replay);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,7618 @@
+/*
+
+    GL call profiling shims, generated by lib/glad/gen_shims.py from glad.h.
+    Do not edit by hand.
+
+*/
+
+#include <stddef.h>
+#include <glad/glad_profile.h>
+
+#ifdef GLAD_PROFILE
+
+#if defined(_WIN32) || defined(__CYGWIN__)
+#include <windows.h>
+static unsigned long long glad_profile_now(void) {
+    static LARGE_INTEGER frequency;
+    LARGE_INTEGER counter;
+    if(frequency.QuadPart == 0) QueryPerformanceFrequency(&frequency);
+    QueryPerformanceCounter(&counter);
+    return (unsigned long long)(counter.QuadPart * 1000000000.0 / frequency.QuadPart);
+}
+#else
+#include <time.h>
+static unsigned long long glad_profile_now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (unsigned long long)ts.tv_sec * 1000000000ull + (unsigned long long)ts.tv_nsec;
+}
+#endif
+
+unsigned int gladProfileScope = 0;
+static int profile_enabled = 0;
+static struct gladProfileScopeStat scope_stats[GLAD_PROFILE_MAX_SCOPES];
+static struct gladProfileStat stats[744] = {
+	{"glCullFace", 0, 0},
+	{"glFrontFace", 0, 0},
+	{"glHint", 0, 0},
+	{"glLineWidth", 0, 0},
+	{"glPointSize", 0, 0},
+	{"glPolygonMode", 0, 0},
+	{"glScissor", 0, 0},
+	{"glTexParameterf", 0, 0},
+	{"glTexParameterfv", 0, 0},
+	{"glTexParameteri", 0, 0},
+	{"glTexParameteriv", 0, 0},
+	{"glTexImage1D", 0, 0},
+	{"glTexImage2D", 0, 0},
+	{"glDrawBuffer", 0, 0},
+	{"glClear", 0, 0},
+	{"glClearColor", 0, 0},
+	{"glClearStencil", 0, 0},
+	{"glClearDepth", 0, 0},
+	{"glStencilMask", 0, 0},
+	{"glColorMask", 0, 0},
+	{"glDepthMask", 0, 0},
+	{"glDisable", 0, 0},
+	{"glEnable", 0, 0},
+	{"glFinish", 0, 0},
+	{"glFlush", 0, 0},
+	{"glBlendFunc", 0, 0},
+	{"glLogicOp", 0, 0},
+	{"glStencilFunc", 0, 0},
+	{"glStencilOp", 0, 0},
+	{"glDepthFunc", 0, 0},
+	{"glPixelStoref", 0, 0},
+	{"glPixelStorei", 0, 0},
+	{"glReadBuffer", 0, 0},
+	{"glReadPixels", 0, 0},
+	{"glGetBooleanv", 0, 0},
+	{"glGetDoublev", 0, 0},
+	{"glGetError", 0, 0},
+	{"glGetFloatv", 0, 0},
+	{"glGetIntegerv", 0, 0},
+	{"glGetString", 0, 0},
+	{"glGetTexImage", 0, 0},
+	{"glGetTexParameterfv", 0, 0},
+	{"glGetTexParameteriv", 0, 0},
+	{"glGetTexLevelParameterfv", 0, 0},
+	{"glGetTexLevelParameteriv", 0, 0},
+	{"glIsEnabled", 0, 0},
+	{"glDepthRange", 0, 0},
+	{"glViewport", 0, 0},
+	{"glNewList", 0, 0},
+	{"glEndList", 0, 0},
+	{"glCallList", 0, 0},
+	{"glCallLists", 0, 0},
+	{"glDeleteLists", 0, 0},
+	{"glGenLists", 0, 0},
+	{"glListBase", 0, 0},
+	{"glBegin", 0, 0},
+	{"glBitmap", 0, 0},
+	{"glColor3b", 0, 0},
+	{"glColor3bv", 0, 0},
+	{"glColor3d", 0, 0},
+	{"glColor3dv", 0, 0},
+	{"glColor3f", 0, 0},
+	{"glColor3fv", 0, 0},
+	{"glColor3i", 0, 0},
+	{"glColor3iv", 0, 0},
+	{"glColor3s", 0, 0},
+	{"glColor3sv", 0, 0},
+	{"glColor3ub", 0, 0},
+	{"glColor3ubv", 0, 0},
+	{"glColor3ui", 0, 0},
+	{"glColor3uiv", 0, 0},
+	{"glColor3us", 0, 0},
+	{"glColor3usv", 0, 0},
+	{"glColor4b", 0, 0},
+	{"glColor4bv", 0, 0},
+	{"glColor4d", 0, 0},
+	{"glColor4dv", 0, 0},
+	{"glColor4f", 0, 0},
+	{"glColor4fv", 0, 0},
+	{"glColor4i", 0, 0},
+	{"glColor4iv", 0, 0},
+	{"glColor4s", 0, 0},
+	{"glColor4sv", 0, 0},
+	{"glColor4ub", 0, 0},
+	{"glColor4ubv", 0, 0},
+	{"glColor4ui", 0, 0},
+	{"glColor4uiv", 0, 0},
+	{"glColor4us", 0, 0},
+	{"glColor4usv", 0, 0},
+	{"glEdgeFlag", 0, 0},
+	{"glEdgeFlagv", 0, 0},
+	{"glEnd", 0, 0},
+	{"glIndexd", 0, 0},
+	{"glIndexdv", 0, 0},
+	{"glIndexf", 0, 0},
+	{"glIndexfv", 0, 0},
+	{"glIndexi", 0, 0},
+	{"glIndexiv", 0, 0},
+	{"glIndexs", 0, 0},
+	{"glIndexsv", 0, 0},
+	{"glNormal3b", 0, 0},
+	{"glNormal3bv", 0, 0},
+	{"glNormal3d", 0, 0},
+	{"glNormal3dv", 0, 0},
+	{"glNormal3f", 0, 0},
+	{"glNormal3fv", 0, 0},
+	{"glNormal3i", 0, 0},
+	{"glNormal3iv", 0, 0},
+	{"glNormal3s", 0, 0},
+	{"glNormal3sv", 0, 0},
+	{"glRasterPos2d", 0, 0},
+	{"glRasterPos2dv", 0, 0},
+	{"glRasterPos2f", 0, 0},
+	{"glRasterPos2fv", 0, 0},
+	{"glRasterPos2i", 0, 0},
+	{"glRasterPos2iv", 0, 0},
+	{"glRasterPos2s", 0, 0},
+	{"glRasterPos2sv", 0, 0},
+	{"glRasterPos3d", 0, 0},
+	{"glRasterPos3dv", 0, 0},
+	{"glRasterPos3f", 0, 0},
+	{"glRasterPos3fv", 0, 0},
+	{"glRasterPos3i", 0, 0},
+	{"glRasterPos3iv", 0, 0},
+	{"glRasterPos3s", 0, 0},
+	{"glRasterPos3sv", 0, 0},
+	{"glRasterPos4d", 0, 0},
+	{"glRasterPos4dv", 0, 0},
+	{"glRasterPos4f", 0, 0},
+	{"glRasterPos4fv", 0, 0},
+	{"glRasterPos4i", 0, 0},
+	{"glRasterPos4iv", 0, 0},
+	{"glRasterPos4s", 0, 0},
+	{"glRasterPos4sv", 0, 0},
+	{"glRectd", 0, 0},
+	{"glRectdv", 0, 0},
+	{"glRectf", 0, 0},
+	{"glRectfv", 0, 0},
+	{"glRecti", 0, 0},
+	{"glRectiv", 0, 0},
+	{"glRects", 0, 0},
+	{"glRectsv", 0, 0},
+	{"glTexCoord1d", 0, 0},
+	{"glTexCoord1dv", 0, 0},
+	{"glTexCoord1f", 0, 0},
+	{"glTexCoord1fv", 0, 0},
+	{"glTexCoord1i", 0, 0},
+	{"glTexCoord1iv", 0, 0},
+	{"glTexCoord1s", 0, 0},
+	{"glTexCoord1sv", 0, 0},
+	{"glTexCoord2d", 0, 0},
+	{"glTexCoord2dv", 0, 0},
+	{"glTexCoord2f", 0, 0},
+	{"glTexCoord2fv", 0, 0},
+	{"glTexCoord2i", 0, 0},
+	{"glTexCoord2iv", 0, 0},
+	{"glTexCoord2s", 0, 0},
+	{"glTexCoord2sv", 0, 0},
+	{"glTexCoord3d", 0, 0},
+	{"glTexCoord3dv", 0, 0},
+	{"glTexCoord3f", 0, 0},
+	{"glTexCoord3fv", 0, 0},
+	{"glTexCoord3i", 0, 0},
+	{"glTexCoord3iv", 0, 0},
+	{"glTexCoord3s", 0, 0},
+	{"glTexCoord3sv", 0, 0},
+	{"glTexCoord4d", 0, 0},
+	{"glTexCoord4dv", 0, 0},
+	{"glTexCoord4f", 0, 0},
+	{"glTexCoord4fv", 0, 0},
+	{"glTexCoord4i", 0, 0},
+	{"glTexCoord4iv", 0, 0},
+	{"glTexCoord4s", 0, 0},
+	{"glTexCoord4sv", 0, 0},
+	{"glVertex2d", 0, 0},
+	{"glVertex2dv", 0, 0},
+	{"glVertex2f", 0, 0},
+	{"glVertex2fv", 0, 0},
+	{"glVertex2i", 0, 0},
+	{"glVertex2iv", 0, 0},
+	{"glVertex2s", 0, 0},
+	{"glVertex2sv", 0, 0},
+	{"glVertex3d", 0, 0},
+	{"glVertex3dv", 0, 0},
+	{"glVertex3f", 0, 0},
+	{"glVertex3fv", 0, 0},
+	{"glVertex3i", 0, 0},
+	{"glVertex3iv", 0, 0},
+	{"glVertex3s", 0, 0},
+	{"glVertex3sv", 0, 0},
+	{"glVertex4d", 0, 0},
+	{"glVertex4dv", 0, 0},
+	{"glVertex4f", 0, 0},
+	{"glVertex4fv", 0, 0},
+	{"glVertex4i", 0, 0},
+	{"glVertex4iv", 0, 0},
+	{"glVertex4s", 0, 0},
+	{"glVertex4sv", 0, 0},
+	{"glClipPlane", 0, 0},
+	{"glColorMaterial", 0, 0},
+	{"glFogf", 0, 0},
+	{"glFogfv", 0, 0},
+	{"glFogi", 0, 0},
+	{"glFogiv", 0, 0},
+	{"glLightf", 0, 0},
+	{"glLightfv", 0, 0},
+	{"glLighti", 0, 0},
+	{"glLightiv", 0, 0},
+	{"glLightModelf", 0, 0},
+	{"glLightModelfv", 0, 0},
+	{"glLightModeli", 0, 0},
+	{"glLightModeliv", 0, 0},
+	{"glLineStipple", 0, 0},
+	{"glMaterialf", 0, 0},
+	{"glMaterialfv", 0, 0},
+	{"glMateriali", 0, 0},
+	{"glMaterialiv", 0, 0},
+	{"glPolygonStipple", 0, 0},
+	{"glShadeModel", 0, 0},
+	{"glTexEnvf", 0, 0},
+	{"glTexEnvfv", 0, 0},
+	{"glTexEnvi", 0, 0},
+	{"glTexEnviv", 0, 0},
+	{"glTexGend", 0, 0},
+	{"glTexGendv", 0, 0},
+	{"glTexGenf", 0, 0},
+	{"glTexGenfv", 0, 0},
+	{"glTexGeni", 0, 0},
+	{"glTexGeniv", 0, 0},
+	{"glFeedbackBuffer", 0, 0},
+	{"glSelectBuffer", 0, 0},
+	{"glRenderMode", 0, 0},
+	{"glInitNames", 0, 0},
+	{"glLoadName", 0, 0},
+	{"glPassThrough", 0, 0},
+	{"glPopName", 0, 0},
+	{"glPushName", 0, 0},
+	{"glClearAccum", 0, 0},
+	{"glClearIndex", 0, 0},
+	{"glIndexMask", 0, 0},
+	{"glAccum", 0, 0},
+	{"glPopAttrib", 0, 0},
+	{"glPushAttrib", 0, 0},
+	{"glMap1d", 0, 0},
+	{"glMap1f", 0, 0},
+	{"glMap2d", 0, 0},
+	{"glMap2f", 0, 0},
+	{"glMapGrid1d", 0, 0},
+	{"glMapGrid1f", 0, 0},
+	{"glMapGrid2d", 0, 0},
+	{"glMapGrid2f", 0, 0},
+	{"glEvalCoord1d", 0, 0},
+	{"glEvalCoord1dv", 0, 0},
+	{"glEvalCoord1f", 0, 0},
+	{"glEvalCoord1fv", 0, 0},
+	{"glEvalCoord2d", 0, 0},
+	{"glEvalCoord2dv", 0, 0},
+	{"glEvalCoord2f", 0, 0},
+	{"glEvalCoord2fv", 0, 0},
+	{"glEvalMesh1", 0, 0},
+	{"glEvalPoint1", 0, 0},
+	{"glEvalMesh2", 0, 0},
+	{"glEvalPoint2", 0, 0},
+	{"glAlphaFunc", 0, 0},
+	{"glPixelZoom", 0, 0},
+	{"glPixelTransferf", 0, 0},
+	{"glPixelTransferi", 0, 0},
+	{"glPixelMapfv", 0, 0},
+	{"glPixelMapuiv", 0, 0},
+	{"glPixelMapusv", 0, 0},
+	{"glCopyPixels", 0, 0},
+	{"glDrawPixels", 0, 0},
+	{"glGetClipPlane", 0, 0},
+	{"glGetLightfv", 0, 0},
+	{"glGetLightiv", 0, 0},
+	{"glGetMapdv", 0, 0},
+	{"glGetMapfv", 0, 0},
+	{"glGetMapiv", 0, 0},
+	{"glGetMaterialfv", 0, 0},
+	{"glGetMaterialiv", 0, 0},
+	{"glGetPixelMapfv", 0, 0},
+	{"glGetPixelMapuiv", 0, 0},
+	{"glGetPixelMapusv", 0, 0},
+	{"glGetPolygonStipple", 0, 0},
+	{"glGetTexEnvfv", 0, 0},
+	{"glGetTexEnviv", 0, 0},
+	{"glGetTexGendv", 0, 0},
+	{"glGetTexGenfv", 0, 0},
+	{"glGetTexGeniv", 0, 0},
+	{"glIsList", 0, 0},
+	{"glFrustum", 0, 0},
+	{"glLoadIdentity", 0, 0},
+	{"glLoadMatrixf", 0, 0},
+	{"glLoadMatrixd", 0, 0},
+	{"glMatrixMode", 0, 0},
+	{"glMultMatrixf", 0, 0},
+	{"glMultMatrixd", 0, 0},
+	{"glOrtho", 0, 0},
+	{"glPopMatrix", 0, 0},
+	{"glPushMatrix", 0, 0},
+	{"glRotated", 0, 0},
+	{"glRotatef", 0, 0},
+	{"glScaled", 0, 0},
+	{"glScalef", 0, 0},
+	{"glTranslated", 0, 0},
+	{"glTranslatef", 0, 0},
+	{"glDrawArrays", 0, 0},
+	{"glDrawElements", 0, 0},
+	{"glGetPointerv", 0, 0},
+	{"glPolygonOffset", 0, 0},
+	{"glCopyTexImage1D", 0, 0},
+	{"glCopyTexImage2D", 0, 0},
+	{"glCopyTexSubImage1D", 0, 0},
+	{"glCopyTexSubImage2D", 0, 0},
+	{"glTexSubImage1D", 0, 0},
+	{"glTexSubImage2D", 0, 0},
+	{"glBindTexture", 0, 0},
+	{"glDeleteTextures", 0, 0},
+	{"glGenTextures", 0, 0},
+	{"glIsTexture", 0, 0},
+	{"glArrayElement", 0, 0},
+	{"glColorPointer", 0, 0},
+	{"glDisableClientState", 0, 0},
+	{"glEdgeFlagPointer", 0, 0},
+	{"glEnableClientState", 0, 0},
+	{"glIndexPointer", 0, 0},
+	{"glInterleavedArrays", 0, 0},
+	{"glNormalPointer", 0, 0},
+	{"glTexCoordPointer", 0, 0},
+	{"glVertexPointer", 0, 0},
+	{"glAreTexturesResident", 0, 0},
+	{"glPrioritizeTextures", 0, 0},
+	{"glIndexub", 0, 0},
+	{"glIndexubv", 0, 0},
+	{"glPopClientAttrib", 0, 0},
+	{"glPushClientAttrib", 0, 0},
+	{"glDrawRangeElements", 0, 0},
+	{"glTexImage3D", 0, 0},
+	{"glTexSubImage3D", 0, 0},
+	{"glCopyTexSubImage3D", 0, 0},
+	{"glActiveTexture", 0, 0},
+	{"glSampleCoverage", 0, 0},
+	{"glCompressedTexImage3D", 0, 0},
+	{"glCompressedTexImage2D", 0, 0},
+	{"glCompressedTexImage1D", 0, 0},
+	{"glCompressedTexSubImage3D", 0, 0},
+	{"glCompressedTexSubImage2D", 0, 0},
+	{"glCompressedTexSubImage1D", 0, 0},
+	{"glGetCompressedTexImage", 0, 0},
+	{"glClientActiveTexture", 0, 0},
+	{"glMultiTexCoord1d", 0, 0},
+	{"glMultiTexCoord1dv", 0, 0},
+	{"glMultiTexCoord1f", 0, 0},
+	{"glMultiTexCoord1fv", 0, 0},
+	{"glMultiTexCoord1i", 0, 0},
+	{"glMultiTexCoord1iv", 0, 0},
+	{"glMultiTexCoord1s", 0, 0},
+	{"glMultiTexCoord1sv", 0, 0},
+	{"glMultiTexCoord2d", 0, 0},
+	{"glMultiTexCoord2dv", 0, 0},
+	{"glMultiTexCoord2f", 0, 0},
+	{"glMultiTexCoord2fv", 0, 0},
+	{"glMultiTexCoord2i", 0, 0},
+	{"glMultiTexCoord2iv", 0, 0},
+	{"glMultiTexCoord2s", 0, 0},
+	{"glMultiTexCoord2sv", 0, 0},
+	{"glMultiTexCoord3d", 0, 0},
+	{"glMultiTexCoord3dv", 0, 0},
+	{"glMultiTexCoord3f", 0, 0},
+	{"glMultiTexCoord3fv", 0, 0},
+	{"glMultiTexCoord3i", 0, 0},
+	{"glMultiTexCoord3iv", 0, 0},
+	{"glMultiTexCoord3s", 0, 0},
+	{"glMultiTexCoord3sv", 0, 0},
+	{"glMultiTexCoord4d", 0, 0},
+	{"glMultiTexCoord4dv", 0, 0},
+	{"glMultiTexCoord4f", 0, 0},
+	{"glMultiTexCoord4fv", 0, 0},
+	{"glMultiTexCoord4i", 0, 0},
+	{"glMultiTexCoord4iv", 0, 0},
+	{"glMultiTexCoord4s", 0, 0},
+	{"glMultiTexCoord4sv", 0, 0},
+	{"glLoadTransposeMatrixf", 0, 0},
+	{"glLoadTransposeMatrixd", 0, 0},
+	{"glMultTransposeMatrixf", 0, 0},
+	{"glMultTransposeMatrixd", 0, 0},
+	{"glBlendFuncSeparate", 0, 0},
+	{"glMultiDrawArrays", 0, 0},
+	{"glMultiDrawElements", 0, 0},
+	{"glPointParameterf", 0, 0},
+	{"glPointParameterfv", 0, 0},
+	{"glPointParameteri", 0, 0},
+	{"glPointParameteriv", 0, 0},
+	{"glFogCoordf", 0, 0},
+	{"glFogCoordfv", 0, 0},
+	{"glFogCoordd", 0, 0},
+	{"glFogCoorddv", 0, 0},
+	{"glFogCoordPointer", 0, 0},
+	{"glSecondaryColor3b", 0, 0},
+	{"glSecondaryColor3bv", 0, 0},
+	{"glSecondaryColor3d", 0, 0},
+	{"glSecondaryColor3dv", 0, 0},
+	{"glSecondaryColor3f", 0, 0},
+	{"glSecondaryColor3fv", 0, 0},
+	{"glSecondaryColor3i", 0, 0},
+	{"glSecondaryColor3iv", 0, 0},
+	{"glSecondaryColor3s", 0, 0},
+	{"glSecondaryColor3sv", 0, 0},
+	{"glSecondaryColor3ub", 0, 0},
+	{"glSecondaryColor3ubv", 0, 0},
+	{"glSecondaryColor3ui", 0, 0},
+	{"glSecondaryColor3uiv", 0, 0},
+	{"glSecondaryColor3us", 0, 0},
+	{"glSecondaryColor3usv", 0, 0},
+	{"glSecondaryColorPointer", 0, 0},
+	{"glWindowPos2d", 0, 0},
+	{"glWindowPos2dv", 0, 0},
+	{"glWindowPos2f", 0, 0},
+	{"glWindowPos2fv", 0, 0},
+	{"glWindowPos2i", 0, 0},
+	{"glWindowPos2iv", 0, 0},
+	{"glWindowPos2s", 0, 0},
+	{"glWindowPos2sv", 0, 0},
+	{"glWindowPos3d", 0, 0},
+	{"glWindowPos3dv", 0, 0},
+	{"glWindowPos3f", 0, 0},
+	{"glWindowPos3fv", 0, 0},
+	{"glWindowPos3i", 0, 0},
+	{"glWindowPos3iv", 0, 0},
+	{"glWindowPos3s", 0, 0},
+	{"glWindowPos3sv", 0, 0},
+	{"glBlendColor", 0, 0},
+	{"glBlendEquation", 0, 0},
+	{"glGenQueries", 0, 0},
+	{"glDeleteQueries", 0, 0},
+	{"glIsQuery", 0, 0},
+	{"glBeginQuery", 0, 0},
+	{"glEndQuery", 0, 0},
+	{"glGetQueryiv", 0, 0},
+	{"glGetQueryObjectiv", 0, 0},
+	{"glGetQueryObjectuiv", 0, 0},
+	{"glBindBuffer", 0, 0},
+	{"glDeleteBuffers", 0, 0},
+	{"glGenBuffers", 0, 0},
+	{"glIsBuffer", 0, 0},
+	{"glBufferData", 0, 0},
+	{"glBufferSubData", 0, 0},
+	{"glGetBufferSubData", 0, 0},
+	{"glMapBuffer", 0, 0},
+	{"glUnmapBuffer", 0, 0},
+	{"glGetBufferParameteriv", 0, 0},
+	{"glGetBufferPointerv", 0, 0},
+	{"glBlendEquationSeparate", 0, 0},
+	{"glDrawBuffers", 0, 0},
+	{"glStencilOpSeparate", 0, 0},
+	{"glStencilFuncSeparate", 0, 0},
+	{"glStencilMaskSeparate", 0, 0},
+	{"glAttachShader", 0, 0},
+	{"glBindAttribLocation", 0, 0},
+	{"glCompileShader", 0, 0},
+	{"glCreateProgram", 0, 0},
+	{"glCreateShader", 0, 0},
+	{"glDeleteProgram", 0, 0},
+	{"glDeleteShader", 0, 0},
+	{"glDetachShader", 0, 0},
+	{"glDisableVertexAttribArray", 0, 0},
+	{"glEnableVertexAttribArray", 0, 0},
+	{"glGetActiveAttrib", 0, 0},
+	{"glGetActiveUniform", 0, 0},
+	{"glGetAttachedShaders", 0, 0},
+	{"glGetAttribLocation", 0, 0},
+	{"glGetProgramiv", 0, 0},
+	{"glGetProgramInfoLog", 0, 0},
+	{"glGetShaderiv", 0, 0},
+	{"glGetShaderInfoLog", 0, 0},
+	{"glGetShaderSource", 0, 0},
+	{"glGetUniformLocation", 0, 0},
+	{"glGetUniformfv", 0, 0},
+	{"glGetUniformiv", 0, 0},
+	{"glGetVertexAttribdv", 0, 0},
+	{"glGetVertexAttribfv", 0, 0},
+	{"glGetVertexAttribiv", 0, 0},
+	{"glGetVertexAttribPointerv", 0, 0},
+	{"glIsProgram", 0, 0},
+	{"glIsShader", 0, 0},
+	{"glLinkProgram", 0, 0},
+	{"glShaderSource", 0, 0},
+	{"glUseProgram", 0, 0},
+	{"glUniform1f", 0, 0},
+	{"glUniform2f", 0, 0},
+	{"glUniform3f", 0, 0},
+	{"glUniform4f", 0, 0},
+	{"glUniform1i", 0, 0},
+	{"glUniform2i", 0, 0},
+	{"glUniform3i", 0, 0},
+	{"glUniform4i", 0, 0},
+	{"glUniform1fv", 0, 0},
+	{"glUniform2fv", 0, 0},
+	{"glUniform3fv", 0, 0},
+	{"glUniform4fv", 0, 0},
+	{"glUniform1iv", 0, 0},
+	{"glUniform2iv", 0, 0},
+	{"glUniform3iv", 0, 0},
+	{"glUniform4iv", 0, 0},
+	{"glUniformMatrix2fv", 0, 0},
+	{"glUniformMatrix3fv", 0, 0},
+	{"glUniformMatrix4fv", 0, 0},
+	{"glValidateProgram", 0, 0},
+	{"glVertexAttrib1d", 0, 0},
+	{"glVertexAttrib1dv", 0, 0},
+	{"glVertexAttrib1f", 0, 0},
+	{"glVertexAttrib1fv", 0, 0},
+	{"glVertexAttrib1s", 0, 0},
+	{"glVertexAttrib1sv", 0, 0},
+	{"glVertexAttrib2d", 0, 0},
+	{"glVertexAttrib2dv", 0, 0},
+	{"glVertexAttrib2f", 0, 0},
+	{"glVertexAttrib2fv", 0, 0},
+	{"glVertexAttrib2s", 0, 0},
+	{"glVertexAttrib2sv", 0, 0},
+	{"glVertexAttrib3d", 0, 0},
+	{"glVertexAttrib3dv", 0, 0},
+	{"glVertexAttrib3f", 0, 0},
+	{"glVertexAttrib3fv", 0, 0},
+	{"glVertexAttrib3s", 0, 0},
+	{"glVertexAttrib3sv", 0, 0},
+	{"glVertexAttrib4Nbv", 0, 0},
+	{"glVertexAttrib4Niv", 0, 0},
+	{"glVertexAttrib4Nsv", 0, 0},
+	{"glVertexAttrib4Nub", 0, 0},
+	{"glVertexAttrib4Nubv", 0, 0},
+	{"glVertexAttrib4Nuiv", 0, 0},
+	{"glVertexAttrib4Nusv", 0, 0},
+	{"glVertexAttrib4bv", 0, 0},
+	{"glVertexAttrib4d", 0, 0},
+	{"glVertexAttrib4dv", 0, 0},
+	{"glVertexAttrib4f", 0, 0},
+	{"glVertexAttrib4fv", 0, 0},
+	{"glVertexAttrib4iv", 0, 0},
+	{"glVertexAttrib4s", 0, 0},
+	{"glVertexAttrib4sv", 0, 0},
+	{"glVertexAttrib4ubv", 0, 0},
+	{"glVertexAttrib4uiv", 0, 0},
+	{"glVertexAttrib4usv", 0, 0},
+	{"glVertexAttribPointer", 0, 0},
+	{"glUniformMatrix2x3fv", 0, 0},
+	{"glUniformMatrix3x2fv", 0, 0},
+	{"glUniformMatrix2x4fv", 0, 0},
+	{"glUniformMatrix4x2fv", 0, 0},
+	{"glUniformMatrix3x4fv", 0, 0},
+	{"glUniformMatrix4x3fv", 0, 0},
+	{"glColorMaski", 0, 0},
+	{"glGetBooleani_v", 0, 0},
+	{"glGetIntegeri_v", 0, 0},
+	{"glEnablei", 0, 0},
+	{"glDisablei", 0, 0},
+	{"glIsEnabledi", 0, 0},
+	{"glBeginTransformFeedback", 0, 0},
+	{"glEndTransformFeedback", 0, 0},
+	{"glBindBufferRange", 0, 0},
+	{"glBindBufferBase", 0, 0},
+	{"glTransformFeedbackVaryings", 0, 0},
+	{"glGetTransformFeedbackVarying", 0, 0},
+	{"glClampColor", 0, 0},
+	{"glBeginConditionalRender", 0, 0},
+	{"glEndConditionalRender", 0, 0},
+	{"glVertexAttribIPointer", 0, 0},
+	{"glGetVertexAttribIiv", 0, 0},
+	{"glGetVertexAttribIuiv", 0, 0},
+	{"glVertexAttribI1i", 0, 0},
+	{"glVertexAttribI2i", 0, 0},
+	{"glVertexAttribI3i", 0, 0},
+	{"glVertexAttribI4i", 0, 0},
+	{"glVertexAttribI1ui", 0, 0},
+	{"glVertexAttribI2ui", 0, 0},
+	{"glVertexAttribI3ui", 0, 0},
+	{"glVertexAttribI4ui", 0, 0},
+	{"glVertexAttribI1iv", 0, 0},
+	{"glVertexAttribI2iv", 0, 0},
+	{"glVertexAttribI3iv", 0, 0},
+	{"glVertexAttribI4iv", 0, 0},
+	{"glVertexAttribI1uiv", 0, 0},
+	{"glVertexAttribI2uiv", 0, 0},
+	{"glVertexAttribI3uiv", 0, 0},
+	{"glVertexAttribI4uiv", 0, 0},
+	{"glVertexAttribI4bv", 0, 0},
+	{"glVertexAttribI4sv", 0, 0},
+	{"glVertexAttribI4ubv", 0, 0},
+	{"glVertexAttribI4usv", 0, 0},
+	{"glGetUniformuiv", 0, 0},
+	{"glBindFragDataLocation", 0, 0},
+	{"glGetFragDataLocation", 0, 0},
+	{"glUniform1ui", 0, 0},
+	{"glUniform2ui", 0, 0},
+	{"glUniform3ui", 0, 0},
+	{"glUniform4ui", 0, 0},
+	{"glUniform1uiv", 0, 0},
+	{"glUniform2uiv", 0, 0},
+	{"glUniform3uiv", 0, 0},
+	{"glUniform4uiv", 0, 0},
+	{"glTexParameterIiv", 0, 0},
+	{"glTexParameterIuiv", 0, 0},
+	{"glGetTexParameterIiv", 0, 0},
+	{"glGetTexParameterIuiv", 0, 0},
+	{"glClearBufferiv", 0, 0},
+	{"glClearBufferuiv", 0, 0},
+	{"glClearBufferfv", 0, 0},
+	{"glClearBufferfi", 0, 0},
+	{"glGetStringi", 0, 0},
+	{"glIsRenderbuffer", 0, 0},
+	{"glBindRenderbuffer", 0, 0},
+	{"glDeleteRenderbuffers", 0, 0},
+	{"glGenRenderbuffers", 0, 0},
+	{"glRenderbufferStorage", 0, 0},
+	{"glGetRenderbufferParameteriv", 0, 0},
+	{"glIsFramebuffer", 0, 0},
+	{"glBindFramebuffer", 0, 0},
+	{"glDeleteFramebuffers", 0, 0},
+	{"glGenFramebuffers", 0, 0},
+	{"glCheckFramebufferStatus", 0, 0},
+	{"glFramebufferTexture1D", 0, 0},
+	{"glFramebufferTexture2D", 0, 0},
+	{"glFramebufferTexture3D", 0, 0},
+	{"glFramebufferRenderbuffer", 0, 0},
+	{"glGetFramebufferAttachmentParameteriv", 0, 0},
+	{"glGenerateMipmap", 0, 0},
+	{"glBlitFramebuffer", 0, 0},
+	{"glRenderbufferStorageMultisample", 0, 0},
+	{"glFramebufferTextureLayer", 0, 0},
+	{"glMapBufferRange", 0, 0},
+	{"glFlushMappedBufferRange", 0, 0},
+	{"glBindVertexArray", 0, 0},
+	{"glDeleteVertexArrays", 0, 0},
+	{"glGenVertexArrays", 0, 0},
+	{"glIsVertexArray", 0, 0},
+	{"glDrawArraysInstanced", 0, 0},
+	{"glDrawElementsInstanced", 0, 0},
+	{"glTexBuffer", 0, 0},
+	{"glPrimitiveRestartIndex", 0, 0},
+	{"glCopyBufferSubData", 0, 0},
+	{"glGetUniformIndices", 0, 0},
+	{"glGetActiveUniformsiv", 0, 0},
+	{"glGetActiveUniformName", 0, 0},
+	{"glGetUniformBlockIndex", 0, 0},
+	{"glGetActiveUniformBlockiv", 0, 0},
+	{"glGetActiveUniformBlockName", 0, 0},
+	{"glUniformBlockBinding", 0, 0},
+	{"glDrawElementsBaseVertex", 0, 0},
+	{"glDrawRangeElementsBaseVertex", 0, 0},
+	{"glDrawElementsInstancedBaseVertex", 0, 0},
+	{"glMultiDrawElementsBaseVertex", 0, 0},
+	{"glProvokingVertex", 0, 0},
+	{"glFenceSync", 0, 0},
+	{"glIsSync", 0, 0},
+	{"glDeleteSync", 0, 0},
+	{"glClientWaitSync", 0, 0},
+	{"glWaitSync", 0, 0},
+	{"glGetInteger64v", 0, 0},
+	{"glGetSynciv", 0, 0},
+	{"glGetInteger64i_v", 0, 0},
+	{"glGetBufferParameteri64v", 0, 0},
+	{"glFramebufferTexture", 0, 0},
+	{"glTexImage2DMultisample", 0, 0},
+	{"glTexImage3DMultisample", 0, 0},
+	{"glGetMultisamplefv", 0, 0},
+	{"glSampleMaski", 0, 0},
+	{"glBindFragDataLocationIndexed", 0, 0},
+	{"glGetFragDataIndex", 0, 0},
+	{"glGenSamplers", 0, 0},
+	{"glDeleteSamplers", 0, 0},
+	{"glIsSampler", 0, 0},
+	{"glBindSampler", 0, 0},
+	{"glSamplerParameteri", 0, 0},
+	{"glSamplerParameteriv", 0, 0},
+	{"glSamplerParameterf", 0, 0},
+	{"glSamplerParameterfv", 0, 0},
+	{"glSamplerParameterIiv", 0, 0},
+	{"glSamplerParameterIuiv", 0, 0},
+	{"glGetSamplerParameteriv", 0, 0},
+	{"glGetSamplerParameterIiv", 0, 0},
+	{"glGetSamplerParameterfv", 0, 0},
+	{"glGetSamplerParameterIuiv", 0, 0},
+	{"glQueryCounter", 0, 0},
+	{"glGetQueryObjecti64v", 0, 0},
+	{"glGetQueryObjectui64v", 0, 0},
+	{"glVertexAttribDivisor", 0, 0},
+	{"glVertexAttribP1ui", 0, 0},
+	{"glVertexAttribP1uiv", 0, 0},
+	{"glVertexAttribP2ui", 0, 0},
+	{"glVertexAttribP2uiv", 0, 0},
+	{"glVertexAttribP3ui", 0, 0},
+	{"glVertexAttribP3uiv", 0, 0},
+	{"glVertexAttribP4ui", 0, 0},
+	{"glVertexAttribP4uiv", 0, 0},
+	{"glVertexP2ui", 0, 0},
+	{"glVertexP2uiv", 0, 0},
+	{"glVertexP3ui", 0, 0},
+	{"glVertexP3uiv", 0, 0},
+	{"glVertexP4ui", 0, 0},
+	{"glVertexP4uiv", 0, 0},
+	{"glTexCoordP1ui", 0, 0},
+	{"glTexCoordP1uiv", 0, 0},
+	{"glTexCoordP2ui", 0, 0},
+	{"glTexCoordP2uiv", 0, 0},
+	{"glTexCoordP3ui", 0, 0},
+	{"glTexCoordP3uiv", 0, 0},
+	{"glTexCoordP4ui", 0, 0},
+	{"glTexCoordP4uiv", 0, 0},
+	{"glMultiTexCoordP1ui", 0, 0},
+	{"glMultiTexCoordP1uiv", 0, 0},
+	{"glMultiTexCoordP2ui", 0, 0},
+	{"glMultiTexCoordP2uiv", 0, 0},
+	{"glMultiTexCoordP3ui", 0, 0},
+	{"glMultiTexCoordP3uiv", 0, 0},
+	{"glMultiTexCoordP4ui", 0, 0},
+	{"glMultiTexCoordP4uiv", 0, 0},
+	{"glNormalP3ui", 0, 0},
+	{"glNormalP3uiv", 0, 0},
+	{"glColorP3ui", 0, 0},
+	{"glColorP3uiv", 0, 0},
+	{"glColorP4ui", 0, 0},
+	{"glColorP4uiv", 0, 0},
+	{"glSecondaryColorP3ui", 0, 0},
+	{"glSecondaryColorP3uiv", 0, 0},
+	{"glBufferStorage", 0, 0},
+	{"glDebugMessageControlARB", 0, 0},
+	{"glDebugMessageInsertARB", 0, 0},
+	{"glDebugMessageCallbackARB", 0, 0},
+	{"glGetDebugMessageLogARB", 0, 0},
+	{"glGetProgramBinary", 0, 0},
+	{"glProgramBinary", 0, 0},
+	{"glProgramParameteri", 0, 0},
+	{"glMaxShaderCompilerThreadsARB", 0, 0},
+	{"glDebugMessageControl", 0, 0},
+	{"glDebugMessageInsert", 0, 0},
+	{"glDebugMessageCallback", 0, 0},
+	{"glGetDebugMessageLog", 0, 0},
+	{"glPushDebugGroup", 0, 0},
+	{"glPopDebugGroup", 0, 0},
+	{"glObjectLabel", 0, 0},
+	{"glGetObjectLabel", 0, 0},
+	{"glObjectPtrLabel", 0, 0},
+	{"glGetObjectPtrLabel", 0, 0},
+	{"glMaxShaderCompilerThreadsKHR", 0, 0},
+};
+
+static void glad_profile_record(unsigned int id, unsigned long long start) {
+    unsigned long long elapsed = glad_profile_now() - start;
+    unsigned int scope = gladProfileScope < GLAD_PROFILE_MAX_SCOPES ? gladProfileScope : 0;
+    stats[id].calls++;
+    stats[id].nanoseconds += elapsed;
+    scope_stats[scope].calls++;
+    scope_stats[scope].nanoseconds += elapsed;
+}
+
+static PFNGLCULLFACEPROC real_glCullFace = NULL;
+static void APIENTRY profile_glCullFace(GLenum mode) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glCullFace(mode);
+	glad_profile_record(0, glad_start);
+}
+static PFNGLFRONTFACEPROC real_glFrontFace = NULL;
+static void APIENTRY profile_glFrontFace(GLenum mode) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glFrontFace(mode);
+	glad_profile_record(1, glad_start);
+}
+static PFNGLHINTPROC real_glHint = NULL;
+static void APIENTRY profile_glHint(GLenum target, GLenum mode) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glHint(target, mode);
+	glad_profile_record(2, glad_start);
+}
+static PFNGLLINEWIDTHPROC real_glLineWidth = NULL;
+static void APIENTRY profile_glLineWidth(GLfloat width) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glLineWidth(width);
+	glad_profile_record(3, glad_start);
+}
+static PFNGLPOINTSIZEPROC real_glPointSize = NULL;
+static void APIENTRY profile_glPointSize(GLfloat size) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glPointSize(size);
+	glad_profile_record(4, glad_start);
+}
+static PFNGLPOLYGONMODEPROC real_glPolygonMode = NULL;
+static void APIENTRY profile_glPolygonMode(GLenum face, GLenum mode) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glPolygonMode(face, mode);
+	glad_profile_record(5, glad_start);
+}
+static PFNGLSCISSORPROC real_glScissor = NULL;
+static void APIENTRY profile_glScissor(GLint x, GLint y, GLsizei width, GLsizei height) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glScissor(x, y, width, height);
+	glad_profile_record(6, glad_start);
+}
+static PFNGLTEXPARAMETERFPROC real_glTexParameterf = NULL;
+static void APIENTRY profile_glTexParameterf(GLenum target, GLenum pname, GLfloat param) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glTexParameterf(target, pname, param);
+	glad_profile_record(7, glad_start);
+}
+static PFNGLTEXPARAMETERFVPROC real_glTexParameterfv = NULL;
+static void APIENTRY profile_glTexParameterfv(GLenum target, GLenum pname, const GLfloat *params) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glTexParameterfv(target, pname, params);
+	glad_profile_record(8, glad_start);
+}
+static PFNGLTEXPARAMETERIPROC real_glTexParameteri = NULL;
+static void APIENTRY profile_glTexParameteri(GLenum target, GLenum pname, GLint param) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glTexParameteri(target, pname, param);
+	glad_profile_record(9, glad_start);
+}
+static PFNGLTEXPARAMETERIVPROC real_glTexParameteriv = NULL;
+static void APIENTRY profile_glTexParameteriv(GLenum target, GLenum pname, const GLint *params) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glTexParameteriv(target, pname, params);
+	glad_profile_record(10, glad_start);
+}
+static PFNGLTEXIMAGE1DPROC real_glTexImage1D = NULL;
+static void APIENTRY profile_glTexImage1D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLint border, GLenum format, GLenum type, const void *pixels) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glTexImage1D(target, level, internalformat, width, border, format, type, pixels);
+	glad_profile_record(11, glad_start);
+}
+static PFNGLTEXIMAGE2DPROC real_glTexImage2D = NULL;
+static void APIENTRY profile_glTexImage2D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void *pixels) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glTexImage2D(target, level, internalformat, width, height, border, format, type, pixels);
+	glad_profile_record(12, glad_start);
+}
+static PFNGLDRAWBUFFERPROC real_glDrawBuffer = NULL;
+static void APIENTRY profile_glDrawBuffer(GLenum buf) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glDrawBuffer(buf);
+	glad_profile_record(13, glad_start);
+}
+static PFNGLCLEARPROC real_glClear = NULL;
+static void APIENTRY profile_glClear(GLbitfield mask) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glClear(mask);
+	glad_profile_record(14, glad_start);
+}
+static PFNGLCLEARCOLORPROC real_glClearColor = NULL;
+static void APIENTRY profile_glClearColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glClearColor(red, green, blue, alpha);
+	glad_profile_record(15, glad_start);
+}
+static PFNGLCLEARSTENCILPROC real_glClearStencil = NULL;
+static void APIENTRY profile_glClearStencil(GLint s) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glClearStencil(s);
+	glad_profile_record(16, glad_start);
+}
+static PFNGLCLEARDEPTHPROC real_glClearDepth = NULL;
+static void APIENTRY profile_glClearDepth(GLdouble depth) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glClearDepth(depth);
+	glad_profile_record(17, glad_start);
+}
+static PFNGLSTENCILMASKPROC real_glStencilMask = NULL;
+static void APIENTRY profile_glStencilMask(GLuint mask) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glStencilMask(mask);
+	glad_profile_record(18, glad_start);
+}
+static PFNGLCOLORMASKPROC real_glColorMask = NULL;
+static void APIENTRY profile_glColorMask(GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glColorMask(red, green, blue, alpha);
+	glad_profile_record(19, glad_start);
+}
+static PFNGLDEPTHMASKPROC real_glDepthMask = NULL;
+static void APIENTRY profile_glDepthMask(GLboolean flag) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glDepthMask(flag);
+	glad_profile_record(20, glad_start);
+}
+static PFNGLDISABLEPROC real_glDisable = NULL;
+static void APIENTRY profile_glDisable(GLenum cap) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glDisable(cap);
+	glad_profile_record(21, glad_start);
+}
+static PFNGLENABLEPROC real_glEnable = NULL;
+static void APIENTRY profile_glEnable(GLenum cap) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glEnable(cap);
+	glad_profile_record(22, glad_start);
+}
+static PFNGLFINISHPROC real_glFinish = NULL;
+static void APIENTRY profile_glFinish(void) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glFinish();
+	glad_profile_record(23, glad_start);
+}
+static PFNGLFLUSHPROC real_glFlush = NULL;
+static void APIENTRY profile_glFlush(void) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glFlush();
+	glad_profile_record(24, glad_start);
+}
+static PFNGLBLENDFUNCPROC real_glBlendFunc = NULL;
+static void APIENTRY profile_glBlendFunc(GLenum sfactor, GLenum dfactor) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glBlendFunc(sfactor, dfactor);
+	glad_profile_record(25, glad_start);
+}
+static PFNGLLOGICOPPROC real_glLogicOp = NULL;
+static void APIENTRY profile_glLogicOp(GLenum opcode) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glLogicOp(opcode);
+	glad_profile_record(26, glad_start);
+}
+static PFNGLSTENCILFUNCPROC real_glStencilFunc = NULL;
+static void APIENTRY profile_glStencilFunc(GLenum func, GLint ref, GLuint mask) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glStencilFunc(func, ref, mask);
+	glad_profile_record(27, glad_start);
+}
+static PFNGLSTENCILOPPROC real_glStencilOp = NULL;
+static void APIENTRY profile_glStencilOp(GLenum fail, GLenum zfail, GLenum zpass) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glStencilOp(fail, zfail, zpass);
+	glad_profile_record(28, glad_start);
+}
+static PFNGLDEPTHFUNCPROC real_glDepthFunc = NULL;
+static void APIENTRY profile_glDepthFunc(GLenum func) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glDepthFunc(func);
+	glad_profile_record(29, glad_start);
+}
+static PFNGLPIXELSTOREFPROC real_glPixelStoref = NULL;
+static void APIENTRY profile_glPixelStoref(GLenum pname, GLfloat param) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glPixelStoref(pname, param);
+	glad_profile_record(30, glad_start);
+}
+static PFNGLPIXELSTOREIPROC real_glPixelStorei = NULL;
+static void APIENTRY profile_glPixelStorei(GLenum pname, GLint param) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glPixelStorei(pname, param);
+	glad_profile_record(31, glad_start);
+}
+static PFNGLREADBUFFERPROC real_glReadBuffer = NULL;
+static void APIENTRY profile_glReadBuffer(GLenum src) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glReadBuffer(src);
+	glad_profile_record(32, glad_start);
+}
+static PFNGLREADPIXELSPROC real_glReadPixels = NULL;
+static void APIENTRY profile_glReadPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void *pixels) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glReadPixels(x, y, width, height, format, type, pixels);
+	glad_profile_record(33, glad_start);
+}
+static PFNGLGETBOOLEANVPROC real_glGetBooleanv = NULL;
+static void APIENTRY profile_glGetBooleanv(GLenum pname, GLboolean *data) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glGetBooleanv(pname, data);
+	glad_profile_record(34, glad_start);
+}
+static PFNGLGETDOUBLEVPROC real_glGetDoublev = NULL;
+static void APIENTRY profile_glGetDoublev(GLenum pname, GLdouble *data) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glGetDoublev(pname, data);
+	glad_profile_record(35, glad_start);
+}
+static PFNGLGETERRORPROC real_glGetError = NULL;
+static GLenum APIENTRY profile_glGetError(void) {
+	GLenum glad_result;
+	unsigned long long glad_start = glad_profile_now();
+	glad_result = real_glGetError();
+	glad_profile_record(36, glad_start);
+	return glad_result;
+}
+static PFNGLGETFLOATVPROC real_glGetFloatv = NULL;
+static void APIENTRY profile_glGetFloatv(GLenum pname, GLfloat *data) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glGetFloatv(pname, data);
+	glad_profile_record(37, glad_start);
+}
+static PFNGLGETINTEGERVPROC real_glGetIntegerv = NULL;
+static void APIENTRY profile_glGetIntegerv(GLenum pname, GLint *data) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glGetIntegerv(pname, data);
+	glad_profile_record(38, glad_start);
+}
+static PFNGLGETSTRINGPROC real_glGetString = NULL;
+static const GLubyte * APIENTRY profile_glGetString(GLenum name) {
+	const GLubyte * glad_result;
+	unsigned long long glad_start = glad_profile_now();
+	glad_result = real_glGetString(name);
+	glad_profile_record(39, glad_start);
+	return glad_result;
+}
+static PFNGLGETTEXIMAGEPROC real_glGetTexImage = NULL;
+static void APIENTRY profile_glGetTexImage(GLenum target, GLint level, GLenum format, GLenum type, void *pixels) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glGetTexImage(target, level, format, type, pixels);
+	glad_profile_record(40, glad_start);
+}
+static PFNGLGETTEXPARAMETERFVPROC real_glGetTexParameterfv = NULL;
+static void APIENTRY profile_glGetTexParameterfv(GLenum target, GLenum pname, GLfloat *params) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glGetTexParameterfv(target, pname, params);
+	glad_profile_record(41, glad_start);
+}
+static PFNGLGETTEXPARAMETERIVPROC real_glGetTexParameteriv = NULL;
+static void APIENTRY profile_glGetTexParameteriv(GLenum target, GLenum pname, GLint *params) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glGetTexParameteriv(target, pname, params);
+	glad_profile_record(42, glad_start);
+}
+static PFNGLGETTEXLEVELPARAMETERFVPROC real_glGetTexLevelParameterfv = NULL;
+static void APIENTRY profile_glGetTexLevelParameterfv(GLenum target, GLint level, GLenum pname, GLfloat *params) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glGetTexLevelParameterfv(target, level, pname, params);
+	glad_profile_record(43, glad_start);
+}
+static PFNGLGETTEXLEVELPARAMETERIVPROC real_glGetTexLevelParameteriv = NULL;
+static void APIENTRY profile_glGetTexLevelParameteriv(GLenum target, GLint level, GLenum pname, GLint *params) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glGetTexLevelParameteriv(target, level, pname, params);
+	glad_profile_record(44, glad_start);
+}
+static PFNGLISENABLEDPROC real_glIsEnabled = NULL;
+static GLboolean APIENTRY profile_glIsEnabled(GLenum cap) {
+	GLboolean glad_result;
+	unsigned long long glad_start = glad_profile_now();
+	glad_result = real_glIsEnabled(cap);
+	glad_profile_record(45, glad_start);
+	return glad_result;
+}
+static PFNGLDEPTHRANGEPROC real_glDepthRange = NULL;
+static void APIENTRY profile_glDepthRange(GLdouble n, GLdouble f) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glDepthRange(n, f);
+	glad_profile_record(46, glad_start);
+}
+static PFNGLVIEWPORTPROC real_glViewport = NULL;
+static void APIENTRY profile_glViewport(GLint x, GLint y, GLsizei width, GLsizei height) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glViewport(x, y, width, height);
+	glad_profile_record(47, glad_start);
+}
+static PFNGLNEWLISTPROC real_glNewList = NULL;
+static void APIENTRY profile_glNewList(GLuint list, GLenum mode) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glNewList(list, mode);
+	glad_profile_record(48, glad_start);
+}
+static PFNGLENDLISTPROC real_glEndList = NULL;
+static void APIENTRY profile_glEndList(void) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glEndList();
+	glad_profile_record(49, glad_start);
+}
+static PFNGLCALLLISTPROC real_glCallList = NULL;
+static void APIENTRY profile_glCallList(GLuint list) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glCallList(list);
+	glad_profile_record(50, glad_start);
+}
+static PFNGLCALLLISTSPROC real_glCallLists = NULL;
+static void APIENTRY profile_glCallLists(GLsizei n, GLenum type, const void *lists) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glCallLists(n, type, lists);
+	glad_profile_record(51, glad_start);
+}
+static PFNGLDELETELISTSPROC real_glDeleteLists = NULL;
+static void APIENTRY profile_glDeleteLists(GLuint list, GLsizei range) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glDeleteLists(list, range);
+	glad_profile_record(52, glad_start);
+}
+static PFNGLGENLISTSPROC real_glGenLists = NULL;
+static GLuint APIENTRY profile_glGenLists(GLsizei range) {
+	GLuint glad_result;
+	unsigned long long glad_start = glad_profile_now();
+	glad_result = real_glGenLists(range);
+	glad_profile_record(53, glad_start);
+	return glad_result;
+}
+static PFNGLLISTBASEPROC real_glListBase = NULL;
+static void APIENTRY profile_glListBase(GLuint base) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glListBase(base);
+	glad_profile_record(54, glad_start);
+}
+static PFNGLBEGINPROC real_glBegin = NULL;
+static void APIENTRY profile_glBegin(GLenum mode) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glBegin(mode);
+	glad_profile_record(55, glad_start);
+}
+static PFNGLBITMAPPROC real_glBitmap = NULL;
+static void APIENTRY profile_glBitmap(GLsizei width, GLsizei height, GLfloat xorig, GLfloat yorig, GLfloat xmove, GLfloat ymove, const GLubyte *bitmap) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glBitmap(width, height, xorig, yorig, xmove, ymove, bitmap);
+	glad_profile_record(56, glad_start);
+}
+static PFNGLCOLOR3BPROC real_glColor3b = NULL;
+static void APIENTRY profile_glColor3b(GLbyte red, GLbyte green, GLbyte blue) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glColor3b(red, green, blue);
+	glad_profile_record(57, glad_start);
+}
+static PFNGLCOLOR3BVPROC real_glColor3bv = NULL;
+static void APIENTRY profile_glColor3bv(const GLbyte *v) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glColor3bv(v);
+	glad_profile_record(58, glad_start);
+}
+static PFNGLCOLOR3DPROC real_glColor3d = NULL;
+static void APIENTRY profile_glColor3d(GLdouble red, GLdouble green, GLdouble blue) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glColor3d(red, green, blue);
+	glad_profile_record(59, glad_start);
+}
+static PFNGLCOLOR3DVPROC real_glColor3dv = NULL;
+static void APIENTRY profile_glColor3dv(const GLdouble *v) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glColor3dv(v);
+	glad_profile_record(60, glad_start);
+}
+static PFNGLCOLOR3FPROC real_glColor3f = NULL;
+static void APIENTRY profile_glColor3f(GLfloat red, GLfloat green, GLfloat blue) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glColor3f(red, green, blue);
+	glad_profile_record(61, glad_start);
+}
+static PFNGLCOLOR3FVPROC real_glColor3fv = NULL;
+static void APIENTRY profile_glColor3fv(const GLfloat *v) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glColor3fv(v);
+	glad_profile_record(62, glad_start);
+}
+static PFNGLCOLOR3IPROC real_glColor3i = NULL;
+static void APIENTRY profile_glColor3i(GLint red, GLint green, GLint blue) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glColor3i(red, green, blue);
+	glad_profile_record(63, glad_start);
+}
+static PFNGLCOLOR3IVPROC real_glColor3iv = NULL;
+static void APIENTRY profile_glColor3iv(const GLint *v) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glColor3iv(v);
+	glad_profile_record(64, glad_start);
+}
+static PFNGLCOLOR3SPROC real_glColor3s = NULL;
+static void APIENTRY profile_glColor3s(GLshort red, GLshort green, GLshort blue) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glColor3s(red, green, blue);
+	glad_profile_record(65, glad_start);
+}
+static PFNGLCOLOR3SVPROC real_glColor3sv = NULL;
+static void APIENTRY profile_glColor3sv(const GLshort *v) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glColor3sv(v);
+	glad_profile_record(66, glad_start);
+}
+static PFNGLCOLOR3UBPROC real_glColor3ub = NULL;
+static void APIENTRY profile_glColor3ub(GLubyte red, GLubyte green, GLubyte blue) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glColor3ub(red, green, blue);
+	glad_profile_record(67, glad_start);
+}
+static PFNGLCOLOR3UBVPROC real_glColor3ubv = NULL;
+static void APIENTRY profile_glColor3ubv(const GLubyte *v) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glColor3ubv(v);
+	glad_profile_record(68, glad_start);
+}
+static PFNGLCOLOR3UIPROC real_glColor3ui = NULL;
+static void APIENTRY profile_glColor3ui(GLuint red, GLuint green, GLuint blue) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glColor3ui(red, green, blue);
+	glad_profile_record(69, glad_start);
+}
+static PFNGLCOLOR3UIVPROC real_glColor3uiv = NULL;
+static void APIENTRY profile_glColor3uiv(const GLuint *v) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glColor3uiv(v);
+	glad_profile_record(70, glad_start);
+}
+static PFNGLCOLOR3USPROC real_glColor3us = NULL;
+static void APIENTRY profile_glColor3us(GLushort red, GLushort green, GLushort blue) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glColor3us(red, green, blue);
+	glad_profile_record(71, glad_start);
+}
+static PFNGLCOLOR3USVPROC real_glColor3usv = NULL;
+static void APIENTRY profile_glColor3usv(const GLushort *v) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glColor3usv(v);
+	glad_profile_record(72, glad_start);
+}
+static PFNGLCOLOR4BPROC real_glColor4b = NULL;
+static void APIENTRY profile_glColor4b(GLbyte red, GLbyte green, GLbyte blue, GLbyte alpha) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glColor4b(red, green, blue, alpha);
+	glad_profile_record(73, glad_start);
+}
+static PFNGLCOLOR4BVPROC real_glColor4bv = NULL;
+static void APIENTRY profile_glColor4bv(const GLbyte *v) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glColor4bv(v);
+	glad_profile_record(74, glad_start);
+}
+static PFNGLCOLOR4DPROC real_glColor4d = NULL;
+static void APIENTRY profile_glColor4d(GLdouble red, GLdouble green, GLdouble blue, GLdouble alpha) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glColor4d(red, green, blue, alpha);
+	glad_profile_record(75, glad_start);
+}
+static PFNGLCOLOR4DVPROC real_glColor4dv = NULL;
+static void APIENTRY profile_glColor4dv(const GLdouble *v) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glColor4dv(v);
+	glad_profile_record(76, glad_start);
+}
+static PFNGLCOLOR4FPROC real_glColor4f = NULL;
+static void APIENTRY profile_glColor4f(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glColor4f(red, green, blue, alpha);
+	glad_profile_record(77, glad_start);
+}
+static PFNGLCOLOR4FVPROC real_glColor4fv = NULL;
+static void APIENTRY profile_glColor4fv(const GLfloat *v) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glColor4fv(v);
+	glad_profile_record(78, glad_start);
+}
+static PFNGLCOLOR4IPROC real_glColor4i = NULL;
+static void APIENTRY profile_glColor4i(GLint red, GLint green, GLint blue, GLint alpha) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glColor4i(red, green, blue, alpha);
+	glad_profile_record(79, glad_start);
+}
+static PFNGLCOLOR4IVPROC real_glColor4iv = NULL;
+static void APIENTRY profile_glColor4iv(const GLint *v) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glColor4iv(v);
+	glad_profile_record(80, glad_start);
+}
+static PFNGLCOLOR4SPROC real_glColor4s = NULL;
+static void APIENTRY profile_glColor4s(GLshort red, GLshort green, GLshort blue, GLshort alpha) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glColor4s(red, green, blue, alpha);
+	glad_profile_record(81, glad_start);
+}
+static PFNGLCOLOR4SVPROC real_glColor4sv = NULL;
+static void APIENTRY profile_glColor4sv(const GLshort *v) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glColor4sv(v);
+	glad_profile_record(82, glad_start);
+}
+static PFNGLCOLOR4UBPROC real_glColor4ub = NULL;
+static void APIENTRY profile_glColor4ub(GLubyte red, GLubyte green, GLubyte blue, GLubyte alpha) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glColor4ub(red, green, blue, alpha);
+	glad_profile_record(83, glad_start);
+}
+static PFNGLCOLOR4UBVPROC real_glColor4ubv = NULL;
+static void APIENTRY profile_glColor4ubv(const GLubyte *v) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glColor4ubv(v);
+	glad_profile_record(84, glad_start);
+}
+static PFNGLCOLOR4UIPROC real_glColor4ui = NULL;
+static void APIENTRY profile_glColor4ui(GLuint red, GLuint green, GLuint blue, GLuint alpha) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glColor4ui(red, green, blue, alpha);
+	glad_profile_record(85, glad_start);
+}
+static PFNGLCOLOR4UIVPROC real_glColor4uiv = NULL;
+static void APIENTRY profile_glColor4uiv(const GLuint *v) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glColor4uiv(v);
+	glad_profile_record(86, glad_start);
+}
+static PFNGLCOLOR4USPROC real_glColor4us = NULL;
+static void APIENTRY profile_glColor4us(GLushort red, GLushort green, GLushort blue, GLushort alpha) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glColor4us(red, green, blue, alpha);
+	glad_profile_record(87, glad_start);
+}
+static PFNGLCOLOR4USVPROC real_glColor4usv = NULL;
+static void APIENTRY profile_glColor4usv(const GLushort *v) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glColor4usv(v);
+	glad_profile_record(88, glad_start);
+}
+static PFNGLEDGEFLAGPROC real_glEdgeFlag = NULL;
+static void APIENTRY profile_glEdgeFlag(GLboolean flag) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glEdgeFlag(flag);
+	glad_profile_record(89, glad_start);
+}
+static PFNGLEDGEFLAGVPROC real_glEdgeFlagv = NULL;
+static void APIENTRY profile_glEdgeFlagv(const GLboolean *flag) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glEdgeFlagv(flag);
+	glad_profile_record(90, glad_start);
+}
+static PFNGLENDPROC real_glEnd = NULL;
+static void APIENTRY profile_glEnd(void) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glEnd();
+	glad_profile_record(91, glad_start);
+}
+static PFNGLINDEXDPROC real_glIndexd = NULL;
+static void APIENTRY profile_glIndexd(GLdouble c) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glIndexd(c);
+	glad_profile_record(92, glad_start);
+}
+static PFNGLINDEXDVPROC real_glIndexdv = NULL;
+static void APIENTRY profile_glIndexdv(const GLdouble *c) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glIndexdv(c);
+	glad_profile_record(93, glad_start);
+}
+static PFNGLINDEXFPROC real_glIndexf = NULL;
+static void APIENTRY profile_glIndexf(GLfloat c) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glIndexf(c);
+	glad_profile_record(94, glad_start);
+}
+static PFNGLINDEXFVPROC real_glIndexfv = NULL;
+static void APIENTRY profile_glIndexfv(const GLfloat *c) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glIndexfv(c);
+	glad_profile_record(95, glad_start);
+}
+static PFNGLINDEXIPROC real_glIndexi = NULL;
+static void APIENTRY profile_glIndexi(GLint c) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glIndexi(c);
+	glad_profile_record(96, glad_start);
+}
+static PFNGLINDEXIVPROC real_glIndexiv = NULL;
+static void APIENTRY profile_glIndexiv(const GLint *c) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glIndexiv(c);
+	glad_profile_record(97, glad_start);
+}
+static PFNGLINDEXSPROC real_glIndexs = NULL;
+static void APIENTRY profile_glIndexs(GLshort c) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glIndexs(c);
+	glad_profile_record(98, glad_start);
+}
+static PFNGLINDEXSVPROC real_glIndexsv = NULL;
+static void APIENTRY profile_glIndexsv(const GLshort *c) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glIndexsv(c);
+	glad_profile_record(99, glad_start);
+}
+static PFNGLNORMAL3BPROC real_glNormal3b = NULL;
+static void APIENTRY profile_glNormal3b(GLbyte nx, GLbyte ny, GLbyte nz) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glNormal3b(nx, ny, nz);
+	glad_profile_record(100, glad_start);
+}
+static PFNGLNORMAL3BVPROC real_glNormal3bv = NULL;
+static void APIENTRY profile_glNormal3bv(const GLbyte *v) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glNormal3bv(v);
+	glad_profile_record(101, glad_start);
+}
+static PFNGLNORMAL3DPROC real_glNormal3d = NULL;
+static void APIENTRY profile_glNormal3d(GLdouble nx, GLdouble ny, GLdouble nz) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glNormal3d(nx, ny, nz);
+	glad_profile_record(102, glad_start);
+}
+static PFNGLNORMAL3DVPROC real_glNormal3dv = NULL;
+static void APIENTRY profile_glNormal3dv(const GLdouble *v) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glNormal3dv(v);
+	glad_profile_record(103, glad_start);
+}
+static PFNGLNORMAL3FPROC real_glNormal3f = NULL;
+static void APIENTRY profile_glNormal3f(GLfloat nx, GLfloat ny, GLfloat nz) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glNormal3f(nx, ny, nz);
+	glad_profile_record(104, glad_start);
+}
+static PFNGLNORMAL3FVPROC real_glNormal3fv = NULL;
+static void APIENTRY profile_glNormal3fv(const GLfloat *v) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glNormal3fv(v);
+	glad_profile_record(105, glad_start);
+}
+static PFNGLNORMAL3IPROC real_glNormal3i = NULL;
+static void APIENTRY profile_glNormal3i(GLint nx, GLint ny, GLint nz) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glNormal3i(nx, ny, nz);
+	glad_profile_record(106, glad_start);
+}
+static PFNGLNORMAL3IVPROC real_glNormal3iv = NULL;
+static void APIENTRY profile_glNormal3iv(const GLint *v) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glNormal3iv(v);
+	glad_profile_record(107, glad_start);
+}
+static PFNGLNORMAL3SPROC real_glNormal3s = NULL;
+static void APIENTRY profile_glNormal3s(GLshort nx, GLshort ny, GLshort nz) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glNormal3s(nx, ny, nz);
+	glad_profile_record(108, glad_start);
+}
+static PFNGLNORMAL3SVPROC real_glNormal3sv = NULL;
+static void APIENTRY profile_glNormal3sv(const GLshort *v) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glNormal3sv(v);
+	glad_profile_record(109, glad_start);
+}
+static PFNGLRASTERPOS2DPROC real_glRasterPos2d = NULL;
+static void APIENTRY profile_glRasterPos2d(GLdouble x, GLdouble y) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glRasterPos2d(x, y);
+	glad_profile_record(110, glad_start);
+}
+static PFNGLRASTERPOS2DVPROC real_glRasterPos2dv = NULL;
+static void APIENTRY profile_glRasterPos2dv(const GLdouble *v) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glRasterPos2dv(v);
+	glad_profile_record(111, glad_start);
+}
+static PFNGLRASTERPOS2FPROC real_glRasterPos2f = NULL;
+static void APIENTRY profile_glRasterPos2f(GLfloat x, GLfloat y) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glRasterPos2f(x, y);
+	glad_profile_record(112, glad_start);
+}
+static PFNGLRASTERPOS2FVPROC real_glRasterPos2fv = NULL;
+static void APIENTRY profile_glRasterPos2fv(const GLfloat *v) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glRasterPos2fv(v);
+	glad_profile_record(113, glad_start);
+}
+static PFNGLRASTERPOS2IPROC real_glRasterPos2i = NULL;
+static void APIENTRY profile_glRasterPos2i(GLint x, GLint y) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glRasterPos2i(x, y);
+	glad_profile_record(114, glad_start);
+}
+static PFNGLRASTERPOS2IVPROC real_glRasterPos2iv = NULL;
+static void APIENTRY profile_glRasterPos2iv(const GLint *v) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glRasterPos2iv(v);
+	glad_profile_record(115, glad_start);
+}
+static PFNGLRASTERPOS2SPROC real_glRasterPos2s = NULL;
+static void APIENTRY profile_glRasterPos2s(GLshort x, GLshort y) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glRasterPos2s(x, y);
+	glad_profile_record(116, glad_start);
+}
+static PFNGLRASTERPOS2SVPROC real_glRasterPos2sv = NULL;
+static void APIENTRY profile_glRasterPos2sv(const GLshort *v) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glRasterPos2sv(v);
+	glad_profile_record(117, glad_start);
+}
+static PFNGLRASTERPOS3DPROC real_glRasterPos3d = NULL;
+static void APIENTRY profile_glRasterPos3d(GLdouble x, GLdouble y, GLdouble z) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glRasterPos3d(x, y, z);
+	glad_profile_record(118, glad_start);
+}
+static PFNGLRASTERPOS3DVPROC real_glRasterPos3dv = NULL;
+static void APIENTRY profile_glRasterPos3dv(const GLdouble *v) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glRasterPos3dv(v);
+	glad_profile_record(119, glad_start);
+}
+static PFNGLRASTERPOS3FPROC real_glRasterPos3f = NULL;
+static void APIENTRY profile_glRasterPos3f(GLfloat x, GLfloat y, GLfloat z) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glRasterPos3f(x, y, z);
+	glad_profile_record(120, glad_start);
+}
+static PFNGLRASTERPOS3FVPROC real_glRasterPos3fv = NULL;
+static void APIENTRY profile_glRasterPos3fv(const GLfloat *v) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glRasterPos3fv(v);
+	glad_profile_record(121, glad_start);
+}
+static PFNGLRASTERPOS3IPROC real_glRasterPos3i = NULL;
+static void APIENTRY profile_glRasterPos3i(GLint x, GLint y, GLint z) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glRasterPos3i(x, y, z);
+	glad_profile_record(122, glad_start);
+}
+static PFNGLRASTERPOS3IVPROC real_glRasterPos3iv = NULL;
+static void APIENTRY profile_glRasterPos3iv(const GLint *v) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glRasterPos3iv(v);
+	glad_profile_record(123, glad_start);
+}
+static PFNGLRASTERPOS3SPROC real_glRasterPos3s = NULL;
+static void APIENTRY profile_glRasterPos3s(GLshort x, GLshort y, GLshort z) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glRasterPos3s(x, y, z);
+	glad_profile_record(124, glad_start);
+}
+static PFNGLRASTERPOS3SVPROC real_glRasterPos3sv = NULL;
+static void APIENTRY profile_glRasterPos3sv(const GLshort *v) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glRasterPos3sv(v);
+	glad_profile_record(125, glad_start);
+}
+static PFNGLRASTERPOS4DPROC real_glRasterPos4d = NULL;
+static void APIENTRY profile_glRasterPos4d(GLdouble x, GLdouble y, GLdouble z, GLdouble w) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glRasterPos4d(x, y, z, w);
+	glad_profile_record(126, glad_start);
+}
+static PFNGLRASTERPOS4DVPROC real_glRasterPos4dv = NULL;
+static void APIENTRY profile_glRasterPos4dv(const GLdouble *v) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glRasterPos4dv(v);
+	glad_profile_record(127, glad_start);
+}
+static PFNGLRASTERPOS4FPROC real_glRasterPos4f = NULL;
+static void APIENTRY profile_glRasterPos4f(GLfloat x, GLfloat y, GLfloat z, GLfloat w) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glRasterPos4f(x, y, z, w);
+	glad_profile_record(128, glad_start);
+}
+static PFNGLRASTERPOS4FVPROC real_glRasterPos4fv = NULL;
+static void APIENTRY profile_glRasterPos4fv(const GLfloat *v) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glRasterPos4fv(v);
+	glad_profile_record(129, glad_start);
+}
+static PFNGLRASTERPOS4IPROC real_glRasterPos4i = NULL;
+static void APIENTRY profile_glRasterPos4i(GLint x, GLint y, GLint z, GLint w) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glRasterPos4i(x, y, z, w);
+	glad_profile_record(130, glad_start);
+}
+static PFNGLRASTERPOS4IVPROC real_glRasterPos4iv = NULL;
+static void APIENTRY profile_glRasterPos4iv(const GLint *v) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glRasterPos4iv(v);
+	glad_profile_record(131, glad_start);
+}
+static PFNGLRASTERPOS4SPROC real_glRasterPos4s = NULL;
+static void APIENTRY profile_glRasterPos4s(GLshort x, GLshort y, GLshort z, GLshort w) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glRasterPos4s(x, y, z, w);
+	glad_profile_record(132, glad_start);
+}
+static PFNGLRASTERPOS4SVPROC real_glRasterPos4sv = NULL;
+static void APIENTRY profile_glRasterPos4sv(const GLshort *v) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glRasterPos4sv(v);
+	glad_profile_record(133, glad_start);
+}
+static PFNGLRECTDPROC real_glRectd = NULL;
+static void APIENTRY profile_glRectd(GLdouble x1, GLdouble y1, GLdouble x2, GLdouble y2) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glRectd(x1, y1, x2, y2);
+	glad_profile_record(134, glad_start);
+}
+static PFNGLRECTDVPROC real_glRectdv = NULL;
+static void APIENTRY profile_glRectdv(const GLdouble *v1, const GLdouble *v2) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glRectdv(v1, v2);
+	glad_profile_record(135, glad_start);
+}
+static PFNGLRECTFPROC real_glRectf = NULL;
+static void APIENTRY profile_glRectf(GLfloat x1, GLfloat y1, GLfloat x2, GLfloat y2) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glRectf(x1, y1, x2, y2);
+	glad_profile_record(136, glad_start);
+}
+static PFNGLRECTFVPROC real_glRectfv = NULL;
+static void APIENTRY profile_glRectfv(const GLfloat *v1, const GLfloat *v2) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glRectfv(v1, v2);
+	glad_profile_record(137, glad_start);
+}
+static PFNGLRECTIPROC real_glRecti = NULL;
+static void APIENTRY profile_glRecti(GLint x1, GLint y1, GLint x2, GLint y2) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glRecti(x1, y1, x2, y2);
+	glad_profile_record(138, glad_start);
+}
+static PFNGLRECTIVPROC real_glRectiv = NULL;
+static void APIENTRY profile_glRectiv(const GLint *v1, const GLint *v2) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glRectiv(v1, v2);
+	glad_profile_record(139, glad_start);
+}
+static PFNGLRECTSPROC real_glRects = NULL;
+static void APIENTRY profile_glRects(GLshort x1, GLshort y1, GLshort x2, GLshort y2) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glRects(x1, y1, x2, y2);
+	glad_profile_record(140, glad_start);
+}
+static PFNGLRECTSVPROC real_glRectsv = NULL;
+static void APIENTRY profile_glRectsv(const GLshort *v1, const GLshort *v2) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glRectsv(v1, v2);
+	glad_profile_record(141, glad_start);
+}
+static PFNGLTEXCOORD1DPROC real_glTexCoord1d = NULL;
+static void APIENTRY profile_glTexCoord1d(GLdouble s) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glTexCoord1d(s);
+	glad_profile_record(142, glad_start);
+}
+static PFNGLTEXCOORD1DVPROC real_glTexCoord1dv = NULL;
+static void APIENTRY profile_glTexCoord1dv(const GLdouble *v) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glTexCoord1dv(v);
+	glad_profile_record(143, glad_start);
+}
+static PFNGLTEXCOORD1FPROC real_glTexCoord1f = NULL;
+static void APIENTRY profile_glTexCoord1f(GLfloat s) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glTexCoord1f(s);
+	glad_profile_record(144, glad_start);
+}
+static PFNGLTEXCOORD1FVPROC real_glTexCoord1fv = NULL;
+static void APIENTRY profile_glTexCoord1fv(const GLfloat *v) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glTexCoord1fv(v);
+	glad_profile_record(145, glad_start);
+}
+static PFNGLTEXCOORD1IPROC real_glTexCoord1i = NULL;
+static void APIENTRY profile_glTexCoord1i(GLint s) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glTexCoord1i(s);
+	glad_profile_record(146, glad_start);
+}
+static PFNGLTEXCOORD1IVPROC real_glTexCoord1iv = NULL;
+static void APIENTRY profile_glTexCoord1iv(const GLint *v) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glTexCoord1iv(v);
+	glad_profile_record(147, glad_start);
+}
+static PFNGLTEXCOORD1SPROC real_glTexCoord1s = NULL;
+static void APIENTRY profile_glTexCoord1s(GLshort s) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glTexCoord1s(s);
+	glad_profile_record(148, glad_start);
+}
+static PFNGLTEXCOORD1SVPROC real_glTexCoord1sv = NULL;
+static void APIENTRY profile_glTexCoord1sv(const GLshort *v) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glTexCoord1sv(v);
+	glad_profile_record(149, glad_start);
+}
+static PFNGLTEXCOORD2DPROC real_glTexCoord2d = NULL;
+static void APIENTRY profile_glTexCoord2d(GLdouble s, GLdouble t) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glTexCoord2d(s, t);
+	glad_profile_record(150, glad_start);
+}
+static PFNGLTEXCOORD2DVPROC real_glTexCoord2dv = NULL;
+static void APIENTRY profile_glTexCoord2dv(const GLdouble *v) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glTexCoord2dv(v);
+	glad_profile_record(151, glad_start);
+}
+static PFNGLTEXCOORD2FPROC real_glTexCoord2f = NULL;
+static void APIENTRY profile_glTexCoord2f(GLfloat s, GLfloat t) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glTexCoord2f(s, t);
+	glad_profile_record(152, glad_start);
+}
+static PFNGLTEXCOORD2FVPROC real_glTexCoord2fv = NULL;
+static void APIENTRY profile_glTexCoord2fv(const GLfloat *v) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glTexCoord2fv(v);
+	glad_profile_record(153, glad_start);
+}
+static PFNGLTEXCOORD2IPROC real_glTexCoord2i = NULL;
+static void APIENTRY profile_glTexCoord2i(GLint s, GLint t) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glTexCoord2i(s, t);
+	glad_profile_record(154, glad_start);
+}
+static PFNGLTEXCOORD2IVPROC real_glTexCoord2iv = NULL;
+static void APIENTRY profile_glTexCoord2iv(const GLint *v) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glTexCoord2iv(v);
+	glad_profile_record(155, glad_start);
+}
+static PFNGLTEXCOORD2SPROC real_glTexCoord2s = NULL;
+static void APIENTRY profile_glTexCoord2s(GLshort s, GLshort t) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glTexCoord2s(s, t);
+	glad_profile_record(156, glad_start);
+}
+static PFNGLTEXCOORD2SVPROC real_glTexCoord2sv = NULL;
+static void APIENTRY profile_glTexCoord2sv(const GLshort *v) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glTexCoord2sv(v);
+	glad_profile_record(157, glad_start);
+}
+static PFNGLTEXCOORD3DPROC real_glTexCoord3d = NULL;
+static void APIENTRY profile_glTexCoord3d(GLdouble s, GLdouble t, GLdouble r) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glTexCoord3d(s, t, r);
+	glad_profile_record(158, glad_start);
+}
+static PFNGLTEXCOORD3DVPROC real_glTexCoord3dv = NULL;
+static void APIENTRY profile_glTexCoord3dv(const GLdouble *v) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glTexCoord3dv(v);
+	glad_profile_record(159, glad_start);
+}
+static PFNGLTEXCOORD3FPROC real_glTexCoord3f = NULL;
+static void APIENTRY profile_glTexCoord3f(GLfloat s, GLfloat t, GLfloat r) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glTexCoord3f(s, t, r);
+	glad_profile_record(160, glad_start);
+}
+static PFNGLTEXCOORD3FVPROC real_glTexCoord3fv = NULL;
+static void APIENTRY profile_glTexCoord3fv(const GLfloat *v) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glTexCoord3fv(v);
+	glad_profile_record(161, glad_start);
+}
+static PFNGLTEXCOORD3IPROC real_glTexCoord3i = NULL;
+static void APIENTRY profile_glTexCoord3i(GLint s, GLint t, GLint r) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glTexCoord3i(s, t, r);
+	glad_profile_record(162, glad_start);
+}
+static PFNGLTEXCOORD3IVPROC real_glTexCoord3iv = NULL;
+static void APIENTRY profile_glTexCoord3iv(const GLint *v) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glTexCoord3iv(v);
+	glad_profile_record(163, glad_start);
+}
+static PFNGLTEXCOORD3SPROC real_glTexCoord3s = NULL;
+static void APIENTRY profile_glTexCoord3s(GLshort s, GLshort t, GLshort r) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glTexCoord3s(s, t, r);
+	glad_profile_record(164, glad_start);
+}
+static PFNGLTEXCOORD3SVPROC real_glTexCoord3sv = NULL;
+static void APIENTRY profile_glTexCoord3sv(const GLshort *v) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glTexCoord3sv(v);
+	glad_profile_record(165, glad_start);
+}
+static PFNGLTEXCOORD4DPROC real_glTexCoord4d = NULL;
+static void APIENTRY profile_glTexCoord4d(GLdouble s, GLdouble t, GLdouble r, GLdouble q) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glTexCoord4d(s, t, r, q);
+	glad_profile_record(166, glad_start);
+}
+static PFNGLTEXCOORD4DVPROC real_glTexCoord4dv = NULL;
+static void APIENTRY profile_glTexCoord4dv(const GLdouble *v) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glTexCoord4dv(v);
+	glad_profile_record(167, glad_start);
+}
+static PFNGLTEXCOORD4FPROC real_glTexCoord4f = NULL;
+static void APIENTRY profile_glTexCoord4f(GLfloat s, GLfloat t, GLfloat r, GLfloat q) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glTexCoord4f(s, t, r, q);
+	glad_profile_record(168, glad_start);
+}
+static PFNGLTEXCOORD4FVPROC real_glTexCoord4fv = NULL;
+static void APIENTRY profile_glTexCoord4fv(const GLfloat *v) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glTexCoord4fv(v);
+	glad_profile_record(169, glad_start);
+}
+static PFNGLTEXCOORD4IPROC real_glTexCoord4i = NULL;
+static void APIENTRY profile_glTexCoord4i(GLint s, GLint t, GLint r, GLint q) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glTexCoord4i(s, t, r, q);
+	glad_profile_record(170, glad_start);
+}
+static PFNGLTEXCOORD4IVPROC real_glTexCoord4iv = NULL;
+static void APIENTRY profile_glTexCoord4iv(const GLint *v) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glTexCoord4iv(v);
+	glad_profile_record(171, glad_start);
+}
+static PFNGLTEXCOORD4SPROC real_glTexCoord4s = NULL;
+static void APIENTRY profile_glTexCoord4s(GLshort s, GLshort t, GLshort r, GLshort q) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glTexCoord4s(s, t, r, q);
+	glad_profile_record(172, glad_start);
+}
+static PFNGLTEXCOORD4SVPROC real_glTexCoord4sv = NULL;
+static void APIENTRY profile_glTexCoord4sv(const GLshort *v) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glTexCoord4sv(v);
+	glad_profile_record(173, glad_start);
+}
+static PFNGLVERTEX2DPROC real_glVertex2d = NULL;
+static void APIENTRY profile_glVertex2d(GLdouble x, GLdouble y) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glVertex2d(x, y);
+	glad_profile_record(174, glad_start);
+}
+static PFNGLVERTEX2DVPROC real_glVertex2dv = NULL;
+static void APIENTRY profile_glVertex2dv(const GLdouble *v) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glVertex2dv(v);
+	glad_profile_record(175, glad_start);
+}
+static PFNGLVERTEX2FPROC real_glVertex2f = NULL;
+static void APIENTRY profile_glVertex2f(GLfloat x, GLfloat y) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glVertex2f(x, y);
+	glad_profile_record(176, glad_start);
+}
+static PFNGLVERTEX2FVPROC real_glVertex2fv = NULL;
+static void APIENTRY profile_glVertex2fv(const GLfloat *v) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glVertex2fv(v);
+	glad_profile_record(177, glad_start);
+}
+static PFNGLVERTEX2IPROC real_glVertex2i = NULL;
+static void APIENTRY profile_glVertex2i(GLint x, GLint y) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glVertex2i(x, y);
+	glad_profile_record(178, glad_start);
+}
+static PFNGLVERTEX2IVPROC real_glVertex2iv = NULL;
+static void APIENTRY profile_glVertex2iv(const GLint *v) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glVertex2iv(v);
+	glad_profile_record(179, glad_start);
+}
+static PFNGLVERTEX2SPROC real_glVertex2s = NULL;
+static void APIENTRY profile_glVertex2s(GLshort x, GLshort y) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glVertex2s(x, y);
+	glad_profile_record(180, glad_start);
+}
+static PFNGLVERTEX2SVPROC real_glVertex2sv = NULL;
+static void APIENTRY profile_glVertex2sv(const GLshort *v) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glVertex2sv(v);
+	glad_profile_record(181, glad_start);
+}
+static PFNGLVERTEX3DPROC real_glVertex3d = NULL;
+static void APIENTRY profile_glVertex3d(GLdouble x, GLdouble y, GLdouble z) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glVertex3d(x, y, z);
+	glad_profile_record(182, glad_start);
+}
+static PFNGLVERTEX3DVPROC real_glVertex3dv = NULL;
+static void APIENTRY profile_glVertex3dv(const GLdouble *v) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glVertex3dv(v);
+	glad_profile_record(183, glad_start);
+}
+static PFNGLVERTEX3FPROC real_glVertex3f = NULL;
+static void APIENTRY profile_glVertex3f(GLfloat x, GLfloat y, GLfloat z) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glVertex3f(x, y, z);
+	glad_profile_record(184, glad_start);
+}
+static PFNGLVERTEX3FVPROC real_glVertex3fv = NULL;
+static void APIENTRY profile_glVertex3fv(const GLfloat *v) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glVertex3fv(v);
+	glad_profile_record(185, glad_start);
+}
+static PFNGLVERTEX3IPROC real_glVertex3i = NULL;
+static void APIENTRY profile_glVertex3i(GLint x, GLint y, GLint z) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glVertex3i(x, y, z);
+	glad_profile_record(186, glad_start);
+}
+static PFNGLVERTEX3IVPROC real_glVertex3iv = NULL;
+static void APIENTRY profile_glVertex3iv(const GLint *v) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glVertex3iv(v);
+	glad_profile_record(187, glad_start);
+}
+static PFNGLVERTEX3SPROC real_glVertex3s = NULL;
+static void APIENTRY profile_glVertex3s(GLshort x, GLshort y, GLshort z) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glVertex3s(x, y, z);
+	glad_profile_record(188, glad_start);
+}
+static PFNGLVERTEX3SVPROC real_glVertex3sv = NULL;
+static void APIENTRY profile_glVertex3sv(const GLshort *v) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glVertex3sv(v);
+	glad_profile_record(189, glad_start);
+}
+static PFNGLVERTEX4DPROC real_glVertex4d = NULL;
+static void APIENTRY profile_glVertex4d(GLdouble x, GLdouble y, GLdouble z, GLdouble w) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glVertex4d(x, y, z, w);
+	glad_profile_record(190, glad_start);
+}
+static PFNGLVERTEX4DVPROC real_glVertex4dv = NULL;
+static void APIENTRY profile_glVertex4dv(const GLdouble *v) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glVertex4dv(v);
+	glad_profile_record(191, glad_start);
+}
+static PFNGLVERTEX4FPROC real_glVertex4f = NULL;
+static void APIENTRY profile_glVertex4f(GLfloat x, GLfloat y, GLfloat z, GLfloat w) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glVertex4f(x, y, z, w);
+	glad_profile_record(192, glad_start);
+}
+static PFNGLVERTEX4FVPROC real_glVertex4fv = NULL;
+static void APIENTRY profile_glVertex4fv(const GLfloat *v) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glVertex4fv(v);
+	glad_profile_record(193, glad_start);
+}
+static PFNGLVERTEX4IPROC real_glVertex4i = NULL;
+static void APIENTRY profile_glVertex4i(GLint x, GLint y, GLint z, GLint w) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glVertex4i(x, y, z, w);
+	glad_profile_record(194, glad_start);
+}
+static PFNGLVERTEX4IVPROC real_glVertex4iv = NULL;
+static void APIENTRY profile_glVertex4iv(const GLint *v) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glVertex4iv(v);
+	glad_profile_record(195, glad_start);
+}
+static PFNGLVERTEX4SPROC real_glVertex4s = NULL;
+static void APIENTRY profile_glVertex4s(GLshort x, GLshort y, GLshort z, GLshort w) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glVertex4s(x, y, z, w);
+	glad_profile_record(196, glad_start);
+}
+static PFNGLVERTEX4SVPROC real_glVertex4sv = NULL;
+static void APIENTRY profile_glVertex4sv(const GLshort *v) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glVertex4sv(v);
+	glad_profile_record(197, glad_start);
+}
+static PFNGLCLIPPLANEPROC real_glClipPlane = NULL;
+static void APIENTRY profile_glClipPlane(GLenum plane, const GLdouble *equation) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glClipPlane(plane, equation);
+	glad_profile_record(198, glad_start);
+}
+static PFNGLCOLORMATERIALPROC real_glColorMaterial = NULL;
+static void APIENTRY profile_glColorMaterial(GLenum face, GLenum mode) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glColorMaterial(face, mode);
+	glad_profile_record(199, glad_start);
+}
+static PFNGLFOGFPROC real_glFogf = NULL;
+static void APIENTRY profile_glFogf(GLenum pname, GLfloat param) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glFogf(pname, param);
+	glad_profile_record(200, glad_start);
+}
+static PFNGLFOGFVPROC real_glFogfv = NULL;
+static void APIENTRY profile_glFogfv(GLenum pname, const GLfloat *params) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glFogfv(pname, params);
+	glad_profile_record(201, glad_start);
+}
+static PFNGLFOGIPROC real_glFogi = NULL;
+static void APIENTRY profile_glFogi(GLenum pname, GLint param) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glFogi(pname, param);
+	glad_profile_record(202, glad_start);
+}
+static PFNGLFOGIVPROC real_glFogiv = NULL;
+static void APIENTRY profile_glFogiv(GLenum pname, const GLint *params) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glFogiv(pname, params);
+	glad_profile_record(203, glad_start);
+}
+static PFNGLLIGHTFPROC real_glLightf = NULL;
+static void APIENTRY profile_glLightf(GLenum light, GLenum pname, GLfloat param) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glLightf(light, pname, param);
+	glad_profile_record(204, glad_start);
+}
+static PFNGLLIGHTFVPROC real_glLightfv = NULL;
+static void APIENTRY profile_glLightfv(GLenum light, GLenum pname, const GLfloat *params) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glLightfv(light, pname, params);
+	glad_profile_record(205, glad_start);
+}
+static PFNGLLIGHTIPROC real_glLighti = NULL;
+static void APIENTRY profile_glLighti(GLenum light, GLenum pname, GLint param) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glLighti(light, pname, param);
+	glad_profile_record(206, glad_start);
+}
+static PFNGLLIGHTIVPROC real_glLightiv = NULL;
+static void APIENTRY profile_glLightiv(GLenum light, GLenum pname, const GLint *params) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glLightiv(light, pname, params);
+	glad_profile_record(207, glad_start);
+}
+static PFNGLLIGHTMODELFPROC real_glLightModelf = NULL;
+static void APIENTRY profile_glLightModelf(GLenum pname, GLfloat param) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glLightModelf(pname, param);
+	glad_profile_record(208, glad_start);
+}
+static PFNGLLIGHTMODELFVPROC real_glLightModelfv = NULL;
+static void APIENTRY profile_glLightModelfv(GLenum pname, const GLfloat *params) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glLightModelfv(pname, params);
+	glad_profile_record(209, glad_start);
+}
+static PFNGLLIGHTMODELIPROC real_glLightModeli = NULL;
+static void APIENTRY profile_glLightModeli(GLenum pname, GLint param) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glLightModeli(pname, param);
+	glad_profile_record(210, glad_start);
+}
+static PFNGLLIGHTMODELIVPROC real_glLightModeliv = NULL;
+static void APIENTRY profile_glLightModeliv(GLenum pname, const GLint *params) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glLightModeliv(pname, params);
+	glad_profile_record(211, glad_start);
+}
+static PFNGLLINESTIPPLEPROC real_glLineStipple = NULL;
+static void APIENTRY profile_glLineStipple(GLint factor, GLushort pattern) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glLineStipple(factor, pattern);
+	glad_profile_record(212, glad_start);
+}
+static PFNGLMATERIALFPROC real_glMaterialf = NULL;
+static void APIENTRY profile_glMaterialf(GLenum face, GLenum pname, GLfloat param) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glMaterialf(face, pname, param);
+	glad_profile_record(213, glad_start);
+}
+static PFNGLMATERIALFVPROC real_glMaterialfv = NULL;
+static void APIENTRY profile_glMaterialfv(GLenum face, GLenum pname, const GLfloat *params) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glMaterialfv(face, pname, params);
+	glad_profile_record(214, glad_start);
+}
+static PFNGLMATERIALIPROC real_glMateriali = NULL;
+static void APIENTRY profile_glMateriali(GLenum face, GLenum pname, GLint param) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glMateriali(face, pname, param);
+	glad_profile_record(215, glad_start);
+}
+static PFNGLMATERIALIVPROC real_glMaterialiv = NULL;
+static void APIENTRY profile_glMaterialiv(GLenum face, GLenum pname, const GLint *params) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glMaterialiv(face, pname, params);
+	glad_profile_record(216, glad_start);
+}
+static PFNGLPOLYGONSTIPPLEPROC real_glPolygonStipple = NULL;
+static void APIENTRY profile_glPolygonStipple(const GLubyte *mask) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glPolygonStipple(mask);
+	glad_profile_record(217, glad_start);
+}
+static PFNGLSHADEMODELPROC real_glShadeModel = NULL;
+static void APIENTRY profile_glShadeModel(GLenum mode) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glShadeModel(mode);
+	glad_profile_record(218, glad_start);
+}
+static PFNGLTEXENVFPROC real_glTexEnvf = NULL;
+static void APIENTRY profile_glTexEnvf(GLenum target, GLenum pname, GLfloat param) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glTexEnvf(target, pname, param);
+	glad_profile_record(219, glad_start);
+}
+static PFNGLTEXENVFVPROC real_glTexEnvfv = NULL;
+static void APIENTRY profile_glTexEnvfv(GLenum target, GLenum pname, const GLfloat *params) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glTexEnvfv(target, pname, params);
+	glad_profile_record(220, glad_start);
+}
+static PFNGLTEXENVIPROC real_glTexEnvi = NULL;
+static void APIENTRY profile_glTexEnvi(GLenum target, GLenum pname, GLint param) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glTexEnvi(target, pname, param);
+	glad_profile_record(221, glad_start);
+}
+static PFNGLTEXENVIVPROC real_glTexEnviv = NULL;
+static void APIENTRY profile_glTexEnviv(GLenum target, GLenum pname, const GLint *params) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glTexEnviv(target, pname, params);
+	glad_profile_record(222, glad_start);
+}
+static PFNGLTEXGENDPROC real_glTexGend = NULL;
+static void APIENTRY profile_glTexGend(GLenum coord, GLenum pname, GLdouble param) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glTexGend(coord, pname, param);
+	glad_profile_record(223, glad_start);
+}
+static PFNGLTEXGENDVPROC real_glTexGendv = NULL;
+static void APIENTRY profile_glTexGendv(GLenum coord, GLenum pname, const GLdouble *params) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glTexGendv(coord, pname, params);
+	glad_profile_record(224, glad_start);
+}
+static PFNGLTEXGENFPROC real_glTexGenf = NULL;
+static void APIENTRY profile_glTexGenf(GLenum coord, GLenum pname, GLfloat param) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glTexGenf(coord, pname, param);
+	glad_profile_record(225, glad_start);
+}
+static PFNGLTEXGENFVPROC real_glTexGenfv = NULL;
+static void APIENTRY profile_glTexGenfv(GLenum coord, GLenum pname, const GLfloat *params) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glTexGenfv(coord, pname, params);
+	glad_profile_record(226, glad_start);
+}
+static PFNGLTEXGENIPROC real_glTexGeni = NULL;
+static void APIENTRY profile_glTexGeni(GLenum coord, GLenum pname, GLint param) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glTexGeni(coord, pname, param);
+	glad_profile_record(227, glad_start);
+}
+static PFNGLTEXGENIVPROC real_glTexGeniv = NULL;
+static void APIENTRY profile_glTexGeniv(GLenum coord, GLenum pname, const GLint *params) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glTexGeniv(coord, pname, params);
+	glad_profile_record(228, glad_start);
+}
+static PFNGLFEEDBACKBUFFERPROC real_glFeedbackBuffer = NULL;
+static void APIENTRY profile_glFeedbackBuffer(GLsizei size, GLenum type, GLfloat *buffer) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glFeedbackBuffer(size, type, buffer);
+	glad_profile_record(229, glad_start);
+}
+static PFNGLSELECTBUFFERPROC real_glSelectBuffer = NULL;
+static void APIENTRY profile_glSelectBuffer(GLsizei size, GLuint *buffer) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glSelectBuffer(size, buffer);
+	glad_profile_record(230, glad_start);
+}
+static PFNGLRENDERMODEPROC real_glRenderMode = NULL;
+static GLint APIENTRY profile_glRenderMode(GLenum mode) {
+	GLint glad_result;
+	unsigned long long glad_start = glad_profile_now();
+	glad_result = real_glRenderMode(mode);
+	glad_profile_record(231, glad_start);
+	return glad_result;
+}
+static PFNGLINITNAMESPROC real_glInitNames = NULL;
+static void APIENTRY profile_glInitNames(void) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glInitNames();
+	glad_profile_record(232, glad_start);
+}
+static PFNGLLOADNAMEPROC real_glLoadName = NULL;
+static void APIENTRY profile_glLoadName(GLuint name) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glLoadName(name);
+	glad_profile_record(233, glad_start);
+}
+static PFNGLPASSTHROUGHPROC real_glPassThrough = NULL;
+static void APIENTRY profile_glPassThrough(GLfloat token) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glPassThrough(token);
+	glad_profile_record(234, glad_start);
+}
+static PFNGLPOPNAMEPROC real_glPopName = NULL;
+static void APIENTRY profile_glPopName(void) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glPopName();
+	glad_profile_record(235, glad_start);
+}
+static PFNGLPUSHNAMEPROC real_glPushName = NULL;
+static void APIENTRY profile_glPushName(GLuint name) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glPushName(name);
+	glad_profile_record(236, glad_start);
+}
+static PFNGLCLEARACCUMPROC real_glClearAccum = NULL;
+static void APIENTRY profile_glClearAccum(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glClearAccum(red, green, blue, alpha);
+	glad_profile_record(237, glad_start);
+}
+static PFNGLCLEARINDEXPROC real_glClearIndex = NULL;
+static void APIENTRY profile_glClearIndex(GLfloat c) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glClearIndex(c);
+	glad_profile_record(238, glad_start);
+}
+static PFNGLINDEXMASKPROC real_glIndexMask = NULL;
+static void APIENTRY profile_glIndexMask(GLuint mask) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glIndexMask(mask);
+	glad_profile_record(239, glad_start);
+}
+static PFNGLACCUMPROC real_glAccum = NULL;
+static void APIENTRY profile_glAccum(GLenum op, GLfloat value) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glAccum(op, value);
+	glad_profile_record(240, glad_start);
+}
+static PFNGLPOPATTRIBPROC real_glPopAttrib = NULL;
+static void APIENTRY profile_glPopAttrib(void) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glPopAttrib();
+	glad_profile_record(241, glad_start);
+}
+static PFNGLPUSHATTRIBPROC real_glPushAttrib = NULL;
+static void APIENTRY profile_glPushAttrib(GLbitfield mask) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glPushAttrib(mask);
+	glad_profile_record(242, glad_start);
+}
+static PFNGLMAP1DPROC real_glMap1d = NULL;
+static void APIENTRY profile_glMap1d(GLenum target, GLdouble u1, GLdouble u2, GLint stride, GLint order, const GLdouble *points) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glMap1d(target, u1, u2, stride, order, points);
+	glad_profile_record(243, glad_start);
+}
+static PFNGLMAP1FPROC real_glMap1f = NULL;
+static void APIENTRY profile_glMap1f(GLenum target, GLfloat u1, GLfloat u2, GLint stride, GLint order, const GLfloat *points) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glMap1f(target, u1, u2, stride, order, points);
+	glad_profile_record(244, glad_start);
+}
+static PFNGLMAP2DPROC real_glMap2d = NULL;
+static void APIENTRY profile_glMap2d(GLenum target, GLdouble u1, GLdouble u2, GLint ustride, GLint uorder, GLdouble v1, GLdouble v2, GLint vstride, GLint vorder, const GLdouble *points) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glMap2d(target, u1, u2, ustride, uorder, v1, v2, vstride, vorder, points);
+	glad_profile_record(245, glad_start);
+}
+static PFNGLMAP2FPROC real_glMap2f = NULL;
+static void APIENTRY profile_glMap2f(GLenum target, GLfloat u1, GLfloat u2, GLint ustride, GLint uorder, GLfloat v1, GLfloat v2, GLint vstride, GLint vorder, const GLfloat *points) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glMap2f(target, u1, u2, ustride, uorder, v1, v2, vstride, vorder, points);
+	glad_profile_record(246, glad_start);
+}
+static PFNGLMAPGRID1DPROC real_glMapGrid1d = NULL;
+static void APIENTRY profile_glMapGrid1d(GLint un, GLdouble u1, GLdouble u2) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glMapGrid1d(un, u1, u2);
+	glad_profile_record(247, glad_start);
+}
+static PFNGLMAPGRID1FPROC real_glMapGrid1f = NULL;
+static void APIENTRY profile_glMapGrid1f(GLint un, GLfloat u1, GLfloat u2) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glMapGrid1f(un, u1, u2);
+	glad_profile_record(248, glad_start);
+}
+static PFNGLMAPGRID2DPROC real_glMapGrid2d = NULL;
+static void APIENTRY profile_glMapGrid2d(GLint un, GLdouble u1, GLdouble u2, GLint vn, GLdouble v1, GLdouble v2) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glMapGrid2d(un, u1, u2, vn, v1, v2);
+	glad_profile_record(249, glad_start);
+}
+static PFNGLMAPGRID2FPROC real_glMapGrid2f = NULL;
+static void APIENTRY profile_glMapGrid2f(GLint un, GLfloat u1, GLfloat u2, GLint vn, GLfloat v1, GLfloat v2) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glMapGrid2f(un, u1, u2, vn, v1, v2);
+	glad_profile_record(250, glad_start);
+}
+static PFNGLEVALCOORD1DPROC real_glEvalCoord1d = NULL;
+static void APIENTRY profile_glEvalCoord1d(GLdouble u) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glEvalCoord1d(u);
+	glad_profile_record(251, glad_start);
+}
+static PFNGLEVALCOORD1DVPROC real_glEvalCoord1dv = NULL;
+static void APIENTRY profile_glEvalCoord1dv(const GLdouble *u) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glEvalCoord1dv(u);
+	glad_profile_record(252, glad_start);
+}
+static PFNGLEVALCOORD1FPROC real_glEvalCoord1f = NULL;
+static void APIENTRY profile_glEvalCoord1f(GLfloat u) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glEvalCoord1f(u);
+	glad_profile_record(253, glad_start);
+}
+static PFNGLEVALCOORD1FVPROC real_glEvalCoord1fv = NULL;
+static void APIENTRY profile_glEvalCoord1fv(const GLfloat *u) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glEvalCoord1fv(u);
+	glad_profile_record(254, glad_start);
+}
+static PFNGLEVALCOORD2DPROC real_glEvalCoord2d = NULL;
+static void APIENTRY profile_glEvalCoord2d(GLdouble u, GLdouble v) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glEvalCoord2d(u, v);
+	glad_profile_record(255, glad_start);
+}
+static PFNGLEVALCOORD2DVPROC real_glEvalCoord2dv = NULL;
+static void APIENTRY profile_glEvalCoord2dv(const GLdouble *u) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glEvalCoord2dv(u);
+	glad_profile_record(256, glad_start);
+}
+static PFNGLEVALCOORD2FPROC real_glEvalCoord2f = NULL;
+static void APIENTRY profile_glEvalCoord2f(GLfloat u, GLfloat v) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glEvalCoord2f(u, v);
+	glad_profile_record(257, glad_start);
+}
+static PFNGLEVALCOORD2FVPROC real_glEvalCoord2fv = NULL;
+static void APIENTRY profile_glEvalCoord2fv(const GLfloat *u) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glEvalCoord2fv(u);
+	glad_profile_record(258, glad_start);
+}
+static PFNGLEVALMESH1PROC real_glEvalMesh1 = NULL;
+static void APIENTRY profile_glEvalMesh1(GLenum mode, GLint i1, GLint i2) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glEvalMesh1(mode, i1, i2);
+	glad_profile_record(259, glad_start);
+}
+static PFNGLEVALPOINT1PROC real_glEvalPoint1 = NULL;
+static void APIENTRY profile_glEvalPoint1(GLint i) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glEvalPoint1(i);
+	glad_profile_record(260, glad_start);
+}
+static PFNGLEVALMESH2PROC real_glEvalMesh2 = NULL;
+static void APIENTRY profile_glEvalMesh2(GLenum mode, GLint i1, GLint i2, GLint j1, GLint j2) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glEvalMesh2(mode, i1, i2, j1, j2);
+	glad_profile_record(261, glad_start);
+}
+static PFNGLEVALPOINT2PROC real_glEvalPoint2 = NULL;
+static void APIENTRY profile_glEvalPoint2(GLint i, GLint j) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glEvalPoint2(i, j);
+	glad_profile_record(262, glad_start);
+}
+static PFNGLALPHAFUNCPROC real_glAlphaFunc = NULL;
+static void APIENTRY profile_glAlphaFunc(GLenum func, GLfloat ref) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glAlphaFunc(func, ref);
+	glad_profile_record(263, glad_start);
+}
+static PFNGLPIXELZOOMPROC real_glPixelZoom = NULL;
+static void APIENTRY profile_glPixelZoom(GLfloat xfactor, GLfloat yfactor) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glPixelZoom(xfactor, yfactor);
+	glad_profile_record(264, glad_start);
+}
+static PFNGLPIXELTRANSFERFPROC real_glPixelTransferf = NULL;
+static void APIENTRY profile_glPixelTransferf(GLenum pname, GLfloat param) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glPixelTransferf(pname, param);
+	glad_profile_record(265, glad_start);
+}
+static PFNGLPIXELTRANSFERIPROC real_glPixelTransferi = NULL;
+static void APIENTRY profile_glPixelTransferi(GLenum pname, GLint param) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glPixelTransferi(pname, param);
+	glad_profile_record(266, glad_start);
+}
+static PFNGLPIXELMAPFVPROC real_glPixelMapfv = NULL;
+static void APIENTRY profile_glPixelMapfv(GLenum map, GLsizei mapsize, const GLfloat *values) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glPixelMapfv(map, mapsize, values);
+	glad_profile_record(267, glad_start);
+}
+static PFNGLPIXELMAPUIVPROC real_glPixelMapuiv = NULL;
+static void APIENTRY profile_glPixelMapuiv(GLenum map, GLsizei mapsize, const GLuint *values) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glPixelMapuiv(map, mapsize, values);
+	glad_profile_record(268, glad_start);
+}
+static PFNGLPIXELMAPUSVPROC real_glPixelMapusv = NULL;
+static void APIENTRY profile_glPixelMapusv(GLenum map, GLsizei mapsize, const GLushort *values) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glPixelMapusv(map, mapsize, values);
+	glad_profile_record(269, glad_start);
+}
+static PFNGLCOPYPIXELSPROC real_glCopyPixels = NULL;
+static void APIENTRY profile_glCopyPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum type) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glCopyPixels(x, y, width, height, type);
+	glad_profile_record(270, glad_start);
+}
+static PFNGLDRAWPIXELSPROC real_glDrawPixels = NULL;
+static void APIENTRY profile_glDrawPixels(GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glDrawPixels(width, height, format, type, pixels);
+	glad_profile_record(271, glad_start);
+}
+static PFNGLGETCLIPPLANEPROC real_glGetClipPlane = NULL;
+static void APIENTRY profile_glGetClipPlane(GLenum plane, GLdouble *equation) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glGetClipPlane(plane, equation);
+	glad_profile_record(272, glad_start);
+}
+static PFNGLGETLIGHTFVPROC real_glGetLightfv = NULL;
+static void APIENTRY profile_glGetLightfv(GLenum light, GLenum pname, GLfloat *params) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glGetLightfv(light, pname, params);
+	glad_profile_record(273, glad_start);
+}
+static PFNGLGETLIGHTIVPROC real_glGetLightiv = NULL;
+static void APIENTRY profile_glGetLightiv(GLenum light, GLenum pname, GLint *params) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glGetLightiv(light, pname, params);
+	glad_profile_record(274, glad_start);
+}
+static PFNGLGETMAPDVPROC real_glGetMapdv = NULL;
+static void APIENTRY profile_glGetMapdv(GLenum target, GLenum query, GLdouble *v) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glGetMapdv(target, query, v);
+	glad_profile_record(275, glad_start);
+}
+static PFNGLGETMAPFVPROC real_glGetMapfv = NULL;
+static void APIENTRY profile_glGetMapfv(GLenum target, GLenum query, GLfloat *v) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glGetMapfv(target, query, v);
+	glad_profile_record(276, glad_start);
+}
+static PFNGLGETMAPIVPROC real_glGetMapiv = NULL;
+static void APIENTRY profile_glGetMapiv(GLenum target, GLenum query, GLint *v) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glGetMapiv(target, query, v);
+	glad_profile_record(277, glad_start);
+}
+static PFNGLGETMATERIALFVPROC real_glGetMaterialfv = NULL;
+static void APIENTRY profile_glGetMaterialfv(GLenum face, GLenum pname, GLfloat *params) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glGetMaterialfv(face, pname, params);
+	glad_profile_record(278, glad_start);
+}
+static PFNGLGETMATERIALIVPROC real_glGetMaterialiv = NULL;
+static void APIENTRY profile_glGetMaterialiv(GLenum face, GLenum pname, GLint *params) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glGetMaterialiv(face, pname, params);
+	glad_profile_record(279, glad_start);
+}
+static PFNGLGETPIXELMAPFVPROC real_glGetPixelMapfv = NULL;
+static void APIENTRY profile_glGetPixelMapfv(GLenum map, GLfloat *values) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glGetPixelMapfv(map, values);
+	glad_profile_record(280, glad_start);
+}
+static PFNGLGETPIXELMAPUIVPROC real_glGetPixelMapuiv = NULL;
+static void APIENTRY profile_glGetPixelMapuiv(GLenum map, GLuint *values) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glGetPixelMapuiv(map, values);
+	glad_profile_record(281, glad_start);
+}
+static PFNGLGETPIXELMAPUSVPROC real_glGetPixelMapusv = NULL;
+static void APIENTRY profile_glGetPixelMapusv(GLenum map, GLushort *values) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glGetPixelMapusv(map, values);
+	glad_profile_record(282, glad_start);
+}
+static PFNGLGETPOLYGONSTIPPLEPROC real_glGetPolygonStipple = NULL;
+static void APIENTRY profile_glGetPolygonStipple(GLubyte *mask) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glGetPolygonStipple(mask);
+	glad_profile_record(283, glad_start);
+}
+static PFNGLGETTEXENVFVPROC real_glGetTexEnvfv = NULL;
+static void APIENTRY profile_glGetTexEnvfv(GLenum target, GLenum pname, GLfloat *params) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glGetTexEnvfv(target, pname, params);
+	glad_profile_record(284, glad_start);
+}
+static PFNGLGETTEXENVIVPROC real_glGetTexEnviv = NULL;
+static void APIENTRY profile_glGetTexEnviv(GLenum target, GLenum pname, GLint *params) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glGetTexEnviv(target, pname, params);
+	glad_profile_record(285, glad_start);
+}
+static PFNGLGETTEXGENDVPROC real_glGetTexGendv = NULL;
+static void APIENTRY profile_glGetTexGendv(GLenum coord, GLenum pname, GLdouble *params) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glGetTexGendv(coord, pname, params);
+	glad_profile_record(286, glad_start);
+}
+static PFNGLGETTEXGENFVPROC real_glGetTexGenfv = NULL;
+static void APIENTRY profile_glGetTexGenfv(GLenum coord, GLenum pname, GLfloat *params) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glGetTexGenfv(coord, pname, params);
+	glad_profile_record(287, glad_start);
+}
+static PFNGLGETTEXGENIVPROC real_glGetTexGeniv = NULL;
+static void APIENTRY profile_glGetTexGeniv(GLenum coord, GLenum pname, GLint *params) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glGetTexGeniv(coord, pname, params);
+	glad_profile_record(288, glad_start);
+}
+static PFNGLISLISTPROC real_glIsList = NULL;
+static GLboolean APIENTRY profile_glIsList(GLuint list) {
+	GLboolean glad_result;
+	unsigned long long glad_start = glad_profile_now();
+	glad_result = real_glIsList(list);
+	glad_profile_record(289, glad_start);
+	return glad_result;
+}
+static PFNGLFRUSTUMPROC real_glFrustum = NULL;
+static void APIENTRY profile_glFrustum(GLdouble left, GLdouble right, GLdouble bottom, GLdouble top, GLdouble zNear, GLdouble zFar) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glFrustum(left, right, bottom, top, zNear, zFar);
+	glad_profile_record(290, glad_start);
+}
+static PFNGLLOADIDENTITYPROC real_glLoadIdentity = NULL;
+static void APIENTRY profile_glLoadIdentity(void) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glLoadIdentity();
+	glad_profile_record(291, glad_start);
+}
+static PFNGLLOADMATRIXFPROC real_glLoadMatrixf = NULL;
+static void APIENTRY profile_glLoadMatrixf(const GLfloat *m) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glLoadMatrixf(m);
+	glad_profile_record(292, glad_start);
+}
+static PFNGLLOADMATRIXDPROC real_glLoadMatrixd = NULL;
+static void APIENTRY profile_glLoadMatrixd(const GLdouble *m) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glLoadMatrixd(m);
+	glad_profile_record(293, glad_start);
+}
+static PFNGLMATRIXMODEPROC real_glMatrixMode = NULL;
+static void APIENTRY profile_glMatrixMode(GLenum mode) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glMatrixMode(mode);
+	glad_profile_record(294, glad_start);
+}
+static PFNGLMULTMATRIXFPROC real_glMultMatrixf = NULL;
+static void APIENTRY profile_glMultMatrixf(const GLfloat *m) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glMultMatrixf(m);
+	glad_profile_record(295, glad_start);
+}
+static PFNGLMULTMATRIXDPROC real_glMultMatrixd = NULL;
+static void APIENTRY profile_glMultMatrixd(const GLdouble *m) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glMultMatrixd(m);
+	glad_profile_record(296, glad_start);
+}
+static PFNGLORTHOPROC real_glOrtho = NULL;
+static void APIENTRY profile_glOrtho(GLdouble left, GLdouble right, GLdouble bottom, GLdouble top, GLdouble zNear, GLdouble zFar) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glOrtho(left, right, bottom, top, zNear, zFar);
+	glad_profile_record(297, glad_start);
+}
+static PFNGLPOPMATRIXPROC real_glPopMatrix = NULL;
+static void APIENTRY profile_glPopMatrix(void) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glPopMatrix();
+	glad_profile_record(298, glad_start);
+}
+static PFNGLPUSHMATRIXPROC real_glPushMatrix = NULL;
+static void APIENTRY profile_glPushMatrix(void) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glPushMatrix();
+	glad_profile_record(299, glad_start);
+}
+static PFNGLROTATEDPROC real_glRotated = NULL;
+static void APIENTRY profile_glRotated(GLdouble angle, GLdouble x, GLdouble y, GLdouble z) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glRotated(angle, x, y, z);
+	glad_profile_record(300, glad_start);
+}
+static PFNGLROTATEFPROC real_glRotatef = NULL;
+static void APIENTRY profile_glRotatef(GLfloat angle, GLfloat x, GLfloat y, GLfloat z) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glRotatef(angle, x, y, z);
+	glad_profile_record(301, glad_start);
+}
+static PFNGLSCALEDPROC real_glScaled = NULL;
+static void APIENTRY profile_glScaled(GLdouble x, GLdouble y, GLdouble z) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glScaled(x, y, z);
+	glad_profile_record(302, glad_start);
+}
+static PFNGLSCALEFPROC real_glScalef = NULL;
+static void APIENTRY profile_glScalef(GLfloat x, GLfloat y, GLfloat z) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glScalef(x, y, z);
+	glad_profile_record(303, glad_start);
+}
+static PFNGLTRANSLATEDPROC real_glTranslated = NULL;
+static void APIENTRY profile_glTranslated(GLdouble x, GLdouble y, GLdouble z) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glTranslated(x, y, z);
+	glad_profile_record(304, glad_start);
+}
+static PFNGLTRANSLATEFPROC real_glTranslatef = NULL;
+static void APIENTRY profile_glTranslatef(GLfloat x, GLfloat y, GLfloat z) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glTranslatef(x, y, z);
+	glad_profile_record(305, glad_start);
+}
+static PFNGLDRAWARRAYSPROC real_glDrawArrays = NULL;
+static void APIENTRY profile_glDrawArrays(GLenum mode, GLint first, GLsizei count) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glDrawArrays(mode, first, count);
+	glad_profile_record(306, glad_start);
+}
+static PFNGLDRAWELEMENTSPROC real_glDrawElements = NULL;
+static void APIENTRY profile_glDrawElements(GLenum mode, GLsizei count, GLenum type, const void *indices) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glDrawElements(mode, count, type, indices);
+	glad_profile_record(307, glad_start);
+}
+static PFNGLGETPOINTERVPROC real_glGetPointerv = NULL;
+static void APIENTRY profile_glGetPointerv(GLenum pname, void **params) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glGetPointerv(pname, params);
+	glad_profile_record(308, glad_start);
+}
+static PFNGLPOLYGONOFFSETPROC real_glPolygonOffset = NULL;
+static void APIENTRY profile_glPolygonOffset(GLfloat factor, GLfloat units) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glPolygonOffset(factor, units);
+	glad_profile_record(309, glad_start);
+}
+static PFNGLCOPYTEXIMAGE1DPROC real_glCopyTexImage1D = NULL;
+static void APIENTRY profile_glCopyTexImage1D(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLint border) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glCopyTexImage1D(target, level, internalformat, x, y, width, border);
+	glad_profile_record(310, glad_start);
+}
+static PFNGLCOPYTEXIMAGE2DPROC real_glCopyTexImage2D = NULL;
+static void APIENTRY profile_glCopyTexImage2D(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glCopyTexImage2D(target, level, internalformat, x, y, width, height, border);
+	glad_profile_record(311, glad_start);
+}
+static PFNGLCOPYTEXSUBIMAGE1DPROC real_glCopyTexSubImage1D = NULL;
+static void APIENTRY profile_glCopyTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glCopyTexSubImage1D(target, level, xoffset, x, y, width);
+	glad_profile_record(312, glad_start);
+}
+static PFNGLCOPYTEXSUBIMAGE2DPROC real_glCopyTexSubImage2D = NULL;
+static void APIENTRY profile_glCopyTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glCopyTexSubImage2D(target, level, xoffset, yoffset, x, y, width, height);
+	glad_profile_record(313, glad_start);
+}
+static PFNGLTEXSUBIMAGE1DPROC real_glTexSubImage1D = NULL;
+static void APIENTRY profile_glTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glTexSubImage1D(target, level, xoffset, width, format, type, pixels);
+	glad_profile_record(314, glad_start);
+}
+static PFNGLTEXSUBIMAGE2DPROC real_glTexSubImage2D = NULL;
+static void APIENTRY profile_glTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glTexSubImage2D(target, level, xoffset, yoffset, width, height, format, type, pixels);
+	glad_profile_record(315, glad_start);
+}
+static PFNGLBINDTEXTUREPROC real_glBindTexture = NULL;
+static void APIENTRY profile_glBindTexture(GLenum target, GLuint texture) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glBindTexture(target, texture);
+	glad_profile_record(316, glad_start);
+}
+static PFNGLDELETETEXTURESPROC real_glDeleteTextures = NULL;
+static void APIENTRY profile_glDeleteTextures(GLsizei n, const GLuint *textures) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glDeleteTextures(n, textures);
+	glad_profile_record(317, glad_start);
+}
+static PFNGLGENTEXTURESPROC real_glGenTextures = NULL;
+static void APIENTRY profile_glGenTextures(GLsizei n, GLuint *textures) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glGenTextures(n, textures);
+	glad_profile_record(318, glad_start);
+}
+static PFNGLISTEXTUREPROC real_glIsTexture = NULL;
+static GLboolean APIENTRY profile_glIsTexture(GLuint texture) {
+	GLboolean glad_result;
+	unsigned long long glad_start = glad_profile_now();
+	glad_result = real_glIsTexture(texture);
+	glad_profile_record(319, glad_start);
+	return glad_result;
+}
+static PFNGLARRAYELEMENTPROC real_glArrayElement = NULL;
+static void APIENTRY profile_glArrayElement(GLint i) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glArrayElement(i);
+	glad_profile_record(320, glad_start);
+}
+static PFNGLCOLORPOINTERPROC real_glColorPointer = NULL;
+static void APIENTRY profile_glColorPointer(GLint size, GLenum type, GLsizei stride, const void *pointer) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glColorPointer(size, type, stride, pointer);
+	glad_profile_record(321, glad_start);
+}
+static PFNGLDISABLECLIENTSTATEPROC real_glDisableClientState = NULL;
+static void APIENTRY profile_glDisableClientState(GLenum array) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glDisableClientState(array);
+	glad_profile_record(322, glad_start);
+}
+static PFNGLEDGEFLAGPOINTERPROC real_glEdgeFlagPointer = NULL;
+static void APIENTRY profile_glEdgeFlagPointer(GLsizei stride, const void *pointer) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glEdgeFlagPointer(stride, pointer);
+	glad_profile_record(323, glad_start);
+}
+static PFNGLENABLECLIENTSTATEPROC real_glEnableClientState = NULL;
+static void APIENTRY profile_glEnableClientState(GLenum array) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glEnableClientState(array);
+	glad_profile_record(324, glad_start);
+}
+static PFNGLINDEXPOINTERPROC real_glIndexPointer = NULL;
+static void APIENTRY profile_glIndexPointer(GLenum type, GLsizei stride, const void *pointer) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glIndexPointer(type, stride, pointer);
+	glad_profile_record(325, glad_start);
+}
+static PFNGLINTERLEAVEDARRAYSPROC real_glInterleavedArrays = NULL;
+static void APIENTRY profile_glInterleavedArrays(GLenum format, GLsizei stride, const void *pointer) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glInterleavedArrays(format, stride, pointer);
+	glad_profile_record(326, glad_start);
+}
+static PFNGLNORMALPOINTERPROC real_glNormalPointer = NULL;
+static void APIENTRY profile_glNormalPointer(GLenum type, GLsizei stride, const void *pointer) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glNormalPointer(type, stride, pointer);
+	glad_profile_record(327, glad_start);
+}
+static PFNGLTEXCOORDPOINTERPROC real_glTexCoordPointer = NULL;
+static void APIENTRY profile_glTexCoordPointer(GLint size, GLenum type, GLsizei stride, const void *pointer) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glTexCoordPointer(size, type, stride, pointer);
+	glad_profile_record(328, glad_start);
+}
+static PFNGLVERTEXPOINTERPROC real_glVertexPointer = NULL;
+static void APIENTRY profile_glVertexPointer(GLint size, GLenum type, GLsizei stride, const void *pointer) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glVertexPointer(size, type, stride, pointer);
+	glad_profile_record(329, glad_start);
+}
+static PFNGLARETEXTURESRESIDENTPROC real_glAreTexturesResident = NULL;
+static GLboolean APIENTRY profile_glAreTexturesResident(GLsizei n, const GLuint *textures, GLboolean *residences) {
+	GLboolean glad_result;
+	unsigned long long glad_start = glad_profile_now();
+	glad_result = real_glAreTexturesResident(n, textures, residences);
+	glad_profile_record(330, glad_start);
+	return glad_result;
+}
+static PFNGLPRIORITIZETEXTURESPROC real_glPrioritizeTextures = NULL;
+static void APIENTRY profile_glPrioritizeTextures(GLsizei n, const GLuint *textures, const GLfloat *priorities) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glPrioritizeTextures(n, textures, priorities);
+	glad_profile_record(331, glad_start);
+}
+static PFNGLINDEXUBPROC real_glIndexub = NULL;
+static void APIENTRY profile_glIndexub(GLubyte c) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glIndexub(c);
+	glad_profile_record(332, glad_start);
+}
+static PFNGLINDEXUBVPROC real_glIndexubv = NULL;
+static void APIENTRY profile_glIndexubv(const GLubyte *c) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glIndexubv(c);
+	glad_profile_record(333, glad_start);
+}
+static PFNGLPOPCLIENTATTRIBPROC real_glPopClientAttrib = NULL;
+static void APIENTRY profile_glPopClientAttrib(void) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glPopClientAttrib();
+	glad_profile_record(334, glad_start);
+}
+static PFNGLPUSHCLIENTATTRIBPROC real_glPushClientAttrib = NULL;
+static void APIENTRY profile_glPushClientAttrib(GLbitfield mask) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glPushClientAttrib(mask);
+	glad_profile_record(335, glad_start);
+}
+static PFNGLDRAWRANGEELEMENTSPROC real_glDrawRangeElements = NULL;
+static void APIENTRY profile_glDrawRangeElements(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glDrawRangeElements(mode, start, end, count, type, indices);
+	glad_profile_record(336, glad_start);
+}
+static PFNGLTEXIMAGE3DPROC real_glTexImage3D = NULL;
+static void APIENTRY profile_glTexImage3D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void *pixels) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glTexImage3D(target, level, internalformat, width, height, depth, border, format, type, pixels);
+	glad_profile_record(337, glad_start);
+}
+static PFNGLTEXSUBIMAGE3DPROC real_glTexSubImage3D = NULL;
+static void APIENTRY profile_glTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glTexSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
+	glad_profile_record(338, glad_start);
+}
+static PFNGLCOPYTEXSUBIMAGE3DPROC real_glCopyTexSubImage3D = NULL;
+static void APIENTRY profile_glCopyTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glCopyTexSubImage3D(target, level, xoffset, yoffset, zoffset, x, y, width, height);
+	glad_profile_record(339, glad_start);
+}
+static PFNGLACTIVETEXTUREPROC real_glActiveTexture = NULL;
+static void APIENTRY profile_glActiveTexture(GLenum texture) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glActiveTexture(texture);
+	glad_profile_record(340, glad_start);
+}
+static PFNGLSAMPLECOVERAGEPROC real_glSampleCoverage = NULL;
+static void APIENTRY profile_glSampleCoverage(GLfloat value, GLboolean invert) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glSampleCoverage(value, invert);
+	glad_profile_record(341, glad_start);
+}
+static PFNGLCOMPRESSEDTEXIMAGE3DPROC real_glCompressedTexImage3D = NULL;
+static void APIENTRY profile_glCompressedTexImage3D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const void *data) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glCompressedTexImage3D(target, level, internalformat, width, height, depth, border, imageSize, data);
+	glad_profile_record(342, glad_start);
+}
+static PFNGLCOMPRESSEDTEXIMAGE2DPROC real_glCompressedTexImage2D = NULL;
+static void APIENTRY profile_glCompressedTexImage2D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void *data) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glCompressedTexImage2D(target, level, internalformat, width, height, border, imageSize, data);
+	glad_profile_record(343, glad_start);
+}
+static PFNGLCOMPRESSEDTEXIMAGE1DPROC real_glCompressedTexImage1D = NULL;
+static void APIENTRY profile_glCompressedTexImage1D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const void *data) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glCompressedTexImage1D(target, level, internalformat, width, border, imageSize, data);
+	glad_profile_record(344, glad_start);
+}
+static PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC real_glCompressedTexSubImage3D = NULL;
+static void APIENTRY profile_glCompressedTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *data) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glCompressedTexSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
+	glad_profile_record(345, glad_start);
+}
+static PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC real_glCompressedTexSubImage2D = NULL;
+static void APIENTRY profile_glCompressedTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *data) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glCompressedTexSubImage2D(target, level, xoffset, yoffset, width, height, format, imageSize, data);
+	glad_profile_record(346, glad_start);
+}
+static PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC real_glCompressedTexSubImage1D = NULL;
+static void APIENTRY profile_glCompressedTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void *data) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glCompressedTexSubImage1D(target, level, xoffset, width, format, imageSize, data);
+	glad_profile_record(347, glad_start);
+}
+static PFNGLGETCOMPRESSEDTEXIMAGEPROC real_glGetCompressedTexImage = NULL;
+static void APIENTRY profile_glGetCompressedTexImage(GLenum target, GLint level, void *img) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glGetCompressedTexImage(target, level, img);
+	glad_profile_record(348, glad_start);
+}
+static PFNGLCLIENTACTIVETEXTUREPROC real_glClientActiveTexture = NULL;
+static void APIENTRY profile_glClientActiveTexture(GLenum texture) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glClientActiveTexture(texture);
+	glad_profile_record(349, glad_start);
+}
+static PFNGLMULTITEXCOORD1DPROC real_glMultiTexCoord1d = NULL;
+static void APIENTRY profile_glMultiTexCoord1d(GLenum target, GLdouble s) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glMultiTexCoord1d(target, s);
+	glad_profile_record(350, glad_start);
+}
+static PFNGLMULTITEXCOORD1DVPROC real_glMultiTexCoord1dv = NULL;
+static void APIENTRY profile_glMultiTexCoord1dv(GLenum target, const GLdouble *v) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glMultiTexCoord1dv(target, v);
+	glad_profile_record(351, glad_start);
+}
+static PFNGLMULTITEXCOORD1FPROC real_glMultiTexCoord1f = NULL;
+static void APIENTRY profile_glMultiTexCoord1f(GLenum target, GLfloat s) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glMultiTexCoord1f(target, s);
+	glad_profile_record(352, glad_start);
+}
+static PFNGLMULTITEXCOORD1FVPROC real_glMultiTexCoord1fv = NULL;
+static void APIENTRY profile_glMultiTexCoord1fv(GLenum target, const GLfloat *v) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glMultiTexCoord1fv(target, v);
+	glad_profile_record(353, glad_start);
+}
+static PFNGLMULTITEXCOORD1IPROC real_glMultiTexCoord1i = NULL;
+static void APIENTRY profile_glMultiTexCoord1i(GLenum target, GLint s) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glMultiTexCoord1i(target, s);
+	glad_profile_record(354, glad_start);
+}
+static PFNGLMULTITEXCOORD1IVPROC real_glMultiTexCoord1iv = NULL;
+static void APIENTRY profile_glMultiTexCoord1iv(GLenum target, const GLint *v) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glMultiTexCoord1iv(target, v);
+	glad_profile_record(355, glad_start);
+}
+static PFNGLMULTITEXCOORD1SPROC real_glMultiTexCoord1s = NULL;
+static void APIENTRY profile_glMultiTexCoord1s(GLenum target, GLshort s) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glMultiTexCoord1s(target, s);
+	glad_profile_record(356, glad_start);
+}
+static PFNGLMULTITEXCOORD1SVPROC real_glMultiTexCoord1sv = NULL;
+static void APIENTRY profile_glMultiTexCoord1sv(GLenum target, const GLshort *v) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glMultiTexCoord1sv(target, v);
+	glad_profile_record(357, glad_start);
+}
+static PFNGLMULTITEXCOORD2DPROC real_glMultiTexCoord2d = NULL;
+static void APIENTRY profile_glMultiTexCoord2d(GLenum target, GLdouble s, GLdouble t) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glMultiTexCoord2d(target, s, t);
+	glad_profile_record(358, glad_start);
+}
+static PFNGLMULTITEXCOORD2DVPROC real_glMultiTexCoord2dv = NULL;
+static void APIENTRY profile_glMultiTexCoord2dv(GLenum target, const GLdouble *v) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glMultiTexCoord2dv(target, v);
+	glad_profile_record(359, glad_start);
+}
+static PFNGLMULTITEXCOORD2FPROC real_glMultiTexCoord2f = NULL;
+static void APIENTRY profile_glMultiTexCoord2f(GLenum target, GLfloat s, GLfloat t) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glMultiTexCoord2f(target, s, t);
+	glad_profile_record(360, glad_start);
+}
+static PFNGLMULTITEXCOORD2FVPROC real_glMultiTexCoord2fv = NULL;
+static void APIENTRY profile_glMultiTexCoord2fv(GLenum target, const GLfloat *v) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glMultiTexCoord2fv(target, v);
+	glad_profile_record(361, glad_start);
+}
+static PFNGLMULTITEXCOORD2IPROC real_glMultiTexCoord2i = NULL;
+static void APIENTRY profile_glMultiTexCoord2i(GLenum target, GLint s, GLint t) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glMultiTexCoord2i(target, s, t);
+	glad_profile_record(362, glad_start);
+}
+static PFNGLMULTITEXCOORD2IVPROC real_glMultiTexCoord2iv = NULL;
+static void APIENTRY profile_glMultiTexCoord2iv(GLenum target, const GLint *v) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glMultiTexCoord2iv(target, v);
+	glad_profile_record(363, glad_start);
+}
+static PFNGLMULTITEXCOORD2SPROC real_glMultiTexCoord2s = NULL;
+static void APIENTRY profile_glMultiTexCoord2s(GLenum target, GLshort s, GLshort t) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glMultiTexCoord2s(target, s, t);
+	glad_profile_record(364, glad_start);
+}
+static PFNGLMULTITEXCOORD2SVPROC real_glMultiTexCoord2sv = NULL;
+static void APIENTRY profile_glMultiTexCoord2sv(GLenum target, const GLshort *v) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glMultiTexCoord2sv(target, v);
+	glad_profile_record(365, glad_start);
+}
+static PFNGLMULTITEXCOORD3DPROC real_glMultiTexCoord3d = NULL;
+static void APIENTRY profile_glMultiTexCoord3d(GLenum target, GLdouble s, GLdouble t, GLdouble r) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glMultiTexCoord3d(target, s, t, r);
+	glad_profile_record(366, glad_start);
+}
+static PFNGLMULTITEXCOORD3DVPROC real_glMultiTexCoord3dv = NULL;
+static void APIENTRY profile_glMultiTexCoord3dv(GLenum target, const GLdouble *v) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glMultiTexCoord3dv(target, v);
+	glad_profile_record(367, glad_start);
+}
+static PFNGLMULTITEXCOORD3FPROC real_glMultiTexCoord3f = NULL;
+static void APIENTRY profile_glMultiTexCoord3f(GLenum target, GLfloat s, GLfloat t, GLfloat r) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glMultiTexCoord3f(target, s, t, r);
+	glad_profile_record(368, glad_start);
+}
+static PFNGLMULTITEXCOORD3FVPROC real_glMultiTexCoord3fv = NULL;
+static void APIENTRY profile_glMultiTexCoord3fv(GLenum target, const GLfloat *v) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glMultiTexCoord3fv(target, v);
+	glad_profile_record(369, glad_start);
+}
+static PFNGLMULTITEXCOORD3IPROC real_glMultiTexCoord3i = NULL;
+static void APIENTRY profile_glMultiTexCoord3i(GLenum target, GLint s, GLint t, GLint r) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glMultiTexCoord3i(target, s, t, r);
+	glad_profile_record(370, glad_start);
+}
+static PFNGLMULTITEXCOORD3IVPROC real_glMultiTexCoord3iv = NULL;
+static void APIENTRY profile_glMultiTexCoord3iv(GLenum target, const GLint *v) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glMultiTexCoord3iv(target, v);
+	glad_profile_record(371, glad_start);
+}
+static PFNGLMULTITEXCOORD3SPROC real_glMultiTexCoord3s = NULL;
+static void APIENTRY profile_glMultiTexCoord3s(GLenum target, GLshort s, GLshort t, GLshort r) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glMultiTexCoord3s(target, s, t, r);
+	glad_profile_record(372, glad_start);
+}
+static PFNGLMULTITEXCOORD3SVPROC real_glMultiTexCoord3sv = NULL;
+static void APIENTRY profile_glMultiTexCoord3sv(GLenum target, const GLshort *v) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glMultiTexCoord3sv(target, v);
+	glad_profile_record(373, glad_start);
+}
+static PFNGLMULTITEXCOORD4DPROC real_glMultiTexCoord4d = NULL;
+static void APIENTRY profile_glMultiTexCoord4d(GLenum target, GLdouble s, GLdouble t, GLdouble r, GLdouble q) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glMultiTexCoord4d(target, s, t, r, q);
+	glad_profile_record(374, glad_start);
+}
+static PFNGLMULTITEXCOORD4DVPROC real_glMultiTexCoord4dv = NULL;
+static void APIENTRY profile_glMultiTexCoord4dv(GLenum target, const GLdouble *v) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glMultiTexCoord4dv(target, v);
+	glad_profile_record(375, glad_start);
+}
+static PFNGLMULTITEXCOORD4FPROC real_glMultiTexCoord4f = NULL;
+static void APIENTRY profile_glMultiTexCoord4f(GLenum target, GLfloat s, GLfloat t, GLfloat r, GLfloat q) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glMultiTexCoord4f(target, s, t, r, q);
+	glad_profile_record(376, glad_start);
+}
+static PFNGLMULTITEXCOORD4FVPROC real_glMultiTexCoord4fv = NULL;
+static void APIENTRY profile_glMultiTexCoord4fv(GLenum target, const GLfloat *v) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glMultiTexCoord4fv(target, v);
+	glad_profile_record(377, glad_start);
+}
+static PFNGLMULTITEXCOORD4IPROC real_glMultiTexCoord4i = NULL;
+static void APIENTRY profile_glMultiTexCoord4i(GLenum target, GLint s, GLint t, GLint r, GLint q) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glMultiTexCoord4i(target, s, t, r, q);
+	glad_profile_record(378, glad_start);
+}
+static PFNGLMULTITEXCOORD4IVPROC real_glMultiTexCoord4iv = NULL;
+static void APIENTRY profile_glMultiTexCoord4iv(GLenum target, const GLint *v) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glMultiTexCoord4iv(target, v);
+	glad_profile_record(379, glad_start);
+}
+static PFNGLMULTITEXCOORD4SPROC real_glMultiTexCoord4s = NULL;
+static void APIENTRY profile_glMultiTexCoord4s(GLenum target, GLshort s, GLshort t, GLshort r, GLshort q) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glMultiTexCoord4s(target, s, t, r, q);
+	glad_profile_record(380, glad_start);
+}
+static PFNGLMULTITEXCOORD4SVPROC real_glMultiTexCoord4sv = NULL;
+static void APIENTRY profile_glMultiTexCoord4sv(GLenum target, const GLshort *v) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glMultiTexCoord4sv(target, v);
+	glad_profile_record(381, glad_start);
+}
+static PFNGLLOADTRANSPOSEMATRIXFPROC real_glLoadTransposeMatrixf = NULL;
+static void APIENTRY profile_glLoadTransposeMatrixf(const GLfloat *m) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glLoadTransposeMatrixf(m);
+	glad_profile_record(382, glad_start);
+}
+static PFNGLLOADTRANSPOSEMATRIXDPROC real_glLoadTransposeMatrixd = NULL;
+static void APIENTRY profile_glLoadTransposeMatrixd(const GLdouble *m) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glLoadTransposeMatrixd(m);
+	glad_profile_record(383, glad_start);
+}
+static PFNGLMULTTRANSPOSEMATRIXFPROC real_glMultTransposeMatrixf = NULL;
+static void APIENTRY profile_glMultTransposeMatrixf(const GLfloat *m) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glMultTransposeMatrixf(m);
+	glad_profile_record(384, glad_start);
+}
+static PFNGLMULTTRANSPOSEMATRIXDPROC real_glMultTransposeMatrixd = NULL;
+static void APIENTRY profile_glMultTransposeMatrixd(const GLdouble *m) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glMultTransposeMatrixd(m);
+	glad_profile_record(385, glad_start);
+}
+static PFNGLBLENDFUNCSEPARATEPROC real_glBlendFuncSeparate = NULL;
+static void APIENTRY profile_glBlendFuncSeparate(GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glBlendFuncSeparate(sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha);
+	glad_profile_record(386, glad_start);
+}
+static PFNGLMULTIDRAWARRAYSPROC real_glMultiDrawArrays = NULL;
+static void APIENTRY profile_glMultiDrawArrays(GLenum mode, const GLint *first, const GLsizei *count, GLsizei drawcount) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glMultiDrawArrays(mode, first, count, drawcount);
+	glad_profile_record(387, glad_start);
+}
+static PFNGLMULTIDRAWELEMENTSPROC real_glMultiDrawElements = NULL;
+static void APIENTRY profile_glMultiDrawElements(GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glMultiDrawElements(mode, count, type, indices, drawcount);
+	glad_profile_record(388, glad_start);
+}
+static PFNGLPOINTPARAMETERFPROC real_glPointParameterf = NULL;
+static void APIENTRY profile_glPointParameterf(GLenum pname, GLfloat param) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glPointParameterf(pname, param);
+	glad_profile_record(389, glad_start);
+}
+static PFNGLPOINTPARAMETERFVPROC real_glPointParameterfv = NULL;
+static void APIENTRY profile_glPointParameterfv(GLenum pname, const GLfloat *params) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glPointParameterfv(pname, params);
+	glad_profile_record(390, glad_start);
+}
+static PFNGLPOINTPARAMETERIPROC real_glPointParameteri = NULL;
+static void APIENTRY profile_glPointParameteri(GLenum pname, GLint param) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glPointParameteri(pname, param);
+	glad_profile_record(391, glad_start);
+}
+static PFNGLPOINTPARAMETERIVPROC real_glPointParameteriv = NULL;
+static void APIENTRY profile_glPointParameteriv(GLenum pname, const GLint *params) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glPointParameteriv(pname, params);
+	glad_profile_record(392, glad_start);
+}
+static PFNGLFOGCOORDFPROC real_glFogCoordf = NULL;
+static void APIENTRY profile_glFogCoordf(GLfloat coord) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glFogCoordf(coord);
+	glad_profile_record(393, glad_start);
+}
+static PFNGLFOGCOORDFVPROC real_glFogCoordfv = NULL;
+static void APIENTRY profile_glFogCoordfv(const GLfloat *coord) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glFogCoordfv(coord);
+	glad_profile_record(394, glad_start);
+}
+static PFNGLFOGCOORDDPROC real_glFogCoordd = NULL;
+static void APIENTRY profile_glFogCoordd(GLdouble coord) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glFogCoordd(coord);
+	glad_profile_record(395, glad_start);
+}
+static PFNGLFOGCOORDDVPROC real_glFogCoorddv = NULL;
+static void APIENTRY profile_glFogCoorddv(const GLdouble *coord) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glFogCoorddv(coord);
+	glad_profile_record(396, glad_start);
+}
+static PFNGLFOGCOORDPOINTERPROC real_glFogCoordPointer = NULL;
+static void APIENTRY profile_glFogCoordPointer(GLenum type, GLsizei stride, const void *pointer) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glFogCoordPointer(type, stride, pointer);
+	glad_profile_record(397, glad_start);
+}
+static PFNGLSECONDARYCOLOR3BPROC real_glSecondaryColor3b = NULL;
+static void APIENTRY profile_glSecondaryColor3b(GLbyte red, GLbyte green, GLbyte blue) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glSecondaryColor3b(red, green, blue);
+	glad_profile_record(398, glad_start);
+}
+static PFNGLSECONDARYCOLOR3BVPROC real_glSecondaryColor3bv = NULL;
+static void APIENTRY profile_glSecondaryColor3bv(const GLbyte *v) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glSecondaryColor3bv(v);
+	glad_profile_record(399, glad_start);
+}
+static PFNGLSECONDARYCOLOR3DPROC real_glSecondaryColor3d = NULL;
+static void APIENTRY profile_glSecondaryColor3d(GLdouble red, GLdouble green, GLdouble blue) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glSecondaryColor3d(red, green, blue);
+	glad_profile_record(400, glad_start);
+}
+static PFNGLSECONDARYCOLOR3DVPROC real_glSecondaryColor3dv = NULL;
+static void APIENTRY profile_glSecondaryColor3dv(const GLdouble *v) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glSecondaryColor3dv(v);
+	glad_profile_record(401, glad_start);
+}
+static PFNGLSECONDARYCOLOR3FPROC real_glSecondaryColor3f = NULL;
+static void APIENTRY profile_glSecondaryColor3f(GLfloat red, GLfloat green, GLfloat blue) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glSecondaryColor3f(red, green, blue);
+	glad_profile_record(402, glad_start);
+}
+static PFNGLSECONDARYCOLOR3FVPROC real_glSecondaryColor3fv = NULL;
+static void APIENTRY profile_glSecondaryColor3fv(const GLfloat *v) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glSecondaryColor3fv(v);
+	glad_profile_record(403, glad_start);
+}
+static PFNGLSECONDARYCOLOR3IPROC real_glSecondaryColor3i = NULL;
+static void APIENTRY profile_glSecondaryColor3i(GLint red, GLint green, GLint blue) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glSecondaryColor3i(red, green, blue);
+	glad_profile_record(404, glad_start);
+}
+static PFNGLSECONDARYCOLOR3IVPROC real_glSecondaryColor3iv = NULL;
+static void APIENTRY profile_glSecondaryColor3iv(const GLint *v) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glSecondaryColor3iv(v);
+	glad_profile_record(405, glad_start);
+}
+static PFNGLSECONDARYCOLOR3SPROC real_glSecondaryColor3s = NULL;
+static void APIENTRY profile_glSecondaryColor3s(GLshort red, GLshort green, GLshort blue) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glSecondaryColor3s(red, green, blue);
+	glad_profile_record(406, glad_start);
+}
+static PFNGLSECONDARYCOLOR3SVPROC real_glSecondaryColor3sv = NULL;
+static void APIENTRY profile_glSecondaryColor3sv(const GLshort *v) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glSecondaryColor3sv(v);
+	glad_profile_record(407, glad_start);
+}
+static PFNGLSECONDARYCOLOR3UBPROC real_glSecondaryColor3ub = NULL;
+static void APIENTRY profile_glSecondaryColor3ub(GLubyte red, GLubyte green, GLubyte blue) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glSecondaryColor3ub(red, green, blue);
+	glad_profile_record(408, glad_start);
+}
+static PFNGLSECONDARYCOLOR3UBVPROC real_glSecondaryColor3ubv = NULL;
+static void APIENTRY profile_glSecondaryColor3ubv(const GLubyte *v) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glSecondaryColor3ubv(v);
+	glad_profile_record(409, glad_start);
+}
+static PFNGLSECONDARYCOLOR3UIPROC real_glSecondaryColor3ui = NULL;
+static void APIENTRY profile_glSecondaryColor3ui(GLuint red, GLuint green, GLuint blue) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glSecondaryColor3ui(red, green, blue);
+	glad_profile_record(410, glad_start);
+}
+static PFNGLSECONDARYCOLOR3UIVPROC real_glSecondaryColor3uiv = NULL;
+static void APIENTRY profile_glSecondaryColor3uiv(const GLuint *v) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glSecondaryColor3uiv(v);
+	glad_profile_record(411, glad_start);
+}
+static PFNGLSECONDARYCOLOR3USPROC real_glSecondaryColor3us = NULL;
+static void APIENTRY profile_glSecondaryColor3us(GLushort red, GLushort green, GLushort blue) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glSecondaryColor3us(red, green, blue);
+	glad_profile_record(412, glad_start);
+}
+static PFNGLSECONDARYCOLOR3USVPROC real_glSecondaryColor3usv = NULL;
+static void APIENTRY profile_glSecondaryColor3usv(const GLushort *v) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glSecondaryColor3usv(v);
+	glad_profile_record(413, glad_start);
+}
+static PFNGLSECONDARYCOLORPOINTERPROC real_glSecondaryColorPointer = NULL;
+static void APIENTRY profile_glSecondaryColorPointer(GLint size, GLenum type, GLsizei stride, const void *pointer) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glSecondaryColorPointer(size, type, stride, pointer);
+	glad_profile_record(414, glad_start);
+}
+static PFNGLWINDOWPOS2DPROC real_glWindowPos2d = NULL;
+static void APIENTRY profile_glWindowPos2d(GLdouble x, GLdouble y) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glWindowPos2d(x, y);
+	glad_profile_record(415, glad_start);
+}
+static PFNGLWINDOWPOS2DVPROC real_glWindowPos2dv = NULL;
+static void APIENTRY profile_glWindowPos2dv(const GLdouble *v) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glWindowPos2dv(v);
+	glad_profile_record(416, glad_start);
+}
+static PFNGLWINDOWPOS2FPROC real_glWindowPos2f = NULL;
+static void APIENTRY profile_glWindowPos2f(GLfloat x, GLfloat y) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glWindowPos2f(x, y);
+	glad_profile_record(417, glad_start);
+}
+static PFNGLWINDOWPOS2FVPROC real_glWindowPos2fv = NULL;
+static void APIENTRY profile_glWindowPos2fv(const GLfloat *v) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glWindowPos2fv(v);
+	glad_profile_record(418, glad_start);
+}
+static PFNGLWINDOWPOS2IPROC real_glWindowPos2i = NULL;
+static void APIENTRY profile_glWindowPos2i(GLint x, GLint y) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glWindowPos2i(x, y);
+	glad_profile_record(419, glad_start);
+}
+static PFNGLWINDOWPOS2IVPROC real_glWindowPos2iv = NULL;
+static void APIENTRY profile_glWindowPos2iv(const GLint *v) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glWindowPos2iv(v);
+	glad_profile_record(420, glad_start);
+}
+static PFNGLWINDOWPOS2SPROC real_glWindowPos2s = NULL;
+static void APIENTRY profile_glWindowPos2s(GLshort x, GLshort y) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glWindowPos2s(x, y);
+	glad_profile_record(421, glad_start);
+}
+static PFNGLWINDOWPOS2SVPROC real_glWindowPos2sv = NULL;
+static void APIENTRY profile_glWindowPos2sv(const GLshort *v) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glWindowPos2sv(v);
+	glad_profile_record(422, glad_start);
+}
+static PFNGLWINDOWPOS3DPROC real_glWindowPos3d = NULL;
+static void APIENTRY profile_glWindowPos3d(GLdouble x, GLdouble y, GLdouble z) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glWindowPos3d(x, y, z);
+	glad_profile_record(423, glad_start);
+}
+static PFNGLWINDOWPOS3DVPROC real_glWindowPos3dv = NULL;
+static void APIENTRY profile_glWindowPos3dv(const GLdouble *v) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glWindowPos3dv(v);
+	glad_profile_record(424, glad_start);
+}
+static PFNGLWINDOWPOS3FPROC real_glWindowPos3f = NULL;
+static void APIENTRY profile_glWindowPos3f(GLfloat x, GLfloat y, GLfloat z) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glWindowPos3f(x, y, z);
+	glad_profile_record(425, glad_start);
+}
+static PFNGLWINDOWPOS3FVPROC real_glWindowPos3fv = NULL;
+static void APIENTRY profile_glWindowPos3fv(const GLfloat *v) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glWindowPos3fv(v);
+	glad_profile_record(426, glad_start);
+}
+static PFNGLWINDOWPOS3IPROC real_glWindowPos3i = NULL;
+static void APIENTRY profile_glWindowPos3i(GLint x, GLint y, GLint z) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glWindowPos3i(x, y, z);
+	glad_profile_record(427, glad_start);
+}
+static PFNGLWINDOWPOS3IVPROC real_glWindowPos3iv = NULL;
+static void APIENTRY profile_glWindowPos3iv(const GLint *v) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glWindowPos3iv(v);
+	glad_profile_record(428, glad_start);
+}
+static PFNGLWINDOWPOS3SPROC real_glWindowPos3s = NULL;
+static void APIENTRY profile_glWindowPos3s(GLshort x, GLshort y, GLshort z) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glWindowPos3s(x, y, z);
+	glad_profile_record(429, glad_start);
+}
+static PFNGLWINDOWPOS3SVPROC real_glWindowPos3sv = NULL;
+static void APIENTRY profile_glWindowPos3sv(const GLshort *v) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glWindowPos3sv(v);
+	glad_profile_record(430, glad_start);
+}
+static PFNGLBLENDCOLORPROC real_glBlendColor = NULL;
+static void APIENTRY profile_glBlendColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glBlendColor(red, green, blue, alpha);
+	glad_profile_record(431, glad_start);
+}
+static PFNGLBLENDEQUATIONPROC real_glBlendEquation = NULL;
+static void APIENTRY profile_glBlendEquation(GLenum mode) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glBlendEquation(mode);
+	glad_profile_record(432, glad_start);
+}
+static PFNGLGENQUERIESPROC real_glGenQueries = NULL;
+static void APIENTRY profile_glGenQueries(GLsizei n, GLuint *ids) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glGenQueries(n, ids);
+	glad_profile_record(433, glad_start);
+}
+static PFNGLDELETEQUERIESPROC real_glDeleteQueries = NULL;
+static void APIENTRY profile_glDeleteQueries(GLsizei n, const GLuint *ids) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glDeleteQueries(n, ids);
+	glad_profile_record(434, glad_start);
+}
+static PFNGLISQUERYPROC real_glIsQuery = NULL;
+static GLboolean APIENTRY profile_glIsQuery(GLuint id) {
+	GLboolean glad_result;
+	unsigned long long glad_start = glad_profile_now();
+	glad_result = real_glIsQuery(id);
+	glad_profile_record(435, glad_start);
+	return glad_result;
+}
+static PFNGLBEGINQUERYPROC real_glBeginQuery = NULL;
+static void APIENTRY profile_glBeginQuery(GLenum target, GLuint id) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glBeginQuery(target, id);
+	glad_profile_record(436, glad_start);
+}
+static PFNGLENDQUERYPROC real_glEndQuery = NULL;
+static void APIENTRY profile_glEndQuery(GLenum target) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glEndQuery(target);
+	glad_profile_record(437, glad_start);
+}
+static PFNGLGETQUERYIVPROC real_glGetQueryiv = NULL;
+static void APIENTRY profile_glGetQueryiv(GLenum target, GLenum pname, GLint *params) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glGetQueryiv(target, pname, params);
+	glad_profile_record(438, glad_start);
+}
+static PFNGLGETQUERYOBJECTIVPROC real_glGetQueryObjectiv = NULL;
+static void APIENTRY profile_glGetQueryObjectiv(GLuint id, GLenum pname, GLint *params) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glGetQueryObjectiv(id, pname, params);
+	glad_profile_record(439, glad_start);
+}
+static PFNGLGETQUERYOBJECTUIVPROC real_glGetQueryObjectuiv = NULL;
+static void APIENTRY profile_glGetQueryObjectuiv(GLuint id, GLenum pname, GLuint *params) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glGetQueryObjectuiv(id, pname, params);
+	glad_profile_record(440, glad_start);
+}
+static PFNGLBINDBUFFERPROC real_glBindBuffer = NULL;
+static void APIENTRY profile_glBindBuffer(GLenum target, GLuint buffer) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glBindBuffer(target, buffer);
+	glad_profile_record(441, glad_start);
+}
+static PFNGLDELETEBUFFERSPROC real_glDeleteBuffers = NULL;
+static void APIENTRY profile_glDeleteBuffers(GLsizei n, const GLuint *buffers) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glDeleteBuffers(n, buffers);
+	glad_profile_record(442, glad_start);
+}
+static PFNGLGENBUFFERSPROC real_glGenBuffers = NULL;
+static void APIENTRY profile_glGenBuffers(GLsizei n, GLuint *buffers) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glGenBuffers(n, buffers);
+	glad_profile_record(443, glad_start);
+}
+static PFNGLISBUFFERPROC real_glIsBuffer = NULL;
+static GLboolean APIENTRY profile_glIsBuffer(GLuint buffer) {
+	GLboolean glad_result;
+	unsigned long long glad_start = glad_profile_now();
+	glad_result = real_glIsBuffer(buffer);
+	glad_profile_record(444, glad_start);
+	return glad_result;
+}
+static PFNGLBUFFERDATAPROC real_glBufferData = NULL;
+static void APIENTRY profile_glBufferData(GLenum target, GLsizeiptr size, const void *data, GLenum usage) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glBufferData(target, size, data, usage);
+	glad_profile_record(445, glad_start);
+}
+static PFNGLBUFFERSUBDATAPROC real_glBufferSubData = NULL;
+static void APIENTRY profile_glBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const void *data) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glBufferSubData(target, offset, size, data);
+	glad_profile_record(446, glad_start);
+}
+static PFNGLGETBUFFERSUBDATAPROC real_glGetBufferSubData = NULL;
+static void APIENTRY profile_glGetBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, void *data) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glGetBufferSubData(target, offset, size, data);
+	glad_profile_record(447, glad_start);
+}
+static PFNGLMAPBUFFERPROC real_glMapBuffer = NULL;
+static void * APIENTRY profile_glMapBuffer(GLenum target, GLenum access) {
+	void * glad_result;
+	unsigned long long glad_start = glad_profile_now();
+	glad_result = real_glMapBuffer(target, access);
+	glad_profile_record(448, glad_start);
+	return glad_result;
+}
+static PFNGLUNMAPBUFFERPROC real_glUnmapBuffer = NULL;
+static GLboolean APIENTRY profile_glUnmapBuffer(GLenum target) {
+	GLboolean glad_result;
+	unsigned long long glad_start = glad_profile_now();
+	glad_result = real_glUnmapBuffer(target);
+	glad_profile_record(449, glad_start);
+	return glad_result;
+}
+static PFNGLGETBUFFERPARAMETERIVPROC real_glGetBufferParameteriv = NULL;
+static void APIENTRY profile_glGetBufferParameteriv(GLenum target, GLenum pname, GLint *params) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glGetBufferParameteriv(target, pname, params);
+	glad_profile_record(450, glad_start);
+}
+static PFNGLGETBUFFERPOINTERVPROC real_glGetBufferPointerv = NULL;
+static void APIENTRY profile_glGetBufferPointerv(GLenum target, GLenum pname, void **params) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glGetBufferPointerv(target, pname, params);
+	glad_profile_record(451, glad_start);
+}
+static PFNGLBLENDEQUATIONSEPARATEPROC real_glBlendEquationSeparate = NULL;
+static void APIENTRY profile_glBlendEquationSeparate(GLenum modeRGB, GLenum modeAlpha) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glBlendEquationSeparate(modeRGB, modeAlpha);
+	glad_profile_record(452, glad_start);
+}
+static PFNGLDRAWBUFFERSPROC real_glDrawBuffers = NULL;
+static void APIENTRY profile_glDrawBuffers(GLsizei n, const GLenum *bufs) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glDrawBuffers(n, bufs);
+	glad_profile_record(453, glad_start);
+}
+static PFNGLSTENCILOPSEPARATEPROC real_glStencilOpSeparate = NULL;
+static void APIENTRY profile_glStencilOpSeparate(GLenum face, GLenum sfail, GLenum dpfail, GLenum dppass) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glStencilOpSeparate(face, sfail, dpfail, dppass);
+	glad_profile_record(454, glad_start);
+}
+static PFNGLSTENCILFUNCSEPARATEPROC real_glStencilFuncSeparate = NULL;
+static void APIENTRY profile_glStencilFuncSeparate(GLenum face, GLenum func, GLint ref, GLuint mask) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glStencilFuncSeparate(face, func, ref, mask);
+	glad_profile_record(455, glad_start);
+}
+static PFNGLSTENCILMASKSEPARATEPROC real_glStencilMaskSeparate = NULL;
+static void APIENTRY profile_glStencilMaskSeparate(GLenum face, GLuint mask) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glStencilMaskSeparate(face, mask);
+	glad_profile_record(456, glad_start);
+}
+static PFNGLATTACHSHADERPROC real_glAttachShader = NULL;
+static void APIENTRY profile_glAttachShader(GLuint program, GLuint shader) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glAttachShader(program, shader);
+	glad_profile_record(457, glad_start);
+}
+static PFNGLBINDATTRIBLOCATIONPROC real_glBindAttribLocation = NULL;
+static void APIENTRY profile_glBindAttribLocation(GLuint program, GLuint index, const GLchar *name) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glBindAttribLocation(program, index, name);
+	glad_profile_record(458, glad_start);
+}
+static PFNGLCOMPILESHADERPROC real_glCompileShader = NULL;
+static void APIENTRY profile_glCompileShader(GLuint shader) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glCompileShader(shader);
+	glad_profile_record(459, glad_start);
+}
+static PFNGLCREATEPROGRAMPROC real_glCreateProgram = NULL;
+static GLuint APIENTRY profile_glCreateProgram(void) {
+	GLuint glad_result;
+	unsigned long long glad_start = glad_profile_now();
+	glad_result = real_glCreateProgram();
+	glad_profile_record(460, glad_start);
+	return glad_result;
+}
+static PFNGLCREATESHADERPROC real_glCreateShader = NULL;
+static GLuint APIENTRY profile_glCreateShader(GLenum type) {
+	GLuint glad_result;
+	unsigned long long glad_start = glad_profile_now();
+	glad_result = real_glCreateShader(type);
+	glad_profile_record(461, glad_start);
+	return glad_result;
+}
+static PFNGLDELETEPROGRAMPROC real_glDeleteProgram = NULL;
+static void APIENTRY profile_glDeleteProgram(GLuint program) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glDeleteProgram(program);
+	glad_profile_record(462, glad_start);
+}
+static PFNGLDELETESHADERPROC real_glDeleteShader = NULL;
+static void APIENTRY profile_glDeleteShader(GLuint shader) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glDeleteShader(shader);
+	glad_profile_record(463, glad_start);
+}
+static PFNGLDETACHSHADERPROC real_glDetachShader = NULL;
+static void APIENTRY profile_glDetachShader(GLuint program, GLuint shader) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glDetachShader(program, shader);
+	glad_profile_record(464, glad_start);
+}
+static PFNGLDISABLEVERTEXATTRIBARRAYPROC real_glDisableVertexAttribArray = NULL;
+static void APIENTRY profile_glDisableVertexAttribArray(GLuint index) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glDisableVertexAttribArray(index);
+	glad_profile_record(465, glad_start);
+}
+static PFNGLENABLEVERTEXATTRIBARRAYPROC real_glEnableVertexAttribArray = NULL;
+static void APIENTRY profile_glEnableVertexAttribArray(GLuint index) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glEnableVertexAttribArray(index);
+	glad_profile_record(466, glad_start);
+}
+static PFNGLGETACTIVEATTRIBPROC real_glGetActiveAttrib = NULL;
+static void APIENTRY profile_glGetActiveAttrib(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glGetActiveAttrib(program, index, bufSize, length, size, type, name);
+	glad_profile_record(467, glad_start);
+}
+static PFNGLGETACTIVEUNIFORMPROC real_glGetActiveUniform = NULL;
+static void APIENTRY profile_glGetActiveUniform(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glGetActiveUniform(program, index, bufSize, length, size, type, name);
+	glad_profile_record(468, glad_start);
+}
+static PFNGLGETATTACHEDSHADERSPROC real_glGetAttachedShaders = NULL;
+static void APIENTRY profile_glGetAttachedShaders(GLuint program, GLsizei maxCount, GLsizei *count, GLuint *shaders) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glGetAttachedShaders(program, maxCount, count, shaders);
+	glad_profile_record(469, glad_start);
+}
+static PFNGLGETATTRIBLOCATIONPROC real_glGetAttribLocation = NULL;
+static GLint APIENTRY profile_glGetAttribLocation(GLuint program, const GLchar *name) {
+	GLint glad_result;
+	unsigned long long glad_start = glad_profile_now();
+	glad_result = real_glGetAttribLocation(program, name);
+	glad_profile_record(470, glad_start);
+	return glad_result;
+}
+static PFNGLGETPROGRAMIVPROC real_glGetProgramiv = NULL;
+static void APIENTRY profile_glGetProgramiv(GLuint program, GLenum pname, GLint *params) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glGetProgramiv(program, pname, params);
+	glad_profile_record(471, glad_start);
+}
+static PFNGLGETPROGRAMINFOLOGPROC real_glGetProgramInfoLog = NULL;
+static void APIENTRY profile_glGetProgramInfoLog(GLuint program, GLsizei bufSize, GLsizei *length, GLchar *infoLog) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glGetProgramInfoLog(program, bufSize, length, infoLog);
+	glad_profile_record(472, glad_start);
+}
+static PFNGLGETSHADERIVPROC real_glGetShaderiv = NULL;
+static void APIENTRY profile_glGetShaderiv(GLuint shader, GLenum pname, GLint *params) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glGetShaderiv(shader, pname, params);
+	glad_profile_record(473, glad_start);
+}
+static PFNGLGETSHADERINFOLOGPROC real_glGetShaderInfoLog = NULL;
+static void APIENTRY profile_glGetShaderInfoLog(GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *infoLog) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glGetShaderInfoLog(shader, bufSize, length, infoLog);
+	glad_profile_record(474, glad_start);
+}
+static PFNGLGETSHADERSOURCEPROC real_glGetShaderSource = NULL;
+static void APIENTRY profile_glGetShaderSource(GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *source) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glGetShaderSource(shader, bufSize, length, source);
+	glad_profile_record(475, glad_start);
+}
+static PFNGLGETUNIFORMLOCATIONPROC real_glGetUniformLocation = NULL;
+static GLint APIENTRY profile_glGetUniformLocation(GLuint program, const GLchar *name) {
+	GLint glad_result;
+	unsigned long long glad_start = glad_profile_now();
+	glad_result = real_glGetUniformLocation(program, name);
+	glad_profile_record(476, glad_start);
+	return glad_result;
+}
+static PFNGLGETUNIFORMFVPROC real_glGetUniformfv = NULL;
+static void APIENTRY profile_glGetUniformfv(GLuint program, GLint location, GLfloat *params) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glGetUniformfv(program, location, params);
+	glad_profile_record(477, glad_start);
+}
+static PFNGLGETUNIFORMIVPROC real_glGetUniformiv = NULL;
+static void APIENTRY profile_glGetUniformiv(GLuint program, GLint location, GLint *params) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glGetUniformiv(program, location, params);
+	glad_profile_record(478, glad_start);
+}
+static PFNGLGETVERTEXATTRIBDVPROC real_glGetVertexAttribdv = NULL;
+static void APIENTRY profile_glGetVertexAttribdv(GLuint index, GLenum pname, GLdouble *params) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glGetVertexAttribdv(index, pname, params);
+	glad_profile_record(479, glad_start);
+}
+static PFNGLGETVERTEXATTRIBFVPROC real_glGetVertexAttribfv = NULL;
+static void APIENTRY profile_glGetVertexAttribfv(GLuint index, GLenum pname, GLfloat *params) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glGetVertexAttribfv(index, pname, params);
+	glad_profile_record(480, glad_start);
+}
+static PFNGLGETVERTEXATTRIBIVPROC real_glGetVertexAttribiv = NULL;
+static void APIENTRY profile_glGetVertexAttribiv(GLuint index, GLenum pname, GLint *params) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glGetVertexAttribiv(index, pname, params);
+	glad_profile_record(481, glad_start);
+}
+static PFNGLGETVERTEXATTRIBPOINTERVPROC real_glGetVertexAttribPointerv = NULL;
+static void APIENTRY profile_glGetVertexAttribPointerv(GLuint index, GLenum pname, void **pointer) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glGetVertexAttribPointerv(index, pname, pointer);
+	glad_profile_record(482, glad_start);
+}
+static PFNGLISPROGRAMPROC real_glIsProgram = NULL;
+static GLboolean APIENTRY profile_glIsProgram(GLuint program) {
+	GLboolean glad_result;
+	unsigned long long glad_start = glad_profile_now();
+	glad_result = real_glIsProgram(program);
+	glad_profile_record(483, glad_start);
+	return glad_result;
+}
+static PFNGLISSHADERPROC real_glIsShader = NULL;
+static GLboolean APIENTRY profile_glIsShader(GLuint shader) {
+	GLboolean glad_result;
+	unsigned long long glad_start = glad_profile_now();
+	glad_result = real_glIsShader(shader);
+	glad_profile_record(484, glad_start);
+	return glad_result;
+}
+static PFNGLLINKPROGRAMPROC real_glLinkProgram = NULL;
+static void APIENTRY profile_glLinkProgram(GLuint program) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glLinkProgram(program);
+	glad_profile_record(485, glad_start);
+}
+static PFNGLSHADERSOURCEPROC real_glShaderSource = NULL;
+static void APIENTRY profile_glShaderSource(GLuint shader, GLsizei count, const GLchar *const*string, const GLint *length) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glShaderSource(shader, count, string, length);
+	glad_profile_record(486, glad_start);
+}
+static PFNGLUSEPROGRAMPROC real_glUseProgram = NULL;
+static void APIENTRY profile_glUseProgram(GLuint program) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glUseProgram(program);
+	glad_profile_record(487, glad_start);
+}
+static PFNGLUNIFORM1FPROC real_glUniform1f = NULL;
+static void APIENTRY profile_glUniform1f(GLint location, GLfloat v0) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glUniform1f(location, v0);
+	glad_profile_record(488, glad_start);
+}
+static PFNGLUNIFORM2FPROC real_glUniform2f = NULL;
+static void APIENTRY profile_glUniform2f(GLint location, GLfloat v0, GLfloat v1) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glUniform2f(location, v0, v1);
+	glad_profile_record(489, glad_start);
+}
+static PFNGLUNIFORM3FPROC real_glUniform3f = NULL;
+static void APIENTRY profile_glUniform3f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glUniform3f(location, v0, v1, v2);
+	glad_profile_record(490, glad_start);
+}
+static PFNGLUNIFORM4FPROC real_glUniform4f = NULL;
+static void APIENTRY profile_glUniform4f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glUniform4f(location, v0, v1, v2, v3);
+	glad_profile_record(491, glad_start);
+}
+static PFNGLUNIFORM1IPROC real_glUniform1i = NULL;
+static void APIENTRY profile_glUniform1i(GLint location, GLint v0) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glUniform1i(location, v0);
+	glad_profile_record(492, glad_start);
+}
+static PFNGLUNIFORM2IPROC real_glUniform2i = NULL;
+static void APIENTRY profile_glUniform2i(GLint location, GLint v0, GLint v1) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glUniform2i(location, v0, v1);
+	glad_profile_record(493, glad_start);
+}
+static PFNGLUNIFORM3IPROC real_glUniform3i = NULL;
+static void APIENTRY profile_glUniform3i(GLint location, GLint v0, GLint v1, GLint v2) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glUniform3i(location, v0, v1, v2);
+	glad_profile_record(494, glad_start);
+}
+static PFNGLUNIFORM4IPROC real_glUniform4i = NULL;
+static void APIENTRY profile_glUniform4i(GLint location, GLint v0, GLint v1, GLint v2, GLint v3) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glUniform4i(location, v0, v1, v2, v3);
+	glad_profile_record(495, glad_start);
+}
+static PFNGLUNIFORM1FVPROC real_glUniform1fv = NULL;
+static void APIENTRY profile_glUniform1fv(GLint location, GLsizei count, const GLfloat *value) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glUniform1fv(location, count, value);
+	glad_profile_record(496, glad_start);
+}
+static PFNGLUNIFORM2FVPROC real_glUniform2fv = NULL;
+static void APIENTRY profile_glUniform2fv(GLint location, GLsizei count, const GLfloat *value) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glUniform2fv(location, count, value);
+	glad_profile_record(497, glad_start);
+}
+static PFNGLUNIFORM3FVPROC real_glUniform3fv = NULL;
+static void APIENTRY profile_glUniform3fv(GLint location, GLsizei count, const GLfloat *value) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glUniform3fv(location, count, value);
+	glad_profile_record(498, glad_start);
+}
+static PFNGLUNIFORM4FVPROC real_glUniform4fv = NULL;
+static void APIENTRY profile_glUniform4fv(GLint location, GLsizei count, const GLfloat *value) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glUniform4fv(location, count, value);
+	glad_profile_record(499, glad_start);
+}
+static PFNGLUNIFORM1IVPROC real_glUniform1iv = NULL;
+static void APIENTRY profile_glUniform1iv(GLint location, GLsizei count, const GLint *value) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glUniform1iv(location, count, value);
+	glad_profile_record(500, glad_start);
+}
+static PFNGLUNIFORM2IVPROC real_glUniform2iv = NULL;
+static void APIENTRY profile_glUniform2iv(GLint location, GLsizei count, const GLint *value) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glUniform2iv(location, count, value);
+	glad_profile_record(501, glad_start);
+}
+static PFNGLUNIFORM3IVPROC real_glUniform3iv = NULL;
+static void APIENTRY profile_glUniform3iv(GLint location, GLsizei count, const GLint *value) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glUniform3iv(location, count, value);
+	glad_profile_record(502, glad_start);
+}
+static PFNGLUNIFORM4IVPROC real_glUniform4iv = NULL;
+static void APIENTRY profile_glUniform4iv(GLint location, GLsizei count, const GLint *value) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glUniform4iv(location, count, value);
+	glad_profile_record(503, glad_start);
+}
+static PFNGLUNIFORMMATRIX2FVPROC real_glUniformMatrix2fv = NULL;
+static void APIENTRY profile_glUniformMatrix2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glUniformMatrix2fv(location, count, transpose, value);
+	glad_profile_record(504, glad_start);
+}
+static PFNGLUNIFORMMATRIX3FVPROC real_glUniformMatrix3fv = NULL;
+static void APIENTRY profile_glUniformMatrix3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glUniformMatrix3fv(location, count, transpose, value);
+	glad_profile_record(505, glad_start);
+}
+static PFNGLUNIFORMMATRIX4FVPROC real_glUniformMatrix4fv = NULL;
+static void APIENTRY profile_glUniformMatrix4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glUniformMatrix4fv(location, count, transpose, value);
+	glad_profile_record(506, glad_start);
+}
+static PFNGLVALIDATEPROGRAMPROC real_glValidateProgram = NULL;
+static void APIENTRY profile_glValidateProgram(GLuint program) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glValidateProgram(program);
+	glad_profile_record(507, glad_start);
+}
+static PFNGLVERTEXATTRIB1DPROC real_glVertexAttrib1d = NULL;
+static void APIENTRY profile_glVertexAttrib1d(GLuint index, GLdouble x) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glVertexAttrib1d(index, x);
+	glad_profile_record(508, glad_start);
+}
+static PFNGLVERTEXATTRIB1DVPROC real_glVertexAttrib1dv = NULL;
+static void APIENTRY profile_glVertexAttrib1dv(GLuint index, const GLdouble *v) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glVertexAttrib1dv(index, v);
+	glad_profile_record(509, glad_start);
+}
+static PFNGLVERTEXATTRIB1FPROC real_glVertexAttrib1f = NULL;
+static void APIENTRY profile_glVertexAttrib1f(GLuint index, GLfloat x) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glVertexAttrib1f(index, x);
+	glad_profile_record(510, glad_start);
+}
+static PFNGLVERTEXATTRIB1FVPROC real_glVertexAttrib1fv = NULL;
+static void APIENTRY profile_glVertexAttrib1fv(GLuint index, const GLfloat *v) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glVertexAttrib1fv(index, v);
+	glad_profile_record(511, glad_start);
+}
+static PFNGLVERTEXATTRIB1SPROC real_glVertexAttrib1s = NULL;
+static void APIENTRY profile_glVertexAttrib1s(GLuint index, GLshort x) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glVertexAttrib1s(index, x);
+	glad_profile_record(512, glad_start);
+}
+static PFNGLVERTEXATTRIB1SVPROC real_glVertexAttrib1sv = NULL;
+static void APIENTRY profile_glVertexAttrib1sv(GLuint index, const GLshort *v) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glVertexAttrib1sv(index, v);
+	glad_profile_record(513, glad_start);
+}
+static PFNGLVERTEXATTRIB2DPROC real_glVertexAttrib2d = NULL;
+static void APIENTRY profile_glVertexAttrib2d(GLuint index, GLdouble x, GLdouble y) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glVertexAttrib2d(index, x, y);
+	glad_profile_record(514, glad_start);
+}
+static PFNGLVERTEXATTRIB2DVPROC real_glVertexAttrib2dv = NULL;
+static void APIENTRY profile_glVertexAttrib2dv(GLuint index, const GLdouble *v) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glVertexAttrib2dv(index, v);
+	glad_profile_record(515, glad_start);
+}
+static PFNGLVERTEXATTRIB2FPROC real_glVertexAttrib2f = NULL;
+static void APIENTRY profile_glVertexAttrib2f(GLuint index, GLfloat x, GLfloat y) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glVertexAttrib2f(index, x, y);
+	glad_profile_record(516, glad_start);
+}
+static PFNGLVERTEXATTRIB2FVPROC real_glVertexAttrib2fv = NULL;
+static void APIENTRY profile_glVertexAttrib2fv(GLuint index, const GLfloat *v) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glVertexAttrib2fv(index, v);
+	glad_profile_record(517, glad_start);
+}
+static PFNGLVERTEXATTRIB2SPROC real_glVertexAttrib2s = NULL;
+static void APIENTRY profile_glVertexAttrib2s(GLuint index, GLshort x, GLshort y) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glVertexAttrib2s(index, x, y);
+	glad_profile_record(518, glad_start);
+}
+static PFNGLVERTEXATTRIB2SVPROC real_glVertexAttrib2sv = NULL;
+static void APIENTRY profile_glVertexAttrib2sv(GLuint index, const GLshort *v) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glVertexAttrib2sv(index, v);
+	glad_profile_record(519, glad_start);
+}
+static PFNGLVERTEXATTRIB3DPROC real_glVertexAttrib3d = NULL;
+static void APIENTRY profile_glVertexAttrib3d(GLuint index, GLdouble x, GLdouble y, GLdouble z) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glVertexAttrib3d(index, x, y, z);
+	glad_profile_record(520, glad_start);
+}
+static PFNGLVERTEXATTRIB3DVPROC real_glVertexAttrib3dv = NULL;
+static void APIENTRY profile_glVertexAttrib3dv(GLuint index, const GLdouble *v) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glVertexAttrib3dv(index, v);
+	glad_profile_record(521, glad_start);
+}
+static PFNGLVERTEXATTRIB3FPROC real_glVertexAttrib3f = NULL;
+static void APIENTRY profile_glVertexAttrib3f(GLuint index, GLfloat x, GLfloat y, GLfloat z) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glVertexAttrib3f(index, x, y, z);
+	glad_profile_record(522, glad_start);
+}
+static PFNGLVERTEXATTRIB3FVPROC real_glVertexAttrib3fv = NULL;
+static void APIENTRY profile_glVertexAttrib3fv(GLuint index, const GLfloat *v) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glVertexAttrib3fv(index, v);
+	glad_profile_record(523, glad_start);
+}
+static PFNGLVERTEXATTRIB3SPROC real_glVertexAttrib3s = NULL;
+static void APIENTRY profile_glVertexAttrib3s(GLuint index, GLshort x, GLshort y, GLshort z) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glVertexAttrib3s(index, x, y, z);
+	glad_profile_record(524, glad_start);
+}
+static PFNGLVERTEXATTRIB3SVPROC real_glVertexAttrib3sv = NULL;
+static void APIENTRY profile_glVertexAttrib3sv(GLuint index, const GLshort *v) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glVertexAttrib3sv(index, v);
+	glad_profile_record(525, glad_start);
+}
+static PFNGLVERTEXATTRIB4NBVPROC real_glVertexAttrib4Nbv = NULL;
+static void APIENTRY profile_glVertexAttrib4Nbv(GLuint index, const GLbyte *v) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glVertexAttrib4Nbv(index, v);
+	glad_profile_record(526, glad_start);
+}
+static PFNGLVERTEXATTRIB4NIVPROC real_glVertexAttrib4Niv = NULL;
+static void APIENTRY profile_glVertexAttrib4Niv(GLuint index, const GLint *v) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glVertexAttrib4Niv(index, v);
+	glad_profile_record(527, glad_start);
+}
+static PFNGLVERTEXATTRIB4NSVPROC real_glVertexAttrib4Nsv = NULL;
+static void APIENTRY profile_glVertexAttrib4Nsv(GLuint index, const GLshort *v) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glVertexAttrib4Nsv(index, v);
+	glad_profile_record(528, glad_start);
+}
+static PFNGLVERTEXATTRIB4NUBPROC real_glVertexAttrib4Nub = NULL;
+static void APIENTRY profile_glVertexAttrib4Nub(GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glVertexAttrib4Nub(index, x, y, z, w);
+	glad_profile_record(529, glad_start);
+}
+static PFNGLVERTEXATTRIB4NUBVPROC real_glVertexAttrib4Nubv = NULL;
+static void APIENTRY profile_glVertexAttrib4Nubv(GLuint index, const GLubyte *v) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glVertexAttrib4Nubv(index, v);
+	glad_profile_record(530, glad_start);
+}
+static PFNGLVERTEXATTRIB4NUIVPROC real_glVertexAttrib4Nuiv = NULL;
+static void APIENTRY profile_glVertexAttrib4Nuiv(GLuint index, const GLuint *v) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glVertexAttrib4Nuiv(index, v);
+	glad_profile_record(531, glad_start);
+}
+static PFNGLVERTEXATTRIB4NUSVPROC real_glVertexAttrib4Nusv = NULL;
+static void APIENTRY profile_glVertexAttrib4Nusv(GLuint index, const GLushort *v) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glVertexAttrib4Nusv(index, v);
+	glad_profile_record(532, glad_start);
+}
+static PFNGLVERTEXATTRIB4BVPROC real_glVertexAttrib4bv = NULL;
+static void APIENTRY profile_glVertexAttrib4bv(GLuint index, const GLbyte *v) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glVertexAttrib4bv(index, v);
+	glad_profile_record(533, glad_start);
+}
+static PFNGLVERTEXATTRIB4DPROC real_glVertexAttrib4d = NULL;
+static void APIENTRY profile_glVertexAttrib4d(GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glVertexAttrib4d(index, x, y, z, w);
+	glad_profile_record(534, glad_start);
+}
+static PFNGLVERTEXATTRIB4DVPROC real_glVertexAttrib4dv = NULL;
+static void APIENTRY profile_glVertexAttrib4dv(GLuint index, const GLdouble *v) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glVertexAttrib4dv(index, v);
+	glad_profile_record(535, glad_start);
+}
+static PFNGLVERTEXATTRIB4FPROC real_glVertexAttrib4f = NULL;
+static void APIENTRY profile_glVertexAttrib4f(GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glVertexAttrib4f(index, x, y, z, w);
+	glad_profile_record(536, glad_start);
+}
+static PFNGLVERTEXATTRIB4FVPROC real_glVertexAttrib4fv = NULL;
+static void APIENTRY profile_glVertexAttrib4fv(GLuint index, const GLfloat *v) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glVertexAttrib4fv(index, v);
+	glad_profile_record(537, glad_start);
+}
+static PFNGLVERTEXATTRIB4IVPROC real_glVertexAttrib4iv = NULL;
+static void APIENTRY profile_glVertexAttrib4iv(GLuint index, const GLint *v) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glVertexAttrib4iv(index, v);
+	glad_profile_record(538, glad_start);
+}
+static PFNGLVERTEXATTRIB4SPROC real_glVertexAttrib4s = NULL;
+static void APIENTRY profile_glVertexAttrib4s(GLuint index, GLshort x, GLshort y, GLshort z, GLshort w) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glVertexAttrib4s(index, x, y, z, w);
+	glad_profile_record(539, glad_start);
+}
+static PFNGLVERTEXATTRIB4SVPROC real_glVertexAttrib4sv = NULL;
+static void APIENTRY profile_glVertexAttrib4sv(GLuint index, const GLshort *v) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glVertexAttrib4sv(index, v);
+	glad_profile_record(540, glad_start);
+}
+static PFNGLVERTEXATTRIB4UBVPROC real_glVertexAttrib4ubv = NULL;
+static void APIENTRY profile_glVertexAttrib4ubv(GLuint index, const GLubyte *v) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glVertexAttrib4ubv(index, v);
+	glad_profile_record(541, glad_start);
+}
+static PFNGLVERTEXATTRIB4UIVPROC real_glVertexAttrib4uiv = NULL;
+static void APIENTRY profile_glVertexAttrib4uiv(GLuint index, const GLuint *v) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glVertexAttrib4uiv(index, v);
+	glad_profile_record(542, glad_start);
+}
+static PFNGLVERTEXATTRIB4USVPROC real_glVertexAttrib4usv = NULL;
+static void APIENTRY profile_glVertexAttrib4usv(GLuint index, const GLushort *v) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glVertexAttrib4usv(index, v);
+	glad_profile_record(543, glad_start);
+}
+static PFNGLVERTEXATTRIBPOINTERPROC real_glVertexAttribPointer = NULL;
+static void APIENTRY profile_glVertexAttribPointer(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void *pointer) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glVertexAttribPointer(index, size, type, normalized, stride, pointer);
+	glad_profile_record(544, glad_start);
+}
+static PFNGLUNIFORMMATRIX2X3FVPROC real_glUniformMatrix2x3fv = NULL;
+static void APIENTRY profile_glUniformMatrix2x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glUniformMatrix2x3fv(location, count, transpose, value);
+	glad_profile_record(545, glad_start);
+}
+static PFNGLUNIFORMMATRIX3X2FVPROC real_glUniformMatrix3x2fv = NULL;
+static void APIENTRY profile_glUniformMatrix3x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glUniformMatrix3x2fv(location, count, transpose, value);
+	glad_profile_record(546, glad_start);
+}
+static PFNGLUNIFORMMATRIX2X4FVPROC real_glUniformMatrix2x4fv = NULL;
+static void APIENTRY profile_glUniformMatrix2x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glUniformMatrix2x4fv(location, count, transpose, value);
+	glad_profile_record(547, glad_start);
+}
+static PFNGLUNIFORMMATRIX4X2FVPROC real_glUniformMatrix4x2fv = NULL;
+static void APIENTRY profile_glUniformMatrix4x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glUniformMatrix4x2fv(location, count, transpose, value);
+	glad_profile_record(548, glad_start);
+}
+static PFNGLUNIFORMMATRIX3X4FVPROC real_glUniformMatrix3x4fv = NULL;
+static void APIENTRY profile_glUniformMatrix3x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glUniformMatrix3x4fv(location, count, transpose, value);
+	glad_profile_record(549, glad_start);
+}
+static PFNGLUNIFORMMATRIX4X3FVPROC real_glUniformMatrix4x3fv = NULL;
+static void APIENTRY profile_glUniformMatrix4x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glUniformMatrix4x3fv(location, count, transpose, value);
+	glad_profile_record(550, glad_start);
+}
+static PFNGLCOLORMASKIPROC real_glColorMaski = NULL;
+static void APIENTRY profile_glColorMaski(GLuint index, GLboolean r, GLboolean g, GLboolean b, GLboolean a) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glColorMaski(index, r, g, b, a);
+	glad_profile_record(551, glad_start);
+}
+static PFNGLGETBOOLEANI_VPROC real_glGetBooleani_v = NULL;
+static void APIENTRY profile_glGetBooleani_v(GLenum target, GLuint index, GLboolean *data) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glGetBooleani_v(target, index, data);
+	glad_profile_record(552, glad_start);
+}
+static PFNGLGETINTEGERI_VPROC real_glGetIntegeri_v = NULL;
+static void APIENTRY profile_glGetIntegeri_v(GLenum target, GLuint index, GLint *data) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glGetIntegeri_v(target, index, data);
+	glad_profile_record(553, glad_start);
+}
+static PFNGLENABLEIPROC real_glEnablei = NULL;
+static void APIENTRY profile_glEnablei(GLenum target, GLuint index) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glEnablei(target, index);
+	glad_profile_record(554, glad_start);
+}
+static PFNGLDISABLEIPROC real_glDisablei = NULL;
+static void APIENTRY profile_glDisablei(GLenum target, GLuint index) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glDisablei(target, index);
+	glad_profile_record(555, glad_start);
+}
+static PFNGLISENABLEDIPROC real_glIsEnabledi = NULL;
+static GLboolean APIENTRY profile_glIsEnabledi(GLenum target, GLuint index) {
+	GLboolean glad_result;
+	unsigned long long glad_start = glad_profile_now();
+	glad_result = real_glIsEnabledi(target, index);
+	glad_profile_record(556, glad_start);
+	return glad_result;
+}
+static PFNGLBEGINTRANSFORMFEEDBACKPROC real_glBeginTransformFeedback = NULL;
+static void APIENTRY profile_glBeginTransformFeedback(GLenum primitiveMode) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glBeginTransformFeedback(primitiveMode);
+	glad_profile_record(557, glad_start);
+}
+static PFNGLENDTRANSFORMFEEDBACKPROC real_glEndTransformFeedback = NULL;
+static void APIENTRY profile_glEndTransformFeedback(void) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glEndTransformFeedback();
+	glad_profile_record(558, glad_start);
+}
+static PFNGLBINDBUFFERRANGEPROC real_glBindBufferRange = NULL;
+static void APIENTRY profile_glBindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glBindBufferRange(target, index, buffer, offset, size);
+	glad_profile_record(559, glad_start);
+}
+static PFNGLBINDBUFFERBASEPROC real_glBindBufferBase = NULL;
+static void APIENTRY profile_glBindBufferBase(GLenum target, GLuint index, GLuint buffer) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glBindBufferBase(target, index, buffer);
+	glad_profile_record(560, glad_start);
+}
+static PFNGLTRANSFORMFEEDBACKVARYINGSPROC real_glTransformFeedbackVaryings = NULL;
+static void APIENTRY profile_glTransformFeedbackVaryings(GLuint program, GLsizei count, const GLchar *const*varyings, GLenum bufferMode) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glTransformFeedbackVaryings(program, count, varyings, bufferMode);
+	glad_profile_record(561, glad_start);
+}
+static PFNGLGETTRANSFORMFEEDBACKVARYINGPROC real_glGetTransformFeedbackVarying = NULL;
+static void APIENTRY profile_glGetTransformFeedbackVarying(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLsizei *size, GLenum *type, GLchar *name) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glGetTransformFeedbackVarying(program, index, bufSize, length, size, type, name);
+	glad_profile_record(562, glad_start);
+}
+static PFNGLCLAMPCOLORPROC real_glClampColor = NULL;
+static void APIENTRY profile_glClampColor(GLenum target, GLenum clamp) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glClampColor(target, clamp);
+	glad_profile_record(563, glad_start);
+}
+static PFNGLBEGINCONDITIONALRENDERPROC real_glBeginConditionalRender = NULL;
+static void APIENTRY profile_glBeginConditionalRender(GLuint id, GLenum mode) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glBeginConditionalRender(id, mode);
+	glad_profile_record(564, glad_start);
+}
+static PFNGLENDCONDITIONALRENDERPROC real_glEndConditionalRender = NULL;
+static void APIENTRY profile_glEndConditionalRender(void) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glEndConditionalRender();
+	glad_profile_record(565, glad_start);
+}
+static PFNGLVERTEXATTRIBIPOINTERPROC real_glVertexAttribIPointer = NULL;
+static void APIENTRY profile_glVertexAttribIPointer(GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glVertexAttribIPointer(index, size, type, stride, pointer);
+	glad_profile_record(566, glad_start);
+}
+static PFNGLGETVERTEXATTRIBIIVPROC real_glGetVertexAttribIiv = NULL;
+static void APIENTRY profile_glGetVertexAttribIiv(GLuint index, GLenum pname, GLint *params) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glGetVertexAttribIiv(index, pname, params);
+	glad_profile_record(567, glad_start);
+}
+static PFNGLGETVERTEXATTRIBIUIVPROC real_glGetVertexAttribIuiv = NULL;
+static void APIENTRY profile_glGetVertexAttribIuiv(GLuint index, GLenum pname, GLuint *params) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glGetVertexAttribIuiv(index, pname, params);
+	glad_profile_record(568, glad_start);
+}
+static PFNGLVERTEXATTRIBI1IPROC real_glVertexAttribI1i = NULL;
+static void APIENTRY profile_glVertexAttribI1i(GLuint index, GLint x) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glVertexAttribI1i(index, x);
+	glad_profile_record(569, glad_start);
+}
+static PFNGLVERTEXATTRIBI2IPROC real_glVertexAttribI2i = NULL;
+static void APIENTRY profile_glVertexAttribI2i(GLuint index, GLint x, GLint y) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glVertexAttribI2i(index, x, y);
+	glad_profile_record(570, glad_start);
+}
+static PFNGLVERTEXATTRIBI3IPROC real_glVertexAttribI3i = NULL;
+static void APIENTRY profile_glVertexAttribI3i(GLuint index, GLint x, GLint y, GLint z) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glVertexAttribI3i(index, x, y, z);
+	glad_profile_record(571, glad_start);
+}
+static PFNGLVERTEXATTRIBI4IPROC real_glVertexAttribI4i = NULL;
+static void APIENTRY profile_glVertexAttribI4i(GLuint index, GLint x, GLint y, GLint z, GLint w) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glVertexAttribI4i(index, x, y, z, w);
+	glad_profile_record(572, glad_start);
+}
+static PFNGLVERTEXATTRIBI1UIPROC real_glVertexAttribI1ui = NULL;
+static void APIENTRY profile_glVertexAttribI1ui(GLuint index, GLuint x) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glVertexAttribI1ui(index, x);
+	glad_profile_record(573, glad_start);
+}
+static PFNGLVERTEXATTRIBI2UIPROC real_glVertexAttribI2ui = NULL;
+static void APIENTRY profile_glVertexAttribI2ui(GLuint index, GLuint x, GLuint y) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glVertexAttribI2ui(index, x, y);
+	glad_profile_record(574, glad_start);
+}
+static PFNGLVERTEXATTRIBI3UIPROC real_glVertexAttribI3ui = NULL;
+static void APIENTRY profile_glVertexAttribI3ui(GLuint index, GLuint x, GLuint y, GLuint z) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glVertexAttribI3ui(index, x, y, z);
+	glad_profile_record(575, glad_start);
+}
+static PFNGLVERTEXATTRIBI4UIPROC real_glVertexAttribI4ui = NULL;
+static void APIENTRY profile_glVertexAttribI4ui(GLuint index, GLuint x, GLuint y, GLuint z, GLuint w) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glVertexAttribI4ui(index, x, y, z, w);
+	glad_profile_record(576, glad_start);
+}
+static PFNGLVERTEXATTRIBI1IVPROC real_glVertexAttribI1iv = NULL;
+static void APIENTRY profile_glVertexAttribI1iv(GLuint index, const GLint *v) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glVertexAttribI1iv(index, v);
+	glad_profile_record(577, glad_start);
+}
+static PFNGLVERTEXATTRIBI2IVPROC real_glVertexAttribI2iv = NULL;
+static void APIENTRY profile_glVertexAttribI2iv(GLuint index, const GLint *v) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glVertexAttribI2iv(index, v);
+	glad_profile_record(578, glad_start);
+}
+static PFNGLVERTEXATTRIBI3IVPROC real_glVertexAttribI3iv = NULL;
+static void APIENTRY profile_glVertexAttribI3iv(GLuint index, const GLint *v) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glVertexAttribI3iv(index, v);
+	glad_profile_record(579, glad_start);
+}
+static PFNGLVERTEXATTRIBI4IVPROC real_glVertexAttribI4iv = NULL;
+static void APIENTRY profile_glVertexAttribI4iv(GLuint index, const GLint *v) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glVertexAttribI4iv(index, v);
+	glad_profile_record(580, glad_start);
+}
+static PFNGLVERTEXATTRIBI1UIVPROC real_glVertexAttribI1uiv = NULL;
+static void APIENTRY profile_glVertexAttribI1uiv(GLuint index, const GLuint *v) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glVertexAttribI1uiv(index, v);
+	glad_profile_record(581, glad_start);
+}
+static PFNGLVERTEXATTRIBI2UIVPROC real_glVertexAttribI2uiv = NULL;
+static void APIENTRY profile_glVertexAttribI2uiv(GLuint index, const GLuint *v) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glVertexAttribI2uiv(index, v);
+	glad_profile_record(582, glad_start);
+}
+static PFNGLVERTEXATTRIBI3UIVPROC real_glVertexAttribI3uiv = NULL;
+static void APIENTRY profile_glVertexAttribI3uiv(GLuint index, const GLuint *v) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glVertexAttribI3uiv(index, v);
+	glad_profile_record(583, glad_start);
+}
+static PFNGLVERTEXATTRIBI4UIVPROC real_glVertexAttribI4uiv = NULL;
+static void APIENTRY profile_glVertexAttribI4uiv(GLuint index, const GLuint *v) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glVertexAttribI4uiv(index, v);
+	glad_profile_record(584, glad_start);
+}
+static PFNGLVERTEXATTRIBI4BVPROC real_glVertexAttribI4bv = NULL;
+static void APIENTRY profile_glVertexAttribI4bv(GLuint index, const GLbyte *v) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glVertexAttribI4bv(index, v);
+	glad_profile_record(585, glad_start);
+}
+static PFNGLVERTEXATTRIBI4SVPROC real_glVertexAttribI4sv = NULL;
+static void APIENTRY profile_glVertexAttribI4sv(GLuint index, const GLshort *v) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glVertexAttribI4sv(index, v);
+	glad_profile_record(586, glad_start);
+}
+static PFNGLVERTEXATTRIBI4UBVPROC real_glVertexAttribI4ubv = NULL;
+static void APIENTRY profile_glVertexAttribI4ubv(GLuint index, const GLubyte *v) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glVertexAttribI4ubv(index, v);
+	glad_profile_record(587, glad_start);
+}
+static PFNGLVERTEXATTRIBI4USVPROC real_glVertexAttribI4usv = NULL;
+static void APIENTRY profile_glVertexAttribI4usv(GLuint index, const GLushort *v) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glVertexAttribI4usv(index, v);
+	glad_profile_record(588, glad_start);
+}
+static PFNGLGETUNIFORMUIVPROC real_glGetUniformuiv = NULL;
+static void APIENTRY profile_glGetUniformuiv(GLuint program, GLint location, GLuint *params) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glGetUniformuiv(program, location, params);
+	glad_profile_record(589, glad_start);
+}
+static PFNGLBINDFRAGDATALOCATIONPROC real_glBindFragDataLocation = NULL;
+static void APIENTRY profile_glBindFragDataLocation(GLuint program, GLuint color, const GLchar *name) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glBindFragDataLocation(program, color, name);
+	glad_profile_record(590, glad_start);
+}
+static PFNGLGETFRAGDATALOCATIONPROC real_glGetFragDataLocation = NULL;
+static GLint APIENTRY profile_glGetFragDataLocation(GLuint program, const GLchar *name) {
+	GLint glad_result;
+	unsigned long long glad_start = glad_profile_now();
+	glad_result = real_glGetFragDataLocation(program, name);
+	glad_profile_record(591, glad_start);
+	return glad_result;
+}
+static PFNGLUNIFORM1UIPROC real_glUniform1ui = NULL;
+static void APIENTRY profile_glUniform1ui(GLint location, GLuint v0) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glUniform1ui(location, v0);
+	glad_profile_record(592, glad_start);
+}
+static PFNGLUNIFORM2UIPROC real_glUniform2ui = NULL;
+static void APIENTRY profile_glUniform2ui(GLint location, GLuint v0, GLuint v1) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glUniform2ui(location, v0, v1);
+	glad_profile_record(593, glad_start);
+}
+static PFNGLUNIFORM3UIPROC real_glUniform3ui = NULL;
+static void APIENTRY profile_glUniform3ui(GLint location, GLuint v0, GLuint v1, GLuint v2) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glUniform3ui(location, v0, v1, v2);
+	glad_profile_record(594, glad_start);
+}
+static PFNGLUNIFORM4UIPROC real_glUniform4ui = NULL;
+static void APIENTRY profile_glUniform4ui(GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glUniform4ui(location, v0, v1, v2, v3);
+	glad_profile_record(595, glad_start);
+}
+static PFNGLUNIFORM1UIVPROC real_glUniform1uiv = NULL;
+static void APIENTRY profile_glUniform1uiv(GLint location, GLsizei count, const GLuint *value) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glUniform1uiv(location, count, value);
+	glad_profile_record(596, glad_start);
+}
+static PFNGLUNIFORM2UIVPROC real_glUniform2uiv = NULL;
+static void APIENTRY profile_glUniform2uiv(GLint location, GLsizei count, const GLuint *value) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glUniform2uiv(location, count, value);
+	glad_profile_record(597, glad_start);
+}
+static PFNGLUNIFORM3UIVPROC real_glUniform3uiv = NULL;
+static void APIENTRY profile_glUniform3uiv(GLint location, GLsizei count, const GLuint *value) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glUniform3uiv(location, count, value);
+	glad_profile_record(598, glad_start);
+}
+static PFNGLUNIFORM4UIVPROC real_glUniform4uiv = NULL;
+static void APIENTRY profile_glUniform4uiv(GLint location, GLsizei count, const GLuint *value) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glUniform4uiv(location, count, value);
+	glad_profile_record(599, glad_start);
+}
+static PFNGLTEXPARAMETERIIVPROC real_glTexParameterIiv = NULL;
+static void APIENTRY profile_glTexParameterIiv(GLenum target, GLenum pname, const GLint *params) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glTexParameterIiv(target, pname, params);
+	glad_profile_record(600, glad_start);
+}
+static PFNGLTEXPARAMETERIUIVPROC real_glTexParameterIuiv = NULL;
+static void APIENTRY profile_glTexParameterIuiv(GLenum target, GLenum pname, const GLuint *params) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glTexParameterIuiv(target, pname, params);
+	glad_profile_record(601, glad_start);
+}
+static PFNGLGETTEXPARAMETERIIVPROC real_glGetTexParameterIiv = NULL;
+static void APIENTRY profile_glGetTexParameterIiv(GLenum target, GLenum pname, GLint *params) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glGetTexParameterIiv(target, pname, params);
+	glad_profile_record(602, glad_start);
+}
+static PFNGLGETTEXPARAMETERIUIVPROC real_glGetTexParameterIuiv = NULL;
+static void APIENTRY profile_glGetTexParameterIuiv(GLenum target, GLenum pname, GLuint *params) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glGetTexParameterIuiv(target, pname, params);
+	glad_profile_record(603, glad_start);
+}
+static PFNGLCLEARBUFFERIVPROC real_glClearBufferiv = NULL;
+static void APIENTRY profile_glClearBufferiv(GLenum buffer, GLint drawbuffer, const GLint *value) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glClearBufferiv(buffer, drawbuffer, value);
+	glad_profile_record(604, glad_start);
+}
+static PFNGLCLEARBUFFERUIVPROC real_glClearBufferuiv = NULL;
+static void APIENTRY profile_glClearBufferuiv(GLenum buffer, GLint drawbuffer, const GLuint *value) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glClearBufferuiv(buffer, drawbuffer, value);
+	glad_profile_record(605, glad_start);
+}
+static PFNGLCLEARBUFFERFVPROC real_glClearBufferfv = NULL;
+static void APIENTRY profile_glClearBufferfv(GLenum buffer, GLint drawbuffer, const GLfloat *value) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glClearBufferfv(buffer, drawbuffer, value);
+	glad_profile_record(606, glad_start);
+}
+static PFNGLCLEARBUFFERFIPROC real_glClearBufferfi = NULL;
+static void APIENTRY profile_glClearBufferfi(GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glClearBufferfi(buffer, drawbuffer, depth, stencil);
+	glad_profile_record(607, glad_start);
+}
+static PFNGLGETSTRINGIPROC real_glGetStringi = NULL;
+static const GLubyte * APIENTRY profile_glGetStringi(GLenum name, GLuint index) {
+	const GLubyte * glad_result;
+	unsigned long long glad_start = glad_profile_now();
+	glad_result = real_glGetStringi(name, index);
+	glad_profile_record(608, glad_start);
+	return glad_result;
+}
+static PFNGLISRENDERBUFFERPROC real_glIsRenderbuffer = NULL;
+static GLboolean APIENTRY profile_glIsRenderbuffer(GLuint renderbuffer) {
+	GLboolean glad_result;
+	unsigned long long glad_start = glad_profile_now();
+	glad_result = real_glIsRenderbuffer(renderbuffer);
+	glad_profile_record(609, glad_start);
+	return glad_result;
+}
+static PFNGLBINDRENDERBUFFERPROC real_glBindRenderbuffer = NULL;
+static void APIENTRY profile_glBindRenderbuffer(GLenum target, GLuint renderbuffer) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glBindRenderbuffer(target, renderbuffer);
+	glad_profile_record(610, glad_start);
+}
+static PFNGLDELETERENDERBUFFERSPROC real_glDeleteRenderbuffers = NULL;
+static void APIENTRY profile_glDeleteRenderbuffers(GLsizei n, const GLuint *renderbuffers) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glDeleteRenderbuffers(n, renderbuffers);
+	glad_profile_record(611, glad_start);
+}
+static PFNGLGENRENDERBUFFERSPROC real_glGenRenderbuffers = NULL;
+static void APIENTRY profile_glGenRenderbuffers(GLsizei n, GLuint *renderbuffers) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glGenRenderbuffers(n, renderbuffers);
+	glad_profile_record(612, glad_start);
+}
+static PFNGLRENDERBUFFERSTORAGEPROC real_glRenderbufferStorage = NULL;
+static void APIENTRY profile_glRenderbufferStorage(GLenum target, GLenum internalformat, GLsizei width, GLsizei height) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glRenderbufferStorage(target, internalformat, width, height);
+	glad_profile_record(613, glad_start);
+}
+static PFNGLGETRENDERBUFFERPARAMETERIVPROC real_glGetRenderbufferParameteriv = NULL;
+static void APIENTRY profile_glGetRenderbufferParameteriv(GLenum target, GLenum pname, GLint *params) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glGetRenderbufferParameteriv(target, pname, params);
+	glad_profile_record(614, glad_start);
+}
+static PFNGLISFRAMEBUFFERPROC real_glIsFramebuffer = NULL;
+static GLboolean APIENTRY profile_glIsFramebuffer(GLuint framebuffer) {
+	GLboolean glad_result;
+	unsigned long long glad_start = glad_profile_now();
+	glad_result = real_glIsFramebuffer(framebuffer);
+	glad_profile_record(615, glad_start);
+	return glad_result;
+}
+static PFNGLBINDFRAMEBUFFERPROC real_glBindFramebuffer = NULL;
+static void APIENTRY profile_glBindFramebuffer(GLenum target, GLuint framebuffer) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glBindFramebuffer(target, framebuffer);
+	glad_profile_record(616, glad_start);
+}
+static PFNGLDELETEFRAMEBUFFERSPROC real_glDeleteFramebuffers = NULL;
+static void APIENTRY profile_glDeleteFramebuffers(GLsizei n, const GLuint *framebuffers) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glDeleteFramebuffers(n, framebuffers);
+	glad_profile_record(617, glad_start);
+}
+static PFNGLGENFRAMEBUFFERSPROC real_glGenFramebuffers = NULL;
+static void APIENTRY profile_glGenFramebuffers(GLsizei n, GLuint *framebuffers) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glGenFramebuffers(n, framebuffers);
+	glad_profile_record(618, glad_start);
+}
+static PFNGLCHECKFRAMEBUFFERSTATUSPROC real_glCheckFramebufferStatus = NULL;
+static GLenum APIENTRY profile_glCheckFramebufferStatus(GLenum target) {
+	GLenum glad_result;
+	unsigned long long glad_start = glad_profile_now();
+	glad_result = real_glCheckFramebufferStatus(target);
+	glad_profile_record(619, glad_start);
+	return glad_result;
+}
+static PFNGLFRAMEBUFFERTEXTURE1DPROC real_glFramebufferTexture1D = NULL;
+static void APIENTRY profile_glFramebufferTexture1D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glFramebufferTexture1D(target, attachment, textarget, texture, level);
+	glad_profile_record(620, glad_start);
+}
+static PFNGLFRAMEBUFFERTEXTURE2DPROC real_glFramebufferTexture2D = NULL;
+static void APIENTRY profile_glFramebufferTexture2D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glFramebufferTexture2D(target, attachment, textarget, texture, level);
+	glad_profile_record(621, glad_start);
+}
+static PFNGLFRAMEBUFFERTEXTURE3DPROC real_glFramebufferTexture3D = NULL;
+static void APIENTRY profile_glFramebufferTexture3D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLint zoffset) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glFramebufferTexture3D(target, attachment, textarget, texture, level, zoffset);
+	glad_profile_record(622, glad_start);
+}
+static PFNGLFRAMEBUFFERRENDERBUFFERPROC real_glFramebufferRenderbuffer = NULL;
+static void APIENTRY profile_glFramebufferRenderbuffer(GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glFramebufferRenderbuffer(target, attachment, renderbuffertarget, renderbuffer);
+	glad_profile_record(623, glad_start);
+}
+static PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC real_glGetFramebufferAttachmentParameteriv = NULL;
+static void APIENTRY profile_glGetFramebufferAttachmentParameteriv(GLenum target, GLenum attachment, GLenum pname, GLint *params) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glGetFramebufferAttachmentParameteriv(target, attachment, pname, params);
+	glad_profile_record(624, glad_start);
+}
+static PFNGLGENERATEMIPMAPPROC real_glGenerateMipmap = NULL;
+static void APIENTRY profile_glGenerateMipmap(GLenum target) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glGenerateMipmap(target);
+	glad_profile_record(625, glad_start);
+}
+static PFNGLBLITFRAMEBUFFERPROC real_glBlitFramebuffer = NULL;
+static void APIENTRY profile_glBlitFramebuffer(GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glBlitFramebuffer(srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
+	glad_profile_record(626, glad_start);
+}
+static PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC real_glRenderbufferStorageMultisample = NULL;
+static void APIENTRY profile_glRenderbufferStorageMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glRenderbufferStorageMultisample(target, samples, internalformat, width, height);
+	glad_profile_record(627, glad_start);
+}
+static PFNGLFRAMEBUFFERTEXTURELAYERPROC real_glFramebufferTextureLayer = NULL;
+static void APIENTRY profile_glFramebufferTextureLayer(GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glFramebufferTextureLayer(target, attachment, texture, level, layer);
+	glad_profile_record(628, glad_start);
+}
+static PFNGLMAPBUFFERRANGEPROC real_glMapBufferRange = NULL;
+static void * APIENTRY profile_glMapBufferRange(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access) {
+	void * glad_result;
+	unsigned long long glad_start = glad_profile_now();
+	glad_result = real_glMapBufferRange(target, offset, length, access);
+	glad_profile_record(629, glad_start);
+	return glad_result;
+}
+static PFNGLFLUSHMAPPEDBUFFERRANGEPROC real_glFlushMappedBufferRange = NULL;
+static void APIENTRY profile_glFlushMappedBufferRange(GLenum target, GLintptr offset, GLsizeiptr length) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glFlushMappedBufferRange(target, offset, length);
+	glad_profile_record(630, glad_start);
+}
+static PFNGLBINDVERTEXARRAYPROC real_glBindVertexArray = NULL;
+static void APIENTRY profile_glBindVertexArray(GLuint array) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glBindVertexArray(array);
+	glad_profile_record(631, glad_start);
+}
+static PFNGLDELETEVERTEXARRAYSPROC real_glDeleteVertexArrays = NULL;
+static void APIENTRY profile_glDeleteVertexArrays(GLsizei n, const GLuint *arrays) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glDeleteVertexArrays(n, arrays);
+	glad_profile_record(632, glad_start);
+}
+static PFNGLGENVERTEXARRAYSPROC real_glGenVertexArrays = NULL;
+static void APIENTRY profile_glGenVertexArrays(GLsizei n, GLuint *arrays) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glGenVertexArrays(n, arrays);
+	glad_profile_record(633, glad_start);
+}
+static PFNGLISVERTEXARRAYPROC real_glIsVertexArray = NULL;
+static GLboolean APIENTRY profile_glIsVertexArray(GLuint array) {
+	GLboolean glad_result;
+	unsigned long long glad_start = glad_profile_now();
+	glad_result = real_glIsVertexArray(array);
+	glad_profile_record(634, glad_start);
+	return glad_result;
+}
+static PFNGLDRAWARRAYSINSTANCEDPROC real_glDrawArraysInstanced = NULL;
+static void APIENTRY profile_glDrawArraysInstanced(GLenum mode, GLint first, GLsizei count, GLsizei instancecount) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glDrawArraysInstanced(mode, first, count, instancecount);
+	glad_profile_record(635, glad_start);
+}
+static PFNGLDRAWELEMENTSINSTANCEDPROC real_glDrawElementsInstanced = NULL;
+static void APIENTRY profile_glDrawElementsInstanced(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glDrawElementsInstanced(mode, count, type, indices, instancecount);
+	glad_profile_record(636, glad_start);
+}
+static PFNGLTEXBUFFERPROC real_glTexBuffer = NULL;
+static void APIENTRY profile_glTexBuffer(GLenum target, GLenum internalformat, GLuint buffer) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glTexBuffer(target, internalformat, buffer);
+	glad_profile_record(637, glad_start);
+}
+static PFNGLPRIMITIVERESTARTINDEXPROC real_glPrimitiveRestartIndex = NULL;
+static void APIENTRY profile_glPrimitiveRestartIndex(GLuint index) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glPrimitiveRestartIndex(index);
+	glad_profile_record(638, glad_start);
+}
+static PFNGLCOPYBUFFERSUBDATAPROC real_glCopyBufferSubData = NULL;
+static void APIENTRY profile_glCopyBufferSubData(GLenum readTarget, GLenum writeTarget, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glCopyBufferSubData(readTarget, writeTarget, readOffset, writeOffset, size);
+	glad_profile_record(639, glad_start);
+}
+static PFNGLGETUNIFORMINDICESPROC real_glGetUniformIndices = NULL;
+static void APIENTRY profile_glGetUniformIndices(GLuint program, GLsizei uniformCount, const GLchar *const*uniformNames, GLuint *uniformIndices) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glGetUniformIndices(program, uniformCount, uniformNames, uniformIndices);
+	glad_profile_record(640, glad_start);
+}
+static PFNGLGETACTIVEUNIFORMSIVPROC real_glGetActiveUniformsiv = NULL;
+static void APIENTRY profile_glGetActiveUniformsiv(GLuint program, GLsizei uniformCount, const GLuint *uniformIndices, GLenum pname, GLint *params) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glGetActiveUniformsiv(program, uniformCount, uniformIndices, pname, params);
+	glad_profile_record(641, glad_start);
+}
+static PFNGLGETACTIVEUNIFORMNAMEPROC real_glGetActiveUniformName = NULL;
+static void APIENTRY profile_glGetActiveUniformName(GLuint program, GLuint uniformIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformName) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glGetActiveUniformName(program, uniformIndex, bufSize, length, uniformName);
+	glad_profile_record(642, glad_start);
+}
+static PFNGLGETUNIFORMBLOCKINDEXPROC real_glGetUniformBlockIndex = NULL;
+static GLuint APIENTRY profile_glGetUniformBlockIndex(GLuint program, const GLchar *uniformBlockName) {
+	GLuint glad_result;
+	unsigned long long glad_start = glad_profile_now();
+	glad_result = real_glGetUniformBlockIndex(program, uniformBlockName);
+	glad_profile_record(643, glad_start);
+	return glad_result;
+}
+static PFNGLGETACTIVEUNIFORMBLOCKIVPROC real_glGetActiveUniformBlockiv = NULL;
+static void APIENTRY profile_glGetActiveUniformBlockiv(GLuint program, GLuint uniformBlockIndex, GLenum pname, GLint *params) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glGetActiveUniformBlockiv(program, uniformBlockIndex, pname, params);
+	glad_profile_record(644, glad_start);
+}
+static PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC real_glGetActiveUniformBlockName = NULL;
+static void APIENTRY profile_glGetActiveUniformBlockName(GLuint program, GLuint uniformBlockIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformBlockName) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glGetActiveUniformBlockName(program, uniformBlockIndex, bufSize, length, uniformBlockName);
+	glad_profile_record(645, glad_start);
+}
+static PFNGLUNIFORMBLOCKBINDINGPROC real_glUniformBlockBinding = NULL;
+static void APIENTRY profile_glUniformBlockBinding(GLuint program, GLuint uniformBlockIndex, GLuint uniformBlockBinding) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glUniformBlockBinding(program, uniformBlockIndex, uniformBlockBinding);
+	glad_profile_record(646, glad_start);
+}
+static PFNGLDRAWELEMENTSBASEVERTEXPROC real_glDrawElementsBaseVertex = NULL;
+static void APIENTRY profile_glDrawElementsBaseVertex(GLenum mode, GLsizei count, GLenum type, const void *indices, GLint basevertex) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glDrawElementsBaseVertex(mode, count, type, indices, basevertex);
+	glad_profile_record(647, glad_start);
+}
+static PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC real_glDrawRangeElementsBaseVertex = NULL;
+static void APIENTRY profile_glDrawRangeElementsBaseVertex(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices, GLint basevertex) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glDrawRangeElementsBaseVertex(mode, start, end, count, type, indices, basevertex);
+	glad_profile_record(648, glad_start);
+}
+static PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC real_glDrawElementsInstancedBaseVertex = NULL;
+static void APIENTRY profile_glDrawElementsInstancedBaseVertex(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glDrawElementsInstancedBaseVertex(mode, count, type, indices, instancecount, basevertex);
+	glad_profile_record(649, glad_start);
+}
+static PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC real_glMultiDrawElementsBaseVertex = NULL;
+static void APIENTRY profile_glMultiDrawElementsBaseVertex(GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount, const GLint *basevertex) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glMultiDrawElementsBaseVertex(mode, count, type, indices, drawcount, basevertex);
+	glad_profile_record(650, glad_start);
+}
+static PFNGLPROVOKINGVERTEXPROC real_glProvokingVertex = NULL;
+static void APIENTRY profile_glProvokingVertex(GLenum mode) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glProvokingVertex(mode);
+	glad_profile_record(651, glad_start);
+}
+static PFNGLFENCESYNCPROC real_glFenceSync = NULL;
+static GLsync APIENTRY profile_glFenceSync(GLenum condition, GLbitfield flags) {
+	GLsync glad_result;
+	unsigned long long glad_start = glad_profile_now();
+	glad_result = real_glFenceSync(condition, flags);
+	glad_profile_record(652, glad_start);
+	return glad_result;
+}
+static PFNGLISSYNCPROC real_glIsSync = NULL;
+static GLboolean APIENTRY profile_glIsSync(GLsync sync) {
+	GLboolean glad_result;
+	unsigned long long glad_start = glad_profile_now();
+	glad_result = real_glIsSync(sync);
+	glad_profile_record(653, glad_start);
+	return glad_result;
+}
+static PFNGLDELETESYNCPROC real_glDeleteSync = NULL;
+static void APIENTRY profile_glDeleteSync(GLsync sync) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glDeleteSync(sync);
+	glad_profile_record(654, glad_start);
+}
+static PFNGLCLIENTWAITSYNCPROC real_glClientWaitSync = NULL;
+static GLenum APIENTRY profile_glClientWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout) {
+	GLenum glad_result;
+	unsigned long long glad_start = glad_profile_now();
+	glad_result = real_glClientWaitSync(sync, flags, timeout);
+	glad_profile_record(655, glad_start);
+	return glad_result;
+}
+static PFNGLWAITSYNCPROC real_glWaitSync = NULL;
+static void APIENTRY profile_glWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glWaitSync(sync, flags, timeout);
+	glad_profile_record(656, glad_start);
+}
+static PFNGLGETINTEGER64VPROC real_glGetInteger64v = NULL;
+static void APIENTRY profile_glGetInteger64v(GLenum pname, GLint64 *data) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glGetInteger64v(pname, data);
+	glad_profile_record(657, glad_start);
+}
+static PFNGLGETSYNCIVPROC real_glGetSynciv = NULL;
+static void APIENTRY profile_glGetSynciv(GLsync sync, GLenum pname, GLsizei count, GLsizei *length, GLint *values) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glGetSynciv(sync, pname, count, length, values);
+	glad_profile_record(658, glad_start);
+}
+static PFNGLGETINTEGER64I_VPROC real_glGetInteger64i_v = NULL;
+static void APIENTRY profile_glGetInteger64i_v(GLenum target, GLuint index, GLint64 *data) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glGetInteger64i_v(target, index, data);
+	glad_profile_record(659, glad_start);
+}
+static PFNGLGETBUFFERPARAMETERI64VPROC real_glGetBufferParameteri64v = NULL;
+static void APIENTRY profile_glGetBufferParameteri64v(GLenum target, GLenum pname, GLint64 *params) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glGetBufferParameteri64v(target, pname, params);
+	glad_profile_record(660, glad_start);
+}
+static PFNGLFRAMEBUFFERTEXTUREPROC real_glFramebufferTexture = NULL;
+static void APIENTRY profile_glFramebufferTexture(GLenum target, GLenum attachment, GLuint texture, GLint level) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glFramebufferTexture(target, attachment, texture, level);
+	glad_profile_record(661, glad_start);
+}
+static PFNGLTEXIMAGE2DMULTISAMPLEPROC real_glTexImage2DMultisample = NULL;
+static void APIENTRY profile_glTexImage2DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glTexImage2DMultisample(target, samples, internalformat, width, height, fixedsamplelocations);
+	glad_profile_record(662, glad_start);
+}
+static PFNGLTEXIMAGE3DMULTISAMPLEPROC real_glTexImage3DMultisample = NULL;
+static void APIENTRY profile_glTexImage3DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glTexImage3DMultisample(target, samples, internalformat, width, height, depth, fixedsamplelocations);
+	glad_profile_record(663, glad_start);
+}
+static PFNGLGETMULTISAMPLEFVPROC real_glGetMultisamplefv = NULL;
+static void APIENTRY profile_glGetMultisamplefv(GLenum pname, GLuint index, GLfloat *val) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glGetMultisamplefv(pname, index, val);
+	glad_profile_record(664, glad_start);
+}
+static PFNGLSAMPLEMASKIPROC real_glSampleMaski = NULL;
+static void APIENTRY profile_glSampleMaski(GLuint maskNumber, GLbitfield mask) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glSampleMaski(maskNumber, mask);
+	glad_profile_record(665, glad_start);
+}
+static PFNGLBINDFRAGDATALOCATIONINDEXEDPROC real_glBindFragDataLocationIndexed = NULL;
+static void APIENTRY profile_glBindFragDataLocationIndexed(GLuint program, GLuint colorNumber, GLuint index, const GLchar *name) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glBindFragDataLocationIndexed(program, colorNumber, index, name);
+	glad_profile_record(666, glad_start);
+}
+static PFNGLGETFRAGDATAINDEXPROC real_glGetFragDataIndex = NULL;
+static GLint APIENTRY profile_glGetFragDataIndex(GLuint program, const GLchar *name) {
+	GLint glad_result;
+	unsigned long long glad_start = glad_profile_now();
+	glad_result = real_glGetFragDataIndex(program, name);
+	glad_profile_record(667, glad_start);
+	return glad_result;
+}
+static PFNGLGENSAMPLERSPROC real_glGenSamplers = NULL;
+static void APIENTRY profile_glGenSamplers(GLsizei count, GLuint *samplers) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glGenSamplers(count, samplers);
+	glad_profile_record(668, glad_start);
+}
+static PFNGLDELETESAMPLERSPROC real_glDeleteSamplers = NULL;
+static void APIENTRY profile_glDeleteSamplers(GLsizei count, const GLuint *samplers) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glDeleteSamplers(count, samplers);
+	glad_profile_record(669, glad_start);
+}
+static PFNGLISSAMPLERPROC real_glIsSampler = NULL;
+static GLboolean APIENTRY profile_glIsSampler(GLuint sampler) {
+	GLboolean glad_result;
+	unsigned long long glad_start = glad_profile_now();
+	glad_result = real_glIsSampler(sampler);
+	glad_profile_record(670, glad_start);
+	return glad_result;
+}
+static PFNGLBINDSAMPLERPROC real_glBindSampler = NULL;
+static void APIENTRY profile_glBindSampler(GLuint unit, GLuint sampler) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glBindSampler(unit, sampler);
+	glad_profile_record(671, glad_start);
+}
+static PFNGLSAMPLERPARAMETERIPROC real_glSamplerParameteri = NULL;
+static void APIENTRY profile_glSamplerParameteri(GLuint sampler, GLenum pname, GLint param) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glSamplerParameteri(sampler, pname, param);
+	glad_profile_record(672, glad_start);
+}
+static PFNGLSAMPLERPARAMETERIVPROC real_glSamplerParameteriv = NULL;
+static void APIENTRY profile_glSamplerParameteriv(GLuint sampler, GLenum pname, const GLint *param) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glSamplerParameteriv(sampler, pname, param);
+	glad_profile_record(673, glad_start);
+}
+static PFNGLSAMPLERPARAMETERFPROC real_glSamplerParameterf = NULL;
+static void APIENTRY profile_glSamplerParameterf(GLuint sampler, GLenum pname, GLfloat param) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glSamplerParameterf(sampler, pname, param);
+	glad_profile_record(674, glad_start);
+}
+static PFNGLSAMPLERPARAMETERFVPROC real_glSamplerParameterfv = NULL;
+static void APIENTRY profile_glSamplerParameterfv(GLuint sampler, GLenum pname, const GLfloat *param) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glSamplerParameterfv(sampler, pname, param);
+	glad_profile_record(675, glad_start);
+}
+static PFNGLSAMPLERPARAMETERIIVPROC real_glSamplerParameterIiv = NULL;
+static void APIENTRY profile_glSamplerParameterIiv(GLuint sampler, GLenum pname, const GLint *param) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glSamplerParameterIiv(sampler, pname, param);
+	glad_profile_record(676, glad_start);
+}
+static PFNGLSAMPLERPARAMETERIUIVPROC real_glSamplerParameterIuiv = NULL;
+static void APIENTRY profile_glSamplerParameterIuiv(GLuint sampler, GLenum pname, const GLuint *param) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glSamplerParameterIuiv(sampler, pname, param);
+	glad_profile_record(677, glad_start);
+}
+static PFNGLGETSAMPLERPARAMETERIVPROC real_glGetSamplerParameteriv = NULL;
+static void APIENTRY profile_glGetSamplerParameteriv(GLuint sampler, GLenum pname, GLint *params) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glGetSamplerParameteriv(sampler, pname, params);
+	glad_profile_record(678, glad_start);
+}
+static PFNGLGETSAMPLERPARAMETERIIVPROC real_glGetSamplerParameterIiv = NULL;
+static void APIENTRY profile_glGetSamplerParameterIiv(GLuint sampler, GLenum pname, GLint *params) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glGetSamplerParameterIiv(sampler, pname, params);
+	glad_profile_record(679, glad_start);
+}
+static PFNGLGETSAMPLERPARAMETERFVPROC real_glGetSamplerParameterfv = NULL;
+static void APIENTRY profile_glGetSamplerParameterfv(GLuint sampler, GLenum pname, GLfloat *params) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glGetSamplerParameterfv(sampler, pname, params);
+	glad_profile_record(680, glad_start);
+}
+static PFNGLGETSAMPLERPARAMETERIUIVPROC real_glGetSamplerParameterIuiv = NULL;
+static void APIENTRY profile_glGetSamplerParameterIuiv(GLuint sampler, GLenum pname, GLuint *params) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glGetSamplerParameterIuiv(sampler, pname, params);
+	glad_profile_record(681, glad_start);
+}
+static PFNGLQUERYCOUNTERPROC real_glQueryCounter = NULL;
+static void APIENTRY profile_glQueryCounter(GLuint id, GLenum target) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glQueryCounter(id, target);
+	glad_profile_record(682, glad_start);
+}
+static PFNGLGETQUERYOBJECTI64VPROC real_glGetQueryObjecti64v = NULL;
+static void APIENTRY profile_glGetQueryObjecti64v(GLuint id, GLenum pname, GLint64 *params) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glGetQueryObjecti64v(id, pname, params);
+	glad_profile_record(683, glad_start);
+}
+static PFNGLGETQUERYOBJECTUI64VPROC real_glGetQueryObjectui64v = NULL;
+static void APIENTRY profile_glGetQueryObjectui64v(GLuint id, GLenum pname, GLuint64 *params) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glGetQueryObjectui64v(id, pname, params);
+	glad_profile_record(684, glad_start);
+}
+static PFNGLVERTEXATTRIBDIVISORPROC real_glVertexAttribDivisor = NULL;
+static void APIENTRY profile_glVertexAttribDivisor(GLuint index, GLuint divisor) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glVertexAttribDivisor(index, divisor);
+	glad_profile_record(685, glad_start);
+}
+static PFNGLVERTEXATTRIBP1UIPROC real_glVertexAttribP1ui = NULL;
+static void APIENTRY profile_glVertexAttribP1ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glVertexAttribP1ui(index, type, normalized, value);
+	glad_profile_record(686, glad_start);
+}
+static PFNGLVERTEXATTRIBP1UIVPROC real_glVertexAttribP1uiv = NULL;
+static void APIENTRY profile_glVertexAttribP1uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glVertexAttribP1uiv(index, type, normalized, value);
+	glad_profile_record(687, glad_start);
+}
+static PFNGLVERTEXATTRIBP2UIPROC real_glVertexAttribP2ui = NULL;
+static void APIENTRY profile_glVertexAttribP2ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glVertexAttribP2ui(index, type, normalized, value);
+	glad_profile_record(688, glad_start);
+}
+static PFNGLVERTEXATTRIBP2UIVPROC real_glVertexAttribP2uiv = NULL;
+static void APIENTRY profile_glVertexAttribP2uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glVertexAttribP2uiv(index, type, normalized, value);
+	glad_profile_record(689, glad_start);
+}
+static PFNGLVERTEXATTRIBP3UIPROC real_glVertexAttribP3ui = NULL;
+static void APIENTRY profile_glVertexAttribP3ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glVertexAttribP3ui(index, type, normalized, value);
+	glad_profile_record(690, glad_start);
+}
+static PFNGLVERTEXATTRIBP3UIVPROC real_glVertexAttribP3uiv = NULL;
+static void APIENTRY profile_glVertexAttribP3uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glVertexAttribP3uiv(index, type, normalized, value);
+	glad_profile_record(691, glad_start);
+}
+static PFNGLVERTEXATTRIBP4UIPROC real_glVertexAttribP4ui = NULL;
+static void APIENTRY profile_glVertexAttribP4ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glVertexAttribP4ui(index, type, normalized, value);
+	glad_profile_record(692, glad_start);
+}
+static PFNGLVERTEXATTRIBP4UIVPROC real_glVertexAttribP4uiv = NULL;
+static void APIENTRY profile_glVertexAttribP4uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glVertexAttribP4uiv(index, type, normalized, value);
+	glad_profile_record(693, glad_start);
+}
+static PFNGLVERTEXP2UIPROC real_glVertexP2ui = NULL;
+static void APIENTRY profile_glVertexP2ui(GLenum type, GLuint value) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glVertexP2ui(type, value);
+	glad_profile_record(694, glad_start);
+}
+static PFNGLVERTEXP2UIVPROC real_glVertexP2uiv = NULL;
+static void APIENTRY profile_glVertexP2uiv(GLenum type, const GLuint *value) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glVertexP2uiv(type, value);
+	glad_profile_record(695, glad_start);
+}
+static PFNGLVERTEXP3UIPROC real_glVertexP3ui = NULL;
+static void APIENTRY profile_glVertexP3ui(GLenum type, GLuint value) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glVertexP3ui(type, value);
+	glad_profile_record(696, glad_start);
+}
+static PFNGLVERTEXP3UIVPROC real_glVertexP3uiv = NULL;
+static void APIENTRY profile_glVertexP3uiv(GLenum type, const GLuint *value) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glVertexP3uiv(type, value);
+	glad_profile_record(697, glad_start);
+}
+static PFNGLVERTEXP4UIPROC real_glVertexP4ui = NULL;
+static void APIENTRY profile_glVertexP4ui(GLenum type, GLuint value) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glVertexP4ui(type, value);
+	glad_profile_record(698, glad_start);
+}
+static PFNGLVERTEXP4UIVPROC real_glVertexP4uiv = NULL;
+static void APIENTRY profile_glVertexP4uiv(GLenum type, const GLuint *value) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glVertexP4uiv(type, value);
+	glad_profile_record(699, glad_start);
+}
+static PFNGLTEXCOORDP1UIPROC real_glTexCoordP1ui = NULL;
+static void APIENTRY profile_glTexCoordP1ui(GLenum type, GLuint coords) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glTexCoordP1ui(type, coords);
+	glad_profile_record(700, glad_start);
+}
+static PFNGLTEXCOORDP1UIVPROC real_glTexCoordP1uiv = NULL;
+static void APIENTRY profile_glTexCoordP1uiv(GLenum type, const GLuint *coords) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glTexCoordP1uiv(type, coords);
+	glad_profile_record(701, glad_start);
+}
+static PFNGLTEXCOORDP2UIPROC real_glTexCoordP2ui = NULL;
+static void APIENTRY profile_glTexCoordP2ui(GLenum type, GLuint coords) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glTexCoordP2ui(type, coords);
+	glad_profile_record(702, glad_start);
+}
+static PFNGLTEXCOORDP2UIVPROC real_glTexCoordP2uiv = NULL;
+static void APIENTRY profile_glTexCoordP2uiv(GLenum type, const GLuint *coords) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glTexCoordP2uiv(type, coords);
+	glad_profile_record(703, glad_start);
+}
+static PFNGLTEXCOORDP3UIPROC real_glTexCoordP3ui = NULL;
+static void APIENTRY profile_glTexCoordP3ui(GLenum type, GLuint coords) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glTexCoordP3ui(type, coords);
+	glad_profile_record(704, glad_start);
+}
+static PFNGLTEXCOORDP3UIVPROC real_glTexCoordP3uiv = NULL;
+static void APIENTRY profile_glTexCoordP3uiv(GLenum type, const GLuint *coords) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glTexCoordP3uiv(type, coords);
+	glad_profile_record(705, glad_start);
+}
+static PFNGLTEXCOORDP4UIPROC real_glTexCoordP4ui = NULL;
+static void APIENTRY profile_glTexCoordP4ui(GLenum type, GLuint coords) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glTexCoordP4ui(type, coords);
+	glad_profile_record(706, glad_start);
+}
+static PFNGLTEXCOORDP4UIVPROC real_glTexCoordP4uiv = NULL;
+static void APIENTRY profile_glTexCoordP4uiv(GLenum type, const GLuint *coords) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glTexCoordP4uiv(type, coords);
+	glad_profile_record(707, glad_start);
+}
+static PFNGLMULTITEXCOORDP1UIPROC real_glMultiTexCoordP1ui = NULL;
+static void APIENTRY profile_glMultiTexCoordP1ui(GLenum texture, GLenum type, GLuint coords) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glMultiTexCoordP1ui(texture, type, coords);
+	glad_profile_record(708, glad_start);
+}
+static PFNGLMULTITEXCOORDP1UIVPROC real_glMultiTexCoordP1uiv = NULL;
+static void APIENTRY profile_glMultiTexCoordP1uiv(GLenum texture, GLenum type, const GLuint *coords) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glMultiTexCoordP1uiv(texture, type, coords);
+	glad_profile_record(709, glad_start);
+}
+static PFNGLMULTITEXCOORDP2UIPROC real_glMultiTexCoordP2ui = NULL;
+static void APIENTRY profile_glMultiTexCoordP2ui(GLenum texture, GLenum type, GLuint coords) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glMultiTexCoordP2ui(texture, type, coords);
+	glad_profile_record(710, glad_start);
+}
+static PFNGLMULTITEXCOORDP2UIVPROC real_glMultiTexCoordP2uiv = NULL;
+static void APIENTRY profile_glMultiTexCoordP2uiv(GLenum texture, GLenum type, const GLuint *coords) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glMultiTexCoordP2uiv(texture, type, coords);
+	glad_profile_record(711, glad_start);
+}
+static PFNGLMULTITEXCOORDP3UIPROC real_glMultiTexCoordP3ui = NULL;
+static void APIENTRY profile_glMultiTexCoordP3ui(GLenum texture, GLenum type, GLuint coords) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glMultiTexCoordP3ui(texture, type, coords);
+	glad_profile_record(712, glad_start);
+}
+static PFNGLMULTITEXCOORDP3UIVPROC real_glMultiTexCoordP3uiv = NULL;
+static void APIENTRY profile_glMultiTexCoordP3uiv(GLenum texture, GLenum type, const GLuint *coords) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glMultiTexCoordP3uiv(texture, type, coords);
+	glad_profile_record(713, glad_start);
+}
+static PFNGLMULTITEXCOORDP4UIPROC real_glMultiTexCoordP4ui = NULL;
+static void APIENTRY profile_glMultiTexCoordP4ui(GLenum texture, GLenum type, GLuint coords) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glMultiTexCoordP4ui(texture, type, coords);
+	glad_profile_record(714, glad_start);
+}
+static PFNGLMULTITEXCOORDP4UIVPROC real_glMultiTexCoordP4uiv = NULL;
+static void APIENTRY profile_glMultiTexCoordP4uiv(GLenum texture, GLenum type, const GLuint *coords) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glMultiTexCoordP4uiv(texture, type, coords);
+	glad_profile_record(715, glad_start);
+}
+static PFNGLNORMALP3UIPROC real_glNormalP3ui = NULL;
+static void APIENTRY profile_glNormalP3ui(GLenum type, GLuint coords) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glNormalP3ui(type, coords);
+	glad_profile_record(716, glad_start);
+}
+static PFNGLNORMALP3UIVPROC real_glNormalP3uiv = NULL;
+static void APIENTRY profile_glNormalP3uiv(GLenum type, const GLuint *coords) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glNormalP3uiv(type, coords);
+	glad_profile_record(717, glad_start);
+}
+static PFNGLCOLORP3UIPROC real_glColorP3ui = NULL;
+static void APIENTRY profile_glColorP3ui(GLenum type, GLuint color) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glColorP3ui(type, color);
+	glad_profile_record(718, glad_start);
+}
+static PFNGLCOLORP3UIVPROC real_glColorP3uiv = NULL;
+static void APIENTRY profile_glColorP3uiv(GLenum type, const GLuint *color) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glColorP3uiv(type, color);
+	glad_profile_record(719, glad_start);
+}
+static PFNGLCOLORP4UIPROC real_glColorP4ui = NULL;
+static void APIENTRY profile_glColorP4ui(GLenum type, GLuint color) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glColorP4ui(type, color);
+	glad_profile_record(720, glad_start);
+}
+static PFNGLCOLORP4UIVPROC real_glColorP4uiv = NULL;
+static void APIENTRY profile_glColorP4uiv(GLenum type, const GLuint *color) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glColorP4uiv(type, color);
+	glad_profile_record(721, glad_start);
+}
+static PFNGLSECONDARYCOLORP3UIPROC real_glSecondaryColorP3ui = NULL;
+static void APIENTRY profile_glSecondaryColorP3ui(GLenum type, GLuint color) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glSecondaryColorP3ui(type, color);
+	glad_profile_record(722, glad_start);
+}
+static PFNGLSECONDARYCOLORP3UIVPROC real_glSecondaryColorP3uiv = NULL;
+static void APIENTRY profile_glSecondaryColorP3uiv(GLenum type, const GLuint *color) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glSecondaryColorP3uiv(type, color);
+	glad_profile_record(723, glad_start);
+}
+static PFNGLBUFFERSTORAGEPROC real_glBufferStorage = NULL;
+static void APIENTRY profile_glBufferStorage(GLenum target, GLsizeiptr size, const void *data, GLbitfield flags) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glBufferStorage(target, size, data, flags);
+	glad_profile_record(724, glad_start);
+}
+static PFNGLDEBUGMESSAGECONTROLARBPROC real_glDebugMessageControlARB = NULL;
+static void APIENTRY profile_glDebugMessageControlARB(GLenum source, GLenum type, GLenum severity, GLsizei count, const GLuint *ids, GLboolean enabled) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glDebugMessageControlARB(source, type, severity, count, ids, enabled);
+	glad_profile_record(725, glad_start);
+}
+static PFNGLDEBUGMESSAGEINSERTARBPROC real_glDebugMessageInsertARB = NULL;
+static void APIENTRY profile_glDebugMessageInsertARB(GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar *buf) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glDebugMessageInsertARB(source, type, id, severity, length, buf);
+	glad_profile_record(726, glad_start);
+}
+static PFNGLDEBUGMESSAGECALLBACKARBPROC real_glDebugMessageCallbackARB = NULL;
+static void APIENTRY profile_glDebugMessageCallbackARB(GLDEBUGPROCARB callback, const void *userParam) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glDebugMessageCallbackARB(callback, userParam);
+	glad_profile_record(727, glad_start);
+}
+static PFNGLGETDEBUGMESSAGELOGARBPROC real_glGetDebugMessageLogARB = NULL;
+static GLuint APIENTRY profile_glGetDebugMessageLogARB(GLuint count, GLsizei bufSize, GLenum *sources, GLenum *types, GLuint *ids, GLenum *severities, GLsizei *lengths, GLchar *messageLog) {
+	GLuint glad_result;
+	unsigned long long glad_start = glad_profile_now();
+	glad_result = real_glGetDebugMessageLogARB(count, bufSize, sources, types, ids, severities, lengths, messageLog);
+	glad_profile_record(728, glad_start);
+	return glad_result;
+}
+static PFNGLGETPROGRAMBINARYPROC real_glGetProgramBinary = NULL;
+static void APIENTRY profile_glGetProgramBinary(GLuint program, GLsizei bufSize, GLsizei *length, GLenum *binaryFormat, void *binary) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glGetProgramBinary(program, bufSize, length, binaryFormat, binary);
+	glad_profile_record(729, glad_start);
+}
+static PFNGLPROGRAMBINARYPROC real_glProgramBinary = NULL;
+static void APIENTRY profile_glProgramBinary(GLuint program, GLenum binaryFormat, const void *binary, GLsizei length) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glProgramBinary(program, binaryFormat, binary, length);
+	glad_profile_record(730, glad_start);
+}
+static PFNGLPROGRAMPARAMETERIPROC real_glProgramParameteri = NULL;
+static void APIENTRY profile_glProgramParameteri(GLuint program, GLenum pname, GLint value) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glProgramParameteri(program, pname, value);
+	glad_profile_record(731, glad_start);
+}
+static PFNGLMAXSHADERCOMPILERTHREADSARBPROC real_glMaxShaderCompilerThreadsARB = NULL;
+static void APIENTRY profile_glMaxShaderCompilerThreadsARB(GLuint count) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glMaxShaderCompilerThreadsARB(count);
+	glad_profile_record(732, glad_start);
+}
+static PFNGLDEBUGMESSAGECONTROLPROC real_glDebugMessageControl = NULL;
+static void APIENTRY profile_glDebugMessageControl(GLenum source, GLenum type, GLenum severity, GLsizei count, const GLuint *ids, GLboolean enabled) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glDebugMessageControl(source, type, severity, count, ids, enabled);
+	glad_profile_record(733, glad_start);
+}
+static PFNGLDEBUGMESSAGEINSERTPROC real_glDebugMessageInsert = NULL;
+static void APIENTRY profile_glDebugMessageInsert(GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar *buf) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glDebugMessageInsert(source, type, id, severity, length, buf);
+	glad_profile_record(734, glad_start);
+}
+static PFNGLDEBUGMESSAGECALLBACKPROC real_glDebugMessageCallback = NULL;
+static void APIENTRY profile_glDebugMessageCallback(GLDEBUGPROC callback, const void *userParam) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glDebugMessageCallback(callback, userParam);
+	glad_profile_record(735, glad_start);
+}
+static PFNGLGETDEBUGMESSAGELOGPROC real_glGetDebugMessageLog = NULL;
+static GLuint APIENTRY profile_glGetDebugMessageLog(GLuint count, GLsizei bufSize, GLenum *sources, GLenum *types, GLuint *ids, GLenum *severities, GLsizei *lengths, GLchar *messageLog) {
+	GLuint glad_result;
+	unsigned long long glad_start = glad_profile_now();
+	glad_result = real_glGetDebugMessageLog(count, bufSize, sources, types, ids, severities, lengths, messageLog);
+	glad_profile_record(736, glad_start);
+	return glad_result;
+}
+static PFNGLPUSHDEBUGGROUPPROC real_glPushDebugGroup = NULL;
+static void APIENTRY profile_glPushDebugGroup(GLenum source, GLuint id, GLsizei length, const GLchar *message) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glPushDebugGroup(source, id, length, message);
+	glad_profile_record(737, glad_start);
+}
+static PFNGLPOPDEBUGGROUPPROC real_glPopDebugGroup = NULL;
+static void APIENTRY profile_glPopDebugGroup(void) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glPopDebugGroup();
+	glad_profile_record(738, glad_start);
+}
+static PFNGLOBJECTLABELPROC real_glObjectLabel = NULL;
+static void APIENTRY profile_glObjectLabel(GLenum identifier, GLuint name, GLsizei length, const GLchar *label) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glObjectLabel(identifier, name, length, label);
+	glad_profile_record(739, glad_start);
+}
+static PFNGLGETOBJECTLABELPROC real_glGetObjectLabel = NULL;
+static void APIENTRY profile_glGetObjectLabel(GLenum identifier, GLuint name, GLsizei bufSize, GLsizei *length, GLchar *label) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glGetObjectLabel(identifier, name, bufSize, length, label);
+	glad_profile_record(740, glad_start);
+}
+static PFNGLOBJECTPTRLABELPROC real_glObjectPtrLabel = NULL;
+static void APIENTRY profile_glObjectPtrLabel(const void *ptr, GLsizei length, const GLchar *label) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glObjectPtrLabel(ptr, length, label);
+	glad_profile_record(741, glad_start);
+}
+static PFNGLGETOBJECTPTRLABELPROC real_glGetObjectPtrLabel = NULL;
+static void APIENTRY profile_glGetObjectPtrLabel(const void *ptr, GLsizei bufSize, GLsizei *length, GLchar *label) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glGetObjectPtrLabel(ptr, bufSize, length, label);
+	glad_profile_record(742, glad_start);
+}
+static PFNGLMAXSHADERCOMPILERTHREADSKHRPROC real_glMaxShaderCompilerThreadsKHR = NULL;
+static void APIENTRY profile_glMaxShaderCompilerThreadsKHR(GLuint count) {
+	unsigned long long glad_start = glad_profile_now();
+	real_glMaxShaderCompilerThreadsKHR(count);
+	glad_profile_record(743, glad_start);
+}
+
+int gladProfileEnable(void) {
+	if(profile_enabled) return 1;
+	real_glCullFace = glad_glCullFace;
+	if(real_glCullFace != NULL) glad_glCullFace = profile_glCullFace;
+	real_glFrontFace = glad_glFrontFace;
+	if(real_glFrontFace != NULL) glad_glFrontFace = profile_glFrontFace;
+	real_glHint = glad_glHint;
+	if(real_glHint != NULL) glad_glHint = profile_glHint;
+	real_glLineWidth = glad_glLineWidth;
+	if(real_glLineWidth != NULL) glad_glLineWidth = profile_glLineWidth;
+	real_glPointSize = glad_glPointSize;
+	if(real_glPointSize != NULL) glad_glPointSize = profile_glPointSize;
+	real_glPolygonMode = glad_glPolygonMode;
+	if(real_glPolygonMode != NULL) glad_glPolygonMode = profile_glPolygonMode;
+	real_glScissor = glad_glScissor;
+	if(real_glScissor != NULL) glad_glScissor = profile_glScissor;
+	real_glTexParameterf = glad_glTexParameterf;
+	if(real_glTexParameterf != NULL) glad_glTexParameterf = profile_glTexParameterf;
+	real_glTexParameterfv = glad_glTexParameterfv;
+	if(real_glTexParameterfv != NULL) glad_glTexParameterfv = profile_glTexParameterfv;
+	real_glTexParameteri = glad_glTexParameteri;
+	if(real_glTexParameteri != NULL) glad_glTexParameteri = profile_glTexParameteri;
+	real_glTexParameteriv = glad_glTexParameteriv;
+	if(real_glTexParameteriv != NULL) glad_glTexParameteriv = profile_glTexParameteriv;
+	real_glTexImage1D = glad_glTexImage1D;
+	if(real_glTexImage1D != NULL) glad_glTexImage1D = profile_glTexImage1D;
+	real_glTexImage2D = glad_glTexImage2D;
+	if(real_glTexImage2D != NULL) glad_glTexImage2D = profile_glTexImage2D;
+	real_glDrawBuffer = glad_glDrawBuffer;
+	if(real_glDrawBuffer != NULL) glad_glDrawBuffer = profile_glDrawBuffer;
+	real_glClear = glad_glClear;
+	if(real_glClear != NULL) glad_glClear = profile_glClear;
+	real_glClearColor = glad_glClearColor;
+	if(real_glClearColor != NULL) glad_glClearColor = profile_glClearColor;
+	real_glClearStencil = glad_glClearStencil;
+	if(real_glClearStencil != NULL) glad_glClearStencil = profile_glClearStencil;
+	real_glClearDepth = glad_glClearDepth;
+	if(real_glClearDepth != NULL) glad_glClearDepth = profile_glClearDepth;
+	real_glStencilMask = glad_glStencilMask;
+	if(real_glStencilMask != NULL) glad_glStencilMask = profile_glStencilMask;
+	real_glColorMask = glad_glColorMask;
+	if(real_glColorMask != NULL) glad_glColorMask = profile_glColorMask;
+	real_glDepthMask = glad_glDepthMask;
+	if(real_glDepthMask != NULL) glad_glDepthMask = profile_glDepthMask;
+	real_glDisable = glad_glDisable;
+	if(real_glDisable != NULL) glad_glDisable = profile_glDisable;
+	real_glEnable = glad_glEnable;
+	if(real_glEnable != NULL) glad_glEnable = profile_glEnable;
+	real_glFinish = glad_glFinish;
+	if(real_glFinish != NULL) glad_glFinish = profile_glFinish;
+	real_glFlush = glad_glFlush;
+	if(real_glFlush != NULL) glad_glFlush = profile_glFlush;
+	real_glBlendFunc = glad_glBlendFunc;
+	if(real_glBlendFunc != NULL) glad_glBlendFunc = profile_glBlendFunc;
+	real_glLogicOp = glad_glLogicOp;
+	if(real_glLogicOp != NULL) glad_glLogicOp = profile_glLogicOp;
+	real_glStencilFunc = glad_glStencilFunc;
+	if(real_glStencilFunc != NULL) glad_glStencilFunc = profile_glStencilFunc;
+	real_glStencilOp = glad_glStencilOp;
+	if(real_glStencilOp != NULL) glad_glStencilOp = profile_glStencilOp;
+	real_glDepthFunc = glad_glDepthFunc;
+	if(real_glDepthFunc != NULL) glad_glDepthFunc = profile_glDepthFunc;
+	real_glPixelStoref = glad_glPixelStoref;
+	if(real_glPixelStoref != NULL) glad_glPixelStoref = profile_glPixelStoref;
+	real_glPixelStorei = glad_glPixelStorei;
+	if(real_glPixelStorei != NULL) glad_glPixelStorei = profile_glPixelStorei;
+	real_glReadBuffer = glad_glReadBuffer;
+	if(real_glReadBuffer != NULL) glad_glReadBuffer = profile_glReadBuffer;
+	real_glReadPixels = glad_glReadPixels;
+	if(real_glReadPixels != NULL) glad_glReadPixels = profile_glReadPixels;
+	real_glGetBooleanv = glad_glGetBooleanv;
+	if(real_glGetBooleanv != NULL) glad_glGetBooleanv = profile_glGetBooleanv;
+	real_glGetDoublev = glad_glGetDoublev;
+	if(real_glGetDoublev != NULL) glad_glGetDoublev = profile_glGetDoublev;
+	real_glGetError = glad_glGetError;
+	if(real_glGetError != NULL) glad_glGetError = profile_glGetError;
+	real_glGetFloatv = glad_glGetFloatv;
+	if(real_glGetFloatv != NULL) glad_glGetFloatv = profile_glGetFloatv;
+	real_glGetIntegerv = glad_glGetIntegerv;
+	if(real_glGetIntegerv != NULL) glad_glGetIntegerv = profile_glGetIntegerv;
+	real_glGetString = glad_glGetString;
+	if(real_glGetString != NULL) glad_glGetString = profile_glGetString;
+	real_glGetTexImage = glad_glGetTexImage;
+	if(real_glGetTexImage != NULL) glad_glGetTexImage = profile_glGetTexImage;
+	real_glGetTexParameterfv = glad_glGetTexParameterfv;
+	if(real_glGetTexParameterfv != NULL) glad_glGetTexParameterfv = profile_glGetTexParameterfv;
+	real_glGetTexParameteriv = glad_glGetTexParameteriv;
+	if(real_glGetTexParameteriv != NULL) glad_glGetTexParameteriv = profile_glGetTexParameteriv;
+	real_glGetTexLevelParameterfv = glad_glGetTexLevelParameterfv;
+	if(real_glGetTexLevelParameterfv != NULL) glad_glGetTexLevelParameterfv = profile_glGetTexLevelParameterfv;
+	real_glGetTexLevelParameteriv = glad_glGetTexLevelParameteriv;
+	if(real_glGetTexLevelParameteriv != NULL) glad_glGetTexLevelParameteriv = profile_glGetTexLevelParameteriv;
+	real_glIsEnabled = glad_glIsEnabled;
+	if(real_glIsEnabled != NULL) glad_glIsEnabled = profile_glIsEnabled;
+	real_glDepthRange = glad_glDepthRange;
+	if(real_glDepthRange != NULL) glad_glDepthRange = profile_glDepthRange;
+	real_glViewport = glad_glViewport;
+	if(real_glViewport != NULL) glad_glViewport = profile_glViewport;
+	real_glNewList = glad_glNewList;
+	if(real_glNewList != NULL) glad_glNewList = profile_glNewList;
+	real_glEndList = glad_glEndList;
+	if(real_glEndList != NULL) glad_glEndList = profile_glEndList;
+	real_glCallList = glad_glCallList;
+	if(real_glCallList != NULL) glad_glCallList = profile_glCallList;
+	real_glCallLists = glad_glCallLists;
+	if(real_glCallLists != NULL) glad_glCallLists = profile_glCallLists;
+	real_glDeleteLists = glad_glDeleteLists;
+	if(real_glDeleteLists != NULL) glad_glDeleteLists = profile_glDeleteLists;
+	real_glGenLists = glad_glGenLists;
+	if(real_glGenLists != NULL) glad_glGenLists = profile_glGenLists;
+	real_glListBase = glad_glListBase;
+	if(real_glListBase != NULL) glad_glListBase = profile_glListBase;
+	real_glBegin = glad_glBegin;
+	if(real_glBegin != NULL) glad_glBegin = profile_glBegin;
+	real_glBitmap = glad_glBitmap;
+	if(real_glBitmap != NULL) glad_glBitmap = profile_glBitmap;
+	real_glColor3b = glad_glColor3b;
+	if(real_glColor3b != NULL) glad_glColor3b = profile_glColor3b;
+	real_glColor3bv = glad_glColor3bv;
+	if(real_glColor3bv != NULL) glad_glColor3bv = profile_glColor3bv;
+	real_glColor3d = glad_glColor3d;
+	if(real_glColor3d != NULL) glad_glColor3d = profile_glColor3d;
+	real_glColor3dv = glad_glColor3dv;
+	if(real_glColor3dv != NULL) glad_glColor3dv = profile_glColor3dv;
+	real_glColor3f = glad_glColor3f;
+	if(real_glColor3f != NULL) glad_glColor3f = profile_glColor3f;
+	real_glColor3fv = glad_glColor3fv;
+	if(real_glColor3fv != NULL) glad_glColor3fv = profile_glColor3fv;
+	real_glColor3i = glad_glColor3i;
+	if(real_glColor3i != NULL) glad_glColor3i = profile_glColor3i;
+	real_glColor3iv = glad_glColor3iv;
+	if(real_glColor3iv != NULL) glad_glColor3iv = profile_glColor3iv;
+	real_glColor3s = glad_glColor3s;
+	if(real_glColor3s != NULL) glad_glColor3s = profile_glColor3s;
+	real_glColor3sv = glad_glColor3sv;
+	if(real_glColor3sv != NULL) glad_glColor3sv = profile_glColor3sv;
+	real_glColor3ub = glad_glColor3ub;
+	if(real_glColor3ub != NULL) glad_glColor3ub = profile_glColor3ub;
+	real_glColor3ubv = glad_glColor3ubv;
+	if(real_glColor3ubv != NULL) glad_glColor3ubv = profile_glColor3ubv;
+	real_glColor3ui = glad_glColor3ui;
+	if(real_glColor3ui != NULL) glad_glColor3ui = profile_glColor3ui;
+	real_glColor3uiv = glad_glColor3uiv;
+	if(real_glColor3uiv != NULL) glad_glColor3uiv = profile_glColor3uiv;
+	real_glColor3us = glad_glColor3us;
+	if(real_glColor3us != NULL) glad_glColor3us = profile_glColor3us;
+	real_glColor3usv = glad_glColor3usv;
+	if(real_glColor3usv != NULL) glad_glColor3usv = profile_glColor3usv;
+	real_glColor4b = glad_glColor4b;
+	if(real_glColor4b != NULL) glad_glColor4b = profile_glColor4b;
+	real_glColor4bv = glad_glColor4bv;
+	if(real_glColor4bv != NULL) glad_glColor4bv = profile_glColor4bv;
+	real_glColor4d = glad_glColor4d;
+	if(real_glColor4d != NULL) glad_glColor4d = profile_glColor4d;
+	real_glColor4dv = glad_glColor4dv;
+	if(real_glColor4dv != NULL) glad_glColor4dv = profile_glColor4dv;
+	real_glColor4f = glad_glColor4f;
+	if(real_glColor4f != NULL) glad_glColor4f = profile_glColor4f;
+	real_glColor4fv = glad_glColor4fv;
+	if(real_glColor4fv != NULL) glad_glColor4fv = profile_glColor4fv;
+	real_glColor4i = glad_glColor4i;
+	if(real_glColor4i != NULL) glad_glColor4i = profile_glColor4i;
+	real_glColor4iv = glad_glColor4iv;
+	if(real_glColor4iv != NULL) glad_glColor4iv = profile_glColor4iv;
+	real_glColor4s = glad_glColor4s;
+	if(real_glColor4s != NULL) glad_glColor4s = profile_glColor4s;
+	real_glColor4sv = glad_glColor4sv;
+	if(real_glColor4sv != NULL) glad_glColor4sv = profile_glColor4sv;
+	real_glColor4ub = glad_glColor4ub;
+	if(real_glColor4ub != NULL) glad_glColor4ub = profile_glColor4ub;
+	real_glColor4ubv = glad_glColor4ubv;
+	if(real_glColor4ubv != NULL) glad_glColor4ubv = profile_glColor4ubv;
+	real_glColor4ui = glad_glColor4ui;
+	if(real_glColor4ui != NULL) glad_glColor4ui = profile_glColor4ui;
+	real_glColor4uiv = glad_glColor4uiv;
+	if(real_glColor4uiv != NULL) glad_glColor4uiv = profile_glColor4uiv;
+	real_glColor4us = glad_glColor4us;
+	if(real_glColor4us != NULL) glad_glColor4us = profile_glColor4us;
+	real_glColor4usv = glad_glColor4usv;
+	if(real_glColor4usv != NULL) glad_glColor4usv = profile_glColor4usv;
+	real_glEdgeFlag = glad_glEdgeFlag;
+	if(real_glEdgeFlag != NULL) glad_glEdgeFlag = profile_glEdgeFlag;
+	real_glEdgeFlagv = glad_glEdgeFlagv;
+	if(real_glEdgeFlagv != NULL) glad_glEdgeFlagv = profile_glEdgeFlagv;
+	real_glEnd = glad_glEnd;
+	if(real_glEnd != NULL) glad_glEnd = profile_glEnd;
+	real_glIndexd = glad_glIndexd;
+	if(real_glIndexd != NULL) glad_glIndexd = profile_glIndexd;
+	real_glIndexdv = glad_glIndexdv;
+	if(real_glIndexdv != NULL) glad_glIndexdv = profile_glIndexdv;
+	real_glIndexf = glad_glIndexf;
+	if(real_glIndexf != NULL) glad_glIndexf = profile_glIndexf;
+	real_glIndexfv = glad_glIndexfv;
+	if(real_glIndexfv != NULL) glad_glIndexfv = profile_glIndexfv;
+	real_glIndexi = glad_glIndexi;
+	if(real_glIndexi != NULL) glad_glIndexi = profile_glIndexi;
+	real_glIndexiv = glad_glIndexiv;
+	if(real_glIndexiv != NULL) glad_glIndexiv = profile_glIndexiv;
+	real_glIndexs = glad_glIndexs;
+	if(real_glIndexs != NULL) glad_glIndexs = profile_glIndexs;
+	real_glIndexsv = glad_glIndexsv;
+	if(real_glIndexsv != NULL) glad_glIndexsv = profile_glIndexsv;
+	real_glNormal3b = glad_glNormal3b;
+	if(real_glNormal3b != NULL) glad_glNormal3b = profile_glNormal3b;
+	real_glNormal3bv = glad_glNormal3bv;
+	if(real_glNormal3bv != NULL) glad_glNormal3bv = profile_glNormal3bv;
+	real_glNormal3d = glad_glNormal3d;
+	if(real_glNormal3d != NULL) glad_glNormal3d = profile_glNormal3d;
+	real_glNormal3dv = glad_glNormal3dv;
+	if(real_glNormal3dv != NULL) glad_glNormal3dv = profile_glNormal3dv;
+	real_glNormal3f = glad_glNormal3f;
+	if(real_glNormal3f != NULL) glad_glNormal3f = profile_glNormal3f;
+	real_glNormal3fv = glad_glNormal3fv;
+	if(real_glNormal3fv != NULL) glad_glNormal3fv = profile_glNormal3fv;
+	real_glNormal3i = glad_glNormal3i;
+	if(real_glNormal3i != NULL) glad_glNormal3i = profile_glNormal3i;
+	real_glNormal3iv = glad_glNormal3iv;
+	if(real_glNormal3iv != NULL) glad_glNormal3iv = profile_glNormal3iv;
+	real_glNormal3s = glad_glNormal3s;
+	if(real_glNormal3s != NULL) glad_glNormal3s = profile_glNormal3s;
+	real_glNormal3sv = glad_glNormal3sv;
+	if(real_glNormal3sv != NULL) glad_glNormal3sv = profile_glNormal3sv;
+	real_glRasterPos2d = glad_glRasterPos2d;
+	if(real_glRasterPos2d != NULL) glad_glRasterPos2d = profile_glRasterPos2d;
+	real_glRasterPos2dv = glad_glRasterPos2dv;
+	if(real_glRasterPos2dv != NULL) glad_glRasterPos2dv = profile_glRasterPos2dv;
+	real_glRasterPos2f = glad_glRasterPos2f;
+	if(real_glRasterPos2f != NULL) glad_glRasterPos2f = profile_glRasterPos2f;
+	real_glRasterPos2fv = glad_glRasterPos2fv;
+	if(real_glRasterPos2fv != NULL) glad_glRasterPos2fv = profile_glRasterPos2fv;
+	real_glRasterPos2i = glad_glRasterPos2i;
+	if(real_glRasterPos2i != NULL) glad_glRasterPos2i = profile_glRasterPos2i;
+	real_glRasterPos2iv = glad_glRasterPos2iv;
+	if(real_glRasterPos2iv != NULL) glad_glRasterPos2iv = profile_glRasterPos2iv;
+	real_glRasterPos2s = glad_glRasterPos2s;
+	if(real_glRasterPos2s != NULL) glad_glRasterPos2s = profile_glRasterPos2s;
+	real_glRasterPos2sv = glad_glRasterPos2sv;
+	if(real_glRasterPos2sv != NULL) glad_glRasterPos2sv = profile_glRasterPos2sv;
+	real_glRasterPos3d = glad_glRasterPos3d;
+	if(real_glRasterPos3d != NULL) glad_glRasterPos3d = profile_glRasterPos3d;
+	real_glRasterPos3dv = glad_glRasterPos3dv;
+	if(real_glRasterPos3dv != NULL) glad_glRasterPos3dv = profile_glRasterPos3dv;
+	real_glRasterPos3f = glad_glRasterPos3f;
+	if(real_glRasterPos3f != NULL) glad_glRasterPos3f = profile_glRasterPos3f;
+	real_glRasterPos3fv = glad_glRasterPos3fv;
+	if(real_glRasterPos3fv != NULL) glad_glRasterPos3fv = profile_glRasterPos3fv;
+	real_glRasterPos3i = glad_glRasterPos3i;
+	if(real_glRasterPos3i != NULL) glad_glRasterPos3i = profile_glRasterPos3i;
+	real_glRasterPos3iv = glad_glRasterPos3iv;
+	if(real_glRasterPos3iv != NULL) glad_glRasterPos3iv = profile_glRasterPos3iv;
+	real_glRasterPos3s = glad_glRasterPos3s;
+	if(real_glRasterPos3s != NULL) glad_glRasterPos3s = profile_glRasterPos3s;
+	real_glRasterPos3sv = glad_glRasterPos3sv;
+	if(real_glRasterPos3sv != NULL) glad_glRasterPos3sv = profile_glRasterPos3sv;
+	real_glRasterPos4d = glad_glRasterPos4d;
+	if(real_glRasterPos4d != NULL) glad_glRasterPos4d = profile_glRasterPos4d;
+	real_glRasterPos4dv = glad_glRasterPos4dv;
+	if(real_glRasterPos4dv != NULL) glad_glRasterPos4dv = profile_glRasterPos4dv;
+	real_glRasterPos4f = glad_glRasterPos4f;
+	if(real_glRasterPos4f != NULL) glad_glRasterPos4f = profile_glRasterPos4f;
+	real_glRasterPos4fv = glad_glRasterPos4fv;
+	if(real_glRasterPos4fv != NULL) glad_glRasterPos4fv = profile_glRasterPos4fv;
+	real_glRasterPos4i = glad_glRasterPos4i;
+	if(real_glRasterPos4i != NULL) glad_glRasterPos4i = profile_glRasterPos4i;
+	real_glRasterPos4iv = glad_glRasterPos4iv;
+	if(real_glRasterPos4iv != NULL) glad_glRasterPos4iv = profile_glRasterPos4iv;
+	real_glRasterPos4s = glad_glRasterPos4s;
+	if(real_glRasterPos4s != NULL) glad_glRasterPos4s = profile_glRasterPos4s;
+	real_glRasterPos4sv = glad_glRasterPos4sv;
+	if(real_glRasterPos4sv != NULL) glad_glRasterPos4sv = profile_glRasterPos4sv;
+	real_glRectd = glad_glRectd;
+	if(real_glRectd != NULL) glad_glRectd = profile_glRectd;
+	real_glRectdv = glad_glRectdv;
+	if(real_glRectdv != NULL) glad_glRectdv = profile_glRectdv;
+	real_glRectf = glad_glRectf;
+	if(real_glRectf != NULL) glad_glRectf = profile_glRectf;
+	real_glRectfv = glad_glRectfv;
+	if(real_glRectfv != NULL) glad_glRectfv = profile_glRectfv;
+	real_glRecti = glad_glRecti;
+	if(real_glRecti != NULL) glad_glRecti = profile_glRecti;
+	real_glRectiv = glad_glRectiv;
+	if(real_glRectiv != NULL) glad_glRectiv = profile_glRectiv;
+	real_glRects = glad_glRects;
+	if(real_glRects != NULL) glad_glRects = profile_glRects;
+	real_glRectsv = glad_glRectsv;
+	if(real_glRectsv != NULL) glad_glRectsv = profile_glRectsv;
+	real_glTexCoord1d = glad_glTexCoord1d;
+	if(real_glTexCoord1d != NULL) glad_glTexCoord1d = profile_glTexCoord1d;
+	real_glTexCoord1dv = glad_glTexCoord1dv;
+	if(real_glTexCoord1dv != NULL) glad_glTexCoord1dv = profile_glTexCoord1dv;
+	real_glTexCoord1f = glad_glTexCoord1f;
+	if(real_glTexCoord1f != NULL) glad_glTexCoord1f = profile_glTexCoord1f;
+	real_glTexCoord1fv = glad_glTexCoord1fv;
+	if(real_glTexCoord1fv != NULL) glad_glTexCoord1fv = profile_glTexCoord1fv;
+	real_glTexCoord1i = glad_glTexCoord1i;
+	if(real_glTexCoord1i != NULL) glad_glTexCoord1i = profile_glTexCoord1i;
+	real_glTexCoord1iv = glad_glTexCoord1iv;
+	if(real_glTexCoord1iv != NULL) glad_glTexCoord1iv = profile_glTexCoord1iv;
+	real_glTexCoord1s = glad_glTexCoord1s;
+	if(real_glTexCoord1s != NULL) glad_glTexCoord1s = profile_glTexCoord1s;
+	real_glTexCoord1sv = glad_glTexCoord1sv;
+	if(real_glTexCoord1sv != NULL) glad_glTexCoord1sv = profile_glTexCoord1sv;
+	real_glTexCoord2d = glad_glTexCoord2d;
+	if(real_glTexCoord2d != NULL) glad_glTexCoord2d = profile_glTexCoord2d;
+	real_glTexCoord2dv = glad_glTexCoord2dv;
+	if(real_glTexCoord2dv != NULL) glad_glTexCoord2dv = profile_glTexCoord2dv;
+	real_glTexCoord2f = glad_glTexCoord2f;
+	if(real_glTexCoord2f != NULL) glad_glTexCoord2f = profile_glTexCoord2f;
+	real_glTexCoord2fv = glad_glTexCoord2fv;
+	if(real_glTexCoord2fv != NULL) glad_glTexCoord2fv = profile_glTexCoord2fv;
+	real_glTexCoord2i = glad_glTexCoord2i;
+	if(real_glTexCoord2i != NULL) glad_glTexCoord2i = profile_glTexCoord2i;
+	real_glTexCoord2iv = glad_glTexCoord2iv;
+	if(real_glTexCoord2iv != NULL) glad_glTexCoord2iv = profile_glTexCoord2iv;
+	real_glTexCoord2s = glad_glTexCoord2s;
+	if(real_glTexCoord2s != NULL) glad_glTexCoord2s = profile_glTexCoord2s;
+	real_glTexCoord2sv = glad_glTexCoord2sv;
+	if(real_glTexCoord2sv != NULL) glad_glTexCoord2sv = profile_glTexCoord2sv;
+	real_glTexCoord3d = glad_glTexCoord3d;
+	if(real_glTexCoord3d != NULL) glad_glTexCoord3d = profile_glTexCoord3d;
+	real_glTexCoord3dv = glad_glTexCoord3dv;
+	if(real_glTexCoord3dv != NULL) glad_glTexCoord3dv = profile_glTexCoord3dv;
+	real_glTexCoord3f = glad_glTexCoord3f;
+	if(real_glTexCoord3f != NULL) glad_glTexCoord3f = profile_glTexCoord3f;
+	real_glTexCoord3fv = glad_glTexCoord3fv;
+	if(real_glTexCoord3fv != NULL) glad_glTexCoord3fv = profile_glTexCoord3fv;
+	real_glTexCoord3i = glad_glTexCoord3i;
+	if(real_glTexCoord3i != NULL) glad_glTexCoord3i = profile_glTexCoord3i;
+	real_glTexCoord3iv = glad_glTexCoord3iv;
+	if(real_glTexCoord3iv != NULL) glad_glTexCoord3iv = profile_glTexCoord3iv;
+	real_glTexCoord3s = glad_glTexCoord3s;
+	if(real_glTexCoord3s != NULL) glad_glTexCoord3s = profile_glTexCoord3s;
+	real_glTexCoord3sv = glad_glTexCoord3sv;
+	if(real_glTexCoord3sv != NULL) glad_glTexCoord3sv = profile_glTexCoord3sv;
+	real_glTexCoord4d = glad_glTexCoord4d;
+	if(real_glTexCoord4d != NULL) glad_glTexCoord4d = profile_glTexCoord4d;
+	real_glTexCoord4dv = glad_glTexCoord4dv;
+	if(real_glTexCoord4dv != NULL) glad_glTexCoord4dv = profile_glTexCoord4dv;
+	real_glTexCoord4f = glad_glTexCoord4f;
+	if(real_glTexCoord4f != NULL) glad_glTexCoord4f = profile_glTexCoord4f;
+	real_glTexCoord4fv = glad_glTexCoord4fv;
+	if(real_glTexCoord4fv != NULL) glad_glTexCoord4fv = profile_glTexCoord4fv;
+	real_glTexCoord4i = glad_glTexCoord4i;
+	if(real_glTexCoord4i != NULL) glad_glTexCoord4i = profile_glTexCoord4i;
+	real_glTexCoord4iv = glad_glTexCoord4iv;
+	if(real_glTexCoord4iv != NULL) glad_glTexCoord4iv = profile_glTexCoord4iv;
+	real_glTexCoord4s = glad_glTexCoord4s;
+	if(real_glTexCoord4s != NULL) glad_glTexCoord4s = profile_glTexCoord4s;
+	real_glTexCoord4sv = glad_glTexCoord4sv;
+	if(real_glTexCoord4sv != NULL) glad_glTexCoord4sv = profile_glTexCoord4sv;
+	real_glVertex2d = glad_glVertex2d;
+	if(real_glVertex2d != NULL) glad_glVertex2d = profile_glVertex2d;
+	real_glVertex2dv = glad_glVertex2dv;
+	if(real_glVertex2dv != NULL) glad_glVertex2dv = profile_glVertex2dv;
+	real_glVertex2f = glad_glVertex2f;
+	if(real_glVertex2f != NULL) glad_glVertex2f = profile_glVertex2f;
+	real_glVertex2fv = glad_glVertex2fv;
+	if(real_glVertex2fv != NULL) glad_glVertex2fv = profile_glVertex2fv;
+	real_glVertex2i = glad_glVertex2i;
+	if(real_glVertex2i != NULL) glad_glVertex2i = profile_glVertex2i;
+	real_glVertex2iv = glad_glVertex2iv;
+	if(real_glVertex2iv != NULL) glad_glVertex2iv = profile_glVertex2iv;
+	real_glVertex2s = glad_glVertex2s;
+	if(real_glVertex2s != NULL) glad_glVertex2s = profile_glVertex2s;
+	real_glVertex2sv = glad_glVertex2sv;
+	if(real_glVertex2sv != NULL) glad_glVertex2sv = profile_glVertex2sv;
+	real_glVertex3d = glad_glVertex3d;
+	if(real_glVertex3d != NULL) glad_glVertex3d = profile_glVertex3d;
+	real_glVertex3dv = glad_glVertex3dv;
+	if(real_glVertex3dv != NULL) glad_glVertex3dv = profile_glVertex3dv;
+	real_glVertex3f = glad_glVertex3f;
+	if(real_glVertex3f != NULL) glad_glVertex3f = profile_glVertex3f;
+	real_glVertex3fv = glad_glVertex3fv;
+	if(real_glVertex3fv != NULL) glad_glVertex3fv = profile_glVertex3fv;
+	real_glVertex3i = glad_glVertex3i;
+	if(real_glVertex3i != NULL) glad_glVertex3i = profile_glVertex3i;
+	real_glVertex3iv = glad_glVertex3iv;
+	if(real_glVertex3iv != NULL) glad_glVertex3iv = profile_glVertex3iv;
+	real_glVertex3s = glad_glVertex3s;
+	if(real_glVertex3s != NULL) glad_glVertex3s = profile_glVertex3s;
+	real_glVertex3sv = glad_glVertex3sv;
+	if(real_glVertex3sv != NULL) glad_glVertex3sv = profile_glVertex3sv;
+	real_glVertex4d = glad_glVertex4d;
+	if(real_glVertex4d != NULL) glad_glVertex4d = profile_glVertex4d;
+	real_glVertex4dv = glad_glVertex4dv;
+	if(real_glVertex4dv != NULL) glad_glVertex4dv = profile_glVertex4dv;
+	real_glVertex4f = glad_glVertex4f;
+	if(real_glVertex4f != NULL) glad_glVertex4f = profile_glVertex4f;
+	real_glVertex4fv = glad_glVertex4fv;
+	if(real_glVertex4fv != NULL) glad_glVertex4fv = profile_glVertex4fv;
+	real_glVertex4i = glad_glVertex4i;
+	if(real_glVertex4i != NULL) glad_glVertex4i = profile_glVertex4i;
+	real_glVertex4iv = glad_glVertex4iv;
+	if(real_glVertex4iv != NULL) glad_glVertex4iv = profile_glVertex4iv;
+	real_glVertex4s = glad_glVertex4s;
+	if(real_glVertex4s != NULL) glad_glVertex4s = profile_glVertex4s;
+	real_glVertex4sv = glad_glVertex4sv;
+	if(real_glVertex4sv != NULL) glad_glVertex4sv = profile_glVertex4sv;
+	real_glClipPlane = glad_glClipPlane;
+	if(real_glClipPlane != NULL) glad_glClipPlane = profile_glClipPlane;
+	real_glColorMaterial = glad_glColorMaterial;
+	if(real_glColorMaterial != NULL) glad_glColorMaterial = profile_glColorMaterial;
+	real_glFogf = glad_glFogf;
+	if(real_glFogf != NULL) glad_glFogf = profile_glFogf;
+	real_glFogfv = glad_glFogfv;
+	if(real_glFogfv != NULL) glad_glFogfv = profile_glFogfv;
+	real_glFogi = glad_glFogi;
+	if(real_glFogi != NULL) glad_glFogi = profile_glFogi;
+	real_glFogiv = glad_glFogiv;
+	if(real_glFogiv != NULL) glad_glFogiv = profile_glFogiv;
+	real_glLightf = glad_glLightf;
+	if(real_glLightf != NULL) glad_glLightf = profile_glLightf;
+	real_glLightfv = glad_glLightfv;
+	if(real_glLightfv != NULL) glad_glLightfv = profile_glLightfv;
+	real_glLighti = glad_glLighti;
+	if(real_glLighti != NULL) glad_glLighti = profile_glLighti;
+	real_glLightiv = glad_glLightiv;
+	if(real_glLightiv != NULL) glad_glLightiv = profile_glLightiv;
+	real_glLightModelf = glad_glLightModelf;
+	if(real_glLightModelf != NULL) glad_glLightModelf = profile_glLightModelf;
+	real_glLightModelfv = glad_glLightModelfv;
+	if(real_glLightModelfv != NULL) glad_glLightModelfv = profile_glLightModelfv;
+	real_glLightModeli = glad_glLightModeli;
+	if(real_glLightModeli != NULL) glad_glLightModeli = profile_glLightModeli;
+	real_glLightModeliv = glad_glLightModeliv;
+	if(real_glLightModeliv != NULL) glad_glLightModeliv = profile_glLightModeliv;
+	real_glLineStipple = glad_glLineStipple;
+	if(real_glLineStipple != NULL) glad_glLineStipple = profile_glLineStipple;
+	real_glMaterialf = glad_glMaterialf;
+	if(real_glMaterialf != NULL) glad_glMaterialf = profile_glMaterialf;
+	real_glMaterialfv = glad_glMaterialfv;
+	if(real_glMaterialfv != NULL) glad_glMaterialfv = profile_glMaterialfv;
+	real_glMateriali = glad_glMateriali;
+	if(real_glMateriali != NULL) glad_glMateriali = profile_glMateriali;
+	real_glMaterialiv = glad_glMaterialiv;
+	if(real_glMaterialiv != NULL) glad_glMaterialiv = profile_glMaterialiv;
+	real_glPolygonStipple = glad_glPolygonStipple;
+	if(real_glPolygonStipple != NULL) glad_glPolygonStipple = profile_glPolygonStipple;
+	real_glShadeModel = glad_glShadeModel;
+	if(real_glShadeModel != NULL) glad_glShadeModel = profile_glShadeModel;
+	real_glTexEnvf = glad_glTexEnvf;
+	if(real_glTexEnvf != NULL) glad_glTexEnvf = profile_glTexEnvf;
+	real_glTexEnvfv = glad_glTexEnvfv;
+	if(real_glTexEnvfv != NULL) glad_glTexEnvfv = profile_glTexEnvfv;
+	real_glTexEnvi = glad_glTexEnvi;
+	if(real_glTexEnvi != NULL) glad_glTexEnvi = profile_glTexEnvi;
+	real_glTexEnviv = glad_glTexEnviv;
+	if(real_glTexEnviv != NULL) glad_glTexEnviv = profile_glTexEnviv;
+	real_glTexGend = glad_glTexGend;
+	if(real_glTexGend != NULL) glad_glTexGend = profile_glTexGend;
+	real_glTexGendv = glad_glTexGendv;
+	if(real_glTexGendv != NULL) glad_glTexGendv = profile_glTexGendv;
+	real_glTexGenf = glad_glTexGenf;
+	if(real_glTexGenf != NULL) glad_glTexGenf = profile_glTexGenf;
+	real_glTexGenfv = glad_glTexGenfv;
+	if(real_glTexGenfv != NULL) glad_glTexGenfv = profile_glTexGenfv;
+	real_glTexGeni = glad_glTexGeni;
+	if(real_glTexGeni != NULL) glad_glTexGeni = profile_glTexGeni;
+	real_glTexGeniv = glad_glTexGeniv;
+	if(real_glTexGeniv != NULL) glad_glTexGeniv = profile_glTexGeniv;
+	real_glFeedbackBuffer = glad_glFeedbackBuffer;
+	if(real_glFeedbackBuffer != NULL) glad_glFeedbackBuffer = profile_glFeedbackBuffer;
+	real_glSelectBuffer = glad_glSelectBuffer;
+	if(real_glSelectBuffer != NULL) glad_glSelectBuffer = profile_glSelectBuffer;
+	real_glRenderMode = glad_glRenderMode;
+	if(real_glRenderMode != NULL) glad_glRenderMode = profile_glRenderMode;
+	real_glInitNames = glad_glInitNames;
+	if(real_glInitNames != NULL) glad_glInitNames = profile_glInitNames;
+	real_glLoadName = glad_glLoadName;
+	if(real_glLoadName != NULL) glad_glLoadName = profile_glLoadName;
+	real_glPassThrough = glad_glPassThrough;
+	if(real_glPassThrough != NULL) glad_glPassThrough = profile_glPassThrough;
+	real_glPopName = glad_glPopName;
+	if(real_glPopName != NULL) glad_glPopName = profile_glPopName;
+	real_glPushName = glad_glPushName;
+	if(real_glPushName != NULL) glad_glPushName = profile_glPushName;
+	real_glClearAccum = glad_glClearAccum;
+	if(real_glClearAccum != NULL) glad_glClearAccum = profile_glClearAccum;
+	real_glClearIndex = glad_glClearIndex;
+	if(real_glClearIndex != NULL) glad_glClearIndex = profile_glClearIndex;
+	real_glIndexMask = glad_glIndexMask;
+	if(real_glIndexMask != NULL) glad_glIndexMask = profile_glIndexMask;
+	real_glAccum = glad_glAccum;
+	if(real_glAccum != NULL) glad_glAccum = profile_glAccum;
+	real_glPopAttrib = glad_glPopAttrib;
+	if(real_glPopAttrib != NULL) glad_glPopAttrib = profile_glPopAttrib;
+	real_glPushAttrib = glad_glPushAttrib;
+	if(real_glPushAttrib != NULL) glad_glPushAttrib = profile_glPushAttrib;
+	real_glMap1d = glad_glMap1d;
+	if(real_glMap1d != NULL) glad_glMap1d = profile_glMap1d;
+	real_glMap1f = glad_glMap1f;
+	if(real_glMap1f != NULL) glad_glMap1f = profile_glMap1f;
+	real_glMap2d = glad_glMap2d;
+	if(real_glMap2d != NULL) glad_glMap2d = profile_glMap2d;
+	real_glMap2f = glad_glMap2f;
+	if(real_glMap2f != NULL) glad_glMap2f = profile_glMap2f;
+	real_glMapGrid1d = glad_glMapGrid1d;
+	if(real_glMapGrid1d != NULL) glad_glMapGrid1d = profile_glMapGrid1d;
+	real_glMapGrid1f = glad_glMapGrid1f;
+	if(real_glMapGrid1f != NULL) glad_glMapGrid1f = profile_glMapGrid1f;
+	real_glMapGrid2d = glad_glMapGrid2d;
+	if(real_glMapGrid2d != NULL) glad_glMapGrid2d = profile_glMapGrid2d;
+	real_glMapGrid2f = glad_glMapGrid2f;
+	if(real_glMapGrid2f != NULL) glad_glMapGrid2f = profile_glMapGrid2f;
+	real_glEvalCoord1d = glad_glEvalCoord1d;
+	if(real_glEvalCoord1d != NULL) glad_glEvalCoord1d = profile_glEvalCoord1d;
+	real_glEvalCoord1dv = glad_glEvalCoord1dv;
+	if(real_glEvalCoord1dv != NULL) glad_glEvalCoord1dv = profile_glEvalCoord1dv;
+	real_glEvalCoord1f = glad_glEvalCoord1f;
+	if(real_glEvalCoord1f != NULL) glad_glEvalCoord1f = profile_glEvalCoord1f;
+	real_glEvalCoord1fv = glad_glEvalCoord1fv;
+	if(real_glEvalCoord1fv != NULL) glad_glEvalCoord1fv = profile_glEvalCoord1fv;
+	real_glEvalCoord2d = glad_glEvalCoord2d;
+	if(real_glEvalCoord2d != NULL) glad_glEvalCoord2d = profile_glEvalCoord2d;
+	real_glEvalCoord2dv = glad_glEvalCoord2dv;
+	if(real_glEvalCoord2dv != NULL) glad_glEvalCoord2dv = profile_glEvalCoord2dv;
+	real_glEvalCoord2f = glad_glEvalCoord2f;
+	if(real_glEvalCoord2f != NULL) glad_glEvalCoord2f = profile_glEvalCoord2f;
+	real_glEvalCoord2fv = glad_glEvalCoord2fv;
+	if(real_glEvalCoord2fv != NULL) glad_glEvalCoord2fv = profile_glEvalCoord2fv;
+	real_glEvalMesh1 = glad_glEvalMesh1;
+	if(real_glEvalMesh1 != NULL) glad_glEvalMesh1 = profile_glEvalMesh1;
+	real_glEvalPoint1 = glad_glEvalPoint1;
+	if(real_glEvalPoint1 != NULL) glad_glEvalPoint1 = profile_glEvalPoint1;
+	real_glEvalMesh2 = glad_glEvalMesh2;
+	if(real_glEvalMesh2 != NULL) glad_glEvalMesh2 = profile_glEvalMesh2;
+	real_glEvalPoint2 = glad_glEvalPoint2;
+	if(real_glEvalPoint2 != NULL) glad_glEvalPoint2 = profile_glEvalPoint2;
+	real_glAlphaFunc = glad_glAlphaFunc;
+	if(real_glAlphaFunc != NULL) glad_glAlphaFunc = profile_glAlphaFunc;
+	real_glPixelZoom = glad_glPixelZoom;
+	if(real_glPixelZoom != NULL) glad_glPixelZoom = profile_glPixelZoom;
+	real_glPixelTransferf = glad_glPixelTransferf;
+	if(real_glPixelTransferf != NULL) glad_glPixelTransferf = profile_glPixelTransferf;
+	real_glPixelTransferi = glad_glPixelTransferi;
+	if(real_glPixelTransferi != NULL) glad_glPixelTransferi = profile_glPixelTransferi;
+	real_glPixelMapfv = glad_glPixelMapfv;
+	if(real_glPixelMapfv != NULL) glad_glPixelMapfv = profile_glPixelMapfv;
+	real_glPixelMapuiv = glad_glPixelMapuiv;
+	if(real_glPixelMapuiv != NULL) glad_glPixelMapuiv = profile_glPixelMapuiv;
+	real_glPixelMapusv = glad_glPixelMapusv;
+	if(real_glPixelMapusv != NULL) glad_glPixelMapusv = profile_glPixelMapusv;
+	real_glCopyPixels = glad_glCopyPixels;
+	if(real_glCopyPixels != NULL) glad_glCopyPixels = profile_glCopyPixels;
+	real_glDrawPixels = glad_glDrawPixels;
+	if(real_glDrawPixels != NULL) glad_glDrawPixels = profile_glDrawPixels;
+	real_glGetClipPlane = glad_glGetClipPlane;
+	if(real_glGetClipPlane != NULL) glad_glGetClipPlane = profile_glGetClipPlane;
+	real_glGetLightfv = glad_glGetLightfv;
+	if(real_glGetLightfv != NULL) glad_glGetLightfv = profile_glGetLightfv;
+	real_glGetLightiv = glad_glGetLightiv;
+	if(real_glGetLightiv != NULL) glad_glGetLightiv = profile_glGetLightiv;
+	real_glGetMapdv = glad_glGetMapdv;
+	if(real_glGetMapdv != NULL) glad_glGetMapdv = profile_glGetMapdv;
+	real_glGetMapfv = glad_glGetMapfv;
+	if(real_glGetMapfv != NULL) glad_glGetMapfv = profile_glGetMapfv;
+	real_glGetMapiv = glad_glGetMapiv;
+	if(real_glGetMapiv != NULL) glad_glGetMapiv = profile_glGetMapiv;
+	real_glGetMaterialfv = glad_glGetMaterialfv;
+	if(real_glGetMaterialfv != NULL) glad_glGetMaterialfv = profile_glGetMaterialfv;
+	real_glGetMaterialiv = glad_glGetMaterialiv;
+	if(real_glGetMaterialiv != NULL) glad_glGetMaterialiv = profile_glGetMaterialiv;
+	real_glGetPixelMapfv = glad_glGetPixelMapfv;
+	if(real_glGetPixelMapfv != NULL) glad_glGetPixelMapfv = profile_glGetPixelMapfv;
+	real_glGetPixelMapuiv = glad_glGetPixelMapuiv;
+	if(real_glGetPixelMapuiv != NULL) glad_glGetPixelMapuiv = profile_glGetPixelMapuiv;
+	real_glGetPixelMapusv = glad_glGetPixelMapusv;
+	if(real_glGetPixelMapusv != NULL) glad_glGetPixelMapusv = profile_glGetPixelMapusv;
+	real_glGetPolygonStipple = glad_glGetPolygonStipple;
+	if(real_glGetPolygonStipple != NULL) glad_glGetPolygonStipple = profile_glGetPolygonStipple;
+	real_glGetTexEnvfv = glad_glGetTexEnvfv;
+	if(real_glGetTexEnvfv != NULL) glad_glGetTexEnvfv = profile_glGetTexEnvfv;
+	real_glGetTexEnviv = glad_glGetTexEnviv;
+	if(real_glGetTexEnviv != NULL) glad_glGetTexEnviv = profile_glGetTexEnviv;
+	real_glGetTexGendv = glad_glGetTexGendv;
+	if(real_glGetTexGendv != NULL) glad_glGetTexGendv = profile_glGetTexGendv;
+	real_glGetTexGenfv = glad_glGetTexGenfv;
+	if(real_glGetTexGenfv != NULL) glad_glGetTexGenfv = profile_glGetTexGenfv;
+	real_glGetTexGeniv = glad_glGetTexGeniv;
+	if(real_glGetTexGeniv != NULL) glad_glGetTexGeniv = profile_glGetTexGeniv;
+	real_glIsList = glad_glIsList;
+	if(real_glIsList != NULL) glad_glIsList = profile_glIsList;
+	real_glFrustum = glad_glFrustum;
+	if(real_glFrustum != NULL) glad_glFrustum = profile_glFrustum;
+	real_glLoadIdentity = glad_glLoadIdentity;
+	if(real_glLoadIdentity != NULL) glad_glLoadIdentity = profile_glLoadIdentity;
+	real_glLoadMatrixf = glad_glLoadMatrixf;
+	if(real_glLoadMatrixf != NULL) glad_glLoadMatrixf = profile_glLoadMatrixf;
+	real_glLoadMatrixd = glad_glLoadMatrixd;
+	if(real_glLoadMatrixd != NULL) glad_glLoadMatrixd = profile_glLoadMatrixd;
+	real_glMatrixMode = glad_glMatrixMode;
+	if(real_glMatrixMode != NULL) glad_glMatrixMode = profile_glMatrixMode;
+	real_glMultMatrixf = glad_glMultMatrixf;
+	if(real_glMultMatrixf != NULL) glad_glMultMatrixf = profile_glMultMatrixf;
+	real_glMultMatrixd = glad_glMultMatrixd;
+	if(real_glMultMatrixd != NULL) glad_glMultMatrixd = profile_glMultMatrixd;
+	real_glOrtho = glad_glOrtho;
+	if(real_glOrtho != NULL) glad_glOrtho = profile_glOrtho;
+	real_glPopMatrix = glad_glPopMatrix;
+	if(real_glPopMatrix != NULL) glad_glPopMatrix = profile_glPopMatrix;
+	real_glPushMatrix = glad_glPushMatrix;
+	if(real_glPushMatrix != NULL) glad_glPushMatrix = profile_glPushMatrix;
+	real_glRotated = glad_glRotated;
+	if(real_glRotated != NULL) glad_glRotated = profile_glRotated;
+	real_glRotatef = glad_glRotatef;
+	if(real_glRotatef != NULL) glad_glRotatef = profile_glRotatef;
+	real_glScaled = glad_glScaled;
+	if(real_glScaled != NULL) glad_glScaled = profile_glScaled;
+	real_glScalef = glad_glScalef;
+	if(real_glScalef != NULL) glad_glScalef = profile_glScalef;
+	real_glTranslated = glad_glTranslated;
+	if(real_glTranslated != NULL) glad_glTranslated = profile_glTranslated;
+	real_glTranslatef = glad_glTranslatef;
+	if(real_glTranslatef != NULL) glad_glTranslatef = profile_glTranslatef;
+	real_glDrawArrays = glad_glDrawArrays;
+	if(real_glDrawArrays != NULL) glad_glDrawArrays = profile_glDrawArrays;
+	real_glDrawElements = glad_glDrawElements;
+	if(real_glDrawElements != NULL) glad_glDrawElements = profile_glDrawElements;
+	real_glGetPointerv = glad_glGetPointerv;
+	if(real_glGetPointerv != NULL) glad_glGetPointerv = profile_glGetPointerv;
+	real_glPolygonOffset = glad_glPolygonOffset;
+	if(real_glPolygonOffset != NULL) glad_glPolygonOffset = profile_glPolygonOffset;
+	real_glCopyTexImage1D = glad_glCopyTexImage1D;
+	if(real_glCopyTexImage1D != NULL) glad_glCopyTexImage1D = profile_glCopyTexImage1D;
+	real_glCopyTexImage2D = glad_glCopyTexImage2D;
+	if(real_glCopyTexImage2D != NULL) glad_glCopyTexImage2D = profile_glCopyTexImage2D;
+	real_glCopyTexSubImage1D = glad_glCopyTexSubImage1D;
+	if(real_glCopyTexSubImage1D != NULL) glad_glCopyTexSubImage1D = profile_glCopyTexSubImage1D;
+	real_glCopyTexSubImage2D = glad_glCopyTexSubImage2D;
+	if(real_glCopyTexSubImage2D != NULL) glad_glCopyTexSubImage2D = profile_glCopyTexSubImage2D;
+	real_glTexSubImage1D = glad_glTexSubImage1D;
+	if(real_glTexSubImage1D != NULL) glad_glTexSubImage1D = profile_glTexSubImage1D;
+	real_glTexSubImage2D = glad_glTexSubImage2D;
+	if(real_glTexSubImage2D != NULL) glad_glTexSubImage2D = profile_glTexSubImage2D;
+	real_glBindTexture = glad_glBindTexture;
+	if(real_glBindTexture != NULL) glad_glBindTexture = profile_glBindTexture;
+	real_glDeleteTextures = glad_glDeleteTextures;
+	if(real_glDeleteTextures != NULL) glad_glDeleteTextures = profile_glDeleteTextures;
+	real_glGenTextures = glad_glGenTextures;
+	if(real_glGenTextures != NULL) glad_glGenTextures = profile_glGenTextures;
+	real_glIsTexture = glad_glIsTexture;
+	if(real_glIsTexture != NULL) glad_glIsTexture = profile_glIsTexture;
+	real_glArrayElement = glad_glArrayElement;
+	if(real_glArrayElement != NULL) glad_glArrayElement = profile_glArrayElement;
+	real_glColorPointer = glad_glColorPointer;
+	if(real_glColorPointer != NULL) glad_glColorPointer = profile_glColorPointer;
+	real_glDisableClientState = glad_glDisableClientState;
+	if(real_glDisableClientState != NULL) glad_glDisableClientState = profile_glDisableClientState;
+	real_glEdgeFlagPointer = glad_glEdgeFlagPointer;
+	if(real_glEdgeFlagPointer != NULL) glad_glEdgeFlagPointer = profile_glEdgeFlagPointer;
+	real_glEnableClientState = glad_glEnableClientState;
+	if(real_glEnableClientState != NULL) glad_glEnableClientState = profile_glEnableClientState;
+	real_glIndexPointer = glad_glIndexPointer;
+	if(real_glIndexPointer != NULL) glad_glIndexPointer = profile_glIndexPointer;
+	real_glInterleavedArrays = glad_glInterleavedArrays;
+	if(real_glInterleavedArrays != NULL) glad_glInterleavedArrays = profile_glInterleavedArrays;
+	real_glNormalPointer = glad_glNormalPointer;
+	if(real_glNormalPointer != NULL) glad_glNormalPointer = profile_glNormalPointer;
+	real_glTexCoordPointer = glad_glTexCoordPointer;
+	if(real_glTexCoordPointer != NULL) glad_glTexCoordPointer = profile_glTexCoordPointer;
+	real_glVertexPointer = glad_glVertexPointer;
+	if(real_glVertexPointer != NULL) glad_glVertexPointer = profile_glVertexPointer;
+	real_glAreTexturesResident = glad_glAreTexturesResident;
+	if(real_glAreTexturesResident != NULL) glad_glAreTexturesResident = profile_glAreTexturesResident;
+	real_glPrioritizeTextures = glad_glPrioritizeTextures;
+	if(real_glPrioritizeTextures != NULL) glad_glPrioritizeTextures = profile_glPrioritizeTextures;
+	real_glIndexub = glad_glIndexub;
+	if(real_glIndexub != NULL) glad_glIndexub = profile_glIndexub;
+	real_glIndexubv = glad_glIndexubv;
+	if(real_glIndexubv != NULL) glad_glIndexubv = profile_glIndexubv;
+	real_glPopClientAttrib = glad_glPopClientAttrib;
+	if(real_glPopClientAttrib != NULL) glad_glPopClientAttrib = profile_glPopClientAttrib;
+	real_glPushClientAttrib = glad_glPushClientAttrib;
+	if(real_glPushClientAttrib != NULL) glad_glPushClientAttrib = profile_glPushClientAttrib;
+	real_glDrawRangeElements = glad_glDrawRangeElements;
+	if(real_glDrawRangeElements != NULL) glad_glDrawRangeElements = profile_glDrawRangeElements;
+	real_glTexImage3D = glad_glTexImage3D;
+	if(real_glTexImage3D != NULL) glad_glTexImage3D = profile_glTexImage3D;
+	real_glTexSubImage3D = glad_glTexSubImage3D;
+	if(real_glTexSubImage3D != NULL) glad_glTexSubImage3D = profile_glTexSubImage3D;
+	real_glCopyTexSubImage3D = glad_glCopyTexSubImage3D;
+	if(real_glCopyTexSubImage3D != NULL) glad_glCopyTexSubImage3D = profile_glCopyTexSubImage3D;
+	real_glActiveTexture = glad_glActiveTexture;
+	if(real_glActiveTexture != NULL) glad_glActiveTexture = profile_glActiveTexture;
+	real_glSampleCoverage = glad_glSampleCoverage;
+	if(real_glSampleCoverage != NULL) glad_glSampleCoverage = profile_glSampleCoverage;
+	real_glCompressedTexImage3D = glad_glCompressedTexImage3D;
+	if(real_glCompressedTexImage3D != NULL) glad_glCompressedTexImage3D = profile_glCompressedTexImage3D;
+	real_glCompressedTexImage2D = glad_glCompressedTexImage2D;
+	if(real_glCompressedTexImage2D != NULL) glad_glCompressedTexImage2D = profile_glCompressedTexImage2D;
+	real_glCompressedTexImage1D = glad_glCompressedTexImage1D;
+	if(real_glCompressedTexImage1D != NULL) glad_glCompressedTexImage1D = profile_glCompressedTexImage1D;
+	real_glCompressedTexSubImage3D = glad_glCompressedTexSubImage3D;
+	if(real_glCompressedTexSubImage3D != NULL) glad_glCompressedTexSubImage3D = profile_glCompressedTexSubImage3D;
+	real_glCompressedTexSubImage2D = glad_glCompressedTexSubImage2D;
+	if(real_glCompressedTexSubImage2D != NULL) glad_glCompressedTexSubImage2D = profile_glCompressedTexSubImage2D;
+	real_glCompressedTexSubImage1D = glad_glCompressedTexSubImage1D;
+	if(real_glCompressedTexSubImage1D != NULL) glad_glCompressedTexSubImage1D = profile_glCompressedTexSubImage1D;
+	real_glGetCompressedTexImage = glad_glGetCompressedTexImage;
+	if(real_glGetCompressedTexImage != NULL) glad_glGetCompressedTexImage = profile_glGetCompressedTexImage;
+	real_glClientActiveTexture = glad_glClientActiveTexture;
+	if(real_glClientActiveTexture != NULL) glad_glClientActiveTexture = profile_glClientActiveTexture;
+	real_glMultiTexCoord1d = glad_glMultiTexCoord1d;
+	if(real_glMultiTexCoord1d != NULL) glad_glMultiTexCoord1d = profile_glMultiTexCoord1d;
+	real_glMultiTexCoord1dv = glad_glMultiTexCoord1dv;
+	if(real_glMultiTexCoord1dv != NULL) glad_glMultiTexCoord1dv = profile_glMultiTexCoord1dv;
+	real_glMultiTexCoord1f = glad_glMultiTexCoord1f;
+	if(real_glMultiTexCoord1f != NULL) glad_glMultiTexCoord1f = profile_glMultiTexCoord1f;
+	real_glMultiTexCoord1fv = glad_glMultiTexCoord1fv;
+	if(real_glMultiTexCoord1fv != NULL) glad_glMultiTexCoord1fv = profile_glMultiTexCoord1fv;
+	real_glMultiTexCoord1i = glad_glMultiTexCoord1i;
+	if(real_glMultiTexCoord1i != NULL) glad_glMultiTexCoord1i = profile_glMultiTexCoord1i;
+	real_glMultiTexCoord1iv = glad_glMultiTexCoord1iv;
+	if(real_glMultiTexCoord1iv != NULL) glad_glMultiTexCoord1iv = profile_glMultiTexCoord1iv;
+	real_glMultiTexCoord1s = glad_glMultiTexCoord1s;
+	if(real_glMultiTexCoord1s != NULL) glad_glMultiTexCoord1s = profile_glMultiTexCoord1s;
+	real_glMultiTexCoord1sv = glad_glMultiTexCoord1sv;
+	if(real_glMultiTexCoord1sv != NULL) glad_glMultiTexCoord1sv = profile_glMultiTexCoord1sv;
+	real_glMultiTexCoord2d = glad_glMultiTexCoord2d;
+	if(real_glMultiTexCoord2d != NULL) glad_glMultiTexCoord2d = profile_glMultiTexCoord2d;
+	real_glMultiTexCoord2dv = glad_glMultiTexCoord2dv;
+	if(real_glMultiTexCoord2dv != NULL) glad_glMultiTexCoord2dv = profile_glMultiTexCoord2dv;
+	real_glMultiTexCoord2f = glad_glMultiTexCoord2f;
+	if(real_glMultiTexCoord2f != NULL) glad_glMultiTexCoord2f = profile_glMultiTexCoord2f;
+	real_glMultiTexCoord2fv = glad_glMultiTexCoord2fv;
+	if(real_glMultiTexCoord2fv != NULL) glad_glMultiTexCoord2fv = profile_glMultiTexCoord2fv;
+	real_glMultiTexCoord2i = glad_glMultiTexCoord2i;
+	if(real_glMultiTexCoord2i != NULL) glad_glMultiTexCoord2i = profile_glMultiTexCoord2i;
+	real_glMultiTexCoord2iv = glad_glMultiTexCoord2iv;
+	if(real_glMultiTexCoord2iv != NULL) glad_glMultiTexCoord2iv = profile_glMultiTexCoord2iv;
+	real_glMultiTexCoord2s = glad_glMultiTexCoord2s;
+	if(real_glMultiTexCoord2s != NULL) glad_glMultiTexCoord2s = profile_glMultiTexCoord2s;
+	real_glMultiTexCoord2sv = glad_glMultiTexCoord2sv;
+	if(real_glMultiTexCoord2sv != NULL) glad_glMultiTexCoord2sv = profile_glMultiTexCoord2sv;
+	real_glMultiTexCoord3d = glad_glMultiTexCoord3d;
+	if(real_glMultiTexCoord3d != NULL) glad_glMultiTexCoord3d = profile_glMultiTexCoord3d;
+	real_glMultiTexCoord3dv = glad_glMultiTexCoord3dv;
+	if(real_glMultiTexCoord3dv != NULL) glad_glMultiTexCoord3dv = profile_glMultiTexCoord3dv;
+	real_glMultiTexCoord3f = glad_glMultiTexCoord3f;
+	if(real_glMultiTexCoord3f != NULL) glad_glMultiTexCoord3f = profile_glMultiTexCoord3f;
+	real_glMultiTexCoord3fv = glad_glMultiTexCoord3fv;
+	if(real_glMultiTexCoord3fv != NULL) glad_glMultiTexCoord3fv = profile_glMultiTexCoord3fv;
+	real_glMultiTexCoord3i = glad_glMultiTexCoord3i;
+	if(real_glMultiTexCoord3i != NULL) glad_glMultiTexCoord3i = profile_glMultiTexCoord3i;
+	real_glMultiTexCoord3iv = glad_glMultiTexCoord3iv;
+	if(real_glMultiTexCoord3iv != NULL) glad_glMultiTexCoord3iv = profile_glMultiTexCoord3iv;
+	real_glMultiTexCoord3s = glad_glMultiTexCoord3s;
+	if(real_glMultiTexCoord3s != NULL) glad_glMultiTexCoord3s = profile_glMultiTexCoord3s;
+	real_glMultiTexCoord3sv = glad_glMultiTexCoord3sv;
+	if(real_glMultiTexCoord3sv != NULL) glad_glMultiTexCoord3sv = profile_glMultiTexCoord3sv;
+	real_glMultiTexCoord4d = glad_glMultiTexCoord4d;
+	if(real_glMultiTexCoord4d != NULL) glad_glMultiTexCoord4d = profile_glMultiTexCoord4d;
+	real_glMultiTexCoord4dv = glad_glMultiTexCoord4dv;
+	if(real_glMultiTexCoord4dv != NULL) glad_glMultiTexCoord4dv = profile_glMultiTexCoord4dv;
+	real_glMultiTexCoord4f = glad_glMultiTexCoord4f;
+	if(real_glMultiTexCoord4f != NULL) glad_glMultiTexCoord4f = profile_glMultiTexCoord4f;
+	real_glMultiTexCoord4fv = glad_glMultiTexCoord4fv;
+	if(real_glMultiTexCoord4fv != NULL) glad_glMultiTexCoord4fv = profile_glMultiTexCoord4fv;
+	real_glMultiTexCoord4i = glad_glMultiTexCoord4i;
+	if(real_glMultiTexCoord4i != NULL) glad_glMultiTexCoord4i = profile_glMultiTexCoord4i;
+	real_glMultiTexCoord4iv = glad_glMultiTexCoord4iv;
+	if(real_glMultiTexCoord4iv != NULL) glad_glMultiTexCoord4iv = profile_glMultiTexCoord4iv;
+	real_glMultiTexCoord4s = glad_glMultiTexCoord4s;
+	if(real_glMultiTexCoord4s != NULL) glad_glMultiTexCoord4s = profile_glMultiTexCoord4s;
+	real_glMultiTexCoord4sv = glad_glMultiTexCoord4sv;
+	if(real_glMultiTexCoord4sv != NULL) glad_glMultiTexCoord4sv = profile_glMultiTexCoord4sv;
+	real_glLoadTransposeMatrixf = glad_glLoadTransposeMatrixf;
+	if(real_glLoadTransposeMatrixf != NULL) glad_glLoadTransposeMatrixf = profile_glLoadTransposeMatrixf;
+	real_glLoadTransposeMatrixd = glad_glLoadTransposeMatrixd;
+	if(real_glLoadTransposeMatrixd != NULL) glad_glLoadTransposeMatrixd = profile_glLoadTransposeMatrixd;
+	real_glMultTransposeMatrixf = glad_glMultTransposeMatrixf;
+	if(real_glMultTransposeMatrixf != NULL) glad_glMultTransposeMatrixf = profile_glMultTransposeMatrixf;
+	real_glMultTransposeMatrixd = glad_glMultTransposeMatrixd;
+	if(real_glMultTransposeMatrixd != NULL) glad_glMultTransposeMatrixd = profile_glMultTransposeMatrixd;
+	real_glBlendFuncSeparate = glad_glBlendFuncSeparate;
+	if(real_glBlendFuncSeparate != NULL) glad_glBlendFuncSeparate = profile_glBlendFuncSeparate;
+	real_glMultiDrawArrays = glad_glMultiDrawArrays;
+	if(real_glMultiDrawArrays != NULL) glad_glMultiDrawArrays = profile_glMultiDrawArrays;
+	real_glMultiDrawElements = glad_glMultiDrawElements;
+	if(real_glMultiDrawElements != NULL) glad_glMultiDrawElements = profile_glMultiDrawElements;
+	real_glPointParameterf = glad_glPointParameterf;
+	if(real_glPointParameterf != NULL) glad_glPointParameterf = profile_glPointParameterf;
+	real_glPointParameterfv = glad_glPointParameterfv;
+	if(real_glPointParameterfv != NULL) glad_glPointParameterfv = profile_glPointParameterfv;
+	real_glPointParameteri = glad_glPointParameteri;
+	if(real_glPointParameteri != NULL) glad_glPointParameteri = profile_glPointParameteri;
+	real_glPointParameteriv = glad_glPointParameteriv;
+	if(real_glPointParameteriv != NULL) glad_glPointParameteriv = profile_glPointParameteriv;
+	real_glFogCoordf = glad_glFogCoordf;
+	if(real_glFogCoordf != NULL) glad_glFogCoordf = profile_glFogCoordf;
+	real_glFogCoordfv = glad_glFogCoordfv;
+	if(real_glFogCoordfv != NULL) glad_glFogCoordfv = profile_glFogCoordfv;
+	real_glFogCoordd = glad_glFogCoordd;
+	if(real_glFogCoordd != NULL) glad_glFogCoordd = profile_glFogCoordd;
+	real_glFogCoorddv = glad_glFogCoorddv;
+	if(real_glFogCoorddv != NULL) glad_glFogCoorddv = profile_glFogCoorddv;
+	real_glFogCoordPointer = glad_glFogCoordPointer;
+	if(real_glFogCoordPointer != NULL) glad_glFogCoordPointer = profile_glFogCoordPointer;
+	real_glSecondaryColor3b = glad_glSecondaryColor3b;
+	if(real_glSecondaryColor3b != NULL) glad_glSecondaryColor3b = profile_glSecondaryColor3b;
+	real_glSecondaryColor3bv = glad_glSecondaryColor3bv;
+	if(real_glSecondaryColor3bv != NULL) glad_glSecondaryColor3bv = profile_glSecondaryColor3bv;
+	real_glSecondaryColor3d = glad_glSecondaryColor3d;
+	if(real_glSecondaryColor3d != NULL) glad_glSecondaryColor3d = profile_glSecondaryColor3d;
+	real_glSecondaryColor3dv = glad_glSecondaryColor3dv;
+	if(real_glSecondaryColor3dv != NULL) glad_glSecondaryColor3dv = profile_glSecondaryColor3dv;
+	real_glSecondaryColor3f = glad_glSecondaryColor3f;
+	if(real_glSecondaryColor3f != NULL) glad_glSecondaryColor3f = profile_glSecondaryColor3f;
+	real_glSecondaryColor3fv = glad_glSecondaryColor3fv;
+	if(real_glSecondaryColor3fv != NULL) glad_glSecondaryColor3fv = profile_glSecondaryColor3fv;
+	real_glSecondaryColor3i = glad_glSecondaryColor3i;
+	if(real_glSecondaryColor3i != NULL) glad_glSecondaryColor3i = profile_glSecondaryColor3i;
+	real_glSecondaryColor3iv = glad_glSecondaryColor3iv;
+	if(real_glSecondaryColor3iv != NULL) glad_glSecondaryColor3iv = profile_glSecondaryColor3iv;
+	real_glSecondaryColor3s = glad_glSecondaryColor3s;
+	if(real_glSecondaryColor3s != NULL) glad_glSecondaryColor3s = profile_glSecondaryColor3s;
+	real_glSecondaryColor3sv = glad_glSecondaryColor3sv;
+	if(real_glSecondaryColor3sv != NULL) glad_glSecondaryColor3sv = profile_glSecondaryColor3sv;
+	real_glSecondaryColor3ub = glad_glSecondaryColor3ub;
+	if(real_glSecondaryColor3ub != NULL) glad_glSecondaryColor3ub = profile_glSecondaryColor3ub;
+	real_glSecondaryColor3ubv = glad_glSecondaryColor3ubv;
+	if(real_glSecondaryColor3ubv != NULL) glad_glSecondaryColor3ubv = profile_glSecondaryColor3ubv;
+	real_glSecondaryColor3ui = glad_glSecondaryColor3ui;
+	if(real_glSecondaryColor3ui != NULL) glad_glSecondaryColor3ui = profile_glSecondaryColor3ui;
+	real_glSecondaryColor3uiv = glad_glSecondaryColor3uiv;
+	if(real_glSecondaryColor3uiv != NULL) glad_glSecondaryColor3uiv = profile_glSecondaryColor3uiv;
+	real_glSecondaryColor3us = glad_glSecondaryColor3us;
+	if(real_glSecondaryColor3us != NULL) glad_glSecondaryColor3us = profile_glSecondaryColor3us;
+	real_glSecondaryColor3usv = glad_glSecondaryColor3usv;
+	if(real_glSecondaryColor3usv != NULL) glad_glSecondaryColor3usv = profile_glSecondaryColor3usv;
+	real_glSecondaryColorPointer = glad_glSecondaryColorPointer;
+	if(real_glSecondaryColorPointer != NULL) glad_glSecondaryColorPointer = profile_glSecondaryColorPointer;
+	real_glWindowPos2d = glad_glWindowPos2d;
+	if(real_glWindowPos2d != NULL) glad_glWindowPos2d = profile_glWindowPos2d;
+	real_glWindowPos2dv = glad_glWindowPos2dv;
+	if(real_glWindowPos2dv != NULL) glad_glWindowPos2dv = profile_glWindowPos2dv;
+	real_glWindowPos2f = glad_glWindowPos2f;
+	if(real_glWindowPos2f != NULL) glad_glWindowPos2f = profile_glWindowPos2f;
+	real_glWindowPos2fv = glad_glWindowPos2fv;
+	if(real_glWindowPos2fv != NULL) glad_glWindowPos2fv = profile_glWindowPos2fv;
+	real_glWindowPos2i = glad_glWindowPos2i;
+	if(real_glWindowPos2i != NULL) glad_glWindowPos2i = profile_glWindowPos2i;
+	real_glWindowPos2iv = glad_glWindowPos2iv;
+	if(real_glWindowPos2iv != NULL) glad_glWindowPos2iv = profile_glWindowPos2iv;
+	real_glWindowPos2s = glad_glWindowPos2s;
+	if(real_glWindowPos2s != NULL) glad_glWindowPos2s = profile_glWindowPos2s;
+	real_glWindowPos2sv = glad_glWindowPos2sv;
+	if(real_glWindowPos2sv != NULL) glad_glWindowPos2sv = profile_glWindowPos2sv;
+	real_glWindowPos3d = glad_glWindowPos3d;
+	if(real_glWindowPos3d != NULL) glad_glWindowPos3d = profile_glWindowPos3d;
+	real_glWindowPos3dv = glad_glWindowPos3dv;
+	if(real_glWindowPos3dv != NULL) glad_glWindowPos3dv = profile_glWindowPos3dv;
+	real_glWindowPos3f = glad_glWindowPos3f;
+	if(real_glWindowPos3f != NULL) glad_glWindowPos3f = profile_glWindowPos3f;
+	real_glWindowPos3fv = glad_glWindowPos3fv;
+	if(real_glWindowPos3fv != NULL) glad_glWindowPos3fv = profile_glWindowPos3fv;
+	real_glWindowPos3i = glad_glWindowPos3i;
+	if(real_glWindowPos3i != NULL) glad_glWindowPos3i = profile_glWindowPos3i;
+	real_glWindowPos3iv = glad_glWindowPos3iv;
+	if(real_glWindowPos3iv != NULL) glad_glWindowPos3iv = profile_glWindowPos3iv;
+	real_glWindowPos3s = glad_glWindowPos3s;
+	if(real_glWindowPos3s != NULL) glad_glWindowPos3s = profile_glWindowPos3s;
+	real_glWindowPos3sv = glad_glWindowPos3sv;
+	if(real_glWindowPos3sv != NULL) glad_glWindowPos3sv = profile_glWindowPos3sv;
+	real_glBlendColor = glad_glBlendColor;
+	if(real_glBlendColor != NULL) glad_glBlendColor = profile_glBlendColor;
+	real_glBlendEquation = glad_glBlendEquation;
+	if(real_glBlendEquation != NULL) glad_glBlendEquation = profile_glBlendEquation;
+	real_glGenQueries = glad_glGenQueries;
+	if(real_glGenQueries != NULL) glad_glGenQueries = profile_glGenQueries;
+	real_glDeleteQueries = glad_glDeleteQueries;
+	if(real_glDeleteQueries != NULL) glad_glDeleteQueries = profile_glDeleteQueries;
+	real_glIsQuery = glad_glIsQuery;
+	if(real_glIsQuery != NULL) glad_glIsQuery = profile_glIsQuery;
+	real_glBeginQuery = glad_glBeginQuery;
+	if(real_glBeginQuery != NULL) glad_glBeginQuery = profile_glBeginQuery;
+	real_glEndQuery = glad_glEndQuery;
+	if(real_glEndQuery != NULL) glad_glEndQuery = profile_glEndQuery;
+	real_glGetQueryiv = glad_glGetQueryiv;
+	if(real_glGetQueryiv != NULL) glad_glGetQueryiv = profile_glGetQueryiv;
+	real_glGetQueryObjectiv = glad_glGetQueryObjectiv;
+	if(real_glGetQueryObjectiv != NULL) glad_glGetQueryObjectiv = profile_glGetQueryObjectiv;
+	real_glGetQueryObjectuiv = glad_glGetQueryObjectuiv;
+	if(real_glGetQueryObjectuiv != NULL) glad_glGetQueryObjectuiv = profile_glGetQueryObjectuiv;
+	real_glBindBuffer = glad_glBindBuffer;
+	if(real_glBindBuffer != NULL) glad_glBindBuffer = profile_glBindBuffer;
+	real_glDeleteBuffers = glad_glDeleteBuffers;
+	if(real_glDeleteBuffers != NULL) glad_glDeleteBuffers = profile_glDeleteBuffers;
+	real_glGenBuffers = glad_glGenBuffers;
+	if(real_glGenBuffers != NULL) glad_glGenBuffers = profile_glGenBuffers;
+	real_glIsBuffer = glad_glIsBuffer;
+	if(real_glIsBuffer != NULL) glad_glIsBuffer = profile_glIsBuffer;
+	real_glBufferData = glad_glBufferData;
+	if(real_glBufferData != NULL) glad_glBufferData = profile_glBufferData;
+	real_glBufferSubData = glad_glBufferSubData;
+	if(real_glBufferSubData != NULL) glad_glBufferSubData = profile_glBufferSubData;
+	real_glGetBufferSubData = glad_glGetBufferSubData;
+	if(real_glGetBufferSubData != NULL) glad_glGetBufferSubData = profile_glGetBufferSubData;
+	real_glMapBuffer = glad_glMapBuffer;
+	if(real_glMapBuffer != NULL) glad_glMapBuffer = profile_glMapBuffer;
+	real_glUnmapBuffer = glad_glUnmapBuffer;
+	if(real_glUnmapBuffer != NULL) glad_glUnmapBuffer = profile_glUnmapBuffer;
+	real_glGetBufferParameteriv = glad_glGetBufferParameteriv;
+	if(real_glGetBufferParameteriv != NULL) glad_glGetBufferParameteriv = profile_glGetBufferParameteriv;
+	real_glGetBufferPointerv = glad_glGetBufferPointerv;
+	if(real_glGetBufferPointerv != NULL) glad_glGetBufferPointerv = profile_glGetBufferPointerv;
+	real_glBlendEquationSeparate = glad_glBlendEquationSeparate;
+	if(real_glBlendEquationSeparate != NULL) glad_glBlendEquationSeparate = profile_glBlendEquationSeparate;
+	real_glDrawBuffers = glad_glDrawBuffers;
+	if(real_glDrawBuffers != NULL) glad_glDrawBuffers = profile_glDrawBuffers;
+	real_glStencilOpSeparate = glad_glStencilOpSeparate;
+	if(real_glStencilOpSeparate != NULL) glad_glStencilOpSeparate = profile_glStencilOpSeparate;
+	real_glStencilFuncSeparate = glad_glStencilFuncSeparate;
+	if(real_glStencilFuncSeparate != NULL) glad_glStencilFuncSeparate = profile_glStencilFuncSeparate;
+	real_glStencilMaskSeparate = glad_glStencilMaskSeparate;
+	if(real_glStencilMaskSeparate != NULL) glad_glStencilMaskSeparate = profile_glStencilMaskSeparate;
+	real_glAttachShader = glad_glAttachShader;
+	if(real_glAttachShader != NULL) glad_glAttachShader = profile_glAttachShader;
+	real_glBindAttribLocation = glad_glBindAttribLocation;
+	if(real_glBindAttribLocation != NULL) glad_glBindAttribLocation = profile_glBindAttribLocation;
+	real_glCompileShader = glad_glCompileShader;
+	if(real_glCompileShader != NULL) glad_glCompileShader = profile_glCompileShader;
+	real_glCreateProgram = glad_glCreateProgram;
+	if(real_glCreateProgram != NULL) glad_glCreateProgram = profile_glCreateProgram;
+	real_glCreateShader = glad_glCreateShader;
+	if(real_glCreateShader != NULL) glad_glCreateShader = profile_glCreateShader;
+	real_glDeleteProgram = glad_glDeleteProgram;
+	if(real_glDeleteProgram != NULL) glad_glDeleteProgram = profile_glDeleteProgram;
+	real_glDeleteShader = glad_glDeleteShader;
+	if(real_glDeleteShader != NULL) glad_glDeleteShader = profile_glDeleteShader;
+	real_glDetachShader = glad_glDetachShader;
+	if(real_glDetachShader != NULL) glad_glDetachShader = profile_glDetachShader;
+	real_glDisableVertexAttribArray = glad_glDisableVertexAttribArray;
+	if(real_glDisableVertexAttribArray != NULL) glad_glDisableVertexAttribArray = profile_glDisableVertexAttribArray;
+	real_glEnableVertexAttribArray = glad_glEnableVertexAttribArray;
+	if(real_glEnableVertexAttribArray != NULL) glad_glEnableVertexAttribArray = profile_glEnableVertexAttribArray;
+	real_glGetActiveAttrib = glad_glGetActiveAttrib;
+	if(real_glGetActiveAttrib != NULL) glad_glGetActiveAttrib = profile_glGetActiveAttrib;
+	real_glGetActiveUniform = glad_glGetActiveUniform;
+	if(real_glGetActiveUniform != NULL) glad_glGetActiveUniform = profile_glGetActiveUniform;
+	real_glGetAttachedShaders = glad_glGetAttachedShaders;
+	if(real_glGetAttachedShaders != NULL) glad_glGetAttachedShaders = profile_glGetAttachedShaders;
+	real_glGetAttribLocation = glad_glGetAttribLocation;
+	if(real_glGetAttribLocation != NULL) glad_glGetAttribLocation = profile_glGetAttribLocation;
+	real_glGetProgramiv = glad_glGetProgramiv;
+	if(real_glGetProgramiv != NULL) glad_glGetProgramiv = profile_glGetProgramiv;
+	real_glGetProgramInfoLog = glad_glGetProgramInfoLog;
+	if(real_glGetProgramInfoLog != NULL) glad_glGetProgramInfoLog = profile_glGetProgramInfoLog;
+	real_glGetShaderiv = glad_glGetShaderiv;
+	if(real_glGetShaderiv != NULL) glad_glGetShaderiv = profile_glGetShaderiv;
+	real_glGetShaderInfoLog = glad_glGetShaderInfoLog;
+	if(real_glGetShaderInfoLog != NULL) glad_glGetShaderInfoLog = profile_glGetShaderInfoLog;
+	real_glGetShaderSource = glad_glGetShaderSource;
+	if(real_glGetShaderSource != NULL) glad_glGetShaderSource = profile_glGetShaderSource;
+	real_glGetUniformLocation = glad_glGetUniformLocation;
+	if(real_glGetUniformLocation != NULL) glad_glGetUniformLocation = profile_glGetUniformLocation;
+	real_glGetUniformfv = glad_glGetUniformfv;
+	if(real_glGetUniformfv != NULL) glad_glGetUniformfv = profile_glGetUniformfv;
+	real_glGetUniformiv = glad_glGetUniformiv;
+	if(real_glGetUniformiv != NULL) glad_glGetUniformiv = profile_glGetUniformiv;
+	real_glGetVertexAttribdv = glad_glGetVertexAttribdv;
+	if(real_glGetVertexAttribdv != NULL) glad_glGetVertexAttribdv = profile_glGetVertexAttribdv;
+	real_glGetVertexAttribfv = glad_glGetVertexAttribfv;
+	if(real_glGetVertexAttribfv != NULL) glad_glGetVertexAttribfv = profile_glGetVertexAttribfv;
+	real_glGetVertexAttribiv = glad_glGetVertexAttribiv;
+	if(real_glGetVertexAttribiv != NULL) glad_glGetVertexAttribiv = profile_glGetVertexAttribiv;
+	real_glGetVertexAttribPointerv = glad_glGetVertexAttribPointerv;
+	if(real_glGetVertexAttribPointerv != NULL) glad_glGetVertexAttribPointerv = profile_glGetVertexAttribPointerv;
+	real_glIsProgram = glad_glIsProgram;
+	if(real_glIsProgram != NULL) glad_glIsProgram = profile_glIsProgram;
+	real_glIsShader = glad_glIsShader;
+	if(real_glIsShader != NULL) glad_glIsShader = profile_glIsShader;
+	real_glLinkProgram = glad_glLinkProgram;
+	if(real_glLinkProgram != NULL) glad_glLinkProgram = profile_glLinkProgram;
+	real_glShaderSource = glad_glShaderSource;
+	if(real_glShaderSource != NULL) glad_glShaderSource = profile_glShaderSource;
+	real_glUseProgram = glad_glUseProgram;
+	if(real_glUseProgram != NULL) glad_glUseProgram = profile_glUseProgram;
+	real_glUniform1f = glad_glUniform1f;
+	if(real_glUniform1f != NULL) glad_glUniform1f = profile_glUniform1f;
+	real_glUniform2f = glad_glUniform2f;
+	if(real_glUniform2f != NULL) glad_glUniform2f = profile_glUniform2f;
+	real_glUniform3f = glad_glUniform3f;
+	if(real_glUniform3f != NULL) glad_glUniform3f = profile_glUniform3f;
+	real_glUniform4f = glad_glUniform4f;
+	if(real_glUniform4f != NULL) glad_glUniform4f = profile_glUniform4f;
+	real_glUniform1i = glad_glUniform1i;
+	if(real_glUniform1i != NULL) glad_glUniform1i = profile_glUniform1i;
+	real_glUniform2i = glad_glUniform2i;
+	if(real_glUniform2i != NULL) glad_glUniform2i = profile_glUniform2i;
+	real_glUniform3i = glad_glUniform3i;
+	if(real_glUniform3i != NULL) glad_glUniform3i = profile_glUniform3i;
+	real_glUniform4i = glad_glUniform4i;
+	if(real_glUniform4i != NULL) glad_glUniform4i = profile_glUniform4i;
+	real_glUniform1fv = glad_glUniform1fv;
+	if(real_glUniform1fv != NULL) glad_glUniform1fv = profile_glUniform1fv;
+	real_glUniform2fv = glad_glUniform2fv;
+	if(real_glUniform2fv != NULL) glad_glUniform2fv = profile_glUniform2fv;
+	real_glUniform3fv = glad_glUniform3fv;
+	if(real_glUniform3fv != NULL) glad_glUniform3fv = profile_glUniform3fv;
+	real_glUniform4fv = glad_glUniform4fv;
+	if(real_glUniform4fv != NULL) glad_glUniform4fv = profile_glUniform4fv;
+	real_glUniform1iv = glad_glUniform1iv;
+	if(real_glUniform1iv != NULL) glad_glUniform1iv = profile_glUniform1iv;
+	real_glUniform2iv = glad_glUniform2iv;
+	if(real_glUniform2iv != NULL) glad_glUniform2iv = profile_glUniform2iv;
+	real_glUniform3iv = glad_glUniform3iv;
+	if(real_glUniform3iv != NULL) glad_glUniform3iv = profile_glUniform3iv;
+	real_glUniform4iv = glad_glUniform4iv;
+	if(real_glUniform4iv != NULL) glad_glUniform4iv = profile_glUniform4iv;
+	real_glUniformMatrix2fv = glad_glUniformMatrix2fv;
+	if(real_glUniformMatrix2fv != NULL) glad_glUniformMatrix2fv = profile_glUniformMatrix2fv;
+	real_glUniformMatrix3fv = glad_glUniformMatrix3fv;
+	if(real_glUniformMatrix3fv != NULL) glad_glUniformMatrix3fv = profile_glUniformMatrix3fv;
+	real_glUniformMatrix4fv = glad_glUniformMatrix4fv;
+	if(real_glUniformMatrix4fv != NULL) glad_glUniformMatrix4fv = profile_glUniformMatrix4fv;
+	real_glValidateProgram = glad_glValidateProgram;
+	if(real_glValidateProgram != NULL) glad_glValidateProgram = profile_glValidateProgram;
+	real_glVertexAttrib1d = glad_glVertexAttrib1d;
+	if(real_glVertexAttrib1d != NULL) glad_glVertexAttrib1d = profile_glVertexAttrib1d;
+	real_glVertexAttrib1dv = glad_glVertexAttrib1dv;
+	if(real_glVertexAttrib1dv != NULL) glad_glVertexAttrib1dv = profile_glVertexAttrib1dv;
+	real_glVertexAttrib1f = glad_glVertexAttrib1f;
+	if(real_glVertexAttrib1f != NULL) glad_glVertexAttrib1f = profile_glVertexAttrib1f;
+	real_glVertexAttrib1fv = glad_glVertexAttrib1fv;
+	if(real_glVertexAttrib1fv != NULL) glad_glVertexAttrib1fv = profile_glVertexAttrib1fv;
+	real_glVertexAttrib1s = glad_glVertexAttrib1s;
+	if(real_glVertexAttrib1s != NULL) glad_glVertexAttrib1s = profile_glVertexAttrib1s;
+	real_glVertexAttrib1sv = glad_glVertexAttrib1sv;
+	if(real_glVertexAttrib1sv != NULL) glad_glVertexAttrib1sv = profile_glVertexAttrib1sv;
+	real_glVertexAttrib2d = glad_glVertexAttrib2d;
+	if(real_glVertexAttrib2d != NULL) glad_glVertexAttrib2d = profile_glVertexAttrib2d;
+	real_glVertexAttrib2dv = glad_glVertexAttrib2dv;
+	if(real_glVertexAttrib2dv != NULL) glad_glVertexAttrib2dv = profile_glVertexAttrib2dv;
+	real_glVertexAttrib2f = glad_glVertexAttrib2f;
+	if(real_glVertexAttrib2f != NULL) glad_glVertexAttrib2f = profile_glVertexAttrib2f;
+	real_glVertexAttrib2fv = glad_glVertexAttrib2fv;
+	if(real_glVertexAttrib2fv != NULL) glad_glVertexAttrib2fv = profile_glVertexAttrib2fv;
+	real_glVertexAttrib2s = glad_glVertexAttrib2s;
+	if(real_glVertexAttrib2s != NULL) glad_glVertexAttrib2s = profile_glVertexAttrib2s;
+	real_glVertexAttrib2sv = glad_glVertexAttrib2sv;
+	if(real_glVertexAttrib2sv != NULL) glad_glVertexAttrib2sv = profile_glVertexAttrib2sv;
+	real_glVertexAttrib3d = glad_glVertexAttrib3d;
+	if(real_glVertexAttrib3d != NULL) glad_glVertexAttrib3d = profile_glVertexAttrib3d;
+	real_glVertexAttrib3dv = glad_glVertexAttrib3dv;
+	if(real_glVertexAttrib3dv != NULL) glad_glVertexAttrib3dv = profile_glVertexAttrib3dv;
+	real_glVertexAttrib3f = glad_glVertexAttrib3f;
+	if(real_glVertexAttrib3f != NULL) glad_glVertexAttrib3f = profile_glVertexAttrib3f;
+	real_glVertexAttrib3fv = glad_glVertexAttrib3fv;
+	if(real_glVertexAttrib3fv != NULL) glad_glVertexAttrib3fv = profile_glVertexAttrib3fv;
+	real_glVertexAttrib3s = glad_glVertexAttrib3s;
+	if(real_glVertexAttrib3s != NULL) glad_glVertexAttrib3s = profile_glVertexAttrib3s;
+	real_glVertexAttrib3sv = glad_glVertexAttrib3sv;
+	if(real_glVertexAttrib3sv != NULL) glad_glVertexAttrib3sv = profile_glVertexAttrib3sv;
+	real_glVertexAttrib4Nbv = glad_glVertexAttrib4Nbv;
+	if(real_glVertexAttrib4Nbv != NULL) glad_glVertexAttrib4Nbv = profile_glVertexAttrib4Nbv;
+	real_glVertexAttrib4Niv = glad_glVertexAttrib4Niv;
+	if(real_glVertexAttrib4Niv != NULL) glad_glVertexAttrib4Niv = profile_glVertexAttrib4Niv;
+	real_glVertexAttrib4Nsv = glad_glVertexAttrib4Nsv;
+	if(real_glVertexAttrib4Nsv != NULL) glad_glVertexAttrib4Nsv = profile_glVertexAttrib4Nsv;
+	real_glVertexAttrib4Nub = glad_glVertexAttrib4Nub;
+	if(real_glVertexAttrib4Nub != NULL) glad_glVertexAttrib4Nub = profile_glVertexAttrib4Nub;
+	real_glVertexAttrib4Nubv = glad_glVertexAttrib4Nubv;
+	if(real_glVertexAttrib4Nubv != NULL) glad_glVertexAttrib4Nubv = profile_glVertexAttrib4Nubv;
+	real_glVertexAttrib4Nuiv = glad_glVertexAttrib4Nuiv;
+	if(real_glVertexAttrib4Nuiv != NULL) glad_glVertexAttrib4Nuiv = profile_glVertexAttrib4Nuiv;
+	real_glVertexAttrib4Nusv = glad_glVertexAttrib4Nusv;
+	if(real_glVertexAttrib4Nusv != NULL) glad_glVertexAttrib4Nusv = profile_glVertexAttrib4Nusv;
+	real_glVertexAttrib4bv = glad_glVertexAttrib4bv;
+	if(real_glVertexAttrib4bv != NULL) glad_glVertexAttrib4bv = profile_glVertexAttrib4bv;
+	real_glVertexAttrib4d = glad_glVertexAttrib4d;
+	if(real_glVertexAttrib4d != NULL) glad_glVertexAttrib4d = profile_glVertexAttrib4d;
+	real_glVertexAttrib4dv = glad_glVertexAttrib4dv;
+	if(real_glVertexAttrib4dv != NULL) glad_glVertexAttrib4dv = profile_glVertexAttrib4dv;
+	real_glVertexAttrib4f = glad_glVertexAttrib4f;
+	if(real_glVertexAttrib4f != NULL) glad_glVertexAttrib4f = profile_glVertexAttrib4f;
+	real_glVertexAttrib4fv = glad_glVertexAttrib4fv;
+	if(real_glVertexAttrib4fv != NULL) glad_glVertexAttrib4fv = profile_glVertexAttrib4fv;
+	real_glVertexAttrib4iv = glad_glVertexAttrib4iv;
+	if(real_glVertexAttrib4iv != NULL) glad_glVertexAttrib4iv = profile_glVertexAttrib4iv;
+	real_glVertexAttrib4s = glad_glVertexAttrib4s;
+	if(real_glVertexAttrib4s != NULL) glad_glVertexAttrib4s = profile_glVertexAttrib4s;
+	real_glVertexAttrib4sv = glad_glVertexAttrib4sv;
+	if(real_glVertexAttrib4sv != NULL) glad_glVertexAttrib4sv = profile_glVertexAttrib4sv;
+	real_glVertexAttrib4ubv = glad_glVertexAttrib4ubv;
+	if(real_glVertexAttrib4ubv != NULL) glad_glVertexAttrib4ubv = profile_glVertexAttrib4ubv;
+	real_glVertexAttrib4uiv = glad_glVertexAttrib4uiv;
+	if(real_glVertexAttrib4uiv != NULL) glad_glVertexAttrib4uiv = profile_glVertexAttrib4uiv;
+	real_glVertexAttrib4usv = glad_glVertexAttrib4usv;
+	if(real_glVertexAttrib4usv != NULL) glad_glVertexAttrib4usv = profile_glVertexAttrib4usv;
+	real_glVertexAttribPointer = glad_glVertexAttribPointer;
+	if(real_glVertexAttribPointer != NULL) glad_glVertexAttribPointer = profile_glVertexAttribPointer;
+	real_glUniformMatrix2x3fv = glad_glUniformMatrix2x3fv;
+	if(real_glUniformMatrix2x3fv != NULL) glad_glUniformMatrix2x3fv = profile_glUniformMatrix2x3fv;
+	real_glUniformMatrix3x2fv = glad_glUniformMatrix3x2fv;
+	if(real_glUniformMatrix3x2fv != NULL) glad_glUniformMatrix3x2fv = profile_glUniformMatrix3x2fv;
+	real_glUniformMatrix2x4fv = glad_glUniformMatrix2x4fv;
+	if(real_glUniformMatrix2x4fv != NULL) glad_glUniformMatrix2x4fv = profile_glUniformMatrix2x4fv;
+	real_glUniformMatrix4x2fv = glad_glUniformMatrix4x2fv;
+	if(real_glUniformMatrix4x2fv != NULL) glad_glUniformMatrix4x2fv = profile_glUniformMatrix4x2fv;
+	real_glUniformMatrix3x4fv = glad_glUniformMatrix3x4fv;
+	if(real_glUniformMatrix3x4fv != NULL) glad_glUniformMatrix3x4fv = profile_glUniformMatrix3x4fv;
+	real_glUniformMatrix4x3fv = glad_glUniformMatrix4x3fv;
+	if(real_glUniformMatrix4x3fv != NULL) glad_glUniformMatrix4x3fv = profile_glUniformMatrix4x3fv;
+	real_glColorMaski = glad_glColorMaski;
+	if(real_glColorMaski != NULL) glad_glColorMaski = profile_glColorMaski;
+	real_glGetBooleani_v = glad_glGetBooleani_v;
+	if(real_glGetBooleani_v != NULL) glad_glGetBooleani_v = profile_glGetBooleani_v;
+	real_glGetIntegeri_v = glad_glGetIntegeri_v;
+	if(real_glGetIntegeri_v != NULL) glad_glGetIntegeri_v = profile_glGetIntegeri_v;
+	real_glEnablei = glad_glEnablei;
+	if(real_glEnablei != NULL) glad_glEnablei = profile_glEnablei;
+	real_glDisablei = glad_glDisablei;
+	if(real_glDisablei != NULL) glad_glDisablei = profile_glDisablei;
+	real_glIsEnabledi = glad_glIsEnabledi;
+	if(real_glIsEnabledi != NULL) glad_glIsEnabledi = profile_glIsEnabledi;
+	real_glBeginTransformFeedback = glad_glBeginTransformFeedback;
+	if(real_glBeginTransformFeedback != NULL) glad_glBeginTransformFeedback = profile_glBeginTransformFeedback;
+	real_glEndTransformFeedback = glad_glEndTransformFeedback;
+	if(real_glEndTransformFeedback != NULL) glad_glEndTransformFeedback = profile_glEndTransformFeedback;
+	real_glBindBufferRange = glad_glBindBufferRange;
+	if(real_glBindBufferRange != NULL) glad_glBindBufferRange = profile_glBindBufferRange;
+	real_glBindBufferBase = glad_glBindBufferBase;
+	if(real_glBindBufferBase != NULL) glad_glBindBufferBase = profile_glBindBufferBase;
+	real_glTransformFeedbackVaryings = glad_glTransformFeedbackVaryings;
+	if(real_glTransformFeedbackVaryings != NULL) glad_glTransformFeedbackVaryings = profile_glTransformFeedbackVaryings;
+	real_glGetTransformFeedbackVarying = glad_glGetTransformFeedbackVarying;
+	if(real_glGetTransformFeedbackVarying != NULL) glad_glGetTransformFeedbackVarying = profile_glGetTransformFeedbackVarying;
+	real_glClampColor = glad_glClampColor;
+	if(real_glClampColor != NULL) glad_glClampColor = profile_glClampColor;
+	real_glBeginConditionalRender = glad_glBeginConditionalRender;
+	if(real_glBeginConditionalRender != NULL) glad_glBeginConditionalRender = profile_glBeginConditionalRender;
+	real_glEndConditionalRender = glad_glEndConditionalRender;
+	if(real_glEndConditionalRender != NULL) glad_glEndConditionalRender = profile_glEndConditionalRender;
+	real_glVertexAttribIPointer = glad_glVertexAttribIPointer;
+	if(real_glVertexAttribIPointer != NULL) glad_glVertexAttribIPointer = profile_glVertexAttribIPointer;
+	real_glGetVertexAttribIiv = glad_glGetVertexAttribIiv;
+	if(real_glGetVertexAttribIiv != NULL) glad_glGetVertexAttribIiv = profile_glGetVertexAttribIiv;
+	real_glGetVertexAttribIuiv = glad_glGetVertexAttribIuiv;
+	if(real_glGetVertexAttribIuiv != NULL) glad_glGetVertexAttribIuiv = profile_glGetVertexAttribIuiv;
+	real_glVertexAttribI1i = glad_glVertexAttribI1i;
+	if(real_glVertexAttribI1i != NULL) glad_glVertexAttribI1i = profile_glVertexAttribI1i;
+	real_glVertexAttribI2i = glad_glVertexAttribI2i;
+	if(real_glVertexAttribI2i != NULL) glad_glVertexAttribI2i = profile_glVertexAttribI2i;
+	real_glVertexAttribI3i = glad_glVertexAttribI3i;
+	if(real_glVertexAttribI3i != NULL) glad_glVertexAttribI3i = profile_glVertexAttribI3i;
+	real_glVertexAttribI4i = glad_glVertexAttribI4i;
+	if(real_glVertexAttribI4i != NULL) glad_glVertexAttribI4i = profile_glVertexAttribI4i;
+	real_glVertexAttribI1ui = glad_glVertexAttribI1ui;
+	if(real_glVertexAttribI1ui != NULL) glad_glVertexAttribI1ui = profile_glVertexAttribI1ui;
+	real_glVertexAttribI2ui = glad_glVertexAttribI2ui;
+	if(real_glVertexAttribI2ui != NULL) glad_glVertexAttribI2ui = profile_glVertexAttribI2ui;
+	real_glVertexAttribI3ui = glad_glVertexAttribI3ui;
+	if(real_glVertexAttribI3ui != NULL) glad_glVertexAttribI3ui = profile_glVertexAttribI3ui;
+	real_glVertexAttribI4ui = glad_glVertexAttribI4ui;
+	if(real_glVertexAttribI4ui != NULL) glad_glVertexAttribI4ui = profile_glVertexAttribI4ui;
+	real_glVertexAttribI1iv = glad_glVertexAttribI1iv;
+	if(real_glVertexAttribI1iv != NULL) glad_glVertexAttribI1iv = profile_glVertexAttribI1iv;
+	real_glVertexAttribI2iv = glad_glVertexAttribI2iv;
+	if(real_glVertexAttribI2iv != NULL) glad_glVertexAttribI2iv = profile_glVertexAttribI2iv;
+	real_glVertexAttribI3iv = glad_glVertexAttribI3iv;
+	if(real_glVertexAttribI3iv != NULL) glad_glVertexAttribI3iv = profile_glVertexAttribI3iv;
+	real_glVertexAttribI4iv = glad_glVertexAttribI4iv;
+	if(real_glVertexAttribI4iv != NULL) glad_glVertexAttribI4iv = profile_glVertexAttribI4iv;
+	real_glVertexAttribI1uiv = glad_glVertexAttribI1uiv;
+	if(real_glVertexAttribI1uiv != NULL) glad_glVertexAttribI1uiv = profile_glVertexAttribI1uiv;
+	real_glVertexAttribI2uiv = glad_glVertexAttribI2uiv;
+	if(real_glVertexAttribI2uiv != NULL) glad_glVertexAttribI2uiv = profile_glVertexAttribI2uiv;
+	real_glVertexAttribI3uiv = glad_glVertexAttribI3uiv;
+	if(real_glVertexAttribI3uiv != NULL) glad_glVertexAttribI3uiv = profile_glVertexAttribI3uiv;
+	real_glVertexAttribI4uiv = glad_glVertexAttribI4uiv;
+	if(real_glVertexAttribI4uiv != NULL) glad_glVertexAttribI4uiv = profile_glVertexAttribI4uiv;
+	real_glVertexAttribI4bv = glad_glVertexAttribI4bv;
+	if(real_glVertexAttribI4bv != NULL) glad_glVertexAttribI4bv = profile_glVertexAttribI4bv;
+	real_glVertexAttribI4sv = glad_glVertexAttribI4sv;
+	if(real_glVertexAttribI4sv != NULL) glad_glVertexAttribI4sv = profile_glVertexAttribI4sv;
+	real_glVertexAttribI4ubv = glad_glVertexAttribI4ubv;
+	if(real_glVertexAttribI4ubv != NULL) glad_glVertexAttribI4ubv = profile_glVertexAttribI4ubv;
+	real_glVertexAttribI4usv = glad_glVertexAttribI4usv;
+	if(real_glVertexAttribI4usv != NULL) glad_glVertexAttribI4usv = profile_glVertexAttribI4usv;
+	real_glGetUniformuiv = glad_glGetUniformuiv;
+	if(real_glGetUniformuiv != NULL) glad_glGetUniformuiv = profile_glGetUniformuiv;
+	real_glBindFragDataLocation = glad_glBindFragDataLocation;
+	if(real_glBindFragDataLocation != NULL) glad_glBindFragDataLocation = profile_glBindFragDataLocation;
+	real_glGetFragDataLocation = glad_glGetFragDataLocation;
+	if(real_glGetFragDataLocation != NULL) glad_glGetFragDataLocation = profile_glGetFragDataLocation;
+	real_glUniform1ui = glad_glUniform1ui;
+	if(real_glUniform1ui != NULL) glad_glUniform1ui = profile_glUniform1ui;
+	real_glUniform2ui = glad_glUniform2ui;
+	if(real_glUniform2ui != NULL) glad_glUniform2ui = profile_glUniform2ui;
+	real_glUniform3ui = glad_glUniform3ui;
+	if(real_glUniform3ui != NULL) glad_glUniform3ui = profile_glUniform3ui;
+	real_glUniform4ui = glad_glUniform4ui;
+	if(real_glUniform4ui != NULL) glad_glUniform4ui = profile_glUniform4ui;
+	real_glUniform1uiv = glad_glUniform1uiv;
+	if(real_glUniform1uiv != NULL) glad_glUniform1uiv = profile_glUniform1uiv;
+	real_glUniform2uiv = glad_glUniform2uiv;
+	if(real_glUniform2uiv != NULL) glad_glUniform2uiv = profile_glUniform2uiv;
+	real_glUniform3uiv = glad_glUniform3uiv;
+	if(real_glUniform3uiv != NULL) glad_glUniform3uiv = profile_glUniform3uiv;
+	real_glUniform4uiv = glad_glUniform4uiv;
+	if(real_glUniform4uiv != NULL) glad_glUniform4uiv = profile_glUniform4uiv;
+	real_glTexParameterIiv = glad_glTexParameterIiv;
+	if(real_glTexParameterIiv != NULL) glad_glTexParameterIiv = profile_glTexParameterIiv;
+	real_glTexParameterIuiv = glad_glTexParameterIuiv;
+	if(real_glTexParameterIuiv != NULL) glad_glTexParameterIuiv = profile_glTexParameterIuiv;
+	real_glGetTexParameterIiv = glad_glGetTexParameterIiv;
+	if(real_glGetTexParameterIiv != NULL) glad_glGetTexParameterIiv = profile_glGetTexParameterIiv;
+	real_glGetTexParameterIuiv = glad_glGetTexParameterIuiv;
+	if(real_glGetTexParameterIuiv != NULL) glad_glGetTexParameterIuiv = profile_glGetTexParameterIuiv;
+	real_glClearBufferiv = glad_glClearBufferiv;
+	if(real_glClearBufferiv != NULL) glad_glClearBufferiv = profile_glClearBufferiv;
+	real_glClearBufferuiv = glad_glClearBufferuiv;
+	if(real_glClearBufferuiv != NULL) glad_glClearBufferuiv = profile_glClearBufferuiv;
+	real_glClearBufferfv = glad_glClearBufferfv;
+	if(real_glClearBufferfv != NULL) glad_glClearBufferfv = profile_glClearBufferfv;
+	real_glClearBufferfi = glad_glClearBufferfi;
+	if(real_glClearBufferfi != NULL) glad_glClearBufferfi = profile_glClearBufferfi;
+	real_glGetStringi = glad_glGetStringi;
+	if(real_glGetStringi != NULL) glad_glGetStringi = profile_glGetStringi;
+	real_glIsRenderbuffer = glad_glIsRenderbuffer;
+	if(real_glIsRenderbuffer != NULL) glad_glIsRenderbuffer = profile_glIsRenderbuffer;
+	real_glBindRenderbuffer = glad_glBindRenderbuffer;
+	if(real_glBindRenderbuffer != NULL) glad_glBindRenderbuffer = profile_glBindRenderbuffer;
+	real_glDeleteRenderbuffers = glad_glDeleteRenderbuffers;
+	if(real_glDeleteRenderbuffers != NULL) glad_glDeleteRenderbuffers = profile_glDeleteRenderbuffers;
+	real_glGenRenderbuffers = glad_glGenRenderbuffers;
+	if(real_glGenRenderbuffers != NULL) glad_glGenRenderbuffers = profile_glGenRenderbuffers;
+	real_glRenderbufferStorage = glad_glRenderbufferStorage;
+	if(real_glRenderbufferStorage != NULL) glad_glRenderbufferStorage = profile_glRenderbufferStorage;
+	real_glGetRenderbufferParameteriv = glad_glGetRenderbufferParameteriv;
+	if(real_glGetRenderbufferParameteriv != NULL) glad_glGetRenderbufferParameteriv = profile_glGetRenderbufferParameteriv;
+	real_glIsFramebuffer = glad_glIsFramebuffer;
+	if(real_glIsFramebuffer != NULL) glad_glIsFramebuffer = profile_glIsFramebuffer;
+	real_glBindFramebuffer = glad_glBindFramebuffer;
+	if(real_glBindFramebuffer != NULL) glad_glBindFramebuffer = profile_glBindFramebuffer;
+	real_glDeleteFramebuffers = glad_glDeleteFramebuffers;
+	if(real_glDeleteFramebuffers != NULL) glad_glDeleteFramebuffers = profile_glDeleteFramebuffers;
+	real_glGenFramebuffers = glad_glGenFramebuffers;
+	if(real_glGenFramebuffers != NULL) glad_glGenFramebuffers = profile_glGenFramebuffers;
+	real_glCheckFramebufferStatus = glad_glCheckFramebufferStatus;
+	if(real_glCheckFramebufferStatus != NULL) glad_glCheckFramebufferStatus = profile_glCheckFramebufferStatus;
+	real_glFramebufferTexture1D = glad_glFramebufferTexture1D;
+	if(real_glFramebufferTexture1D != NULL) glad_glFramebufferTexture1D = profile_glFramebufferTexture1D;
+	real_glFramebufferTexture2D = glad_glFramebufferTexture2D;
+	if(real_glFramebufferTexture2D != NULL) glad_glFramebufferTexture2D = profile_glFramebufferTexture2D;
+	real_glFramebufferTexture3D = glad_glFramebufferTexture3D;
+	if(real_glFramebufferTexture3D != NULL) glad_glFramebufferTexture3D = profile_glFramebufferTexture3D;
+	real_glFramebufferRenderbuffer = glad_glFramebufferRenderbuffer;
+	if(real_glFramebufferRenderbuffer != NULL) glad_glFramebufferRenderbuffer = profile_glFramebufferRenderbuffer;
+	real_glGetFramebufferAttachmentParameteriv = glad_glGetFramebufferAttachmentParameteriv;
+	if(real_glGetFramebufferAttachmentParameteriv != NULL) glad_glGetFramebufferAttachmentParameteriv = profile_glGetFramebufferAttachmentParameteriv;
+	real_glGenerateMipmap = glad_glGenerateMipmap;
+	if(real_glGenerateMipmap != NULL) glad_glGenerateMipmap = profile_glGenerateMipmap;
+	real_glBlitFramebuffer = glad_glBlitFramebuffer;
+	if(real_glBlitFramebuffer != NULL) glad_glBlitFramebuffer = profile_glBlitFramebuffer;
+	real_glRenderbufferStorageMultisample = glad_glRenderbufferStorageMultisample;
+	if(real_glRenderbufferStorageMultisample != NULL) glad_glRenderbufferStorageMultisample = profile_glRenderbufferStorageMultisample;
+	real_glFramebufferTextureLayer = glad_glFramebufferTextureLayer;
+	if(real_glFramebufferTextureLayer != NULL) glad_glFramebufferTextureLayer = profile_glFramebufferTextureLayer;
+	real_glMapBufferRange = glad_glMapBufferRange;
+	if(real_glMapBufferRange != NULL) glad_glMapBufferRange = profile_glMapBufferRange;
+	real_glFlushMappedBufferRange = glad_glFlushMappedBufferRange;
+	if(real_glFlushMappedBufferRange != NULL) glad_glFlushMappedBufferRange = profile_glFlushMappedBufferRange;
+	real_glBindVertexArray = glad_glBindVertexArray;
+	if(real_glBindVertexArray != NULL) glad_glBindVertexArray = profile_glBindVertexArray;
+	real_glDeleteVertexArrays = glad_glDeleteVertexArrays;
+	if(real_glDeleteVertexArrays != NULL) glad_glDeleteVertexArrays = profile_glDeleteVertexArrays;
+	real_glGenVertexArrays = glad_glGenVertexArrays;
+	if(real_glGenVertexArrays != NULL) glad_glGenVertexArrays = profile_glGenVertexArrays;
+	real_glIsVertexArray = glad_glIsVertexArray;
+	if(real_glIsVertexArray != NULL) glad_glIsVertexArray = profile_glIsVertexArray;
+	real_glDrawArraysInstanced = glad_glDrawArraysInstanced;
+	if(real_glDrawArraysInstanced != NULL) glad_glDrawArraysInstanced = profile_glDrawArraysInstanced;
+	real_glDrawElementsInstanced = glad_glDrawElementsInstanced;
+	if(real_glDrawElementsInstanced != NULL) glad_glDrawElementsInstanced = profile_glDrawElementsInstanced;
+	real_glTexBuffer = glad_glTexBuffer;
+	if(real_glTexBuffer != NULL) glad_glTexBuffer = profile_glTexBuffer;
+	real_glPrimitiveRestartIndex = glad_glPrimitiveRestartIndex;
+	if(real_glPrimitiveRestartIndex != NULL) glad_glPrimitiveRestartIndex = profile_glPrimitiveRestartIndex;
+	real_glCopyBufferSubData = glad_glCopyBufferSubData;
+	if(real_glCopyBufferSubData != NULL) glad_glCopyBufferSubData = profile_glCopyBufferSubData;
+	real_glGetUniformIndices = glad_glGetUniformIndices;
+	if(real_glGetUniformIndices != NULL) glad_glGetUniformIndices = profile_glGetUniformIndices;
+	real_glGetActiveUniformsiv = glad_glGetActiveUniformsiv;
+	if(real_glGetActiveUniformsiv != NULL) glad_glGetActiveUniformsiv = profile_glGetActiveUniformsiv;
+	real_glGetActiveUniformName = glad_glGetActiveUniformName;
+	if(real_glGetActiveUniformName != NULL) glad_glGetActiveUniformName = profile_glGetActiveUniformName;
+	real_glGetUniformBlockIndex = glad_glGetUniformBlockIndex;
+	if(real_glGetUniformBlockIndex != NULL) glad_glGetUniformBlockIndex = profile_glGetUniformBlockIndex;
+	real_glGetActiveUniformBlockiv = glad_glGetActiveUniformBlockiv;
+	if(real_glGetActiveUniformBlockiv != NULL) glad_glGetActiveUniformBlockiv = profile_glGetActiveUniformBlockiv;
+	real_glGetActiveUniformBlockName = glad_glGetActiveUniformBlockName;
+	if(real_glGetActiveUniformBlockName != NULL) glad_glGetActiveUniformBlockName = profile_glGetActiveUniformBlockName;
+	real_glUniformBlockBinding = glad_glUniformBlockBinding;
+	if(real_glUniformBlockBinding != NULL) glad_glUniformBlockBinding = profile_glUniformBlockBinding;
+	real_glDrawElementsBaseVertex = glad_glDrawElementsBaseVertex;
+	if(real_glDrawElementsBaseVertex != NULL) glad_glDrawElementsBaseVertex = profile_glDrawElementsBaseVertex;
+	real_glDrawRangeElementsBaseVertex = glad_glDrawRangeElementsBaseVertex;
+	if(real_glDrawRangeElementsBaseVertex != NULL) glad_glDrawRangeElementsBaseVertex = profile_glDrawRangeElementsBaseVertex;
+	real_glDrawElementsInstancedBaseVertex = glad_glDrawElementsInstancedBaseVertex;
+	if(real_glDrawElementsInstancedBaseVertex != NULL) glad_glDrawElementsInstancedBaseVertex = profile_glDrawElementsInstancedBaseVertex;
+	real_glMultiDrawElementsBaseVertex = glad_glMultiDrawElementsBaseVertex;
+	if(real_glMultiDrawElementsBaseVertex != NULL) glad_glMultiDrawElementsBaseVertex = profile_glMultiDrawElementsBaseVertex;
+	real_glProvokingVertex = glad_glProvokingVertex;
+	if(real_glProvokingVertex != NULL) glad_glProvokingVertex = profile_glProvokingVertex;
+	real_glFenceSync = glad_glFenceSync;
+	if(real_glFenceSync != NULL) glad_glFenceSync = profile_glFenceSync;
+	real_glIsSync = glad_glIsSync;
+	if(real_glIsSync != NULL) glad_glIsSync = profile_glIsSync;
+	real_glDeleteSync = glad_glDeleteSync;
+	if(real_glDeleteSync != NULL) glad_glDeleteSync = profile_glDeleteSync;
+	real_glClientWaitSync = glad_glClientWaitSync;
+	if(real_glClientWaitSync != NULL) glad_glClientWaitSync = profile_glClientWaitSync;
+	real_glWaitSync = glad_glWaitSync;
+	if(real_glWaitSync != NULL) glad_glWaitSync = profile_glWaitSync;
+	real_glGetInteger64v = glad_glGetInteger64v;
+	if(real_glGetInteger64v != NULL) glad_glGetInteger64v = profile_glGetInteger64v;
+	real_glGetSynciv = glad_glGetSynciv;
+	if(real_glGetSynciv != NULL) glad_glGetSynciv = profile_glGetSynciv;
+	real_glGetInteger64i_v = glad_glGetInteger64i_v;
+	if(real_glGetInteger64i_v != NULL) glad_glGetInteger64i_v = profile_glGetInteger64i_v;
+	real_glGetBufferParameteri64v = glad_glGetBufferParameteri64v;
+	if(real_glGetBufferParameteri64v != NULL) glad_glGetBufferParameteri64v = profile_glGetBufferParameteri64v;
+	real_glFramebufferTexture = glad_glFramebufferTexture;
+	if(real_glFramebufferTexture != NULL) glad_glFramebufferTexture = profile_glFramebufferTexture;
+	real_glTexImage2DMultisample = glad_glTexImage2DMultisample;
+	if(real_glTexImage2DMultisample != NULL) glad_glTexImage2DMultisample = profile_glTexImage2DMultisample;
+	real_glTexImage3DMultisample = glad_glTexImage3DMultisample;
+	if(real_glTexImage3DMultisample != NULL) glad_glTexImage3DMultisample = profile_glTexImage3DMultisample;
+	real_glGetMultisamplefv = glad_glGetMultisamplefv;
+	if(real_glGetMultisamplefv != NULL) glad_glGetMultisamplefv = profile_glGetMultisamplefv;
+	real_glSampleMaski = glad_glSampleMaski;
+	if(real_glSampleMaski != NULL) glad_glSampleMaski = profile_glSampleMaski;
+	real_glBindFragDataLocationIndexed = glad_glBindFragDataLocationIndexed;
+	if(real_glBindFragDataLocationIndexed != NULL) glad_glBindFragDataLocationIndexed = profile_glBindFragDataLocationIndexed;
+	real_glGetFragDataIndex = glad_glGetFragDataIndex;
+	if(real_glGetFragDataIndex != NULL) glad_glGetFragDataIndex = profile_glGetFragDataIndex;
+	real_glGenSamplers = glad_glGenSamplers;
+	if(real_glGenSamplers != NULL) glad_glGenSamplers = profile_glGenSamplers;
+	real_glDeleteSamplers = glad_glDeleteSamplers;
+	if(real_glDeleteSamplers != NULL) glad_glDeleteSamplers = profile_glDeleteSamplers;
+	real_glIsSampler = glad_glIsSampler;
+	if(real_glIsSampler != NULL) glad_glIsSampler = profile_glIsSampler;
+	real_glBindSampler = glad_glBindSampler;
+	if(real_glBindSampler != NULL) glad_glBindSampler = profile_glBindSampler;
+	real_glSamplerParameteri = glad_glSamplerParameteri;
+	if(real_glSamplerParameteri != NULL) glad_glSamplerParameteri = profile_glSamplerParameteri;
+	real_glSamplerParameteriv = glad_glSamplerParameteriv;
+	if(real_glSamplerParameteriv != NULL) glad_glSamplerParameteriv = profile_glSamplerParameteriv;
+	real_glSamplerParameterf = glad_glSamplerParameterf;
+	if(real_glSamplerParameterf != NULL) glad_glSamplerParameterf = profile_glSamplerParameterf;
+	real_glSamplerParameterfv = glad_glSamplerParameterfv;
+	if(real_glSamplerParameterfv != NULL) glad_glSamplerParameterfv = profile_glSamplerParameterfv;
+	real_glSamplerParameterIiv = glad_glSamplerParameterIiv;
+	if(real_glSamplerParameterIiv != NULL) glad_glSamplerParameterIiv = profile_glSamplerParameterIiv;
+	real_glSamplerParameterIuiv = glad_glSamplerParameterIuiv;
+	if(real_glSamplerParameterIuiv != NULL) glad_glSamplerParameterIuiv = profile_glSamplerParameterIuiv;
+	real_glGetSamplerParameteriv = glad_glGetSamplerParameteriv;
+	if(real_glGetSamplerParameteriv != NULL) glad_glGetSamplerParameteriv = profile_glGetSamplerParameteriv;
+	real_glGetSamplerParameterIiv = glad_glGetSamplerParameterIiv;
+	if(real_glGetSamplerParameterIiv != NULL) glad_glGetSamplerParameterIiv = profile_glGetSamplerParameterIiv;
+	real_glGetSamplerParameterfv = glad_glGetSamplerParameterfv;
+	if(real_glGetSamplerParameterfv != NULL) glad_glGetSamplerParameterfv = profile_glGetSamplerParameterfv;
+	real_glGetSamplerParameterIuiv = glad_glGetSamplerParameterIuiv;
+	if(real_glGetSamplerParameterIuiv != NULL) glad_glGetSamplerParameterIuiv = profile_glGetSamplerParameterIuiv;
+	real_glQueryCounter = glad_glQueryCounter;
+	if(real_glQueryCounter != NULL) glad_glQueryCounter = profile_glQueryCounter;
+	real_glGetQueryObjecti64v = glad_glGetQueryObjecti64v;
+	if(real_glGetQueryObjecti64v != NULL) glad_glGetQueryObjecti64v = profile_glGetQueryObjecti64v;
+	real_glGetQueryObjectui64v = glad_glGetQueryObjectui64v;
+	if(real_glGetQueryObjectui64v != NULL) glad_glGetQueryObjectui64v = profile_glGetQueryObjectui64v;
+	real_glVertexAttribDivisor = glad_glVertexAttribDivisor;
+	if(real_glVertexAttribDivisor != NULL) glad_glVertexAttribDivisor = profile_glVertexAttribDivisor;
+	real_glVertexAttribP1ui = glad_glVertexAttribP1ui;
+	if(real_glVertexAttribP1ui != NULL) glad_glVertexAttribP1ui = profile_glVertexAttribP1ui;
+	real_glVertexAttribP1uiv = glad_glVertexAttribP1uiv;
+	if(real_glVertexAttribP1uiv != NULL) glad_glVertexAttribP1uiv = profile_glVertexAttribP1uiv;
+	real_glVertexAttribP2ui = glad_glVertexAttribP2ui;
+	if(real_glVertexAttribP2ui != NULL) glad_glVertexAttribP2ui = profile_glVertexAttribP2ui;
+	real_glVertexAttribP2uiv = glad_glVertexAttribP2uiv;
+	if(real_glVertexAttribP2uiv != NULL) glad_glVertexAttribP2uiv = profile_glVertexAttribP2uiv;
+	real_glVertexAttribP3ui = glad_glVertexAttribP3ui;
+	if(real_glVertexAttribP3ui != NULL) glad_glVertexAttribP3ui = profile_glVertexAttribP3ui;
+	real_glVertexAttribP3uiv = glad_glVertexAttribP3uiv;
+	if(real_glVertexAttribP3uiv != NULL) glad_glVertexAttribP3uiv = profile_glVertexAttribP3uiv;
+	real_glVertexAttribP4ui = glad_glVertexAttribP4ui;
+	if(real_glVertexAttribP4ui != NULL) glad_glVertexAttribP4ui = profile_glVertexAttribP4ui;
+	real_glVertexAttribP4uiv = glad_glVertexAttribP4uiv;
+	if(real_glVertexAttribP4uiv != NULL) glad_glVertexAttribP4uiv = profile_glVertexAttribP4uiv;
+	real_glVertexP2ui = glad_glVertexP2ui;
+	if(real_glVertexP2ui != NULL) glad_glVertexP2ui = profile_glVertexP2ui;
+	real_glVertexP2uiv = glad_glVertexP2uiv;
+	if(real_glVertexP2uiv != NULL) glad_glVertexP2uiv = profile_glVertexP2uiv;
+	real_glVertexP3ui = glad_glVertexP3ui;
+	if(real_glVertexP3ui != NULL) glad_glVertexP3ui = profile_glVertexP3ui;
+	real_glVertexP3uiv = glad_glVertexP3uiv;
+	if(real_glVertexP3uiv != NULL) glad_glVertexP3uiv = profile_glVertexP3uiv;
+	real_glVertexP4ui = glad_glVertexP4ui;
+	if(real_glVertexP4ui != NULL) glad_glVertexP4ui = profile_glVertexP4ui;
+	real_glVertexP4uiv = glad_glVertexP4uiv;
+	if(real_glVertexP4uiv != NULL) glad_glVertexP4uiv = profile_glVertexP4uiv;
+	real_glTexCoordP1ui = glad_glTexCoordP1ui;
+	if(real_glTexCoordP1ui != NULL) glad_glTexCoordP1ui = profile_glTexCoordP1ui;
+	real_glTexCoordP1uiv = glad_glTexCoordP1uiv;
+	if(real_glTexCoordP1uiv != NULL) glad_glTexCoordP1uiv = profile_glTexCoordP1uiv;
+	real_glTexCoordP2ui = glad_glTexCoordP2ui;
+	if(real_glTexCoordP2ui != NULL) glad_glTexCoordP2ui = profile_glTexCoordP2ui;
+	real_glTexCoordP2uiv = glad_glTexCoordP2uiv;
+	if(real_glTexCoordP2uiv != NULL) glad_glTexCoordP2uiv = profile_glTexCoordP2uiv;
+	real_glTexCoordP3ui = glad_glTexCoordP3ui;
+	if(real_glTexCoordP3ui != NULL) glad_glTexCoordP3ui = profile_glTexCoordP3ui;
+	real_glTexCoordP3uiv = glad_glTexCoordP3uiv;
+	if(real_glTexCoordP3uiv != NULL) glad_glTexCoordP3uiv = profile_glTexCoordP3uiv;
+	real_glTexCoordP4ui = glad_glTexCoordP4ui;
+	if(real_glTexCoordP4ui != NULL) glad_glTexCoordP4ui = profile_glTexCoordP4ui;
+	real_glTexCoordP4uiv = glad_glTexCoordP4uiv;
+	if(real_glTexCoordP4uiv != NULL) glad_glTexCoordP4uiv = profile_glTexCoordP4uiv;
+	real_glMultiTexCoordP1ui = glad_glMultiTexCoordP1ui;
+	if(real_glMultiTexCoordP1ui != NULL) glad_glMultiTexCoordP1ui = profile_glMultiTexCoordP1ui;
+	real_glMultiTexCoordP1uiv = glad_glMultiTexCoordP1uiv;
+	if(real_glMultiTexCoordP1uiv != NULL) glad_glMultiTexCoordP1uiv = profile_glMultiTexCoordP1uiv;
+	real_glMultiTexCoordP2ui = glad_glMultiTexCoordP2ui;
+	if(real_glMultiTexCoordP2ui != NULL) glad_glMultiTexCoordP2ui = profile_glMultiTexCoordP2ui;
+	real_glMultiTexCoordP2uiv = glad_glMultiTexCoordP2uiv;
+	if(real_glMultiTexCoordP2uiv != NULL) glad_glMultiTexCoordP2uiv = profile_glMultiTexCoordP2uiv;
+	real_glMultiTexCoordP3ui = glad_glMultiTexCoordP3ui;
+	if(real_glMultiTexCoordP3ui != NULL) glad_glMultiTexCoordP3ui = profile_glMultiTexCoordP3ui;
+	real_glMultiTexCoordP3uiv = glad_glMultiTexCoordP3uiv;
+	if(real_glMultiTexCoordP3uiv != NULL) glad_glMultiTexCoordP3uiv = profile_glMultiTexCoordP3uiv;
+	real_glMultiTexCoordP4ui = glad_glMultiTexCoordP4ui;
+	if(real_glMultiTexCoordP4ui != NULL) glad_glMultiTexCoordP4ui = profile_glMultiTexCoordP4ui;
+	real_glMultiTexCoordP4uiv = glad_glMultiTexCoordP4uiv;
+	if(real_glMultiTexCoordP4uiv != NULL) glad_glMultiTexCoordP4uiv = profile_glMultiTexCoordP4uiv;
+	real_glNormalP3ui = glad_glNormalP3ui;
+	if(real_glNormalP3ui != NULL) glad_glNormalP3ui = profile_glNormalP3ui;
+	real_glNormalP3uiv = glad_glNormalP3uiv;
+	if(real_glNormalP3uiv != NULL) glad_glNormalP3uiv = profile_glNormalP3uiv;
+	real_glColorP3ui = glad_glColorP3ui;
+	if(real_glColorP3ui != NULL) glad_glColorP3ui = profile_glColorP3ui;
+	real_glColorP3uiv = glad_glColorP3uiv;
+	if(real_glColorP3uiv != NULL) glad_glColorP3uiv = profile_glColorP3uiv;
+	real_glColorP4ui = glad_glColorP4ui;
+	if(real_glColorP4ui != NULL) glad_glColorP4ui = profile_glColorP4ui;
+	real_glColorP4uiv = glad_glColorP4uiv;
+	if(real_glColorP4uiv != NULL) glad_glColorP4uiv = profile_glColorP4uiv;
+	real_glSecondaryColorP3ui = glad_glSecondaryColorP3ui;
+	if(real_glSecondaryColorP3ui != NULL) glad_glSecondaryColorP3ui = profile_glSecondaryColorP3ui;
+	real_glSecondaryColorP3uiv = glad_glSecondaryColorP3uiv;
+	if(real_glSecondaryColorP3uiv != NULL) glad_glSecondaryColorP3uiv = profile_glSecondaryColorP3uiv;
+	real_glBufferStorage = glad_glBufferStorage;
+	if(real_glBufferStorage != NULL) glad_glBufferStorage = profile_glBufferStorage;
+	real_glDebugMessageControlARB = glad_glDebugMessageControlARB;
+	if(real_glDebugMessageControlARB != NULL) glad_glDebugMessageControlARB = profile_glDebugMessageControlARB;
+	real_glDebugMessageInsertARB = glad_glDebugMessageInsertARB;
+	if(real_glDebugMessageInsertARB != NULL) glad_glDebugMessageInsertARB = profile_glDebugMessageInsertARB;
+	real_glDebugMessageCallbackARB = glad_glDebugMessageCallbackARB;
+	if(real_glDebugMessageCallbackARB != NULL) glad_glDebugMessageCallbackARB = profile_glDebugMessageCallbackARB;
+	real_glGetDebugMessageLogARB = glad_glGetDebugMessageLogARB;
+	if(real_glGetDebugMessageLogARB != NULL) glad_glGetDebugMessageLogARB = profile_glGetDebugMessageLogARB;
+	real_glGetProgramBinary = glad_glGetProgramBinary;
+	if(real_glGetProgramBinary != NULL) glad_glGetProgramBinary = profile_glGetProgramBinary;
+	real_glProgramBinary = glad_glProgramBinary;
+	if(real_glProgramBinary != NULL) glad_glProgramBinary = profile_glProgramBinary;
+	real_glProgramParameteri = glad_glProgramParameteri;
+	if(real_glProgramParameteri != NULL) glad_glProgramParameteri = profile_glProgramParameteri;
+	real_glMaxShaderCompilerThreadsARB = glad_glMaxShaderCompilerThreadsARB;
+	if(real_glMaxShaderCompilerThreadsARB != NULL) glad_glMaxShaderCompilerThreadsARB = profile_glMaxShaderCompilerThreadsARB;
+	real_glDebugMessageControl = glad_glDebugMessageControl;
+	if(real_glDebugMessageControl != NULL) glad_glDebugMessageControl = profile_glDebugMessageControl;
+	real_glDebugMessageInsert = glad_glDebugMessageInsert;
+	if(real_glDebugMessageInsert != NULL) glad_glDebugMessageInsert = profile_glDebugMessageInsert;
+	real_glDebugMessageCallback = glad_glDebugMessageCallback;
+	if(real_glDebugMessageCallback != NULL) glad_glDebugMessageCallback = profile_glDebugMessageCallback;
+	real_glGetDebugMessageLog = glad_glGetDebugMessageLog;
+	if(real_glGetDebugMessageLog != NULL) glad_glGetDebugMessageLog = profile_glGetDebugMessageLog;
+	real_glPushDebugGroup = glad_glPushDebugGroup;
+	if(real_glPushDebugGroup != NULL) glad_glPushDebugGroup = profile_glPushDebugGroup;
+	real_glPopDebugGroup = glad_glPopDebugGroup;
+	if(real_glPopDebugGroup != NULL) glad_glPopDebugGroup = profile_glPopDebugGroup;
+	real_glObjectLabel = glad_glObjectLabel;
+	if(real_glObjectLabel != NULL) glad_glObjectLabel = profile_glObjectLabel;
+	real_glGetObjectLabel = glad_glGetObjectLabel;
+	if(real_glGetObjectLabel != NULL) glad_glGetObjectLabel = profile_glGetObjectLabel;
+	real_glObjectPtrLabel = glad_glObjectPtrLabel;
+	if(real_glObjectPtrLabel != NULL) glad_glObjectPtrLabel = profile_glObjectPtrLabel;
+	real_glGetObjectPtrLabel = glad_glGetObjectPtrLabel;
+	if(real_glGetObjectPtrLabel != NULL) glad_glGetObjectPtrLabel = profile_glGetObjectPtrLabel;
+	real_glMaxShaderCompilerThreadsKHR = glad_glMaxShaderCompilerThreadsKHR;
+	if(real_glMaxShaderCompilerThreadsKHR != NULL) glad_glMaxShaderCompilerThreadsKHR = profile_glMaxShaderCompilerThreadsKHR;
+	profile_enabled = 1;
+	return 1;
+}
+
+void gladProfileDisable(void) {
+	if(!profile_enabled) return;
+	if(glad_glCullFace == profile_glCullFace) glad_glCullFace = real_glCullFace;
+	if(glad_glFrontFace == profile_glFrontFace) glad_glFrontFace = real_glFrontFace;
+	if(glad_glHint == profile_glHint) glad_glHint = real_glHint;
+	if(glad_glLineWidth == profile_glLineWidth) glad_glLineWidth = real_glLineWidth;
+	if(glad_glPointSize == profile_glPointSize) glad_glPointSize = real_glPointSize;
+	if(glad_glPolygonMode == profile_glPolygonMode) glad_glPolygonMode = real_glPolygonMode;
+	if(glad_glScissor == profile_glScissor) glad_glScissor = real_glScissor;
+	if(glad_glTexParameterf == profile_glTexParameterf) glad_glTexParameterf = real_glTexParameterf;
+	if(glad_glTexParameterfv == profile_glTexParameterfv) glad_glTexParameterfv = real_glTexParameterfv;
+	if(glad_glTexParameteri == profile_glTexParameteri) glad_glTexParameteri = real_glTexParameteri;
+	if(glad_glTexParameteriv == profile_glTexParameteriv) glad_glTexParameteriv = real_glTexParameteriv;
+	if(glad_glTexImage1D == profile_glTexImage1D) glad_glTexImage1D = real_glTexImage1D;
+	if(glad_glTexImage2D == profile_glTexImage2D) glad_glTexImage2D = real_glTexImage2D;
+	if(glad_glDrawBuffer == profile_glDrawBuffer) glad_glDrawBuffer = real_glDrawBuffer;
+	if(glad_glClear == profile_glClear) glad_glClear = real_glClear;
+	if(glad_glClearColor == profile_glClearColor) glad_glClearColor = real_glClearColor;
+	if(glad_glClearStencil == profile_glClearStencil) glad_glClearStencil = real_glClearStencil;
+	if(glad_glClearDepth == profile_glClearDepth) glad_glClearDepth = real_glClearDepth;
+	if(glad_glStencilMask == profile_glStencilMask) glad_glStencilMask = real_glStencilMask;
+	if(glad_glColorMask == profile_glColorMask) glad_glColorMask = real_glColorMask;
+	if(glad_glDepthMask == profile_glDepthMask) glad_glDepthMask = real_glDepthMask;
+	if(glad_glDisable == profile_glDisable) glad_glDisable = real_glDisable;
+	if(glad_glEnable == profile_glEnable) glad_glEnable = real_glEnable;
+	if(glad_glFinish == profile_glFinish) glad_glFinish = real_glFinish;
+	if(glad_glFlush == profile_glFlush) glad_glFlush = real_glFlush;
+	if(glad_glBlendFunc == profile_glBlendFunc) glad_glBlendFunc = real_glBlendFunc;
+	if(glad_glLogicOp == profile_glLogicOp) glad_glLogicOp = real_glLogicOp;
+	if(glad_glStencilFunc == profile_glStencilFunc) glad_glStencilFunc = real_glStencilFunc;
+	if(glad_glStencilOp == profile_glStencilOp) glad_glStencilOp = real_glStencilOp;
+	if(glad_glDepthFunc == profile_glDepthFunc) glad_glDepthFunc = real_glDepthFunc;
+	if(glad_glPixelStoref == profile_glPixelStoref) glad_glPixelStoref = real_glPixelStoref;
+	if(glad_glPixelStorei == profile_glPixelStorei) glad_glPixelStorei = real_glPixelStorei;
+	if(glad_glReadBuffer == profile_glReadBuffer) glad_glReadBuffer = real_glReadBuffer;
+	if(glad_glReadPixels == profile_glReadPixels) glad_glReadPixels = real_glReadPixels;
+	if(glad_glGetBooleanv == profile_glGetBooleanv) glad_glGetBooleanv = real_glGetBooleanv;
+	if(glad_glGetDoublev == profile_glGetDoublev) glad_glGetDoublev = real_glGetDoublev;
+	if(glad_glGetError == profile_glGetError) glad_glGetError = real_glGetError;
+	if(glad_glGetFloatv == profile_glGetFloatv) glad_glGetFloatv = real_glGetFloatv;
+	if(glad_glGetIntegerv == profile_glGetIntegerv) glad_glGetIntegerv = real_glGetIntegerv;
+	if(glad_glGetString == profile_glGetString) glad_glGetString = real_glGetString;
+	if(glad_glGetTexImage == profile_glGetTexImage) glad_glGetTexImage = real_glGetTexImage;
+	if(glad_glGetTexParameterfv == profile_glGetTexParameterfv) glad_glGetTexParameterfv = real_glGetTexParameterfv;
+	if(glad_glGetTexParameteriv == profile_glGetTexParameteriv) glad_glGetTexParameteriv = real_glGetTexParameteriv;
+	if(glad_glGetTexLevelParameterfv == profile_glGetTexLevelParameterfv) glad_glGetTexLevelParameterfv = real_glGetTexLevelParameterfv;
+	if(glad_glGetTexLevelParameteriv == profile_glGetTexLevelParameteriv) glad_glGetTexLevelParameteriv = real_glGetTexLevelParameteriv;
+	if(glad_glIsEnabled == profile_glIsEnabled) glad_glIsEnabled = real_glIsEnabled;
+	if(glad_glDepthRange == profile_glDepthRange) glad_glDepthRange = real_glDepthRange;
+	if(glad_glViewport == profile_glViewport) glad_glViewport = real_glViewport;
+	if(glad_glNewList == profile_glNewList) glad_glNewList = real_glNewList;
+	if(glad_glEndList == profile_glEndList) glad_glEndList = real_glEndList;
+	if(glad_glCallList == profile_glCallList) glad_glCallList = real_glCallList;
+	if(glad_glCallLists == profile_glCallLists) glad_glCallLists = real_glCallLists;
+	if(glad_glDeleteLists == profile_glDeleteLists) glad_glDeleteLists = real_glDeleteLists;
+	if(glad_glGenLists == profile_glGenLists) glad_glGenLists = real_glGenLists;
+	if(glad_glListBase == profile_glListBase) glad_glListBase = real_glListBase;
+	if(glad_glBegin == profile_glBegin) glad_glBegin = real_glBegin;
+	if(glad_glBitmap == profile_glBitmap) glad_glBitmap = real_glBitmap;
+	if(glad_glColor3b == profile_glColor3b) glad_glColor3b = real_glColor3b;
+	if(glad_glColor3bv == profile_glColor3bv) glad_glColor3bv = real_glColor3bv;
+	if(glad_glColor3d == profile_glColor3d) glad_glColor3d = real_glColor3d;
+	if(glad_glColor3dv == profile_glColor3dv) glad_glColor3dv = real_glColor3dv;
+	if(glad_glColor3f == profile_glColor3f) glad_glColor3f = real_glColor3f;
+	if(glad_glColor3fv == profile_glColor3fv) glad_glColor3fv = real_glColor3fv;
+	if(glad_glColor3i == profile_glColor3i) glad_glColor3i = real_glColor3i;
+	if(glad_glColor3iv == profile_glColor3iv) glad_glColor3iv = real_glColor3iv;
+	if(glad_glColor3s == profile_glColor3s) glad_glColor3s = real_glColor3s;
+	if(glad_glColor3sv == profile_glColor3sv) glad_glColor3sv = real_glColor3sv;
+	if(glad_glColor3ub == profile_glColor3ub) glad_glColor3ub = real_glColor3ub;
+	if(glad_glColor3ubv == profile_glColor3ubv) glad_glColor3ubv = real_glColor3ubv;
+	if(glad_glColor3ui == profile_glColor3ui) glad_glColor3ui = real_glColor3ui;
+	if(glad_glColor3uiv == profile_glColor3uiv) glad_glColor3uiv = real_glColor3uiv;
+	if(glad_glColor3us == profile_glColor3us) glad_glColor3us = real_glColor3us;
+	if(glad_glColor3usv == profile_glColor3usv) glad_glColor3usv = real_glColor3usv;
+	if(glad_glColor4b == profile_glColor4b) glad_glColor4b = real_glColor4b;
+	if(glad_glColor4bv == profile_glColor4bv) glad_glColor4bv = real_glColor4bv;
+	if(glad_glColor4d == profile_glColor4d) glad_glColor4d = real_glColor4d;
+	if(glad_glColor4dv == profile_glColor4dv) glad_glColor4dv = real_glColor4dv;
+	if(glad_glColor4f == profile_glColor4f) glad_glColor4f = real_glColor4f;
+	if(glad_glColor4fv == profile_glColor4fv) glad_glColor4fv = real_glColor4fv;
+	if(glad_glColor4i == profile_glColor4i) glad_glColor4i = real_glColor4i;
+	if(glad_glColor4iv == profile_glColor4iv) glad_glColor4iv = real_glColor4iv;
+	if(glad_glColor4s == profile_glColor4s) glad_glColor4s = real_glColor4s;
+	if(glad_glColor4sv == profile_glColor4sv) glad_glColor4sv = real_glColor4sv;
+	if(glad_glColor4ub == profile_glColor4ub) glad_glColor4ub = real_glColor4ub;
+	if(glad_glColor4ubv == profile_glColor4ubv) glad_glColor4ubv = real_glColor4ubv;
+	if(glad_glColor4ui == profile_glColor4ui) glad_glColor4ui = real_glColor4ui;
+	if(glad_glColor4uiv == profile_glColor4uiv) glad_glColor4uiv = real_glColor4uiv;
+	if(glad_glColor4us == profile_glColor4us) glad_glColor4us = real_glColor4us;
+	if(glad_glColor4usv == profile_glColor4usv) glad_glColor4usv = real_glColor4usv;
+	if(glad_glEdgeFlag == profile_glEdgeFlag) glad_glEdgeFlag = real_glEdgeFlag;
+	if(glad_glEdgeFlagv == profile_glEdgeFlagv) glad_glEdgeFlagv = real_glEdgeFlagv;
+	if(glad_glEnd == profile_glEnd) glad_glEnd = real_glEnd;
+	if(glad_glIndexd == profile_glIndexd) glad_glIndexd = real_glIndexd;
+	if(glad_glIndexdv == profile_glIndexdv) glad_glIndexdv = real_glIndexdv;
+	if(glad_glIndexf == profile_glIndexf) glad_glIndexf = real_glIndexf;
+	if(glad_glIndexfv == profile_glIndexfv) glad_glIndexfv = real_glIndexfv;
+	if(glad_glIndexi == profile_glIndexi) glad_glIndexi = real_glIndexi;
+	if(glad_glIndexiv == profile_glIndexiv) glad_glIndexiv = real_glIndexiv;
+	if(glad_glIndexs == profile_glIndexs) glad_glIndexs = real_glIndexs;
+	if(glad_glIndexsv == profile_glIndexsv) glad_glIndexsv = real_glIndexsv;
+	if(glad_glNormal3b == profile_glNormal3b) glad_glNormal3b = real_glNormal3b;
+	if(glad_glNormal3bv == profile_glNormal3bv) glad_glNormal3bv = real_glNormal3bv;
+	if(glad_glNormal3d == profile_glNormal3d) glad_glNormal3d = real_glNormal3d;
+	if(glad_glNormal3dv == profile_glNormal3dv) glad_glNormal3dv = real_glNormal3dv;
+	if(glad_glNormal3f == profile_glNormal3f) glad_glNormal3f = real_glNormal3f;
+	if(glad_glNormal3fv == profile_glNormal3fv) glad_glNormal3fv = real_glNormal3fv;
+	if(glad_glNormal3i == profile_glNormal3i) glad_glNormal3i = real_glNormal3i;
+	if(glad_glNormal3iv == profile_glNormal3iv) glad_glNormal3iv = real_glNormal3iv;
+	if(glad_glNormal3s == profile_glNormal3s) glad_glNormal3s = real_glNormal3s;
+	if(glad_glNormal3sv == profile_glNormal3sv) glad_glNormal3sv = real_glNormal3sv;
+	if(glad_glRasterPos2d == profile_glRasterPos2d) glad_glRasterPos2d = real_glRasterPos2d;
+	if(glad_glRasterPos2dv == profile_glRasterPos2dv) glad_glRasterPos2dv = real_glRasterPos2dv;
+	if(glad_glRasterPos2f == profile_glRasterPos2f) glad_glRasterPos2f = real_glRasterPos2f;
+	if(glad_glRasterPos2fv == profile_glRasterPos2fv) glad_glRasterPos2fv = real_glRasterPos2fv;
+	if(glad_glRasterPos2i == profile_glRasterPos2i) glad_glRasterPos2i = real_glRasterPos2i;
+	if(glad_glRasterPos2iv == profile_glRasterPos2iv) glad_glRasterPos2iv = real_glRasterPos2iv;
+	if(glad_glRasterPos2s == profile_glRasterPos2s) glad_glRasterPos2s = real_glRasterPos2s;
+	if(glad_glRasterPos2sv == profile_glRasterPos2sv) glad_glRasterPos2sv = real_glRasterPos2sv;
+	if(glad_glRasterPos3d == profile_glRasterPos3d) glad_glRasterPos3d = real_glRasterPos3d;
+	if(glad_glRasterPos3dv == profile_glRasterPos3dv) glad_glRasterPos3dv = real_glRasterPos3dv;
+	if(glad_glRasterPos3f == profile_glRasterPos3f) glad_glRasterPos3f = real_glRasterPos3f;
+	if(glad_glRasterPos3fv == profile_glRasterPos3fv) glad_glRasterPos3fv = real_glRasterPos3fv;
+	if(glad_glRasterPos3i == profile_glRasterPos3i) glad_glRasterPos3i = real_glRasterPos3i;
+	if(glad_glRasterPos3iv == profile_glRasterPos3iv) glad_glRasterPos3iv = real_glRasterPos3iv;
+	if(glad_glRasterPos3s == profile_glRasterPos3s) glad_glRasterPos3s = real_glRasterPos3s;
+	if(glad_glRasterPos3sv == profile_glRasterPos3sv) glad_glRasterPos3sv = real_glRasterPos3sv;
+	if(glad_glRasterPos4d == profile_glRasterPos4d) glad_glRasterPos4d = real_glRasterPos4d;
+	if(glad_glRasterPos4dv == profile_glRasterPos4dv) glad_glRasterPos4dv = real_glRasterPos4dv;
+	if(glad_glRasterPos4f == profile_glRasterPos4f) glad_glRasterPos4f = real_glRasterPos4f;
+	if(glad_glRasterPos4fv == profile_glRasterPos4fv) glad_glRasterPos4fv = real_glRasterPos4fv;
+	if(glad_glRasterPos4i == profile_glRasterPos4i) glad_glRasterPos4i = real_glRasterPos4i;
+	if(glad_glRasterPos4iv == profile_glRasterPos4iv) glad_glRasterPos4iv = real_glRasterPos4iv;
+	if(glad_glRasterPos4s == profile_glRasterPos4s) glad_glRasterPos4s = real_glRasterPos4s;
+	if(glad_glRasterPos4sv == profile_glRasterPos4sv) glad_glRasterPos4sv = real_glRasterPos4sv;
+	if(glad_glRectd == profile_glRectd) glad_glRectd = real_glRectd;
+	if(glad_glRectdv == profile_glRectdv) glad_glRectdv = real_glRectdv;
+	if(glad_glRectf == profile_glRectf) glad_glRectf = real_glRectf;
+	if(glad_glRectfv == profile_glRectfv) glad_glRectfv = real_glRectfv;
+	if(glad_glRecti == profile_glRecti) glad_glRecti = real_glRecti;
+	if(glad_glRectiv == profile_glRectiv) glad_glRectiv = real_glRectiv;
+	if(glad_glRects == profile_glRects) glad_glRects = real_glRects;
+	if(glad_glRectsv == profile_glRectsv) glad_glRectsv = real_glRectsv;
+	if(glad_glTexCoord1d == profile_glTexCoord1d) glad_glTexCoord1d = real_glTexCoord1d;
+	if(glad_glTexCoord1dv == profile_glTexCoord1dv) glad_glTexCoord1dv = real_glTexCoord1dv;
+	if(glad_glTexCoord1f == profile_glTexCoord1f) glad_glTexCoord1f = real_glTexCoord1f;
+	if(glad_glTexCoord1fv == profile_glTexCoord1fv) glad_glTexCoord1fv = real_glTexCoord1fv;
+	if(glad_glTexCoord1i == profile_glTexCoord1i) glad_glTexCoord1i = real_glTexCoord1i;
+	if(glad_glTexCoord1iv == profile_glTexCoord1iv) glad_glTexCoord1iv = real_glTexCoord1iv;
+	if(glad_glTexCoord1s == profile_glTexCoord1s) glad_glTexCoord1s = real_glTexCoord1s;
+	if(glad_glTexCoord1sv == profile_glTexCoord1sv) glad_glTexCoord1sv = real_glTexCoord1sv;
+	if(glad_glTexCoord2d == profile_glTexCoord2d) glad_glTexCoord2d = real_glTexCoord2d;
+	if(glad_glTexCoord2dv == profile_glTexCoord2dv) glad_glTexCoord2dv = real_glTexCoord2dv;
+	if(glad_glTexCoord2f == profile_glTexCoord2f) glad_glTexCoord2f = real_glTexCoord2f;
+	if(glad_glTexCoord2fv == profile_glTexCoord2fv) glad_glTexCoord2fv = real_glTexCoord2fv;
+	if(glad_glTexCoord2i == profile_glTexCoord2i) glad_glTexCoord2i = real_glTexCoord2i;
+	if(glad_glTexCoord2iv == profile_glTexCoord2iv) glad_glTexCoord2iv = real_glTexCoord2iv;
+	if(glad_glTexCoord2s == profile_glTexCoord2s) glad_glTexCoord2s = real_glTexCoord2s;
+	if(glad_glTexCoord2sv == profile_glTexCoord2sv) glad_glTexCoord2sv = real_glTexCoord2sv;
+	if(glad_glTexCoord3d == profile_glTexCoord3d) glad_glTexCoord3d = real_glTexCoord3d;
+	if(glad_glTexCoord3dv == profile_glTexCoord3dv) glad_glTexCoord3dv = real_glTexCoord3dv;
+	if(glad_glTexCoord3f == profile_glTexCoord3f) glad_glTexCoord3f = real_glTexCoord3f;
+	if(glad_glTexCoord3fv == profile_glTexCoord3fv) glad_glTexCoord3fv = real_glTexCoord3fv;
+	if(glad_glTexCoord3i == profile_glTexCoord3i) glad_glTexCoord3i = real_glTexCoord3i;
+	if(glad_glTexCoord3iv == profile_glTexCoord3iv) glad_glTexCoord3iv = real_glTexCoord3iv;
+	if(glad_glTexCoord3s == profile_glTexCoord3s) glad_glTexCoord3s = real_glTexCoord3s;
+	if(glad_glTexCoord3sv == profile_glTexCoord3sv) glad_glTexCoord3sv = real_glTexCoord3sv;
+	if(glad_glTexCoord4d == profile_glTexCoord4d) glad_glTexCoord4d = real_glTexCoord4d;
+	if(glad_glTexCoord4dv == profile_glTexCoord4dv) glad_glTexCoord4dv = real_glTexCoord4dv;
+	if(glad_glTexCoord4f == profile_glTexCoord4f) glad_glTexCoord4f = real_glTexCoord4f;
+	if(glad_glTexCoord4fv == profile_glTexCoord4fv) glad_glTexCoord4fv = real_glTexCoord4fv;
+	if(glad_glTexCoord4i == profile_glTexCoord4i) glad_glTexCoord4i = real_glTexCoord4i;
+	if(glad_glTexCoord4iv == profile_glTexCoord4iv) glad_glTexCoord4iv = real_glTexCoord4iv;
+	if(glad_glTexCoord4s == profile_glTexCoord4s) glad_glTexCoord4s = real_glTexCoord4s;
+	if(glad_glTexCoord4sv == profile_glTexCoord4sv) glad_glTexCoord4sv = real_glTexCoord4sv;
+	if(glad_glVertex2d == profile_glVertex2d) glad_glVertex2d = real_glVertex2d;
+	if(glad_glVertex2dv == profile_glVertex2dv) glad_glVertex2dv = real_glVertex2dv;
+	if(glad_glVertex2f == profile_glVertex2f) glad_glVertex2f = real_glVertex2f;
+	if(glad_glVertex2fv == profile_glVertex2fv) glad_glVertex2fv = real_glVertex2fv;
+	if(glad_glVertex2i == profile_glVertex2i) glad_glVertex2i = real_glVertex2i;
+	if(glad_glVertex2iv == profile_glVertex2iv) glad_glVertex2iv = real_glVertex2iv;
+	if(glad_glVertex2s == profile_glVertex2s) glad_glVertex2s = real_glVertex2s;
+	if(glad_glVertex2sv == profile_glVertex2sv) glad_glVertex2sv = real_glVertex2sv;
+	if(glad_glVertex3d == profile_glVertex3d) glad_glVertex3d = real_glVertex3d;
+	if(glad_glVertex3dv == profile_glVertex3dv) glad_glVertex3dv = real_glVertex3dv;
+	if(glad_glVertex3f == profile_glVertex3f) glad_glVertex3f = real_glVertex3f;
+	if(glad_glVertex3fv == profile_glVertex3fv) glad_glVertex3fv = real_glVertex3fv;
+	if(glad_glVertex3i == profile_glVertex3i) glad_glVertex3i = real_glVertex3i;
+	if(glad_glVertex3iv == profile_glVertex3iv) glad_glVertex3iv = real_glVertex3iv;
+	if(glad_glVertex3s == profile_glVertex3s) glad_glVertex3s = real_glVertex3s;
+	if(glad_glVertex3sv == profile_glVertex3sv) glad_glVertex3sv = real_glVertex3sv;
+	if(glad_glVertex4d == profile_glVertex4d) glad_glVertex4d = real_glVertex4d;
+	if(glad_glVertex4dv == profile_glVertex4dv) glad_glVertex4dv = real_glVertex4dv;
+	if(glad_glVertex4f == profile_glVertex4f) glad_glVertex4f = real_glVertex4f;
+	if(glad_glVertex4fv == profile_glVertex4fv) glad_glVertex4fv = real_glVertex4fv;
+	if(glad_glVertex4i == profile_glVertex4i) glad_glVertex4i = real_glVertex4i;
+	if(glad_glVertex4iv == profile_glVertex4iv) glad_glVertex4iv = real_glVertex4iv;
+	if(glad_glVertex4s == profile_glVertex4s) glad_glVertex4s = real_glVertex4s;
+	if(glad_glVertex4sv == profile_glVertex4sv) glad_glVertex4sv = real_glVertex4sv;
+	if(glad_glClipPlane == profile_glClipPlane) glad_glClipPlane = real_glClipPlane;
+	if(glad_glColorMaterial == profile_glColorMaterial) glad_glColorMaterial = real_glColorMaterial;
+	if(glad_glFogf == profile_glFogf) glad_glFogf = real_glFogf;
+	if(glad_glFogfv == profile_glFogfv) glad_glFogfv = real_glFogfv;
+	if(glad_glFogi == profile_glFogi) glad_glFogi = real_glFogi;
+	if(glad_glFogiv == profile_glFogiv) glad_glFogiv = real_glFogiv;
+	if(glad_glLightf == profile_glLightf) glad_glLightf = real_glLightf;
+	if(glad_glLightfv == profile_glLightfv) glad_glLightfv = real_glLightfv;
+	if(glad_glLighti == profile_glLighti) glad_glLighti = real_glLighti;
+	if(glad_glLightiv == profile_glLightiv) glad_glLightiv = real_glLightiv;
+	if(glad_glLightModelf == profile_glLightModelf) glad_glLightModelf = real_glLightModelf;
+	if(glad_glLightModelfv == profile_glLightModelfv) glad_glLightModelfv = real_glLightModelfv;
+	if(glad_glLightModeli == profile_glLightModeli) glad_glLightModeli = real_glLightModeli;
+	if(glad_glLightModeliv == profile_glLightModeliv) glad_glLightModeliv = real_glLightModeliv;
+	if(glad_glLineStipple == profile_glLineStipple) glad_glLineStipple = real_glLineStipple;
+	if(glad_glMaterialf == profile_glMaterialf) glad_glMaterialf = real_glMaterialf;
+	if(glad_glMaterialfv == profile_glMaterialfv) glad_glMaterialfv = real_glMaterialfv;
+	if(glad_glMateriali == profile_glMateriali) glad_glMateriali = real_glMateriali;
+	if(glad_glMaterialiv == profile_glMaterialiv) glad_glMaterialiv = real_glMaterialiv;
+	if(glad_glPolygonStipple == profile_glPolygonStipple) glad_glPolygonStipple = real_glPolygonStipple;
+	if(glad_glShadeModel == profile_glShadeModel) glad_glShadeModel = real_glShadeModel;
+	if(glad_glTexEnvf == profile_glTexEnvf) glad_glTexEnvf = real_glTexEnvf;
+	if(glad_glTexEnvfv == profile_glTexEnvfv) glad_glTexEnvfv = real_glTexEnvfv;
+	if(glad_glTexEnvi == profile_glTexEnvi) glad_glTexEnvi = real_glTexEnvi;
+	if(glad_glTexEnviv == profile_glTexEnviv) glad_glTexEnviv = real_glTexEnviv;
+	if(glad_glTexGend == profile_glTexGend) glad_glTexGend = real_glTexGend;
+	if(glad_glTexGendv == profile_glTexGendv) glad_glTexGendv = real_glTexGendv;
+	if(glad_glTexGenf == profile_glTexGenf) glad_glTexGenf = real_glTexGenf;
+	if(glad_glTexGenfv == profile_glTexGenfv) glad_glTexGenfv = real_glTexGenfv;
+	if(glad_glTexGeni == profile_glTexGeni) glad_glTexGeni = real_glTexGeni;
+	if(glad_glTexGeniv == profile_glTexGeniv) glad_glTexGeniv = real_glTexGeniv;
+	if(glad_glFeedbackBuffer == profile_glFeedbackBuffer) glad_glFeedbackBuffer = real_glFeedbackBuffer;
+	if(glad_glSelectBuffer == profile_glSelectBuffer) glad_glSelectBuffer = real_glSelectBuffer;
+	if(glad_glRenderMode == profile_glRenderMode) glad_glRenderMode = real_glRenderMode;
+	if(glad_glInitNames == profile_glInitNames) glad_glInitNames = real_glInitNames;
+	if(glad_glLoadName == profile_glLoadName) glad_glLoadName = real_glLoadName;
+	if(glad_glPassThrough == profile_glPassThrough) glad_glPassThrough = real_glPassThrough;
+	if(glad_glPopName == profile_glPopName) glad_glPopName = real_glPopName;
+	if(glad_glPushName == profile_glPushName) glad_glPushName = real_glPushName;
+	if(glad_glClearAccum == profile_glClearAccum) glad_glClearAccum = real_glClearAccum;
+	if(glad_glClearIndex == profile_glClearIndex) glad_glClearIndex = real_glClearIndex;
+	if(glad_glIndexMask == profile_glIndexMask) glad_glIndexMask = real_glIndexMask;
+	if(glad_glAccum == profile_glAccum) glad_glAccum = real_glAccum;
+	if(glad_glPopAttrib == profile_glPopAttrib) glad_glPopAttrib = real_glPopAttrib;
+	if(glad_glPushAttrib == profile_glPushAttrib) glad_glPushAttrib = real_glPushAttrib;
+	if(glad_glMap1d == profile_glMap1d) glad_glMap1d = real_glMap1d;
+	if(glad_glMap1f == profile_glMap1f) glad_glMap1f = real_glMap1f;
+	if(glad_glMap2d == profile_glMap2d) glad_glMap2d = real_glMap2d;
+	if(glad_glMap2f == profile_glMap2f) glad_glMap2f = real_glMap2f;
+	if(glad_glMapGrid1d == profile_glMapGrid1d) glad_glMapGrid1d = real_glMapGrid1d;
+	if(glad_glMapGrid1f == profile_glMapGrid1f) glad_glMapGrid1f = real_glMapGrid1f;
+	if(glad_glMapGrid2d == profile_glMapGrid2d) glad_glMapGrid2d = real_glMapGrid2d;
+	if(glad_glMapGrid2f == profile_glMapGrid2f) glad_glMapGrid2f = real_glMapGrid2f;
+	if(glad_glEvalCoord1d == profile_glEvalCoord1d) glad_glEvalCoord1d = real_glEvalCoord1d;
+	if(glad_glEvalCoord1dv == profile_glEvalCoord1dv) glad_glEvalCoord1dv = real_glEvalCoord1dv;
+	if(glad_glEvalCoord1f == profile_glEvalCoord1f) glad_glEvalCoord1f = real_glEvalCoord1f;
+	if(glad_glEvalCoord1fv == profile_glEvalCoord1fv) glad_glEvalCoord1fv = real_glEvalCoord1fv;
+	if(glad_glEvalCoord2d == profile_glEvalCoord2d) glad_glEvalCoord2d = real_glEvalCoord2d;
+	if(glad_glEvalCoord2dv == profile_glEvalCoord2dv) glad_glEvalCoord2dv = real_glEvalCoord2dv;
+	if(glad_glEvalCoord2f == profile_glEvalCoord2f) glad_glEvalCoord2f = real_glEvalCoord2f;
+	if(glad_glEvalCoord2fv == profile_glEvalCoord2fv) glad_glEvalCoord2fv = real_glEvalCoord2fv;
+	if(glad_glEvalMesh1 == profile_glEvalMesh1) glad_glEvalMesh1 = real_glEvalMesh1;
+	if(glad_glEvalPoint1 == profile_glEvalPoint1) glad_glEvalPoint1 = real_glEvalPoint1;
+	if(glad_glEvalMesh2 == profile_glEvalMesh2) glad_glEvalMesh2 = real_glEvalMesh2;
+	if(glad_glEvalPoint2 == profile_glEvalPoint2) glad_glEvalPoint2 = real_glEvalPoint2;
+	if(glad_glAlphaFunc == profile_glAlphaFunc) glad_glAlphaFunc = real_glAlphaFunc;
+	if(glad_glPixelZoom == profile_glPixelZoom) glad_glPixelZoom = real_glPixelZoom;
+	if(glad_glPixelTransferf == profile_glPixelTransferf) glad_glPixelTransferf = real_glPixelTransferf;
+	if(glad_glPixelTransferi == profile_glPixelTransferi) glad_glPixelTransferi = real_glPixelTransferi;
+	if(glad_glPixelMapfv == profile_glPixelMapfv) glad_glPixelMapfv = real_glPixelMapfv;
+	if(glad_glPixelMapuiv == profile_glPixelMapuiv) glad_glPixelMapuiv = real_glPixelMapuiv;
+	if(glad_glPixelMapusv == profile_glPixelMapusv) glad_glPixelMapusv = real_glPixelMapusv;
+	if(glad_glCopyPixels == profile_glCopyPixels) glad_glCopyPixels = real_glCopyPixels;
+	if(glad_glDrawPixels == profile_glDrawPixels) glad_glDrawPixels = real_glDrawPixels;
+	if(glad_glGetClipPlane == profile_glGetClipPlane) glad_glGetClipPlane = real_glGetClipPlane;
+	if(glad_glGetLightfv == profile_glGetLightfv) glad_glGetLightfv = real_glGetLightfv;
+	if(glad_glGetLightiv == profile_glGetLightiv) glad_glGetLightiv = real_glGetLightiv;
+	if(glad_glGetMapdv == profile_glGetMapdv) glad_glGetMapdv = real_glGetMapdv;
+	if(glad_glGetMapfv == profile_glGetMapfv) glad_glGetMapfv = real_glGetMapfv;
+	if(glad_glGetMapiv == profile_glGetMapiv) glad_glGetMapiv = real_glGetMapiv;
+	if(glad_glGetMaterialfv == profile_glGetMaterialfv) glad_glGetMaterialfv = real_glGetMaterialfv;
+	if(glad_glGetMaterialiv == profile_glGetMaterialiv) glad_glGetMaterialiv = real_glGetMaterialiv;
+	if(glad_glGetPixelMapfv == profile_glGetPixelMapfv) glad_glGetPixelMapfv = real_glGetPixelMapfv;
+	if(glad_glGetPixelMapuiv == profile_glGetPixelMapuiv) glad_glGetPixelMapuiv = real_glGetPixelMapuiv;
+	if(glad_glGetPixelMapusv == profile_glGetPixelMapusv) glad_glGetPixelMapusv = real_glGetPixelMapusv;
+	if(glad_glGetPolygonStipple == profile_glGetPolygonStipple) glad_glGetPolygonStipple = real_glGetPolygonStipple;
+	if(glad_glGetTexEnvfv == profile_glGetTexEnvfv) glad_glGetTexEnvfv = real_glGetTexEnvfv;
+	if(glad_glGetTexEnviv == profile_glGetTexEnviv) glad_glGetTexEnviv = real_glGetTexEnviv;
+	if(glad_glGetTexGendv == profile_glGetTexGendv) glad_glGetTexGendv = real_glGetTexGendv;
+	if(glad_glGetTexGenfv == profile_glGetTexGenfv) glad_glGetTexGenfv = real_glGetTexGenfv;
+	if(glad_glGetTexGeniv == profile_glGetTexGeniv) glad_glGetTexGeniv = real_glGetTexGeniv;
+	if(glad_glIsList == profile_glIsList) glad_glIsList = real_glIsList;
+	if(glad_glFrustum == profile_glFrustum) glad_glFrustum = real_glFrustum;
+	if(glad_glLoadIdentity == profile_glLoadIdentity) glad_glLoadIdentity = real_glLoadIdentity;
+	if(glad_glLoadMatrixf == profile_glLoadMatrixf) glad_glLoadMatrixf = real_glLoadMatrixf;
+	if(glad_glLoadMatrixd == profile_glLoadMatrixd) glad_glLoadMatrixd = real_glLoadMatrixd;
+	if(glad_glMatrixMode == profile_glMatrixMode) glad_glMatrixMode = real_glMatrixMode;
+	if(glad_glMultMatrixf == profile_glMultMatrixf) glad_glMultMatrixf = real_glMultMatrixf;
+	if(glad_glMultMatrixd == profile_glMultMatrixd) glad_glMultMatrixd = real_glMultMatrixd;
+	if(glad_glOrtho == profile_glOrtho) glad_glOrtho = real_glOrtho;
+	if(glad_glPopMatrix == profile_glPopMatrix) glad_glPopMatrix = real_glPopMatrix;
+	if(glad_glPushMatrix == profile_glPushMatrix) glad_glPushMatrix = real_glPushMatrix;
+	if(glad_glRotated == profile_glRotated) glad_glRotated = real_glRotated;
+	if(glad_glRotatef == profile_glRotatef) glad_glRotatef = real_glRotatef;
+	if(glad_glScaled == profile_glScaled) glad_glScaled = real_glScaled;
+	if(glad_glScalef == profile_glScalef) glad_glScalef = real_glScalef;
+	if(glad_glTranslated == profile_glTranslated) glad_glTranslated = real_glTranslated;
+	if(glad_glTranslatef == profile_glTranslatef) glad_glTranslatef = real_glTranslatef;
+	if(glad_glDrawArrays == profile_glDrawArrays) glad_glDrawArrays = real_glDrawArrays;
+	if(glad_glDrawElements == profile_glDrawElements) glad_glDrawElements = real_glDrawElements;
+	if(glad_glGetPointerv == profile_glGetPointerv) glad_glGetPointerv = real_glGetPointerv;
+	if(glad_glPolygonOffset == profile_glPolygonOffset) glad_glPolygonOffset = real_glPolygonOffset;
+	if(glad_glCopyTexImage1D == profile_glCopyTexImage1D) glad_glCopyTexImage1D = real_glCopyTexImage1D;
+	if(glad_glCopyTexImage2D == profile_glCopyTexImage2D) glad_glCopyTexImage2D = real_glCopyTexImage2D;
+	if(glad_glCopyTexSubImage1D == profile_glCopyTexSubImage1D) glad_glCopyTexSubImage1D = real_glCopyTexSubImage1D;
+	if(glad_glCopyTexSubImage2D == profile_glCopyTexSubImage2D) glad_glCopyTexSubImage2D = real_glCopyTexSubImage2D;
+	if(glad_glTexSubImage1D == profile_glTexSubImage1D) glad_glTexSubImage1D = real_glTexSubImage1D;
+	if(glad_glTexSubImage2D == profile_glTexSubImage2D) glad_glTexSubImage2D = real_glTexSubImage2D;
+	if(glad_glBindTexture == profile_glBindTexture) glad_glBindTexture = real_glBindTexture;
+	if(glad_glDeleteTextures == profile_glDeleteTextures) glad_glDeleteTextures = real_glDeleteTextures;
+	if(glad_glGenTextures == profile_glGenTextures) glad_glGenTextures = real_glGenTextures;
+	if(glad_glIsTexture == profile_glIsTexture) glad_glIsTexture = real_glIsTexture;
+	if(glad_glArrayElement == profile_glArrayElement) glad_glArrayElement = real_glArrayElement;
+	if(glad_glColorPointer == profile_glColorPointer) glad_glColorPointer = real_glColorPointer;
+	if(glad_glDisableClientState == profile_glDisableClientState) glad_glDisableClientState = real_glDisableClientState;
+	if(glad_glEdgeFlagPointer == profile_glEdgeFlagPointer) glad_glEdgeFlagPointer = real_glEdgeFlagPointer;
+	if(glad_glEnableClientState == profile_glEnableClientState) glad_glEnableClientState = real_glEnableClientState;
+	if(glad_glIndexPointer == profile_glIndexPointer) glad_glIndexPointer = real_glIndexPointer;
+	if(glad_glInterleavedArrays == profile_glInterleavedArrays) glad_glInterleavedArrays = real_glInterleavedArrays;
+	if(glad_glNormalPointer == profile_glNormalPointer) glad_glNormalPointer = real_glNormalPointer;
+	if(glad_glTexCoordPointer == profile_glTexCoordPointer) glad_glTexCoordPointer = real_glTexCoordPointer;
+	if(glad_glVertexPointer == profile_glVertexPointer) glad_glVertexPointer = real_glVertexPointer;
+	if(glad_glAreTexturesResident == profile_glAreTexturesResident) glad_glAreTexturesResident = real_glAreTexturesResident;
+	if(glad_glPrioritizeTextures == profile_glPrioritizeTextures) glad_glPrioritizeTextures = real_glPrioritizeTextures;
+	if(glad_glIndexub == profile_glIndexub) glad_glIndexub = real_glIndexub;
+	if(glad_glIndexubv == profile_glIndexubv) glad_glIndexubv = real_glIndexubv;
+	if(glad_glPopClientAttrib == profile_glPopClientAttrib) glad_glPopClientAttrib = real_glPopClientAttrib;
+	if(glad_glPushClientAttrib == profile_glPushClientAttrib) glad_glPushClientAttrib = real_glPushClientAttrib;
+	if(glad_glDrawRangeElements == profile_glDrawRangeElements) glad_glDrawRangeElements = real_glDrawRangeElements;
+	if(glad_glTexImage3D == profile_glTexImage3D) glad_glTexImage3D = real_glTexImage3D;
+	if(glad_glTexSubImage3D == profile_glTexSubImage3D) glad_glTexSubImage3D = real_glTexSubImage3D;
+	if(glad_glCopyTexSubImage3D == profile_glCopyTexSubImage3D) glad_glCopyTexSubImage3D = real_glCopyTexSubImage3D;
+	if(glad_glActiveTexture == profile_glActiveTexture) glad_glActiveTexture = real_glActiveTexture;
+	if(glad_glSampleCoverage == profile_glSampleCoverage) glad_glSampleCoverage = real_glSampleCoverage;
+	if(glad_glCompressedTexImage3D == profile_glCompressedTexImage3D) glad_glCompressedTexImage3D = real_glCompressedTexImage3D;
+	if(glad_glCompressedTexImage2D == profile_glCompressedTexImage2D) glad_glCompressedTexImage2D = real_glCompressedTexImage2D;
+	if(glad_glCompressedTexImage1D == profile_glCompressedTexImage1D) glad_glCompressedTexImage1D = real_glCompressedTexImage1D;
+	if(glad_glCompressedTexSubImage3D == profile_glCompressedTexSubImage3D) glad_glCompressedTexSubImage3D = real_glCompressedTexSubImage3D;
+	if(glad_glCompressedTexSubImage2D == profile_glCompressedTexSubImage2D) glad_glCompressedTexSubImage2D = real_glCompressedTexSubImage2D;
+	if(glad_glCompressedTexSubImage1D == profile_glCompressedTexSubImage1D) glad_glCompressedTexSubImage1D = real_glCompressedTexSubImage1D;
+	if(glad_glGetCompressedTexImage == profile_glGetCompressedTexImage) glad_glGetCompressedTexImage = real_glGetCompressedTexImage;
+	if(glad_glClientActiveTexture == profile_glClientActiveTexture) glad_glClientActiveTexture = real_glClientActiveTexture;
+	if(glad_glMultiTexCoord1d == profile_glMultiTexCoord1d) glad_glMultiTexCoord1d = real_glMultiTexCoord1d;
+	if(glad_glMultiTexCoord1dv == profile_glMultiTexCoord1dv) glad_glMultiTexCoord1dv = real_glMultiTexCoord1dv;
+	if(glad_glMultiTexCoord1f == profile_glMultiTexCoord1f) glad_glMultiTexCoord1f = real_glMultiTexCoord1f;
+	if(glad_glMultiTexCoord1fv == profile_glMultiTexCoord1fv) glad_glMultiTexCoord1fv = real_glMultiTexCoord1fv;
+	if(glad_glMultiTexCoord1i == profile_glMultiTexCoord1i) glad_glMultiTexCoord1i = real_glMultiTexCoord1i;
+	if(glad_glMultiTexCoord1iv == profile_glMultiTexCoord1iv) glad_glMultiTexCoord1iv = real_glMultiTexCoord1iv;
+	if(glad_glMultiTexCoord1s == profile_glMultiTexCoord1s) glad_glMultiTexCoord1s = real_glMultiTexCoord1s;
+	if(glad_glMultiTexCoord1sv == profile_glMultiTexCoord1sv) glad_glMultiTexCoord1sv = real_glMultiTexCoord1sv;
+	if(glad_glMultiTexCoord2d == profile_glMultiTexCoord2d) glad_glMultiTexCoord2d = real_glMultiTexCoord2d;
+	if(glad_glMultiTexCoord2dv == profile_glMultiTexCoord2dv) glad_glMultiTexCoord2dv = real_glMultiTexCoord2dv;
+	if(glad_glMultiTexCoord2f == profile_glMultiTexCoord2f) glad_glMultiTexCoord2f = real_glMultiTexCoord2f;
+	if(glad_glMultiTexCoord2fv == profile_glMultiTexCoord2fv) glad_glMultiTexCoord2fv = real_glMultiTexCoord2fv;
+	if(glad_glMultiTexCoord2i == profile_glMultiTexCoord2i) glad_glMultiTexCoord2i = real_glMultiTexCoord2i;
+	if(glad_glMultiTexCoord2iv == profile_glMultiTexCoord2iv) glad_glMultiTexCoord2iv = real_glMultiTexCoord2iv;
+	if(glad_glMultiTexCoord2s == profile_glMultiTexCoord2s) glad_glMultiTexCoord2s = real_glMultiTexCoord2s;
+	if(glad_glMultiTexCoord2sv == profile_glMultiTexCoord2sv) glad_glMultiTexCoord2sv = real_glMultiTexCoord2sv;
+	if(glad_glMultiTexCoord3d == profile_glMultiTexCoord3d) glad_glMultiTexCoord3d = real_glMultiTexCoord3d;
+	if(glad_glMultiTexCoord3dv == profile_glMultiTexCoord3dv) glad_glMultiTexCoord3dv = real_glMultiTexCoord3dv;
+	if(glad_glMultiTexCoord3f == profile_glMultiTexCoord3f) glad_glMultiTexCoord3f = real_glMultiTexCoord3f;
+	if(glad_glMultiTexCoord3fv == profile_glMultiTexCoord3fv) glad_glMultiTexCoord3fv = real_glMultiTexCoord3fv;
+	if(glad_glMultiTexCoord3i == profile_glMultiTexCoord3i) glad_glMultiTexCoord3i = real_glMultiTexCoord3i;
+	if(glad_glMultiTexCoord3iv == profile_glMultiTexCoord3iv) glad_glMultiTexCoord3iv = real_glMultiTexCoord3iv;
+	if(glad_glMultiTexCoord3s == profile_glMultiTexCoord3s) glad_glMultiTexCoord3s = real_glMultiTexCoord3s;
+	if(glad_glMultiTexCoord3sv == profile_glMultiTexCoord3sv) glad_glMultiTexCoord3sv = real_glMultiTexCoord3sv;
+	if(glad_glMultiTexCoord4d == profile_glMultiTexCoord4d) glad_glMultiTexCoord4d = real_glMultiTexCoord4d;
+	if(glad_glMultiTexCoord4dv == profile_glMultiTexCoord4dv) glad_glMultiTexCoord4dv = real_glMultiTexCoord4dv;
+	if(glad_glMultiTexCoord4f == profile_glMultiTexCoord4f) glad_glMultiTexCoord4f = real_glMultiTexCoord4f;
+	if(glad_glMultiTexCoord4fv == profile_glMultiTexCoord4fv) glad_glMultiTexCoord4fv = real_glMultiTexCoord4fv;
+	if(glad_glMultiTexCoord4i == profile_glMultiTexCoord4i) glad_glMultiTexCoord4i = real_glMultiTexCoord4i;
+	if(glad_glMultiTexCoord4iv == profile_glMultiTexCoord4iv) glad_glMultiTexCoord4iv = real_glMultiTexCoord4iv;
+	if(glad_glMultiTexCoord4s == profile_glMultiTexCoord4s) glad_glMultiTexCoord4s = real_glMultiTexCoord4s;
+	if(glad_glMultiTexCoord4sv == profile_glMultiTexCoord4sv) glad_glMultiTexCoord4sv = real_glMultiTexCoord4sv;
+	if(glad_glLoadTransposeMatrixf == profile_glLoadTransposeMatrixf) glad_glLoadTransposeMatrixf = real_glLoadTransposeMatrixf;
+	if(glad_glLoadTransposeMatrixd == profile_glLoadTransposeMatrixd) glad_glLoadTransposeMatrixd = real_glLoadTransposeMatrixd;
+	if(glad_glMultTransposeMatrixf == profile_glMultTransposeMatrixf) glad_glMultTransposeMatrixf = real_glMultTransposeMatrixf;
+	if(glad_glMultTransposeMatrixd == profile_glMultTransposeMatrixd) glad_glMultTransposeMatrixd = real_glMultTransposeMatrixd;
+	if(glad_glBlendFuncSeparate == profile_glBlendFuncSeparate) glad_glBlendFuncSeparate = real_glBlendFuncSeparate;
+	if(glad_glMultiDrawArrays == profile_glMultiDrawArrays) glad_glMultiDrawArrays = real_glMultiDrawArrays;
+	if(glad_glMultiDrawElements == profile_glMultiDrawElements) glad_glMultiDrawElements = real_glMultiDrawElements;
+	if(glad_glPointParameterf == profile_glPointParameterf) glad_glPointParameterf = real_glPointParameterf;
+	if(glad_glPointParameterfv == profile_glPointParameterfv) glad_glPointParameterfv = real_glPointParameterfv;
+	if(glad_glPointParameteri == profile_glPointParameteri) glad_glPointParameteri = real_glPointParameteri;
+	if(glad_glPointParameteriv == profile_glPointParameteriv) glad_glPointParameteriv = real_glPointParameteriv;
+	if(glad_glFogCoordf == profile_glFogCoordf) glad_glFogCoordf = real_glFogCoordf;
+	if(glad_glFogCoordfv == profile_glFogCoordfv) glad_glFogCoordfv = real_glFogCoordfv;
+	if(glad_glFogCoordd == profile_glFogCoordd) glad_glFogCoordd = real_glFogCoordd;
+	if(glad_glFogCoorddv == profile_glFogCoorddv) glad_glFogCoorddv = real_glFogCoorddv;
+	if(glad_glFogCoordPointer == profile_glFogCoordPointer) glad_glFogCoordPointer = real_glFogCoordPointer;
+	if(glad_glSecondaryColor3b == profile_glSecondaryColor3b) glad_glSecondaryColor3b = real_glSecondaryColor3b;
+	if(glad_glSecondaryColor3bv == profile_glSecondaryColor3bv) glad_glSecondaryColor3bv = real_glSecondaryColor3bv;
+	if(glad_glSecondaryColor3d == profile_glSecondaryColor3d) glad_glSecondaryColor3d = real_glSecondaryColor3d;
+	if(glad_glSecondaryColor3dv == profile_glSecondaryColor3dv) glad_glSecondaryColor3dv = real_glSecondaryColor3dv;
+	if(glad_glSecondaryColor3f == profile_glSecondaryColor3f) glad_glSecondaryColor3f = real_glSecondaryColor3f;
+	if(glad_glSecondaryColor3fv == profile_glSecondaryColor3fv) glad_glSecondaryColor3fv = real_glSecondaryColor3fv;
+	if(glad_glSecondaryColor3i == profile_glSecondaryColor3i) glad_glSecondaryColor3i = real_glSecondaryColor3i;
+	if(glad_glSecondaryColor3iv == profile_glSecondaryColor3iv) glad_glSecondaryColor3iv = real_glSecondaryColor3iv;
+	if(glad_glSecondaryColor3s == profile_glSecondaryColor3s) glad_glSecondaryColor3s = real_glSecondaryColor3s;
+	if(glad_glSecondaryColor3sv == profile_glSecondaryColor3sv) glad_glSecondaryColor3sv = real_glSecondaryColor3sv;
+	if(glad_glSecondaryColor3ub == profile_glSecondaryColor3ub) glad_glSecondaryColor3ub = real_glSecondaryColor3ub;
+	if(glad_glSecondaryColor3ubv == profile_glSecondaryColor3ubv) glad_glSecondaryColor3ubv = real_glSecondaryColor3ubv;
+	if(glad_glSecondaryColor3ui == profile_glSecondaryColor3ui) glad_glSecondaryColor3ui = real_glSecondaryColor3ui;
+	if(glad_glSecondaryColor3uiv == profile_glSecondaryColor3uiv) glad_glSecondaryColor3uiv = real_glSecondaryColor3uiv;
+	if(glad_glSecondaryColor3us == profile_glSecondaryColor3us) glad_glSecondaryColor3us = real_glSecondaryColor3us;
+	if(glad_glSecondaryColor3usv == profile_glSecondaryColor3usv) glad_glSecondaryColor3usv = real_glSecondaryColor3usv;
+	if(glad_glSecondaryColorPointer == profile_glSecondaryColorPointer) glad_glSecondaryColorPointer = real_glSecondaryColorPointer;
+	if(glad_glWindowPos2d == profile_glWindowPos2d) glad_glWindowPos2d = real_glWindowPos2d;
+	if(glad_glWindowPos2dv == profile_glWindowPos2dv) glad_glWindowPos2dv = real_glWindowPos2dv;
+	if(glad_glWindowPos2f == profile_glWindowPos2f) glad_glWindowPos2f = real_glWindowPos2f;
+	if(glad_glWindowPos2fv == profile_glWindowPos2fv) glad_glWindowPos2fv = real_glWindowPos2fv;
+	if(glad_glWindowPos2i == profile_glWindowPos2i) glad_glWindowPos2i = real_glWindowPos2i;
+	if(glad_glWindowPos2iv == profile_glWindowPos2iv) glad_glWindowPos2iv = real_glWindowPos2iv;
+	if(glad_glWindowPos2s == profile_glWindowPos2s) glad_glWindowPos2s = real_glWindowPos2s;
+	if(glad_glWindowPos2sv == profile_glWindowPos2sv) glad_glWindowPos2sv = real_glWindowPos2sv;
+	if(glad_glWindowPos3d == profile_glWindowPos3d) glad_glWindowPos3d = real_glWindowPos3d;
+	if(glad_glWindowPos3dv == profile_glWindowPos3dv) glad_glWindowPos3dv = real_glWindowPos3dv;
+	if(glad_glWindowPos3f == profile_glWindowPos3f) glad_glWindowPos3f = real_glWindowPos3f;
+	if(glad_glWindowPos3fv == profile_glWindowPos3fv) glad_glWindowPos3fv = real_glWindowPos3fv;
+	if(glad_glWindowPos3i == profile_glWindowPos3i) glad_glWindowPos3i = real_glWindowPos3i;
+	if(glad_glWindowPos3iv == profile_glWindowPos3iv) glad_glWindowPos3iv = real_glWindowPos3iv;
+	if(glad_glWindowPos3s == profile_glWindowPos3s) glad_glWindowPos3s = real_glWindowPos3s;
+	if(glad_glWindowPos3sv == profile_glWindowPos3sv) glad_glWindowPos3sv = real_glWindowPos3sv;
+	if(glad_glBlendColor == profile_glBlendColor) glad_glBlendColor = real_glBlendColor;
+	if(glad_glBlendEquation == profile_glBlendEquation) glad_glBlendEquation = real_glBlendEquation;
+	if(glad_glGenQueries == profile_glGenQueries) glad_glGenQueries = real_glGenQueries;
+	if(glad_glDeleteQueries == profile_glDeleteQueries) glad_glDeleteQueries = real_glDeleteQueries;
+	if(glad_glIsQuery == profile_glIsQuery) glad_glIsQuery = real_glIsQuery;
+	if(glad_glBeginQuery == profile_glBeginQuery) glad_glBeginQuery = real_glBeginQuery;
+	if(glad_glEndQuery == profile_glEndQuery) glad_glEndQuery = real_glEndQuery;
+	if(glad_glGetQueryiv == profile_glGetQueryiv) glad_glGetQueryiv = real_glGetQueryiv;
+	if(glad_glGetQueryObjectiv == profile_glGetQueryObjectiv) glad_glGetQueryObjectiv = real_glGetQueryObjectiv;
+	if(glad_glGetQueryObjectuiv == profile_glGetQueryObjectuiv) glad_glGetQueryObjectuiv = real_glGetQueryObjectuiv;
+	if(glad_glBindBuffer == profile_glBindBuffer) glad_glBindBuffer = real_glBindBuffer;
+	if(glad_glDeleteBuffers == profile_glDeleteBuffers) glad_glDeleteBuffers = real_glDeleteBuffers;
+	if(glad_glGenBuffers == profile_glGenBuffers) glad_glGenBuffers = real_glGenBuffers;
+	if(glad_glIsBuffer == profile_glIsBuffer) glad_glIsBuffer = real_glIsBuffer;
+	if(glad_glBufferData == profile_glBufferData) glad_glBufferData = real_glBufferData;
+	if(glad_glBufferSubData == profile_glBufferSubData) glad_glBufferSubData = real_glBufferSubData;
+	if(glad_glGetBufferSubData == profile_glGetBufferSubData) glad_glGetBufferSubData = real_glGetBufferSubData;
+	if(glad_glMapBuffer == profile_glMapBuffer) glad_glMapBuffer = real_glMapBuffer;
+	if(glad_glUnmapBuffer == profile_glUnmapBuffer) glad_glUnmapBuffer = real_glUnmapBuffer;
+	if(glad_glGetBufferParameteriv == profile_glGetBufferParameteriv) glad_glGetBufferParameteriv = real_glGetBufferParameteriv;
+	if(glad_glGetBufferPointerv == profile_glGetBufferPointerv) glad_glGetBufferPointerv = real_glGetBufferPointerv;
+	if(glad_glBlendEquationSeparate == profile_glBlendEquationSeparate) glad_glBlendEquationSeparate = real_glBlendEquationSeparate;
+	if(glad_glDrawBuffers == profile_glDrawBuffers) glad_glDrawBuffers = real_glDrawBuffers;
+	if(glad_glStencilOpSeparate == profile_glStencilOpSeparate) glad_glStencilOpSeparate = real_glStencilOpSeparate;
+	if(glad_glStencilFuncSeparate == profile_glStencilFuncSeparate) glad_glStencilFuncSeparate = real_glStencilFuncSeparate;
+	if(glad_glStencilMaskSeparate == profile_glStencilMaskSeparate) glad_glStencilMaskSeparate = real_glStencilMaskSeparate;
+	if(glad_glAttachShader == profile_glAttachShader) glad_glAttachShader = real_glAttachShader;
+	if(glad_glBindAttribLocation == profile_glBindAttribLocation) glad_glBindAttribLocation = real_glBindAttribLocation;
+	if(glad_glCompileShader == profile_glCompileShader) glad_glCompileShader = real_glCompileShader;
+	if(glad_glCreateProgram == profile_glCreateProgram) glad_glCreateProgram = real_glCreateProgram;
+	if(glad_glCreateShader == profile_glCreateShader) glad_glCreateShader = real_glCreateShader;
+	if(glad_glDeleteProgram == profile_glDeleteProgram) glad_glDeleteProgram = real_glDeleteProgram;
+	if(glad_glDeleteShader == profile_glDeleteShader) glad_glDeleteShader = real_glDeleteShader;
+	if(glad_glDetachShader == profile_glDetachShader) glad_glDetachShader = real_glDetachShader;
+	if(glad_glDisableVertexAttribArray == profile_glDisableVertexAttribArray) glad_glDisableVertexAttribArray = real_glDisableVertexAttribArray;
+	if(glad_glEnableVertexAttribArray == profile_glEnableVertexAttribArray) glad_glEnableVertexAttribArray = real_glEnableVertexAttribArray;
+	if(glad_glGetActiveAttrib == profile_glGetActiveAttrib) glad_glGetActiveAttrib = real_glGetActiveAttrib;
+	if(glad_glGetActiveUniform == profile_glGetActiveUniform) glad_glGetActiveUniform = real_glGetActiveUniform;
+	if(glad_glGetAttachedShaders == profile_glGetAttachedShaders) glad_glGetAttachedShaders = real_glGetAttachedShaders;
+	if(glad_glGetAttribLocation == profile_glGetAttribLocation) glad_glGetAttribLocation = real_glGetAttribLocation;
+	if(glad_glGetProgramiv == profile_glGetProgramiv) glad_glGetProgramiv = real_glGetProgramiv;
+	if(glad_glGetProgramInfoLog == profile_glGetProgramInfoLog) glad_glGetProgramInfoLog = real_glGetProgramInfoLog;
+	if(glad_glGetShaderiv == profile_glGetShaderiv) glad_glGetShaderiv = real_glGetShaderiv;
+	if(glad_glGetShaderInfoLog == profile_glGetShaderInfoLog) glad_glGetShaderInfoLog = real_glGetShaderInfoLog;
+	if(glad_glGetShaderSource == profile_glGetShaderSource) glad_glGetShaderSource = real_glGetShaderSource;
+	if(glad_glGetUniformLocation == profile_glGetUniformLocation) glad_glGetUniformLocation = real_glGetUniformLocation;
+	if(glad_glGetUniformfv == profile_glGetUniformfv) glad_glGetUniformfv = real_glGetUniformfv;
+	if(glad_glGetUniformiv == profile_glGetUniformiv) glad_glGetUniformiv = real_glGetUniformiv;
+	if(glad_glGetVertexAttribdv == profile_glGetVertexAttribdv) glad_glGetVertexAttribdv = real_glGetVertexAttribdv;
+	if(glad_glGetVertexAttribfv == profile_glGetVertexAttribfv) glad_glGetVertexAttribfv = real_glGetVertexAttribfv;
+	if(glad_glGetVertexAttribiv == profile_glGetVertexAttribiv) glad_glGetVertexAttribiv = real_glGetVertexAttribiv;
+	if(glad_glGetVertexAttribPointerv == profile_glGetVertexAttribPointerv) glad_glGetVertexAttribPointerv = real_glGetVertexAttribPointerv;
+	if(glad_glIsProgram == profile_glIsProgram) glad_glIsProgram = real_glIsProgram;
+	if(glad_glIsShader == profile_glIsShader) glad_glIsShader = real_glIsShader;
+	if(glad_glLinkProgram == profile_glLinkProgram) glad_glLinkProgram = real_glLinkProgram;
+	if(glad_glShaderSource == profile_glShaderSource) glad_glShaderSource = real_glShaderSource;
+	if(glad_glUseProgram == profile_glUseProgram) glad_glUseProgram = real_glUseProgram;
+	if(glad_glUniform1f == profile_glUniform1f) glad_glUniform1f = real_glUniform1f;
+	if(glad_glUniform2f == profile_glUniform2f) glad_glUniform2f = real_glUniform2f;
+	if(glad_glUniform3f == profile_glUniform3f) glad_glUniform3f = real_glUniform3f;
+	if(glad_glUniform4f == profile_glUniform4f) glad_glUniform4f = real_glUniform4f;
+	if(glad_glUniform1i == profile_glUniform1i) glad_glUniform1i = real_glUniform1i;
+	if(glad_glUniform2i == profile_glUniform2i) glad_glUniform2i = real_glUniform2i;
+	if(glad_glUniform3i == profile_glUniform3i) glad_glUniform3i = real_glUniform3i;
+	if(glad_glUniform4i == profile_glUniform4i) glad_glUniform4i = real_glUniform4i;
+	if(glad_glUniform1fv == profile_glUniform1fv) glad_glUniform1fv = real_glUniform1fv;
+	if(glad_glUniform2fv == profile_glUniform2fv) glad_glUniform2fv = real_glUniform2fv;
+	if(glad_glUniform3fv == profile_glUniform3fv) glad_glUniform3fv = real_glUniform3fv;
+	if(glad_glUniform4fv == profile_glUniform4fv) glad_glUniform4fv = real_glUniform4fv;
+	if(glad_glUniform1iv == profile_glUniform1iv) glad_glUniform1iv = real_glUniform1iv;
+	if(glad_glUniform2iv == profile_glUniform2iv) glad_glUniform2iv = real_glUniform2iv;
+	if(glad_glUniform3iv == profile_glUniform3iv) glad_glUniform3iv = real_glUniform3iv;
+	if(glad_glUniform4iv == profile_glUniform4iv) glad_glUniform4iv = real_glUniform4iv;
+	if(glad_glUniformMatrix2fv == profile_glUniformMatrix2fv) glad_glUniformMatrix2fv = real_glUniformMatrix2fv;
+	if(glad_glUniformMatrix3fv == profile_glUniformMatrix3fv) glad_glUniformMatrix3fv = real_glUniformMatrix3fv;
+	if(glad_glUniformMatrix4fv == profile_glUniformMatrix4fv) glad_glUniformMatrix4fv = real_glUniformMatrix4fv;
+	if(glad_glValidateProgram == profile_glValidateProgram) glad_glValidateProgram = real_glValidateProgram;
+	if(glad_glVertexAttrib1d == profile_glVertexAttrib1d) glad_glVertexAttrib1d = real_glVertexAttrib1d;
+	if(glad_glVertexAttrib1dv == profile_glVertexAttrib1dv) glad_glVertexAttrib1dv = real_glVertexAttrib1dv;
+	if(glad_glVertexAttrib1f == profile_glVertexAttrib1f) glad_glVertexAttrib1f = real_glVertexAttrib1f;
+	if(glad_glVertexAttrib1fv == profile_glVertexAttrib1fv) glad_glVertexAttrib1fv = real_glVertexAttrib1fv;
+	if(glad_glVertexAttrib1s == profile_glVertexAttrib1s) glad_glVertexAttrib1s = real_glVertexAttrib1s;
+	if(glad_glVertexAttrib1sv == profile_glVertexAttrib1sv) glad_glVertexAttrib1sv = real_glVertexAttrib1sv;
+	if(glad_glVertexAttrib2d == profile_glVertexAttrib2d) glad_glVertexAttrib2d = real_glVertexAttrib2d;
+	if(glad_glVertexAttrib2dv == profile_glVertexAttrib2dv) glad_glVertexAttrib2dv = real_glVertexAttrib2dv;
+	if(glad_glVertexAttrib2f == profile_glVertexAttrib2f) glad_glVertexAttrib2f = real_glVertexAttrib2f;
+	if(glad_glVertexAttrib2fv == profile_glVertexAttrib2fv) glad_glVertexAttrib2fv = real_glVertexAttrib2fv;
+	if(glad_glVertexAttrib2s == profile_glVertexAttrib2s) glad_glVertexAttrib2s = real_glVertexAttrib2s;
+	if(glad_glVertexAttrib2sv == profile_glVertexAttrib2sv) glad_glVertexAttrib2sv = real_glVertexAttrib2sv;
+	if(glad_glVertexAttrib3d == profile_glVertexAttrib3d) glad_glVertexAttrib3d = real_glVertexAttrib3d;
+	if(glad_glVertexAttrib3dv == profile_glVertexAttrib3dv) glad_glVertexAttrib3dv = real_glVertexAttrib3dv;
+	if(glad_glVertexAttrib3f == profile_glVertexAttrib3f) glad_glVertexAttrib3f = real_glVertexAttrib3f;
+	if(glad_glVertexAttrib3fv == profile_glVertexAttrib3fv) glad_glVertexAttrib3fv = real_glVertexAttrib3fv;
+	if(glad_glVertexAttrib3s == profile_glVertexAttrib3s) glad_glVertexAttrib3s = real_glVertexAttrib3s;
+	if(glad_glVertexAttrib3sv == profile_glVertexAttrib3sv) glad_glVertexAttrib3sv = real_glVertexAttrib3sv;
+	if(glad_glVertexAttrib4Nbv == profile_glVertexAttrib4Nbv) glad_glVertexAttrib4Nbv = real_glVertexAttrib4Nbv;
+	if(glad_glVertexAttrib4Niv == profile_glVertexAttrib4Niv) glad_glVertexAttrib4Niv = real_glVertexAttrib4Niv;
+	if(glad_glVertexAttrib4Nsv == profile_glVertexAttrib4Nsv) glad_glVertexAttrib4Nsv = real_glVertexAttrib4Nsv;
+	if(glad_glVertexAttrib4Nub == profile_glVertexAttrib4Nub) glad_glVertexAttrib4Nub = real_glVertexAttrib4Nub;
+	if(glad_glVertexAttrib4Nubv == profile_glVertexAttrib4Nubv) glad_glVertexAttrib4Nubv = real_glVertexAttrib4Nubv;
+	if(glad_glVertexAttrib4Nuiv == profile_glVertexAttrib4Nuiv) glad_glVertexAttrib4Nuiv = real_glVertexAttrib4Nuiv;
+	if(glad_glVertexAttrib4Nusv == profile_glVertexAttrib4Nusv) glad_glVertexAttrib4Nusv = real_glVertexAttrib4Nusv;
+	if(glad_glVertexAttrib4bv == profile_glVertexAttrib4bv) glad_glVertexAttrib4bv = real_glVertexAttrib4bv;
+	if(glad_glVertexAttrib4d == profile_glVertexAttrib4d) glad_glVertexAttrib4d = real_glVertexAttrib4d;
+	if(glad_glVertexAttrib4dv == profile_glVertexAttrib4dv) glad_glVertexAttrib4dv = real_glVertexAttrib4dv;
+	if(glad_glVertexAttrib4f == profile_glVertexAttrib4f) glad_glVertexAttrib4f = real_glVertexAttrib4f;
+	if(glad_glVertexAttrib4fv == profile_glVertexAttrib4fv) glad_glVertexAttrib4fv = real_glVertexAttrib4fv;
+	if(glad_glVertexAttrib4iv == profile_glVertexAttrib4iv) glad_glVertexAttrib4iv = real_glVertexAttrib4iv;
+	if(glad_glVertexAttrib4s == profile_glVertexAttrib4s) glad_glVertexAttrib4s = real_glVertexAttrib4s;
+	if(glad_glVertexAttrib4sv == profile_glVertexAttrib4sv) glad_glVertexAttrib4sv = real_glVertexAttrib4sv;
+	if(glad_glVertexAttrib4ubv == profile_glVertexAttrib4ubv) glad_glVertexAttrib4ubv = real_glVertexAttrib4ubv;
+	if(glad_glVertexAttrib4uiv == profile_glVertexAttrib4uiv) glad_glVertexAttrib4uiv = real_glVertexAttrib4uiv;
+	if(glad_glVertexAttrib4usv == profile_glVertexAttrib4usv) glad_glVertexAttrib4usv = real_glVertexAttrib4usv;
+	if(glad_glVertexAttribPointer == profile_glVertexAttribPointer) glad_glVertexAttribPointer = real_glVertexAttribPointer;
+	if(glad_glUniformMatrix2x3fv == profile_glUniformMatrix2x3fv) glad_glUniformMatrix2x3fv = real_glUniformMatrix2x3fv;
+	if(glad_glUniformMatrix3x2fv == profile_glUniformMatrix3x2fv) glad_glUniformMatrix3x2fv = real_glUniformMatrix3x2fv;
+	if(glad_glUniformMatrix2x4fv == profile_glUniformMatrix2x4fv) glad_glUniformMatrix2x4fv = real_glUniformMatrix2x4fv;
+	if(glad_glUniformMatrix4x2fv == profile_glUniformMatrix4x2fv) glad_glUniformMatrix4x2fv = real_glUniformMatrix4x2fv;
+	if(glad_glUniformMatrix3x4fv == profile_glUniformMatrix3x4fv) glad_glUniformMatrix3x4fv = real_glUniformMatrix3x4fv;
+	if(glad_glUniformMatrix4x3fv == profile_glUniformMatrix4x3fv) glad_glUniformMatrix4x3fv = real_glUniformMatrix4x3fv;
+	if(glad_glColorMaski == profile_glColorMaski) glad_glColorMaski = real_glColorMaski;
+	if(glad_glGetBooleani_v == profile_glGetBooleani_v) glad_glGetBooleani_v = real_glGetBooleani_v;
+	if(glad_glGetIntegeri_v == profile_glGetIntegeri_v) glad_glGetIntegeri_v = real_glGetIntegeri_v;
+	if(glad_glEnablei == profile_glEnablei) glad_glEnablei = real_glEnablei;
+	if(glad_glDisablei == profile_glDisablei) glad_glDisablei = real_glDisablei;
+	if(glad_glIsEnabledi == profile_glIsEnabledi) glad_glIsEnabledi = real_glIsEnabledi;
+	if(glad_glBeginTransformFeedback == profile_glBeginTransformFeedback) glad_glBeginTransformFeedback = real_glBeginTransformFeedback;
+	if(glad_glEndTransformFeedback == profile_glEndTransformFeedback) glad_glEndTransformFeedback = real_glEndTransformFeedback;
+	if(glad_glBindBufferRange == profile_glBindBufferRange) glad_glBindBufferRange = real_glBindBufferRange;
+	if(glad_glBindBufferBase == profile_glBindBufferBase) glad_glBindBufferBase = real_glBindBufferBase;
+	if(glad_glTransformFeedbackVaryings == profile_glTransformFeedbackVaryings) glad_glTransformFeedbackVaryings = real_glTransformFeedbackVaryings;
+	if(glad_glGetTransformFeedbackVarying == profile_glGetTransformFeedbackVarying) glad_glGetTransformFeedbackVarying = real_glGetTransformFeedbackVarying;
+	if(glad_glClampColor == profile_glClampColor) glad_glClampColor = real_glClampColor;
+	if(glad_glBeginConditionalRender == profile_glBeginConditionalRender) glad_glBeginConditionalRender = real_glBeginConditionalRender;
+	if(glad_glEndConditionalRender == profile_glEndConditionalRender) glad_glEndConditionalRender = real_glEndConditionalRender;
+	if(glad_glVertexAttribIPointer == profile_glVertexAttribIPointer) glad_glVertexAttribIPointer = real_glVertexAttribIPointer;
+	if(glad_glGetVertexAttribIiv == profile_glGetVertexAttribIiv) glad_glGetVertexAttribIiv = real_glGetVertexAttribIiv;
+	if(glad_glGetVertexAttribIuiv == profile_glGetVertexAttribIuiv) glad_glGetVertexAttribIuiv = real_glGetVertexAttribIuiv;
+	if(glad_glVertexAttribI1i == profile_glVertexAttribI1i) glad_glVertexAttribI1i = real_glVertexAttribI1i;
+	if(glad_glVertexAttribI2i == profile_glVertexAttribI2i) glad_glVertexAttribI2i = real_glVertexAttribI2i;
+	if(glad_glVertexAttribI3i == profile_glVertexAttribI3i) glad_glVertexAttribI3i = real_glVertexAttribI3i;
+	if(glad_glVertexAttribI4i == profile_glVertexAttribI4i) glad_glVertexAttribI4i = real_glVertexAttribI4i;
+	if(glad_glVertexAttribI1ui == profile_glVertexAttribI1ui) glad_glVertexAttribI1ui = real_glVertexAttribI1ui;
+	if(glad_glVertexAttribI2ui == profile_glVertexAttribI2ui) glad_glVertexAttribI2ui = real_glVertexAttribI2ui;
+	if(glad_glVertexAttribI3ui == profile_glVertexAttribI3ui) glad_glVertexAttribI3ui = real_glVertexAttribI3ui;
+	if(glad_glVertexAttribI4ui == profile_glVertexAttribI4ui) glad_glVertexAttribI4ui = real_glVertexAttribI4ui;
+	if(glad_glVertexAttribI1iv == profile_glVertexAttribI1iv) glad_glVertexAttribI1iv = real_glVertexAttribI1iv;
+	if(glad_glVertexAttribI2iv == profile_glVertexAttribI2iv) glad_glVertexAttribI2iv = real_glVertexAttribI2iv;
+	if(glad_glVertexAttribI3iv == profile_glVertexAttribI3iv) glad_glVertexAttribI3iv = real_glVertexAttribI3iv;
+	if(glad_glVertexAttribI4iv == profile_glVertexAttribI4iv) glad_glVertexAttribI4iv = real_glVertexAttribI4iv;
+	if(glad_glVertexAttribI1uiv == profile_glVertexAttribI1uiv) glad_glVertexAttribI1uiv = real_glVertexAttribI1uiv;
+	if(glad_glVertexAttribI2uiv == profile_glVertexAttribI2uiv) glad_glVertexAttribI2uiv = real_glVertexAttribI2uiv;
+	if(glad_glVertexAttribI3uiv == profile_glVertexAttribI3uiv) glad_glVertexAttribI3uiv = real_glVertexAttribI3uiv;
+	if(glad_glVertexAttribI4uiv == profile_glVertexAttribI4uiv) glad_glVertexAttribI4uiv = real_glVertexAttribI4uiv;
+	if(glad_glVertexAttribI4bv == profile_glVertexAttribI4bv) glad_glVertexAttribI4bv = real_glVertexAttribI4bv;
+	if(glad_glVertexAttribI4sv == profile_glVertexAttribI4sv) glad_glVertexAttribI4sv = real_glVertexAttribI4sv;
+	if(glad_glVertexAttribI4ubv == profile_glVertexAttribI4ubv) glad_glVertexAttribI4ubv = real_glVertexAttribI4ubv;
+	if(glad_glVertexAttribI4usv == profile_glVertexAttribI4usv) glad_glVertexAttribI4usv = real_glVertexAttribI4usv;
+	if(glad_glGetUniformuiv == profile_glGetUniformuiv) glad_glGetUniformuiv = real_glGetUniformuiv;
+	if(glad_glBindFragDataLocation == profile_glBindFragDataLocation) glad_glBindFragDataLocation = real_glBindFragDataLocation;
+	if(glad_glGetFragDataLocation == profile_glGetFragDataLocation) glad_glGetFragDataLocation = real_glGetFragDataLocation;
+	if(glad_glUniform1ui == profile_glUniform1ui) glad_glUniform1ui = real_glUniform1ui;
+	if(glad_glUniform2ui == profile_glUniform2ui) glad_glUniform2ui = real_glUniform2ui;
+	if(glad_glUniform3ui == profile_glUniform3ui) glad_glUniform3ui = real_glUniform3ui;
+	if(glad_glUniform4ui == profile_glUniform4ui) glad_glUniform4ui = real_glUniform4ui;
+	if(glad_glUniform1uiv == profile_glUniform1uiv) glad_glUniform1uiv = real_glUniform1uiv;
+	if(glad_glUniform2uiv == profile_glUniform2uiv) glad_glUniform2uiv = real_glUniform2uiv;
+	if(glad_glUniform3uiv == profile_glUniform3uiv) glad_glUniform3uiv = real_glUniform3uiv;
+	if(glad_glUniform4uiv == profile_glUniform4uiv) glad_glUniform4uiv = real_glUniform4uiv;
+	if(glad_glTexParameterIiv == profile_glTexParameterIiv) glad_glTexParameterIiv = real_glTexParameterIiv;
+	if(glad_glTexParameterIuiv == profile_glTexParameterIuiv) glad_glTexParameterIuiv = real_glTexParameterIuiv;
+	if(glad_glGetTexParameterIiv == profile_glGetTexParameterIiv) glad_glGetTexParameterIiv = real_glGetTexParameterIiv;
+	if(glad_glGetTexParameterIuiv == profile_glGetTexParameterIuiv) glad_glGetTexParameterIuiv = real_glGetTexParameterIuiv;
+	if(glad_glClearBufferiv == profile_glClearBufferiv) glad_glClearBufferiv = real_glClearBufferiv;
+	if(glad_glClearBufferuiv == profile_glClearBufferuiv) glad_glClearBufferuiv = real_glClearBufferuiv;
+	if(glad_glClearBufferfv == profile_glClearBufferfv) glad_glClearBufferfv = real_glClearBufferfv;
+	if(glad_glClearBufferfi == profile_glClearBufferfi) glad_glClearBufferfi = real_glClearBufferfi;
+	if(glad_glGetStringi == profile_glGetStringi) glad_glGetStringi = real_glGetStringi;
+	if(glad_glIsRenderbuffer == profile_glIsRenderbuffer) glad_glIsRenderbuffer = real_glIsRenderbuffer;
+	if(glad_glBindRenderbuffer == profile_glBindRenderbuffer) glad_glBindRenderbuffer = real_glBindRenderbuffer;
+	if(glad_glDeleteRenderbuffers == profile_glDeleteRenderbuffers) glad_glDeleteRenderbuffers = real_glDeleteRenderbuffers;
+	if(glad_glGenRenderbuffers == profile_glGenRenderbuffers) glad_glGenRenderbuffers = real_glGenRenderbuffers;
+	if(glad_glRenderbufferStorage == profile_glRenderbufferStorage) glad_glRenderbufferStorage = real_glRenderbufferStorage;
+	if(glad_glGetRenderbufferParameteriv == profile_glGetRenderbufferParameteriv) glad_glGetRenderbufferParameteriv = real_glGetRenderbufferParameteriv;
+	if(glad_glIsFramebuffer == profile_glIsFramebuffer) glad_glIsFramebuffer = real_glIsFramebuffer;
+	if(glad_glBindFramebuffer == profile_glBindFramebuffer) glad_glBindFramebuffer = real_glBindFramebuffer;
+	if(glad_glDeleteFramebuffers == profile_glDeleteFramebuffers) glad_glDeleteFramebuffers = real_glDeleteFramebuffers;
+	if(glad_glGenFramebuffers == profile_glGenFramebuffers) glad_glGenFramebuffers = real_glGenFramebuffers;
+	if(glad_glCheckFramebufferStatus == profile_glCheckFramebufferStatus) glad_glCheckFramebufferStatus = real_glCheckFramebufferStatus;
+	if(glad_glFramebufferTexture1D == profile_glFramebufferTexture1D) glad_glFramebufferTexture1D = real_glFramebufferTexture1D;
+	if(glad_glFramebufferTexture2D == profile_glFramebufferTexture2D) glad_glFramebufferTexture2D = real_glFramebufferTexture2D;
+	if(glad_glFramebufferTexture3D == profile_glFramebufferTexture3D) glad_glFramebufferTexture3D = real_glFramebufferTexture3D;
+	if(glad_glFramebufferRenderbuffer == profile_glFramebufferRenderbuffer) glad_glFramebufferRenderbuffer = real_glFramebufferRenderbuffer;
+	if(glad_glGetFramebufferAttachmentParameteriv == profile_glGetFramebufferAttachmentParameteriv) glad_glGetFramebufferAttachmentParameteriv = real_glGetFramebufferAttachmentParameteriv;
+	if(glad_glGenerateMipmap == profile_glGenerateMipmap) glad_glGenerateMipmap = real_glGenerateMipmap;
+	if(glad_glBlitFramebuffer == profile_glBlitFramebuffer) glad_glBlitFramebuffer = real_glBlitFramebuffer;
+	if(glad_glRenderbufferStorageMultisample == profile_glRenderbufferStorageMultisample) glad_glRenderbufferStorageMultisample = real_glRenderbufferStorageMultisample;
+	if(glad_glFramebufferTextureLayer == profile_glFramebufferTextureLayer) glad_glFramebufferTextureLayer = real_glFramebufferTextureLayer;
+	if(glad_glMapBufferRange == profile_glMapBufferRange) glad_glMapBufferRange = real_glMapBufferRange;
+	if(glad_glFlushMappedBufferRange == profile_glFlushMappedBufferRange) glad_glFlushMappedBufferRange = real_glFlushMappedBufferRange;
+	if(glad_glBindVertexArray == profile_glBindVertexArray) glad_glBindVertexArray = real_glBindVertexArray;
+	if(glad_glDeleteVertexArrays == profile_glDeleteVertexArrays) glad_glDeleteVertexArrays = real_glDeleteVertexArrays;
+	if(glad_glGenVertexArrays == profile_glGenVertexArrays) glad_glGenVertexArrays = real_glGenVertexArrays;
+	if(glad_glIsVertexArray == profile_glIsVertexArray) glad_glIsVertexArray = real_glIsVertexArray;
+	if(glad_glDrawArraysInstanced == profile_glDrawArraysInstanced) glad_glDrawArraysInstanced = real_glDrawArraysInstanced;
+	if(glad_glDrawElementsInstanced == profile_glDrawElementsInstanced) glad_glDrawElementsInstanced = real_glDrawElementsInstanced;
+	if(glad_glTexBuffer == profile_glTexBuffer) glad_glTexBuffer = real_glTexBuffer;
+	if(glad_glPrimitiveRestartIndex == profile_glPrimitiveRestartIndex) glad_glPrimitiveRestartIndex = real_glPrimitiveRestartIndex;
+	if(glad_glCopyBufferSubData == profile_glCopyBufferSubData) glad_glCopyBufferSubData = real_glCopyBufferSubData;
+	if(glad_glGetUniformIndices == profile_glGetUniformIndices) glad_glGetUniformIndices = real_glGetUniformIndices;
+	if(glad_glGetActiveUniformsiv == profile_glGetActiveUniformsiv) glad_glGetActiveUniformsiv = real_glGetActiveUniformsiv;
+	if(glad_glGetActiveUniformName == profile_glGetActiveUniformName) glad_glGetActiveUniformName = real_glGetActiveUniformName;
+	if(glad_glGetUniformBlockIndex == profile_glGetUniformBlockIndex) glad_glGetUniformBlockIndex = real_glGetUniformBlockIndex;
+	if(glad_glGetActiveUniformBlockiv == profile_glGetActiveUniformBlockiv) glad_glGetActiveUniformBlockiv = real_glGetActiveUniformBlockiv;
+	if(glad_glGetActiveUniformBlockName == profile_glGetActiveUniformBlockName) glad_glGetActiveUniformBlockName = real_glGetActiveUniformBlockName;
+	if(glad_glUniformBlockBinding == profile_glUniformBlockBinding) glad_glUniformBlockBinding = real_glUniformBlockBinding;
+	if(glad_glDrawElementsBaseVertex == profile_glDrawElementsBaseVertex) glad_glDrawElementsBaseVertex = real_glDrawElementsBaseVertex;
+	if(glad_glDrawRangeElementsBaseVertex == profile_glDrawRangeElementsBaseVertex) glad_glDrawRangeElementsBaseVertex = real_glDrawRangeElementsBaseVertex;
+	if(glad_glDrawElementsInstancedBaseVertex == profile_glDrawElementsInstancedBaseVertex) glad_glDrawElementsInstancedBaseVertex = real_glDrawElementsInstancedBaseVertex;
+	if(glad_glMultiDrawElementsBaseVertex == profile_glMultiDrawElementsBaseVertex) glad_glMultiDrawElementsBaseVertex = real_glMultiDrawElementsBaseVertex;
+	if(glad_glProvokingVertex == profile_glProvokingVertex) glad_glProvokingVertex = real_glProvokingVertex;
+	if(glad_glFenceSync == profile_glFenceSync) glad_glFenceSync = real_glFenceSync;
+	if(glad_glIsSync == profile_glIsSync) glad_glIsSync = real_glIsSync;
+	if(glad_glDeleteSync == profile_glDeleteSync) glad_glDeleteSync = real_glDeleteSync;
+	if(glad_glClientWaitSync == profile_glClientWaitSync) glad_glClientWaitSync = real_glClientWaitSync;
+	if(glad_glWaitSync == profile_glWaitSync) glad_glWaitSync = real_glWaitSync;
+	if(glad_glGetInteger64v == profile_glGetInteger64v) glad_glGetInteger64v = real_glGetInteger64v;
+	if(glad_glGetSynciv == profile_glGetSynciv) glad_glGetSynciv = real_glGetSynciv;
+	if(glad_glGetInteger64i_v == profile_glGetInteger64i_v) glad_glGetInteger64i_v = real_glGetInteger64i_v;
+	if(glad_glGetBufferParameteri64v == profile_glGetBufferParameteri64v) glad_glGetBufferParameteri64v = real_glGetBufferParameteri64v;
+	if(glad_glFramebufferTexture == profile_glFramebufferTexture) glad_glFramebufferTexture = real_glFramebufferTexture;
+	if(glad_glTexImage2DMultisample == profile_glTexImage2DMultisample) glad_glTexImage2DMultisample = real_glTexImage2DMultisample;
+	if(glad_glTexImage3DMultisample == profile_glTexImage3DMultisample) glad_glTexImage3DMultisample = real_glTexImage3DMultisample;
+	if(glad_glGetMultisamplefv == profile_glGetMultisamplefv) glad_glGetMultisamplefv = real_glGetMultisamplefv;
+	if(glad_glSampleMaski == profile_glSampleMaski) glad_glSampleMaski = real_glSampleMaski;
+	if(glad_glBindFragDataLocationIndexed == profile_glBindFragDataLocationIndexed) glad_glBindFragDataLocationIndexed = real_glBindFragDataLocationIndexed;
+	if(glad_glGetFragDataIndex == profile_glGetFragDataIndex) glad_glGetFragDataIndex = real_glGetFragDataIndex;
+	if(glad_glGenSamplers == profile_glGenSamplers) glad_glGenSamplers = real_glGenSamplers;
+	if(glad_glDeleteSamplers == profile_glDeleteSamplers) glad_glDeleteSamplers = real_glDeleteSamplers;
+	if(glad_glIsSampler == profile_glIsSampler) glad_glIsSampler = real_glIsSampler;
+	if(glad_glBindSampler == profile_glBindSampler) glad_glBindSampler = real_glBindSampler;
+	if(glad_glSamplerParameteri == profile_glSamplerParameteri) glad_glSamplerParameteri = real_glSamplerParameteri;
+	if(glad_glSamplerParameteriv == profile_glSamplerParameteriv) glad_glSamplerParameteriv = real_glSamplerParameteriv;
+	if(glad_glSamplerParameterf == profile_glSamplerParameterf) glad_glSamplerParameterf = real_glSamplerParameterf;
+	if(glad_glSamplerParameterfv == profile_glSamplerParameterfv) glad_glSamplerParameterfv = real_glSamplerParameterfv;
+	if(glad_glSamplerParameterIiv == profile_glSamplerParameterIiv) glad_glSamplerParameterIiv = real_glSamplerParameterIiv;
+	if(glad_glSamplerParameterIuiv == profile_glSamplerParameterIuiv) glad_glSamplerParameterIuiv = real_glSamplerParameterIuiv;
+	if(glad_glGetSamplerParameteriv == profile_glGetSamplerParameteriv) glad_glGetSamplerParameteriv = real_glGetSamplerParameteriv;
+	if(glad_glGetSamplerParameterIiv == profile_glGetSamplerParameterIiv) glad_glGetSamplerParameterIiv = real_glGetSamplerParameterIiv;
+	if(glad_glGetSamplerParameterfv == profile_glGetSamplerParameterfv) glad_glGetSamplerParameterfv = real_glGetSamplerParameterfv;
+	if(glad_glGetSamplerParameterIuiv == profile_glGetSamplerParameterIuiv) glad_glGetSamplerParameterIuiv = real_glGetSamplerParameterIuiv;
+	if(glad_glQueryCounter == profile_glQueryCounter) glad_glQueryCounter = real_glQueryCounter;
+	if(glad_glGetQueryObjecti64v == profile_glGetQueryObjecti64v) glad_glGetQueryObjecti64v = real_glGetQueryObjecti64v;
+	if(glad_glGetQueryObjectui64v == profile_glGetQueryObjectui64v) glad_glGetQueryObjectui64v = real_glGetQueryObjectui64v;
+	if(glad_glVertexAttribDivisor == profile_glVertexAttribDivisor) glad_glVertexAttribDivisor = real_glVertexAttribDivisor;
+	if(glad_glVertexAttribP1ui == profile_glVertexAttribP1ui) glad_glVertexAttribP1ui = real_glVertexAttribP1ui;
+	if(glad_glVertexAttribP1uiv == profile_glVertexAttribP1uiv) glad_glVertexAttribP1uiv = real_glVertexAttribP1uiv;
+	if(glad_glVertexAttribP2ui == profile_glVertexAttribP2ui) glad_glVertexAttribP2ui = real_glVertexAttribP2ui;
+	if(glad_glVertexAttribP2uiv == profile_glVertexAttribP2uiv) glad_glVertexAttribP2uiv = real_glVertexAttribP2uiv;
+	if(glad_glVertexAttribP3ui == profile_glVertexAttribP3ui) glad_glVertexAttribP3ui = real_glVertexAttribP3ui;
+	if(glad_glVertexAttribP3uiv == profile_glVertexAttribP3uiv) glad_glVertexAttribP3uiv = real_glVertexAttribP3uiv;
+	if(glad_glVertexAttribP4ui == profile_glVertexAttribP4ui) glad_glVertexAttribP4ui = real_glVertexAttribP4ui;
+	if(glad_glVertexAttribP4uiv == profile_glVertexAttribP4uiv) glad_glVertexAttribP4uiv = real_glVertexAttribP4uiv;
+	if(glad_glVertexP2ui == profile_glVertexP2ui) glad_glVertexP2ui = real_glVertexP2ui;
+	if(glad_glVertexP2uiv == profile_glVertexP2uiv) glad_glVertexP2uiv = real_glVertexP2uiv;
+	if(glad_glVertexP3ui == profile_glVertexP3ui) glad_glVertexP3ui = real_glVertexP3ui;
+	if(glad_glVertexP3uiv == profile_glVertexP3uiv) glad_glVertexP3uiv = real_glVertexP3uiv;
+	if(glad_glVertexP4ui == profile_glVertexP4ui) glad_glVertexP4ui = real_glVertexP4ui;
+	if(glad_glVertexP4uiv == profile_glVertexP4uiv) glad_glVertexP4uiv = real_glVertexP4uiv;
+	if(glad_glTexCoordP1ui == profile_glTexCoordP1ui) glad_glTexCoordP1ui = real_glTexCoordP1ui;
+	if(glad_glTexCoordP1uiv == profile_glTexCoordP1uiv) glad_glTexCoordP1uiv = real_glTexCoordP1uiv;
+	if(glad_glTexCoordP2ui == profile_glTexCoordP2ui) glad_glTexCoordP2ui = real_glTexCoordP2ui;
+	if(glad_glTexCoordP2uiv == profile_glTexCoordP2uiv) glad_glTexCoordP2uiv = real_glTexCoordP2uiv;
+	if(glad_glTexCoordP3ui == profile_glTexCoordP3ui) glad_glTexCoordP3ui = real_glTexCoordP3ui;
+	if(glad_glTexCoordP3uiv == profile_glTexCoordP3uiv) glad_glTexCoordP3uiv = real_glTexCoordP3uiv;
+	if(glad_glTexCoordP4ui == profile_glTexCoordP4ui) glad_glTexCoordP4ui = real_glTexCoordP4ui;
+	if(glad_glTexCoordP4uiv == profile_glTexCoordP4uiv) glad_glTexCoordP4uiv = real_glTexCoordP4uiv;
+	if(glad_glMultiTexCoordP1ui == profile_glMultiTexCoordP1ui) glad_glMultiTexCoordP1ui = real_glMultiTexCoordP1ui;
+	if(glad_glMultiTexCoordP1uiv == profile_glMultiTexCoordP1uiv) glad_glMultiTexCoordP1uiv = real_glMultiTexCoordP1uiv;
+	if(glad_glMultiTexCoordP2ui == profile_glMultiTexCoordP2ui) glad_glMultiTexCoordP2ui = real_glMultiTexCoordP2ui;
+	if(glad_glMultiTexCoordP2uiv == profile_glMultiTexCoordP2uiv) glad_glMultiTexCoordP2uiv = real_glMultiTexCoordP2uiv;
+	if(glad_glMultiTexCoordP3ui == profile_glMultiTexCoordP3ui) glad_glMultiTexCoordP3ui = real_glMultiTexCoordP3ui;
+	if(glad_glMultiTexCoordP3uiv == profile_glMultiTexCoordP3uiv) glad_glMultiTexCoordP3uiv = real_glMultiTexCoordP3uiv;
+	if(glad_glMultiTexCoordP4ui == profile_glMultiTexCoordP4ui) glad_glMultiTexCoordP4ui = real_glMultiTexCoordP4ui;
+	if(glad_glMultiTexCoordP4uiv == profile_glMultiTexCoordP4uiv) glad_glMultiTexCoordP4uiv = real_glMultiTexCoordP4uiv;
+	if(glad_glNormalP3ui == profile_glNormalP3ui) glad_glNormalP3ui = real_glNormalP3ui;
+	if(glad_glNormalP3uiv == profile_glNormalP3uiv) glad_glNormalP3uiv = real_glNormalP3uiv;
+	if(glad_glColorP3ui == profile_glColorP3ui) glad_glColorP3ui = real_glColorP3ui;
+	if(glad_glColorP3uiv == profile_glColorP3uiv) glad_glColorP3uiv = real_glColorP3uiv;
+	if(glad_glColorP4ui == profile_glColorP4ui) glad_glColorP4ui = real_glColorP4ui;
+	if(glad_glColorP4uiv == profile_glColorP4uiv) glad_glColorP4uiv = real_glColorP4uiv;
+	if(glad_glSecondaryColorP3ui == profile_glSecondaryColorP3ui) glad_glSecondaryColorP3ui = real_glSecondaryColorP3ui;
+	if(glad_glSecondaryColorP3uiv == profile_glSecondaryColorP3uiv) glad_glSecondaryColorP3uiv = real_glSecondaryColorP3uiv;
+	if(glad_glBufferStorage == profile_glBufferStorage) glad_glBufferStorage = real_glBufferStorage;
+	if(glad_glDebugMessageControlARB == profile_glDebugMessageControlARB) glad_glDebugMessageControlARB = real_glDebugMessageControlARB;
+	if(glad_glDebugMessageInsertARB == profile_glDebugMessageInsertARB) glad_glDebugMessageInsertARB = real_glDebugMessageInsertARB;
+	if(glad_glDebugMessageCallbackARB == profile_glDebugMessageCallbackARB) glad_glDebugMessageCallbackARB = real_glDebugMessageCallbackARB;
+	if(glad_glGetDebugMessageLogARB == profile_glGetDebugMessageLogARB) glad_glGetDebugMessageLogARB = real_glGetDebugMessageLogARB;
+	if(glad_glGetProgramBinary == profile_glGetProgramBinary) glad_glGetProgramBinary = real_glGetProgramBinary;
+	if(glad_glProgramBinary == profile_glProgramBinary) glad_glProgramBinary = real_glProgramBinary;
+	if(glad_glProgramParameteri == profile_glProgramParameteri) glad_glProgramParameteri = real_glProgramParameteri;
+	if(glad_glMaxShaderCompilerThreadsARB == profile_glMaxShaderCompilerThreadsARB) glad_glMaxShaderCompilerThreadsARB = real_glMaxShaderCompilerThreadsARB;
+	if(glad_glDebugMessageControl == profile_glDebugMessageControl) glad_glDebugMessageControl = real_glDebugMessageControl;
+	if(glad_glDebugMessageInsert == profile_glDebugMessageInsert) glad_glDebugMessageInsert = real_glDebugMessageInsert;
+	if(glad_glDebugMessageCallback == profile_glDebugMessageCallback) glad_glDebugMessageCallback = real_glDebugMessageCallback;
+	if(glad_glGetDebugMessageLog == profile_glGetDebugMessageLog) glad_glGetDebugMessageLog = real_glGetDebugMessageLog;
+	if(glad_glPushDebugGroup == profile_glPushDebugGroup) glad_glPushDebugGroup = real_glPushDebugGroup;
+	if(glad_glPopDebugGroup == profile_glPopDebugGroup) glad_glPopDebugGroup = real_glPopDebugGroup;
+	if(glad_glObjectLabel == profile_glObjectLabel) glad_glObjectLabel = real_glObjectLabel;
+	if(glad_glGetObjectLabel == profile_glGetObjectLabel) glad_glGetObjectLabel = real_glGetObjectLabel;
+	if(glad_glObjectPtrLabel == profile_glObjectPtrLabel) glad_glObjectPtrLabel = real_glObjectPtrLabel;
+	if(glad_glGetObjectPtrLabel == profile_glGetObjectPtrLabel) glad_glGetObjectPtrLabel = real_glGetObjectPtrLabel;
+	if(glad_glMaxShaderCompilerThreadsKHR == profile_glMaxShaderCompilerThreadsKHR) glad_glMaxShaderCompilerThreadsKHR = real_glMaxShaderCompilerThreadsKHR;
+	profile_enabled = 0;
+}
+
+int gladProfileEnabled(void) {
+    return profile_enabled;
+}
+
+void gladProfileReset(void) {
+    unsigned int index;
+    for(index = 0; index < sizeof(stats) / sizeof(stats[0]); index++) {
+        stats[index].calls = 0;
+        stats[index].nanoseconds = 0;
+    }
+    for(index = 0; index < GLAD_PROFILE_MAX_SCOPES; index++) {
+        scope_stats[index].calls = 0;
+        scope_stats[index].nanoseconds = 0;
+    }
+}
+
+unsigned int gladProfileStats(const struct gladProfileStat **out) {
+    *out = stats;
+    return sizeof(stats) / sizeof(stats[0]);
+}
+
+const struct gladProfileScopeStat *gladProfileScopeStats(void) {
+    return scope_stats;
+}
+
+#else
+
+unsigned int gladProfileScope = 0;
+
+int gladProfileEnable(void) {
+    return 0;
+}
+
+void gladProfileDisable(void) {
+}
+
+int gladProfileEnabled(void) {
+    return 0;
+}
+
+void gladProfileReset(void) {
+}
+
+unsigned int gladProfileStats(const struct gladProfileStat **out) {
+    *out = NULL;
+    return 0;
+}
+
+const struct gladProfileScopeStat *gladProfileScopeStats(void) {
+    return NULL;
+}
+
+#endif
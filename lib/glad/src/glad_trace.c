@@ -0,0 +1,1018 @@
+/*
+
+    GL call trace capture and replay, see glad/glad_trace.h for the format.
+    The per-function shims and the replay dispatcher are generated into
+    glad_trace_calls.h by lib/glad/gen_shims.py.
+
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <glad/glad_trace.h>
+
+#define TRACE_MAGIC 0x52544c47u /* "GLTR" */
+#define TRACE_OP_FRAME 0xFFFFu
+#define TRACE_OP_BLOB 0xFFFEu
+#define TRACE_OP_BUFFER_DATA 0xFFFDu
+#define TRACE_TAG_NULL 0u
+#define TRACE_TAG_OFFSET 0xFFFFFFFEu
+#define TRACE_TAG_UNSUPPORTED 0xFFFFFFFFu
+#define TRACE_FLUSH_SIZE (1u << 20)
+#define TRACE_BLOB_ALIGNMENT 16
+#define TRACE_MAX_MAPPINGS 8
+#define TRACE_SCRATCH_SLOTS 8
+#define TRACE_SCRATCH_DEFAULT 4096
+
+enum {
+    TRACE_NS_BUFFER,
+    TRACE_NS_TEXTURE,
+    TRACE_NS_VERTEX_ARRAY,
+    TRACE_NS_FRAMEBUFFER,
+    TRACE_NS_RENDERBUFFER,
+    TRACE_NS_SAMPLER,
+    TRACE_NS_PROGRAM,
+    TRACE_NS_QUERY,
+    TRACE_NS_COUNT
+};
+
+struct trace_bytes {
+    unsigned char *data;
+    size_t size;
+    size_t capacity;
+};
+
+static void bytes_reserve(struct trace_bytes *bytes, size_t size) {
+    if(bytes->size + size > bytes->capacity) {
+        size_t capacity = bytes->capacity ? bytes->capacity : 4096;
+        while(capacity < bytes->size + size) {
+            capacity *= 2;
+        }
+        bytes->data = (unsigned char *)realloc(bytes->data, capacity);
+        bytes->capacity = capacity;
+    }
+}
+
+static void bytes_append(struct trace_bytes *bytes, const void *data, size_t size) {
+    bytes_reserve(bytes, size);
+    memcpy(bytes->data + bytes->size, data, size);
+    bytes->size += size;
+}
+
+static void bytes_free(struct trace_bytes *bytes) {
+    free(bytes->data);
+    bytes->data = NULL;
+    bytes->size = 0;
+    bytes->capacity = 0;
+}
+
+static unsigned long long trace_hash(const void *data, size_t size) {
+    const unsigned char *bytes = (const unsigned char *)data;
+    unsigned long long hash = 0x9E3779B97F4A7C15ull ^ (unsigned long long)size;
+    unsigned long long word;
+
+    while(size >= 8) {
+        memcpy(&word, bytes, 8);
+        word *= 0xFF51AFD7ED558CCDull;
+        word ^= word >> 33;
+        hash = (hash ^ word) * 0xC4CEB9FE1A85EC53ull;
+        hash = (hash << 31) | (hash >> 33);
+        bytes += 8;
+        size -= 8;
+    }
+    word = 0;
+    memcpy(&word, bytes, size);
+    hash = (hash ^ word) * 0xC4CEB9FE1A85EC53ull;
+    hash ^= hash >> 29;
+    return hash;
+}
+
+
+/* Capture ##################################################################*/
+
+struct trace_blob_slot {
+    unsigned long long hash;
+    size_t size;
+    size_t offset;
+    unsigned int id;
+};
+
+struct trace_mapping {
+    GLenum target;
+    void *pointer;
+    GLsizeiptr length;
+    GLbitfield access;
+};
+
+static FILE *trace_file = NULL;
+static size_t trace_file_size = 0;
+static int trace_active = 0;
+static int trace_setup_done = 0;
+static unsigned int trace_frames_left = 0;
+static struct trace_bytes trace_stream;
+static struct trace_bytes trace_call;
+static struct trace_bytes trace_temp;
+static unsigned int trace_call_id = 0;
+static struct trace_blob_slot *trace_blobs = NULL;
+static unsigned int trace_blob_mask = 0;
+static unsigned int trace_blob_count = 0;
+static GLuint trace_unpack_buffer = 0;
+static GLint trace_unpack_alignment = 4;
+static GLint trace_unpack_row_length = 0;
+static GLint trace_unpack_skip_pixels = 0;
+static GLint trace_unpack_skip_rows = 0;
+static GLint trace_unpack_skip_images = 0;
+static GLint trace_unpack_image_height = 0;
+static struct trace_mapping trace_mappings[TRACE_MAX_MAPPINGS];
+
+static void trace_flush(void) {
+    if(trace_stream.size > 0) {
+        fwrite(trace_stream.data, 1, trace_stream.size, trace_file);
+        trace_file_size += trace_stream.size;
+        trace_stream.size = 0;
+    }
+}
+
+static void trace_write_u16(unsigned short value) {
+    bytes_append(&trace_stream, &value, sizeof(value));
+}
+
+static void trace_write_u32(unsigned int value) {
+    bytes_append(&trace_stream, &value, sizeof(value));
+}
+
+static void trace_grow_blobs(void) {
+    unsigned int old_capacity = trace_blobs ? trace_blob_mask + 1 : 0;
+    unsigned int capacity = old_capacity ? old_capacity * 2 : 1024;
+    struct trace_blob_slot *old = trace_blobs;
+    unsigned int index;
+
+    trace_blobs = (struct trace_blob_slot *)calloc(capacity, sizeof(*trace_blobs));
+    trace_blob_mask = capacity - 1;
+    for(index = 0; index < old_capacity; index++) {
+        if(old[index].id != 0) {
+            unsigned int slot = (unsigned int)old[index].hash & trace_blob_mask;
+            while(trace_blobs[slot].id != 0) {
+                slot = (slot + 1) & trace_blob_mask;
+            }
+            trace_blobs[slot] = old[index];
+        }
+    }
+    free(old);
+}
+
+/* Hashes can collide, the bytes written the first time decide. A blob is
+   either still whole in the stream or whole in the file. */
+static int trace_blob_equals(const struct trace_blob_slot *slot, const void *data, size_t size) {
+    const unsigned char *bytes = (const unsigned char *)data;
+    unsigned char chunk[4096];
+    size_t done = 0;
+    int equal;
+
+    if(slot->offset >= trace_file_size) {
+        return memcmp(trace_stream.data + (slot->offset - trace_file_size), data, size) == 0;
+    }
+
+    equal = fseek(trace_file, (long)slot->offset, SEEK_SET) == 0;
+    while(equal && done < size) {
+        size_t length = size - done < sizeof(chunk) ? size - done : sizeof(chunk);
+        equal = fread(chunk, 1, length, trace_file) == length && memcmp(chunk, bytes + done, length) == 0;
+        done += length;
+    }
+    fseek(trace_file, 0, SEEK_END);
+    return equal;
+}
+
+/* Returns the id of `data`, writing it to the stream the first time it is seen. */
+static unsigned int trace_blob(const void *data, size_t size) {
+    unsigned long long hash = trace_hash(data, size);
+    unsigned int slot;
+
+    if(trace_blobs == NULL || (trace_blob_count + 1) * 2 > trace_blob_mask + 1) {
+        trace_grow_blobs();
+    }
+
+    slot = (unsigned int)hash & trace_blob_mask;
+    while(trace_blobs[slot].id != 0) {
+        if(trace_blobs[slot].hash == hash && trace_blobs[slot].size == size
+            && trace_blob_equals(&trace_blobs[slot], data, size)) {
+            return trace_blobs[slot].id;
+        }
+        slot = (slot + 1) & trace_blob_mask;
+    }
+
+    trace_blob_count++;
+    trace_blobs[slot].hash = hash;
+    trace_blobs[slot].size = size;
+    trace_blobs[slot].id = trace_blob_count;
+
+    trace_write_u16(TRACE_OP_BLOB);
+    trace_write_u32(trace_blob_count);
+    trace_write_u32((unsigned int)size);
+    while((trace_file_size + trace_stream.size) % TRACE_BLOB_ALIGNMENT != 0) {
+        bytes_append(&trace_stream, "", 1);
+    }
+    trace_blobs[slot].offset = trace_file_size + trace_stream.size;
+    if(size >= TRACE_FLUSH_SIZE / 16) {
+        trace_flush();
+        fwrite(data, 1, size, trace_file);
+        trace_file_size += size;
+    } else {
+        bytes_append(&trace_stream, data, size);
+    }
+
+    return trace_blob_count;
+}
+
+static void trace_begin_call(unsigned int id) {
+    trace_call_id = id;
+    trace_call.size = 0;
+}
+
+static void trace_end_call(void) {
+    trace_write_u16((unsigned short)trace_call_id);
+    trace_write_u32((unsigned int)trace_call.size);
+    bytes_append(&trace_stream, trace_call.data, trace_call.size);
+    if(trace_stream.size >= TRACE_FLUSH_SIZE) {
+        trace_flush();
+    }
+}
+
+static void trace_put(const void *value, size_t size) {
+    bytes_append(&trace_call, value, size);
+}
+
+static void trace_put_tag(unsigned int tag) {
+    trace_put(&tag, sizeof(tag));
+}
+
+static void trace_put_data(const void *data, size_t size) {
+    trace_put_tag(data == NULL ? TRACE_TAG_NULL : trace_blob(data, size));
+}
+
+static void trace_put_offset(const void *pointer) {
+    unsigned long long offset = (unsigned long long)(size_t)pointer;
+    if(pointer == NULL) {
+        trace_put_tag(TRACE_TAG_NULL);
+        return;
+    }
+    trace_put_tag(TRACE_TAG_OFFSET);
+    trace_put(&offset, sizeof(offset));
+}
+
+static void trace_put_pixels(const void *pixels, size_t size) {
+    if(trace_unpack_buffer != 0) {
+        trace_put_offset(pixels);
+    } else {
+        trace_put_data(pixels, size);
+    }
+}
+
+static void trace_put_unsupported(int present) {
+    trace_put_tag(present ? TRACE_TAG_UNSUPPORTED : TRACE_TAG_NULL);
+}
+
+static void trace_put_string(const GLchar *string, GLsizei length) {
+    size_t size;
+    if(string == NULL) {
+        trace_put_tag(TRACE_TAG_NULL);
+        return;
+    }
+    if(length < 0) {
+        trace_put_data(string, strlen(string) + 1);
+        return;
+    }
+    size = (size_t)length;
+    trace_temp.size = 0;
+    bytes_append(&trace_temp, string, size);
+    bytes_append(&trace_temp, "", 1);
+    trace_put_data(trace_temp.data, trace_temp.size);
+}
+
+/* String arrays are recorded as one blob of NUL-terminated strings. */
+static void trace_put_strings(GLsizei count, const GLchar *const*strings, const GLint *lengths) {
+    GLsizei index;
+    if(strings == NULL) {
+        trace_put_tag(TRACE_TAG_NULL);
+        return;
+    }
+    trace_temp.size = 0;
+    for(index = 0; index < count; index++) {
+        size_t length = (lengths != NULL && lengths[index] >= 0)
+            ? (size_t)lengths[index]
+            : strlen(strings[index]);
+        bytes_append(&trace_temp, strings[index], length);
+        bytes_append(&trace_temp, "", 1);
+    }
+    trace_put_data(trace_temp.data, trace_temp.size);
+}
+
+static size_t trace_param_count(GLenum pname) {
+    switch(pname) {
+    case GL_TEXTURE_BORDER_COLOR:
+    case GL_TEXTURE_SWIZZLE_RGBA:
+        return 4;
+    case GL_POINT_DISTANCE_ATTENUATION:
+        return 3;
+    default:
+        return 1;
+    }
+}
+
+/* Bytes from `pixels` to the end of the last pixel read, skips included.
+   1D images ignore the row and image unpack state, 2D ones the image state. */
+static size_t trace_image_size(GLenum format, GLenum type, GLsizei width, GLsizei height, GLsizei depth, int dimensions) {
+    size_t components;
+    size_t pixel_size;
+    size_t row_size;
+    size_t rows;
+    size_t alignment = trace_unpack_alignment > 0 ? (size_t)trace_unpack_alignment : 1;
+    GLsizei row_length = trace_unpack_row_length > 0 ? trace_unpack_row_length : width;
+    size_t skip_pixels = trace_unpack_skip_pixels > 0 ? (size_t)trace_unpack_skip_pixels : 0;
+    size_t skip_rows = dimensions > 1 && trace_unpack_skip_rows > 0 ? (size_t)trace_unpack_skip_rows : 0;
+    size_t skip_images = dimensions > 2 && trace_unpack_skip_images > 0 ? (size_t)trace_unpack_skip_images : 0;
+    size_t image_rows = dimensions > 2 && trace_unpack_image_height > 0 ? (size_t)trace_unpack_image_height : (size_t)height;
+
+    if(width <= 0 || height <= 0 || depth <= 0) {
+        return 0;
+    }
+
+    switch(format) {
+    case GL_RG:
+    case GL_RG_INTEGER:
+    case GL_LUMINANCE_ALPHA:
+        components = 2;
+        break;
+    case GL_RGB:
+    case GL_BGR:
+    case GL_RGB_INTEGER:
+    case GL_BGR_INTEGER:
+        components = 3;
+        break;
+    case GL_RGBA:
+    case GL_BGRA:
+    case GL_RGBA_INTEGER:
+    case GL_BGRA_INTEGER:
+        components = 4;
+        break;
+    default:
+        components = 1;
+        break;
+    }
+
+    switch(type) {
+    case GL_UNSIGNED_BYTE:
+    case GL_BYTE:
+        pixel_size = components;
+        break;
+    case GL_UNSIGNED_SHORT:
+    case GL_SHORT:
+    case GL_HALF_FLOAT:
+        pixel_size = components * 2;
+        break;
+    case GL_UNSIGNED_BYTE_3_3_2:
+    case GL_UNSIGNED_BYTE_2_3_3_REV:
+        pixel_size = 1;
+        break;
+    case GL_UNSIGNED_SHORT_5_6_5:
+    case GL_UNSIGNED_SHORT_5_6_5_REV:
+    case GL_UNSIGNED_SHORT_4_4_4_4:
+    case GL_UNSIGNED_SHORT_4_4_4_4_REV:
+    case GL_UNSIGNED_SHORT_5_5_5_1:
+    case GL_UNSIGNED_SHORT_1_5_5_5_REV:
+        pixel_size = 2;
+        break;
+    case GL_UNSIGNED_INT_8_8_8_8:
+    case GL_UNSIGNED_INT_8_8_8_8_REV:
+    case GL_UNSIGNED_INT_10_10_10_2:
+    case GL_UNSIGNED_INT_2_10_10_10_REV:
+    case GL_UNSIGNED_INT_24_8:
+    case GL_UNSIGNED_INT_10F_11F_11F_REV:
+    case GL_UNSIGNED_INT_5_9_9_9_REV:
+        pixel_size = 4;
+        break;
+    case GL_FLOAT_32_UNSIGNED_INT_24_8_REV:
+        pixel_size = 8;
+        break;
+    default:
+        pixel_size = components * 4;
+        break;
+    }
+
+    row_size = (size_t)row_length * pixel_size;
+    row_size = (row_size + alignment - 1) / alignment * alignment;
+    rows = (skip_images + (size_t)depth - 1) * image_rows + skip_rows + (size_t)height - 1;
+    return row_size * rows + (skip_pixels + (size_t)width) * pixel_size;
+}
+
+static void trace_hook_bind_buffer(GLenum target, GLuint buffer);
+static void trace_hook_pixel_store(GLenum pname, GLint param);
+static void trace_hook_map(GLenum target, void *pointer, GLintptr offset, GLsizeiptr length, GLbitfield access);
+static void trace_hook_unmap(GLenum target);
+
+
+/* Replay ###################################################################*/
+
+struct trace_key_slot {
+    unsigned long long key;
+    unsigned long long value;
+    int used;
+};
+
+struct trace_key_map {
+    struct trace_key_slot *slots;
+    unsigned int mask;
+    unsigned int count;
+};
+
+struct trace_name_map {
+    GLuint *names;
+    unsigned int capacity;
+};
+
+struct trace_blob_ref {
+    const unsigned char *data;
+    unsigned int size;
+};
+
+struct trace_replay_mapping {
+    GLenum target;
+    void *pointer;
+};
+
+struct gladTraceReplay {
+    unsigned char *data;
+    size_t size;
+    size_t cursor;
+    size_t call_end;
+    size_t frames_start;
+    unsigned int *ids;
+    unsigned int id_count;
+    struct trace_blob_ref *blobs;
+    unsigned int blob_capacity;
+    struct trace_name_map names[TRACE_NS_COUNT];
+    struct trace_key_map locations;
+    struct trace_key_map syncs;
+    struct trace_replay_mapping mappings[TRACE_MAX_MAPPINGS];
+    void *scratch[TRACE_SCRATCH_SLOTS];
+    size_t scratch_size[TRACE_SCRATCH_SLOTS];
+    GLuint program;
+    int unsupported;
+    struct gladTraceReplayStats stats;
+};
+
+static unsigned long long *key_map_find(struct trace_key_map *map, unsigned long long key, int insert) {
+    unsigned int slot;
+
+    if(insert && (map->slots == NULL || (map->count + 1) * 2 > map->mask + 1)) {
+        unsigned int old_capacity = map->slots ? map->mask + 1 : 0;
+        unsigned int capacity = old_capacity ? old_capacity * 2 : 256;
+        struct trace_key_slot *old = map->slots;
+        unsigned int index;
+
+        map->slots = (struct trace_key_slot *)calloc(capacity, sizeof(*map->slots));
+        map->mask = capacity - 1;
+        for(index = 0; index < old_capacity; index++) {
+            if(old[index].used) {
+                slot = (unsigned int)(trace_hash(&old[index].key, sizeof(old[index].key))) & map->mask;
+                while(map->slots[slot].used) {
+                    slot = (slot + 1) & map->mask;
+                }
+                map->slots[slot] = old[index];
+            }
+        }
+        free(old);
+    }
+    if(map->slots == NULL) {
+        return NULL;
+    }
+
+    slot = (unsigned int)trace_hash(&key, sizeof(key)) & map->mask;
+    while(map->slots[slot].used) {
+        if(map->slots[slot].key == key) {
+            return &map->slots[slot].value;
+        }
+        slot = (slot + 1) & map->mask;
+    }
+    if(!insert) {
+        return NULL;
+    }
+    map->slots[slot].used = 1;
+    map->slots[slot].key = key;
+    map->count++;
+    return &map->slots[slot].value;
+}
+
+static void trace_get(struct gladTraceReplay *r, void *value, size_t size) {
+    if(r->cursor + size > r->call_end) {
+        memset(value, 0, size);
+        r->unsupported = 1;
+        return;
+    }
+    memcpy(value, r->data + r->cursor, size);
+    r->cursor += size;
+}
+
+static const void *trace_get_data(struct gladTraceReplay *r) {
+    unsigned int tag;
+    trace_get(r, &tag, sizeof(tag));
+    if(tag == TRACE_TAG_NULL) {
+        return NULL;
+    }
+    if(tag == TRACE_TAG_OFFSET) {
+        unsigned long long offset;
+        trace_get(r, &offset, sizeof(offset));
+        return (const void *)(size_t)offset;
+    }
+    if(tag == TRACE_TAG_UNSUPPORTED || tag >= r->blob_capacity || r->blobs[tag].data == NULL) {
+        r->unsupported = 1;
+        return NULL;
+    }
+    return r->blobs[tag].data;
+}
+
+static const void *trace_get_offset(struct gladTraceReplay *r) {
+    return trace_get_data(r);
+}
+
+static void trace_get_unsupported(struct gladTraceReplay *r) {
+    unsigned int tag;
+    trace_get(r, &tag, sizeof(tag));
+    if(tag != TRACE_TAG_NULL) {
+        r->unsupported = 1;
+    }
+}
+
+static void *trace_scratch(struct gladTraceReplay *r, unsigned int slot, size_t size) {
+    if(size < TRACE_SCRATCH_DEFAULT) {
+        size = TRACE_SCRATCH_DEFAULT;
+    }
+    if(r->scratch_size[slot] < size) {
+        free(r->scratch[slot]);
+        r->scratch[slot] = malloc(size);
+        r->scratch_size[slot] = r->scratch[slot] ? size : 0;
+        if(r->scratch[slot] == NULL) {
+            r->unsupported = 1;
+        }
+    }
+    return r->scratch[slot];
+}
+
+static const GLchar *const*trace_get_strings(struct gladTraceReplay *r, unsigned int slot, GLsizei count) {
+    const GLchar *cursor = (const GLchar *)trace_get_data(r);
+    const GLchar **strings;
+    GLsizei index;
+
+    if(cursor == NULL || count <= 0) {
+        return NULL;
+    }
+    strings = (const GLchar **)trace_scratch(r, slot, (size_t)count * sizeof(*strings));
+    if(strings == NULL) {
+        return NULL;
+    }
+    for(index = 0; index < count; index++) {
+        strings[index] = cursor;
+        cursor += strlen(cursor) + 1;
+    }
+    return strings;
+}
+
+static GLuint trace_map_name(struct gladTraceReplay *r, unsigned int ns, GLuint name) {
+    struct trace_name_map *map = &r->names[ns];
+    if(name < map->capacity && map->names[name] != 0) {
+        return map->names[name];
+    }
+    return name;
+}
+
+static void trace_bind_name(struct gladTraceReplay *r, unsigned int ns, GLuint recorded, GLuint actual) {
+    struct trace_name_map *map = &r->names[ns];
+    if(recorded >= map->capacity) {
+        unsigned int capacity = map->capacity ? map->capacity : 64;
+        while(capacity <= recorded) {
+            capacity *= 2;
+        }
+        map->names = (GLuint *)realloc(map->names, capacity * sizeof(GLuint));
+        memset(map->names + map->capacity, 0, (capacity - map->capacity) * sizeof(GLuint));
+        map->capacity = capacity;
+    }
+    map->names[recorded] = actual;
+}
+
+static void trace_bind_names(struct gladTraceReplay *r, unsigned int ns, const GLuint *recorded, const GLuint *actual, GLsizei count) {
+    GLsizei index;
+    if(recorded == NULL || actual == NULL) {
+        return;
+    }
+    for(index = 0; index < count; index++) {
+        trace_bind_name(r, ns, recorded[index], actual[index]);
+    }
+}
+
+static int trace_names_bound(struct gladTraceReplay *r, unsigned int ns, const GLuint *recorded, GLsizei count) {
+    struct trace_name_map *map = &r->names[ns];
+    GLsizei index;
+    if(recorded == NULL || count <= 0) {
+        return 0;
+    }
+    for(index = 0; index < count; index++) {
+        if(recorded[index] >= map->capacity || map->names[recorded[index]] == 0) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/* Deleted names are free again, a later glGen* may record the same ones. */
+static void trace_unbind_names(struct gladTraceReplay *r, unsigned int ns, const GLuint *recorded, GLsizei count) {
+    struct trace_name_map *map = &r->names[ns];
+    GLsizei index;
+    if(recorded == NULL) {
+        return;
+    }
+    for(index = 0; index < count; index++) {
+        if(recorded[index] < map->capacity) {
+            map->names[recorded[index]] = 0;
+        }
+    }
+}
+
+static GLuint *trace_map_names(struct gladTraceReplay *r, unsigned int slot, unsigned int ns, const GLuint *recorded, GLsizei count) {
+    GLuint *names;
+    GLsizei index;
+    if(recorded == NULL || count <= 0) {
+        return NULL;
+    }
+    names = (GLuint *)trace_scratch(r, slot, (size_t)count * sizeof(GLuint));
+    if(names == NULL) {
+        return NULL;
+    }
+    for(index = 0; index < count; index++) {
+        names[index] = trace_map_name(r, ns, recorded[index]);
+    }
+    return names;
+}
+
+static unsigned long long trace_location_key(GLuint program, GLint location) {
+    return ((unsigned long long)program << 32) | (unsigned int)location;
+}
+
+static GLint trace_map_location(struct gladTraceReplay *r, GLint location) {
+    unsigned long long *value;
+    if(location < 0) {
+        return location;
+    }
+    value = key_map_find(&r->locations, trace_location_key(r->program, location), 0);
+    return value ? (GLint)*value : location;
+}
+
+static void trace_bind_location(struct gladTraceReplay *r, GLuint program, GLint recorded, GLint actual) {
+    if(recorded >= 0) {
+        *key_map_find(&r->locations, trace_location_key(program, recorded), 1) = (unsigned long long)(unsigned int)actual;
+    }
+}
+
+static GLsync trace_map_sync(struct gladTraceReplay *r, GLsync sync) {
+    unsigned long long *value = key_map_find(&r->syncs, (unsigned long long)(size_t)sync, 0);
+    return value ? (GLsync)(size_t)*value : sync;
+}
+
+static void trace_bind_sync(struct gladTraceReplay *r, GLsync recorded, GLsync actual) {
+    *key_map_find(&r->syncs, (unsigned long long)(size_t)recorded, 1) = (unsigned long long)(size_t)actual;
+}
+
+static void trace_replay_map(struct gladTraceReplay *r, GLenum target, void *pointer) {
+    unsigned int index;
+    for(index = 0; index < TRACE_MAX_MAPPINGS; index++) {
+        if(r->mappings[index].pointer == NULL || r->mappings[index].target == target) {
+            r->mappings[index].target = target;
+            r->mappings[index].pointer = pointer;
+            return;
+        }
+    }
+}
+
+static void trace_replay_unmap(struct gladTraceReplay *r, GLenum target) {
+    unsigned int index;
+    for(index = 0; index < TRACE_MAX_MAPPINGS; index++) {
+        if(r->mappings[index].target == target) {
+            r->mappings[index].pointer = NULL;
+        }
+    }
+}
+
+
+#include "glad_trace_calls.h"
+
+
+/* Capture hooks ############################################################*/
+
+static void trace_hook_bind_buffer(GLenum target, GLuint buffer) {
+    if(target == GL_PIXEL_UNPACK_BUFFER) {
+        trace_unpack_buffer = buffer;
+    }
+}
+
+static void trace_hook_pixel_store(GLenum pname, GLint param) {
+    if(pname == GL_UNPACK_ALIGNMENT) {
+        trace_unpack_alignment = param;
+    } else if(pname == GL_UNPACK_ROW_LENGTH) {
+        trace_unpack_row_length = param;
+    } else if(pname == GL_UNPACK_SKIP_PIXELS) {
+        trace_unpack_skip_pixels = param;
+    } else if(pname == GL_UNPACK_SKIP_ROWS) {
+        trace_unpack_skip_rows = param;
+    } else if(pname == GL_UNPACK_SKIP_IMAGES) {
+        trace_unpack_skip_images = param;
+    } else if(pname == GL_UNPACK_IMAGE_HEIGHT) {
+        trace_unpack_image_height = param;
+    }
+}
+
+static void trace_hook_map(GLenum target, void *pointer, GLintptr offset, GLsizeiptr length, GLbitfield access) {
+    unsigned int index;
+    (void)offset;
+
+    if(pointer == NULL) {
+        return;
+    }
+    if(length < 0) {
+        GLint size = 0;
+        trace_real_glGetBufferParameteriv(target, GL_BUFFER_SIZE, &size);
+        length = size;
+    }
+    for(index = 0; index < TRACE_MAX_MAPPINGS; index++) {
+        if(trace_mappings[index].pointer == NULL || trace_mappings[index].target == target) {
+            trace_mappings[index].target = target;
+            trace_mappings[index].pointer = pointer;
+            trace_mappings[index].length = length;
+            trace_mappings[index].access = access;
+            return;
+        }
+    }
+}
+
+/* Mapped writes are captured as a whole when the buffer is unmapped. */
+static void trace_hook_unmap(GLenum target) {
+    unsigned int index;
+    for(index = 0; index < TRACE_MAX_MAPPINGS; index++) {
+        struct trace_mapping *mapping = &trace_mappings[index];
+        if(mapping->pointer != NULL && mapping->target == target) {
+            if(mapping->access & GL_MAP_WRITE_BIT) {
+                unsigned int blob = trace_blob(mapping->pointer, (size_t)mapping->length);
+                trace_write_u16(TRACE_OP_BUFFER_DATA);
+                trace_write_u32(target);
+                trace_write_u32(blob);
+            }
+            mapping->pointer = NULL;
+        }
+    }
+}
+
+
+/* Public API ###############################################################*/
+
+int gladTraceBegin(const char *path, unsigned int frames) {
+    unsigned int index;
+
+    if(trace_active || frames == 0) {
+        return 0;
+    }
+
+    trace_file = fopen(path, "w+b");
+    if(trace_file == NULL) {
+        return 0;
+    }
+    trace_file_size = 0;
+
+    trace_write_u32(TRACE_MAGIC);
+    trace_write_u32(GLAD_TRACE_VERSION);
+    trace_write_u32(TRACE_FUNCTION_COUNT);
+    for(index = 0; index < TRACE_FUNCTION_COUNT; index++) {
+        unsigned short length = (unsigned short)strlen(trace_names[index]);
+        trace_write_u16(length);
+        bytes_append(&trace_stream, trace_names[index], length);
+    }
+    trace_flush();
+
+    trace_frames_left = frames;
+    trace_setup_done = 0;
+    trace_unpack_buffer = 0;
+    trace_unpack_alignment = 4;
+    trace_unpack_row_length = 0;
+    trace_unpack_skip_pixels = 0;
+    trace_unpack_skip_rows = 0;
+    trace_unpack_skip_images = 0;
+    trace_unpack_image_height = 0;
+    memset(trace_mappings, 0, sizeof(trace_mappings));
+    trace_install();
+    trace_active = 1;
+    return 1;
+}
+
+void gladTraceFrame(void) {
+    if(!trace_active) {
+        return;
+    }
+
+    trace_write_u16(TRACE_OP_FRAME);
+    trace_flush();
+
+    if(!trace_setup_done) {
+        trace_setup_done = 1;
+    } else if(--trace_frames_left == 0) {
+        gladTraceEnd();
+    }
+}
+
+void gladTraceEnd(void) {
+    if(!trace_active) {
+        return;
+    }
+
+    trace_uninstall();
+    trace_flush();
+    fclose(trace_file);
+    trace_file = NULL;
+    bytes_free(&trace_stream);
+    bytes_free(&trace_call);
+    bytes_free(&trace_temp);
+    free(trace_blobs);
+    trace_blobs = NULL;
+    trace_blob_mask = 0;
+    trace_blob_count = 0;
+    trace_active = 0;
+}
+
+int gladTraceActive(void) {
+    return trace_active;
+}
+
+static int replay_read(struct gladTraceReplay *r, void *value, size_t size) {
+    if(r->cursor + size > r->size) {
+        return 0;
+    }
+    memcpy(value, r->data + r->cursor, size);
+    r->cursor += size;
+    return 1;
+}
+
+struct gladTraceReplay *gladTraceReplayOpen(const char *path) {
+    struct gladTraceReplay *r;
+    FILE *file;
+    long size;
+    unsigned int magic = 0;
+    unsigned int version = 0;
+    unsigned int index;
+
+    file = fopen(path, "rb");
+    if(file == NULL) {
+        return NULL;
+    }
+
+    r = (struct gladTraceReplay *)calloc(1, sizeof(*r));
+    fseek(file, 0, SEEK_END);
+    size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    r->size = size > 0 ? (size_t)size : 0;
+    r->data = (unsigned char *)malloc(r->size ? r->size : 1);
+    if(fread(r->data, 1, r->size, file) != r->size) {
+        r->size = 0;
+    }
+    fclose(file);
+
+    if(!replay_read(r, &magic, sizeof(magic)) || magic != TRACE_MAGIC
+        || !replay_read(r, &version, sizeof(version)) || version != GLAD_TRACE_VERSION
+        || !replay_read(r, &r->id_count, sizeof(r->id_count))) {
+        gladTraceReplayClose(r);
+        return NULL;
+    }
+
+    /* Map recorded function ids onto this build's ids by name. */
+    r->ids = (unsigned int *)malloc((r->id_count ? r->id_count : 1) * sizeof(unsigned int));
+    for(index = 0; index < r->id_count; index++) {
+        unsigned short length = 0;
+        unsigned int id;
+        r->ids[index] = TRACE_FUNCTION_COUNT;
+        if(!replay_read(r, &length, sizeof(length)) || r->cursor + length > r->size) {
+            gladTraceReplayClose(r);
+            return NULL;
+        }
+        for(id = 0; id < TRACE_FUNCTION_COUNT; id++) {
+            if(strlen(trace_names[id]) == length
+                && memcmp(trace_names[id], r->data + r->cursor, length) == 0) {
+                r->ids[index] = id;
+                break;
+            }
+        }
+        r->cursor += length;
+    }
+
+    return r;
+}
+
+static void replay_register_blob(struct gladTraceReplay *r, unsigned int id, const unsigned char *data, unsigned int size) {
+    if(id >= r->blob_capacity) {
+        unsigned int capacity = r->blob_capacity ? r->blob_capacity : 1024;
+        while(capacity <= id) {
+            capacity *= 2;
+        }
+        r->blobs = (struct trace_blob_ref *)realloc(r->blobs, capacity * sizeof(*r->blobs));
+        memset(r->blobs + r->blob_capacity, 0, (capacity - r->blob_capacity) * sizeof(*r->blobs));
+        r->blob_capacity = capacity;
+    }
+    r->blobs[id].data = data;
+    r->blobs[id].size = size;
+}
+
+static void replay_buffer_data(struct gladTraceReplay *r, GLenum target, unsigned int blob) {
+    unsigned int index;
+    if(blob >= r->blob_capacity || r->blobs[blob].data == NULL) {
+        return;
+    }
+    for(index = 0; index < TRACE_MAX_MAPPINGS; index++) {
+        if(r->mappings[index].pointer != NULL && r->mappings[index].target == target) {
+            memcpy(r->mappings[index].pointer, r->blobs[blob].data, r->blobs[blob].size);
+            return;
+        }
+    }
+}
+
+int gladTraceReplayFrame(struct gladTraceReplay *r) {
+    unsigned short op;
+
+    while(replay_read(r, &op, sizeof(op))) {
+        if(op == TRACE_OP_FRAME) {
+            if(r->frames_start == 0) {
+                r->frames_start = r->cursor;
+            } else {
+                r->stats.frames++;
+            }
+            return 1;
+        } else if(op == TRACE_OP_BLOB) {
+            unsigned int id = 0;
+            unsigned int size = 0;
+            if(!replay_read(r, &id, sizeof(id)) || !replay_read(r, &size, sizeof(size))) {
+                break;
+            }
+            r->cursor = (r->cursor + TRACE_BLOB_ALIGNMENT - 1) / TRACE_BLOB_ALIGNMENT * TRACE_BLOB_ALIGNMENT;
+            if(r->cursor + size > r->size) {
+                break;
+            }
+            replay_register_blob(r, id, r->data + r->cursor, size);
+            r->cursor += size;
+        } else if(op == TRACE_OP_BUFFER_DATA) {
+            unsigned int target = 0;
+            unsigned int blob = 0;
+            if(!replay_read(r, &target, sizeof(target)) || !replay_read(r, &blob, sizeof(blob))) {
+                break;
+            }
+            replay_buffer_data(r, target, blob);
+        } else {
+            unsigned int size = 0;
+            if(!replay_read(r, &size, sizeof(size)) || r->cursor + size > r->size) {
+                break;
+            }
+            r->call_end = r->cursor + size;
+            r->unsupported = 0;
+            if(op < r->id_count && trace_replay_call(r, r->ids[op])) {
+                r->stats.calls++;
+            } else {
+                r->stats.skipped++;
+            }
+            r->cursor = r->call_end;
+        }
+    }
+
+    r->cursor = r->size;
+    return 0;
+}
+
+void gladTraceReplayRewind(struct gladTraceReplay *r) {
+    if(r->frames_start != 0) {
+        r->cursor = r->frames_start;
+    }
+}
+
+struct gladTraceReplayStats gladTraceReplayGetStats(const struct gladTraceReplay *r) {
+    return r->stats;
+}
+
+void gladTraceReplayClose(struct gladTraceReplay *r) {
+    unsigned int index;
+    if(r == NULL) {
+        return;
+    }
+    for(index = 0; index < TRACE_NS_COUNT; index++) {
+        free(r->names[index].names);
+    }
+    for(index = 0; index < TRACE_SCRATCH_SLOTS; index++) {
+        free(r->scratch[index]);
+    }
+    free(r->locations.slots);
+    free(r->syncs.slots);
+    free(r->blobs);
+    free(r->ids);
+    free(r->data);
+    free(r);
+}
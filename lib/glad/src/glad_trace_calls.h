@@ -0,0 +1,16821 @@
+/*
+
+    GL call trace shims, generated by lib/glad/gen_shims.py from glad.h.
+    Do not edit by hand; included by glad_trace.c.
+
+*/
+
+#define TRACE_FUNCTION_COUNT 744
+
+static const char *trace_names[TRACE_FUNCTION_COUNT] = {
+	"glCullFace",
+	"glFrontFace",
+	"glHint",
+	"glLineWidth",
+	"glPointSize",
+	"glPolygonMode",
+	"glScissor",
+	"glTexParameterf",
+	"glTexParameterfv",
+	"glTexParameteri",
+	"glTexParameteriv",
+	"glTexImage1D",
+	"glTexImage2D",
+	"glDrawBuffer",
+	"glClear",
+	"glClearColor",
+	"glClearStencil",
+	"glClearDepth",
+	"glStencilMask",
+	"glColorMask",
+	"glDepthMask",
+	"glDisable",
+	"glEnable",
+	"glFinish",
+	"glFlush",
+	"glBlendFunc",
+	"glLogicOp",
+	"glStencilFunc",
+	"glStencilOp",
+	"glDepthFunc",
+	"glPixelStoref",
+	"glPixelStorei",
+	"glReadBuffer",
+	"glReadPixels",
+	"glGetBooleanv",
+	"glGetDoublev",
+	"glGetError",
+	"glGetFloatv",
+	"glGetIntegerv",
+	"glGetString",
+	"glGetTexImage",
+	"glGetTexParameterfv",
+	"glGetTexParameteriv",
+	"glGetTexLevelParameterfv",
+	"glGetTexLevelParameteriv",
+	"glIsEnabled",
+	"glDepthRange",
+	"glViewport",
+	"glNewList",
+	"glEndList",
+	"glCallList",
+	"glCallLists",
+	"glDeleteLists",
+	"glGenLists",
+	"glListBase",
+	"glBegin",
+	"glBitmap",
+	"glColor3b",
+	"glColor3bv",
+	"glColor3d",
+	"glColor3dv",
+	"glColor3f",
+	"glColor3fv",
+	"glColor3i",
+	"glColor3iv",
+	"glColor3s",
+	"glColor3sv",
+	"glColor3ub",
+	"glColor3ubv",
+	"glColor3ui",
+	"glColor3uiv",
+	"glColor3us",
+	"glColor3usv",
+	"glColor4b",
+	"glColor4bv",
+	"glColor4d",
+	"glColor4dv",
+	"glColor4f",
+	"glColor4fv",
+	"glColor4i",
+	"glColor4iv",
+	"glColor4s",
+	"glColor4sv",
+	"glColor4ub",
+	"glColor4ubv",
+	"glColor4ui",
+	"glColor4uiv",
+	"glColor4us",
+	"glColor4usv",
+	"glEdgeFlag",
+	"glEdgeFlagv",
+	"glEnd",
+	"glIndexd",
+	"glIndexdv",
+	"glIndexf",
+	"glIndexfv",
+	"glIndexi",
+	"glIndexiv",
+	"glIndexs",
+	"glIndexsv",
+	"glNormal3b",
+	"glNormal3bv",
+	"glNormal3d",
+	"glNormal3dv",
+	"glNormal3f",
+	"glNormal3fv",
+	"glNormal3i",
+	"glNormal3iv",
+	"glNormal3s",
+	"glNormal3sv",
+	"glRasterPos2d",
+	"glRasterPos2dv",
+	"glRasterPos2f",
+	"glRasterPos2fv",
+	"glRasterPos2i",
+	"glRasterPos2iv",
+	"glRasterPos2s",
+	"glRasterPos2sv",
+	"glRasterPos3d",
+	"glRasterPos3dv",
+	"glRasterPos3f",
+	"glRasterPos3fv",
+	"glRasterPos3i",
+	"glRasterPos3iv",
+	"glRasterPos3s",
+	"glRasterPos3sv",
+	"glRasterPos4d",
+	"glRasterPos4dv",
+	"glRasterPos4f",
+	"glRasterPos4fv",
+	"glRasterPos4i",
+	"glRasterPos4iv",
+	"glRasterPos4s",
+	"glRasterPos4sv",
+	"glRectd",
+	"glRectdv",
+	"glRectf",
+	"glRectfv",
+	"glRecti",
+	"glRectiv",
+	"glRects",
+	"glRectsv",
+	"glTexCoord1d",
+	"glTexCoord1dv",
+	"glTexCoord1f",
+	"glTexCoord1fv",
+	"glTexCoord1i",
+	"glTexCoord1iv",
+	"glTexCoord1s",
+	"glTexCoord1sv",
+	"glTexCoord2d",
+	"glTexCoord2dv",
+	"glTexCoord2f",
+	"glTexCoord2fv",
+	"glTexCoord2i",
+	"glTexCoord2iv",
+	"glTexCoord2s",
+	"glTexCoord2sv",
+	"glTexCoord3d",
+	"glTexCoord3dv",
+	"glTexCoord3f",
+	"glTexCoord3fv",
+	"glTexCoord3i",
+	"glTexCoord3iv",
+	"glTexCoord3s",
+	"glTexCoord3sv",
+	"glTexCoord4d",
+	"glTexCoord4dv",
+	"glTexCoord4f",
+	"glTexCoord4fv",
+	"glTexCoord4i",
+	"glTexCoord4iv",
+	"glTexCoord4s",
+	"glTexCoord4sv",
+	"glVertex2d",
+	"glVertex2dv",
+	"glVertex2f",
+	"glVertex2fv",
+	"glVertex2i",
+	"glVertex2iv",
+	"glVertex2s",
+	"glVertex2sv",
+	"glVertex3d",
+	"glVertex3dv",
+	"glVertex3f",
+	"glVertex3fv",
+	"glVertex3i",
+	"glVertex3iv",
+	"glVertex3s",
+	"glVertex3sv",
+	"glVertex4d",
+	"glVertex4dv",
+	"glVertex4f",
+	"glVertex4fv",
+	"glVertex4i",
+	"glVertex4iv",
+	"glVertex4s",
+	"glVertex4sv",
+	"glClipPlane",
+	"glColorMaterial",
+	"glFogf",
+	"glFogfv",
+	"glFogi",
+	"glFogiv",
+	"glLightf",
+	"glLightfv",
+	"glLighti",
+	"glLightiv",
+	"glLightModelf",
+	"glLightModelfv",
+	"glLightModeli",
+	"glLightModeliv",
+	"glLineStipple",
+	"glMaterialf",
+	"glMaterialfv",
+	"glMateriali",
+	"glMaterialiv",
+	"glPolygonStipple",
+	"glShadeModel",
+	"glTexEnvf",
+	"glTexEnvfv",
+	"glTexEnvi",
+	"glTexEnviv",
+	"glTexGend",
+	"glTexGendv",
+	"glTexGenf",
+	"glTexGenfv",
+	"glTexGeni",
+	"glTexGeniv",
+	"glFeedbackBuffer",
+	"glSelectBuffer",
+	"glRenderMode",
+	"glInitNames",
+	"glLoadName",
+	"glPassThrough",
+	"glPopName",
+	"glPushName",
+	"glClearAccum",
+	"glClearIndex",
+	"glIndexMask",
+	"glAccum",
+	"glPopAttrib",
+	"glPushAttrib",
+	"glMap1d",
+	"glMap1f",
+	"glMap2d",
+	"glMap2f",
+	"glMapGrid1d",
+	"glMapGrid1f",
+	"glMapGrid2d",
+	"glMapGrid2f",
+	"glEvalCoord1d",
+	"glEvalCoord1dv",
+	"glEvalCoord1f",
+	"glEvalCoord1fv",
+	"glEvalCoord2d",
+	"glEvalCoord2dv",
+	"glEvalCoord2f",
+	"glEvalCoord2fv",
+	"glEvalMesh1",
+	"glEvalPoint1",
+	"glEvalMesh2",
+	"glEvalPoint2",
+	"glAlphaFunc",
+	"glPixelZoom",
+	"glPixelTransferf",
+	"glPixelTransferi",
+	"glPixelMapfv",
+	"glPixelMapuiv",
+	"glPixelMapusv",
+	"glCopyPixels",
+	"glDrawPixels",
+	"glGetClipPlane",
+	"glGetLightfv",
+	"glGetLightiv",
+	"glGetMapdv",
+	"glGetMapfv",
+	"glGetMapiv",
+	"glGetMaterialfv",
+	"glGetMaterialiv",
+	"glGetPixelMapfv",
+	"glGetPixelMapuiv",
+	"glGetPixelMapusv",
+	"glGetPolygonStipple",
+	"glGetTexEnvfv",
+	"glGetTexEnviv",
+	"glGetTexGendv",
+	"glGetTexGenfv",
+	"glGetTexGeniv",
+	"glIsList",
+	"glFrustum",
+	"glLoadIdentity",
+	"glLoadMatrixf",
+	"glLoadMatrixd",
+	"glMatrixMode",
+	"glMultMatrixf",
+	"glMultMatrixd",
+	"glOrtho",
+	"glPopMatrix",
+	"glPushMatrix",
+	"glRotated",
+	"glRotatef",
+	"glScaled",
+	"glScalef",
+	"glTranslated",
+	"glTranslatef",
+	"glDrawArrays",
+	"glDrawElements",
+	"glGetPointerv",
+	"glPolygonOffset",
+	"glCopyTexImage1D",
+	"glCopyTexImage2D",
+	"glCopyTexSubImage1D",
+	"glCopyTexSubImage2D",
+	"glTexSubImage1D",
+	"glTexSubImage2D",
+	"glBindTexture",
+	"glDeleteTextures",
+	"glGenTextures",
+	"glIsTexture",
+	"glArrayElement",
+	"glColorPointer",
+	"glDisableClientState",
+	"glEdgeFlagPointer",
+	"glEnableClientState",
+	"glIndexPointer",
+	"glInterleavedArrays",
+	"glNormalPointer",
+	"glTexCoordPointer",
+	"glVertexPointer",
+	"glAreTexturesResident",
+	"glPrioritizeTextures",
+	"glIndexub",
+	"glIndexubv",
+	"glPopClientAttrib",
+	"glPushClientAttrib",
+	"glDrawRangeElements",
+	"glTexImage3D",
+	"glTexSubImage3D",
+	"glCopyTexSubImage3D",
+	"glActiveTexture",
+	"glSampleCoverage",
+	"glCompressedTexImage3D",
+	"glCompressedTexImage2D",
+	"glCompressedTexImage1D",
+	"glCompressedTexSubImage3D",
+	"glCompressedTexSubImage2D",
+	"glCompressedTexSubImage1D",
+	"glGetCompressedTexImage",
+	"glClientActiveTexture",
+	"glMultiTexCoord1d",
+	"glMultiTexCoord1dv",
+	"glMultiTexCoord1f",
+	"glMultiTexCoord1fv",
+	"glMultiTexCoord1i",
+	"glMultiTexCoord1iv",
+	"glMultiTexCoord1s",
+	"glMultiTexCoord1sv",
+	"glMultiTexCoord2d",
+	"glMultiTexCoord2dv",
+	"glMultiTexCoord2f",
+	"glMultiTexCoord2fv",
+	"glMultiTexCoord2i",
+	"glMultiTexCoord2iv",
+	"glMultiTexCoord2s",
+	"glMultiTexCoord2sv",
+	"glMultiTexCoord3d",
+	"glMultiTexCoord3dv",
+	"glMultiTexCoord3f",
+	"glMultiTexCoord3fv",
+	"glMultiTexCoord3i",
+	"glMultiTexCoord3iv",
+	"glMultiTexCoord3s",
+	"glMultiTexCoord3sv",
+	"glMultiTexCoord4d",
+	"glMultiTexCoord4dv",
+	"glMultiTexCoord4f",
+	"glMultiTexCoord4fv",
+	"glMultiTexCoord4i",
+	"glMultiTexCoord4iv",
+	"glMultiTexCoord4s",
+	"glMultiTexCoord4sv",
+	"glLoadTransposeMatrixf",
+	"glLoadTransposeMatrixd",
+	"glMultTransposeMatrixf",
+	"glMultTransposeMatrixd",
+	"glBlendFuncSeparate",
+	"glMultiDrawArrays",
+	"glMultiDrawElements",
+	"glPointParameterf",
+	"glPointParameterfv",
+	"glPointParameteri",
+	"glPointParameteriv",
+	"glFogCoordf",
+	"glFogCoordfv",
+	"glFogCoordd",
+	"glFogCoorddv",
+	"glFogCoordPointer",
+	"glSecondaryColor3b",
+	"glSecondaryColor3bv",
+	"glSecondaryColor3d",
+	"glSecondaryColor3dv",
+	"glSecondaryColor3f",
+	"glSecondaryColor3fv",
+	"glSecondaryColor3i",
+	"glSecondaryColor3iv",
+	"glSecondaryColor3s",
+	"glSecondaryColor3sv",
+	"glSecondaryColor3ub",
+	"glSecondaryColor3ubv",
+	"glSecondaryColor3ui",
+	"glSecondaryColor3uiv",
+	"glSecondaryColor3us",
+	"glSecondaryColor3usv",
+	"glSecondaryColorPointer",
+	"glWindowPos2d",
+	"glWindowPos2dv",
+	"glWindowPos2f",
+	"glWindowPos2fv",
+	"glWindowPos2i",
+	"glWindowPos2iv",
+	"glWindowPos2s",
+	"glWindowPos2sv",
+	"glWindowPos3d",
+	"glWindowPos3dv",
+	"glWindowPos3f",
+	"glWindowPos3fv",
+	"glWindowPos3i",
+	"glWindowPos3iv",
+	"glWindowPos3s",
+	"glWindowPos3sv",
+	"glBlendColor",
+	"glBlendEquation",
+	"glGenQueries",
+	"glDeleteQueries",
+	"glIsQuery",
+	"glBeginQuery",
+	"glEndQuery",
+	"glGetQueryiv",
+	"glGetQueryObjectiv",
+	"glGetQueryObjectuiv",
+	"glBindBuffer",
+	"glDeleteBuffers",
+	"glGenBuffers",
+	"glIsBuffer",
+	"glBufferData",
+	"glBufferSubData",
+	"glGetBufferSubData",
+	"glMapBuffer",
+	"glUnmapBuffer",
+	"glGetBufferParameteriv",
+	"glGetBufferPointerv",
+	"glBlendEquationSeparate",
+	"glDrawBuffers",
+	"glStencilOpSeparate",
+	"glStencilFuncSeparate",
+	"glStencilMaskSeparate",
+	"glAttachShader",
+	"glBindAttribLocation",
+	"glCompileShader",
+	"glCreateProgram",
+	"glCreateShader",
+	"glDeleteProgram",
+	"glDeleteShader",
+	"glDetachShader",
+	"glDisableVertexAttribArray",
+	"glEnableVertexAttribArray",
+	"glGetActiveAttrib",
+	"glGetActiveUniform",
+	"glGetAttachedShaders",
+	"glGetAttribLocation",
+	"glGetProgramiv",
+	"glGetProgramInfoLog",
+	"glGetShaderiv",
+	"glGetShaderInfoLog",
+	"glGetShaderSource",
+	"glGetUniformLocation",
+	"glGetUniformfv",
+	"glGetUniformiv",
+	"glGetVertexAttribdv",
+	"glGetVertexAttribfv",
+	"glGetVertexAttribiv",
+	"glGetVertexAttribPointerv",
+	"glIsProgram",
+	"glIsShader",
+	"glLinkProgram",
+	"glShaderSource",
+	"glUseProgram",
+	"glUniform1f",
+	"glUniform2f",
+	"glUniform3f",
+	"glUniform4f",
+	"glUniform1i",
+	"glUniform2i",
+	"glUniform3i",
+	"glUniform4i",
+	"glUniform1fv",
+	"glUniform2fv",
+	"glUniform3fv",
+	"glUniform4fv",
+	"glUniform1iv",
+	"glUniform2iv",
+	"glUniform3iv",
+	"glUniform4iv",
+	"glUniformMatrix2fv",
+	"glUniformMatrix3fv",
+	"glUniformMatrix4fv",
+	"glValidateProgram",
+	"glVertexAttrib1d",
+	"glVertexAttrib1dv",
+	"glVertexAttrib1f",
+	"glVertexAttrib1fv",
+	"glVertexAttrib1s",
+	"glVertexAttrib1sv",
+	"glVertexAttrib2d",
+	"glVertexAttrib2dv",
+	"glVertexAttrib2f",
+	"glVertexAttrib2fv",
+	"glVertexAttrib2s",
+	"glVertexAttrib2sv",
+	"glVertexAttrib3d",
+	"glVertexAttrib3dv",
+	"glVertexAttrib3f",
+	"glVertexAttrib3fv",
+	"glVertexAttrib3s",
+	"glVertexAttrib3sv",
+	"glVertexAttrib4Nbv",
+	"glVertexAttrib4Niv",
+	"glVertexAttrib4Nsv",
+	"glVertexAttrib4Nub",
+	"glVertexAttrib4Nubv",
+	"glVertexAttrib4Nuiv",
+	"glVertexAttrib4Nusv",
+	"glVertexAttrib4bv",
+	"glVertexAttrib4d",
+	"glVertexAttrib4dv",
+	"glVertexAttrib4f",
+	"glVertexAttrib4fv",
+	"glVertexAttrib4iv",
+	"glVertexAttrib4s",
+	"glVertexAttrib4sv",
+	"glVertexAttrib4ubv",
+	"glVertexAttrib4uiv",
+	"glVertexAttrib4usv",
+	"glVertexAttribPointer",
+	"glUniformMatrix2x3fv",
+	"glUniformMatrix3x2fv",
+	"glUniformMatrix2x4fv",
+	"glUniformMatrix4x2fv",
+	"glUniformMatrix3x4fv",
+	"glUniformMatrix4x3fv",
+	"glColorMaski",
+	"glGetBooleani_v",
+	"glGetIntegeri_v",
+	"glEnablei",
+	"glDisablei",
+	"glIsEnabledi",
+	"glBeginTransformFeedback",
+	"glEndTransformFeedback",
+	"glBindBufferRange",
+	"glBindBufferBase",
+	"glTransformFeedbackVaryings",
+	"glGetTransformFeedbackVarying",
+	"glClampColor",
+	"glBeginConditionalRender",
+	"glEndConditionalRender",
+	"glVertexAttribIPointer",
+	"glGetVertexAttribIiv",
+	"glGetVertexAttribIuiv",
+	"glVertexAttribI1i",
+	"glVertexAttribI2i",
+	"glVertexAttribI3i",
+	"glVertexAttribI4i",
+	"glVertexAttribI1ui",
+	"glVertexAttribI2ui",
+	"glVertexAttribI3ui",
+	"glVertexAttribI4ui",
+	"glVertexAttribI1iv",
+	"glVertexAttribI2iv",
+	"glVertexAttribI3iv",
+	"glVertexAttribI4iv",
+	"glVertexAttribI1uiv",
+	"glVertexAttribI2uiv",
+	"glVertexAttribI3uiv",
+	"glVertexAttribI4uiv",
+	"glVertexAttribI4bv",
+	"glVertexAttribI4sv",
+	"glVertexAttribI4ubv",
+	"glVertexAttribI4usv",
+	"glGetUniformuiv",
+	"glBindFragDataLocation",
+	"glGetFragDataLocation",
+	"glUniform1ui",
+	"glUniform2ui",
+	"glUniform3ui",
+	"glUniform4ui",
+	"glUniform1uiv",
+	"glUniform2uiv",
+	"glUniform3uiv",
+	"glUniform4uiv",
+	"glTexParameterIiv",
+	"glTexParameterIuiv",
+	"glGetTexParameterIiv",
+	"glGetTexParameterIuiv",
+	"glClearBufferiv",
+	"glClearBufferuiv",
+	"glClearBufferfv",
+	"glClearBufferfi",
+	"glGetStringi",
+	"glIsRenderbuffer",
+	"glBindRenderbuffer",
+	"glDeleteRenderbuffers",
+	"glGenRenderbuffers",
+	"glRenderbufferStorage",
+	"glGetRenderbufferParameteriv",
+	"glIsFramebuffer",
+	"glBindFramebuffer",
+	"glDeleteFramebuffers",
+	"glGenFramebuffers",
+	"glCheckFramebufferStatus",
+	"glFramebufferTexture1D",
+	"glFramebufferTexture2D",
+	"glFramebufferTexture3D",
+	"glFramebufferRenderbuffer",
+	"glGetFramebufferAttachmentParameteriv",
+	"glGenerateMipmap",
+	"glBlitFramebuffer",
+	"glRenderbufferStorageMultisample",
+	"glFramebufferTextureLayer",
+	"glMapBufferRange",
+	"glFlushMappedBufferRange",
+	"glBindVertexArray",
+	"glDeleteVertexArrays",
+	"glGenVertexArrays",
+	"glIsVertexArray",
+	"glDrawArraysInstanced",
+	"glDrawElementsInstanced",
+	"glTexBuffer",
+	"glPrimitiveRestartIndex",
+	"glCopyBufferSubData",
+	"glGetUniformIndices",
+	"glGetActiveUniformsiv",
+	"glGetActiveUniformName",
+	"glGetUniformBlockIndex",
+	"glGetActiveUniformBlockiv",
+	"glGetActiveUniformBlockName",
+	"glUniformBlockBinding",
+	"glDrawElementsBaseVertex",
+	"glDrawRangeElementsBaseVertex",
+	"glDrawElementsInstancedBaseVertex",
+	"glMultiDrawElementsBaseVertex",
+	"glProvokingVertex",
+	"glFenceSync",
+	"glIsSync",
+	"glDeleteSync",
+	"glClientWaitSync",
+	"glWaitSync",
+	"glGetInteger64v",
+	"glGetSynciv",
+	"glGetInteger64i_v",
+	"glGetBufferParameteri64v",
+	"glFramebufferTexture",
+	"glTexImage2DMultisample",
+	"glTexImage3DMultisample",
+	"glGetMultisamplefv",
+	"glSampleMaski",
+	"glBindFragDataLocationIndexed",
+	"glGetFragDataIndex",
+	"glGenSamplers",
+	"glDeleteSamplers",
+	"glIsSampler",
+	"glBindSampler",
+	"glSamplerParameteri",
+	"glSamplerParameteriv",
+	"glSamplerParameterf",
+	"glSamplerParameterfv",
+	"glSamplerParameterIiv",
+	"glSamplerParameterIuiv",
+	"glGetSamplerParameteriv",
+	"glGetSamplerParameterIiv",
+	"glGetSamplerParameterfv",
+	"glGetSamplerParameterIuiv",
+	"glQueryCounter",
+	"glGetQueryObjecti64v",
+	"glGetQueryObjectui64v",
+	"glVertexAttribDivisor",
+	"glVertexAttribP1ui",
+	"glVertexAttribP1uiv",
+	"glVertexAttribP2ui",
+	"glVertexAttribP2uiv",
+	"glVertexAttribP3ui",
+	"glVertexAttribP3uiv",
+	"glVertexAttribP4ui",
+	"glVertexAttribP4uiv",
+	"glVertexP2ui",
+	"glVertexP2uiv",
+	"glVertexP3ui",
+	"glVertexP3uiv",
+	"glVertexP4ui",
+	"glVertexP4uiv",
+	"glTexCoordP1ui",
+	"glTexCoordP1uiv",
+	"glTexCoordP2ui",
+	"glTexCoordP2uiv",
+	"glTexCoordP3ui",
+	"glTexCoordP3uiv",
+	"glTexCoordP4ui",
+	"glTexCoordP4uiv",
+	"glMultiTexCoordP1ui",
+	"glMultiTexCoordP1uiv",
+	"glMultiTexCoordP2ui",
+	"glMultiTexCoordP2uiv",
+	"glMultiTexCoordP3ui",
+	"glMultiTexCoordP3uiv",
+	"glMultiTexCoordP4ui",
+	"glMultiTexCoordP4uiv",
+	"glNormalP3ui",
+	"glNormalP3uiv",
+	"glColorP3ui",
+	"glColorP3uiv",
+	"glColorP4ui",
+	"glColorP4uiv",
+	"glSecondaryColorP3ui",
+	"glSecondaryColorP3uiv",
+	"glBufferStorage",
+	"glDebugMessageControlARB",
+	"glDebugMessageInsertARB",
+	"glDebugMessageCallbackARB",
+	"glGetDebugMessageLogARB",
+	"glGetProgramBinary",
+	"glProgramBinary",
+	"glProgramParameteri",
+	"glMaxShaderCompilerThreadsARB",
+	"glDebugMessageControl",
+	"glDebugMessageInsert",
+	"glDebugMessageCallback",
+	"glGetDebugMessageLog",
+	"glPushDebugGroup",
+	"glPopDebugGroup",
+	"glObjectLabel",
+	"glGetObjectLabel",
+	"glObjectPtrLabel",
+	"glGetObjectPtrLabel",
+	"glMaxShaderCompilerThreadsKHR",
+};
+
+static PFNGLCULLFACEPROC trace_real_glCullFace = NULL;
+static void APIENTRY trace_glCullFace(GLenum mode) {
+	trace_real_glCullFace(mode);
+	trace_begin_call(0);
+	trace_put(&mode, sizeof(mode));
+	trace_end_call();
+}
+static PFNGLFRONTFACEPROC trace_real_glFrontFace = NULL;
+static void APIENTRY trace_glFrontFace(GLenum mode) {
+	trace_real_glFrontFace(mode);
+	trace_begin_call(1);
+	trace_put(&mode, sizeof(mode));
+	trace_end_call();
+}
+static PFNGLHINTPROC trace_real_glHint = NULL;
+static void APIENTRY trace_glHint(GLenum target, GLenum mode) {
+	trace_real_glHint(target, mode);
+	trace_begin_call(2);
+	trace_put(&target, sizeof(target));
+	trace_put(&mode, sizeof(mode));
+	trace_end_call();
+}
+static PFNGLLINEWIDTHPROC trace_real_glLineWidth = NULL;
+static void APIENTRY trace_glLineWidth(GLfloat width) {
+	trace_real_glLineWidth(width);
+	trace_begin_call(3);
+	trace_put(&width, sizeof(width));
+	trace_end_call();
+}
+static PFNGLPOINTSIZEPROC trace_real_glPointSize = NULL;
+static void APIENTRY trace_glPointSize(GLfloat size) {
+	trace_real_glPointSize(size);
+	trace_begin_call(4);
+	trace_put(&size, sizeof(size));
+	trace_end_call();
+}
+static PFNGLPOLYGONMODEPROC trace_real_glPolygonMode = NULL;
+static void APIENTRY trace_glPolygonMode(GLenum face, GLenum mode) {
+	trace_real_glPolygonMode(face, mode);
+	trace_begin_call(5);
+	trace_put(&face, sizeof(face));
+	trace_put(&mode, sizeof(mode));
+	trace_end_call();
+}
+static PFNGLSCISSORPROC trace_real_glScissor = NULL;
+static void APIENTRY trace_glScissor(GLint x, GLint y, GLsizei width, GLsizei height) {
+	trace_real_glScissor(x, y, width, height);
+	trace_begin_call(6);
+	trace_put(&x, sizeof(x));
+	trace_put(&y, sizeof(y));
+	trace_put(&width, sizeof(width));
+	trace_put(&height, sizeof(height));
+	trace_end_call();
+}
+static PFNGLTEXPARAMETERFPROC trace_real_glTexParameterf = NULL;
+static void APIENTRY trace_glTexParameterf(GLenum target, GLenum pname, GLfloat param) {
+	trace_real_glTexParameterf(target, pname, param);
+	trace_begin_call(7);
+	trace_put(&target, sizeof(target));
+	trace_put(&pname, sizeof(pname));
+	trace_put(&param, sizeof(param));
+	trace_end_call();
+}
+static PFNGLTEXPARAMETERFVPROC trace_real_glTexParameterfv = NULL;
+static void APIENTRY trace_glTexParameterfv(GLenum target, GLenum pname, const GLfloat *params) {
+	trace_real_glTexParameterfv(target, pname, params);
+	trace_begin_call(8);
+	trace_put(&target, sizeof(target));
+	trace_put(&pname, sizeof(pname));
+	trace_put_data(params, params == NULL ? 0 : (size_t)(trace_param_count(pname) * sizeof(GLfloat)));
+	trace_end_call();
+}
+static PFNGLTEXPARAMETERIPROC trace_real_glTexParameteri = NULL;
+static void APIENTRY trace_glTexParameteri(GLenum target, GLenum pname, GLint param) {
+	trace_real_glTexParameteri(target, pname, param);
+	trace_begin_call(9);
+	trace_put(&target, sizeof(target));
+	trace_put(&pname, sizeof(pname));
+	trace_put(&param, sizeof(param));
+	trace_end_call();
+}
+static PFNGLTEXPARAMETERIVPROC trace_real_glTexParameteriv = NULL;
+static void APIENTRY trace_glTexParameteriv(GLenum target, GLenum pname, const GLint *params) {
+	trace_real_glTexParameteriv(target, pname, params);
+	trace_begin_call(10);
+	trace_put(&target, sizeof(target));
+	trace_put(&pname, sizeof(pname));
+	trace_put_data(params, params == NULL ? 0 : (size_t)(trace_param_count(pname) * sizeof(GLint)));
+	trace_end_call();
+}
+static PFNGLTEXIMAGE1DPROC trace_real_glTexImage1D = NULL;
+static void APIENTRY trace_glTexImage1D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLint border, GLenum format, GLenum type, const void *pixels) {
+	trace_real_glTexImage1D(target, level, internalformat, width, border, format, type, pixels);
+	trace_begin_call(11);
+	trace_put(&target, sizeof(target));
+	trace_put(&level, sizeof(level));
+	trace_put(&internalformat, sizeof(internalformat));
+	trace_put(&width, sizeof(width));
+	trace_put(&border, sizeof(border));
+	trace_put(&format, sizeof(format));
+	trace_put(&type, sizeof(type));
+	trace_put_pixels(pixels, pixels == NULL ? 0 : (size_t)(trace_image_size(format, type, width, 1, 1, 1)));
+	trace_end_call();
+}
+static PFNGLTEXIMAGE2DPROC trace_real_glTexImage2D = NULL;
+static void APIENTRY trace_glTexImage2D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void *pixels) {
+	trace_real_glTexImage2D(target, level, internalformat, width, height, border, format, type, pixels);
+	trace_begin_call(12);
+	trace_put(&target, sizeof(target));
+	trace_put(&level, sizeof(level));
+	trace_put(&internalformat, sizeof(internalformat));
+	trace_put(&width, sizeof(width));
+	trace_put(&height, sizeof(height));
+	trace_put(&border, sizeof(border));
+	trace_put(&format, sizeof(format));
+	trace_put(&type, sizeof(type));
+	trace_put_pixels(pixels, pixels == NULL ? 0 : (size_t)(trace_image_size(format, type, width, height, 1, 2)));
+	trace_end_call();
+}
+static PFNGLDRAWBUFFERPROC trace_real_glDrawBuffer = NULL;
+static void APIENTRY trace_glDrawBuffer(GLenum buf) {
+	trace_real_glDrawBuffer(buf);
+	trace_begin_call(13);
+	trace_put(&buf, sizeof(buf));
+	trace_end_call();
+}
+static PFNGLCLEARPROC trace_real_glClear = NULL;
+static void APIENTRY trace_glClear(GLbitfield mask) {
+	trace_real_glClear(mask);
+	trace_begin_call(14);
+	trace_put(&mask, sizeof(mask));
+	trace_end_call();
+}
+static PFNGLCLEARCOLORPROC trace_real_glClearColor = NULL;
+static void APIENTRY trace_glClearColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) {
+	trace_real_glClearColor(red, green, blue, alpha);
+	trace_begin_call(15);
+	trace_put(&red, sizeof(red));
+	trace_put(&green, sizeof(green));
+	trace_put(&blue, sizeof(blue));
+	trace_put(&alpha, sizeof(alpha));
+	trace_end_call();
+}
+static PFNGLCLEARSTENCILPROC trace_real_glClearStencil = NULL;
+static void APIENTRY trace_glClearStencil(GLint s) {
+	trace_real_glClearStencil(s);
+	trace_begin_call(16);
+	trace_put(&s, sizeof(s));
+	trace_end_call();
+}
+static PFNGLCLEARDEPTHPROC trace_real_glClearDepth = NULL;
+static void APIENTRY trace_glClearDepth(GLdouble depth) {
+	trace_real_glClearDepth(depth);
+	trace_begin_call(17);
+	trace_put(&depth, sizeof(depth));
+	trace_end_call();
+}
+static PFNGLSTENCILMASKPROC trace_real_glStencilMask = NULL;
+static void APIENTRY trace_glStencilMask(GLuint mask) {
+	trace_real_glStencilMask(mask);
+	trace_begin_call(18);
+	trace_put(&mask, sizeof(mask));
+	trace_end_call();
+}
+static PFNGLCOLORMASKPROC trace_real_glColorMask = NULL;
+static void APIENTRY trace_glColorMask(GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha) {
+	trace_real_glColorMask(red, green, blue, alpha);
+	trace_begin_call(19);
+	trace_put(&red, sizeof(red));
+	trace_put(&green, sizeof(green));
+	trace_put(&blue, sizeof(blue));
+	trace_put(&alpha, sizeof(alpha));
+	trace_end_call();
+}
+static PFNGLDEPTHMASKPROC trace_real_glDepthMask = NULL;
+static void APIENTRY trace_glDepthMask(GLboolean flag) {
+	trace_real_glDepthMask(flag);
+	trace_begin_call(20);
+	trace_put(&flag, sizeof(flag));
+	trace_end_call();
+}
+static PFNGLDISABLEPROC trace_real_glDisable = NULL;
+static void APIENTRY trace_glDisable(GLenum cap) {
+	trace_real_glDisable(cap);
+	trace_begin_call(21);
+	trace_put(&cap, sizeof(cap));
+	trace_end_call();
+}
+static PFNGLENABLEPROC trace_real_glEnable = NULL;
+static void APIENTRY trace_glEnable(GLenum cap) {
+	trace_real_glEnable(cap);
+	trace_begin_call(22);
+	trace_put(&cap, sizeof(cap));
+	trace_end_call();
+}
+static PFNGLFINISHPROC trace_real_glFinish = NULL;
+static void APIENTRY trace_glFinish(void) {
+	trace_real_glFinish();
+	trace_begin_call(23);
+	trace_end_call();
+}
+static PFNGLFLUSHPROC trace_real_glFlush = NULL;
+static void APIENTRY trace_glFlush(void) {
+	trace_real_glFlush();
+	trace_begin_call(24);
+	trace_end_call();
+}
+static PFNGLBLENDFUNCPROC trace_real_glBlendFunc = NULL;
+static void APIENTRY trace_glBlendFunc(GLenum sfactor, GLenum dfactor) {
+	trace_real_glBlendFunc(sfactor, dfactor);
+	trace_begin_call(25);
+	trace_put(&sfactor, sizeof(sfactor));
+	trace_put(&dfactor, sizeof(dfactor));
+	trace_end_call();
+}
+static PFNGLLOGICOPPROC trace_real_glLogicOp = NULL;
+static void APIENTRY trace_glLogicOp(GLenum opcode) {
+	trace_real_glLogicOp(opcode);
+	trace_begin_call(26);
+	trace_put(&opcode, sizeof(opcode));
+	trace_end_call();
+}
+static PFNGLSTENCILFUNCPROC trace_real_glStencilFunc = NULL;
+static void APIENTRY trace_glStencilFunc(GLenum func, GLint ref, GLuint mask) {
+	trace_real_glStencilFunc(func, ref, mask);
+	trace_begin_call(27);
+	trace_put(&func, sizeof(func));
+	trace_put(&ref, sizeof(ref));
+	trace_put(&mask, sizeof(mask));
+	trace_end_call();
+}
+static PFNGLSTENCILOPPROC trace_real_glStencilOp = NULL;
+static void APIENTRY trace_glStencilOp(GLenum fail, GLenum zfail, GLenum zpass) {
+	trace_real_glStencilOp(fail, zfail, zpass);
+	trace_begin_call(28);
+	trace_put(&fail, sizeof(fail));
+	trace_put(&zfail, sizeof(zfail));
+	trace_put(&zpass, sizeof(zpass));
+	trace_end_call();
+}
+static PFNGLDEPTHFUNCPROC trace_real_glDepthFunc = NULL;
+static void APIENTRY trace_glDepthFunc(GLenum func) {
+	trace_real_glDepthFunc(func);
+	trace_begin_call(29);
+	trace_put(&func, sizeof(func));
+	trace_end_call();
+}
+static PFNGLPIXELSTOREFPROC trace_real_glPixelStoref = NULL;
+static void APIENTRY trace_glPixelStoref(GLenum pname, GLfloat param) {
+	trace_real_glPixelStoref(pname, param);
+	trace_begin_call(30);
+	trace_put(&pname, sizeof(pname));
+	trace_put(&param, sizeof(param));
+	trace_end_call();
+}
+static PFNGLPIXELSTOREIPROC trace_real_glPixelStorei = NULL;
+static void APIENTRY trace_glPixelStorei(GLenum pname, GLint param) {
+	trace_real_glPixelStorei(pname, param);
+	trace_begin_call(31);
+	trace_put(&pname, sizeof(pname));
+	trace_put(&param, sizeof(param));
+	trace_end_call();
+	trace_hook_pixel_store(pname, param);
+}
+static PFNGLREADBUFFERPROC trace_real_glReadBuffer = NULL;
+static void APIENTRY trace_glReadBuffer(GLenum src) {
+	trace_real_glReadBuffer(src);
+	trace_begin_call(32);
+	trace_put(&src, sizeof(src));
+	trace_end_call();
+}
+static PFNGLREADPIXELSPROC trace_real_glReadPixels = NULL;
+static void APIENTRY trace_glReadPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void *pixels) {
+	trace_real_glReadPixels(x, y, width, height, format, type, pixels);
+	trace_begin_call(33);
+	trace_put(&x, sizeof(x));
+	trace_put(&y, sizeof(y));
+	trace_put(&width, sizeof(width));
+	trace_put(&height, sizeof(height));
+	trace_put(&format, sizeof(format));
+	trace_put(&type, sizeof(type));
+	trace_end_call();
+}
+static PFNGLGETBOOLEANVPROC trace_real_glGetBooleanv = NULL;
+static void APIENTRY trace_glGetBooleanv(GLenum pname, GLboolean *data) {
+	trace_real_glGetBooleanv(pname, data);
+	trace_begin_call(34);
+	trace_put(&pname, sizeof(pname));
+	trace_end_call();
+}
+static PFNGLGETDOUBLEVPROC trace_real_glGetDoublev = NULL;
+static void APIENTRY trace_glGetDoublev(GLenum pname, GLdouble *data) {
+	trace_real_glGetDoublev(pname, data);
+	trace_begin_call(35);
+	trace_put(&pname, sizeof(pname));
+	trace_end_call();
+}
+static PFNGLGETERRORPROC trace_real_glGetError = NULL;
+static GLenum APIENTRY trace_glGetError(void) {
+	GLenum glad_result;
+	glad_result = trace_real_glGetError();
+	trace_begin_call(36);
+	trace_put(&glad_result, sizeof(glad_result));
+	trace_end_call();
+	return glad_result;
+}
+static PFNGLGETFLOATVPROC trace_real_glGetFloatv = NULL;
+static void APIENTRY trace_glGetFloatv(GLenum pname, GLfloat *data) {
+	trace_real_glGetFloatv(pname, data);
+	trace_begin_call(37);
+	trace_put(&pname, sizeof(pname));
+	trace_end_call();
+}
+static PFNGLGETINTEGERVPROC trace_real_glGetIntegerv = NULL;
+static void APIENTRY trace_glGetIntegerv(GLenum pname, GLint *data) {
+	trace_real_glGetIntegerv(pname, data);
+	trace_begin_call(38);
+	trace_put(&pname, sizeof(pname));
+	trace_end_call();
+}
+static PFNGLGETSTRINGPROC trace_real_glGetString = NULL;
+static const GLubyte * APIENTRY trace_glGetString(GLenum name) {
+	const GLubyte * glad_result;
+	glad_result = trace_real_glGetString(name);
+	trace_begin_call(39);
+	trace_put(&name, sizeof(name));
+	trace_end_call();
+	return glad_result;
+}
+static PFNGLGETTEXIMAGEPROC trace_real_glGetTexImage = NULL;
+static void APIENTRY trace_glGetTexImage(GLenum target, GLint level, GLenum format, GLenum type, void *pixels) {
+	trace_real_glGetTexImage(target, level, format, type, pixels);
+	trace_begin_call(40);
+	trace_put(&target, sizeof(target));
+	trace_put(&level, sizeof(level));
+	trace_put(&format, sizeof(format));
+	trace_put(&type, sizeof(type));
+	trace_end_call();
+}
+static PFNGLGETTEXPARAMETERFVPROC trace_real_glGetTexParameterfv = NULL;
+static void APIENTRY trace_glGetTexParameterfv(GLenum target, GLenum pname, GLfloat *params) {
+	trace_real_glGetTexParameterfv(target, pname, params);
+	trace_begin_call(41);
+	trace_put(&target, sizeof(target));
+	trace_put(&pname, sizeof(pname));
+	trace_end_call();
+}
+static PFNGLGETTEXPARAMETERIVPROC trace_real_glGetTexParameteriv = NULL;
+static void APIENTRY trace_glGetTexParameteriv(GLenum target, GLenum pname, GLint *params) {
+	trace_real_glGetTexParameteriv(target, pname, params);
+	trace_begin_call(42);
+	trace_put(&target, sizeof(target));
+	trace_put(&pname, sizeof(pname));
+	trace_end_call();
+}
+static PFNGLGETTEXLEVELPARAMETERFVPROC trace_real_glGetTexLevelParameterfv = NULL;
+static void APIENTRY trace_glGetTexLevelParameterfv(GLenum target, GLint level, GLenum pname, GLfloat *params) {
+	trace_real_glGetTexLevelParameterfv(target, level, pname, params);
+	trace_begin_call(43);
+	trace_put(&target, sizeof(target));
+	trace_put(&level, sizeof(level));
+	trace_put(&pname, sizeof(pname));
+	trace_end_call();
+}
+static PFNGLGETTEXLEVELPARAMETERIVPROC trace_real_glGetTexLevelParameteriv = NULL;
+static void APIENTRY trace_glGetTexLevelParameteriv(GLenum target, GLint level, GLenum pname, GLint *params) {
+	trace_real_glGetTexLevelParameteriv(target, level, pname, params);
+	trace_begin_call(44);
+	trace_put(&target, sizeof(target));
+	trace_put(&level, sizeof(level));
+	trace_put(&pname, sizeof(pname));
+	trace_end_call();
+}
+static PFNGLISENABLEDPROC trace_real_glIsEnabled = NULL;
+static GLboolean APIENTRY trace_glIsEnabled(GLenum cap) {
+	GLboolean glad_result;
+	glad_result = trace_real_glIsEnabled(cap);
+	trace_begin_call(45);
+	trace_put(&cap, sizeof(cap));
+	trace_put(&glad_result, sizeof(glad_result));
+	trace_end_call();
+	return glad_result;
+}
+static PFNGLDEPTHRANGEPROC trace_real_glDepthRange = NULL;
+static void APIENTRY trace_glDepthRange(GLdouble n, GLdouble f) {
+	trace_real_glDepthRange(n, f);
+	trace_begin_call(46);
+	trace_put(&n, sizeof(n));
+	trace_put(&f, sizeof(f));
+	trace_end_call();
+}
+static PFNGLVIEWPORTPROC trace_real_glViewport = NULL;
+static void APIENTRY trace_glViewport(GLint x, GLint y, GLsizei width, GLsizei height) {
+	trace_real_glViewport(x, y, width, height);
+	trace_begin_call(47);
+	trace_put(&x, sizeof(x));
+	trace_put(&y, sizeof(y));
+	trace_put(&width, sizeof(width));
+	trace_put(&height, sizeof(height));
+	trace_end_call();
+}
+static PFNGLNEWLISTPROC trace_real_glNewList = NULL;
+static void APIENTRY trace_glNewList(GLuint list, GLenum mode) {
+	trace_real_glNewList(list, mode);
+	trace_begin_call(48);
+	trace_put(&list, sizeof(list));
+	trace_put(&mode, sizeof(mode));
+	trace_end_call();
+}
+static PFNGLENDLISTPROC trace_real_glEndList = NULL;
+static void APIENTRY trace_glEndList(void) {
+	trace_real_glEndList();
+	trace_begin_call(49);
+	trace_end_call();
+}
+static PFNGLCALLLISTPROC trace_real_glCallList = NULL;
+static void APIENTRY trace_glCallList(GLuint list) {
+	trace_real_glCallList(list);
+	trace_begin_call(50);
+	trace_put(&list, sizeof(list));
+	trace_end_call();
+}
+static PFNGLCALLLISTSPROC trace_real_glCallLists = NULL;
+static void APIENTRY trace_glCallLists(GLsizei n, GLenum type, const void *lists) {
+	trace_real_glCallLists(n, type, lists);
+	trace_begin_call(51);
+	trace_put(&n, sizeof(n));
+	trace_put(&type, sizeof(type));
+	trace_put_unsupported(lists != NULL);
+	trace_end_call();
+}
+static PFNGLDELETELISTSPROC trace_real_glDeleteLists = NULL;
+static void APIENTRY trace_glDeleteLists(GLuint list, GLsizei range) {
+	trace_real_glDeleteLists(list, range);
+	trace_begin_call(52);
+	trace_put(&list, sizeof(list));
+	trace_put(&range, sizeof(range));
+	trace_end_call();
+}
+static PFNGLGENLISTSPROC trace_real_glGenLists = NULL;
+static GLuint APIENTRY trace_glGenLists(GLsizei range) {
+	GLuint glad_result;
+	glad_result = trace_real_glGenLists(range);
+	trace_begin_call(53);
+	trace_put(&range, sizeof(range));
+	trace_put(&glad_result, sizeof(glad_result));
+	trace_end_call();
+	return glad_result;
+}
+static PFNGLLISTBASEPROC trace_real_glListBase = NULL;
+static void APIENTRY trace_glListBase(GLuint base) {
+	trace_real_glListBase(base);
+	trace_begin_call(54);
+	trace_put(&base, sizeof(base));
+	trace_end_call();
+}
+static PFNGLBEGINPROC trace_real_glBegin = NULL;
+static void APIENTRY trace_glBegin(GLenum mode) {
+	trace_real_glBegin(mode);
+	trace_begin_call(55);
+	trace_put(&mode, sizeof(mode));
+	trace_end_call();
+}
+static PFNGLBITMAPPROC trace_real_glBitmap = NULL;
+static void APIENTRY trace_glBitmap(GLsizei width, GLsizei height, GLfloat xorig, GLfloat yorig, GLfloat xmove, GLfloat ymove, const GLubyte *bitmap) {
+	trace_real_glBitmap(width, height, xorig, yorig, xmove, ymove, bitmap);
+	trace_begin_call(56);
+	trace_put(&width, sizeof(width));
+	trace_put(&height, sizeof(height));
+	trace_put(&xorig, sizeof(xorig));
+	trace_put(&yorig, sizeof(yorig));
+	trace_put(&xmove, sizeof(xmove));
+	trace_put(&ymove, sizeof(ymove));
+	trace_put_unsupported(bitmap != NULL);
+	trace_end_call();
+}
+static PFNGLCOLOR3BPROC trace_real_glColor3b = NULL;
+static void APIENTRY trace_glColor3b(GLbyte red, GLbyte green, GLbyte blue) {
+	trace_real_glColor3b(red, green, blue);
+	trace_begin_call(57);
+	trace_put(&red, sizeof(red));
+	trace_put(&green, sizeof(green));
+	trace_put(&blue, sizeof(blue));
+	trace_end_call();
+}
+static PFNGLCOLOR3BVPROC trace_real_glColor3bv = NULL;
+static void APIENTRY trace_glColor3bv(const GLbyte *v) {
+	trace_real_glColor3bv(v);
+	trace_begin_call(58);
+	trace_put_data(v, v == NULL ? 0 : (size_t)(3 * sizeof(GLbyte)));
+	trace_end_call();
+}
+static PFNGLCOLOR3DPROC trace_real_glColor3d = NULL;
+static void APIENTRY trace_glColor3d(GLdouble red, GLdouble green, GLdouble blue) {
+	trace_real_glColor3d(red, green, blue);
+	trace_begin_call(59);
+	trace_put(&red, sizeof(red));
+	trace_put(&green, sizeof(green));
+	trace_put(&blue, sizeof(blue));
+	trace_end_call();
+}
+static PFNGLCOLOR3DVPROC trace_real_glColor3dv = NULL;
+static void APIENTRY trace_glColor3dv(const GLdouble *v) {
+	trace_real_glColor3dv(v);
+	trace_begin_call(60);
+	trace_put_data(v, v == NULL ? 0 : (size_t)(3 * sizeof(GLdouble)));
+	trace_end_call();
+}
+static PFNGLCOLOR3FPROC trace_real_glColor3f = NULL;
+static void APIENTRY trace_glColor3f(GLfloat red, GLfloat green, GLfloat blue) {
+	trace_real_glColor3f(red, green, blue);
+	trace_begin_call(61);
+	trace_put(&red, sizeof(red));
+	trace_put(&green, sizeof(green));
+	trace_put(&blue, sizeof(blue));
+	trace_end_call();
+}
+static PFNGLCOLOR3FVPROC trace_real_glColor3fv = NULL;
+static void APIENTRY trace_glColor3fv(const GLfloat *v) {
+	trace_real_glColor3fv(v);
+	trace_begin_call(62);
+	trace_put_data(v, v == NULL ? 0 : (size_t)(3 * sizeof(GLfloat)));
+	trace_end_call();
+}
+static PFNGLCOLOR3IPROC trace_real_glColor3i = NULL;
+static void APIENTRY trace_glColor3i(GLint red, GLint green, GLint blue) {
+	trace_real_glColor3i(red, green, blue);
+	trace_begin_call(63);
+	trace_put(&red, sizeof(red));
+	trace_put(&green, sizeof(green));
+	trace_put(&blue, sizeof(blue));
+	trace_end_call();
+}
+static PFNGLCOLOR3IVPROC trace_real_glColor3iv = NULL;
+static void APIENTRY trace_glColor3iv(const GLint *v) {
+	trace_real_glColor3iv(v);
+	trace_begin_call(64);
+	trace_put_data(v, v == NULL ? 0 : (size_t)(3 * sizeof(GLint)));
+	trace_end_call();
+}
+static PFNGLCOLOR3SPROC trace_real_glColor3s = NULL;
+static void APIENTRY trace_glColor3s(GLshort red, GLshort green, GLshort blue) {
+	trace_real_glColor3s(red, green, blue);
+	trace_begin_call(65);
+	trace_put(&red, sizeof(red));
+	trace_put(&green, sizeof(green));
+	trace_put(&blue, sizeof(blue));
+	trace_end_call();
+}
+static PFNGLCOLOR3SVPROC trace_real_glColor3sv = NULL;
+static void APIENTRY trace_glColor3sv(const GLshort *v) {
+	trace_real_glColor3sv(v);
+	trace_begin_call(66);
+	trace_put_data(v, v == NULL ? 0 : (size_t)(3 * sizeof(GLshort)));
+	trace_end_call();
+}
+static PFNGLCOLOR3UBPROC trace_real_glColor3ub = NULL;
+static void APIENTRY trace_glColor3ub(GLubyte red, GLubyte green, GLubyte blue) {
+	trace_real_glColor3ub(red, green, blue);
+	trace_begin_call(67);
+	trace_put(&red, sizeof(red));
+	trace_put(&green, sizeof(green));
+	trace_put(&blue, sizeof(blue));
+	trace_end_call();
+}
+static PFNGLCOLOR3UBVPROC trace_real_glColor3ubv = NULL;
+static void APIENTRY trace_glColor3ubv(const GLubyte *v) {
+	trace_real_glColor3ubv(v);
+	trace_begin_call(68);
+	trace_put_data(v, v == NULL ? 0 : (size_t)(3 * sizeof(GLubyte)));
+	trace_end_call();
+}
+static PFNGLCOLOR3UIPROC trace_real_glColor3ui = NULL;
+static void APIENTRY trace_glColor3ui(GLuint red, GLuint green, GLuint blue) {
+	trace_real_glColor3ui(red, green, blue);
+	trace_begin_call(69);
+	trace_put(&red, sizeof(red));
+	trace_put(&green, sizeof(green));
+	trace_put(&blue, sizeof(blue));
+	trace_end_call();
+}
+static PFNGLCOLOR3UIVPROC trace_real_glColor3uiv = NULL;
+static void APIENTRY trace_glColor3uiv(const GLuint *v) {
+	trace_real_glColor3uiv(v);
+	trace_begin_call(70);
+	trace_put_data(v, v == NULL ? 0 : (size_t)(3 * sizeof(GLuint)));
+	trace_end_call();
+}
+static PFNGLCOLOR3USPROC trace_real_glColor3us = NULL;
+static void APIENTRY trace_glColor3us(GLushort red, GLushort green, GLushort blue) {
+	trace_real_glColor3us(red, green, blue);
+	trace_begin_call(71);
+	trace_put(&red, sizeof(red));
+	trace_put(&green, sizeof(green));
+	trace_put(&blue, sizeof(blue));
+	trace_end_call();
+}
+static PFNGLCOLOR3USVPROC trace_real_glColor3usv = NULL;
+static void APIENTRY trace_glColor3usv(const GLushort *v) {
+	trace_real_glColor3usv(v);
+	trace_begin_call(72);
+	trace_put_data(v, v == NULL ? 0 : (size_t)(3 * sizeof(GLushort)));
+	trace_end_call();
+}
+static PFNGLCOLOR4BPROC trace_real_glColor4b = NULL;
+static void APIENTRY trace_glColor4b(GLbyte red, GLbyte green, GLbyte blue, GLbyte alpha) {
+	trace_real_glColor4b(red, green, blue, alpha);
+	trace_begin_call(73);
+	trace_put(&red, sizeof(red));
+	trace_put(&green, sizeof(green));
+	trace_put(&blue, sizeof(blue));
+	trace_put(&alpha, sizeof(alpha));
+	trace_end_call();
+}
+static PFNGLCOLOR4BVPROC trace_real_glColor4bv = NULL;
+static void APIENTRY trace_glColor4bv(const GLbyte *v) {
+	trace_real_glColor4bv(v);
+	trace_begin_call(74);
+	trace_put_data(v, v == NULL ? 0 : (size_t)(4 * sizeof(GLbyte)));
+	trace_end_call();
+}
+static PFNGLCOLOR4DPROC trace_real_glColor4d = NULL;
+static void APIENTRY trace_glColor4d(GLdouble red, GLdouble green, GLdouble blue, GLdouble alpha) {
+	trace_real_glColor4d(red, green, blue, alpha);
+	trace_begin_call(75);
+	trace_put(&red, sizeof(red));
+	trace_put(&green, sizeof(green));
+	trace_put(&blue, sizeof(blue));
+	trace_put(&alpha, sizeof(alpha));
+	trace_end_call();
+}
+static PFNGLCOLOR4DVPROC trace_real_glColor4dv = NULL;
+static void APIENTRY trace_glColor4dv(const GLdouble *v) {
+	trace_real_glColor4dv(v);
+	trace_begin_call(76);
+	trace_put_data(v, v == NULL ? 0 : (size_t)(4 * sizeof(GLdouble)));
+	trace_end_call();
+}
+static PFNGLCOLOR4FPROC trace_real_glColor4f = NULL;
+static void APIENTRY trace_glColor4f(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) {
+	trace_real_glColor4f(red, green, blue, alpha);
+	trace_begin_call(77);
+	trace_put(&red, sizeof(red));
+	trace_put(&green, sizeof(green));
+	trace_put(&blue, sizeof(blue));
+	trace_put(&alpha, sizeof(alpha));
+	trace_end_call();
+}
+static PFNGLCOLOR4FVPROC trace_real_glColor4fv = NULL;
+static void APIENTRY trace_glColor4fv(const GLfloat *v) {
+	trace_real_glColor4fv(v);
+	trace_begin_call(78);
+	trace_put_data(v, v == NULL ? 0 : (size_t)(4 * sizeof(GLfloat)));
+	trace_end_call();
+}
+static PFNGLCOLOR4IPROC trace_real_glColor4i = NULL;
+static void APIENTRY trace_glColor4i(GLint red, GLint green, GLint blue, GLint alpha) {
+	trace_real_glColor4i(red, green, blue, alpha);
+	trace_begin_call(79);
+	trace_put(&red, sizeof(red));
+	trace_put(&green, sizeof(green));
+	trace_put(&blue, sizeof(blue));
+	trace_put(&alpha, sizeof(alpha));
+	trace_end_call();
+}
+static PFNGLCOLOR4IVPROC trace_real_glColor4iv = NULL;
+static void APIENTRY trace_glColor4iv(const GLint *v) {
+	trace_real_glColor4iv(v);
+	trace_begin_call(80);
+	trace_put_data(v, v == NULL ? 0 : (size_t)(4 * sizeof(GLint)));
+	trace_end_call();
+}
+static PFNGLCOLOR4SPROC trace_real_glColor4s = NULL;
+static void APIENTRY trace_glColor4s(GLshort red, GLshort green, GLshort blue, GLshort alpha) {
+	trace_real_glColor4s(red, green, blue, alpha);
+	trace_begin_call(81);
+	trace_put(&red, sizeof(red));
+	trace_put(&green, sizeof(green));
+	trace_put(&blue, sizeof(blue));
+	trace_put(&alpha, sizeof(alpha));
+	trace_end_call();
+}
+static PFNGLCOLOR4SVPROC trace_real_glColor4sv = NULL;
+static void APIENTRY trace_glColor4sv(const GLshort *v) {
+	trace_real_glColor4sv(v);
+	trace_begin_call(82);
+	trace_put_data(v, v == NULL ? 0 : (size_t)(4 * sizeof(GLshort)));
+	trace_end_call();
+}
+static PFNGLCOLOR4UBPROC trace_real_glColor4ub = NULL;
+static void APIENTRY trace_glColor4ub(GLubyte red, GLubyte green, GLubyte blue, GLubyte alpha) {
+	trace_real_glColor4ub(red, green, blue, alpha);
+	trace_begin_call(83);
+	trace_put(&red, sizeof(red));
+	trace_put(&green, sizeof(green));
+	trace_put(&blue, sizeof(blue));
+	trace_put(&alpha, sizeof(alpha));
+	trace_end_call();
+}
+static PFNGLCOLOR4UBVPROC trace_real_glColor4ubv = NULL;
+static void APIENTRY trace_glColor4ubv(const GLubyte *v) {
+	trace_real_glColor4ubv(v);
+	trace_begin_call(84);
+	trace_put_data(v, v == NULL ? 0 : (size_t)(4 * sizeof(GLubyte)));
+	trace_end_call();
+}
+static PFNGLCOLOR4UIPROC trace_real_glColor4ui = NULL;
+static void APIENTRY trace_glColor4ui(GLuint red, GLuint green, GLuint blue, GLuint alpha) {
+	trace_real_glColor4ui(red, green, blue, alpha);
+	trace_begin_call(85);
+	trace_put(&red, sizeof(red));
+	trace_put(&green, sizeof(green));
+	trace_put(&blue, sizeof(blue));
+	trace_put(&alpha, sizeof(alpha));
+	trace_end_call();
+}
+static PFNGLCOLOR4UIVPROC trace_real_glColor4uiv = NULL;
+static void APIENTRY trace_glColor4uiv(const GLuint *v) {
+	trace_real_glColor4uiv(v);
+	trace_begin_call(86);
+	trace_put_data(v, v == NULL ? 0 : (size_t)(4 * sizeof(GLuint)));
+	trace_end_call();
+}
+static PFNGLCOLOR4USPROC trace_real_glColor4us = NULL;
+static void APIENTRY trace_glColor4us(GLushort red, GLushort green, GLushort blue, GLushort alpha) {
+	trace_real_glColor4us(red, green, blue, alpha);
+	trace_begin_call(87);
+	trace_put(&red, sizeof(red));
+	trace_put(&green, sizeof(green));
+	trace_put(&blue, sizeof(blue));
+	trace_put(&alpha, sizeof(alpha));
+	trace_end_call();
+}
+static PFNGLCOLOR4USVPROC trace_real_glColor4usv = NULL;
+static void APIENTRY trace_glColor4usv(const GLushort *v) {
+	trace_real_glColor4usv(v);
+	trace_begin_call(88);
+	trace_put_data(v, v == NULL ? 0 : (size_t)(4 * sizeof(GLushort)));
+	trace_end_call();
+}
+static PFNGLEDGEFLAGPROC trace_real_glEdgeFlag = NULL;
+static void APIENTRY trace_glEdgeFlag(GLboolean flag) {
+	trace_real_glEdgeFlag(flag);
+	trace_begin_call(89);
+	trace_put(&flag, sizeof(flag));
+	trace_end_call();
+}
+static PFNGLEDGEFLAGVPROC trace_real_glEdgeFlagv = NULL;
+static void APIENTRY trace_glEdgeFlagv(const GLboolean *flag) {
+	trace_real_glEdgeFlagv(flag);
+	trace_begin_call(90);
+	trace_put_unsupported(flag != NULL);
+	trace_end_call();
+}
+static PFNGLENDPROC trace_real_glEnd = NULL;
+static void APIENTRY trace_glEnd(void) {
+	trace_real_glEnd();
+	trace_begin_call(91);
+	trace_end_call();
+}
+static PFNGLINDEXDPROC trace_real_glIndexd = NULL;
+static void APIENTRY trace_glIndexd(GLdouble c) {
+	trace_real_glIndexd(c);
+	trace_begin_call(92);
+	trace_put(&c, sizeof(c));
+	trace_end_call();
+}
+static PFNGLINDEXDVPROC trace_real_glIndexdv = NULL;
+static void APIENTRY trace_glIndexdv(const GLdouble *c) {
+	trace_real_glIndexdv(c);
+	trace_begin_call(93);
+	trace_put_unsupported(c != NULL);
+	trace_end_call();
+}
+static PFNGLINDEXFPROC trace_real_glIndexf = NULL;
+static void APIENTRY trace_glIndexf(GLfloat c) {
+	trace_real_glIndexf(c);
+	trace_begin_call(94);
+	trace_put(&c, sizeof(c));
+	trace_end_call();
+}
+static PFNGLINDEXFVPROC trace_real_glIndexfv = NULL;
+static void APIENTRY trace_glIndexfv(const GLfloat *c) {
+	trace_real_glIndexfv(c);
+	trace_begin_call(95);
+	trace_put_unsupported(c != NULL);
+	trace_end_call();
+}
+static PFNGLINDEXIPROC trace_real_glIndexi = NULL;
+static void APIENTRY trace_glIndexi(GLint c) {
+	trace_real_glIndexi(c);
+	trace_begin_call(96);
+	trace_put(&c, sizeof(c));
+	trace_end_call();
+}
+static PFNGLINDEXIVPROC trace_real_glIndexiv = NULL;
+static void APIENTRY trace_glIndexiv(const GLint *c) {
+	trace_real_glIndexiv(c);
+	trace_begin_call(97);
+	trace_put_unsupported(c != NULL);
+	trace_end_call();
+}
+static PFNGLINDEXSPROC trace_real_glIndexs = NULL;
+static void APIENTRY trace_glIndexs(GLshort c) {
+	trace_real_glIndexs(c);
+	trace_begin_call(98);
+	trace_put(&c, sizeof(c));
+	trace_end_call();
+}
+static PFNGLINDEXSVPROC trace_real_glIndexsv = NULL;
+static void APIENTRY trace_glIndexsv(const GLshort *c) {
+	trace_real_glIndexsv(c);
+	trace_begin_call(99);
+	trace_put_unsupported(c != NULL);
+	trace_end_call();
+}
+static PFNGLNORMAL3BPROC trace_real_glNormal3b = NULL;
+static void APIENTRY trace_glNormal3b(GLbyte nx, GLbyte ny, GLbyte nz) {
+	trace_real_glNormal3b(nx, ny, nz);
+	trace_begin_call(100);
+	trace_put(&nx, sizeof(nx));
+	trace_put(&ny, sizeof(ny));
+	trace_put(&nz, sizeof(nz));
+	trace_end_call();
+}
+static PFNGLNORMAL3BVPROC trace_real_glNormal3bv = NULL;
+static void APIENTRY trace_glNormal3bv(const GLbyte *v) {
+	trace_real_glNormal3bv(v);
+	trace_begin_call(101);
+	trace_put_data(v, v == NULL ? 0 : (size_t)(3 * sizeof(GLbyte)));
+	trace_end_call();
+}
+static PFNGLNORMAL3DPROC trace_real_glNormal3d = NULL;
+static void APIENTRY trace_glNormal3d(GLdouble nx, GLdouble ny, GLdouble nz) {
+	trace_real_glNormal3d(nx, ny, nz);
+	trace_begin_call(102);
+	trace_put(&nx, sizeof(nx));
+	trace_put(&ny, sizeof(ny));
+	trace_put(&nz, sizeof(nz));
+	trace_end_call();
+}
+static PFNGLNORMAL3DVPROC trace_real_glNormal3dv = NULL;
+static void APIENTRY trace_glNormal3dv(const GLdouble *v) {
+	trace_real_glNormal3dv(v);
+	trace_begin_call(103);
+	trace_put_data(v, v == NULL ? 0 : (size_t)(3 * sizeof(GLdouble)));
+	trace_end_call();
+}
+static PFNGLNORMAL3FPROC trace_real_glNormal3f = NULL;
+static void APIENTRY trace_glNormal3f(GLfloat nx, GLfloat ny, GLfloat nz) {
+	trace_real_glNormal3f(nx, ny, nz);
+	trace_begin_call(104);
+	trace_put(&nx, sizeof(nx));
+	trace_put(&ny, sizeof(ny));
+	trace_put(&nz, sizeof(nz));
+	trace_end_call();
+}
+static PFNGLNORMAL3FVPROC trace_real_glNormal3fv = NULL;
+static void APIENTRY trace_glNormal3fv(const GLfloat *v) {
+	trace_real_glNormal3fv(v);
+	trace_begin_call(105);
+	trace_put_data(v, v == NULL ? 0 : (size_t)(3 * sizeof(GLfloat)));
+	trace_end_call();
+}
+static PFNGLNORMAL3IPROC trace_real_glNormal3i = NULL;
+static void APIENTRY trace_glNormal3i(GLint nx, GLint ny, GLint nz) {
+	trace_real_glNormal3i(nx, ny, nz);
+	trace_begin_call(106);
+	trace_put(&nx, sizeof(nx));
+	trace_put(&ny, sizeof(ny));
+	trace_put(&nz, sizeof(nz));
+	trace_end_call();
+}
+static PFNGLNORMAL3IVPROC trace_real_glNormal3iv = NULL;
+static void APIENTRY trace_glNormal3iv(const GLint *v) {
+	trace_real_glNormal3iv(v);
+	trace_begin_call(107);
+	trace_put_data(v, v == NULL ? 0 : (size_t)(3 * sizeof(GLint)));
+	trace_end_call();
+}
+static PFNGLNORMAL3SPROC trace_real_glNormal3s = NULL;
+static void APIENTRY trace_glNormal3s(GLshort nx, GLshort ny, GLshort nz) {
+	trace_real_glNormal3s(nx, ny, nz);
+	trace_begin_call(108);
+	trace_put(&nx, sizeof(nx));
+	trace_put(&ny, sizeof(ny));
+	trace_put(&nz, sizeof(nz));
+	trace_end_call();
+}
+static PFNGLNORMAL3SVPROC trace_real_glNormal3sv = NULL;
+static void APIENTRY trace_glNormal3sv(const GLshort *v) {
+	trace_real_glNormal3sv(v);
+	trace_begin_call(109);
+	trace_put_data(v, v == NULL ? 0 : (size_t)(3 * sizeof(GLshort)));
+	trace_end_call();
+}
+static PFNGLRASTERPOS2DPROC trace_real_glRasterPos2d = NULL;
+static void APIENTRY trace_glRasterPos2d(GLdouble x, GLdouble y) {
+	trace_real_glRasterPos2d(x, y);
+	trace_begin_call(110);
+	trace_put(&x, sizeof(x));
+	trace_put(&y, sizeof(y));
+	trace_end_call();
+}
+static PFNGLRASTERPOS2DVPROC trace_real_glRasterPos2dv = NULL;
+static void APIENTRY trace_glRasterPos2dv(const GLdouble *v) {
+	trace_real_glRasterPos2dv(v);
+	trace_begin_call(111);
+	trace_put_data(v, v == NULL ? 0 : (size_t)(2 * sizeof(GLdouble)));
+	trace_end_call();
+}
+static PFNGLRASTERPOS2FPROC trace_real_glRasterPos2f = NULL;
+static void APIENTRY trace_glRasterPos2f(GLfloat x, GLfloat y) {
+	trace_real_glRasterPos2f(x, y);
+	trace_begin_call(112);
+	trace_put(&x, sizeof(x));
+	trace_put(&y, sizeof(y));
+	trace_end_call();
+}
+static PFNGLRASTERPOS2FVPROC trace_real_glRasterPos2fv = NULL;
+static void APIENTRY trace_glRasterPos2fv(const GLfloat *v) {
+	trace_real_glRasterPos2fv(v);
+	trace_begin_call(113);
+	trace_put_data(v, v == NULL ? 0 : (size_t)(2 * sizeof(GLfloat)));
+	trace_end_call();
+}
+static PFNGLRASTERPOS2IPROC trace_real_glRasterPos2i = NULL;
+static void APIENTRY trace_glRasterPos2i(GLint x, GLint y) {
+	trace_real_glRasterPos2i(x, y);
+	trace_begin_call(114);
+	trace_put(&x, sizeof(x));
+	trace_put(&y, sizeof(y));
+	trace_end_call();
+}
+static PFNGLRASTERPOS2IVPROC trace_real_glRasterPos2iv = NULL;
+static void APIENTRY trace_glRasterPos2iv(const GLint *v) {
+	trace_real_glRasterPos2iv(v);
+	trace_begin_call(115);
+	trace_put_data(v, v == NULL ? 0 : (size_t)(2 * sizeof(GLint)));
+	trace_end_call();
+}
+static PFNGLRASTERPOS2SPROC trace_real_glRasterPos2s = NULL;
+static void APIENTRY trace_glRasterPos2s(GLshort x, GLshort y) {
+	trace_real_glRasterPos2s(x, y);
+	trace_begin_call(116);
+	trace_put(&x, sizeof(x));
+	trace_put(&y, sizeof(y));
+	trace_end_call();
+}
+static PFNGLRASTERPOS2SVPROC trace_real_glRasterPos2sv = NULL;
+static void APIENTRY trace_glRasterPos2sv(const GLshort *v) {
+	trace_real_glRasterPos2sv(v);
+	trace_begin_call(117);
+	trace_put_data(v, v == NULL ? 0 : (size_t)(2 * sizeof(GLshort)));
+	trace_end_call();
+}
+static PFNGLRASTERPOS3DPROC trace_real_glRasterPos3d = NULL;
+static void APIENTRY trace_glRasterPos3d(GLdouble x, GLdouble y, GLdouble z) {
+	trace_real_glRasterPos3d(x, y, z);
+	trace_begin_call(118);
+	trace_put(&x, sizeof(x));
+	trace_put(&y, sizeof(y));
+	trace_put(&z, sizeof(z));
+	trace_end_call();
+}
+static PFNGLRASTERPOS3DVPROC trace_real_glRasterPos3dv = NULL;
+static void APIENTRY trace_glRasterPos3dv(const GLdouble *v) {
+	trace_real_glRasterPos3dv(v);
+	trace_begin_call(119);
+	trace_put_data(v, v == NULL ? 0 : (size_t)(3 * sizeof(GLdouble)));
+	trace_end_call();
+}
+static PFNGLRASTERPOS3FPROC trace_real_glRasterPos3f = NULL;
+static void APIENTRY trace_glRasterPos3f(GLfloat x, GLfloat y, GLfloat z) {
+	trace_real_glRasterPos3f(x, y, z);
+	trace_begin_call(120);
+	trace_put(&x, sizeof(x));
+	trace_put(&y, sizeof(y));
+	trace_put(&z, sizeof(z));
+	trace_end_call();
+}
+static PFNGLRASTERPOS3FVPROC trace_real_glRasterPos3fv = NULL;
+static void APIENTRY trace_glRasterPos3fv(const GLfloat *v) {
+	trace_real_glRasterPos3fv(v);
+	trace_begin_call(121);
+	trace_put_data(v, v == NULL ? 0 : (size_t)(3 * sizeof(GLfloat)));
+	trace_end_call();
+}
+static PFNGLRASTERPOS3IPROC trace_real_glRasterPos3i = NULL;
+static void APIENTRY trace_glRasterPos3i(GLint x, GLint y, GLint z) {
+	trace_real_glRasterPos3i(x, y, z);
+	trace_begin_call(122);
+	trace_put(&x, sizeof(x));
+	trace_put(&y, sizeof(y));
+	trace_put(&z, sizeof(z));
+	trace_end_call();
+}
+static PFNGLRASTERPOS3IVPROC trace_real_glRasterPos3iv = NULL;
+static void APIENTRY trace_glRasterPos3iv(const GLint *v) {
+	trace_real_glRasterPos3iv(v);
+	trace_begin_call(123);
+	trace_put_data(v, v == NULL ? 0 : (size_t)(3 * sizeof(GLint)));
+	trace_end_call();
+}
+static PFNGLRASTERPOS3SPROC trace_real_glRasterPos3s = NULL;
+static void APIENTRY trace_glRasterPos3s(GLshort x, GLshort y, GLshort z) {
+	trace_real_glRasterPos3s(x, y, z);
+	trace_begin_call(124);
+	trace_put(&x, sizeof(x));
+	trace_put(&y, sizeof(y));
+	trace_put(&z, sizeof(z));
+	trace_end_call();
+}
+static PFNGLRASTERPOS3SVPROC trace_real_glRasterPos3sv = NULL;
+static void APIENTRY trace_glRasterPos3sv(const GLshort *v) {
+	trace_real_glRasterPos3sv(v);
+	trace_begin_call(125);
+	trace_put_data(v, v == NULL ? 0 : (size_t)(3 * sizeof(GLshort)));
+	trace_end_call();
+}
+static PFNGLRASTERPOS4DPROC trace_real_glRasterPos4d = NULL;
+static void APIENTRY trace_glRasterPos4d(GLdouble x, GLdouble y, GLdouble z, GLdouble w) {
+	trace_real_glRasterPos4d(x, y, z, w);
+	trace_begin_call(126);
+	trace_put(&x, sizeof(x));
+	trace_put(&y, sizeof(y));
+	trace_put(&z, sizeof(z));
+	trace_put(&w, sizeof(w));
+	trace_end_call();
+}
+static PFNGLRASTERPOS4DVPROC trace_real_glRasterPos4dv = NULL;
+static void APIENTRY trace_glRasterPos4dv(const GLdouble *v) {
+	trace_real_glRasterPos4dv(v);
+	trace_begin_call(127);
+	trace_put_data(v, v == NULL ? 0 : (size_t)(4 * sizeof(GLdouble)));
+	trace_end_call();
+}
+static PFNGLRASTERPOS4FPROC trace_real_glRasterPos4f = NULL;
+static void APIENTRY trace_glRasterPos4f(GLfloat x, GLfloat y, GLfloat z, GLfloat w) {
+	trace_real_glRasterPos4f(x, y, z, w);
+	trace_begin_call(128);
+	trace_put(&x, sizeof(x));
+	trace_put(&y, sizeof(y));
+	trace_put(&z, sizeof(z));
+	trace_put(&w, sizeof(w));
+	trace_end_call();
+}
+static PFNGLRASTERPOS4FVPROC trace_real_glRasterPos4fv = NULL;
+static void APIENTRY trace_glRasterPos4fv(const GLfloat *v) {
+	trace_real_glRasterPos4fv(v);
+	trace_begin_call(129);
+	trace_put_data(v, v == NULL ? 0 : (size_t)(4 * sizeof(GLfloat)));
+	trace_end_call();
+}
+static PFNGLRASTERPOS4IPROC trace_real_glRasterPos4i = NULL;
+static void APIENTRY trace_glRasterPos4i(GLint x, GLint y, GLint z, GLint w) {
+	trace_real_glRasterPos4i(x, y, z, w);
+	trace_begin_call(130);
+	trace_put(&x, sizeof(x));
+	trace_put(&y, sizeof(y));
+	trace_put(&z, sizeof(z));
+	trace_put(&w, sizeof(w));
+	trace_end_call();
+}
+static PFNGLRASTERPOS4IVPROC trace_real_glRasterPos4iv = NULL;
+static void APIENTRY trace_glRasterPos4iv(const GLint *v) {
+	trace_real_glRasterPos4iv(v);
+	trace_begin_call(131);
+	trace_put_data(v, v == NULL ? 0 : (size_t)(4 * sizeof(GLint)));
+	trace_end_call();
+}
+static PFNGLRASTERPOS4SPROC trace_real_glRasterPos4s = NULL;
+static void APIENTRY trace_glRasterPos4s(GLshort x, GLshort y, GLshort z, GLshort w) {
+	trace_real_glRasterPos4s(x, y, z, w);
+	trace_begin_call(132);
+	trace_put(&x, sizeof(x));
+	trace_put(&y, sizeof(y));
+	trace_put(&z, sizeof(z));
+	trace_put(&w, sizeof(w));
+	trace_end_call();
+}
+static PFNGLRASTERPOS4SVPROC trace_real_glRasterPos4sv = NULL;
+static void APIENTRY trace_glRasterPos4sv(const GLshort *v) {
+	trace_real_glRasterPos4sv(v);
+	trace_begin_call(133);
+	trace_put_data(v, v == NULL ? 0 : (size_t)(4 * sizeof(GLshort)));
+	trace_end_call();
+}
+static PFNGLRECTDPROC trace_real_glRectd = NULL;
+static void APIENTRY trace_glRectd(GLdouble x1, GLdouble y1, GLdouble x2, GLdouble y2) {
+	trace_real_glRectd(x1, y1, x2, y2);
+	trace_begin_call(134);
+	trace_put(&x1, sizeof(x1));
+	trace_put(&y1, sizeof(y1));
+	trace_put(&x2, sizeof(x2));
+	trace_put(&y2, sizeof(y2));
+	trace_end_call();
+}
+static PFNGLRECTDVPROC trace_real_glRectdv = NULL;
+static void APIENTRY trace_glRectdv(const GLdouble *v1, const GLdouble *v2) {
+	trace_real_glRectdv(v1, v2);
+	trace_begin_call(135);
+	trace_put_unsupported(v1 != NULL);
+	trace_put_unsupported(v2 != NULL);
+	trace_end_call();
+}
+static PFNGLRECTFPROC trace_real_glRectf = NULL;
+static void APIENTRY trace_glRectf(GLfloat x1, GLfloat y1, GLfloat x2, GLfloat y2) {
+	trace_real_glRectf(x1, y1, x2, y2);
+	trace_begin_call(136);
+	trace_put(&x1, sizeof(x1));
+	trace_put(&y1, sizeof(y1));
+	trace_put(&x2, sizeof(x2));
+	trace_put(&y2, sizeof(y2));
+	trace_end_call();
+}
+static PFNGLRECTFVPROC trace_real_glRectfv = NULL;
+static void APIENTRY trace_glRectfv(const GLfloat *v1, const GLfloat *v2) {
+	trace_real_glRectfv(v1, v2);
+	trace_begin_call(137);
+	trace_put_unsupported(v1 != NULL);
+	trace_put_unsupported(v2 != NULL);
+	trace_end_call();
+}
+static PFNGLRECTIPROC trace_real_glRecti = NULL;
+static void APIENTRY trace_glRecti(GLint x1, GLint y1, GLint x2, GLint y2) {
+	trace_real_glRecti(x1, y1, x2, y2);
+	trace_begin_call(138);
+	trace_put(&x1, sizeof(x1));
+	trace_put(&y1, sizeof(y1));
+	trace_put(&x2, sizeof(x2));
+	trace_put(&y2, sizeof(y2));
+	trace_end_call();
+}
+static PFNGLRECTIVPROC trace_real_glRectiv = NULL;
+static void APIENTRY trace_glRectiv(const GLint *v1, const GLint *v2) {
+	trace_real_glRectiv(v1, v2);
+	trace_begin_call(139);
+	trace_put_unsupported(v1 != NULL);
+	trace_put_unsupported(v2 != NULL);
+	trace_end_call();
+}
+static PFNGLRECTSPROC trace_real_glRects = NULL;
+static void APIENTRY trace_glRects(GLshort x1, GLshort y1, GLshort x2, GLshort y2) {
+	trace_real_glRects(x1, y1, x2, y2);
+	trace_begin_call(140);
+	trace_put(&x1, sizeof(x1));
+	trace_put(&y1, sizeof(y1));
+	trace_put(&x2, sizeof(x2));
+	trace_put(&y2, sizeof(y2));
+	trace_end_call();
+}
+static PFNGLRECTSVPROC trace_real_glRectsv = NULL;
+static void APIENTRY trace_glRectsv(const GLshort *v1, const GLshort *v2) {
+	trace_real_glRectsv(v1, v2);
+	trace_begin_call(141);
+	trace_put_unsupported(v1 != NULL);
+	trace_put_unsupported(v2 != NULL);
+	trace_end_call();
+}
+static PFNGLTEXCOORD1DPROC trace_real_glTexCoord1d = NULL;
+static void APIENTRY trace_glTexCoord1d(GLdouble s) {
+	trace_real_glTexCoord1d(s);
+	trace_begin_call(142);
+	trace_put(&s, sizeof(s));
+	trace_end_call();
+}
+static PFNGLTEXCOORD1DVPROC trace_real_glTexCoord1dv = NULL;
+static void APIENTRY trace_glTexCoord1dv(const GLdouble *v) {
+	trace_real_glTexCoord1dv(v);
+	trace_begin_call(143);
+	trace_put_data(v, v == NULL ? 0 : (size_t)(1 * sizeof(GLdouble)));
+	trace_end_call();
+}
+static PFNGLTEXCOORD1FPROC trace_real_glTexCoord1f = NULL;
+static void APIENTRY trace_glTexCoord1f(GLfloat s) {
+	trace_real_glTexCoord1f(s);
+	trace_begin_call(144);
+	trace_put(&s, sizeof(s));
+	trace_end_call();
+}
+static PFNGLTEXCOORD1FVPROC trace_real_glTexCoord1fv = NULL;
+static void APIENTRY trace_glTexCoord1fv(const GLfloat *v) {
+	trace_real_glTexCoord1fv(v);
+	trace_begin_call(145);
+	trace_put_data(v, v == NULL ? 0 : (size_t)(1 * sizeof(GLfloat)));
+	trace_end_call();
+}
+static PFNGLTEXCOORD1IPROC trace_real_glTexCoord1i = NULL;
+static void APIENTRY trace_glTexCoord1i(GLint s) {
+	trace_real_glTexCoord1i(s);
+	trace_begin_call(146);
+	trace_put(&s, sizeof(s));
+	trace_end_call();
+}
+static PFNGLTEXCOORD1IVPROC trace_real_glTexCoord1iv = NULL;
+static void APIENTRY trace_glTexCoord1iv(const GLint *v) {
+	trace_real_glTexCoord1iv(v);
+	trace_begin_call(147);
+	trace_put_data(v, v == NULL ? 0 : (size_t)(1 * sizeof(GLint)));
+	trace_end_call();
+}
+static PFNGLTEXCOORD1SPROC trace_real_glTexCoord1s = NULL;
+static void APIENTRY trace_glTexCoord1s(GLshort s) {
+	trace_real_glTexCoord1s(s);
+	trace_begin_call(148);
+	trace_put(&s, sizeof(s));
+	trace_end_call();
+}
+static PFNGLTEXCOORD1SVPROC trace_real_glTexCoord1sv = NULL;
+static void APIENTRY trace_glTexCoord1sv(const GLshort *v) {
+	trace_real_glTexCoord1sv(v);
+	trace_begin_call(149);
+	trace_put_data(v, v == NULL ? 0 : (size_t)(1 * sizeof(GLshort)));
+	trace_end_call();
+}
+static PFNGLTEXCOORD2DPROC trace_real_glTexCoord2d = NULL;
+static void APIENTRY trace_glTexCoord2d(GLdouble s, GLdouble t) {
+	trace_real_glTexCoord2d(s, t);
+	trace_begin_call(150);
+	trace_put(&s, sizeof(s));
+	trace_put(&t, sizeof(t));
+	trace_end_call();
+}
+static PFNGLTEXCOORD2DVPROC trace_real_glTexCoord2dv = NULL;
+static void APIENTRY trace_glTexCoord2dv(const GLdouble *v) {
+	trace_real_glTexCoord2dv(v);
+	trace_begin_call(151);
+	trace_put_data(v, v == NULL ? 0 : (size_t)(2 * sizeof(GLdouble)));
+	trace_end_call();
+}
+static PFNGLTEXCOORD2FPROC trace_real_glTexCoord2f = NULL;
+static void APIENTRY trace_glTexCoord2f(GLfloat s, GLfloat t) {
+	trace_real_glTexCoord2f(s, t);
+	trace_begin_call(152);
+	trace_put(&s, sizeof(s));
+	trace_put(&t, sizeof(t));
+	trace_end_call();
+}
+static PFNGLTEXCOORD2FVPROC trace_real_glTexCoord2fv = NULL;
+static void APIENTRY trace_glTexCoord2fv(const GLfloat *v) {
+	trace_real_glTexCoord2fv(v);
+	trace_begin_call(153);
+	trace_put_data(v, v == NULL ? 0 : (size_t)(2 * sizeof(GLfloat)));
+	trace_end_call();
+}
+static PFNGLTEXCOORD2IPROC trace_real_glTexCoord2i = NULL;
+static void APIENTRY trace_glTexCoord2i(GLint s, GLint t) {
+	trace_real_glTexCoord2i(s, t);
+	trace_begin_call(154);
+	trace_put(&s, sizeof(s));
+	trace_put(&t, sizeof(t));
+	trace_end_call();
+}
+static PFNGLTEXCOORD2IVPROC trace_real_glTexCoord2iv = NULL;
+static void APIENTRY trace_glTexCoord2iv(const GLint *v) {
+	trace_real_glTexCoord2iv(v);
+	trace_begin_call(155);
+	trace_put_data(v, v == NULL ? 0 : (size_t)(2 * sizeof(GLint)));
+	trace_end_call();
+}
+static PFNGLTEXCOORD2SPROC trace_real_glTexCoord2s = NULL;
+static void APIENTRY trace_glTexCoord2s(GLshort s, GLshort t) {
+	trace_real_glTexCoord2s(s, t);
+	trace_begin_call(156);
+	trace_put(&s, sizeof(s));
+	trace_put(&t, sizeof(t));
+	trace_end_call();
+}
+static PFNGLTEXCOORD2SVPROC trace_real_glTexCoord2sv = NULL;
+static void APIENTRY trace_glTexCoord2sv(const GLshort *v) {
+	trace_real_glTexCoord2sv(v);
+	trace_begin_call(157);
+	trace_put_data(v, v == NULL ? 0 : (size_t)(2 * sizeof(GLshort)));
+	trace_end_call();
+}
+static PFNGLTEXCOORD3DPROC trace_real_glTexCoord3d = NULL;
+static void APIENTRY trace_glTexCoord3d(GLdouble s, GLdouble t, GLdouble r) {
+	trace_real_glTexCoord3d(s, t, r);
+	trace_begin_call(158);
+	trace_put(&s, sizeof(s));
+	trace_put(&t, sizeof(t));
+	trace_put(&r, sizeof(r));
+	trace_end_call();
+}
+static PFNGLTEXCOORD3DVPROC trace_real_glTexCoord3dv = NULL;
+static void APIENTRY trace_glTexCoord3dv(const GLdouble *v) {
+	trace_real_glTexCoord3dv(v);
+	trace_begin_call(159);
+	trace_put_data(v, v == NULL ? 0 : (size_t)(3 * sizeof(GLdouble)));
+	trace_end_call();
+}
+static PFNGLTEXCOORD3FPROC trace_real_glTexCoord3f = NULL;
+static void APIENTRY trace_glTexCoord3f(GLfloat s, GLfloat t, GLfloat r) {
+	trace_real_glTexCoord3f(s, t, r);
+	trace_begin_call(160);
+	trace_put(&s, sizeof(s));
+	trace_put(&t, sizeof(t));
+	trace_put(&r, sizeof(r));
+	trace_end_call();
+}
+static PFNGLTEXCOORD3FVPROC trace_real_glTexCoord3fv = NULL;
+static void APIENTRY trace_glTexCoord3fv(const GLfloat *v) {
+	trace_real_glTexCoord3fv(v);
+	trace_begin_call(161);
+	trace_put_data(v, v == NULL ? 0 : (size_t)(3 * sizeof(GLfloat)));
+	trace_end_call();
+}
+static PFNGLTEXCOORD3IPROC trace_real_glTexCoord3i = NULL;
+static void APIENTRY trace_glTexCoord3i(GLint s, GLint t, GLint r) {
+	trace_real_glTexCoord3i(s, t, r);
+	trace_begin_call(162);
+	trace_put(&s, sizeof(s));
+	trace_put(&t, sizeof(t));
+	trace_put(&r, sizeof(r));
+	trace_end_call();
+}
+static PFNGLTEXCOORD3IVPROC trace_real_glTexCoord3iv = NULL;
+static void APIENTRY trace_glTexCoord3iv(const GLint *v) {
+	trace_real_glTexCoord3iv(v);
+	trace_begin_call(163);
+	trace_put_data(v, v == NULL ? 0 : (size_t)(3 * sizeof(GLint)));
+	trace_end_call();
+}
+static PFNGLTEXCOORD3SPROC trace_real_glTexCoord3s = NULL;
+static void APIENTRY trace_glTexCoord3s(GLshort s, GLshort t, GLshort r) {
+	trace_real_glTexCoord3s(s, t, r);
+	trace_begin_call(164);
+	trace_put(&s, sizeof(s));
+	trace_put(&t, sizeof(t));
+	trace_put(&r, sizeof(r));
+	trace_end_call();
+}
+static PFNGLTEXCOORD3SVPROC trace_real_glTexCoord3sv = NULL;
+static void APIENTRY trace_glTexCoord3sv(const GLshort *v) {
+	trace_real_glTexCoord3sv(v);
+	trace_begin_call(165);
+	trace_put_data(v, v == NULL ? 0 : (size_t)(3 * sizeof(GLshort)));
+	trace_end_call();
+}
+static PFNGLTEXCOORD4DPROC trace_real_glTexCoord4d = NULL;
+static void APIENTRY trace_glTexCoord4d(GLdouble s, GLdouble t, GLdouble r, GLdouble q) {
+	trace_real_glTexCoord4d(s, t, r, q);
+	trace_begin_call(166);
+	trace_put(&s, sizeof(s));
+	trace_put(&t, sizeof(t));
+	trace_put(&r, sizeof(r));
+	trace_put(&q, sizeof(q));
+	trace_end_call();
+}
+static PFNGLTEXCOORD4DVPROC trace_real_glTexCoord4dv = NULL;
+static void APIENTRY trace_glTexCoord4dv(const GLdouble *v) {
+	trace_real_glTexCoord4dv(v);
+	trace_begin_call(167);
+	trace_put_data(v, v == NULL ? 0 : (size_t)(4 * sizeof(GLdouble)));
+	trace_end_call();
+}
+static PFNGLTEXCOORD4FPROC trace_real_glTexCoord4f = NULL;
+static void APIENTRY trace_glTexCoord4f(GLfloat s, GLfloat t, GLfloat r, GLfloat q) {
+	trace_real_glTexCoord4f(s, t, r, q);
+	trace_begin_call(168);
+	trace_put(&s, sizeof(s));
+	trace_put(&t, sizeof(t));
+	trace_put(&r, sizeof(r));
+	trace_put(&q, sizeof(q));
+	trace_end_call();
+}
+static PFNGLTEXCOORD4FVPROC trace_real_glTexCoord4fv = NULL;
+static void APIENTRY trace_glTexCoord4fv(const GLfloat *v) {
+	trace_real_glTexCoord4fv(v);
+	trace_begin_call(169);
+	trace_put_data(v, v == NULL ? 0 : (size_t)(4 * sizeof(GLfloat)));
+	trace_end_call();
+}
+static PFNGLTEXCOORD4IPROC trace_real_glTexCoord4i = NULL;
+static void APIENTRY trace_glTexCoord4i(GLint s, GLint t, GLint r, GLint q) {
+	trace_real_glTexCoord4i(s, t, r, q);
+	trace_begin_call(170);
+	trace_put(&s, sizeof(s));
+	trace_put(&t, sizeof(t));
+	trace_put(&r, sizeof(r));
+	trace_put(&q, sizeof(q));
+	trace_end_call();
+}
+static PFNGLTEXCOORD4IVPROC trace_real_glTexCoord4iv = NULL;
+static void APIENTRY trace_glTexCoord4iv(const GLint *v) {
+	trace_real_glTexCoord4iv(v);
+	trace_begin_call(171);
+	trace_put_data(v, v == NULL ? 0 : (size_t)(4 * sizeof(GLint)));
+	trace_end_call();
+}
+static PFNGLTEXCOORD4SPROC trace_real_glTexCoord4s = NULL;
+static void APIENTRY trace_glTexCoord4s(GLshort s, GLshort t, GLshort r, GLshort q) {
+	trace_real_glTexCoord4s(s, t, r, q);
+	trace_begin_call(172);
+	trace_put(&s, sizeof(s));
+	trace_put(&t, sizeof(t));
+	trace_put(&r, sizeof(r));
+	trace_put(&q, sizeof(q));
+	trace_end_call();
+}
+static PFNGLTEXCOORD4SVPROC trace_real_glTexCoord4sv = NULL;
+static void APIENTRY trace_glTexCoord4sv(const GLshort *v) {
+	trace_real_glTexCoord4sv(v);
+	trace_begin_call(173);
+	trace_put_data(v, v == NULL ? 0 : (size_t)(4 * sizeof(GLshort)));
+	trace_end_call();
+}
+static PFNGLVERTEX2DPROC trace_real_glVertex2d = NULL;
+static void APIENTRY trace_glVertex2d(GLdouble x, GLdouble y) {
+	trace_real_glVertex2d(x, y);
+	trace_begin_call(174);
+	trace_put(&x, sizeof(x));
+	trace_put(&y, sizeof(y));
+	trace_end_call();
+}
+static PFNGLVERTEX2DVPROC trace_real_glVertex2dv = NULL;
+static void APIENTRY trace_glVertex2dv(const GLdouble *v) {
+	trace_real_glVertex2dv(v);
+	trace_begin_call(175);
+	trace_put_data(v, v == NULL ? 0 : (size_t)(2 * sizeof(GLdouble)));
+	trace_end_call();
+}
+static PFNGLVERTEX2FPROC trace_real_glVertex2f = NULL;
+static void APIENTRY trace_glVertex2f(GLfloat x, GLfloat y) {
+	trace_real_glVertex2f(x, y);
+	trace_begin_call(176);
+	trace_put(&x, sizeof(x));
+	trace_put(&y, sizeof(y));
+	trace_end_call();
+}
+static PFNGLVERTEX2FVPROC trace_real_glVertex2fv = NULL;
+static void APIENTRY trace_glVertex2fv(const GLfloat *v) {
+	trace_real_glVertex2fv(v);
+	trace_begin_call(177);
+	trace_put_data(v, v == NULL ? 0 : (size_t)(2 * sizeof(GLfloat)));
+	trace_end_call();
+}
+static PFNGLVERTEX2IPROC trace_real_glVertex2i = NULL;
+static void APIENTRY trace_glVertex2i(GLint x, GLint y) {
+	trace_real_glVertex2i(x, y);
+	trace_begin_call(178);
+	trace_put(&x, sizeof(x));
+	trace_put(&y, sizeof(y));
+	trace_end_call();
+}
+static PFNGLVERTEX2IVPROC trace_real_glVertex2iv = NULL;
+static void APIENTRY trace_glVertex2iv(const GLint *v) {
+	trace_real_glVertex2iv(v);
+	trace_begin_call(179);
+	trace_put_data(v, v == NULL ? 0 : (size_t)(2 * sizeof(GLint)));
+	trace_end_call();
+}
+static PFNGLVERTEX2SPROC trace_real_glVertex2s = NULL;
+static void APIENTRY trace_glVertex2s(GLshort x, GLshort y) {
+	trace_real_glVertex2s(x, y);
+	trace_begin_call(180);
+	trace_put(&x, sizeof(x));
+	trace_put(&y, sizeof(y));
+	trace_end_call();
+}
+static PFNGLVERTEX2SVPROC trace_real_glVertex2sv = NULL;
+static void APIENTRY trace_glVertex2sv(const GLshort *v) {
+	trace_real_glVertex2sv(v);
+	trace_begin_call(181);
+	trace_put_data(v, v == NULL ? 0 : (size_t)(2 * sizeof(GLshort)));
+	trace_end_call();
+}
+static PFNGLVERTEX3DPROC trace_real_glVertex3d = NULL;
+static void APIENTRY trace_glVertex3d(GLdouble x, GLdouble y, GLdouble z) {
+	trace_real_glVertex3d(x, y, z);
+	trace_begin_call(182);
+	trace_put(&x, sizeof(x));
+	trace_put(&y, sizeof(y));
+	trace_put(&z, sizeof(z));
+	trace_end_call();
+}
+static PFNGLVERTEX3DVPROC trace_real_glVertex3dv = NULL;
+static void APIENTRY trace_glVertex3dv(const GLdouble *v) {
+	trace_real_glVertex3dv(v);
+	trace_begin_call(183);
+	trace_put_data(v, v == NULL ? 0 : (size_t)(3 * sizeof(GLdouble)));
+	trace_end_call();
+}
+static PFNGLVERTEX3FPROC trace_real_glVertex3f = NULL;
+static void APIENTRY trace_glVertex3f(GLfloat x, GLfloat y, GLfloat z) {
+	trace_real_glVertex3f(x, y, z);
+	trace_begin_call(184);
+	trace_put(&x, sizeof(x));
+	trace_put(&y, sizeof(y));
+	trace_put(&z, sizeof(z));
+	trace_end_call();
+}
+static PFNGLVERTEX3FVPROC trace_real_glVertex3fv = NULL;
+static void APIENTRY trace_glVertex3fv(const GLfloat *v) {
+	trace_real_glVertex3fv(v);
+	trace_begin_call(185);
+	trace_put_data(v, v == NULL ? 0 : (size_t)(3 * sizeof(GLfloat)));
+	trace_end_call();
+}
+static PFNGLVERTEX3IPROC trace_real_glVertex3i = NULL;
+static void APIENTRY trace_glVertex3i(GLint x, GLint y, GLint z) {
+	trace_real_glVertex3i(x, y, z);
+	trace_begin_call(186);
+	trace_put(&x, sizeof(x));
+	trace_put(&y, sizeof(y));
+	trace_put(&z, sizeof(z));
+	trace_end_call();
+}
+static PFNGLVERTEX3IVPROC trace_real_glVertex3iv = NULL;
+static void APIENTRY trace_glVertex3iv(const GLint *v) {
+	trace_real_glVertex3iv(v);
+	trace_begin_call(187);
+	trace_put_data(v, v == NULL ? 0 : (size_t)(3 * sizeof(GLint)));
+	trace_end_call();
+}
+static PFNGLVERTEX3SPROC trace_real_glVertex3s = NULL;
+static void APIENTRY trace_glVertex3s(GLshort x, GLshort y, GLshort z) {
+	trace_real_glVertex3s(x, y, z);
+	trace_begin_call(188);
+	trace_put(&x, sizeof(x));
+	trace_put(&y, sizeof(y));
+	trace_put(&z, sizeof(z));
+	trace_end_call();
+}
+static PFNGLVERTEX3SVPROC trace_real_glVertex3sv = NULL;
+static void APIENTRY trace_glVertex3sv(const GLshort *v) {
+	trace_real_glVertex3sv(v);
+	trace_begin_call(189);
+	trace_put_data(v, v == NULL ? 0 : (size_t)(3 * sizeof(GLshort)));
+	trace_end_call();
+}
+static PFNGLVERTEX4DPROC trace_real_glVertex4d = NULL;
+static void APIENTRY trace_glVertex4d(GLdouble x, GLdouble y, GLdouble z, GLdouble w) {
+	trace_real_glVertex4d(x, y, z, w);
+	trace_begin_call(190);
+	trace_put(&x, sizeof(x));
+	trace_put(&y, sizeof(y));
+	trace_put(&z, sizeof(z));
+	trace_put(&w, sizeof(w));
+	trace_end_call();
+}
+static PFNGLVERTEX4DVPROC trace_real_glVertex4dv = NULL;
+static void APIENTRY trace_glVertex4dv(const GLdouble *v) {
+	trace_real_glVertex4dv(v);
+	trace_begin_call(191);
+	trace_put_data(v, v == NULL ? 0 : (size_t)(4 * sizeof(GLdouble)));
+	trace_end_call();
+}
+static PFNGLVERTEX4FPROC trace_real_glVertex4f = NULL;
+static void APIENTRY trace_glVertex4f(GLfloat x, GLfloat y, GLfloat z, GLfloat w) {
+	trace_real_glVertex4f(x, y, z, w);
+	trace_begin_call(192);
+	trace_put(&x, sizeof(x));
+	trace_put(&y, sizeof(y));
+	trace_put(&z, sizeof(z));
+	trace_put(&w, sizeof(w));
+	trace_end_call();
+}
+static PFNGLVERTEX4FVPROC trace_real_glVertex4fv = NULL;
+static void APIENTRY trace_glVertex4fv(const GLfloat *v) {
+	trace_real_glVertex4fv(v);
+	trace_begin_call(193);
+	trace_put_data(v, v == NULL ? 0 : (size_t)(4 * sizeof(GLfloat)));
+	trace_end_call();
+}
+static PFNGLVERTEX4IPROC trace_real_glVertex4i = NULL;
+static void APIENTRY trace_glVertex4i(GLint x, GLint y, GLint z, GLint w) {
+	trace_real_glVertex4i(x, y, z, w);
+	trace_begin_call(194);
+	trace_put(&x, sizeof(x));
+	trace_put(&y, sizeof(y));
+	trace_put(&z, sizeof(z));
+	trace_put(&w, sizeof(w));
+	trace_end_call();
+}
+static PFNGLVERTEX4IVPROC trace_real_glVertex4iv = NULL;
+static void APIENTRY trace_glVertex4iv(const GLint *v) {
+	trace_real_glVertex4iv(v);
+	trace_begin_call(195);
+	trace_put_data(v, v == NULL ? 0 : (size_t)(4 * sizeof(GLint)));
+	trace_end_call();
+}
+static PFNGLVERTEX4SPROC trace_real_glVertex4s = NULL;
+static void APIENTRY trace_glVertex4s(GLshort x, GLshort y, GLshort z, GLshort w) {
+	trace_real_glVertex4s(x, y, z, w);
+	trace_begin_call(196);
+	trace_put(&x, sizeof(x));
+	trace_put(&y, sizeof(y));
+	trace_put(&z, sizeof(z));
+	trace_put(&w, sizeof(w));
+	trace_end_call();
+}
+static PFNGLVERTEX4SVPROC trace_real_glVertex4sv = NULL;
+static void APIENTRY trace_glVertex4sv(const GLshort *v) {
+	trace_real_glVertex4sv(v);
+	trace_begin_call(197);
+	trace_put_data(v, v == NULL ? 0 : (size_t)(4 * sizeof(GLshort)));
+	trace_end_call();
+}
+static PFNGLCLIPPLANEPROC trace_real_glClipPlane = NULL;
+static void APIENTRY trace_glClipPlane(GLenum plane, const GLdouble *equation) {
+	trace_real_glClipPlane(plane, equation);
+	trace_begin_call(198);
+	trace_put(&plane, sizeof(plane));
+	trace_put_unsupported(equation != NULL);
+	trace_end_call();
+}
+static PFNGLCOLORMATERIALPROC trace_real_glColorMaterial = NULL;
+static void APIENTRY trace_glColorMaterial(GLenum face, GLenum mode) {
+	trace_real_glColorMaterial(face, mode);
+	trace_begin_call(199);
+	trace_put(&face, sizeof(face));
+	trace_put(&mode, sizeof(mode));
+	trace_end_call();
+}
+static PFNGLFOGFPROC trace_real_glFogf = NULL;
+static void APIENTRY trace_glFogf(GLenum pname, GLfloat param) {
+	trace_real_glFogf(pname, param);
+	trace_begin_call(200);
+	trace_put(&pname, sizeof(pname));
+	trace_put(&param, sizeof(param));
+	trace_end_call();
+}
+static PFNGLFOGFVPROC trace_real_glFogfv = NULL;
+static void APIENTRY trace_glFogfv(GLenum pname, const GLfloat *params) {
+	trace_real_glFogfv(pname, params);
+	trace_begin_call(201);
+	trace_put(&pname, sizeof(pname));
+	trace_put_unsupported(params != NULL);
+	trace_end_call();
+}
+static PFNGLFOGIPROC trace_real_glFogi = NULL;
+static void APIENTRY trace_glFogi(GLenum pname, GLint param) {
+	trace_real_glFogi(pname, param);
+	trace_begin_call(202);
+	trace_put(&pname, sizeof(pname));
+	trace_put(&param, sizeof(param));
+	trace_end_call();
+}
+static PFNGLFOGIVPROC trace_real_glFogiv = NULL;
+static void APIENTRY trace_glFogiv(GLenum pname, const GLint *params) {
+	trace_real_glFogiv(pname, params);
+	trace_begin_call(203);
+	trace_put(&pname, sizeof(pname));
+	trace_put_unsupported(params != NULL);
+	trace_end_call();
+}
+static PFNGLLIGHTFPROC trace_real_glLightf = NULL;
+static void APIENTRY trace_glLightf(GLenum light, GLenum pname, GLfloat param) {
+	trace_real_glLightf(light, pname, param);
+	trace_begin_call(204);
+	trace_put(&light, sizeof(light));
+	trace_put(&pname, sizeof(pname));
+	trace_put(&param, sizeof(param));
+	trace_end_call();
+}
+static PFNGLLIGHTFVPROC trace_real_glLightfv = NULL;
+static void APIENTRY trace_glLightfv(GLenum light, GLenum pname, const GLfloat *params) {
+	trace_real_glLightfv(light, pname, params);
+	trace_begin_call(205);
+	trace_put(&light, sizeof(light));
+	trace_put(&pname, sizeof(pname));
+	trace_put_unsupported(params != NULL);
+	trace_end_call();
+}
+static PFNGLLIGHTIPROC trace_real_glLighti = NULL;
+static void APIENTRY trace_glLighti(GLenum light, GLenum pname, GLint param) {
+	trace_real_glLighti(light, pname, param);
+	trace_begin_call(206);
+	trace_put(&light, sizeof(light));
+	trace_put(&pname, sizeof(pname));
+	trace_put(&param, sizeof(param));
+	trace_end_call();
+}
+static PFNGLLIGHTIVPROC trace_real_glLightiv = NULL;
+static void APIENTRY trace_glLightiv(GLenum light, GLenum pname, const GLint *params) {
+	trace_real_glLightiv(light, pname, params);
+	trace_begin_call(207);
+	trace_put(&light, sizeof(light));
+	trace_put(&pname, sizeof(pname));
+	trace_put_unsupported(params != NULL);
+	trace_end_call();
+}
+static PFNGLLIGHTMODELFPROC trace_real_glLightModelf = NULL;
+static void APIENTRY trace_glLightModelf(GLenum pname, GLfloat param) {
+	trace_real_glLightModelf(pname, param);
+	trace_begin_call(208);
+	trace_put(&pname, sizeof(pname));
+	trace_put(&param, sizeof(param));
+	trace_end_call();
+}
+static PFNGLLIGHTMODELFVPROC trace_real_glLightModelfv = NULL;
+static void APIENTRY trace_glLightModelfv(GLenum pname, const GLfloat *params) {
+	trace_real_glLightModelfv(pname, params);
+	trace_begin_call(209);
+	trace_put(&pname, sizeof(pname));
+	trace_put_unsupported(params != NULL);
+	trace_end_call();
+}
+static PFNGLLIGHTMODELIPROC trace_real_glLightModeli = NULL;
+static void APIENTRY trace_glLightModeli(GLenum pname, GLint param) {
+	trace_real_glLightModeli(pname, param);
+	trace_begin_call(210);
+	trace_put(&pname, sizeof(pname));
+	trace_put(&param, sizeof(param));
+	trace_end_call();
+}
+static PFNGLLIGHTMODELIVPROC trace_real_glLightModeliv = NULL;
+static void APIENTRY trace_glLightModeliv(GLenum pname, const GLint *params) {
+	trace_real_glLightModeliv(pname, params);
+	trace_begin_call(211);
+	trace_put(&pname, sizeof(pname));
+	trace_put_unsupported(params != NULL);
+	trace_end_call();
+}
+static PFNGLLINESTIPPLEPROC trace_real_glLineStipple = NULL;
+static void APIENTRY trace_glLineStipple(GLint factor, GLushort pattern) {
+	trace_real_glLineStipple(factor, pattern);
+	trace_begin_call(212);
+	trace_put(&factor, sizeof(factor));
+	trace_put(&pattern, sizeof(pattern));
+	trace_end_call();
+}
+static PFNGLMATERIALFPROC trace_real_glMaterialf = NULL;
+static void APIENTRY trace_glMaterialf(GLenum face, GLenum pname, GLfloat param) {
+	trace_real_glMaterialf(face, pname, param);
+	trace_begin_call(213);
+	trace_put(&face, sizeof(face));
+	trace_put(&pname, sizeof(pname));
+	trace_put(&param, sizeof(param));
+	trace_end_call();
+}
+static PFNGLMATERIALFVPROC trace_real_glMaterialfv = NULL;
+static void APIENTRY trace_glMaterialfv(GLenum face, GLenum pname, const GLfloat *params) {
+	trace_real_glMaterialfv(face, pname, params);
+	trace_begin_call(214);
+	trace_put(&face, sizeof(face));
+	trace_put(&pname, sizeof(pname));
+	trace_put_unsupported(params != NULL);
+	trace_end_call();
+}
+static PFNGLMATERIALIPROC trace_real_glMateriali = NULL;
+static void APIENTRY trace_glMateriali(GLenum face, GLenum pname, GLint param) {
+	trace_real_glMateriali(face, pname, param);
+	trace_begin_call(215);
+	trace_put(&face, sizeof(face));
+	trace_put(&pname, sizeof(pname));
+	trace_put(&param, sizeof(param));
+	trace_end_call();
+}
+static PFNGLMATERIALIVPROC trace_real_glMaterialiv = NULL;
+static void APIENTRY trace_glMaterialiv(GLenum face, GLenum pname, const GLint *params) {
+	trace_real_glMaterialiv(face, pname, params);
+	trace_begin_call(216);
+	trace_put(&face, sizeof(face));
+	trace_put(&pname, sizeof(pname));
+	trace_put_unsupported(params != NULL);
+	trace_end_call();
+}
+static PFNGLPOLYGONSTIPPLEPROC trace_real_glPolygonStipple = NULL;
+static void APIENTRY trace_glPolygonStipple(const GLubyte *mask) {
+	trace_real_glPolygonStipple(mask);
+	trace_begin_call(217);
+	trace_put_unsupported(mask != NULL);
+	trace_end_call();
+}
+static PFNGLSHADEMODELPROC trace_real_glShadeModel = NULL;
+static void APIENTRY trace_glShadeModel(GLenum mode) {
+	trace_real_glShadeModel(mode);
+	trace_begin_call(218);
+	trace_put(&mode, sizeof(mode));
+	trace_end_call();
+}
+static PFNGLTEXENVFPROC trace_real_glTexEnvf = NULL;
+static void APIENTRY trace_glTexEnvf(GLenum target, GLenum pname, GLfloat param) {
+	trace_real_glTexEnvf(target, pname, param);
+	trace_begin_call(219);
+	trace_put(&target, sizeof(target));
+	trace_put(&pname, sizeof(pname));
+	trace_put(&param, sizeof(param));
+	trace_end_call();
+}
+static PFNGLTEXENVFVPROC trace_real_glTexEnvfv = NULL;
+static void APIENTRY trace_glTexEnvfv(GLenum target, GLenum pname, const GLfloat *params) {
+	trace_real_glTexEnvfv(target, pname, params);
+	trace_begin_call(220);
+	trace_put(&target, sizeof(target));
+	trace_put(&pname, sizeof(pname));
+	trace_put_unsupported(params != NULL);
+	trace_end_call();
+}
+static PFNGLTEXENVIPROC trace_real_glTexEnvi = NULL;
+static void APIENTRY trace_glTexEnvi(GLenum target, GLenum pname, GLint param) {
+	trace_real_glTexEnvi(target, pname, param);
+	trace_begin_call(221);
+	trace_put(&target, sizeof(target));
+	trace_put(&pname, sizeof(pname));
+	trace_put(&param, sizeof(param));
+	trace_end_call();
+}
+static PFNGLTEXENVIVPROC trace_real_glTexEnviv = NULL;
+static void APIENTRY trace_glTexEnviv(GLenum target, GLenum pname, const GLint *params) {
+	trace_real_glTexEnviv(target, pname, params);
+	trace_begin_call(222);
+	trace_put(&target, sizeof(target));
+	trace_put(&pname, sizeof(pname));
+	trace_put_unsupported(params != NULL);
+	trace_end_call();
+}
+static PFNGLTEXGENDPROC trace_real_glTexGend = NULL;
+static void APIENTRY trace_glTexGend(GLenum coord, GLenum pname, GLdouble param) {
+	trace_real_glTexGend(coord, pname, param);
+	trace_begin_call(223);
+	trace_put(&coord, sizeof(coord));
+	trace_put(&pname, sizeof(pname));
+	trace_put(&param, sizeof(param));
+	trace_end_call();
+}
+static PFNGLTEXGENDVPROC trace_real_glTexGendv = NULL;
+static void APIENTRY trace_glTexGendv(GLenum coord, GLenum pname, const GLdouble *params) {
+	trace_real_glTexGendv(coord, pname, params);
+	trace_begin_call(224);
+	trace_put(&coord, sizeof(coord));
+	trace_put(&pname, sizeof(pname));
+	trace_put_unsupported(params != NULL);
+	trace_end_call();
+}
+static PFNGLTEXGENFPROC trace_real_glTexGenf = NULL;
+static void APIENTRY trace_glTexGenf(GLenum coord, GLenum pname, GLfloat param) {
+	trace_real_glTexGenf(coord, pname, param);
+	trace_begin_call(225);
+	trace_put(&coord, sizeof(coord));
+	trace_put(&pname, sizeof(pname));
+	trace_put(&param, sizeof(param));
+	trace_end_call();
+}
+static PFNGLTEXGENFVPROC trace_real_glTexGenfv = NULL;
+static void APIENTRY trace_glTexGenfv(GLenum coord, GLenum pname, const GLfloat *params) {
+	trace_real_glTexGenfv(coord, pname, params);
+	trace_begin_call(226);
+	trace_put(&coord, sizeof(coord));
+	trace_put(&pname, sizeof(pname));
+	trace_put_unsupported(params != NULL);
+	trace_end_call();
+}
+static PFNGLTEXGENIPROC trace_real_glTexGeni = NULL;
+static void APIENTRY trace_glTexGeni(GLenum coord, GLenum pname, GLint param) {
+	trace_real_glTexGeni(coord, pname, param);
+	trace_begin_call(227);
+	trace_put(&coord, sizeof(coord));
+	trace_put(&pname, sizeof(pname));
+	trace_put(&param, sizeof(param));
+	trace_end_call();
+}
+static PFNGLTEXGENIVPROC trace_real_glTexGeniv = NULL;
+static void APIENTRY trace_glTexGeniv(GLenum coord, GLenum pname, const GLint *params) {
+	trace_real_glTexGeniv(coord, pname, params);
+	trace_begin_call(228);
+	trace_put(&coord, sizeof(coord));
+	trace_put(&pname, sizeof(pname));
+	trace_put_unsupported(params != NULL);
+	trace_end_call();
+}
+static PFNGLFEEDBACKBUFFERPROC trace_real_glFeedbackBuffer = NULL;
+static void APIENTRY trace_glFeedbackBuffer(GLsizei size, GLenum type, GLfloat *buffer) {
+	trace_real_glFeedbackBuffer(size, type, buffer);
+	trace_begin_call(229);
+	trace_put(&size, sizeof(size));
+	trace_put(&type, sizeof(type));
+	trace_end_call();
+}
+static PFNGLSELECTBUFFERPROC trace_real_glSelectBuffer = NULL;
+static void APIENTRY trace_glSelectBuffer(GLsizei size, GLuint *buffer) {
+	trace_real_glSelectBuffer(size, buffer);
+	trace_begin_call(230);
+	trace_put(&size, sizeof(size));
+	trace_end_call();
+}
+static PFNGLRENDERMODEPROC trace_real_glRenderMode = NULL;
+static GLint APIENTRY trace_glRenderMode(GLenum mode) {
+	GLint glad_result;
+	glad_result = trace_real_glRenderMode(mode);
+	trace_begin_call(231);
+	trace_put(&mode, sizeof(mode));
+	trace_put(&glad_result, sizeof(glad_result));
+	trace_end_call();
+	return glad_result;
+}
+static PFNGLINITNAMESPROC trace_real_glInitNames = NULL;
+static void APIENTRY trace_glInitNames(void) {
+	trace_real_glInitNames();
+	trace_begin_call(232);
+	trace_end_call();
+}
+static PFNGLLOADNAMEPROC trace_real_glLoadName = NULL;
+static void APIENTRY trace_glLoadName(GLuint name) {
+	trace_real_glLoadName(name);
+	trace_begin_call(233);
+	trace_put(&name, sizeof(name));
+	trace_end_call();
+}
+static PFNGLPASSTHROUGHPROC trace_real_glPassThrough = NULL;
+static void APIENTRY trace_glPassThrough(GLfloat token) {
+	trace_real_glPassThrough(token);
+	trace_begin_call(234);
+	trace_put(&token, sizeof(token));
+	trace_end_call();
+}
+static PFNGLPOPNAMEPROC trace_real_glPopName = NULL;
+static void APIENTRY trace_glPopName(void) {
+	trace_real_glPopName();
+	trace_begin_call(235);
+	trace_end_call();
+}
+static PFNGLPUSHNAMEPROC trace_real_glPushName = NULL;
+static void APIENTRY trace_glPushName(GLuint name) {
+	trace_real_glPushName(name);
+	trace_begin_call(236);
+	trace_put(&name, sizeof(name));
+	trace_end_call();
+}
+static PFNGLCLEARACCUMPROC trace_real_glClearAccum = NULL;
+static void APIENTRY trace_glClearAccum(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) {
+	trace_real_glClearAccum(red, green, blue, alpha);
+	trace_begin_call(237);
+	trace_put(&red, sizeof(red));
+	trace_put(&green, sizeof(green));
+	trace_put(&blue, sizeof(blue));
+	trace_put(&alpha, sizeof(alpha));
+	trace_end_call();
+}
+static PFNGLCLEARINDEXPROC trace_real_glClearIndex = NULL;
+static void APIENTRY trace_glClearIndex(GLfloat c) {
+	trace_real_glClearIndex(c);
+	trace_begin_call(238);
+	trace_put(&c, sizeof(c));
+	trace_end_call();
+}
+static PFNGLINDEXMASKPROC trace_real_glIndexMask = NULL;
+static void APIENTRY trace_glIndexMask(GLuint mask) {
+	trace_real_glIndexMask(mask);
+	trace_begin_call(239);
+	trace_put(&mask, sizeof(mask));
+	trace_end_call();
+}
+static PFNGLACCUMPROC trace_real_glAccum = NULL;
+static void APIENTRY trace_glAccum(GLenum op, GLfloat value) {
+	trace_real_glAccum(op, value);
+	trace_begin_call(240);
+	trace_put(&op, sizeof(op));
+	trace_put(&value, sizeof(value));
+	trace_end_call();
+}
+static PFNGLPOPATTRIBPROC trace_real_glPopAttrib = NULL;
+static void APIENTRY trace_glPopAttrib(void) {
+	trace_real_glPopAttrib();
+	trace_begin_call(241);
+	trace_end_call();
+}
+static PFNGLPUSHATTRIBPROC trace_real_glPushAttrib = NULL;
+static void APIENTRY trace_glPushAttrib(GLbitfield mask) {
+	trace_real_glPushAttrib(mask);
+	trace_begin_call(242);
+	trace_put(&mask, sizeof(mask));
+	trace_end_call();
+}
+static PFNGLMAP1DPROC trace_real_glMap1d = NULL;
+static void APIENTRY trace_glMap1d(GLenum target, GLdouble u1, GLdouble u2, GLint stride, GLint order, const GLdouble *points) {
+	trace_real_glMap1d(target, u1, u2, stride, order, points);
+	trace_begin_call(243);
+	trace_put(&target, sizeof(target));
+	trace_put(&u1, sizeof(u1));
+	trace_put(&u2, sizeof(u2));
+	trace_put(&stride, sizeof(stride));
+	trace_put(&order, sizeof(order));
+	trace_put_unsupported(points != NULL);
+	trace_end_call();
+}
+static PFNGLMAP1FPROC trace_real_glMap1f = NULL;
+static void APIENTRY trace_glMap1f(GLenum target, GLfloat u1, GLfloat u2, GLint stride, GLint order, const GLfloat *points) {
+	trace_real_glMap1f(target, u1, u2, stride, order, points);
+	trace_begin_call(244);
+	trace_put(&target, sizeof(target));
+	trace_put(&u1, sizeof(u1));
+	trace_put(&u2, sizeof(u2));
+	trace_put(&stride, sizeof(stride));
+	trace_put(&order, sizeof(order));
+	trace_put_unsupported(points != NULL);
+	trace_end_call();
+}
+static PFNGLMAP2DPROC trace_real_glMap2d = NULL;
+static void APIENTRY trace_glMap2d(GLenum target, GLdouble u1, GLdouble u2, GLint ustride, GLint uorder, GLdouble v1, GLdouble v2, GLint vstride, GLint vorder, const GLdouble *points) {
+	trace_real_glMap2d(target, u1, u2, ustride, uorder, v1, v2, vstride, vorder, points);
+	trace_begin_call(245);
+	trace_put(&target, sizeof(target));
+	trace_put(&u1, sizeof(u1));
+	trace_put(&u2, sizeof(u2));
+	trace_put(&ustride, sizeof(ustride));
+	trace_put(&uorder, sizeof(uorder));
+	trace_put(&v1, sizeof(v1));
+	trace_put(&v2, sizeof(v2));
+	trace_put(&vstride, sizeof(vstride));
+	trace_put(&vorder, sizeof(vorder));
+	trace_put_unsupported(points != NULL);
+	trace_end_call();
+}
+static PFNGLMAP2FPROC trace_real_glMap2f = NULL;
+static void APIENTRY trace_glMap2f(GLenum target, GLfloat u1, GLfloat u2, GLint ustride, GLint uorder, GLfloat v1, GLfloat v2, GLint vstride, GLint vorder, const GLfloat *points) {
+	trace_real_glMap2f(target, u1, u2, ustride, uorder, v1, v2, vstride, vorder, points);
+	trace_begin_call(246);
+	trace_put(&target, sizeof(target));
+	trace_put(&u1, sizeof(u1));
+	trace_put(&u2, sizeof(u2));
+	trace_put(&ustride, sizeof(ustride));
+	trace_put(&uorder, sizeof(uorder));
+	trace_put(&v1, sizeof(v1));
+	trace_put(&v2, sizeof(v2));
+	trace_put(&vstride, sizeof(vstride));
+	trace_put(&vorder, sizeof(vorder));
+	trace_put_unsupported(points != NULL);
+	trace_end_call();
+}
+static PFNGLMAPGRID1DPROC trace_real_glMapGrid1d = NULL;
+static void APIENTRY trace_glMapGrid1d(GLint un, GLdouble u1, GLdouble u2) {
+	trace_real_glMapGrid1d(un, u1, u2);
+	trace_begin_call(247);
+	trace_put(&un, sizeof(un));
+	trace_put(&u1, sizeof(u1));
+	trace_put(&u2, sizeof(u2));
+	trace_end_call();
+}
+static PFNGLMAPGRID1FPROC trace_real_glMapGrid1f = NULL;
+static void APIENTRY trace_glMapGrid1f(GLint un, GLfloat u1, GLfloat u2) {
+	trace_real_glMapGrid1f(un, u1, u2);
+	trace_begin_call(248);
+	trace_put(&un, sizeof(un));
+	trace_put(&u1, sizeof(u1));
+	trace_put(&u2, sizeof(u2));
+	trace_end_call();
+}
+static PFNGLMAPGRID2DPROC trace_real_glMapGrid2d = NULL;
+static void APIENTRY trace_glMapGrid2d(GLint un, GLdouble u1, GLdouble u2, GLint vn, GLdouble v1, GLdouble v2) {
+	trace_real_glMapGrid2d(un, u1, u2, vn, v1, v2);
+	trace_begin_call(249);
+	trace_put(&un, sizeof(un));
+	trace_put(&u1, sizeof(u1));
+	trace_put(&u2, sizeof(u2));
+	trace_put(&vn, sizeof(vn));
+	trace_put(&v1, sizeof(v1));
+	trace_put(&v2, sizeof(v2));
+	trace_end_call();
+}
+static PFNGLMAPGRID2FPROC trace_real_glMapGrid2f = NULL;
+static void APIENTRY trace_glMapGrid2f(GLint un, GLfloat u1, GLfloat u2, GLint vn, GLfloat v1, GLfloat v2) {
+	trace_real_glMapGrid2f(un, u1, u2, vn, v1, v2);
+	trace_begin_call(250);
+	trace_put(&un, sizeof(un));
+	trace_put(&u1, sizeof(u1));
+	trace_put(&u2, sizeof(u2));
+	trace_put(&vn, sizeof(vn));
+	trace_put(&v1, sizeof(v1));
+	trace_put(&v2, sizeof(v2));
+	trace_end_call();
+}
+static PFNGLEVALCOORD1DPROC trace_real_glEvalCoord1d = NULL;
+static void APIENTRY trace_glEvalCoord1d(GLdouble u) {
+	trace_real_glEvalCoord1d(u);
+	trace_begin_call(251);
+	trace_put(&u, sizeof(u));
+	trace_end_call();
+}
+static PFNGLEVALCOORD1DVPROC trace_real_glEvalCoord1dv = NULL;
+static void APIENTRY trace_glEvalCoord1dv(const GLdouble *u) {
+	trace_real_glEvalCoord1dv(u);
+	trace_begin_call(252);
+	trace_put_data(u, u == NULL ? 0 : (size_t)(1 * sizeof(GLdouble)));
+	trace_end_call();
+}
+static PFNGLEVALCOORD1FPROC trace_real_glEvalCoord1f = NULL;
+static void APIENTRY trace_glEvalCoord1f(GLfloat u) {
+	trace_real_glEvalCoord1f(u);
+	trace_begin_call(253);
+	trace_put(&u, sizeof(u));
+	trace_end_call();
+}
+static PFNGLEVALCOORD1FVPROC trace_real_glEvalCoord1fv = NULL;
+static void APIENTRY trace_glEvalCoord1fv(const GLfloat *u) {
+	trace_real_glEvalCoord1fv(u);
+	trace_begin_call(254);
+	trace_put_data(u, u == NULL ? 0 : (size_t)(1 * sizeof(GLfloat)));
+	trace_end_call();
+}
+static PFNGLEVALCOORD2DPROC trace_real_glEvalCoord2d = NULL;
+static void APIENTRY trace_glEvalCoord2d(GLdouble u, GLdouble v) {
+	trace_real_glEvalCoord2d(u, v);
+	trace_begin_call(255);
+	trace_put(&u, sizeof(u));
+	trace_put(&v, sizeof(v));
+	trace_end_call();
+}
+static PFNGLEVALCOORD2DVPROC trace_real_glEvalCoord2dv = NULL;
+static void APIENTRY trace_glEvalCoord2dv(const GLdouble *u) {
+	trace_real_glEvalCoord2dv(u);
+	trace_begin_call(256);
+	trace_put_data(u, u == NULL ? 0 : (size_t)(2 * sizeof(GLdouble)));
+	trace_end_call();
+}
+static PFNGLEVALCOORD2FPROC trace_real_glEvalCoord2f = NULL;
+static void APIENTRY trace_glEvalCoord2f(GLfloat u, GLfloat v) {
+	trace_real_glEvalCoord2f(u, v);
+	trace_begin_call(257);
+	trace_put(&u, sizeof(u));
+	trace_put(&v, sizeof(v));
+	trace_end_call();
+}
+static PFNGLEVALCOORD2FVPROC trace_real_glEvalCoord2fv = NULL;
+static void APIENTRY trace_glEvalCoord2fv(const GLfloat *u) {
+	trace_real_glEvalCoord2fv(u);
+	trace_begin_call(258);
+	trace_put_data(u, u == NULL ? 0 : (size_t)(2 * sizeof(GLfloat)));
+	trace_end_call();
+}
+static PFNGLEVALMESH1PROC trace_real_glEvalMesh1 = NULL;
+static void APIENTRY trace_glEvalMesh1(GLenum mode, GLint i1, GLint i2) {
+	trace_real_glEvalMesh1(mode, i1, i2);
+	trace_begin_call(259);
+	trace_put(&mode, sizeof(mode));
+	trace_put(&i1, sizeof(i1));
+	trace_put(&i2, sizeof(i2));
+	trace_end_call();
+}
+static PFNGLEVALPOINT1PROC trace_real_glEvalPoint1 = NULL;
+static void APIENTRY trace_glEvalPoint1(GLint i) {
+	trace_real_glEvalPoint1(i);
+	trace_begin_call(260);
+	trace_put(&i, sizeof(i));
+	trace_end_call();
+}
+static PFNGLEVALMESH2PROC trace_real_glEvalMesh2 = NULL;
+static void APIENTRY trace_glEvalMesh2(GLenum mode, GLint i1, GLint i2, GLint j1, GLint j2) {
+	trace_real_glEvalMesh2(mode, i1, i2, j1, j2);
+	trace_begin_call(261);
+	trace_put(&mode, sizeof(mode));
+	trace_put(&i1, sizeof(i1));
+	trace_put(&i2, sizeof(i2));
+	trace_put(&j1, sizeof(j1));
+	trace_put(&j2, sizeof(j2));
+	trace_end_call();
+}
+static PFNGLEVALPOINT2PROC trace_real_glEvalPoint2 = NULL;
+static void APIENTRY trace_glEvalPoint2(GLint i, GLint j) {
+	trace_real_glEvalPoint2(i, j);
+	trace_begin_call(262);
+	trace_put(&i, sizeof(i));
+	trace_put(&j, sizeof(j));
+	trace_end_call();
+}
+static PFNGLALPHAFUNCPROC trace_real_glAlphaFunc = NULL;
+static void APIENTRY trace_glAlphaFunc(GLenum func, GLfloat ref) {
+	trace_real_glAlphaFunc(func, ref);
+	trace_begin_call(263);
+	trace_put(&func, sizeof(func));
+	trace_put(&ref, sizeof(ref));
+	trace_end_call();
+}
+static PFNGLPIXELZOOMPROC trace_real_glPixelZoom = NULL;
+static void APIENTRY trace_glPixelZoom(GLfloat xfactor, GLfloat yfactor) {
+	trace_real_glPixelZoom(xfactor, yfactor);
+	trace_begin_call(264);
+	trace_put(&xfactor, sizeof(xfactor));
+	trace_put(&yfactor, sizeof(yfactor));
+	trace_end_call();
+}
+static PFNGLPIXELTRANSFERFPROC trace_real_glPixelTransferf = NULL;
+static void APIENTRY trace_glPixelTransferf(GLenum pname, GLfloat param) {
+	trace_real_glPixelTransferf(pname, param);
+	trace_begin_call(265);
+	trace_put(&pname, sizeof(pname));
+	trace_put(&param, sizeof(param));
+	trace_end_call();
+}
+static PFNGLPIXELTRANSFERIPROC trace_real_glPixelTransferi = NULL;
+static void APIENTRY trace_glPixelTransferi(GLenum pname, GLint param) {
+	trace_real_glPixelTransferi(pname, param);
+	trace_begin_call(266);
+	trace_put(&pname, sizeof(pname));
+	trace_put(&param, sizeof(param));
+	trace_end_call();
+}
+static PFNGLPIXELMAPFVPROC trace_real_glPixelMapfv = NULL;
+static void APIENTRY trace_glPixelMapfv(GLenum map, GLsizei mapsize, const GLfloat *values) {
+	trace_real_glPixelMapfv(map, mapsize, values);
+	trace_begin_call(267);
+	trace_put(&map, sizeof(map));
+	trace_put(&mapsize, sizeof(mapsize));
+	trace_put_unsupported(values != NULL);
+	trace_end_call();
+}
+static PFNGLPIXELMAPUIVPROC trace_real_glPixelMapuiv = NULL;
+static void APIENTRY trace_glPixelMapuiv(GLenum map, GLsizei mapsize, const GLuint *values) {
+	trace_real_glPixelMapuiv(map, mapsize, values);
+	trace_begin_call(268);
+	trace_put(&map, sizeof(map));
+	trace_put(&mapsize, sizeof(mapsize));
+	trace_put_unsupported(values != NULL);
+	trace_end_call();
+}
+static PFNGLPIXELMAPUSVPROC trace_real_glPixelMapusv = NULL;
+static void APIENTRY trace_glPixelMapusv(GLenum map, GLsizei mapsize, const GLushort *values) {
+	trace_real_glPixelMapusv(map, mapsize, values);
+	trace_begin_call(269);
+	trace_put(&map, sizeof(map));
+	trace_put(&mapsize, sizeof(mapsize));
+	trace_put_unsupported(values != NULL);
+	trace_end_call();
+}
+static PFNGLCOPYPIXELSPROC trace_real_glCopyPixels = NULL;
+static void APIENTRY trace_glCopyPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum type) {
+	trace_real_glCopyPixels(x, y, width, height, type);
+	trace_begin_call(270);
+	trace_put(&x, sizeof(x));
+	trace_put(&y, sizeof(y));
+	trace_put(&width, sizeof(width));
+	trace_put(&height, sizeof(height));
+	trace_put(&type, sizeof(type));
+	trace_end_call();
+}
+static PFNGLDRAWPIXELSPROC trace_real_glDrawPixels = NULL;
+static void APIENTRY trace_glDrawPixels(GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels) {
+	trace_real_glDrawPixels(width, height, format, type, pixels);
+	trace_begin_call(271);
+	trace_put(&width, sizeof(width));
+	trace_put(&height, sizeof(height));
+	trace_put(&format, sizeof(format));
+	trace_put(&type, sizeof(type));
+	trace_put_unsupported(pixels != NULL);
+	trace_end_call();
+}
+static PFNGLGETCLIPPLANEPROC trace_real_glGetClipPlane = NULL;
+static void APIENTRY trace_glGetClipPlane(GLenum plane, GLdouble *equation) {
+	trace_real_glGetClipPlane(plane, equation);
+	trace_begin_call(272);
+	trace_put(&plane, sizeof(plane));
+	trace_end_call();
+}
+static PFNGLGETLIGHTFVPROC trace_real_glGetLightfv = NULL;
+static void APIENTRY trace_glGetLightfv(GLenum light, GLenum pname, GLfloat *params) {
+	trace_real_glGetLightfv(light, pname, params);
+	trace_begin_call(273);
+	trace_put(&light, sizeof(light));
+	trace_put(&pname, sizeof(pname));
+	trace_end_call();
+}
+static PFNGLGETLIGHTIVPROC trace_real_glGetLightiv = NULL;
+static void APIENTRY trace_glGetLightiv(GLenum light, GLenum pname, GLint *params) {
+	trace_real_glGetLightiv(light, pname, params);
+	trace_begin_call(274);
+	trace_put(&light, sizeof(light));
+	trace_put(&pname, sizeof(pname));
+	trace_end_call();
+}
+static PFNGLGETMAPDVPROC trace_real_glGetMapdv = NULL;
+static void APIENTRY trace_glGetMapdv(GLenum target, GLenum query, GLdouble *v) {
+	trace_real_glGetMapdv(target, query, v);
+	trace_begin_call(275);
+	trace_put(&target, sizeof(target));
+	trace_put(&query, sizeof(query));
+	trace_end_call();
+}
+static PFNGLGETMAPFVPROC trace_real_glGetMapfv = NULL;
+static void APIENTRY trace_glGetMapfv(GLenum target, GLenum query, GLfloat *v) {
+	trace_real_glGetMapfv(target, query, v);
+	trace_begin_call(276);
+	trace_put(&target, sizeof(target));
+	trace_put(&query, sizeof(query));
+	trace_end_call();
+}
+static PFNGLGETMAPIVPROC trace_real_glGetMapiv = NULL;
+static void APIENTRY trace_glGetMapiv(GLenum target, GLenum query, GLint *v) {
+	trace_real_glGetMapiv(target, query, v);
+	trace_begin_call(277);
+	trace_put(&target, sizeof(target));
+	trace_put(&query, sizeof(query));
+	trace_end_call();
+}
+static PFNGLGETMATERIALFVPROC trace_real_glGetMaterialfv = NULL;
+static void APIENTRY trace_glGetMaterialfv(GLenum face, GLenum pname, GLfloat *params) {
+	trace_real_glGetMaterialfv(face, pname, params);
+	trace_begin_call(278);
+	trace_put(&face, sizeof(face));
+	trace_put(&pname, sizeof(pname));
+	trace_end_call();
+}
+static PFNGLGETMATERIALIVPROC trace_real_glGetMaterialiv = NULL;
+static void APIENTRY trace_glGetMaterialiv(GLenum face, GLenum pname, GLint *params) {
+	trace_real_glGetMaterialiv(face, pname, params);
+	trace_begin_call(279);
+	trace_put(&face, sizeof(face));
+	trace_put(&pname, sizeof(pname));
+	trace_end_call();
+}
+static PFNGLGETPIXELMAPFVPROC trace_real_glGetPixelMapfv = NULL;
+static void APIENTRY trace_glGetPixelMapfv(GLenum map, GLfloat *values) {
+	trace_real_glGetPixelMapfv(map, values);
+	trace_begin_call(280);
+	trace_put(&map, sizeof(map));
+	trace_end_call();
+}
+static PFNGLGETPIXELMAPUIVPROC trace_real_glGetPixelMapuiv = NULL;
+static void APIENTRY trace_glGetPixelMapuiv(GLenum map, GLuint *values) {
+	trace_real_glGetPixelMapuiv(map, values);
+	trace_begin_call(281);
+	trace_put(&map, sizeof(map));
+	trace_end_call();
+}
+static PFNGLGETPIXELMAPUSVPROC trace_real_glGetPixelMapusv = NULL;
+static void APIENTRY trace_glGetPixelMapusv(GLenum map, GLushort *values) {
+	trace_real_glGetPixelMapusv(map, values);
+	trace_begin_call(282);
+	trace_put(&map, sizeof(map));
+	trace_end_call();
+}
+static PFNGLGETPOLYGONSTIPPLEPROC trace_real_glGetPolygonStipple = NULL;
+static void APIENTRY trace_glGetPolygonStipple(GLubyte *mask) {
+	trace_real_glGetPolygonStipple(mask);
+	trace_begin_call(283);
+	trace_end_call();
+}
+static PFNGLGETTEXENVFVPROC trace_real_glGetTexEnvfv = NULL;
+static void APIENTRY trace_glGetTexEnvfv(GLenum target, GLenum pname, GLfloat *params) {
+	trace_real_glGetTexEnvfv(target, pname, params);
+	trace_begin_call(284);
+	trace_put(&target, sizeof(target));
+	trace_put(&pname, sizeof(pname));
+	trace_end_call();
+}
+static PFNGLGETTEXENVIVPROC trace_real_glGetTexEnviv = NULL;
+static void APIENTRY trace_glGetTexEnviv(GLenum target, GLenum pname, GLint *params) {
+	trace_real_glGetTexEnviv(target, pname, params);
+	trace_begin_call(285);
+	trace_put(&target, sizeof(target));
+	trace_put(&pname, sizeof(pname));
+	trace_end_call();
+}
+static PFNGLGETTEXGENDVPROC trace_real_glGetTexGendv = NULL;
+static void APIENTRY trace_glGetTexGendv(GLenum coord, GLenum pname, GLdouble *params) {
+	trace_real_glGetTexGendv(coord, pname, params);
+	trace_begin_call(286);
+	trace_put(&coord, sizeof(coord));
+	trace_put(&pname, sizeof(pname));
+	trace_end_call();
+}
+static PFNGLGETTEXGENFVPROC trace_real_glGetTexGenfv = NULL;
+static void APIENTRY trace_glGetTexGenfv(GLenum coord, GLenum pname, GLfloat *params) {
+	trace_real_glGetTexGenfv(coord, pname, params);
+	trace_begin_call(287);
+	trace_put(&coord, sizeof(coord));
+	trace_put(&pname, sizeof(pname));
+	trace_end_call();
+}
+static PFNGLGETTEXGENIVPROC trace_real_glGetTexGeniv = NULL;
+static void APIENTRY trace_glGetTexGeniv(GLenum coord, GLenum pname, GLint *params) {
+	trace_real_glGetTexGeniv(coord, pname, params);
+	trace_begin_call(288);
+	trace_put(&coord, sizeof(coord));
+	trace_put(&pname, sizeof(pname));
+	trace_end_call();
+}
+static PFNGLISLISTPROC trace_real_glIsList = NULL;
+static GLboolean APIENTRY trace_glIsList(GLuint list) {
+	GLboolean glad_result;
+	glad_result = trace_real_glIsList(list);
+	trace_begin_call(289);
+	trace_put(&list, sizeof(list));
+	trace_put(&glad_result, sizeof(glad_result));
+	trace_end_call();
+	return glad_result;
+}
+static PFNGLFRUSTUMPROC trace_real_glFrustum = NULL;
+static void APIENTRY trace_glFrustum(GLdouble left, GLdouble right, GLdouble bottom, GLdouble top, GLdouble zNear, GLdouble zFar) {
+	trace_real_glFrustum(left, right, bottom, top, zNear, zFar);
+	trace_begin_call(290);
+	trace_put(&left, sizeof(left));
+	trace_put(&right, sizeof(right));
+	trace_put(&bottom, sizeof(bottom));
+	trace_put(&top, sizeof(top));
+	trace_put(&zNear, sizeof(zNear));
+	trace_put(&zFar, sizeof(zFar));
+	trace_end_call();
+}
+static PFNGLLOADIDENTITYPROC trace_real_glLoadIdentity = NULL;
+static void APIENTRY trace_glLoadIdentity(void) {
+	trace_real_glLoadIdentity();
+	trace_begin_call(291);
+	trace_end_call();
+}
+static PFNGLLOADMATRIXFPROC trace_real_glLoadMatrixf = NULL;
+static void APIENTRY trace_glLoadMatrixf(const GLfloat *m) {
+	trace_real_glLoadMatrixf(m);
+	trace_begin_call(292);
+	trace_put_unsupported(m != NULL);
+	trace_end_call();
+}
+static PFNGLLOADMATRIXDPROC trace_real_glLoadMatrixd = NULL;
+static void APIENTRY trace_glLoadMatrixd(const GLdouble *m) {
+	trace_real_glLoadMatrixd(m);
+	trace_begin_call(293);
+	trace_put_unsupported(m != NULL);
+	trace_end_call();
+}
+static PFNGLMATRIXMODEPROC trace_real_glMatrixMode = NULL;
+static void APIENTRY trace_glMatrixMode(GLenum mode) {
+	trace_real_glMatrixMode(mode);
+	trace_begin_call(294);
+	trace_put(&mode, sizeof(mode));
+	trace_end_call();
+}
+static PFNGLMULTMATRIXFPROC trace_real_glMultMatrixf = NULL;
+static void APIENTRY trace_glMultMatrixf(const GLfloat *m) {
+	trace_real_glMultMatrixf(m);
+	trace_begin_call(295);
+	trace_put_unsupported(m != NULL);
+	trace_end_call();
+}
+static PFNGLMULTMATRIXDPROC trace_real_glMultMatrixd = NULL;
+static void APIENTRY trace_glMultMatrixd(const GLdouble *m) {
+	trace_real_glMultMatrixd(m);
+	trace_begin_call(296);
+	trace_put_unsupported(m != NULL);
+	trace_end_call();
+}
+static PFNGLORTHOPROC trace_real_glOrtho = NULL;
+static void APIENTRY trace_glOrtho(GLdouble left, GLdouble right, GLdouble bottom, GLdouble top, GLdouble zNear, GLdouble zFar) {
+	trace_real_glOrtho(left, right, bottom, top, zNear, zFar);
+	trace_begin_call(297);
+	trace_put(&left, sizeof(left));
+	trace_put(&right, sizeof(right));
+	trace_put(&bottom, sizeof(bottom));
+	trace_put(&top, sizeof(top));
+	trace_put(&zNear, sizeof(zNear));
+	trace_put(&zFar, sizeof(zFar));
+	trace_end_call();
+}
+static PFNGLPOPMATRIXPROC trace_real_glPopMatrix = NULL;
+static void APIENTRY trace_glPopMatrix(void) {
+	trace_real_glPopMatrix();
+	trace_begin_call(298);
+	trace_end_call();
+}
+static PFNGLPUSHMATRIXPROC trace_real_glPushMatrix = NULL;
+static void APIENTRY trace_glPushMatrix(void) {
+	trace_real_glPushMatrix();
+	trace_begin_call(299);
+	trace_end_call();
+}
+static PFNGLROTATEDPROC trace_real_glRotated = NULL;
+static void APIENTRY trace_glRotated(GLdouble angle, GLdouble x, GLdouble y, GLdouble z) {
+	trace_real_glRotated(angle, x, y, z);
+	trace_begin_call(300);
+	trace_put(&angle, sizeof(angle));
+	trace_put(&x, sizeof(x));
+	trace_put(&y, sizeof(y));
+	trace_put(&z, sizeof(z));
+	trace_end_call();
+}
+static PFNGLROTATEFPROC trace_real_glRotatef = NULL;
+static void APIENTRY trace_glRotatef(GLfloat angle, GLfloat x, GLfloat y, GLfloat z) {
+	trace_real_glRotatef(angle, x, y, z);
+	trace_begin_call(301);
+	trace_put(&angle, sizeof(angle));
+	trace_put(&x, sizeof(x));
+	trace_put(&y, sizeof(y));
+	trace_put(&z, sizeof(z));
+	trace_end_call();
+}
+static PFNGLSCALEDPROC trace_real_glScaled = NULL;
+static void APIENTRY trace_glScaled(GLdouble x, GLdouble y, GLdouble z) {
+	trace_real_glScaled(x, y, z);
+	trace_begin_call(302);
+	trace_put(&x, sizeof(x));
+	trace_put(&y, sizeof(y));
+	trace_put(&z, sizeof(z));
+	trace_end_call();
+}
+static PFNGLSCALEFPROC trace_real_glScalef = NULL;
+static void APIENTRY trace_glScalef(GLfloat x, GLfloat y, GLfloat z) {
+	trace_real_glScalef(x, y, z);
+	trace_begin_call(303);
+	trace_put(&x, sizeof(x));
+	trace_put(&y, sizeof(y));
+	trace_put(&z, sizeof(z));
+	trace_end_call();
+}
+static PFNGLTRANSLATEDPROC trace_real_glTranslated = NULL;
+static void APIENTRY trace_glTranslated(GLdouble x, GLdouble y, GLdouble z) {
+	trace_real_glTranslated(x, y, z);
+	trace_begin_call(304);
+	trace_put(&x, sizeof(x));
+	trace_put(&y, sizeof(y));
+	trace_put(&z, sizeof(z));
+	trace_end_call();
+}
+static PFNGLTRANSLATEFPROC trace_real_glTranslatef = NULL;
+static void APIENTRY trace_glTranslatef(GLfloat x, GLfloat y, GLfloat z) {
+	trace_real_glTranslatef(x, y, z);
+	trace_begin_call(305);
+	trace_put(&x, sizeof(x));
+	trace_put(&y, sizeof(y));
+	trace_put(&z, sizeof(z));
+	trace_end_call();
+}
+static PFNGLDRAWARRAYSPROC trace_real_glDrawArrays = NULL;
+static void APIENTRY trace_glDrawArrays(GLenum mode, GLint first, GLsizei count) {
+	trace_real_glDrawArrays(mode, first, count);
+	trace_begin_call(306);
+	trace_put(&mode, sizeof(mode));
+	trace_put(&first, sizeof(first));
+	trace_put(&count, sizeof(count));
+	trace_end_call();
+}
+static PFNGLDRAWELEMENTSPROC trace_real_glDrawElements = NULL;
+static void APIENTRY trace_glDrawElements(GLenum mode, GLsizei count, GLenum type, const void *indices) {
+	trace_real_glDrawElements(mode, count, type, indices);
+	trace_begin_call(307);
+	trace_put(&mode, sizeof(mode));
+	trace_put(&count, sizeof(count));
+	trace_put(&type, sizeof(type));
+	trace_put_offset(indices);
+	trace_end_call();
+}
+static PFNGLGETPOINTERVPROC trace_real_glGetPointerv = NULL;
+static void APIENTRY trace_glGetPointerv(GLenum pname, void **params) {
+	trace_real_glGetPointerv(pname, params);
+	trace_begin_call(308);
+	trace_put(&pname, sizeof(pname));
+	trace_end_call();
+}
+static PFNGLPOLYGONOFFSETPROC trace_real_glPolygonOffset = NULL;
+static void APIENTRY trace_glPolygonOffset(GLfloat factor, GLfloat units) {
+	trace_real_glPolygonOffset(factor, units);
+	trace_begin_call(309);
+	trace_put(&factor, sizeof(factor));
+	trace_put(&units, sizeof(units));
+	trace_end_call();
+}
+static PFNGLCOPYTEXIMAGE1DPROC trace_real_glCopyTexImage1D = NULL;
+static void APIENTRY trace_glCopyTexImage1D(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLint border) {
+	trace_real_glCopyTexImage1D(target, level, internalformat, x, y, width, border);
+	trace_begin_call(310);
+	trace_put(&target, sizeof(target));
+	trace_put(&level, sizeof(level));
+	trace_put(&internalformat, sizeof(internalformat));
+	trace_put(&x, sizeof(x));
+	trace_put(&y, sizeof(y));
+	trace_put(&width, sizeof(width));
+	trace_put(&border, sizeof(border));
+	trace_end_call();
+}
+static PFNGLCOPYTEXIMAGE2DPROC trace_real_glCopyTexImage2D = NULL;
+static void APIENTRY trace_glCopyTexImage2D(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border) {
+	trace_real_glCopyTexImage2D(target, level, internalformat, x, y, width, height, border);
+	trace_begin_call(311);
+	trace_put(&target, sizeof(target));
+	trace_put(&level, sizeof(level));
+	trace_put(&internalformat, sizeof(internalformat));
+	trace_put(&x, sizeof(x));
+	trace_put(&y, sizeof(y));
+	trace_put(&width, sizeof(width));
+	trace_put(&height, sizeof(height));
+	trace_put(&border, sizeof(border));
+	trace_end_call();
+}
+static PFNGLCOPYTEXSUBIMAGE1DPROC trace_real_glCopyTexSubImage1D = NULL;
+static void APIENTRY trace_glCopyTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width) {
+	trace_real_glCopyTexSubImage1D(target, level, xoffset, x, y, width);
+	trace_begin_call(312);
+	trace_put(&target, sizeof(target));
+	trace_put(&level, sizeof(level));
+	trace_put(&xoffset, sizeof(xoffset));
+	trace_put(&x, sizeof(x));
+	trace_put(&y, sizeof(y));
+	trace_put(&width, sizeof(width));
+	trace_end_call();
+}
+static PFNGLCOPYTEXSUBIMAGE2DPROC trace_real_glCopyTexSubImage2D = NULL;
+static void APIENTRY trace_glCopyTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height) {
+	trace_real_glCopyTexSubImage2D(target, level, xoffset, yoffset, x, y, width, height);
+	trace_begin_call(313);
+	trace_put(&target, sizeof(target));
+	trace_put(&level, sizeof(level));
+	trace_put(&xoffset, sizeof(xoffset));
+	trace_put(&yoffset, sizeof(yoffset));
+	trace_put(&x, sizeof(x));
+	trace_put(&y, sizeof(y));
+	trace_put(&width, sizeof(width));
+	trace_put(&height, sizeof(height));
+	trace_end_call();
+}
+static PFNGLTEXSUBIMAGE1DPROC trace_real_glTexSubImage1D = NULL;
+static void APIENTRY trace_glTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels) {
+	trace_real_glTexSubImage1D(target, level, xoffset, width, format, type, pixels);
+	trace_begin_call(314);
+	trace_put(&target, sizeof(target));
+	trace_put(&level, sizeof(level));
+	trace_put(&xoffset, sizeof(xoffset));
+	trace_put(&width, sizeof(width));
+	trace_put(&format, sizeof(format));
+	trace_put(&type, sizeof(type));
+	trace_put_pixels(pixels, pixels == NULL ? 0 : (size_t)(trace_image_size(format, type, width, 1, 1, 1)));
+	trace_end_call();
+}
+static PFNGLTEXSUBIMAGE2DPROC trace_real_glTexSubImage2D = NULL;
+static void APIENTRY trace_glTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels) {
+	trace_real_glTexSubImage2D(target, level, xoffset, yoffset, width, height, format, type, pixels);
+	trace_begin_call(315);
+	trace_put(&target, sizeof(target));
+	trace_put(&level, sizeof(level));
+	trace_put(&xoffset, sizeof(xoffset));
+	trace_put(&yoffset, sizeof(yoffset));
+	trace_put(&width, sizeof(width));
+	trace_put(&height, sizeof(height));
+	trace_put(&format, sizeof(format));
+	trace_put(&type, sizeof(type));
+	trace_put_pixels(pixels, pixels == NULL ? 0 : (size_t)(trace_image_size(format, type, width, height, 1, 2)));
+	trace_end_call();
+}
+static PFNGLBINDTEXTUREPROC trace_real_glBindTexture = NULL;
+static void APIENTRY trace_glBindTexture(GLenum target, GLuint texture) {
+	trace_real_glBindTexture(target, texture);
+	trace_begin_call(316);
+	trace_put(&target, sizeof(target));
+	trace_put(&texture, sizeof(texture));
+	trace_end_call();
+}
+static PFNGLDELETETEXTURESPROC trace_real_glDeleteTextures = NULL;
+static void APIENTRY trace_glDeleteTextures(GLsizei n, const GLuint *textures) {
+	trace_real_glDeleteTextures(n, textures);
+	trace_begin_call(317);
+	trace_put(&n, sizeof(n));
+	trace_put_data(textures, textures == NULL ? 0 : (size_t)n * sizeof(GLuint));
+	trace_end_call();
+}
+static PFNGLGENTEXTURESPROC trace_real_glGenTextures = NULL;
+static void APIENTRY trace_glGenTextures(GLsizei n, GLuint *textures) {
+	trace_real_glGenTextures(n, textures);
+	trace_begin_call(318);
+	trace_put(&n, sizeof(n));
+	trace_put_data(textures, textures == NULL ? 0 : (size_t)n * sizeof(GLuint));
+	trace_end_call();
+}
+static PFNGLISTEXTUREPROC trace_real_glIsTexture = NULL;
+static GLboolean APIENTRY trace_glIsTexture(GLuint texture) {
+	GLboolean glad_result;
+	glad_result = trace_real_glIsTexture(texture);
+	trace_begin_call(319);
+	trace_put(&texture, sizeof(texture));
+	trace_put(&glad_result, sizeof(glad_result));
+	trace_end_call();
+	return glad_result;
+}
+static PFNGLARRAYELEMENTPROC trace_real_glArrayElement = NULL;
+static void APIENTRY trace_glArrayElement(GLint i) {
+	trace_real_glArrayElement(i);
+	trace_begin_call(320);
+	trace_put(&i, sizeof(i));
+	trace_end_call();
+}
+static PFNGLCOLORPOINTERPROC trace_real_glColorPointer = NULL;
+static void APIENTRY trace_glColorPointer(GLint size, GLenum type, GLsizei stride, const void *pointer) {
+	trace_real_glColorPointer(size, type, stride, pointer);
+	trace_begin_call(321);
+	trace_put(&size, sizeof(size));
+	trace_put(&type, sizeof(type));
+	trace_put(&stride, sizeof(stride));
+	trace_put_unsupported(pointer != NULL);
+	trace_end_call();
+}
+static PFNGLDISABLECLIENTSTATEPROC trace_real_glDisableClientState = NULL;
+static void APIENTRY trace_glDisableClientState(GLenum array) {
+	trace_real_glDisableClientState(array);
+	trace_begin_call(322);
+	trace_put(&array, sizeof(array));
+	trace_end_call();
+}
+static PFNGLEDGEFLAGPOINTERPROC trace_real_glEdgeFlagPointer = NULL;
+static void APIENTRY trace_glEdgeFlagPointer(GLsizei stride, const void *pointer) {
+	trace_real_glEdgeFlagPointer(stride, pointer);
+	trace_begin_call(323);
+	trace_put(&stride, sizeof(stride));
+	trace_put_unsupported(pointer != NULL);
+	trace_end_call();
+}
+static PFNGLENABLECLIENTSTATEPROC trace_real_glEnableClientState = NULL;
+static void APIENTRY trace_glEnableClientState(GLenum array) {
+	trace_real_glEnableClientState(array);
+	trace_begin_call(324);
+	trace_put(&array, sizeof(array));
+	trace_end_call();
+}
+static PFNGLINDEXPOINTERPROC trace_real_glIndexPointer = NULL;
+static void APIENTRY trace_glIndexPointer(GLenum type, GLsizei stride, const void *pointer) {
+	trace_real_glIndexPointer(type, stride, pointer);
+	trace_begin_call(325);
+	trace_put(&type, sizeof(type));
+	trace_put(&stride, sizeof(stride));
+	trace_put_unsupported(pointer != NULL);
+	trace_end_call();
+}
+static PFNGLINTERLEAVEDARRAYSPROC trace_real_glInterleavedArrays = NULL;
+static void APIENTRY trace_glInterleavedArrays(GLenum format, GLsizei stride, const void *pointer) {
+	trace_real_glInterleavedArrays(format, stride, pointer);
+	trace_begin_call(326);
+	trace_put(&format, sizeof(format));
+	trace_put(&stride, sizeof(stride));
+	trace_put_unsupported(pointer != NULL);
+	trace_end_call();
+}
+static PFNGLNORMALPOINTERPROC trace_real_glNormalPointer = NULL;
+static void APIENTRY trace_glNormalPointer(GLenum type, GLsizei stride, const void *pointer) {
+	trace_real_glNormalPointer(type, stride, pointer);
+	trace_begin_call(327);
+	trace_put(&type, sizeof(type));
+	trace_put(&stride, sizeof(stride));
+	trace_put_unsupported(pointer != NULL);
+	trace_end_call();
+}
+static PFNGLTEXCOORDPOINTERPROC trace_real_glTexCoordPointer = NULL;
+static void APIENTRY trace_glTexCoordPointer(GLint size, GLenum type, GLsizei stride, const void *pointer) {
+	trace_real_glTexCoordPointer(size, type, stride, pointer);
+	trace_begin_call(328);
+	trace_put(&size, sizeof(size));
+	trace_put(&type, sizeof(type));
+	trace_put(&stride, sizeof(stride));
+	trace_put_unsupported(pointer != NULL);
+	trace_end_call();
+}
+static PFNGLVERTEXPOINTERPROC trace_real_glVertexPointer = NULL;
+static void APIENTRY trace_glVertexPointer(GLint size, GLenum type, GLsizei stride, const void *pointer) {
+	trace_real_glVertexPointer(size, type, stride, pointer);
+	trace_begin_call(329);
+	trace_put(&size, sizeof(size));
+	trace_put(&type, sizeof(type));
+	trace_put(&stride, sizeof(stride));
+	trace_put_unsupported(pointer != NULL);
+	trace_end_call();
+}
+static PFNGLARETEXTURESRESIDENTPROC trace_real_glAreTexturesResident = NULL;
+static GLboolean APIENTRY trace_glAreTexturesResident(GLsizei n, const GLuint *textures, GLboolean *residences) {
+	GLboolean glad_result;
+	glad_result = trace_real_glAreTexturesResident(n, textures, residences);
+	trace_begin_call(330);
+	trace_put(&n, sizeof(n));
+	trace_put_unsupported(textures != NULL);
+	trace_put(&glad_result, sizeof(glad_result));
+	trace_end_call();
+	return glad_result;
+}
+static PFNGLPRIORITIZETEXTURESPROC trace_real_glPrioritizeTextures = NULL;
+static void APIENTRY trace_glPrioritizeTextures(GLsizei n, const GLuint *textures, const GLfloat *priorities) {
+	trace_real_glPrioritizeTextures(n, textures, priorities);
+	trace_begin_call(331);
+	trace_put(&n, sizeof(n));
+	trace_put_unsupported(textures != NULL);
+	trace_put_unsupported(priorities != NULL);
+	trace_end_call();
+}
+static PFNGLINDEXUBPROC trace_real_glIndexub = NULL;
+static void APIENTRY trace_glIndexub(GLubyte c) {
+	trace_real_glIndexub(c);
+	trace_begin_call(332);
+	trace_put(&c, sizeof(c));
+	trace_end_call();
+}
+static PFNGLINDEXUBVPROC trace_real_glIndexubv = NULL;
+static void APIENTRY trace_glIndexubv(const GLubyte *c) {
+	trace_real_glIndexubv(c);
+	trace_begin_call(333);
+	trace_put_unsupported(c != NULL);
+	trace_end_call();
+}
+static PFNGLPOPCLIENTATTRIBPROC trace_real_glPopClientAttrib = NULL;
+static void APIENTRY trace_glPopClientAttrib(void) {
+	trace_real_glPopClientAttrib();
+	trace_begin_call(334);
+	trace_end_call();
+}
+static PFNGLPUSHCLIENTATTRIBPROC trace_real_glPushClientAttrib = NULL;
+static void APIENTRY trace_glPushClientAttrib(GLbitfield mask) {
+	trace_real_glPushClientAttrib(mask);
+	trace_begin_call(335);
+	trace_put(&mask, sizeof(mask));
+	trace_end_call();
+}
+static PFNGLDRAWRANGEELEMENTSPROC trace_real_glDrawRangeElements = NULL;
+static void APIENTRY trace_glDrawRangeElements(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices) {
+	trace_real_glDrawRangeElements(mode, start, end, count, type, indices);
+	trace_begin_call(336);
+	trace_put(&mode, sizeof(mode));
+	trace_put(&start, sizeof(start));
+	trace_put(&end, sizeof(end));
+	trace_put(&count, sizeof(count));
+	trace_put(&type, sizeof(type));
+	trace_put_offset(indices);
+	trace_end_call();
+}
+static PFNGLTEXIMAGE3DPROC trace_real_glTexImage3D = NULL;
+static void APIENTRY trace_glTexImage3D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void *pixels) {
+	trace_real_glTexImage3D(target, level, internalformat, width, height, depth, border, format, type, pixels);
+	trace_begin_call(337);
+	trace_put(&target, sizeof(target));
+	trace_put(&level, sizeof(level));
+	trace_put(&internalformat, sizeof(internalformat));
+	trace_put(&width, sizeof(width));
+	trace_put(&height, sizeof(height));
+	trace_put(&depth, sizeof(depth));
+	trace_put(&border, sizeof(border));
+	trace_put(&format, sizeof(format));
+	trace_put(&type, sizeof(type));
+	trace_put_pixels(pixels, pixels == NULL ? 0 : (size_t)(trace_image_size(format, type, width, height, depth, 3)));
+	trace_end_call();
+}
+static PFNGLTEXSUBIMAGE3DPROC trace_real_glTexSubImage3D = NULL;
+static void APIENTRY trace_glTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels) {
+	trace_real_glTexSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
+	trace_begin_call(338);
+	trace_put(&target, sizeof(target));
+	trace_put(&level, sizeof(level));
+	trace_put(&xoffset, sizeof(xoffset));
+	trace_put(&yoffset, sizeof(yoffset));
+	trace_put(&zoffset, sizeof(zoffset));
+	trace_put(&width, sizeof(width));
+	trace_put(&height, sizeof(height));
+	trace_put(&depth, sizeof(depth));
+	trace_put(&format, sizeof(format));
+	trace_put(&type, sizeof(type));
+	trace_put_pixels(pixels, pixels == NULL ? 0 : (size_t)(trace_image_size(format, type, width, height, depth, 3)));
+	trace_end_call();
+}
+static PFNGLCOPYTEXSUBIMAGE3DPROC trace_real_glCopyTexSubImage3D = NULL;
+static void APIENTRY trace_glCopyTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height) {
+	trace_real_glCopyTexSubImage3D(target, level, xoffset, yoffset, zoffset, x, y, width, height);
+	trace_begin_call(339);
+	trace_put(&target, sizeof(target));
+	trace_put(&level, sizeof(level));
+	trace_put(&xoffset, sizeof(xoffset));
+	trace_put(&yoffset, sizeof(yoffset));
+	trace_put(&zoffset, sizeof(zoffset));
+	trace_put(&x, sizeof(x));
+	trace_put(&y, sizeof(y));
+	trace_put(&width, sizeof(width));
+	trace_put(&height, sizeof(height));
+	trace_end_call();
+}
+static PFNGLACTIVETEXTUREPROC trace_real_glActiveTexture = NULL;
+static void APIENTRY trace_glActiveTexture(GLenum texture) {
+	trace_real_glActiveTexture(texture);
+	trace_begin_call(340);
+	trace_put(&texture, sizeof(texture));
+	trace_end_call();
+}
+static PFNGLSAMPLECOVERAGEPROC trace_real_glSampleCoverage = NULL;
+static void APIENTRY trace_glSampleCoverage(GLfloat value, GLboolean invert) {
+	trace_real_glSampleCoverage(value, invert);
+	trace_begin_call(341);
+	trace_put(&value, sizeof(value));
+	trace_put(&invert, sizeof(invert));
+	trace_end_call();
+}
+static PFNGLCOMPRESSEDTEXIMAGE3DPROC trace_real_glCompressedTexImage3D = NULL;
+static void APIENTRY trace_glCompressedTexImage3D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const void *data) {
+	trace_real_glCompressedTexImage3D(target, level, internalformat, width, height, depth, border, imageSize, data);
+	trace_begin_call(342);
+	trace_put(&target, sizeof(target));
+	trace_put(&level, sizeof(level));
+	trace_put(&internalformat, sizeof(internalformat));
+	trace_put(&width, sizeof(width));
+	trace_put(&height, sizeof(height));
+	trace_put(&depth, sizeof(depth));
+	trace_put(&border, sizeof(border));
+	trace_put(&imageSize, sizeof(imageSize));
+	trace_put_pixels(data, data == NULL ? 0 : (size_t)(imageSize));
+	trace_end_call();
+}
+static PFNGLCOMPRESSEDTEXIMAGE2DPROC trace_real_glCompressedTexImage2D = NULL;
+static void APIENTRY trace_glCompressedTexImage2D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void *data) {
+	trace_real_glCompressedTexImage2D(target, level, internalformat, width, height, border, imageSize, data);
+	trace_begin_call(343);
+	trace_put(&target, sizeof(target));
+	trace_put(&level, sizeof(level));
+	trace_put(&internalformat, sizeof(internalformat));
+	trace_put(&width, sizeof(width));
+	trace_put(&height, sizeof(height));
+	trace_put(&border, sizeof(border));
+	trace_put(&imageSize, sizeof(imageSize));
+	trace_put_pixels(data, data == NULL ? 0 : (size_t)(imageSize));
+	trace_end_call();
+}
+static PFNGLCOMPRESSEDTEXIMAGE1DPROC trace_real_glCompressedTexImage1D = NULL;
+static void APIENTRY trace_glCompressedTexImage1D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const void *data) {
+	trace_real_glCompressedTexImage1D(target, level, internalformat, width, border, imageSize, data);
+	trace_begin_call(344);
+	trace_put(&target, sizeof(target));
+	trace_put(&level, sizeof(level));
+	trace_put(&internalformat, sizeof(internalformat));
+	trace_put(&width, sizeof(width));
+	trace_put(&border, sizeof(border));
+	trace_put(&imageSize, sizeof(imageSize));
+	trace_put_pixels(data, data == NULL ? 0 : (size_t)(imageSize));
+	trace_end_call();
+}
+static PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC trace_real_glCompressedTexSubImage3D = NULL;
+static void APIENTRY trace_glCompressedTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *data) {
+	trace_real_glCompressedTexSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
+	trace_begin_call(345);
+	trace_put(&target, sizeof(target));
+	trace_put(&level, sizeof(level));
+	trace_put(&xoffset, sizeof(xoffset));
+	trace_put(&yoffset, sizeof(yoffset));
+	trace_put(&zoffset, sizeof(zoffset));
+	trace_put(&width, sizeof(width));
+	trace_put(&height, sizeof(height));
+	trace_put(&depth, sizeof(depth));
+	trace_put(&format, sizeof(format));
+	trace_put(&imageSize, sizeof(imageSize));
+	trace_put_pixels(data, data == NULL ? 0 : (size_t)(imageSize));
+	trace_end_call();
+}
+static PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC trace_real_glCompressedTexSubImage2D = NULL;
+static void APIENTRY trace_glCompressedTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *data) {
+	trace_real_glCompressedTexSubImage2D(target, level, xoffset, yoffset, width, height, format, imageSize, data);
+	trace_begin_call(346);
+	trace_put(&target, sizeof(target));
+	trace_put(&level, sizeof(level));
+	trace_put(&xoffset, sizeof(xoffset));
+	trace_put(&yoffset, sizeof(yoffset));
+	trace_put(&width, sizeof(width));
+	trace_put(&height, sizeof(height));
+	trace_put(&format, sizeof(format));
+	trace_put(&imageSize, sizeof(imageSize));
+	trace_put_pixels(data, data == NULL ? 0 : (size_t)(imageSize));
+	trace_end_call();
+}
+static PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC trace_real_glCompressedTexSubImage1D = NULL;
+static void APIENTRY trace_glCompressedTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void *data) {
+	trace_real_glCompressedTexSubImage1D(target, level, xoffset, width, format, imageSize, data);
+	trace_begin_call(347);
+	trace_put(&target, sizeof(target));
+	trace_put(&level, sizeof(level));
+	trace_put(&xoffset, sizeof(xoffset));
+	trace_put(&width, sizeof(width));
+	trace_put(&format, sizeof(format));
+	trace_put(&imageSize, sizeof(imageSize));
+	trace_put_pixels(data, data == NULL ? 0 : (size_t)(imageSize));
+	trace_end_call();
+}
+static PFNGLGETCOMPRESSEDTEXIMAGEPROC trace_real_glGetCompressedTexImage = NULL;
+static void APIENTRY trace_glGetCompressedTexImage(GLenum target, GLint level, void *img) {
+	trace_real_glGetCompressedTexImage(target, level, img);
+	trace_begin_call(348);
+	trace_put(&target, sizeof(target));
+	trace_put(&level, sizeof(level));
+	trace_end_call();
+}
+static PFNGLCLIENTACTIVETEXTUREPROC trace_real_glClientActiveTexture = NULL;
+static void APIENTRY trace_glClientActiveTexture(GLenum texture) {
+	trace_real_glClientActiveTexture(texture);
+	trace_begin_call(349);
+	trace_put(&texture, sizeof(texture));
+	trace_end_call();
+}
+static PFNGLMULTITEXCOORD1DPROC trace_real_glMultiTexCoord1d = NULL;
+static void APIENTRY trace_glMultiTexCoord1d(GLenum target, GLdouble s) {
+	trace_real_glMultiTexCoord1d(target, s);
+	trace_begin_call(350);
+	trace_put(&target, sizeof(target));
+	trace_put(&s, sizeof(s));
+	trace_end_call();
+}
+static PFNGLMULTITEXCOORD1DVPROC trace_real_glMultiTexCoord1dv = NULL;
+static void APIENTRY trace_glMultiTexCoord1dv(GLenum target, const GLdouble *v) {
+	trace_real_glMultiTexCoord1dv(target, v);
+	trace_begin_call(351);
+	trace_put(&target, sizeof(target));
+	trace_put_data(v, v == NULL ? 0 : (size_t)(1 * sizeof(GLdouble)));
+	trace_end_call();
+}
+static PFNGLMULTITEXCOORD1FPROC trace_real_glMultiTexCoord1f = NULL;
+static void APIENTRY trace_glMultiTexCoord1f(GLenum target, GLfloat s) {
+	trace_real_glMultiTexCoord1f(target, s);
+	trace_begin_call(352);
+	trace_put(&target, sizeof(target));
+	trace_put(&s, sizeof(s));
+	trace_end_call();
+}
+static PFNGLMULTITEXCOORD1FVPROC trace_real_glMultiTexCoord1fv = NULL;
+static void APIENTRY trace_glMultiTexCoord1fv(GLenum target, const GLfloat *v) {
+	trace_real_glMultiTexCoord1fv(target, v);
+	trace_begin_call(353);
+	trace_put(&target, sizeof(target));
+	trace_put_data(v, v == NULL ? 0 : (size_t)(1 * sizeof(GLfloat)));
+	trace_end_call();
+}
+static PFNGLMULTITEXCOORD1IPROC trace_real_glMultiTexCoord1i = NULL;
+static void APIENTRY trace_glMultiTexCoord1i(GLenum target, GLint s) {
+	trace_real_glMultiTexCoord1i(target, s);
+	trace_begin_call(354);
+	trace_put(&target, sizeof(target));
+	trace_put(&s, sizeof(s));
+	trace_end_call();
+}
+static PFNGLMULTITEXCOORD1IVPROC trace_real_glMultiTexCoord1iv = NULL;
+static void APIENTRY trace_glMultiTexCoord1iv(GLenum target, const GLint *v) {
+	trace_real_glMultiTexCoord1iv(target, v);
+	trace_begin_call(355);
+	trace_put(&target, sizeof(target));
+	trace_put_data(v, v == NULL ? 0 : (size_t)(1 * sizeof(GLint)));
+	trace_end_call();
+}
+static PFNGLMULTITEXCOORD1SPROC trace_real_glMultiTexCoord1s = NULL;
+static void APIENTRY trace_glMultiTexCoord1s(GLenum target, GLshort s) {
+	trace_real_glMultiTexCoord1s(target, s);
+	trace_begin_call(356);
+	trace_put(&target, sizeof(target));
+	trace_put(&s, sizeof(s));
+	trace_end_call();
+}
+static PFNGLMULTITEXCOORD1SVPROC trace_real_glMultiTexCoord1sv = NULL;
+static void APIENTRY trace_glMultiTexCoord1sv(GLenum target, const GLshort *v) {
+	trace_real_glMultiTexCoord1sv(target, v);
+	trace_begin_call(357);
+	trace_put(&target, sizeof(target));
+	trace_put_data(v, v == NULL ? 0 : (size_t)(1 * sizeof(GLshort)));
+	trace_end_call();
+}
+static PFNGLMULTITEXCOORD2DPROC trace_real_glMultiTexCoord2d = NULL;
+static void APIENTRY trace_glMultiTexCoord2d(GLenum target, GLdouble s, GLdouble t) {
+	trace_real_glMultiTexCoord2d(target, s, t);
+	trace_begin_call(358);
+	trace_put(&target, sizeof(target));
+	trace_put(&s, sizeof(s));
+	trace_put(&t, sizeof(t));
+	trace_end_call();
+}
+static PFNGLMULTITEXCOORD2DVPROC trace_real_glMultiTexCoord2dv = NULL;
+static void APIENTRY trace_glMultiTexCoord2dv(GLenum target, const GLdouble *v) {
+	trace_real_glMultiTexCoord2dv(target, v);
+	trace_begin_call(359);
+	trace_put(&target, sizeof(target));
+	trace_put_data(v, v == NULL ? 0 : (size_t)(2 * sizeof(GLdouble)));
+	trace_end_call();
+}
+static PFNGLMULTITEXCOORD2FPROC trace_real_glMultiTexCoord2f = NULL;
+static void APIENTRY trace_glMultiTexCoord2f(GLenum target, GLfloat s, GLfloat t) {
+	trace_real_glMultiTexCoord2f(target, s, t);
+	trace_begin_call(360);
+	trace_put(&target, sizeof(target));
+	trace_put(&s, sizeof(s));
+	trace_put(&t, sizeof(t));
+	trace_end_call();
+}
+static PFNGLMULTITEXCOORD2FVPROC trace_real_glMultiTexCoord2fv = NULL;
+static void APIENTRY trace_glMultiTexCoord2fv(GLenum target, const GLfloat *v) {
+	trace_real_glMultiTexCoord2fv(target, v);
+	trace_begin_call(361);
+	trace_put(&target, sizeof(target));
+	trace_put_data(v, v == NULL ? 0 : (size_t)(2 * sizeof(GLfloat)));
+	trace_end_call();
+}
+static PFNGLMULTITEXCOORD2IPROC trace_real_glMultiTexCoord2i = NULL;
+static void APIENTRY trace_glMultiTexCoord2i(GLenum target, GLint s, GLint t) {
+	trace_real_glMultiTexCoord2i(target, s, t);
+	trace_begin_call(362);
+	trace_put(&target, sizeof(target));
+	trace_put(&s, sizeof(s));
+	trace_put(&t, sizeof(t));
+	trace_end_call();
+}
+static PFNGLMULTITEXCOORD2IVPROC trace_real_glMultiTexCoord2iv = NULL;
+static void APIENTRY trace_glMultiTexCoord2iv(GLenum target, const GLint *v) {
+	trace_real_glMultiTexCoord2iv(target, v);
+	trace_begin_call(363);
+	trace_put(&target, sizeof(target));
+	trace_put_data(v, v == NULL ? 0 : (size_t)(2 * sizeof(GLint)));
+	trace_end_call();
+}
+static PFNGLMULTITEXCOORD2SPROC trace_real_glMultiTexCoord2s = NULL;
+static void APIENTRY trace_glMultiTexCoord2s(GLenum target, GLshort s, GLshort t) {
+	trace_real_glMultiTexCoord2s(target, s, t);
+	trace_begin_call(364);
+	trace_put(&target, sizeof(target));
+	trace_put(&s, sizeof(s));
+	trace_put(&t, sizeof(t));
+	trace_end_call();
+}
+static PFNGLMULTITEXCOORD2SVPROC trace_real_glMultiTexCoord2sv = NULL;
+static void APIENTRY trace_glMultiTexCoord2sv(GLenum target, const GLshort *v) {
+	trace_real_glMultiTexCoord2sv(target, v);
+	trace_begin_call(365);
+	trace_put(&target, sizeof(target));
+	trace_put_data(v, v == NULL ? 0 : (size_t)(2 * sizeof(GLshort)));
+	trace_end_call();
+}
+static PFNGLMULTITEXCOORD3DPROC trace_real_glMultiTexCoord3d = NULL;
+static void APIENTRY trace_glMultiTexCoord3d(GLenum target, GLdouble s, GLdouble t, GLdouble r) {
+	trace_real_glMultiTexCoord3d(target, s, t, r);
+	trace_begin_call(366);
+	trace_put(&target, sizeof(target));
+	trace_put(&s, sizeof(s));
+	trace_put(&t, sizeof(t));
+	trace_put(&r, sizeof(r));
+	trace_end_call();
+}
+static PFNGLMULTITEXCOORD3DVPROC trace_real_glMultiTexCoord3dv = NULL;
+static void APIENTRY trace_glMultiTexCoord3dv(GLenum target, const GLdouble *v) {
+	trace_real_glMultiTexCoord3dv(target, v);
+	trace_begin_call(367);
+	trace_put(&target, sizeof(target));
+	trace_put_data(v, v == NULL ? 0 : (size_t)(3 * sizeof(GLdouble)));
+	trace_end_call();
+}
+static PFNGLMULTITEXCOORD3FPROC trace_real_glMultiTexCoord3f = NULL;
+static void APIENTRY trace_glMultiTexCoord3f(GLenum target, GLfloat s, GLfloat t, GLfloat r) {
+	trace_real_glMultiTexCoord3f(target, s, t, r);
+	trace_begin_call(368);
+	trace_put(&target, sizeof(target));
+	trace_put(&s, sizeof(s));
+	trace_put(&t, sizeof(t));
+	trace_put(&r, sizeof(r));
+	trace_end_call();
+}
+static PFNGLMULTITEXCOORD3FVPROC trace_real_glMultiTexCoord3fv = NULL;
+static void APIENTRY trace_glMultiTexCoord3fv(GLenum target, const GLfloat *v) {
+	trace_real_glMultiTexCoord3fv(target, v);
+	trace_begin_call(369);
+	trace_put(&target, sizeof(target));
+	trace_put_data(v, v == NULL ? 0 : (size_t)(3 * sizeof(GLfloat)));
+	trace_end_call();
+}
+static PFNGLMULTITEXCOORD3IPROC trace_real_glMultiTexCoord3i = NULL;
+static void APIENTRY trace_glMultiTexCoord3i(GLenum target, GLint s, GLint t, GLint r) {
+	trace_real_glMultiTexCoord3i(target, s, t, r);
+	trace_begin_call(370);
+	trace_put(&target, sizeof(target));
+	trace_put(&s, sizeof(s));
+	trace_put(&t, sizeof(t));
+	trace_put(&r, sizeof(r));
+	trace_end_call();
+}
+static PFNGLMULTITEXCOORD3IVPROC trace_real_glMultiTexCoord3iv = NULL;
+static void APIENTRY trace_glMultiTexCoord3iv(GLenum target, const GLint *v) {
+	trace_real_glMultiTexCoord3iv(target, v);
+	trace_begin_call(371);
+	trace_put(&target, sizeof(target));
+	trace_put_data(v, v == NULL ? 0 : (size_t)(3 * sizeof(GLint)));
+	trace_end_call();
+}
+static PFNGLMULTITEXCOORD3SPROC trace_real_glMultiTexCoord3s = NULL;
+static void APIENTRY trace_glMultiTexCoord3s(GLenum target, GLshort s, GLshort t, GLshort r) {
+	trace_real_glMultiTexCoord3s(target, s, t, r);
+	trace_begin_call(372);
+	trace_put(&target, sizeof(target));
+	trace_put(&s, sizeof(s));
+	trace_put(&t, sizeof(t));
+	trace_put(&r, sizeof(r));
+	trace_end_call();
+}
+static PFNGLMULTITEXCOORD3SVPROC trace_real_glMultiTexCoord3sv = NULL;
+static void APIENTRY trace_glMultiTexCoord3sv(GLenum target, const GLshort *v) {
+	trace_real_glMultiTexCoord3sv(target, v);
+	trace_begin_call(373);
+	trace_put(&target, sizeof(target));
+	trace_put_data(v, v == NULL ? 0 : (size_t)(3 * sizeof(GLshort)));
+	trace_end_call();
+}
+static PFNGLMULTITEXCOORD4DPROC trace_real_glMultiTexCoord4d = NULL;
+static void APIENTRY trace_glMultiTexCoord4d(GLenum target, GLdouble s, GLdouble t, GLdouble r, GLdouble q) {
+	trace_real_glMultiTexCoord4d(target, s, t, r, q);
+	trace_begin_call(374);
+	trace_put(&target, sizeof(target));
+	trace_put(&s, sizeof(s));
+	trace_put(&t, sizeof(t));
+	trace_put(&r, sizeof(r));
+	trace_put(&q, sizeof(q));
+	trace_end_call();
+}
+static PFNGLMULTITEXCOORD4DVPROC trace_real_glMultiTexCoord4dv = NULL;
+static void APIENTRY trace_glMultiTexCoord4dv(GLenum target, const GLdouble *v) {
+	trace_real_glMultiTexCoord4dv(target, v);
+	trace_begin_call(375);
+	trace_put(&target, sizeof(target));
+	trace_put_data(v, v == NULL ? 0 : (size_t)(4 * sizeof(GLdouble)));
+	trace_end_call();
+}
+static PFNGLMULTITEXCOORD4FPROC trace_real_glMultiTexCoord4f = NULL;
+static void APIENTRY trace_glMultiTexCoord4f(GLenum target, GLfloat s, GLfloat t, GLfloat r, GLfloat q) {
+	trace_real_glMultiTexCoord4f(target, s, t, r, q);
+	trace_begin_call(376);
+	trace_put(&target, sizeof(target));
+	trace_put(&s, sizeof(s));
+	trace_put(&t, sizeof(t));
+	trace_put(&r, sizeof(r));
+	trace_put(&q, sizeof(q));
+	trace_end_call();
+}
+static PFNGLMULTITEXCOORD4FVPROC trace_real_glMultiTexCoord4fv = NULL;
+static void APIENTRY trace_glMultiTexCoord4fv(GLenum target, const GLfloat *v) {
+	trace_real_glMultiTexCoord4fv(target, v);
+	trace_begin_call(377);
+	trace_put(&target, sizeof(target));
+	trace_put_data(v, v == NULL ? 0 : (size_t)(4 * sizeof(GLfloat)));
+	trace_end_call();
+}
+static PFNGLMULTITEXCOORD4IPROC trace_real_glMultiTexCoord4i = NULL;
+static void APIENTRY trace_glMultiTexCoord4i(GLenum target, GLint s, GLint t, GLint r, GLint q) {
+	trace_real_glMultiTexCoord4i(target, s, t, r, q);
+	trace_begin_call(378);
+	trace_put(&target, sizeof(target));
+	trace_put(&s, sizeof(s));
+	trace_put(&t, sizeof(t));
+	trace_put(&r, sizeof(r));
+	trace_put(&q, sizeof(q));
+	trace_end_call();
+}
+static PFNGLMULTITEXCOORD4IVPROC trace_real_glMultiTexCoord4iv = NULL;
+static void APIENTRY trace_glMultiTexCoord4iv(GLenum target, const GLint *v) {
+	trace_real_glMultiTexCoord4iv(target, v);
+	trace_begin_call(379);
+	trace_put(&target, sizeof(target));
+	trace_put_data(v, v == NULL ? 0 : (size_t)(4 * sizeof(GLint)));
+	trace_end_call();
+}
+static PFNGLMULTITEXCOORD4SPROC trace_real_glMultiTexCoord4s = NULL;
+static void APIENTRY trace_glMultiTexCoord4s(GLenum target, GLshort s, GLshort t, GLshort r, GLshort q) {
+	trace_real_glMultiTexCoord4s(target, s, t, r, q);
+	trace_begin_call(380);
+	trace_put(&target, sizeof(target));
+	trace_put(&s, sizeof(s));
+	trace_put(&t, sizeof(t));
+	trace_put(&r, sizeof(r));
+	trace_put(&q, sizeof(q));
+	trace_end_call();
+}
+static PFNGLMULTITEXCOORD4SVPROC trace_real_glMultiTexCoord4sv = NULL;
+static void APIENTRY trace_glMultiTexCoord4sv(GLenum target, const GLshort *v) {
+	trace_real_glMultiTexCoord4sv(target, v);
+	trace_begin_call(381);
+	trace_put(&target, sizeof(target));
+	trace_put_data(v, v == NULL ? 0 : (size_t)(4 * sizeof(GLshort)));
+	trace_end_call();
+}
+static PFNGLLOADTRANSPOSEMATRIXFPROC trace_real_glLoadTransposeMatrixf = NULL;
+static void APIENTRY trace_glLoadTransposeMatrixf(const GLfloat *m) {
+	trace_real_glLoadTransposeMatrixf(m);
+	trace_begin_call(382);
+	trace_put_unsupported(m != NULL);
+	trace_end_call();
+}
+static PFNGLLOADTRANSPOSEMATRIXDPROC trace_real_glLoadTransposeMatrixd = NULL;
+static void APIENTRY trace_glLoadTransposeMatrixd(const GLdouble *m) {
+	trace_real_glLoadTransposeMatrixd(m);
+	trace_begin_call(383);
+	trace_put_unsupported(m != NULL);
+	trace_end_call();
+}
+static PFNGLMULTTRANSPOSEMATRIXFPROC trace_real_glMultTransposeMatrixf = NULL;
+static void APIENTRY trace_glMultTransposeMatrixf(const GLfloat *m) {
+	trace_real_glMultTransposeMatrixf(m);
+	trace_begin_call(384);
+	trace_put_unsupported(m != NULL);
+	trace_end_call();
+}
+static PFNGLMULTTRANSPOSEMATRIXDPROC trace_real_glMultTransposeMatrixd = NULL;
+static void APIENTRY trace_glMultTransposeMatrixd(const GLdouble *m) {
+	trace_real_glMultTransposeMatrixd(m);
+	trace_begin_call(385);
+	trace_put_unsupported(m != NULL);
+	trace_end_call();
+}
+static PFNGLBLENDFUNCSEPARATEPROC trace_real_glBlendFuncSeparate = NULL;
+static void APIENTRY trace_glBlendFuncSeparate(GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha) {
+	trace_real_glBlendFuncSeparate(sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha);
+	trace_begin_call(386);
+	trace_put(&sfactorRGB, sizeof(sfactorRGB));
+	trace_put(&dfactorRGB, sizeof(dfactorRGB));
+	trace_put(&sfactorAlpha, sizeof(sfactorAlpha));
+	trace_put(&dfactorAlpha, sizeof(dfactorAlpha));
+	trace_end_call();
+}
+static PFNGLMULTIDRAWARRAYSPROC trace_real_glMultiDrawArrays = NULL;
+static void APIENTRY trace_glMultiDrawArrays(GLenum mode, const GLint *first, const GLsizei *count, GLsizei drawcount) {
+	trace_real_glMultiDrawArrays(mode, first, count, drawcount);
+	trace_begin_call(387);
+	trace_put(&mode, sizeof(mode));
+	trace_put_data(first, first == NULL ? 0 : (size_t)(drawcount * sizeof(GLint)));
+	trace_put_data(count, count == NULL ? 0 : (size_t)(drawcount * sizeof(GLsizei)));
+	trace_put(&drawcount, sizeof(drawcount));
+	trace_end_call();
+}
+static PFNGLMULTIDRAWELEMENTSPROC trace_real_glMultiDrawElements = NULL;
+static void APIENTRY trace_glMultiDrawElements(GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount) {
+	trace_real_glMultiDrawElements(mode, count, type, indices, drawcount);
+	trace_begin_call(388);
+	trace_put(&mode, sizeof(mode));
+	trace_put_unsupported(count != NULL);
+	trace_put(&type, sizeof(type));
+	trace_put_unsupported(indices != NULL);
+	trace_put(&drawcount, sizeof(drawcount));
+	trace_end_call();
+}
+static PFNGLPOINTPARAMETERFPROC trace_real_glPointParameterf = NULL;
+static void APIENTRY trace_glPointParameterf(GLenum pname, GLfloat param) {
+	trace_real_glPointParameterf(pname, param);
+	trace_begin_call(389);
+	trace_put(&pname, sizeof(pname));
+	trace_put(&param, sizeof(param));
+	trace_end_call();
+}
+static PFNGLPOINTPARAMETERFVPROC trace_real_glPointParameterfv = NULL;
+static void APIENTRY trace_glPointParameterfv(GLenum pname, const GLfloat *params) {
+	trace_real_glPointParameterfv(pname, params);
+	trace_begin_call(390);
+	trace_put(&pname, sizeof(pname));
+	trace_put_data(params, params == NULL ? 0 : (size_t)(trace_param_count(pname) * sizeof(GLfloat)));
+	trace_end_call();
+}
+static PFNGLPOINTPARAMETERIPROC trace_real_glPointParameteri = NULL;
+static void APIENTRY trace_glPointParameteri(GLenum pname, GLint param) {
+	trace_real_glPointParameteri(pname, param);
+	trace_begin_call(391);
+	trace_put(&pname, sizeof(pname));
+	trace_put(&param, sizeof(param));
+	trace_end_call();
+}
+static PFNGLPOINTPARAMETERIVPROC trace_real_glPointParameteriv = NULL;
+static void APIENTRY trace_glPointParameteriv(GLenum pname, const GLint *params) {
+	trace_real_glPointParameteriv(pname, params);
+	trace_begin_call(392);
+	trace_put(&pname, sizeof(pname));
+	trace_put_data(params, params == NULL ? 0 : (size_t)(trace_param_count(pname) * sizeof(GLint)));
+	trace_end_call();
+}
+static PFNGLFOGCOORDFPROC trace_real_glFogCoordf = NULL;
+static void APIENTRY trace_glFogCoordf(GLfloat coord) {
+	trace_real_glFogCoordf(coord);
+	trace_begin_call(393);
+	trace_put(&coord, sizeof(coord));
+	trace_end_call();
+}
+static PFNGLFOGCOORDFVPROC trace_real_glFogCoordfv = NULL;
+static void APIENTRY trace_glFogCoordfv(const GLfloat *coord) {
+	trace_real_glFogCoordfv(coord);
+	trace_begin_call(394);
+	trace_put_unsupported(coord != NULL);
+	trace_end_call();
+}
+static PFNGLFOGCOORDDPROC trace_real_glFogCoordd = NULL;
+static void APIENTRY trace_glFogCoordd(GLdouble coord) {
+	trace_real_glFogCoordd(coord);
+	trace_begin_call(395);
+	trace_put(&coord, sizeof(coord));
+	trace_end_call();
+}
+static PFNGLFOGCOORDDVPROC trace_real_glFogCoorddv = NULL;
+static void APIENTRY trace_glFogCoorddv(const GLdouble *coord) {
+	trace_real_glFogCoorddv(coord);
+	trace_begin_call(396);
+	trace_put_unsupported(coord != NULL);
+	trace_end_call();
+}
+static PFNGLFOGCOORDPOINTERPROC trace_real_glFogCoordPointer = NULL;
+static void APIENTRY trace_glFogCoordPointer(GLenum type, GLsizei stride, const void *pointer) {
+	trace_real_glFogCoordPointer(type, stride, pointer);
+	trace_begin_call(397);
+	trace_put(&type, sizeof(type));
+	trace_put(&stride, sizeof(stride));
+	trace_put_unsupported(pointer != NULL);
+	trace_end_call();
+}
+static PFNGLSECONDARYCOLOR3BPROC trace_real_glSecondaryColor3b = NULL;
+static void APIENTRY trace_glSecondaryColor3b(GLbyte red, GLbyte green, GLbyte blue) {
+	trace_real_glSecondaryColor3b(red, green, blue);
+	trace_begin_call(398);
+	trace_put(&red, sizeof(red));
+	trace_put(&green, sizeof(green));
+	trace_put(&blue, sizeof(blue));
+	trace_end_call();
+}
+static PFNGLSECONDARYCOLOR3BVPROC trace_real_glSecondaryColor3bv = NULL;
+static void APIENTRY trace_glSecondaryColor3bv(const GLbyte *v) {
+	trace_real_glSecondaryColor3bv(v);
+	trace_begin_call(399);
+	trace_put_data(v, v == NULL ? 0 : (size_t)(3 * sizeof(GLbyte)));
+	trace_end_call();
+}
+static PFNGLSECONDARYCOLOR3DPROC trace_real_glSecondaryColor3d = NULL;
+static void APIENTRY trace_glSecondaryColor3d(GLdouble red, GLdouble green, GLdouble blue) {
+	trace_real_glSecondaryColor3d(red, green, blue);
+	trace_begin_call(400);
+	trace_put(&red, sizeof(red));
+	trace_put(&green, sizeof(green));
+	trace_put(&blue, sizeof(blue));
+	trace_end_call();
+}
+static PFNGLSECONDARYCOLOR3DVPROC trace_real_glSecondaryColor3dv = NULL;
+static void APIENTRY trace_glSecondaryColor3dv(const GLdouble *v) {
+	trace_real_glSecondaryColor3dv(v);
+	trace_begin_call(401);
+	trace_put_data(v, v == NULL ? 0 : (size_t)(3 * sizeof(GLdouble)));
+	trace_end_call();
+}
+static PFNGLSECONDARYCOLOR3FPROC trace_real_glSecondaryColor3f = NULL;
+static void APIENTRY trace_glSecondaryColor3f(GLfloat red, GLfloat green, GLfloat blue) {
+	trace_real_glSecondaryColor3f(red, green, blue);
+	trace_begin_call(402);
+	trace_put(&red, sizeof(red));
+	trace_put(&green, sizeof(green));
+	trace_put(&blue, sizeof(blue));
+	trace_end_call();
+}
+static PFNGLSECONDARYCOLOR3FVPROC trace_real_glSecondaryColor3fv = NULL;
+static void APIENTRY trace_glSecondaryColor3fv(const GLfloat *v) {
+	trace_real_glSecondaryColor3fv(v);
+	trace_begin_call(403);
+	trace_put_data(v, v == NULL ? 0 : (size_t)(3 * sizeof(GLfloat)));
+	trace_end_call();
+}
+static PFNGLSECONDARYCOLOR3IPROC trace_real_glSecondaryColor3i = NULL;
+static void APIENTRY trace_glSecondaryColor3i(GLint red, GLint green, GLint blue) {
+	trace_real_glSecondaryColor3i(red, green, blue);
+	trace_begin_call(404);
+	trace_put(&red, sizeof(red));
+	trace_put(&green, sizeof(green));
+	trace_put(&blue, sizeof(blue));
+	trace_end_call();
+}
+static PFNGLSECONDARYCOLOR3IVPROC trace_real_glSecondaryColor3iv = NULL;
+static void APIENTRY trace_glSecondaryColor3iv(const GLint *v) {
+	trace_real_glSecondaryColor3iv(v);
+	trace_begin_call(405);
+	trace_put_data(v, v == NULL ? 0 : (size_t)(3 * sizeof(GLint)));
+	trace_end_call();
+}
+static PFNGLSECONDARYCOLOR3SPROC trace_real_glSecondaryColor3s = NULL;
+static void APIENTRY trace_glSecondaryColor3s(GLshort red, GLshort green, GLshort blue) {
+	trace_real_glSecondaryColor3s(red, green, blue);
+	trace_begin_call(406);
+	trace_put(&red, sizeof(red));
+	trace_put(&green, sizeof(green));
+	trace_put(&blue, sizeof(blue));
+	trace_end_call();
+}
+static PFNGLSECONDARYCOLOR3SVPROC trace_real_glSecondaryColor3sv = NULL;
+static void APIENTRY trace_glSecondaryColor3sv(const GLshort *v) {
+	trace_real_glSecondaryColor3sv(v);
+	trace_begin_call(407);
+	trace_put_data(v, v == NULL ? 0 : (size_t)(3 * sizeof(GLshort)));
+	trace_end_call();
+}
+static PFNGLSECONDARYCOLOR3UBPROC trace_real_glSecondaryColor3ub = NULL;
+static void APIENTRY trace_glSecondaryColor3ub(GLubyte red, GLubyte green, GLubyte blue) {
+	trace_real_glSecondaryColor3ub(red, green, blue);
+	trace_begin_call(408);
+	trace_put(&red, sizeof(red));
+	trace_put(&green, sizeof(green));
+	trace_put(&blue, sizeof(blue));
+	trace_end_call();
+}
+static PFNGLSECONDARYCOLOR3UBVPROC trace_real_glSecondaryColor3ubv = NULL;
+static void APIENTRY trace_glSecondaryColor3ubv(const GLubyte *v) {
+	trace_real_glSecondaryColor3ubv(v);
+	trace_begin_call(409);
+	trace_put_data(v, v == NULL ? 0 : (size_t)(3 * sizeof(GLubyte)));
+	trace_end_call();
+}
+static PFNGLSECONDARYCOLOR3UIPROC trace_real_glSecondaryColor3ui = NULL;
+static void APIENTRY trace_glSecondaryColor3ui(GLuint red, GLuint green, GLuint blue) {
+	trace_real_glSecondaryColor3ui(red, green, blue);
+	trace_begin_call(410);
+	trace_put(&red, sizeof(red));
+	trace_put(&green, sizeof(green));
+	trace_put(&blue, sizeof(blue));
+	trace_end_call();
+}
+static PFNGLSECONDARYCOLOR3UIVPROC trace_real_glSecondaryColor3uiv = NULL;
+static void APIENTRY trace_glSecondaryColor3uiv(const GLuint *v) {
+	trace_real_glSecondaryColor3uiv(v);
+	trace_begin_call(411);
+	trace_put_data(v, v == NULL ? 0 : (size_t)(3 * sizeof(GLuint)));
+	trace_end_call();
+}
+static PFNGLSECONDARYCOLOR3USPROC trace_real_glSecondaryColor3us = NULL;
+static void APIENTRY trace_glSecondaryColor3us(GLushort red, GLushort green, GLushort blue) {
+	trace_real_glSecondaryColor3us(red, green, blue);
+	trace_begin_call(412);
+	trace_put(&red, sizeof(red));
+	trace_put(&green, sizeof(green));
+	trace_put(&blue, sizeof(blue));
+	trace_end_call();
+}
+static PFNGLSECONDARYCOLOR3USVPROC trace_real_glSecondaryColor3usv = NULL;
+static void APIENTRY trace_glSecondaryColor3usv(const GLushort *v) {
+	trace_real_glSecondaryColor3usv(v);
+	trace_begin_call(413);
+	trace_put_data(v, v == NULL ? 0 : (size_t)(3 * sizeof(GLushort)));
+	trace_end_call();
+}
+static PFNGLSECONDARYCOLORPOINTERPROC trace_real_glSecondaryColorPointer = NULL;
+static void APIENTRY trace_glSecondaryColorPointer(GLint size, GLenum type, GLsizei stride, const void *pointer) {
+	trace_real_glSecondaryColorPointer(size, type, stride, pointer);
+	trace_begin_call(414);
+	trace_put(&size, sizeof(size));
+	trace_put(&type, sizeof(type));
+	trace_put(&stride, sizeof(stride));
+	trace_put_unsupported(pointer != NULL);
+	trace_end_call();
+}
+static PFNGLWINDOWPOS2DPROC trace_real_glWindowPos2d = NULL;
+static void APIENTRY trace_glWindowPos2d(GLdouble x, GLdouble y) {
+	trace_real_glWindowPos2d(x, y);
+	trace_begin_call(415);
+	trace_put(&x, sizeof(x));
+	trace_put(&y, sizeof(y));
+	trace_end_call();
+}
+static PFNGLWINDOWPOS2DVPROC trace_real_glWindowPos2dv = NULL;
+static void APIENTRY trace_glWindowPos2dv(const GLdouble *v) {
+	trace_real_glWindowPos2dv(v);
+	trace_begin_call(416);
+	trace_put_data(v, v == NULL ? 0 : (size_t)(2 * sizeof(GLdouble)));
+	trace_end_call();
+}
+static PFNGLWINDOWPOS2FPROC trace_real_glWindowPos2f = NULL;
+static void APIENTRY trace_glWindowPos2f(GLfloat x, GLfloat y) {
+	trace_real_glWindowPos2f(x, y);
+	trace_begin_call(417);
+	trace_put(&x, sizeof(x));
+	trace_put(&y, sizeof(y));
+	trace_end_call();
+}
+static PFNGLWINDOWPOS2FVPROC trace_real_glWindowPos2fv = NULL;
+static void APIENTRY trace_glWindowPos2fv(const GLfloat *v) {
+	trace_real_glWindowPos2fv(v);
+	trace_begin_call(418);
+	trace_put_data(v, v == NULL ? 0 : (size_t)(2 * sizeof(GLfloat)));
+	trace_end_call();
+}
+static PFNGLWINDOWPOS2IPROC trace_real_glWindowPos2i = NULL;
+static void APIENTRY trace_glWindowPos2i(GLint x, GLint y) {
+	trace_real_glWindowPos2i(x, y);
+	trace_begin_call(419);
+	trace_put(&x, sizeof(x));
+	trace_put(&y, sizeof(y));
+	trace_end_call();
+}
+static PFNGLWINDOWPOS2IVPROC trace_real_glWindowPos2iv = NULL;
+static void APIENTRY trace_glWindowPos2iv(const GLint *v) {
+	trace_real_glWindowPos2iv(v);
+	trace_begin_call(420);
+	trace_put_data(v, v == NULL ? 0 : (size_t)(2 * sizeof(GLint)));
+	trace_end_call();
+}
+static PFNGLWINDOWPOS2SPROC trace_real_glWindowPos2s = NULL;
+static void APIENTRY trace_glWindowPos2s(GLshort x, GLshort y) {
+	trace_real_glWindowPos2s(x, y);
+	trace_begin_call(421);
+	trace_put(&x, sizeof(x));
+	trace_put(&y, sizeof(y));
+	trace_end_call();
+}
+static PFNGLWINDOWPOS2SVPROC trace_real_glWindowPos2sv = NULL;
+static void APIENTRY trace_glWindowPos2sv(const GLshort *v) {
+	trace_real_glWindowPos2sv(v);
+	trace_begin_call(422);
+	trace_put_data(v, v == NULL ? 0 : (size_t)(2 * sizeof(GLshort)));
+	trace_end_call();
+}
+static PFNGLWINDOWPOS3DPROC trace_real_glWindowPos3d = NULL;
+static void APIENTRY trace_glWindowPos3d(GLdouble x, GLdouble y, GLdouble z) {
+	trace_real_glWindowPos3d(x, y, z);
+	trace_begin_call(423);
+	trace_put(&x, sizeof(x));
+	trace_put(&y, sizeof(y));
+	trace_put(&z, sizeof(z));
+	trace_end_call();
+}
+static PFNGLWINDOWPOS3DVPROC trace_real_glWindowPos3dv = NULL;
+static void APIENTRY trace_glWindowPos3dv(const GLdouble *v) {
+	trace_real_glWindowPos3dv(v);
+	trace_begin_call(424);
+	trace_put_data(v, v == NULL ? 0 : (size_t)(3 * sizeof(GLdouble)));
+	trace_end_call();
+}
+static PFNGLWINDOWPOS3FPROC trace_real_glWindowPos3f = NULL;
+static void APIENTRY trace_glWindowPos3f(GLfloat x, GLfloat y, GLfloat z) {
+	trace_real_glWindowPos3f(x, y, z);
+	trace_begin_call(425);
+	trace_put(&x, sizeof(x));
+	trace_put(&y, sizeof(y));
+	trace_put(&z, sizeof(z));
+	trace_end_call();
+}
+static PFNGLWINDOWPOS3FVPROC trace_real_glWindowPos3fv = NULL;
+static void APIENTRY trace_glWindowPos3fv(const GLfloat *v) {
+	trace_real_glWindowPos3fv(v);
+	trace_begin_call(426);
+	trace_put_data(v, v == NULL ? 0 : (size_t)(3 * sizeof(GLfloat)));
+	trace_end_call();
+}
+static PFNGLWINDOWPOS3IPROC trace_real_glWindowPos3i = NULL;
+static void APIENTRY trace_glWindowPos3i(GLint x, GLint y, GLint z) {
+	trace_real_glWindowPos3i(x, y, z);
+	trace_begin_call(427);
+	trace_put(&x, sizeof(x));
+	trace_put(&y, sizeof(y));
+	trace_put(&z, sizeof(z));
+	trace_end_call();
+}
+static PFNGLWINDOWPOS3IVPROC trace_real_glWindowPos3iv = NULL;
+static void APIENTRY trace_glWindowPos3iv(const GLint *v) {
+	trace_real_glWindowPos3iv(v);
+	trace_begin_call(428);
+	trace_put_data(v, v == NULL ? 0 : (size_t)(3 * sizeof(GLint)));
+	trace_end_call();
+}
+static PFNGLWINDOWPOS3SPROC trace_real_glWindowPos3s = NULL;
+static void APIENTRY trace_glWindowPos3s(GLshort x, GLshort y, GLshort z) {
+	trace_real_glWindowPos3s(x, y, z);
+	trace_begin_call(429);
+	trace_put(&x, sizeof(x));
+	trace_put(&y, sizeof(y));
+	trace_put(&z, sizeof(z));
+	trace_end_call();
+}
+static PFNGLWINDOWPOS3SVPROC trace_real_glWindowPos3sv = NULL;
+static void APIENTRY trace_glWindowPos3sv(const GLshort *v) {
+	trace_real_glWindowPos3sv(v);
+	trace_begin_call(430);
+	trace_put_data(v, v == NULL ? 0 : (size_t)(3 * sizeof(GLshort)));
+	trace_end_call();
+}
+static PFNGLBLENDCOLORPROC trace_real_glBlendColor = NULL;
+static void APIENTRY trace_glBlendColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) {
+	trace_real_glBlendColor(red, green, blue, alpha);
+	trace_begin_call(431);
+	trace_put(&red, sizeof(red));
+	trace_put(&green, sizeof(green));
+	trace_put(&blue, sizeof(blue));
+	trace_put(&alpha, sizeof(alpha));
+	trace_end_call();
+}
+static PFNGLBLENDEQUATIONPROC trace_real_glBlendEquation = NULL;
+static void APIENTRY trace_glBlendEquation(GLenum mode) {
+	trace_real_glBlendEquation(mode);
+	trace_begin_call(432);
+	trace_put(&mode, sizeof(mode));
+	trace_end_call();
+}
+static PFNGLGENQUERIESPROC trace_real_glGenQueries = NULL;
+static void APIENTRY trace_glGenQueries(GLsizei n, GLuint *ids) {
+	trace_real_glGenQueries(n, ids);
+	trace_begin_call(433);
+	trace_put(&n, sizeof(n));
+	trace_put_data(ids, ids == NULL ? 0 : (size_t)n * sizeof(GLuint));
+	trace_end_call();
+}
+static PFNGLDELETEQUERIESPROC trace_real_glDeleteQueries = NULL;
+static void APIENTRY trace_glDeleteQueries(GLsizei n, const GLuint *ids) {
+	trace_real_glDeleteQueries(n, ids);
+	trace_begin_call(434);
+	trace_put(&n, sizeof(n));
+	trace_put_data(ids, ids == NULL ? 0 : (size_t)n * sizeof(GLuint));
+	trace_end_call();
+}
+static PFNGLISQUERYPROC trace_real_glIsQuery = NULL;
+static GLboolean APIENTRY trace_glIsQuery(GLuint id) {
+	GLboolean glad_result;
+	glad_result = trace_real_glIsQuery(id);
+	trace_begin_call(435);
+	trace_put(&id, sizeof(id));
+	trace_put(&glad_result, sizeof(glad_result));
+	trace_end_call();
+	return glad_result;
+}
+static PFNGLBEGINQUERYPROC trace_real_glBeginQuery = NULL;
+static void APIENTRY trace_glBeginQuery(GLenum target, GLuint id) {
+	trace_real_glBeginQuery(target, id);
+	trace_begin_call(436);
+	trace_put(&target, sizeof(target));
+	trace_put(&id, sizeof(id));
+	trace_end_call();
+}
+static PFNGLENDQUERYPROC trace_real_glEndQuery = NULL;
+static void APIENTRY trace_glEndQuery(GLenum target) {
+	trace_real_glEndQuery(target);
+	trace_begin_call(437);
+	trace_put(&target, sizeof(target));
+	trace_end_call();
+}
+static PFNGLGETQUERYIVPROC trace_real_glGetQueryiv = NULL;
+static void APIENTRY trace_glGetQueryiv(GLenum target, GLenum pname, GLint *params) {
+	trace_real_glGetQueryiv(target, pname, params);
+	trace_begin_call(438);
+	trace_put(&target, sizeof(target));
+	trace_put(&pname, sizeof(pname));
+	trace_end_call();
+}
+static PFNGLGETQUERYOBJECTIVPROC trace_real_glGetQueryObjectiv = NULL;
+static void APIENTRY trace_glGetQueryObjectiv(GLuint id, GLenum pname, GLint *params) {
+	trace_real_glGetQueryObjectiv(id, pname, params);
+	trace_begin_call(439);
+	trace_put(&id, sizeof(id));
+	trace_put(&pname, sizeof(pname));
+	trace_end_call();
+}
+static PFNGLGETQUERYOBJECTUIVPROC trace_real_glGetQueryObjectuiv = NULL;
+static void APIENTRY trace_glGetQueryObjectuiv(GLuint id, GLenum pname, GLuint *params) {
+	trace_real_glGetQueryObjectuiv(id, pname, params);
+	trace_begin_call(440);
+	trace_put(&id, sizeof(id));
+	trace_put(&pname, sizeof(pname));
+	trace_end_call();
+}
+static PFNGLBINDBUFFERPROC trace_real_glBindBuffer = NULL;
+static void APIENTRY trace_glBindBuffer(GLenum target, GLuint buffer) {
+	trace_real_glBindBuffer(target, buffer);
+	trace_begin_call(441);
+	trace_put(&target, sizeof(target));
+	trace_put(&buffer, sizeof(buffer));
+	trace_end_call();
+	trace_hook_bind_buffer(target, buffer);
+}
+static PFNGLDELETEBUFFERSPROC trace_real_glDeleteBuffers = NULL;
+static void APIENTRY trace_glDeleteBuffers(GLsizei n, const GLuint *buffers) {
+	trace_real_glDeleteBuffers(n, buffers);
+	trace_begin_call(442);
+	trace_put(&n, sizeof(n));
+	trace_put_data(buffers, buffers == NULL ? 0 : (size_t)n * sizeof(GLuint));
+	trace_end_call();
+}
+static PFNGLGENBUFFERSPROC trace_real_glGenBuffers = NULL;
+static void APIENTRY trace_glGenBuffers(GLsizei n, GLuint *buffers) {
+	trace_real_glGenBuffers(n, buffers);
+	trace_begin_call(443);
+	trace_put(&n, sizeof(n));
+	trace_put_data(buffers, buffers == NULL ? 0 : (size_t)n * sizeof(GLuint));
+	trace_end_call();
+}
+static PFNGLISBUFFERPROC trace_real_glIsBuffer = NULL;
+static GLboolean APIENTRY trace_glIsBuffer(GLuint buffer) {
+	GLboolean glad_result;
+	glad_result = trace_real_glIsBuffer(buffer);
+	trace_begin_call(444);
+	trace_put(&buffer, sizeof(buffer));
+	trace_put(&glad_result, sizeof(glad_result));
+	trace_end_call();
+	return glad_result;
+}
+static PFNGLBUFFERDATAPROC trace_real_glBufferData = NULL;
+static void APIENTRY trace_glBufferData(GLenum target, GLsizeiptr size, const void *data, GLenum usage) {
+	trace_real_glBufferData(target, size, data, usage);
+	trace_begin_call(445);
+	trace_put(&target, sizeof(target));
+	trace_put(&size, sizeof(size));
+	trace_put_data(data, data == NULL ? 0 : (size_t)(size));
+	trace_put(&usage, sizeof(usage));
+	trace_end_call();
+}
+static PFNGLBUFFERSUBDATAPROC trace_real_glBufferSubData = NULL;
+static void APIENTRY trace_glBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const void *data) {
+	trace_real_glBufferSubData(target, offset, size, data);
+	trace_begin_call(446);
+	trace_put(&target, sizeof(target));
+	trace_put(&offset, sizeof(offset));
+	trace_put(&size, sizeof(size));
+	trace_put_data(data, data == NULL ? 0 : (size_t)(size));
+	trace_end_call();
+}
+static PFNGLGETBUFFERSUBDATAPROC trace_real_glGetBufferSubData = NULL;
+static void APIENTRY trace_glGetBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, void *data) {
+	trace_real_glGetBufferSubData(target, offset, size, data);
+	trace_begin_call(447);
+	trace_put(&target, sizeof(target));
+	trace_put(&offset, sizeof(offset));
+	trace_put(&size, sizeof(size));
+	trace_end_call();
+}
+static PFNGLMAPBUFFERPROC trace_real_glMapBuffer = NULL;
+static void * APIENTRY trace_glMapBuffer(GLenum target, GLenum access) {
+	void * glad_result;
+	glad_result = trace_real_glMapBuffer(target, access);
+	trace_begin_call(448);
+	trace_put(&target, sizeof(target));
+	trace_put(&access, sizeof(access));
+	trace_end_call();
+	trace_hook_map(target, glad_result, 0, -1, access == GL_READ_ONLY ? GL_MAP_READ_BIT : GL_MAP_WRITE_BIT);
+	return glad_result;
+}
+static PFNGLUNMAPBUFFERPROC trace_real_glUnmapBuffer = NULL;
+static GLboolean APIENTRY trace_glUnmapBuffer(GLenum target) {
+	GLboolean glad_result;
+	trace_hook_unmap(target);
+	glad_result = trace_real_glUnmapBuffer(target);
+	trace_begin_call(449);
+	trace_put(&target, sizeof(target));
+	trace_put(&glad_result, sizeof(glad_result));
+	trace_end_call();
+	return glad_result;
+}
+static PFNGLGETBUFFERPARAMETERIVPROC trace_real_glGetBufferParameteriv = NULL;
+static void APIENTRY trace_glGetBufferParameteriv(GLenum target, GLenum pname, GLint *params) {
+	trace_real_glGetBufferParameteriv(target, pname, params);
+	trace_begin_call(450);
+	trace_put(&target, sizeof(target));
+	trace_put(&pname, sizeof(pname));
+	trace_end_call();
+}
+static PFNGLGETBUFFERPOINTERVPROC trace_real_glGetBufferPointerv = NULL;
+static void APIENTRY trace_glGetBufferPointerv(GLenum target, GLenum pname, void **params) {
+	trace_real_glGetBufferPointerv(target, pname, params);
+	trace_begin_call(451);
+	trace_put(&target, sizeof(target));
+	trace_put(&pname, sizeof(pname));
+	trace_end_call();
+}
+static PFNGLBLENDEQUATIONSEPARATEPROC trace_real_glBlendEquationSeparate = NULL;
+static void APIENTRY trace_glBlendEquationSeparate(GLenum modeRGB, GLenum modeAlpha) {
+	trace_real_glBlendEquationSeparate(modeRGB, modeAlpha);
+	trace_begin_call(452);
+	trace_put(&modeRGB, sizeof(modeRGB));
+	trace_put(&modeAlpha, sizeof(modeAlpha));
+	trace_end_call();
+}
+static PFNGLDRAWBUFFERSPROC trace_real_glDrawBuffers = NULL;
+static void APIENTRY trace_glDrawBuffers(GLsizei n, const GLenum *bufs) {
+	trace_real_glDrawBuffers(n, bufs);
+	trace_begin_call(453);
+	trace_put(&n, sizeof(n));
+	trace_put_data(bufs, bufs == NULL ? 0 : (size_t)(n * sizeof(GLenum)));
+	trace_end_call();
+}
+static PFNGLSTENCILOPSEPARATEPROC trace_real_glStencilOpSeparate = NULL;
+static void APIENTRY trace_glStencilOpSeparate(GLenum face, GLenum sfail, GLenum dpfail, GLenum dppass) {
+	trace_real_glStencilOpSeparate(face, sfail, dpfail, dppass);
+	trace_begin_call(454);
+	trace_put(&face, sizeof(face));
+	trace_put(&sfail, sizeof(sfail));
+	trace_put(&dpfail, sizeof(dpfail));
+	trace_put(&dppass, sizeof(dppass));
+	trace_end_call();
+}
+static PFNGLSTENCILFUNCSEPARATEPROC trace_real_glStencilFuncSeparate = NULL;
+static void APIENTRY trace_glStencilFuncSeparate(GLenum face, GLenum func, GLint ref, GLuint mask) {
+	trace_real_glStencilFuncSeparate(face, func, ref, mask);
+	trace_begin_call(455);
+	trace_put(&face, sizeof(face));
+	trace_put(&func, sizeof(func));
+	trace_put(&ref, sizeof(ref));
+	trace_put(&mask, sizeof(mask));
+	trace_end_call();
+}
+static PFNGLSTENCILMASKSEPARATEPROC trace_real_glStencilMaskSeparate = NULL;
+static void APIENTRY trace_glStencilMaskSeparate(GLenum face, GLuint mask) {
+	trace_real_glStencilMaskSeparate(face, mask);
+	trace_begin_call(456);
+	trace_put(&face, sizeof(face));
+	trace_put(&mask, sizeof(mask));
+	trace_end_call();
+}
+static PFNGLATTACHSHADERPROC trace_real_glAttachShader = NULL;
+static void APIENTRY trace_glAttachShader(GLuint program, GLuint shader) {
+	trace_real_glAttachShader(program, shader);
+	trace_begin_call(457);
+	trace_put(&program, sizeof(program));
+	trace_put(&shader, sizeof(shader));
+	trace_end_call();
+}
+static PFNGLBINDATTRIBLOCATIONPROC trace_real_glBindAttribLocation = NULL;
+static void APIENTRY trace_glBindAttribLocation(GLuint program, GLuint index, const GLchar *name) {
+	trace_real_glBindAttribLocation(program, index, name);
+	trace_begin_call(458);
+	trace_put(&program, sizeof(program));
+	trace_put(&index, sizeof(index));
+	trace_put_string(name, -1);
+	trace_end_call();
+}
+static PFNGLCOMPILESHADERPROC trace_real_glCompileShader = NULL;
+static void APIENTRY trace_glCompileShader(GLuint shader) {
+	trace_real_glCompileShader(shader);
+	trace_begin_call(459);
+	trace_put(&shader, sizeof(shader));
+	trace_end_call();
+}
+static PFNGLCREATEPROGRAMPROC trace_real_glCreateProgram = NULL;
+static GLuint APIENTRY trace_glCreateProgram(void) {
+	GLuint glad_result;
+	glad_result = trace_real_glCreateProgram();
+	trace_begin_call(460);
+	trace_put(&glad_result, sizeof(glad_result));
+	trace_end_call();
+	return glad_result;
+}
+static PFNGLCREATESHADERPROC trace_real_glCreateShader = NULL;
+static GLuint APIENTRY trace_glCreateShader(GLenum type) {
+	GLuint glad_result;
+	glad_result = trace_real_glCreateShader(type);
+	trace_begin_call(461);
+	trace_put(&type, sizeof(type));
+	trace_put(&glad_result, sizeof(glad_result));
+	trace_end_call();
+	return glad_result;
+}
+static PFNGLDELETEPROGRAMPROC trace_real_glDeleteProgram = NULL;
+static void APIENTRY trace_glDeleteProgram(GLuint program) {
+	trace_real_glDeleteProgram(program);
+	trace_begin_call(462);
+	trace_put(&program, sizeof(program));
+	trace_end_call();
+}
+static PFNGLDELETESHADERPROC trace_real_glDeleteShader = NULL;
+static void APIENTRY trace_glDeleteShader(GLuint shader) {
+	trace_real_glDeleteShader(shader);
+	trace_begin_call(463);
+	trace_put(&shader, sizeof(shader));
+	trace_end_call();
+}
+static PFNGLDETACHSHADERPROC trace_real_glDetachShader = NULL;
+static void APIENTRY trace_glDetachShader(GLuint program, GLuint shader) {
+	trace_real_glDetachShader(program, shader);
+	trace_begin_call(464);
+	trace_put(&program, sizeof(program));
+	trace_put(&shader, sizeof(shader));
+	trace_end_call();
+}
+static PFNGLDISABLEVERTEXATTRIBARRAYPROC trace_real_glDisableVertexAttribArray = NULL;
+static void APIENTRY trace_glDisableVertexAttribArray(GLuint index) {
+	trace_real_glDisableVertexAttribArray(index);
+	trace_begin_call(465);
+	trace_put(&index, sizeof(index));
+	trace_end_call();
+}
+static PFNGLENABLEVERTEXATTRIBARRAYPROC trace_real_glEnableVertexAttribArray = NULL;
+static void APIENTRY trace_glEnableVertexAttribArray(GLuint index) {
+	trace_real_glEnableVertexAttribArray(index);
+	trace_begin_call(466);
+	trace_put(&index, sizeof(index));
+	trace_end_call();
+}
+static PFNGLGETACTIVEATTRIBPROC trace_real_glGetActiveAttrib = NULL;
+static void APIENTRY trace_glGetActiveAttrib(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name) {
+	trace_real_glGetActiveAttrib(program, index, bufSize, length, size, type, name);
+	trace_begin_call(467);
+	trace_put(&program, sizeof(program));
+	trace_put(&index, sizeof(index));
+	trace_put(&bufSize, sizeof(bufSize));
+	trace_end_call();
+}
+static PFNGLGETACTIVEUNIFORMPROC trace_real_glGetActiveUniform = NULL;
+static void APIENTRY trace_glGetActiveUniform(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name) {
+	trace_real_glGetActiveUniform(program, index, bufSize, length, size, type, name);
+	trace_begin_call(468);
+	trace_put(&program, sizeof(program));
+	trace_put(&index, sizeof(index));
+	trace_put(&bufSize, sizeof(bufSize));
+	trace_end_call();
+}
+static PFNGLGETATTACHEDSHADERSPROC trace_real_glGetAttachedShaders = NULL;
+static void APIENTRY trace_glGetAttachedShaders(GLuint program, GLsizei maxCount, GLsizei *count, GLuint *shaders) {
+	trace_real_glGetAttachedShaders(program, maxCount, count, shaders);
+	trace_begin_call(469);
+	trace_put(&program, sizeof(program));
+	trace_put(&maxCount, sizeof(maxCount));
+	trace_end_call();
+}
+static PFNGLGETATTRIBLOCATIONPROC trace_real_glGetAttribLocation = NULL;
+static GLint APIENTRY trace_glGetAttribLocation(GLuint program, const GLchar *name) {
+	GLint glad_result;
+	glad_result = trace_real_glGetAttribLocation(program, name);
+	trace_begin_call(470);
+	trace_put(&program, sizeof(program));
+	trace_put_string(name, -1);
+	trace_put(&glad_result, sizeof(glad_result));
+	trace_end_call();
+	return glad_result;
+}
+static PFNGLGETPROGRAMIVPROC trace_real_glGetProgramiv = NULL;
+static void APIENTRY trace_glGetProgramiv(GLuint program, GLenum pname, GLint *params) {
+	trace_real_glGetProgramiv(program, pname, params);
+	trace_begin_call(471);
+	trace_put(&program, sizeof(program));
+	trace_put(&pname, sizeof(pname));
+	trace_end_call();
+}
+static PFNGLGETPROGRAMINFOLOGPROC trace_real_glGetProgramInfoLog = NULL;
+static void APIENTRY trace_glGetProgramInfoLog(GLuint program, GLsizei bufSize, GLsizei *length, GLchar *infoLog) {
+	trace_real_glGetProgramInfoLog(program, bufSize, length, infoLog);
+	trace_begin_call(472);
+	trace_put(&program, sizeof(program));
+	trace_put(&bufSize, sizeof(bufSize));
+	trace_end_call();
+}
+static PFNGLGETSHADERIVPROC trace_real_glGetShaderiv = NULL;
+static void APIENTRY trace_glGetShaderiv(GLuint shader, GLenum pname, GLint *params) {
+	trace_real_glGetShaderiv(shader, pname, params);
+	trace_begin_call(473);
+	trace_put(&shader, sizeof(shader));
+	trace_put(&pname, sizeof(pname));
+	trace_end_call();
+}
+static PFNGLGETSHADERINFOLOGPROC trace_real_glGetShaderInfoLog = NULL;
+static void APIENTRY trace_glGetShaderInfoLog(GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *infoLog) {
+	trace_real_glGetShaderInfoLog(shader, bufSize, length, infoLog);
+	trace_begin_call(474);
+	trace_put(&shader, sizeof(shader));
+	trace_put(&bufSize, sizeof(bufSize));
+	trace_end_call();
+}
+static PFNGLGETSHADERSOURCEPROC trace_real_glGetShaderSource = NULL;
+static void APIENTRY trace_glGetShaderSource(GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *source) {
+	trace_real_glGetShaderSource(shader, bufSize, length, source);
+	trace_begin_call(475);
+	trace_put(&shader, sizeof(shader));
+	trace_put(&bufSize, sizeof(bufSize));
+	trace_end_call();
+}
+static PFNGLGETUNIFORMLOCATIONPROC trace_real_glGetUniformLocation = NULL;
+static GLint APIENTRY trace_glGetUniformLocation(GLuint program, const GLchar *name) {
+	GLint glad_result;
+	glad_result = trace_real_glGetUniformLocation(program, name);
+	trace_begin_call(476);
+	trace_put(&program, sizeof(program));
+	trace_put_string(name, -1);
+	trace_put(&glad_result, sizeof(glad_result));
+	trace_end_call();
+	return glad_result;
+}
+static PFNGLGETUNIFORMFVPROC trace_real_glGetUniformfv = NULL;
+static void APIENTRY trace_glGetUniformfv(GLuint program, GLint location, GLfloat *params) {
+	trace_real_glGetUniformfv(program, location, params);
+	trace_begin_call(477);
+	trace_put(&program, sizeof(program));
+	trace_put(&location, sizeof(location));
+	trace_end_call();
+}
+static PFNGLGETUNIFORMIVPROC trace_real_glGetUniformiv = NULL;
+static void APIENTRY trace_glGetUniformiv(GLuint program, GLint location, GLint *params) {
+	trace_real_glGetUniformiv(program, location, params);
+	trace_begin_call(478);
+	trace_put(&program, sizeof(program));
+	trace_put(&location, sizeof(location));
+	trace_end_call();
+}
+static PFNGLGETVERTEXATTRIBDVPROC trace_real_glGetVertexAttribdv = NULL;
+static void APIENTRY trace_glGetVertexAttribdv(GLuint index, GLenum pname, GLdouble *params) {
+	trace_real_glGetVertexAttribdv(index, pname, params);
+	trace_begin_call(479);
+	trace_put(&index, sizeof(index));
+	trace_put(&pname, sizeof(pname));
+	trace_end_call();
+}
+static PFNGLGETVERTEXATTRIBFVPROC trace_real_glGetVertexAttribfv = NULL;
+static void APIENTRY trace_glGetVertexAttribfv(GLuint index, GLenum pname, GLfloat *params) {
+	trace_real_glGetVertexAttribfv(index, pname, params);
+	trace_begin_call(480);
+	trace_put(&index, sizeof(index));
+	trace_put(&pname, sizeof(pname));
+	trace_end_call();
+}
+static PFNGLGETVERTEXATTRIBIVPROC trace_real_glGetVertexAttribiv = NULL;
+static void APIENTRY trace_glGetVertexAttribiv(GLuint index, GLenum pname, GLint *params) {
+	trace_real_glGetVertexAttribiv(index, pname, params);
+	trace_begin_call(481);
+	trace_put(&index, sizeof(index));
+	trace_put(&pname, sizeof(pname));
+	trace_end_call();
+}
+static PFNGLGETVERTEXATTRIBPOINTERVPROC trace_real_glGetVertexAttribPointerv = NULL;
+static void APIENTRY trace_glGetVertexAttribPointerv(GLuint index, GLenum pname, void **pointer) {
+	trace_real_glGetVertexAttribPointerv(index, pname, pointer);
+	trace_begin_call(482);
+	trace_put(&index, sizeof(index));
+	trace_put(&pname, sizeof(pname));
+	trace_end_call();
+}
+static PFNGLISPROGRAMPROC trace_real_glIsProgram = NULL;
+static GLboolean APIENTRY trace_glIsProgram(GLuint program) {
+	GLboolean glad_result;
+	glad_result = trace_real_glIsProgram(program);
+	trace_begin_call(483);
+	trace_put(&program, sizeof(program));
+	trace_put(&glad_result, sizeof(glad_result));
+	trace_end_call();
+	return glad_result;
+}
+static PFNGLISSHADERPROC trace_real_glIsShader = NULL;
+static GLboolean APIENTRY trace_glIsShader(GLuint shader) {
+	GLboolean glad_result;
+	glad_result = trace_real_glIsShader(shader);
+	trace_begin_call(484);
+	trace_put(&shader, sizeof(shader));
+	trace_put(&glad_result, sizeof(glad_result));
+	trace_end_call();
+	return glad_result;
+}
+static PFNGLLINKPROGRAMPROC trace_real_glLinkProgram = NULL;
+static void APIENTRY trace_glLinkProgram(GLuint program) {
+	trace_real_glLinkProgram(program);
+	trace_begin_call(485);
+	trace_put(&program, sizeof(program));
+	trace_end_call();
+}
+static PFNGLSHADERSOURCEPROC trace_real_glShaderSource = NULL;
+static void APIENTRY trace_glShaderSource(GLuint shader, GLsizei count, const GLchar *const*string, const GLint *length) {
+	trace_real_glShaderSource(shader, count, string, length);
+	trace_begin_call(486);
+	trace_put(&shader, sizeof(shader));
+	trace_put(&count, sizeof(count));
+	trace_put_strings(count, (const GLchar *const*)string, length);
+	trace_end_call();
+}
+static PFNGLUSEPROGRAMPROC trace_real_glUseProgram = NULL;
+static void APIENTRY trace_glUseProgram(GLuint program) {
+	trace_real_glUseProgram(program);
+	trace_begin_call(487);
+	trace_put(&program, sizeof(program));
+	trace_end_call();
+}
+static PFNGLUNIFORM1FPROC trace_real_glUniform1f = NULL;
+static void APIENTRY trace_glUniform1f(GLint location, GLfloat v0) {
+	trace_real_glUniform1f(location, v0);
+	trace_begin_call(488);
+	trace_put(&location, sizeof(location));
+	trace_put(&v0, sizeof(v0));
+	trace_end_call();
+}
+static PFNGLUNIFORM2FPROC trace_real_glUniform2f = NULL;
+static void APIENTRY trace_glUniform2f(GLint location, GLfloat v0, GLfloat v1) {
+	trace_real_glUniform2f(location, v0, v1);
+	trace_begin_call(489);
+	trace_put(&location, sizeof(location));
+	trace_put(&v0, sizeof(v0));
+	trace_put(&v1, sizeof(v1));
+	trace_end_call();
+}
+static PFNGLUNIFORM3FPROC trace_real_glUniform3f = NULL;
+static void APIENTRY trace_glUniform3f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2) {
+	trace_real_glUniform3f(location, v0, v1, v2);
+	trace_begin_call(490);
+	trace_put(&location, sizeof(location));
+	trace_put(&v0, sizeof(v0));
+	trace_put(&v1, sizeof(v1));
+	trace_put(&v2, sizeof(v2));
+	trace_end_call();
+}
+static PFNGLUNIFORM4FPROC trace_real_glUniform4f = NULL;
+static void APIENTRY trace_glUniform4f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3) {
+	trace_real_glUniform4f(location, v0, v1, v2, v3);
+	trace_begin_call(491);
+	trace_put(&location, sizeof(location));
+	trace_put(&v0, sizeof(v0));
+	trace_put(&v1, sizeof(v1));
+	trace_put(&v2, sizeof(v2));
+	trace_put(&v3, sizeof(v3));
+	trace_end_call();
+}
+static PFNGLUNIFORM1IPROC trace_real_glUniform1i = NULL;
+static void APIENTRY trace_glUniform1i(GLint location, GLint v0) {
+	trace_real_glUniform1i(location, v0);
+	trace_begin_call(492);
+	trace_put(&location, sizeof(location));
+	trace_put(&v0, sizeof(v0));
+	trace_end_call();
+}
+static PFNGLUNIFORM2IPROC trace_real_glUniform2i = NULL;
+static void APIENTRY trace_glUniform2i(GLint location, GLint v0, GLint v1) {
+	trace_real_glUniform2i(location, v0, v1);
+	trace_begin_call(493);
+	trace_put(&location, sizeof(location));
+	trace_put(&v0, sizeof(v0));
+	trace_put(&v1, sizeof(v1));
+	trace_end_call();
+}
+static PFNGLUNIFORM3IPROC trace_real_glUniform3i = NULL;
+static void APIENTRY trace_glUniform3i(GLint location, GLint v0, GLint v1, GLint v2) {
+	trace_real_glUniform3i(location, v0, v1, v2);
+	trace_begin_call(494);
+	trace_put(&location, sizeof(location));
+	trace_put(&v0, sizeof(v0));
+	trace_put(&v1, sizeof(v1));
+	trace_put(&v2, sizeof(v2));
+	trace_end_call();
+}
+static PFNGLUNIFORM4IPROC trace_real_glUniform4i = NULL;
+static void APIENTRY trace_glUniform4i(GLint location, GLint v0, GLint v1, GLint v2, GLint v3) {
+	trace_real_glUniform4i(location, v0, v1, v2, v3);
+	trace_begin_call(495);
+	trace_put(&location, sizeof(location));
+	trace_put(&v0, sizeof(v0));
+	trace_put(&v1, sizeof(v1));
+	trace_put(&v2, sizeof(v2));
+	trace_put(&v3, sizeof(v3));
+	trace_end_call();
+}
+static PFNGLUNIFORM1FVPROC trace_real_glUniform1fv = NULL;
+static void APIENTRY trace_glUniform1fv(GLint location, GLsizei count, const GLfloat *value) {
+	trace_real_glUniform1fv(location, count, value);
+	trace_begin_call(496);
+	trace_put(&location, sizeof(location));
+	trace_put(&count, sizeof(count));
+	trace_put_data(value, value == NULL ? 0 : (size_t)(count * 1 * sizeof(GLfloat)));
+	trace_end_call();
+}
+static PFNGLUNIFORM2FVPROC trace_real_glUniform2fv = NULL;
+static void APIENTRY trace_glUniform2fv(GLint location, GLsizei count, const GLfloat *value) {
+	trace_real_glUniform2fv(location, count, value);
+	trace_begin_call(497);
+	trace_put(&location, sizeof(location));
+	trace_put(&count, sizeof(count));
+	trace_put_data(value, value == NULL ? 0 : (size_t)(count * 2 * sizeof(GLfloat)));
+	trace_end_call();
+}
+static PFNGLUNIFORM3FVPROC trace_real_glUniform3fv = NULL;
+static void APIENTRY trace_glUniform3fv(GLint location, GLsizei count, const GLfloat *value) {
+	trace_real_glUniform3fv(location, count, value);
+	trace_begin_call(498);
+	trace_put(&location, sizeof(location));
+	trace_put(&count, sizeof(count));
+	trace_put_data(value, value == NULL ? 0 : (size_t)(count * 3 * sizeof(GLfloat)));
+	trace_end_call();
+}
+static PFNGLUNIFORM4FVPROC trace_real_glUniform4fv = NULL;
+static void APIENTRY trace_glUniform4fv(GLint location, GLsizei count, const GLfloat *value) {
+	trace_real_glUniform4fv(location, count, value);
+	trace_begin_call(499);
+	trace_put(&location, sizeof(location));
+	trace_put(&count, sizeof(count));
+	trace_put_data(value, value == NULL ? 0 : (size_t)(count * 4 * sizeof(GLfloat)));
+	trace_end_call();
+}
+static PFNGLUNIFORM1IVPROC trace_real_glUniform1iv = NULL;
+static void APIENTRY trace_glUniform1iv(GLint location, GLsizei count, const GLint *value) {
+	trace_real_glUniform1iv(location, count, value);
+	trace_begin_call(500);
+	trace_put(&location, sizeof(location));
+	trace_put(&count, sizeof(count));
+	trace_put_data(value, value == NULL ? 0 : (size_t)(count * 1 * sizeof(GLint)));
+	trace_end_call();
+}
+static PFNGLUNIFORM2IVPROC trace_real_glUniform2iv = NULL;
+static void APIENTRY trace_glUniform2iv(GLint location, GLsizei count, const GLint *value) {
+	trace_real_glUniform2iv(location, count, value);
+	trace_begin_call(501);
+	trace_put(&location, sizeof(location));
+	trace_put(&count, sizeof(count));
+	trace_put_data(value, value == NULL ? 0 : (size_t)(count * 2 * sizeof(GLint)));
+	trace_end_call();
+}
+static PFNGLUNIFORM3IVPROC trace_real_glUniform3iv = NULL;
+static void APIENTRY trace_glUniform3iv(GLint location, GLsizei count, const GLint *value) {
+	trace_real_glUniform3iv(location, count, value);
+	trace_begin_call(502);
+	trace_put(&location, sizeof(location));
+	trace_put(&count, sizeof(count));
+	trace_put_data(value, value == NULL ? 0 : (size_t)(count * 3 * sizeof(GLint)));
+	trace_end_call();
+}
+static PFNGLUNIFORM4IVPROC trace_real_glUniform4iv = NULL;
+static void APIENTRY trace_glUniform4iv(GLint location, GLsizei count, const GLint *value) {
+	trace_real_glUniform4iv(location, count, value);
+	trace_begin_call(503);
+	trace_put(&location, sizeof(location));
+	trace_put(&count, sizeof(count));
+	trace_put_data(value, value == NULL ? 0 : (size_t)(count * 4 * sizeof(GLint)));
+	trace_end_call();
+}
+static PFNGLUNIFORMMATRIX2FVPROC trace_real_glUniformMatrix2fv = NULL;
+static void APIENTRY trace_glUniformMatrix2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	trace_real_glUniformMatrix2fv(location, count, transpose, value);
+	trace_begin_call(504);
+	trace_put(&location, sizeof(location));
+	trace_put(&count, sizeof(count));
+	trace_put(&transpose, sizeof(transpose));
+	trace_put_data(value, value == NULL ? 0 : (size_t)(count * 2 * 2 * sizeof(GLfloat)));
+	trace_end_call();
+}
+static PFNGLUNIFORMMATRIX3FVPROC trace_real_glUniformMatrix3fv = NULL;
+static void APIENTRY trace_glUniformMatrix3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	trace_real_glUniformMatrix3fv(location, count, transpose, value);
+	trace_begin_call(505);
+	trace_put(&location, sizeof(location));
+	trace_put(&count, sizeof(count));
+	trace_put(&transpose, sizeof(transpose));
+	trace_put_data(value, value == NULL ? 0 : (size_t)(count * 3 * 3 * sizeof(GLfloat)));
+	trace_end_call();
+}
+static PFNGLUNIFORMMATRIX4FVPROC trace_real_glUniformMatrix4fv = NULL;
+static void APIENTRY trace_glUniformMatrix4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	trace_real_glUniformMatrix4fv(location, count, transpose, value);
+	trace_begin_call(506);
+	trace_put(&location, sizeof(location));
+	trace_put(&count, sizeof(count));
+	trace_put(&transpose, sizeof(transpose));
+	trace_put_data(value, value == NULL ? 0 : (size_t)(count * 4 * 4 * sizeof(GLfloat)));
+	trace_end_call();
+}
+static PFNGLVALIDATEPROGRAMPROC trace_real_glValidateProgram = NULL;
+static void APIENTRY trace_glValidateProgram(GLuint program) {
+	trace_real_glValidateProgram(program);
+	trace_begin_call(507);
+	trace_put(&program, sizeof(program));
+	trace_end_call();
+}
+static PFNGLVERTEXATTRIB1DPROC trace_real_glVertexAttrib1d = NULL;
+static void APIENTRY trace_glVertexAttrib1d(GLuint index, GLdouble x) {
+	trace_real_glVertexAttrib1d(index, x);
+	trace_begin_call(508);
+	trace_put(&index, sizeof(index));
+	trace_put(&x, sizeof(x));
+	trace_end_call();
+}
+static PFNGLVERTEXATTRIB1DVPROC trace_real_glVertexAttrib1dv = NULL;
+static void APIENTRY trace_glVertexAttrib1dv(GLuint index, const GLdouble *v) {
+	trace_real_glVertexAttrib1dv(index, v);
+	trace_begin_call(509);
+	trace_put(&index, sizeof(index));
+	trace_put_data(v, v == NULL ? 0 : (size_t)(1 * sizeof(GLdouble)));
+	trace_end_call();
+}
+static PFNGLVERTEXATTRIB1FPROC trace_real_glVertexAttrib1f = NULL;
+static void APIENTRY trace_glVertexAttrib1f(GLuint index, GLfloat x) {
+	trace_real_glVertexAttrib1f(index, x);
+	trace_begin_call(510);
+	trace_put(&index, sizeof(index));
+	trace_put(&x, sizeof(x));
+	trace_end_call();
+}
+static PFNGLVERTEXATTRIB1FVPROC trace_real_glVertexAttrib1fv = NULL;
+static void APIENTRY trace_glVertexAttrib1fv(GLuint index, const GLfloat *v) {
+	trace_real_glVertexAttrib1fv(index, v);
+	trace_begin_call(511);
+	trace_put(&index, sizeof(index));
+	trace_put_data(v, v == NULL ? 0 : (size_t)(1 * sizeof(GLfloat)));
+	trace_end_call();
+}
+static PFNGLVERTEXATTRIB1SPROC trace_real_glVertexAttrib1s = NULL;
+static void APIENTRY trace_glVertexAttrib1s(GLuint index, GLshort x) {
+	trace_real_glVertexAttrib1s(index, x);
+	trace_begin_call(512);
+	trace_put(&index, sizeof(index));
+	trace_put(&x, sizeof(x));
+	trace_end_call();
+}
+static PFNGLVERTEXATTRIB1SVPROC trace_real_glVertexAttrib1sv = NULL;
+static void APIENTRY trace_glVertexAttrib1sv(GLuint index, const GLshort *v) {
+	trace_real_glVertexAttrib1sv(index, v);
+	trace_begin_call(513);
+	trace_put(&index, sizeof(index));
+	trace_put_data(v, v == NULL ? 0 : (size_t)(1 * sizeof(GLshort)));
+	trace_end_call();
+}
+static PFNGLVERTEXATTRIB2DPROC trace_real_glVertexAttrib2d = NULL;
+static void APIENTRY trace_glVertexAttrib2d(GLuint index, GLdouble x, GLdouble y) {
+	trace_real_glVertexAttrib2d(index, x, y);
+	trace_begin_call(514);
+	trace_put(&index, sizeof(index));
+	trace_put(&x, sizeof(x));
+	trace_put(&y, sizeof(y));
+	trace_end_call();
+}
+static PFNGLVERTEXATTRIB2DVPROC trace_real_glVertexAttrib2dv = NULL;
+static void APIENTRY trace_glVertexAttrib2dv(GLuint index, const GLdouble *v) {
+	trace_real_glVertexAttrib2dv(index, v);
+	trace_begin_call(515);
+	trace_put(&index, sizeof(index));
+	trace_put_data(v, v == NULL ? 0 : (size_t)(2 * sizeof(GLdouble)));
+	trace_end_call();
+}
+static PFNGLVERTEXATTRIB2FPROC trace_real_glVertexAttrib2f = NULL;
+static void APIENTRY trace_glVertexAttrib2f(GLuint index, GLfloat x, GLfloat y) {
+	trace_real_glVertexAttrib2f(index, x, y);
+	trace_begin_call(516);
+	trace_put(&index, sizeof(index));
+	trace_put(&x, sizeof(x));
+	trace_put(&y, sizeof(y));
+	trace_end_call();
+}
+static PFNGLVERTEXATTRIB2FVPROC trace_real_glVertexAttrib2fv = NULL;
+static void APIENTRY trace_glVertexAttrib2fv(GLuint index, const GLfloat *v) {
+	trace_real_glVertexAttrib2fv(index, v);
+	trace_begin_call(517);
+	trace_put(&index, sizeof(index));
+	trace_put_data(v, v == NULL ? 0 : (size_t)(2 * sizeof(GLfloat)));
+	trace_end_call();
+}
+static PFNGLVERTEXATTRIB2SPROC trace_real_glVertexAttrib2s = NULL;
+static void APIENTRY trace_glVertexAttrib2s(GLuint index, GLshort x, GLshort y) {
+	trace_real_glVertexAttrib2s(index, x, y);
+	trace_begin_call(518);
+	trace_put(&index, sizeof(index));
+	trace_put(&x, sizeof(x));
+	trace_put(&y, sizeof(y));
+	trace_end_call();
+}
+static PFNGLVERTEXATTRIB2SVPROC trace_real_glVertexAttrib2sv = NULL;
+static void APIENTRY trace_glVertexAttrib2sv(GLuint index, const GLshort *v) {
+	trace_real_glVertexAttrib2sv(index, v);
+	trace_begin_call(519);
+	trace_put(&index, sizeof(index));
+	trace_put_data(v, v == NULL ? 0 : (size_t)(2 * sizeof(GLshort)));
+	trace_end_call();
+}
+static PFNGLVERTEXATTRIB3DPROC trace_real_glVertexAttrib3d = NULL;
+static void APIENTRY trace_glVertexAttrib3d(GLuint index, GLdouble x, GLdouble y, GLdouble z) {
+	trace_real_glVertexAttrib3d(index, x, y, z);
+	trace_begin_call(520);
+	trace_put(&index, sizeof(index));
+	trace_put(&x, sizeof(x));
+	trace_put(&y, sizeof(y));
+	trace_put(&z, sizeof(z));
+	trace_end_call();
+}
+static PFNGLVERTEXATTRIB3DVPROC trace_real_glVertexAttrib3dv = NULL;
+static void APIENTRY trace_glVertexAttrib3dv(GLuint index, const GLdouble *v) {
+	trace_real_glVertexAttrib3dv(index, v);
+	trace_begin_call(521);
+	trace_put(&index, sizeof(index));
+	trace_put_data(v, v == NULL ? 0 : (size_t)(3 * sizeof(GLdouble)));
+	trace_end_call();
+}
+static PFNGLVERTEXATTRIB3FPROC trace_real_glVertexAttrib3f = NULL;
+static void APIENTRY trace_glVertexAttrib3f(GLuint index, GLfloat x, GLfloat y, GLfloat z) {
+	trace_real_glVertexAttrib3f(index, x, y, z);
+	trace_begin_call(522);
+	trace_put(&index, sizeof(index));
+	trace_put(&x, sizeof(x));
+	trace_put(&y, sizeof(y));
+	trace_put(&z, sizeof(z));
+	trace_end_call();
+}
+static PFNGLVERTEXATTRIB3FVPROC trace_real_glVertexAttrib3fv = NULL;
+static void APIENTRY trace_glVertexAttrib3fv(GLuint index, const GLfloat *v) {
+	trace_real_glVertexAttrib3fv(index, v);
+	trace_begin_call(523);
+	trace_put(&index, sizeof(index));
+	trace_put_data(v, v == NULL ? 0 : (size_t)(3 * sizeof(GLfloat)));
+	trace_end_call();
+}
+static PFNGLVERTEXATTRIB3SPROC trace_real_glVertexAttrib3s = NULL;
+static void APIENTRY trace_glVertexAttrib3s(GLuint index, GLshort x, GLshort y, GLshort z) {
+	trace_real_glVertexAttrib3s(index, x, y, z);
+	trace_begin_call(524);
+	trace_put(&index, sizeof(index));
+	trace_put(&x, sizeof(x));
+	trace_put(&y, sizeof(y));
+	trace_put(&z, sizeof(z));
+	trace_end_call();
+}
+static PFNGLVERTEXATTRIB3SVPROC trace_real_glVertexAttrib3sv = NULL;
+static void APIENTRY trace_glVertexAttrib3sv(GLuint index, const GLshort *v) {
+	trace_real_glVertexAttrib3sv(index, v);
+	trace_begin_call(525);
+	trace_put(&index, sizeof(index));
+	trace_put_data(v, v == NULL ? 0 : (size_t)(3 * sizeof(GLshort)));
+	trace_end_call();
+}
+static PFNGLVERTEXATTRIB4NBVPROC trace_real_glVertexAttrib4Nbv = NULL;
+static void APIENTRY trace_glVertexAttrib4Nbv(GLuint index, const GLbyte *v) {
+	trace_real_glVertexAttrib4Nbv(index, v);
+	trace_begin_call(526);
+	trace_put(&index, sizeof(index));
+	trace_put_data(v, v == NULL ? 0 : (size_t)(4 * sizeof(GLbyte)));
+	trace_end_call();
+}
+static PFNGLVERTEXATTRIB4NIVPROC trace_real_glVertexAttrib4Niv = NULL;
+static void APIENTRY trace_glVertexAttrib4Niv(GLuint index, const GLint *v) {
+	trace_real_glVertexAttrib4Niv(index, v);
+	trace_begin_call(527);
+	trace_put(&index, sizeof(index));
+	trace_put_data(v, v == NULL ? 0 : (size_t)(4 * sizeof(GLint)));
+	trace_end_call();
+}
+static PFNGLVERTEXATTRIB4NSVPROC trace_real_glVertexAttrib4Nsv = NULL;
+static void APIENTRY trace_glVertexAttrib4Nsv(GLuint index, const GLshort *v) {
+	trace_real_glVertexAttrib4Nsv(index, v);
+	trace_begin_call(528);
+	trace_put(&index, sizeof(index));
+	trace_put_data(v, v == NULL ? 0 : (size_t)(4 * sizeof(GLshort)));
+	trace_end_call();
+}
+static PFNGLVERTEXATTRIB4NUBPROC trace_real_glVertexAttrib4Nub = NULL;
+static void APIENTRY trace_glVertexAttrib4Nub(GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w) {
+	trace_real_glVertexAttrib4Nub(index, x, y, z, w);
+	trace_begin_call(529);
+	trace_put(&index, sizeof(index));
+	trace_put(&x, sizeof(x));
+	trace_put(&y, sizeof(y));
+	trace_put(&z, sizeof(z));
+	trace_put(&w, sizeof(w));
+	trace_end_call();
+}
+static PFNGLVERTEXATTRIB4NUBVPROC trace_real_glVertexAttrib4Nubv = NULL;
+static void APIENTRY trace_glVertexAttrib4Nubv(GLuint index, const GLubyte *v) {
+	trace_real_glVertexAttrib4Nubv(index, v);
+	trace_begin_call(530);
+	trace_put(&index, sizeof(index));
+	trace_put_data(v, v == NULL ? 0 : (size_t)(4 * sizeof(GLubyte)));
+	trace_end_call();
+}
+static PFNGLVERTEXATTRIB4NUIVPROC trace_real_glVertexAttrib4Nuiv = NULL;
+static void APIENTRY trace_glVertexAttrib4Nuiv(GLuint index, const GLuint *v) {
+	trace_real_glVertexAttrib4Nuiv(index, v);
+	trace_begin_call(531);
+	trace_put(&index, sizeof(index));
+	trace_put_data(v, v == NULL ? 0 : (size_t)(4 * sizeof(GLuint)));
+	trace_end_call();
+}
+static PFNGLVERTEXATTRIB4NUSVPROC trace_real_glVertexAttrib4Nusv = NULL;
+static void APIENTRY trace_glVertexAttrib4Nusv(GLuint index, const GLushort *v) {
+	trace_real_glVertexAttrib4Nusv(index, v);
+	trace_begin_call(532);
+	trace_put(&index, sizeof(index));
+	trace_put_data(v, v == NULL ? 0 : (size_t)(4 * sizeof(GLushort)));
+	trace_end_call();
+}
+static PFNGLVERTEXATTRIB4BVPROC trace_real_glVertexAttrib4bv = NULL;
+static void APIENTRY trace_glVertexAttrib4bv(GLuint index, const GLbyte *v) {
+	trace_real_glVertexAttrib4bv(index, v);
+	trace_begin_call(533);
+	trace_put(&index, sizeof(index));
+	trace_put_data(v, v == NULL ? 0 : (size_t)(4 * sizeof(GLbyte)));
+	trace_end_call();
+}
+static PFNGLVERTEXATTRIB4DPROC trace_real_glVertexAttrib4d = NULL;
+static void APIENTRY trace_glVertexAttrib4d(GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w) {
+	trace_real_glVertexAttrib4d(index, x, y, z, w);
+	trace_begin_call(534);
+	trace_put(&index, sizeof(index));
+	trace_put(&x, sizeof(x));
+	trace_put(&y, sizeof(y));
+	trace_put(&z, sizeof(z));
+	trace_put(&w, sizeof(w));
+	trace_end_call();
+}
+static PFNGLVERTEXATTRIB4DVPROC trace_real_glVertexAttrib4dv = NULL;
+static void APIENTRY trace_glVertexAttrib4dv(GLuint index, const GLdouble *v) {
+	trace_real_glVertexAttrib4dv(index, v);
+	trace_begin_call(535);
+	trace_put(&index, sizeof(index));
+	trace_put_data(v, v == NULL ? 0 : (size_t)(4 * sizeof(GLdouble)));
+	trace_end_call();
+}
+static PFNGLVERTEXATTRIB4FPROC trace_real_glVertexAttrib4f = NULL;
+static void APIENTRY trace_glVertexAttrib4f(GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w) {
+	trace_real_glVertexAttrib4f(index, x, y, z, w);
+	trace_begin_call(536);
+	trace_put(&index, sizeof(index));
+	trace_put(&x, sizeof(x));
+	trace_put(&y, sizeof(y));
+	trace_put(&z, sizeof(z));
+	trace_put(&w, sizeof(w));
+	trace_end_call();
+}
+static PFNGLVERTEXATTRIB4FVPROC trace_real_glVertexAttrib4fv = NULL;
+static void APIENTRY trace_glVertexAttrib4fv(GLuint index, const GLfloat *v) {
+	trace_real_glVertexAttrib4fv(index, v);
+	trace_begin_call(537);
+	trace_put(&index, sizeof(index));
+	trace_put_data(v, v == NULL ? 0 : (size_t)(4 * sizeof(GLfloat)));
+	trace_end_call();
+}
+static PFNGLVERTEXATTRIB4IVPROC trace_real_glVertexAttrib4iv = NULL;
+static void APIENTRY trace_glVertexAttrib4iv(GLuint index, const GLint *v) {
+	trace_real_glVertexAttrib4iv(index, v);
+	trace_begin_call(538);
+	trace_put(&index, sizeof(index));
+	trace_put_data(v, v == NULL ? 0 : (size_t)(4 * sizeof(GLint)));
+	trace_end_call();
+}
+static PFNGLVERTEXATTRIB4SPROC trace_real_glVertexAttrib4s = NULL;
+static void APIENTRY trace_glVertexAttrib4s(GLuint index, GLshort x, GLshort y, GLshort z, GLshort w) {
+	trace_real_glVertexAttrib4s(index, x, y, z, w);
+	trace_begin_call(539);
+	trace_put(&index, sizeof(index));
+	trace_put(&x, sizeof(x));
+	trace_put(&y, sizeof(y));
+	trace_put(&z, sizeof(z));
+	trace_put(&w, sizeof(w));
+	trace_end_call();
+}
+static PFNGLVERTEXATTRIB4SVPROC trace_real_glVertexAttrib4sv = NULL;
+static void APIENTRY trace_glVertexAttrib4sv(GLuint index, const GLshort *v) {
+	trace_real_glVertexAttrib4sv(index, v);
+	trace_begin_call(540);
+	trace_put(&index, sizeof(index));
+	trace_put_data(v, v == NULL ? 0 : (size_t)(4 * sizeof(GLshort)));
+	trace_end_call();
+}
+static PFNGLVERTEXATTRIB4UBVPROC trace_real_glVertexAttrib4ubv = NULL;
+static void APIENTRY trace_glVertexAttrib4ubv(GLuint index, const GLubyte *v) {
+	trace_real_glVertexAttrib4ubv(index, v);
+	trace_begin_call(541);
+	trace_put(&index, sizeof(index));
+	trace_put_data(v, v == NULL ? 0 : (size_t)(4 * sizeof(GLubyte)));
+	trace_end_call();
+}
+static PFNGLVERTEXATTRIB4UIVPROC trace_real_glVertexAttrib4uiv = NULL;
+static void APIENTRY trace_glVertexAttrib4uiv(GLuint index, const GLuint *v) {
+	trace_real_glVertexAttrib4uiv(index, v);
+	trace_begin_call(542);
+	trace_put(&index, sizeof(index));
+	trace_put_data(v, v == NULL ? 0 : (size_t)(4 * sizeof(GLuint)));
+	trace_end_call();
+}
+static PFNGLVERTEXATTRIB4USVPROC trace_real_glVertexAttrib4usv = NULL;
+static void APIENTRY trace_glVertexAttrib4usv(GLuint index, const GLushort *v) {
+	trace_real_glVertexAttrib4usv(index, v);
+	trace_begin_call(543);
+	trace_put(&index, sizeof(index));
+	trace_put_data(v, v == NULL ? 0 : (size_t)(4 * sizeof(GLushort)));
+	trace_end_call();
+}
+static PFNGLVERTEXATTRIBPOINTERPROC trace_real_glVertexAttribPointer = NULL;
+static void APIENTRY trace_glVertexAttribPointer(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void *pointer) {
+	trace_real_glVertexAttribPointer(index, size, type, normalized, stride, pointer);
+	trace_begin_call(544);
+	trace_put(&index, sizeof(index));
+	trace_put(&size, sizeof(size));
+	trace_put(&type, sizeof(type));
+	trace_put(&normalized, sizeof(normalized));
+	trace_put(&stride, sizeof(stride));
+	trace_put_offset(pointer);
+	trace_end_call();
+}
+static PFNGLUNIFORMMATRIX2X3FVPROC trace_real_glUniformMatrix2x3fv = NULL;
+static void APIENTRY trace_glUniformMatrix2x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	trace_real_glUniformMatrix2x3fv(location, count, transpose, value);
+	trace_begin_call(545);
+	trace_put(&location, sizeof(location));
+	trace_put(&count, sizeof(count));
+	trace_put(&transpose, sizeof(transpose));
+	trace_put_data(value, value == NULL ? 0 : (size_t)(count * 2 * 3 * sizeof(GLfloat)));
+	trace_end_call();
+}
+static PFNGLUNIFORMMATRIX3X2FVPROC trace_real_glUniformMatrix3x2fv = NULL;
+static void APIENTRY trace_glUniformMatrix3x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	trace_real_glUniformMatrix3x2fv(location, count, transpose, value);
+	trace_begin_call(546);
+	trace_put(&location, sizeof(location));
+	trace_put(&count, sizeof(count));
+	trace_put(&transpose, sizeof(transpose));
+	trace_put_data(value, value == NULL ? 0 : (size_t)(count * 3 * 2 * sizeof(GLfloat)));
+	trace_end_call();
+}
+static PFNGLUNIFORMMATRIX2X4FVPROC trace_real_glUniformMatrix2x4fv = NULL;
+static void APIENTRY trace_glUniformMatrix2x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	trace_real_glUniformMatrix2x4fv(location, count, transpose, value);
+	trace_begin_call(547);
+	trace_put(&location, sizeof(location));
+	trace_put(&count, sizeof(count));
+	trace_put(&transpose, sizeof(transpose));
+	trace_put_data(value, value == NULL ? 0 : (size_t)(count * 2 * 4 * sizeof(GLfloat)));
+	trace_end_call();
+}
+static PFNGLUNIFORMMATRIX4X2FVPROC trace_real_glUniformMatrix4x2fv = NULL;
+static void APIENTRY trace_glUniformMatrix4x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	trace_real_glUniformMatrix4x2fv(location, count, transpose, value);
+	trace_begin_call(548);
+	trace_put(&location, sizeof(location));
+	trace_put(&count, sizeof(count));
+	trace_put(&transpose, sizeof(transpose));
+	trace_put_data(value, value == NULL ? 0 : (size_t)(count * 4 * 2 * sizeof(GLfloat)));
+	trace_end_call();
+}
+static PFNGLUNIFORMMATRIX3X4FVPROC trace_real_glUniformMatrix3x4fv = NULL;
+static void APIENTRY trace_glUniformMatrix3x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	trace_real_glUniformMatrix3x4fv(location, count, transpose, value);
+	trace_begin_call(549);
+	trace_put(&location, sizeof(location));
+	trace_put(&count, sizeof(count));
+	trace_put(&transpose, sizeof(transpose));
+	trace_put_data(value, value == NULL ? 0 : (size_t)(count * 3 * 4 * sizeof(GLfloat)));
+	trace_end_call();
+}
+static PFNGLUNIFORMMATRIX4X3FVPROC trace_real_glUniformMatrix4x3fv = NULL;
+static void APIENTRY trace_glUniformMatrix4x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	trace_real_glUniformMatrix4x3fv(location, count, transpose, value);
+	trace_begin_call(550);
+	trace_put(&location, sizeof(location));
+	trace_put(&count, sizeof(count));
+	trace_put(&transpose, sizeof(transpose));
+	trace_put_data(value, value == NULL ? 0 : (size_t)(count * 4 * 3 * sizeof(GLfloat)));
+	trace_end_call();
+}
+static PFNGLCOLORMASKIPROC trace_real_glColorMaski = NULL;
+static void APIENTRY trace_glColorMaski(GLuint index, GLboolean r, GLboolean g, GLboolean b, GLboolean a) {
+	trace_real_glColorMaski(index, r, g, b, a);
+	trace_begin_call(551);
+	trace_put(&index, sizeof(index));
+	trace_put(&r, sizeof(r));
+	trace_put(&g, sizeof(g));
+	trace_put(&b, sizeof(b));
+	trace_put(&a, sizeof(a));
+	trace_end_call();
+}
+static PFNGLGETBOOLEANI_VPROC trace_real_glGetBooleani_v = NULL;
+static void APIENTRY trace_glGetBooleani_v(GLenum target, GLuint index, GLboolean *data) {
+	trace_real_glGetBooleani_v(target, index, data);
+	trace_begin_call(552);
+	trace_put(&target, sizeof(target));
+	trace_put(&index, sizeof(index));
+	trace_end_call();
+}
+static PFNGLGETINTEGERI_VPROC trace_real_glGetIntegeri_v = NULL;
+static void APIENTRY trace_glGetIntegeri_v(GLenum target, GLuint index, GLint *data) {
+	trace_real_glGetIntegeri_v(target, index, data);
+	trace_begin_call(553);
+	trace_put(&target, sizeof(target));
+	trace_put(&index, sizeof(index));
+	trace_end_call();
+}
+static PFNGLENABLEIPROC trace_real_glEnablei = NULL;
+static void APIENTRY trace_glEnablei(GLenum target, GLuint index) {
+	trace_real_glEnablei(target, index);
+	trace_begin_call(554);
+	trace_put(&target, sizeof(target));
+	trace_put(&index, sizeof(index));
+	trace_end_call();
+}
+static PFNGLDISABLEIPROC trace_real_glDisablei = NULL;
+static void APIENTRY trace_glDisablei(GLenum target, GLuint index) {
+	trace_real_glDisablei(target, index);
+	trace_begin_call(555);
+	trace_put(&target, sizeof(target));
+	trace_put(&index, sizeof(index));
+	trace_end_call();
+}
+static PFNGLISENABLEDIPROC trace_real_glIsEnabledi = NULL;
+static GLboolean APIENTRY trace_glIsEnabledi(GLenum target, GLuint index) {
+	GLboolean glad_result;
+	glad_result = trace_real_glIsEnabledi(target, index);
+	trace_begin_call(556);
+	trace_put(&target, sizeof(target));
+	trace_put(&index, sizeof(index));
+	trace_put(&glad_result, sizeof(glad_result));
+	trace_end_call();
+	return glad_result;
+}
+static PFNGLBEGINTRANSFORMFEEDBACKPROC trace_real_glBeginTransformFeedback = NULL;
+static void APIENTRY trace_glBeginTransformFeedback(GLenum primitiveMode) {
+	trace_real_glBeginTransformFeedback(primitiveMode);
+	trace_begin_call(557);
+	trace_put(&primitiveMode, sizeof(primitiveMode));
+	trace_end_call();
+}
+static PFNGLENDTRANSFORMFEEDBACKPROC trace_real_glEndTransformFeedback = NULL;
+static void APIENTRY trace_glEndTransformFeedback(void) {
+	trace_real_glEndTransformFeedback();
+	trace_begin_call(558);
+	trace_end_call();
+}
+static PFNGLBINDBUFFERRANGEPROC trace_real_glBindBufferRange = NULL;
+static void APIENTRY trace_glBindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size) {
+	trace_real_glBindBufferRange(target, index, buffer, offset, size);
+	trace_begin_call(559);
+	trace_put(&target, sizeof(target));
+	trace_put(&index, sizeof(index));
+	trace_put(&buffer, sizeof(buffer));
+	trace_put(&offset, sizeof(offset));
+	trace_put(&size, sizeof(size));
+	trace_end_call();
+}
+static PFNGLBINDBUFFERBASEPROC trace_real_glBindBufferBase = NULL;
+static void APIENTRY trace_glBindBufferBase(GLenum target, GLuint index, GLuint buffer) {
+	trace_real_glBindBufferBase(target, index, buffer);
+	trace_begin_call(560);
+	trace_put(&target, sizeof(target));
+	trace_put(&index, sizeof(index));
+	trace_put(&buffer, sizeof(buffer));
+	trace_end_call();
+}
+static PFNGLTRANSFORMFEEDBACKVARYINGSPROC trace_real_glTransformFeedbackVaryings = NULL;
+static void APIENTRY trace_glTransformFeedbackVaryings(GLuint program, GLsizei count, const GLchar *const*varyings, GLenum bufferMode) {
+	trace_real_glTransformFeedbackVaryings(program, count, varyings, bufferMode);
+	trace_begin_call(561);
+	trace_put(&program, sizeof(program));
+	trace_put(&count, sizeof(count));
+	trace_put_strings(count, (const GLchar *const*)varyings, NULL);
+	trace_put(&bufferMode, sizeof(bufferMode));
+	trace_end_call();
+}
+static PFNGLGETTRANSFORMFEEDBACKVARYINGPROC trace_real_glGetTransformFeedbackVarying = NULL;
+static void APIENTRY trace_glGetTransformFeedbackVarying(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLsizei *size, GLenum *type, GLchar *name) {
+	trace_real_glGetTransformFeedbackVarying(program, index, bufSize, length, size, type, name);
+	trace_begin_call(562);
+	trace_put(&program, sizeof(program));
+	trace_put(&index, sizeof(index));
+	trace_put(&bufSize, sizeof(bufSize));
+	trace_end_call();
+}
+static PFNGLCLAMPCOLORPROC trace_real_glClampColor = NULL;
+static void APIENTRY trace_glClampColor(GLenum target, GLenum clamp) {
+	trace_real_glClampColor(target, clamp);
+	trace_begin_call(563);
+	trace_put(&target, sizeof(target));
+	trace_put(&clamp, sizeof(clamp));
+	trace_end_call();
+}
+static PFNGLBEGINCONDITIONALRENDERPROC trace_real_glBeginConditionalRender = NULL;
+static void APIENTRY trace_glBeginConditionalRender(GLuint id, GLenum mode) {
+	trace_real_glBeginConditionalRender(id, mode);
+	trace_begin_call(564);
+	trace_put(&id, sizeof(id));
+	trace_put(&mode, sizeof(mode));
+	trace_end_call();
+}
+static PFNGLENDCONDITIONALRENDERPROC trace_real_glEndConditionalRender = NULL;
+static void APIENTRY trace_glEndConditionalRender(void) {
+	trace_real_glEndConditionalRender();
+	trace_begin_call(565);
+	trace_end_call();
+}
+static PFNGLVERTEXATTRIBIPOINTERPROC trace_real_glVertexAttribIPointer = NULL;
+static void APIENTRY trace_glVertexAttribIPointer(GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer) {
+	trace_real_glVertexAttribIPointer(index, size, type, stride, pointer);
+	trace_begin_call(566);
+	trace_put(&index, sizeof(index));
+	trace_put(&size, sizeof(size));
+	trace_put(&type, sizeof(type));
+	trace_put(&stride, sizeof(stride));
+	trace_put_offset(pointer);
+	trace_end_call();
+}
+static PFNGLGETVERTEXATTRIBIIVPROC trace_real_glGetVertexAttribIiv = NULL;
+static void APIENTRY trace_glGetVertexAttribIiv(GLuint index, GLenum pname, GLint *params) {
+	trace_real_glGetVertexAttribIiv(index, pname, params);
+	trace_begin_call(567);
+	trace_put(&index, sizeof(index));
+	trace_put(&pname, sizeof(pname));
+	trace_end_call();
+}
+static PFNGLGETVERTEXATTRIBIUIVPROC trace_real_glGetVertexAttribIuiv = NULL;
+static void APIENTRY trace_glGetVertexAttribIuiv(GLuint index, GLenum pname, GLuint *params) {
+	trace_real_glGetVertexAttribIuiv(index, pname, params);
+	trace_begin_call(568);
+	trace_put(&index, sizeof(index));
+	trace_put(&pname, sizeof(pname));
+	trace_end_call();
+}
+static PFNGLVERTEXATTRIBI1IPROC trace_real_glVertexAttribI1i = NULL;
+static void APIENTRY trace_glVertexAttribI1i(GLuint index, GLint x) {
+	trace_real_glVertexAttribI1i(index, x);
+	trace_begin_call(569);
+	trace_put(&index, sizeof(index));
+	trace_put(&x, sizeof(x));
+	trace_end_call();
+}
+static PFNGLVERTEXATTRIBI2IPROC trace_real_glVertexAttribI2i = NULL;
+static void APIENTRY trace_glVertexAttribI2i(GLuint index, GLint x, GLint y) {
+	trace_real_glVertexAttribI2i(index, x, y);
+	trace_begin_call(570);
+	trace_put(&index, sizeof(index));
+	trace_put(&x, sizeof(x));
+	trace_put(&y, sizeof(y));
+	trace_end_call();
+}
+static PFNGLVERTEXATTRIBI3IPROC trace_real_glVertexAttribI3i = NULL;
+static void APIENTRY trace_glVertexAttribI3i(GLuint index, GLint x, GLint y, GLint z) {
+	trace_real_glVertexAttribI3i(index, x, y, z);
+	trace_begin_call(571);
+	trace_put(&index, sizeof(index));
+	trace_put(&x, sizeof(x));
+	trace_put(&y, sizeof(y));
+	trace_put(&z, sizeof(z));
+	trace_end_call();
+}
+static PFNGLVERTEXATTRIBI4IPROC trace_real_glVertexAttribI4i = NULL;
+static void APIENTRY trace_glVertexAttribI4i(GLuint index, GLint x, GLint y, GLint z, GLint w) {
+	trace_real_glVertexAttribI4i(index, x, y, z, w);
+	trace_begin_call(572);
+	trace_put(&index, sizeof(index));
+	trace_put(&x, sizeof(x));
+	trace_put(&y, sizeof(y));
+	trace_put(&z, sizeof(z));
+	trace_put(&w, sizeof(w));
+	trace_end_call();
+}
+static PFNGLVERTEXATTRIBI1UIPROC trace_real_glVertexAttribI1ui = NULL;
+static void APIENTRY trace_glVertexAttribI1ui(GLuint index, GLuint x) {
+	trace_real_glVertexAttribI1ui(index, x);
+	trace_begin_call(573);
+	trace_put(&index, sizeof(index));
+	trace_put(&x, sizeof(x));
+	trace_end_call();
+}
+static PFNGLVERTEXATTRIBI2UIPROC trace_real_glVertexAttribI2ui = NULL;
+static void APIENTRY trace_glVertexAttribI2ui(GLuint index, GLuint x, GLuint y) {
+	trace_real_glVertexAttribI2ui(index, x, y);
+	trace_begin_call(574);
+	trace_put(&index, sizeof(index));
+	trace_put(&x, sizeof(x));
+	trace_put(&y, sizeof(y));
+	trace_end_call();
+}
+static PFNGLVERTEXATTRIBI3UIPROC trace_real_glVertexAttribI3ui = NULL;
+static void APIENTRY trace_glVertexAttribI3ui(GLuint index, GLuint x, GLuint y, GLuint z) {
+	trace_real_glVertexAttribI3ui(index, x, y, z);
+	trace_begin_call(575);
+	trace_put(&index, sizeof(index));
+	trace_put(&x, sizeof(x));
+	trace_put(&y, sizeof(y));
+	trace_put(&z, sizeof(z));
+	trace_end_call();
+}
+static PFNGLVERTEXATTRIBI4UIPROC trace_real_glVertexAttribI4ui = NULL;
+static void APIENTRY trace_glVertexAttribI4ui(GLuint index, GLuint x, GLuint y, GLuint z, GLuint w) {
+	trace_real_glVertexAttribI4ui(index, x, y, z, w);
+	trace_begin_call(576);
+	trace_put(&index, sizeof(index));
+	trace_put(&x, sizeof(x));
+	trace_put(&y, sizeof(y));
+	trace_put(&z, sizeof(z));
+	trace_put(&w, sizeof(w));
+	trace_end_call();
+}
+static PFNGLVERTEXATTRIBI1IVPROC trace_real_glVertexAttribI1iv = NULL;
+static void APIENTRY trace_glVertexAttribI1iv(GLuint index, const GLint *v) {
+	trace_real_glVertexAttribI1iv(index, v);
+	trace_begin_call(577);
+	trace_put(&index, sizeof(index));
+	trace_put_data(v, v == NULL ? 0 : (size_t)(1 * sizeof(GLint)));
+	trace_end_call();
+}
+static PFNGLVERTEXATTRIBI2IVPROC trace_real_glVertexAttribI2iv = NULL;
+static void APIENTRY trace_glVertexAttribI2iv(GLuint index, const GLint *v) {
+	trace_real_glVertexAttribI2iv(index, v);
+	trace_begin_call(578);
+	trace_put(&index, sizeof(index));
+	trace_put_data(v, v == NULL ? 0 : (size_t)(2 * sizeof(GLint)));
+	trace_end_call();
+}
+static PFNGLVERTEXATTRIBI3IVPROC trace_real_glVertexAttribI3iv = NULL;
+static void APIENTRY trace_glVertexAttribI3iv(GLuint index, const GLint *v) {
+	trace_real_glVertexAttribI3iv(index, v);
+	trace_begin_call(579);
+	trace_put(&index, sizeof(index));
+	trace_put_data(v, v == NULL ? 0 : (size_t)(3 * sizeof(GLint)));
+	trace_end_call();
+}
+static PFNGLVERTEXATTRIBI4IVPROC trace_real_glVertexAttribI4iv = NULL;
+static void APIENTRY trace_glVertexAttribI4iv(GLuint index, const GLint *v) {
+	trace_real_glVertexAttribI4iv(index, v);
+	trace_begin_call(580);
+	trace_put(&index, sizeof(index));
+	trace_put_data(v, v == NULL ? 0 : (size_t)(4 * sizeof(GLint)));
+	trace_end_call();
+}
+static PFNGLVERTEXATTRIBI1UIVPROC trace_real_glVertexAttribI1uiv = NULL;
+static void APIENTRY trace_glVertexAttribI1uiv(GLuint index, const GLuint *v) {
+	trace_real_glVertexAttribI1uiv(index, v);
+	trace_begin_call(581);
+	trace_put(&index, sizeof(index));
+	trace_put_data(v, v == NULL ? 0 : (size_t)(1 * sizeof(GLuint)));
+	trace_end_call();
+}
+static PFNGLVERTEXATTRIBI2UIVPROC trace_real_glVertexAttribI2uiv = NULL;
+static void APIENTRY trace_glVertexAttribI2uiv(GLuint index, const GLuint *v) {
+	trace_real_glVertexAttribI2uiv(index, v);
+	trace_begin_call(582);
+	trace_put(&index, sizeof(index));
+	trace_put_data(v, v == NULL ? 0 : (size_t)(2 * sizeof(GLuint)));
+	trace_end_call();
+}
+static PFNGLVERTEXATTRIBI3UIVPROC trace_real_glVertexAttribI3uiv = NULL;
+static void APIENTRY trace_glVertexAttribI3uiv(GLuint index, const GLuint *v) {
+	trace_real_glVertexAttribI3uiv(index, v);
+	trace_begin_call(583);
+	trace_put(&index, sizeof(index));
+	trace_put_data(v, v == NULL ? 0 : (size_t)(3 * sizeof(GLuint)));
+	trace_end_call();
+}
+static PFNGLVERTEXATTRIBI4UIVPROC trace_real_glVertexAttribI4uiv = NULL;
+static void APIENTRY trace_glVertexAttribI4uiv(GLuint index, const GLuint *v) {
+	trace_real_glVertexAttribI4uiv(index, v);
+	trace_begin_call(584);
+	trace_put(&index, sizeof(index));
+	trace_put_data(v, v == NULL ? 0 : (size_t)(4 * sizeof(GLuint)));
+	trace_end_call();
+}
+static PFNGLVERTEXATTRIBI4BVPROC trace_real_glVertexAttribI4bv = NULL;
+static void APIENTRY trace_glVertexAttribI4bv(GLuint index, const GLbyte *v) {
+	trace_real_glVertexAttribI4bv(index, v);
+	trace_begin_call(585);
+	trace_put(&index, sizeof(index));
+	trace_put_data(v, v == NULL ? 0 : (size_t)(4 * sizeof(GLbyte)));
+	trace_end_call();
+}
+static PFNGLVERTEXATTRIBI4SVPROC trace_real_glVertexAttribI4sv = NULL;
+static void APIENTRY trace_glVertexAttribI4sv(GLuint index, const GLshort *v) {
+	trace_real_glVertexAttribI4sv(index, v);
+	trace_begin_call(586);
+	trace_put(&index, sizeof(index));
+	trace_put_data(v, v == NULL ? 0 : (size_t)(4 * sizeof(GLshort)));
+	trace_end_call();
+}
+static PFNGLVERTEXATTRIBI4UBVPROC trace_real_glVertexAttribI4ubv = NULL;
+static void APIENTRY trace_glVertexAttribI4ubv(GLuint index, const GLubyte *v) {
+	trace_real_glVertexAttribI4ubv(index, v);
+	trace_begin_call(587);
+	trace_put(&index, sizeof(index));
+	trace_put_data(v, v == NULL ? 0 : (size_t)(4 * sizeof(GLubyte)));
+	trace_end_call();
+}
+static PFNGLVERTEXATTRIBI4USVPROC trace_real_glVertexAttribI4usv = NULL;
+static void APIENTRY trace_glVertexAttribI4usv(GLuint index, const GLushort *v) {
+	trace_real_glVertexAttribI4usv(index, v);
+	trace_begin_call(588);
+	trace_put(&index, sizeof(index));
+	trace_put_data(v, v == NULL ? 0 : (size_t)(4 * sizeof(GLushort)));
+	trace_end_call();
+}
+static PFNGLGETUNIFORMUIVPROC trace_real_glGetUniformuiv = NULL;
+static void APIENTRY trace_glGetUniformuiv(GLuint program, GLint location, GLuint *params) {
+	trace_real_glGetUniformuiv(program, location, params);
+	trace_begin_call(589);
+	trace_put(&program, sizeof(program));
+	trace_put(&location, sizeof(location));
+	trace_end_call();
+}
+static PFNGLBINDFRAGDATALOCATIONPROC trace_real_glBindFragDataLocation = NULL;
+static void APIENTRY trace_glBindFragDataLocation(GLuint program, GLuint color, const GLchar *name) {
+	trace_real_glBindFragDataLocation(program, color, name);
+	trace_begin_call(590);
+	trace_put(&program, sizeof(program));
+	trace_put(&color, sizeof(color));
+	trace_put_string(name, -1);
+	trace_end_call();
+}
+static PFNGLGETFRAGDATALOCATIONPROC trace_real_glGetFragDataLocation = NULL;
+static GLint APIENTRY trace_glGetFragDataLocation(GLuint program, const GLchar *name) {
+	GLint glad_result;
+	glad_result = trace_real_glGetFragDataLocation(program, name);
+	trace_begin_call(591);
+	trace_put(&program, sizeof(program));
+	trace_put_string(name, -1);
+	trace_put(&glad_result, sizeof(glad_result));
+	trace_end_call();
+	return glad_result;
+}
+static PFNGLUNIFORM1UIPROC trace_real_glUniform1ui = NULL;
+static void APIENTRY trace_glUniform1ui(GLint location, GLuint v0) {
+	trace_real_glUniform1ui(location, v0);
+	trace_begin_call(592);
+	trace_put(&location, sizeof(location));
+	trace_put(&v0, sizeof(v0));
+	trace_end_call();
+}
+static PFNGLUNIFORM2UIPROC trace_real_glUniform2ui = NULL;
+static void APIENTRY trace_glUniform2ui(GLint location, GLuint v0, GLuint v1) {
+	trace_real_glUniform2ui(location, v0, v1);
+	trace_begin_call(593);
+	trace_put(&location, sizeof(location));
+	trace_put(&v0, sizeof(v0));
+	trace_put(&v1, sizeof(v1));
+	trace_end_call();
+}
+static PFNGLUNIFORM3UIPROC trace_real_glUniform3ui = NULL;
+static void APIENTRY trace_glUniform3ui(GLint location, GLuint v0, GLuint v1, GLuint v2) {
+	trace_real_glUniform3ui(location, v0, v1, v2);
+	trace_begin_call(594);
+	trace_put(&location, sizeof(location));
+	trace_put(&v0, sizeof(v0));
+	trace_put(&v1, sizeof(v1));
+	trace_put(&v2, sizeof(v2));
+	trace_end_call();
+}
+static PFNGLUNIFORM4UIPROC trace_real_glUniform4ui = NULL;
+static void APIENTRY trace_glUniform4ui(GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3) {
+	trace_real_glUniform4ui(location, v0, v1, v2, v3);
+	trace_begin_call(595);
+	trace_put(&location, sizeof(location));
+	trace_put(&v0, sizeof(v0));
+	trace_put(&v1, sizeof(v1));
+	trace_put(&v2, sizeof(v2));
+	trace_put(&v3, sizeof(v3));
+	trace_end_call();
+}
+static PFNGLUNIFORM1UIVPROC trace_real_glUniform1uiv = NULL;
+static void APIENTRY trace_glUniform1uiv(GLint location, GLsizei count, const GLuint *value) {
+	trace_real_glUniform1uiv(location, count, value);
+	trace_begin_call(596);
+	trace_put(&location, sizeof(location));
+	trace_put(&count, sizeof(count));
+	trace_put_data(value, value == NULL ? 0 : (size_t)(count * 1 * sizeof(GLuint)));
+	trace_end_call();
+}
+static PFNGLUNIFORM2UIVPROC trace_real_glUniform2uiv = NULL;
+static void APIENTRY trace_glUniform2uiv(GLint location, GLsizei count, const GLuint *value) {
+	trace_real_glUniform2uiv(location, count, value);
+	trace_begin_call(597);
+	trace_put(&location, sizeof(location));
+	trace_put(&count, sizeof(count));
+	trace_put_data(value, value == NULL ? 0 : (size_t)(count * 2 * sizeof(GLuint)));
+	trace_end_call();
+}
+static PFNGLUNIFORM3UIVPROC trace_real_glUniform3uiv = NULL;
+static void APIENTRY trace_glUniform3uiv(GLint location, GLsizei count, const GLuint *value) {
+	trace_real_glUniform3uiv(location, count, value);
+	trace_begin_call(598);
+	trace_put(&location, sizeof(location));
+	trace_put(&count, sizeof(count));
+	trace_put_data(value, value == NULL ? 0 : (size_t)(count * 3 * sizeof(GLuint)));
+	trace_end_call();
+}
+static PFNGLUNIFORM4UIVPROC trace_real_glUniform4uiv = NULL;
+static void APIENTRY trace_glUniform4uiv(GLint location, GLsizei count, const GLuint *value) {
+	trace_real_glUniform4uiv(location, count, value);
+	trace_begin_call(599);
+	trace_put(&location, sizeof(location));
+	trace_put(&count, sizeof(count));
+	trace_put_data(value, value == NULL ? 0 : (size_t)(count * 4 * sizeof(GLuint)));
+	trace_end_call();
+}
+static PFNGLTEXPARAMETERIIVPROC trace_real_glTexParameterIiv = NULL;
+static void APIENTRY trace_glTexParameterIiv(GLenum target, GLenum pname, const GLint *params) {
+	trace_real_glTexParameterIiv(target, pname, params);
+	trace_begin_call(600);
+	trace_put(&target, sizeof(target));
+	trace_put(&pname, sizeof(pname));
+	trace_put_data(params, params == NULL ? 0 : (size_t)(trace_param_count(pname) * sizeof(GLint)));
+	trace_end_call();
+}
+static PFNGLTEXPARAMETERIUIVPROC trace_real_glTexParameterIuiv = NULL;
+static void APIENTRY trace_glTexParameterIuiv(GLenum target, GLenum pname, const GLuint *params) {
+	trace_real_glTexParameterIuiv(target, pname, params);
+	trace_begin_call(601);
+	trace_put(&target, sizeof(target));
+	trace_put(&pname, sizeof(pname));
+	trace_put_data(params, params == NULL ? 0 : (size_t)(trace_param_count(pname) * sizeof(GLuint)));
+	trace_end_call();
+}
+static PFNGLGETTEXPARAMETERIIVPROC trace_real_glGetTexParameterIiv = NULL;
+static void APIENTRY trace_glGetTexParameterIiv(GLenum target, GLenum pname, GLint *params) {
+	trace_real_glGetTexParameterIiv(target, pname, params);
+	trace_begin_call(602);
+	trace_put(&target, sizeof(target));
+	trace_put(&pname, sizeof(pname));
+	trace_end_call();
+}
+static PFNGLGETTEXPARAMETERIUIVPROC trace_real_glGetTexParameterIuiv = NULL;
+static void APIENTRY trace_glGetTexParameterIuiv(GLenum target, GLenum pname, GLuint *params) {
+	trace_real_glGetTexParameterIuiv(target, pname, params);
+	trace_begin_call(603);
+	trace_put(&target, sizeof(target));
+	trace_put(&pname, sizeof(pname));
+	trace_end_call();
+}
+static PFNGLCLEARBUFFERIVPROC trace_real_glClearBufferiv = NULL;
+static void APIENTRY trace_glClearBufferiv(GLenum buffer, GLint drawbuffer, const GLint *value) {
+	trace_real_glClearBufferiv(buffer, drawbuffer, value);
+	trace_begin_call(604);
+	trace_put(&buffer, sizeof(buffer));
+	trace_put(&drawbuffer, sizeof(drawbuffer));
+	trace_put_data(value, value == NULL ? 0 : (size_t)((buffer == GL_COLOR ? 4 : 1) * sizeof(GLint)));
+	trace_end_call();
+}
+static PFNGLCLEARBUFFERUIVPROC trace_real_glClearBufferuiv = NULL;
+static void APIENTRY trace_glClearBufferuiv(GLenum buffer, GLint drawbuffer, const GLuint *value) {
+	trace_real_glClearBufferuiv(buffer, drawbuffer, value);
+	trace_begin_call(605);
+	trace_put(&buffer, sizeof(buffer));
+	trace_put(&drawbuffer, sizeof(drawbuffer));
+	trace_put_data(value, value == NULL ? 0 : (size_t)((buffer == GL_COLOR ? 4 : 1) * sizeof(GLuint)));
+	trace_end_call();
+}
+static PFNGLCLEARBUFFERFVPROC trace_real_glClearBufferfv = NULL;
+static void APIENTRY trace_glClearBufferfv(GLenum buffer, GLint drawbuffer, const GLfloat *value) {
+	trace_real_glClearBufferfv(buffer, drawbuffer, value);
+	trace_begin_call(606);
+	trace_put(&buffer, sizeof(buffer));
+	trace_put(&drawbuffer, sizeof(drawbuffer));
+	trace_put_data(value, value == NULL ? 0 : (size_t)((buffer == GL_COLOR ? 4 : 1) * sizeof(GLfloat)));
+	trace_end_call();
+}
+static PFNGLCLEARBUFFERFIPROC trace_real_glClearBufferfi = NULL;
+static void APIENTRY trace_glClearBufferfi(GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil) {
+	trace_real_glClearBufferfi(buffer, drawbuffer, depth, stencil);
+	trace_begin_call(607);
+	trace_put(&buffer, sizeof(buffer));
+	trace_put(&drawbuffer, sizeof(drawbuffer));
+	trace_put(&depth, sizeof(depth));
+	trace_put(&stencil, sizeof(stencil));
+	trace_end_call();
+}
+static PFNGLGETSTRINGIPROC trace_real_glGetStringi = NULL;
+static const GLubyte * APIENTRY trace_glGetStringi(GLenum name, GLuint index) {
+	const GLubyte * glad_result;
+	glad_result = trace_real_glGetStringi(name, index);
+	trace_begin_call(608);
+	trace_put(&name, sizeof(name));
+	trace_put(&index, sizeof(index));
+	trace_end_call();
+	return glad_result;
+}
+static PFNGLISRENDERBUFFERPROC trace_real_glIsRenderbuffer = NULL;
+static GLboolean APIENTRY trace_glIsRenderbuffer(GLuint renderbuffer) {
+	GLboolean glad_result;
+	glad_result = trace_real_glIsRenderbuffer(renderbuffer);
+	trace_begin_call(609);
+	trace_put(&renderbuffer, sizeof(renderbuffer));
+	trace_put(&glad_result, sizeof(glad_result));
+	trace_end_call();
+	return glad_result;
+}
+static PFNGLBINDRENDERBUFFERPROC trace_real_glBindRenderbuffer = NULL;
+static void APIENTRY trace_glBindRenderbuffer(GLenum target, GLuint renderbuffer) {
+	trace_real_glBindRenderbuffer(target, renderbuffer);
+	trace_begin_call(610);
+	trace_put(&target, sizeof(target));
+	trace_put(&renderbuffer, sizeof(renderbuffer));
+	trace_end_call();
+}
+static PFNGLDELETERENDERBUFFERSPROC trace_real_glDeleteRenderbuffers = NULL;
+static void APIENTRY trace_glDeleteRenderbuffers(GLsizei n, const GLuint *renderbuffers) {
+	trace_real_glDeleteRenderbuffers(n, renderbuffers);
+	trace_begin_call(611);
+	trace_put(&n, sizeof(n));
+	trace_put_data(renderbuffers, renderbuffers == NULL ? 0 : (size_t)n * sizeof(GLuint));
+	trace_end_call();
+}
+static PFNGLGENRENDERBUFFERSPROC trace_real_glGenRenderbuffers = NULL;
+static void APIENTRY trace_glGenRenderbuffers(GLsizei n, GLuint *renderbuffers) {
+	trace_real_glGenRenderbuffers(n, renderbuffers);
+	trace_begin_call(612);
+	trace_put(&n, sizeof(n));
+	trace_put_data(renderbuffers, renderbuffers == NULL ? 0 : (size_t)n * sizeof(GLuint));
+	trace_end_call();
+}
+static PFNGLRENDERBUFFERSTORAGEPROC trace_real_glRenderbufferStorage = NULL;
+static void APIENTRY trace_glRenderbufferStorage(GLenum target, GLenum internalformat, GLsizei width, GLsizei height) {
+	trace_real_glRenderbufferStorage(target, internalformat, width, height);
+	trace_begin_call(613);
+	trace_put(&target, sizeof(target));
+	trace_put(&internalformat, sizeof(internalformat));
+	trace_put(&width, sizeof(width));
+	trace_put(&height, sizeof(height));
+	trace_end_call();
+}
+static PFNGLGETRENDERBUFFERPARAMETERIVPROC trace_real_glGetRenderbufferParameteriv = NULL;
+static void APIENTRY trace_glGetRenderbufferParameteriv(GLenum target, GLenum pname, GLint *params) {
+	trace_real_glGetRenderbufferParameteriv(target, pname, params);
+	trace_begin_call(614);
+	trace_put(&target, sizeof(target));
+	trace_put(&pname, sizeof(pname));
+	trace_end_call();
+}
+static PFNGLISFRAMEBUFFERPROC trace_real_glIsFramebuffer = NULL;
+static GLboolean APIENTRY trace_glIsFramebuffer(GLuint framebuffer) {
+	GLboolean glad_result;
+	glad_result = trace_real_glIsFramebuffer(framebuffer);
+	trace_begin_call(615);
+	trace_put(&framebuffer, sizeof(framebuffer));
+	trace_put(&glad_result, sizeof(glad_result));
+	trace_end_call();
+	return glad_result;
+}
+static PFNGLBINDFRAMEBUFFERPROC trace_real_glBindFramebuffer = NULL;
+static void APIENTRY trace_glBindFramebuffer(GLenum target, GLuint framebuffer) {
+	trace_real_glBindFramebuffer(target, framebuffer);
+	trace_begin_call(616);
+	trace_put(&target, sizeof(target));
+	trace_put(&framebuffer, sizeof(framebuffer));
+	trace_end_call();
+}
+static PFNGLDELETEFRAMEBUFFERSPROC trace_real_glDeleteFramebuffers = NULL;
+static void APIENTRY trace_glDeleteFramebuffers(GLsizei n, const GLuint *framebuffers) {
+	trace_real_glDeleteFramebuffers(n, framebuffers);
+	trace_begin_call(617);
+	trace_put(&n, sizeof(n));
+	trace_put_data(framebuffers, framebuffers == NULL ? 0 : (size_t)n * sizeof(GLuint));
+	trace_end_call();
+}
+static PFNGLGENFRAMEBUFFERSPROC trace_real_glGenFramebuffers = NULL;
+static void APIENTRY trace_glGenFramebuffers(GLsizei n, GLuint *framebuffers) {
+	trace_real_glGenFramebuffers(n, framebuffers);
+	trace_begin_call(618);
+	trace_put(&n, sizeof(n));
+	trace_put_data(framebuffers, framebuffers == NULL ? 0 : (size_t)n * sizeof(GLuint));
+	trace_end_call();
+}
+static PFNGLCHECKFRAMEBUFFERSTATUSPROC trace_real_glCheckFramebufferStatus = NULL;
+static GLenum APIENTRY trace_glCheckFramebufferStatus(GLenum target) {
+	GLenum glad_result;
+	glad_result = trace_real_glCheckFramebufferStatus(target);
+	trace_begin_call(619);
+	trace_put(&target, sizeof(target));
+	trace_put(&glad_result, sizeof(glad_result));
+	trace_end_call();
+	return glad_result;
+}
+static PFNGLFRAMEBUFFERTEXTURE1DPROC trace_real_glFramebufferTexture1D = NULL;
+static void APIENTRY trace_glFramebufferTexture1D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level) {
+	trace_real_glFramebufferTexture1D(target, attachment, textarget, texture, level);
+	trace_begin_call(620);
+	trace_put(&target, sizeof(target));
+	trace_put(&attachment, sizeof(attachment));
+	trace_put(&textarget, sizeof(textarget));
+	trace_put(&texture, sizeof(texture));
+	trace_put(&level, sizeof(level));
+	trace_end_call();
+}
+static PFNGLFRAMEBUFFERTEXTURE2DPROC trace_real_glFramebufferTexture2D = NULL;
+static void APIENTRY trace_glFramebufferTexture2D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level) {
+	trace_real_glFramebufferTexture2D(target, attachment, textarget, texture, level);
+	trace_begin_call(621);
+	trace_put(&target, sizeof(target));
+	trace_put(&attachment, sizeof(attachment));
+	trace_put(&textarget, sizeof(textarget));
+	trace_put(&texture, sizeof(texture));
+	trace_put(&level, sizeof(level));
+	trace_end_call();
+}
+static PFNGLFRAMEBUFFERTEXTURE3DPROC trace_real_glFramebufferTexture3D = NULL;
+static void APIENTRY trace_glFramebufferTexture3D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLint zoffset) {
+	trace_real_glFramebufferTexture3D(target, attachment, textarget, texture, level, zoffset);
+	trace_begin_call(622);
+	trace_put(&target, sizeof(target));
+	trace_put(&attachment, sizeof(attachment));
+	trace_put(&textarget, sizeof(textarget));
+	trace_put(&texture, sizeof(texture));
+	trace_put(&level, sizeof(level));
+	trace_put(&zoffset, sizeof(zoffset));
+	trace_end_call();
+}
+static PFNGLFRAMEBUFFERRENDERBUFFERPROC trace_real_glFramebufferRenderbuffer = NULL;
+static void APIENTRY trace_glFramebufferRenderbuffer(GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer) {
+	trace_real_glFramebufferRenderbuffer(target, attachment, renderbuffertarget, renderbuffer);
+	trace_begin_call(623);
+	trace_put(&target, sizeof(target));
+	trace_put(&attachment, sizeof(attachment));
+	trace_put(&renderbuffertarget, sizeof(renderbuffertarget));
+	trace_put(&renderbuffer, sizeof(renderbuffer));
+	trace_end_call();
+}
+static PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC trace_real_glGetFramebufferAttachmentParameteriv = NULL;
+static void APIENTRY trace_glGetFramebufferAttachmentParameteriv(GLenum target, GLenum attachment, GLenum pname, GLint *params) {
+	trace_real_glGetFramebufferAttachmentParameteriv(target, attachment, pname, params);
+	trace_begin_call(624);
+	trace_put(&target, sizeof(target));
+	trace_put(&attachment, sizeof(attachment));
+	trace_put(&pname, sizeof(pname));
+	trace_end_call();
+}
+static PFNGLGENERATEMIPMAPPROC trace_real_glGenerateMipmap = NULL;
+static void APIENTRY trace_glGenerateMipmap(GLenum target) {
+	trace_real_glGenerateMipmap(target);
+	trace_begin_call(625);
+	trace_put(&target, sizeof(target));
+	trace_end_call();
+}
+static PFNGLBLITFRAMEBUFFERPROC trace_real_glBlitFramebuffer = NULL;
+static void APIENTRY trace_glBlitFramebuffer(GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter) {
+	trace_real_glBlitFramebuffer(srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
+	trace_begin_call(626);
+	trace_put(&srcX0, sizeof(srcX0));
+	trace_put(&srcY0, sizeof(srcY0));
+	trace_put(&srcX1, sizeof(srcX1));
+	trace_put(&srcY1, sizeof(srcY1));
+	trace_put(&dstX0, sizeof(dstX0));
+	trace_put(&dstY0, sizeof(dstY0));
+	trace_put(&dstX1, sizeof(dstX1));
+	trace_put(&dstY1, sizeof(dstY1));
+	trace_put(&mask, sizeof(mask));
+	trace_put(&filter, sizeof(filter));
+	trace_end_call();
+}
+static PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC trace_real_glRenderbufferStorageMultisample = NULL;
+static void APIENTRY trace_glRenderbufferStorageMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height) {
+	trace_real_glRenderbufferStorageMultisample(target, samples, internalformat, width, height);
+	trace_begin_call(627);
+	trace_put(&target, sizeof(target));
+	trace_put(&samples, sizeof(samples));
+	trace_put(&internalformat, sizeof(internalformat));
+	trace_put(&width, sizeof(width));
+	trace_put(&height, sizeof(height));
+	trace_end_call();
+}
+static PFNGLFRAMEBUFFERTEXTURELAYERPROC trace_real_glFramebufferTextureLayer = NULL;
+static void APIENTRY trace_glFramebufferTextureLayer(GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer) {
+	trace_real_glFramebufferTextureLayer(target, attachment, texture, level, layer);
+	trace_begin_call(628);
+	trace_put(&target, sizeof(target));
+	trace_put(&attachment, sizeof(attachment));
+	trace_put(&texture, sizeof(texture));
+	trace_put(&level, sizeof(level));
+	trace_put(&layer, sizeof(layer));
+	trace_end_call();
+}
+static PFNGLMAPBUFFERRANGEPROC trace_real_glMapBufferRange = NULL;
+static void * APIENTRY trace_glMapBufferRange(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access) {
+	void * glad_result;
+	glad_result = trace_real_glMapBufferRange(target, offset, length, access);
+	trace_begin_call(629);
+	trace_put(&target, sizeof(target));
+	trace_put(&offset, sizeof(offset));
+	trace_put(&length, sizeof(length));
+	trace_put(&access, sizeof(access));
+	trace_end_call();
+	trace_hook_map(target, glad_result, offset, length, access);
+	return glad_result;
+}
+static PFNGLFLUSHMAPPEDBUFFERRANGEPROC trace_real_glFlushMappedBufferRange = NULL;
+static void APIENTRY trace_glFlushMappedBufferRange(GLenum target, GLintptr offset, GLsizeiptr length) {
+	trace_real_glFlushMappedBufferRange(target, offset, length);
+	trace_begin_call(630);
+	trace_put(&target, sizeof(target));
+	trace_put(&offset, sizeof(offset));
+	trace_put(&length, sizeof(length));
+	trace_end_call();
+}
+static PFNGLBINDVERTEXARRAYPROC trace_real_glBindVertexArray = NULL;
+static void APIENTRY trace_glBindVertexArray(GLuint array) {
+	trace_real_glBindVertexArray(array);
+	trace_begin_call(631);
+	trace_put(&array, sizeof(array));
+	trace_end_call();
+}
+static PFNGLDELETEVERTEXARRAYSPROC trace_real_glDeleteVertexArrays = NULL;
+static void APIENTRY trace_glDeleteVertexArrays(GLsizei n, const GLuint *arrays) {
+	trace_real_glDeleteVertexArrays(n, arrays);
+	trace_begin_call(632);
+	trace_put(&n, sizeof(n));
+	trace_put_data(arrays, arrays == NULL ? 0 : (size_t)n * sizeof(GLuint));
+	trace_end_call();
+}
+static PFNGLGENVERTEXARRAYSPROC trace_real_glGenVertexArrays = NULL;
+static void APIENTRY trace_glGenVertexArrays(GLsizei n, GLuint *arrays) {
+	trace_real_glGenVertexArrays(n, arrays);
+	trace_begin_call(633);
+	trace_put(&n, sizeof(n));
+	trace_put_data(arrays, arrays == NULL ? 0 : (size_t)n * sizeof(GLuint));
+	trace_end_call();
+}
+static PFNGLISVERTEXARRAYPROC trace_real_glIsVertexArray = NULL;
+static GLboolean APIENTRY trace_glIsVertexArray(GLuint array) {
+	GLboolean glad_result;
+	glad_result = trace_real_glIsVertexArray(array);
+	trace_begin_call(634);
+	trace_put(&array, sizeof(array));
+	trace_put(&glad_result, sizeof(glad_result));
+	trace_end_call();
+	return glad_result;
+}
+static PFNGLDRAWARRAYSINSTANCEDPROC trace_real_glDrawArraysInstanced = NULL;
+static void APIENTRY trace_glDrawArraysInstanced(GLenum mode, GLint first, GLsizei count, GLsizei instancecount) {
+	trace_real_glDrawArraysInstanced(mode, first, count, instancecount);
+	trace_begin_call(635);
+	trace_put(&mode, sizeof(mode));
+	trace_put(&first, sizeof(first));
+	trace_put(&count, sizeof(count));
+	trace_put(&instancecount, sizeof(instancecount));
+	trace_end_call();
+}
+static PFNGLDRAWELEMENTSINSTANCEDPROC trace_real_glDrawElementsInstanced = NULL;
+static void APIENTRY trace_glDrawElementsInstanced(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount) {
+	trace_real_glDrawElementsInstanced(mode, count, type, indices, instancecount);
+	trace_begin_call(636);
+	trace_put(&mode, sizeof(mode));
+	trace_put(&count, sizeof(count));
+	trace_put(&type, sizeof(type));
+	trace_put_offset(indices);
+	trace_put(&instancecount, sizeof(instancecount));
+	trace_end_call();
+}
+static PFNGLTEXBUFFERPROC trace_real_glTexBuffer = NULL;
+static void APIENTRY trace_glTexBuffer(GLenum target, GLenum internalformat, GLuint buffer) {
+	trace_real_glTexBuffer(target, internalformat, buffer);
+	trace_begin_call(637);
+	trace_put(&target, sizeof(target));
+	trace_put(&internalformat, sizeof(internalformat));
+	trace_put(&buffer, sizeof(buffer));
+	trace_end_call();
+}
+static PFNGLPRIMITIVERESTARTINDEXPROC trace_real_glPrimitiveRestartIndex = NULL;
+static void APIENTRY trace_glPrimitiveRestartIndex(GLuint index) {
+	trace_real_glPrimitiveRestartIndex(index);
+	trace_begin_call(638);
+	trace_put(&index, sizeof(index));
+	trace_end_call();
+}
+static PFNGLCOPYBUFFERSUBDATAPROC trace_real_glCopyBufferSubData = NULL;
+static void APIENTRY trace_glCopyBufferSubData(GLenum readTarget, GLenum writeTarget, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size) {
+	trace_real_glCopyBufferSubData(readTarget, writeTarget, readOffset, writeOffset, size);
+	trace_begin_call(639);
+	trace_put(&readTarget, sizeof(readTarget));
+	trace_put(&writeTarget, sizeof(writeTarget));
+	trace_put(&readOffset, sizeof(readOffset));
+	trace_put(&writeOffset, sizeof(writeOffset));
+	trace_put(&size, sizeof(size));
+	trace_end_call();
+}
+static PFNGLGETUNIFORMINDICESPROC trace_real_glGetUniformIndices = NULL;
+static void APIENTRY trace_glGetUniformIndices(GLuint program, GLsizei uniformCount, const GLchar *const*uniformNames, GLuint *uniformIndices) {
+	trace_real_glGetUniformIndices(program, uniformCount, uniformNames, uniformIndices);
+	trace_begin_call(640);
+	trace_put(&program, sizeof(program));
+	trace_put(&uniformCount, sizeof(uniformCount));
+	trace_put_strings(uniformCount, (const GLchar *const*)uniformNames, NULL);
+	trace_end_call();
+}
+static PFNGLGETACTIVEUNIFORMSIVPROC trace_real_glGetActiveUniformsiv = NULL;
+static void APIENTRY trace_glGetActiveUniformsiv(GLuint program, GLsizei uniformCount, const GLuint *uniformIndices, GLenum pname, GLint *params) {
+	trace_real_glGetActiveUniformsiv(program, uniformCount, uniformIndices, pname, params);
+	trace_begin_call(641);
+	trace_put(&program, sizeof(program));
+	trace_put(&uniformCount, sizeof(uniformCount));
+	trace_put_data(uniformIndices, uniformIndices == NULL ? 0 : (size_t)(uniformCount * sizeof(GLuint)));
+	trace_put(&pname, sizeof(pname));
+	trace_end_call();
+}
+static PFNGLGETACTIVEUNIFORMNAMEPROC trace_real_glGetActiveUniformName = NULL;
+static void APIENTRY trace_glGetActiveUniformName(GLuint program, GLuint uniformIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformName) {
+	trace_real_glGetActiveUniformName(program, uniformIndex, bufSize, length, uniformName);
+	trace_begin_call(642);
+	trace_put(&program, sizeof(program));
+	trace_put(&uniformIndex, sizeof(uniformIndex));
+	trace_put(&bufSize, sizeof(bufSize));
+	trace_end_call();
+}
+static PFNGLGETUNIFORMBLOCKINDEXPROC trace_real_glGetUniformBlockIndex = NULL;
+static GLuint APIENTRY trace_glGetUniformBlockIndex(GLuint program, const GLchar *uniformBlockName) {
+	GLuint glad_result;
+	glad_result = trace_real_glGetUniformBlockIndex(program, uniformBlockName);
+	trace_begin_call(643);
+	trace_put(&program, sizeof(program));
+	trace_put_string(uniformBlockName, -1);
+	trace_put(&glad_result, sizeof(glad_result));
+	trace_end_call();
+	return glad_result;
+}
+static PFNGLGETACTIVEUNIFORMBLOCKIVPROC trace_real_glGetActiveUniformBlockiv = NULL;
+static void APIENTRY trace_glGetActiveUniformBlockiv(GLuint program, GLuint uniformBlockIndex, GLenum pname, GLint *params) {
+	trace_real_glGetActiveUniformBlockiv(program, uniformBlockIndex, pname, params);
+	trace_begin_call(644);
+	trace_put(&program, sizeof(program));
+	trace_put(&uniformBlockIndex, sizeof(uniformBlockIndex));
+	trace_put(&pname, sizeof(pname));
+	trace_end_call();
+}
+static PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC trace_real_glGetActiveUniformBlockName = NULL;
+static void APIENTRY trace_glGetActiveUniformBlockName(GLuint program, GLuint uniformBlockIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformBlockName) {
+	trace_real_glGetActiveUniformBlockName(program, uniformBlockIndex, bufSize, length, uniformBlockName);
+	trace_begin_call(645);
+	trace_put(&program, sizeof(program));
+	trace_put(&uniformBlockIndex, sizeof(uniformBlockIndex));
+	trace_put(&bufSize, sizeof(bufSize));
+	trace_end_call();
+}
+static PFNGLUNIFORMBLOCKBINDINGPROC trace_real_glUniformBlockBinding = NULL;
+static void APIENTRY trace_glUniformBlockBinding(GLuint program, GLuint uniformBlockIndex, GLuint uniformBlockBinding) {
+	trace_real_glUniformBlockBinding(program, uniformBlockIndex, uniformBlockBinding);
+	trace_begin_call(646);
+	trace_put(&program, sizeof(program));
+	trace_put(&uniformBlockIndex, sizeof(uniformBlockIndex));
+	trace_put(&uniformBlockBinding, sizeof(uniformBlockBinding));
+	trace_end_call();
+}
+static PFNGLDRAWELEMENTSBASEVERTEXPROC trace_real_glDrawElementsBaseVertex = NULL;
+static void APIENTRY trace_glDrawElementsBaseVertex(GLenum mode, GLsizei count, GLenum type, const void *indices, GLint basevertex) {
+	trace_real_glDrawElementsBaseVertex(mode, count, type, indices, basevertex);
+	trace_begin_call(647);
+	trace_put(&mode, sizeof(mode));
+	trace_put(&count, sizeof(count));
+	trace_put(&type, sizeof(type));
+	trace_put_offset(indices);
+	trace_put(&basevertex, sizeof(basevertex));
+	trace_end_call();
+}
+static PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC trace_real_glDrawRangeElementsBaseVertex = NULL;
+static void APIENTRY trace_glDrawRangeElementsBaseVertex(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices, GLint basevertex) {
+	trace_real_glDrawRangeElementsBaseVertex(mode, start, end, count, type, indices, basevertex);
+	trace_begin_call(648);
+	trace_put(&mode, sizeof(mode));
+	trace_put(&start, sizeof(start));
+	trace_put(&end, sizeof(end));
+	trace_put(&count, sizeof(count));
+	trace_put(&type, sizeof(type));
+	trace_put_offset(indices);
+	trace_put(&basevertex, sizeof(basevertex));
+	trace_end_call();
+}
+static PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC trace_real_glDrawElementsInstancedBaseVertex = NULL;
+static void APIENTRY trace_glDrawElementsInstancedBaseVertex(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex) {
+	trace_real_glDrawElementsInstancedBaseVertex(mode, count, type, indices, instancecount, basevertex);
+	trace_begin_call(649);
+	trace_put(&mode, sizeof(mode));
+	trace_put(&count, sizeof(count));
+	trace_put(&type, sizeof(type));
+	trace_put_offset(indices);
+	trace_put(&instancecount, sizeof(instancecount));
+	trace_put(&basevertex, sizeof(basevertex));
+	trace_end_call();
+}
+static PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC trace_real_glMultiDrawElementsBaseVertex = NULL;
+static void APIENTRY trace_glMultiDrawElementsBaseVertex(GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount, const GLint *basevertex) {
+	trace_real_glMultiDrawElementsBaseVertex(mode, count, type, indices, drawcount, basevertex);
+	trace_begin_call(650);
+	trace_put(&mode, sizeof(mode));
+	trace_put_unsupported(count != NULL);
+	trace_put(&type, sizeof(type));
+	trace_put_unsupported(indices != NULL);
+	trace_put(&drawcount, sizeof(drawcount));
+	trace_put_unsupported(basevertex != NULL);
+	trace_end_call();
+}
+static PFNGLPROVOKINGVERTEXPROC trace_real_glProvokingVertex = NULL;
+static void APIENTRY trace_glProvokingVertex(GLenum mode) {
+	trace_real_glProvokingVertex(mode);
+	trace_begin_call(651);
+	trace_put(&mode, sizeof(mode));
+	trace_end_call();
+}
+static PFNGLFENCESYNCPROC trace_real_glFenceSync = NULL;
+static GLsync APIENTRY trace_glFenceSync(GLenum condition, GLbitfield flags) {
+	GLsync glad_result;
+	glad_result = trace_real_glFenceSync(condition, flags);
+	trace_begin_call(652);
+	trace_put(&condition, sizeof(condition));
+	trace_put(&flags, sizeof(flags));
+	trace_put(&glad_result, sizeof(glad_result));
+	trace_end_call();
+	return glad_result;
+}
+static PFNGLISSYNCPROC trace_real_glIsSync = NULL;
+static GLboolean APIENTRY trace_glIsSync(GLsync sync) {
+	GLboolean glad_result;
+	glad_result = trace_real_glIsSync(sync);
+	trace_begin_call(653);
+	trace_put(&sync, sizeof(sync));
+	trace_put(&glad_result, sizeof(glad_result));
+	trace_end_call();
+	return glad_result;
+}
+static PFNGLDELETESYNCPROC trace_real_glDeleteSync = NULL;
+static void APIENTRY trace_glDeleteSync(GLsync sync) {
+	trace_real_glDeleteSync(sync);
+	trace_begin_call(654);
+	trace_put(&sync, sizeof(sync));
+	trace_end_call();
+}
+static PFNGLCLIENTWAITSYNCPROC trace_real_glClientWaitSync = NULL;
+static GLenum APIENTRY trace_glClientWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout) {
+	GLenum glad_result;
+	glad_result = trace_real_glClientWaitSync(sync, flags, timeout);
+	trace_begin_call(655);
+	trace_put(&sync, sizeof(sync));
+	trace_put(&flags, sizeof(flags));
+	trace_put(&timeout, sizeof(timeout));
+	trace_put(&glad_result, sizeof(glad_result));
+	trace_end_call();
+	return glad_result;
+}
+static PFNGLWAITSYNCPROC trace_real_glWaitSync = NULL;
+static void APIENTRY trace_glWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout) {
+	trace_real_glWaitSync(sync, flags, timeout);
+	trace_begin_call(656);
+	trace_put(&sync, sizeof(sync));
+	trace_put(&flags, sizeof(flags));
+	trace_put(&timeout, sizeof(timeout));
+	trace_end_call();
+}
+static PFNGLGETINTEGER64VPROC trace_real_glGetInteger64v = NULL;
+static void APIENTRY trace_glGetInteger64v(GLenum pname, GLint64 *data) {
+	trace_real_glGetInteger64v(pname, data);
+	trace_begin_call(657);
+	trace_put(&pname, sizeof(pname));
+	trace_end_call();
+}
+static PFNGLGETSYNCIVPROC trace_real_glGetSynciv = NULL;
+static void APIENTRY trace_glGetSynciv(GLsync sync, GLenum pname, GLsizei count, GLsizei *length, GLint *values) {
+	trace_real_glGetSynciv(sync, pname, count, length, values);
+	trace_begin_call(658);
+	trace_put(&sync, sizeof(sync));
+	trace_put(&pname, sizeof(pname));
+	trace_put(&count, sizeof(count));
+	trace_end_call();
+}
+static PFNGLGETINTEGER64I_VPROC trace_real_glGetInteger64i_v = NULL;
+static void APIENTRY trace_glGetInteger64i_v(GLenum target, GLuint index, GLint64 *data) {
+	trace_real_glGetInteger64i_v(target, index, data);
+	trace_begin_call(659);
+	trace_put(&target, sizeof(target));
+	trace_put(&index, sizeof(index));
+	trace_end_call();
+}
+static PFNGLGETBUFFERPARAMETERI64VPROC trace_real_glGetBufferParameteri64v = NULL;
+static void APIENTRY trace_glGetBufferParameteri64v(GLenum target, GLenum pname, GLint64 *params) {
+	trace_real_glGetBufferParameteri64v(target, pname, params);
+	trace_begin_call(660);
+	trace_put(&target, sizeof(target));
+	trace_put(&pname, sizeof(pname));
+	trace_end_call();
+}
+static PFNGLFRAMEBUFFERTEXTUREPROC trace_real_glFramebufferTexture = NULL;
+static void APIENTRY trace_glFramebufferTexture(GLenum target, GLenum attachment, GLuint texture, GLint level) {
+	trace_real_glFramebufferTexture(target, attachment, texture, level);
+	trace_begin_call(661);
+	trace_put(&target, sizeof(target));
+	trace_put(&attachment, sizeof(attachment));
+	trace_put(&texture, sizeof(texture));
+	trace_put(&level, sizeof(level));
+	trace_end_call();
+}
+static PFNGLTEXIMAGE2DMULTISAMPLEPROC trace_real_glTexImage2DMultisample = NULL;
+static void APIENTRY trace_glTexImage2DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations) {
+	trace_real_glTexImage2DMultisample(target, samples, internalformat, width, height, fixedsamplelocations);
+	trace_begin_call(662);
+	trace_put(&target, sizeof(target));
+	trace_put(&samples, sizeof(samples));
+	trace_put(&internalformat, sizeof(internalformat));
+	trace_put(&width, sizeof(width));
+	trace_put(&height, sizeof(height));
+	trace_put(&fixedsamplelocations, sizeof(fixedsamplelocations));
+	trace_end_call();
+}
+static PFNGLTEXIMAGE3DMULTISAMPLEPROC trace_real_glTexImage3DMultisample = NULL;
+static void APIENTRY trace_glTexImage3DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations) {
+	trace_real_glTexImage3DMultisample(target, samples, internalformat, width, height, depth, fixedsamplelocations);
+	trace_begin_call(663);
+	trace_put(&target, sizeof(target));
+	trace_put(&samples, sizeof(samples));
+	trace_put(&internalformat, sizeof(internalformat));
+	trace_put(&width, sizeof(width));
+	trace_put(&height, sizeof(height));
+	trace_put(&depth, sizeof(depth));
+	trace_put(&fixedsamplelocations, sizeof(fixedsamplelocations));
+	trace_end_call();
+}
+static PFNGLGETMULTISAMPLEFVPROC trace_real_glGetMultisamplefv = NULL;
+static void APIENTRY trace_glGetMultisamplefv(GLenum pname, GLuint index, GLfloat *val) {
+	trace_real_glGetMultisamplefv(pname, index, val);
+	trace_begin_call(664);
+	trace_put(&pname, sizeof(pname));
+	trace_put(&index, sizeof(index));
+	trace_end_call();
+}
+static PFNGLSAMPLEMASKIPROC trace_real_glSampleMaski = NULL;
+static void APIENTRY trace_glSampleMaski(GLuint maskNumber, GLbitfield mask) {
+	trace_real_glSampleMaski(maskNumber, mask);
+	trace_begin_call(665);
+	trace_put(&maskNumber, sizeof(maskNumber));
+	trace_put(&mask, sizeof(mask));
+	trace_end_call();
+}
+static PFNGLBINDFRAGDATALOCATIONINDEXEDPROC trace_real_glBindFragDataLocationIndexed = NULL;
+static void APIENTRY trace_glBindFragDataLocationIndexed(GLuint program, GLuint colorNumber, GLuint index, const GLchar *name) {
+	trace_real_glBindFragDataLocationIndexed(program, colorNumber, index, name);
+	trace_begin_call(666);
+	trace_put(&program, sizeof(program));
+	trace_put(&colorNumber, sizeof(colorNumber));
+	trace_put(&index, sizeof(index));
+	trace_put_string(name, -1);
+	trace_end_call();
+}
+static PFNGLGETFRAGDATAINDEXPROC trace_real_glGetFragDataIndex = NULL;
+static GLint APIENTRY trace_glGetFragDataIndex(GLuint program, const GLchar *name) {
+	GLint glad_result;
+	glad_result = trace_real_glGetFragDataIndex(program, name);
+	trace_begin_call(667);
+	trace_put(&program, sizeof(program));
+	trace_put_string(name, -1);
+	trace_put(&glad_result, sizeof(glad_result));
+	trace_end_call();
+	return glad_result;
+}
+static PFNGLGENSAMPLERSPROC trace_real_glGenSamplers = NULL;
+static void APIENTRY trace_glGenSamplers(GLsizei count, GLuint *samplers) {
+	trace_real_glGenSamplers(count, samplers);
+	trace_begin_call(668);
+	trace_put(&count, sizeof(count));
+	trace_put_data(samplers, samplers == NULL ? 0 : (size_t)count * sizeof(GLuint));
+	trace_end_call();
+}
+static PFNGLDELETESAMPLERSPROC trace_real_glDeleteSamplers = NULL;
+static void APIENTRY trace_glDeleteSamplers(GLsizei count, const GLuint *samplers) {
+	trace_real_glDeleteSamplers(count, samplers);
+	trace_begin_call(669);
+	trace_put(&count, sizeof(count));
+	trace_put_data(samplers, samplers == NULL ? 0 : (size_t)count * sizeof(GLuint));
+	trace_end_call();
+}
+static PFNGLISSAMPLERPROC trace_real_glIsSampler = NULL;
+static GLboolean APIENTRY trace_glIsSampler(GLuint sampler) {
+	GLboolean glad_result;
+	glad_result = trace_real_glIsSampler(sampler);
+	trace_begin_call(670);
+	trace_put(&sampler, sizeof(sampler));
+	trace_put(&glad_result, sizeof(glad_result));
+	trace_end_call();
+	return glad_result;
+}
+static PFNGLBINDSAMPLERPROC trace_real_glBindSampler = NULL;
+static void APIENTRY trace_glBindSampler(GLuint unit, GLuint sampler) {
+	trace_real_glBindSampler(unit, sampler);
+	trace_begin_call(671);
+	trace_put(&unit, sizeof(unit));
+	trace_put(&sampler, sizeof(sampler));
+	trace_end_call();
+}
+static PFNGLSAMPLERPARAMETERIPROC trace_real_glSamplerParameteri = NULL;
+static void APIENTRY trace_glSamplerParameteri(GLuint sampler, GLenum pname, GLint param) {
+	trace_real_glSamplerParameteri(sampler, pname, param);
+	trace_begin_call(672);
+	trace_put(&sampler, sizeof(sampler));
+	trace_put(&pname, sizeof(pname));
+	trace_put(&param, sizeof(param));
+	trace_end_call();
+}
+static PFNGLSAMPLERPARAMETERIVPROC trace_real_glSamplerParameteriv = NULL;
+static void APIENTRY trace_glSamplerParameteriv(GLuint sampler, GLenum pname, const GLint *param) {
+	trace_real_glSamplerParameteriv(sampler, pname, param);
+	trace_begin_call(673);
+	trace_put(&sampler, sizeof(sampler));
+	trace_put(&pname, sizeof(pname));
+	trace_put_data(param, param == NULL ? 0 : (size_t)(trace_param_count(pname) * sizeof(GLint)));
+	trace_end_call();
+}
+static PFNGLSAMPLERPARAMETERFPROC trace_real_glSamplerParameterf = NULL;
+static void APIENTRY trace_glSamplerParameterf(GLuint sampler, GLenum pname, GLfloat param) {
+	trace_real_glSamplerParameterf(sampler, pname, param);
+	trace_begin_call(674);
+	trace_put(&sampler, sizeof(sampler));
+	trace_put(&pname, sizeof(pname));
+	trace_put(&param, sizeof(param));
+	trace_end_call();
+}
+static PFNGLSAMPLERPARAMETERFVPROC trace_real_glSamplerParameterfv = NULL;
+static void APIENTRY trace_glSamplerParameterfv(GLuint sampler, GLenum pname, const GLfloat *param) {
+	trace_real_glSamplerParameterfv(sampler, pname, param);
+	trace_begin_call(675);
+	trace_put(&sampler, sizeof(sampler));
+	trace_put(&pname, sizeof(pname));
+	trace_put_data(param, param == NULL ? 0 : (size_t)(trace_param_count(pname) * sizeof(GLfloat)));
+	trace_end_call();
+}
+static PFNGLSAMPLERPARAMETERIIVPROC trace_real_glSamplerParameterIiv = NULL;
+static void APIENTRY trace_glSamplerParameterIiv(GLuint sampler, GLenum pname, const GLint *param) {
+	trace_real_glSamplerParameterIiv(sampler, pname, param);
+	trace_begin_call(676);
+	trace_put(&sampler, sizeof(sampler));
+	trace_put(&pname, sizeof(pname));
+	trace_put_data(param, param == NULL ? 0 : (size_t)(trace_param_count(pname) * sizeof(GLint)));
+	trace_end_call();
+}
+static PFNGLSAMPLERPARAMETERIUIVPROC trace_real_glSamplerParameterIuiv = NULL;
+static void APIENTRY trace_glSamplerParameterIuiv(GLuint sampler, GLenum pname, const GLuint *param) {
+	trace_real_glSamplerParameterIuiv(sampler, pname, param);
+	trace_begin_call(677);
+	trace_put(&sampler, sizeof(sampler));
+	trace_put(&pname, sizeof(pname));
+	trace_put_data(param, param == NULL ? 0 : (size_t)(trace_param_count(pname) * sizeof(GLuint)));
+	trace_end_call();
+}
+static PFNGLGETSAMPLERPARAMETERIVPROC trace_real_glGetSamplerParameteriv = NULL;
+static void APIENTRY trace_glGetSamplerParameteriv(GLuint sampler, GLenum pname, GLint *params) {
+	trace_real_glGetSamplerParameteriv(sampler, pname, params);
+	trace_begin_call(678);
+	trace_put(&sampler, sizeof(sampler));
+	trace_put(&pname, sizeof(pname));
+	trace_end_call();
+}
+static PFNGLGETSAMPLERPARAMETERIIVPROC trace_real_glGetSamplerParameterIiv = NULL;
+static void APIENTRY trace_glGetSamplerParameterIiv(GLuint sampler, GLenum pname, GLint *params) {
+	trace_real_glGetSamplerParameterIiv(sampler, pname, params);
+	trace_begin_call(679);
+	trace_put(&sampler, sizeof(sampler));
+	trace_put(&pname, sizeof(pname));
+	trace_end_call();
+}
+static PFNGLGETSAMPLERPARAMETERFVPROC trace_real_glGetSamplerParameterfv = NULL;
+static void APIENTRY trace_glGetSamplerParameterfv(GLuint sampler, GLenum pname, GLfloat *params) {
+	trace_real_glGetSamplerParameterfv(sampler, pname, params);
+	trace_begin_call(680);
+	trace_put(&sampler, sizeof(sampler));
+	trace_put(&pname, sizeof(pname));
+	trace_end_call();
+}
+static PFNGLGETSAMPLERPARAMETERIUIVPROC trace_real_glGetSamplerParameterIuiv = NULL;
+static void APIENTRY trace_glGetSamplerParameterIuiv(GLuint sampler, GLenum pname, GLuint *params) {
+	trace_real_glGetSamplerParameterIuiv(sampler, pname, params);
+	trace_begin_call(681);
+	trace_put(&sampler, sizeof(sampler));
+	trace_put(&pname, sizeof(pname));
+	trace_end_call();
+}
+static PFNGLQUERYCOUNTERPROC trace_real_glQueryCounter = NULL;
+static void APIENTRY trace_glQueryCounter(GLuint id, GLenum target) {
+	trace_real_glQueryCounter(id, target);
+	trace_begin_call(682);
+	trace_put(&id, sizeof(id));
+	trace_put(&target, sizeof(target));
+	trace_end_call();
+}
+static PFNGLGETQUERYOBJECTI64VPROC trace_real_glGetQueryObjecti64v = NULL;
+static void APIENTRY trace_glGetQueryObjecti64v(GLuint id, GLenum pname, GLint64 *params) {
+	trace_real_glGetQueryObjecti64v(id, pname, params);
+	trace_begin_call(683);
+	trace_put(&id, sizeof(id));
+	trace_put(&pname, sizeof(pname));
+	trace_end_call();
+}
+static PFNGLGETQUERYOBJECTUI64VPROC trace_real_glGetQueryObjectui64v = NULL;
+static void APIENTRY trace_glGetQueryObjectui64v(GLuint id, GLenum pname, GLuint64 *params) {
+	trace_real_glGetQueryObjectui64v(id, pname, params);
+	trace_begin_call(684);
+	trace_put(&id, sizeof(id));
+	trace_put(&pname, sizeof(pname));
+	trace_end_call();
+}
+static PFNGLVERTEXATTRIBDIVISORPROC trace_real_glVertexAttribDivisor = NULL;
+static void APIENTRY trace_glVertexAttribDivisor(GLuint index, GLuint divisor) {
+	trace_real_glVertexAttribDivisor(index, divisor);
+	trace_begin_call(685);
+	trace_put(&index, sizeof(index));
+	trace_put(&divisor, sizeof(divisor));
+	trace_end_call();
+}
+static PFNGLVERTEXATTRIBP1UIPROC trace_real_glVertexAttribP1ui = NULL;
+static void APIENTRY trace_glVertexAttribP1ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+	trace_real_glVertexAttribP1ui(index, type, normalized, value);
+	trace_begin_call(686);
+	trace_put(&index, sizeof(index));
+	trace_put(&type, sizeof(type));
+	trace_put(&normalized, sizeof(normalized));
+	trace_put(&value, sizeof(value));
+	trace_end_call();
+}
+static PFNGLVERTEXATTRIBP1UIVPROC trace_real_glVertexAttribP1uiv = NULL;
+static void APIENTRY trace_glVertexAttribP1uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) {
+	trace_real_glVertexAttribP1uiv(index, type, normalized, value);
+	trace_begin_call(687);
+	trace_put(&index, sizeof(index));
+	trace_put(&type, sizeof(type));
+	trace_put(&normalized, sizeof(normalized));
+	trace_put_data(value, value == NULL ? 0 : (size_t)(sizeof(GLuint)));
+	trace_end_call();
+}
+static PFNGLVERTEXATTRIBP2UIPROC trace_real_glVertexAttribP2ui = NULL;
+static void APIENTRY trace_glVertexAttribP2ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+	trace_real_glVertexAttribP2ui(index, type, normalized, value);
+	trace_begin_call(688);
+	trace_put(&index, sizeof(index));
+	trace_put(&type, sizeof(type));
+	trace_put(&normalized, sizeof(normalized));
+	trace_put(&value, sizeof(value));
+	trace_end_call();
+}
+static PFNGLVERTEXATTRIBP2UIVPROC trace_real_glVertexAttribP2uiv = NULL;
+static void APIENTRY trace_glVertexAttribP2uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) {
+	trace_real_glVertexAttribP2uiv(index, type, normalized, value);
+	trace_begin_call(689);
+	trace_put(&index, sizeof(index));
+	trace_put(&type, sizeof(type));
+	trace_put(&normalized, sizeof(normalized));
+	trace_put_data(value, value == NULL ? 0 : (size_t)(sizeof(GLuint)));
+	trace_end_call();
+}
+static PFNGLVERTEXATTRIBP3UIPROC trace_real_glVertexAttribP3ui = NULL;
+static void APIENTRY trace_glVertexAttribP3ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+	trace_real_glVertexAttribP3ui(index, type, normalized, value);
+	trace_begin_call(690);
+	trace_put(&index, sizeof(index));
+	trace_put(&type, sizeof(type));
+	trace_put(&normalized, sizeof(normalized));
+	trace_put(&value, sizeof(value));
+	trace_end_call();
+}
+static PFNGLVERTEXATTRIBP3UIVPROC trace_real_glVertexAttribP3uiv = NULL;
+static void APIENTRY trace_glVertexAttribP3uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) {
+	trace_real_glVertexAttribP3uiv(index, type, normalized, value);
+	trace_begin_call(691);
+	trace_put(&index, sizeof(index));
+	trace_put(&type, sizeof(type));
+	trace_put(&normalized, sizeof(normalized));
+	trace_put_data(value, value == NULL ? 0 : (size_t)(sizeof(GLuint)));
+	trace_end_call();
+}
+static PFNGLVERTEXATTRIBP4UIPROC trace_real_glVertexAttribP4ui = NULL;
+static void APIENTRY trace_glVertexAttribP4ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+	trace_real_glVertexAttribP4ui(index, type, normalized, value);
+	trace_begin_call(692);
+	trace_put(&index, sizeof(index));
+	trace_put(&type, sizeof(type));
+	trace_put(&normalized, sizeof(normalized));
+	trace_put(&value, sizeof(value));
+	trace_end_call();
+}
+static PFNGLVERTEXATTRIBP4UIVPROC trace_real_glVertexAttribP4uiv = NULL;
+static void APIENTRY trace_glVertexAttribP4uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) {
+	trace_real_glVertexAttribP4uiv(index, type, normalized, value);
+	trace_begin_call(693);
+	trace_put(&index, sizeof(index));
+	trace_put(&type, sizeof(type));
+	trace_put(&normalized, sizeof(normalized));
+	trace_put_data(value, value == NULL ? 0 : (size_t)(sizeof(GLuint)));
+	trace_end_call();
+}
+static PFNGLVERTEXP2UIPROC trace_real_glVertexP2ui = NULL;
+static void APIENTRY trace_glVertexP2ui(GLenum type, GLuint value) {
+	trace_real_glVertexP2ui(type, value);
+	trace_begin_call(694);
+	trace_put(&type, sizeof(type));
+	trace_put(&value, sizeof(value));
+	trace_end_call();
+}
+static PFNGLVERTEXP2UIVPROC trace_real_glVertexP2uiv = NULL;
+static void APIENTRY trace_glVertexP2uiv(GLenum type, const GLuint *value) {
+	trace_real_glVertexP2uiv(type, value);
+	trace_begin_call(695);
+	trace_put(&type, sizeof(type));
+	trace_put_data(value, value == NULL ? 0 : (size_t)(sizeof(GLuint)));
+	trace_end_call();
+}
+static PFNGLVERTEXP3UIPROC trace_real_glVertexP3ui = NULL;
+static void APIENTRY trace_glVertexP3ui(GLenum type, GLuint value) {
+	trace_real_glVertexP3ui(type, value);
+	trace_begin_call(696);
+	trace_put(&type, sizeof(type));
+	trace_put(&value, sizeof(value));
+	trace_end_call();
+}
+static PFNGLVERTEXP3UIVPROC trace_real_glVertexP3uiv = NULL;
+static void APIENTRY trace_glVertexP3uiv(GLenum type, const GLuint *value) {
+	trace_real_glVertexP3uiv(type, value);
+	trace_begin_call(697);
+	trace_put(&type, sizeof(type));
+	trace_put_data(value, value == NULL ? 0 : (size_t)(sizeof(GLuint)));
+	trace_end_call();
+}
+static PFNGLVERTEXP4UIPROC trace_real_glVertexP4ui = NULL;
+static void APIENTRY trace_glVertexP4ui(GLenum type, GLuint value) {
+	trace_real_glVertexP4ui(type, value);
+	trace_begin_call(698);
+	trace_put(&type, sizeof(type));
+	trace_put(&value, sizeof(value));
+	trace_end_call();
+}
+static PFNGLVERTEXP4UIVPROC trace_real_glVertexP4uiv = NULL;
+static void APIENTRY trace_glVertexP4uiv(GLenum type, const GLuint *value) {
+	trace_real_glVertexP4uiv(type, value);
+	trace_begin_call(699);
+	trace_put(&type, sizeof(type));
+	trace_put_data(value, value == NULL ? 0 : (size_t)(sizeof(GLuint)));
+	trace_end_call();
+}
+static PFNGLTEXCOORDP1UIPROC trace_real_glTexCoordP1ui = NULL;
+static void APIENTRY trace_glTexCoordP1ui(GLenum type, GLuint coords) {
+	trace_real_glTexCoordP1ui(type, coords);
+	trace_begin_call(700);
+	trace_put(&type, sizeof(type));
+	trace_put(&coords, sizeof(coords));
+	trace_end_call();
+}
+static PFNGLTEXCOORDP1UIVPROC trace_real_glTexCoordP1uiv = NULL;
+static void APIENTRY trace_glTexCoordP1uiv(GLenum type, const GLuint *coords) {
+	trace_real_glTexCoordP1uiv(type, coords);
+	trace_begin_call(701);
+	trace_put(&type, sizeof(type));
+	trace_put_data(coords, coords == NULL ? 0 : (size_t)(sizeof(GLuint)));
+	trace_end_call();
+}
+static PFNGLTEXCOORDP2UIPROC trace_real_glTexCoordP2ui = NULL;
+static void APIENTRY trace_glTexCoordP2ui(GLenum type, GLuint coords) {
+	trace_real_glTexCoordP2ui(type, coords);
+	trace_begin_call(702);
+	trace_put(&type, sizeof(type));
+	trace_put(&coords, sizeof(coords));
+	trace_end_call();
+}
+static PFNGLTEXCOORDP2UIVPROC trace_real_glTexCoordP2uiv = NULL;
+static void APIENTRY trace_glTexCoordP2uiv(GLenum type, const GLuint *coords) {
+	trace_real_glTexCoordP2uiv(type, coords);
+	trace_begin_call(703);
+	trace_put(&type, sizeof(type));
+	trace_put_data(coords, coords == NULL ? 0 : (size_t)(sizeof(GLuint)));
+	trace_end_call();
+}
+static PFNGLTEXCOORDP3UIPROC trace_real_glTexCoordP3ui = NULL;
+static void APIENTRY trace_glTexCoordP3ui(GLenum type, GLuint coords) {
+	trace_real_glTexCoordP3ui(type, coords);
+	trace_begin_call(704);
+	trace_put(&type, sizeof(type));
+	trace_put(&coords, sizeof(coords));
+	trace_end_call();
+}
+static PFNGLTEXCOORDP3UIVPROC trace_real_glTexCoordP3uiv = NULL;
+static void APIENTRY trace_glTexCoordP3uiv(GLenum type, const GLuint *coords) {
+	trace_real_glTexCoordP3uiv(type, coords);
+	trace_begin_call(705);
+	trace_put(&type, sizeof(type));
+	trace_put_data(coords, coords == NULL ? 0 : (size_t)(sizeof(GLuint)));
+	trace_end_call();
+}
+static PFNGLTEXCOORDP4UIPROC trace_real_glTexCoordP4ui = NULL;
+static void APIENTRY trace_glTexCoordP4ui(GLenum type, GLuint coords) {
+	trace_real_glTexCoordP4ui(type, coords);
+	trace_begin_call(706);
+	trace_put(&type, sizeof(type));
+	trace_put(&coords, sizeof(coords));
+	trace_end_call();
+}
+static PFNGLTEXCOORDP4UIVPROC trace_real_glTexCoordP4uiv = NULL;
+static void APIENTRY trace_glTexCoordP4uiv(GLenum type, const GLuint *coords) {
+	trace_real_glTexCoordP4uiv(type, coords);
+	trace_begin_call(707);
+	trace_put(&type, sizeof(type));
+	trace_put_data(coords, coords == NULL ? 0 : (size_t)(sizeof(GLuint)));
+	trace_end_call();
+}
+static PFNGLMULTITEXCOORDP1UIPROC trace_real_glMultiTexCoordP1ui = NULL;
+static void APIENTRY trace_glMultiTexCoordP1ui(GLenum texture, GLenum type, GLuint coords) {
+	trace_real_glMultiTexCoordP1ui(texture, type, coords);
+	trace_begin_call(708);
+	trace_put(&texture, sizeof(texture));
+	trace_put(&type, sizeof(type));
+	trace_put(&coords, sizeof(coords));
+	trace_end_call();
+}
+static PFNGLMULTITEXCOORDP1UIVPROC trace_real_glMultiTexCoordP1uiv = NULL;
+static void APIENTRY trace_glMultiTexCoordP1uiv(GLenum texture, GLenum type, const GLuint *coords) {
+	trace_real_glMultiTexCoordP1uiv(texture, type, coords);
+	trace_begin_call(709);
+	trace_put(&texture, sizeof(texture));
+	trace_put(&type, sizeof(type));
+	trace_put_data(coords, coords == NULL ? 0 : (size_t)(sizeof(GLuint)));
+	trace_end_call();
+}
+static PFNGLMULTITEXCOORDP2UIPROC trace_real_glMultiTexCoordP2ui = NULL;
+static void APIENTRY trace_glMultiTexCoordP2ui(GLenum texture, GLenum type, GLuint coords) {
+	trace_real_glMultiTexCoordP2ui(texture, type, coords);
+	trace_begin_call(710);
+	trace_put(&texture, sizeof(texture));
+	trace_put(&type, sizeof(type));
+	trace_put(&coords, sizeof(coords));
+	trace_end_call();
+}
+static PFNGLMULTITEXCOORDP2UIVPROC trace_real_glMultiTexCoordP2uiv = NULL;
+static void APIENTRY trace_glMultiTexCoordP2uiv(GLenum texture, GLenum type, const GLuint *coords) {
+	trace_real_glMultiTexCoordP2uiv(texture, type, coords);
+	trace_begin_call(711);
+	trace_put(&texture, sizeof(texture));
+	trace_put(&type, sizeof(type));
+	trace_put_data(coords, coords == NULL ? 0 : (size_t)(sizeof(GLuint)));
+	trace_end_call();
+}
+static PFNGLMULTITEXCOORDP3UIPROC trace_real_glMultiTexCoordP3ui = NULL;
+static void APIENTRY trace_glMultiTexCoordP3ui(GLenum texture, GLenum type, GLuint coords) {
+	trace_real_glMultiTexCoordP3ui(texture, type, coords);
+	trace_begin_call(712);
+	trace_put(&texture, sizeof(texture));
+	trace_put(&type, sizeof(type));
+	trace_put(&coords, sizeof(coords));
+	trace_end_call();
+}
+static PFNGLMULTITEXCOORDP3UIVPROC trace_real_glMultiTexCoordP3uiv = NULL;
+static void APIENTRY trace_glMultiTexCoordP3uiv(GLenum texture, GLenum type, const GLuint *coords) {
+	trace_real_glMultiTexCoordP3uiv(texture, type, coords);
+	trace_begin_call(713);
+	trace_put(&texture, sizeof(texture));
+	trace_put(&type, sizeof(type));
+	trace_put_data(coords, coords == NULL ? 0 : (size_t)(sizeof(GLuint)));
+	trace_end_call();
+}
+static PFNGLMULTITEXCOORDP4UIPROC trace_real_glMultiTexCoordP4ui = NULL;
+static void APIENTRY trace_glMultiTexCoordP4ui(GLenum texture, GLenum type, GLuint coords) {
+	trace_real_glMultiTexCoordP4ui(texture, type, coords);
+	trace_begin_call(714);
+	trace_put(&texture, sizeof(texture));
+	trace_put(&type, sizeof(type));
+	trace_put(&coords, sizeof(coords));
+	trace_end_call();
+}
+static PFNGLMULTITEXCOORDP4UIVPROC trace_real_glMultiTexCoordP4uiv = NULL;
+static void APIENTRY trace_glMultiTexCoordP4uiv(GLenum texture, GLenum type, const GLuint *coords) {
+	trace_real_glMultiTexCoordP4uiv(texture, type, coords);
+	trace_begin_call(715);
+	trace_put(&texture, sizeof(texture));
+	trace_put(&type, sizeof(type));
+	trace_put_data(coords, coords == NULL ? 0 : (size_t)(sizeof(GLuint)));
+	trace_end_call();
+}
+static PFNGLNORMALP3UIPROC trace_real_glNormalP3ui = NULL;
+static void APIENTRY trace_glNormalP3ui(GLenum type, GLuint coords) {
+	trace_real_glNormalP3ui(type, coords);
+	trace_begin_call(716);
+	trace_put(&type, sizeof(type));
+	trace_put(&coords, sizeof(coords));
+	trace_end_call();
+}
+static PFNGLNORMALP3UIVPROC trace_real_glNormalP3uiv = NULL;
+static void APIENTRY trace_glNormalP3uiv(GLenum type, const GLuint *coords) {
+	trace_real_glNormalP3uiv(type, coords);
+	trace_begin_call(717);
+	trace_put(&type, sizeof(type));
+	trace_put_data(coords, coords == NULL ? 0 : (size_t)(sizeof(GLuint)));
+	trace_end_call();
+}
+static PFNGLCOLORP3UIPROC trace_real_glColorP3ui = NULL;
+static void APIENTRY trace_glColorP3ui(GLenum type, GLuint color) {
+	trace_real_glColorP3ui(type, color);
+	trace_begin_call(718);
+	trace_put(&type, sizeof(type));
+	trace_put(&color, sizeof(color));
+	trace_end_call();
+}
+static PFNGLCOLORP3UIVPROC trace_real_glColorP3uiv = NULL;
+static void APIENTRY trace_glColorP3uiv(GLenum type, const GLuint *color) {
+	trace_real_glColorP3uiv(type, color);
+	trace_begin_call(719);
+	trace_put(&type, sizeof(type));
+	trace_put_data(color, color == NULL ? 0 : (size_t)(sizeof(GLuint)));
+	trace_end_call();
+}
+static PFNGLCOLORP4UIPROC trace_real_glColorP4ui = NULL;
+static void APIENTRY trace_glColorP4ui(GLenum type, GLuint color) {
+	trace_real_glColorP4ui(type, color);
+	trace_begin_call(720);
+	trace_put(&type, sizeof(type));
+	trace_put(&color, sizeof(color));
+	trace_end_call();
+}
+static PFNGLCOLORP4UIVPROC trace_real_glColorP4uiv = NULL;
+static void APIENTRY trace_glColorP4uiv(GLenum type, const GLuint *color) {
+	trace_real_glColorP4uiv(type, color);
+	trace_begin_call(721);
+	trace_put(&type, sizeof(type));
+	trace_put_data(color, color == NULL ? 0 : (size_t)(sizeof(GLuint)));
+	trace_end_call();
+}
+static PFNGLSECONDARYCOLORP3UIPROC trace_real_glSecondaryColorP3ui = NULL;
+static void APIENTRY trace_glSecondaryColorP3ui(GLenum type, GLuint color) {
+	trace_real_glSecondaryColorP3ui(type, color);
+	trace_begin_call(722);
+	trace_put(&type, sizeof(type));
+	trace_put(&color, sizeof(color));
+	trace_end_call();
+}
+static PFNGLSECONDARYCOLORP3UIVPROC trace_real_glSecondaryColorP3uiv = NULL;
+static void APIENTRY trace_glSecondaryColorP3uiv(GLenum type, const GLuint *color) {
+	trace_real_glSecondaryColorP3uiv(type, color);
+	trace_begin_call(723);
+	trace_put(&type, sizeof(type));
+	trace_put_data(color, color == NULL ? 0 : (size_t)(sizeof(GLuint)));
+	trace_end_call();
+}
+static PFNGLBUFFERSTORAGEPROC trace_real_glBufferStorage = NULL;
+static void APIENTRY trace_glBufferStorage(GLenum target, GLsizeiptr size, const void *data, GLbitfield flags) {
+	trace_real_glBufferStorage(target, size, data, flags);
+	trace_begin_call(724);
+	trace_put(&target, sizeof(target));
+	trace_put(&size, sizeof(size));
+	trace_put_data(data, data == NULL ? 0 : (size_t)(size));
+	trace_put(&flags, sizeof(flags));
+	trace_end_call();
+}
+static PFNGLDEBUGMESSAGECONTROLARBPROC trace_real_glDebugMessageControlARB = NULL;
+static void APIENTRY trace_glDebugMessageControlARB(GLenum source, GLenum type, GLenum severity, GLsizei count, const GLuint *ids, GLboolean enabled) {
+	trace_real_glDebugMessageControlARB(source, type, severity, count, ids, enabled);
+	trace_begin_call(725);
+	trace_put(&source, sizeof(source));
+	trace_put(&type, sizeof(type));
+	trace_put(&severity, sizeof(severity));
+	trace_put(&count, sizeof(count));
+	trace_put_data(ids, ids == NULL ? 0 : (size_t)(count * sizeof(GLuint)));
+	trace_put(&enabled, sizeof(enabled));
+	trace_end_call();
+}
+static PFNGLDEBUGMESSAGEINSERTARBPROC trace_real_glDebugMessageInsertARB = NULL;
+static void APIENTRY trace_glDebugMessageInsertARB(GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar *buf) {
+	trace_real_glDebugMessageInsertARB(source, type, id, severity, length, buf);
+	trace_begin_call(726);
+	trace_put(&source, sizeof(source));
+	trace_put(&type, sizeof(type));
+	trace_put(&id, sizeof(id));
+	trace_put(&severity, sizeof(severity));
+	trace_put(&length, sizeof(length));
+	trace_put_string(buf, length);
+	trace_end_call();
+}
+static PFNGLDEBUGMESSAGECALLBACKARBPROC trace_real_glDebugMessageCallbackARB = NULL;
+static void APIENTRY trace_glDebugMessageCallbackARB(GLDEBUGPROCARB callback, const void *userParam) {
+	trace_real_glDebugMessageCallbackARB(callback, userParam);
+	trace_begin_call(727);
+	trace_put_unsupported(callback != NULL);
+	trace_put_unsupported(userParam != NULL);
+	trace_end_call();
+}
+static PFNGLGETDEBUGMESSAGELOGARBPROC trace_real_glGetDebugMessageLogARB = NULL;
+static GLuint APIENTRY trace_glGetDebugMessageLogARB(GLuint count, GLsizei bufSize, GLenum *sources, GLenum *types, GLuint *ids, GLenum *severities, GLsizei *lengths, GLchar *messageLog) {
+	GLuint glad_result;
+	glad_result = trace_real_glGetDebugMessageLogARB(count, bufSize, sources, types, ids, severities, lengths, messageLog);
+	trace_begin_call(728);
+	trace_put(&count, sizeof(count));
+	trace_put(&bufSize, sizeof(bufSize));
+	trace_put(&glad_result, sizeof(glad_result));
+	trace_end_call();
+	return glad_result;
+}
+static PFNGLGETPROGRAMBINARYPROC trace_real_glGetProgramBinary = NULL;
+static void APIENTRY trace_glGetProgramBinary(GLuint program, GLsizei bufSize, GLsizei *length, GLenum *binaryFormat, void *binary) {
+	trace_real_glGetProgramBinary(program, bufSize, length, binaryFormat, binary);
+	trace_begin_call(729);
+	trace_put(&program, sizeof(program));
+	trace_put(&bufSize, sizeof(bufSize));
+	trace_end_call();
+}
+static PFNGLPROGRAMBINARYPROC trace_real_glProgramBinary = NULL;
+static void APIENTRY trace_glProgramBinary(GLuint program, GLenum binaryFormat, const void *binary, GLsizei length) {
+	trace_real_glProgramBinary(program, binaryFormat, binary, length);
+	trace_begin_call(730);
+	trace_put(&program, sizeof(program));
+	trace_put(&binaryFormat, sizeof(binaryFormat));
+	trace_put_data(binary, binary == NULL ? 0 : (size_t)(length));
+	trace_put(&length, sizeof(length));
+	trace_end_call();
+}
+static PFNGLPROGRAMPARAMETERIPROC trace_real_glProgramParameteri = NULL;
+static void APIENTRY trace_glProgramParameteri(GLuint program, GLenum pname, GLint value) {
+	trace_real_glProgramParameteri(program, pname, value);
+	trace_begin_call(731);
+	trace_put(&program, sizeof(program));
+	trace_put(&pname, sizeof(pname));
+	trace_put(&value, sizeof(value));
+	trace_end_call();
+}
+static PFNGLMAXSHADERCOMPILERTHREADSARBPROC trace_real_glMaxShaderCompilerThreadsARB = NULL;
+static void APIENTRY trace_glMaxShaderCompilerThreadsARB(GLuint count) {
+	trace_real_glMaxShaderCompilerThreadsARB(count);
+	trace_begin_call(732);
+	trace_put(&count, sizeof(count));
+	trace_end_call();
+}
+static PFNGLDEBUGMESSAGECONTROLPROC trace_real_glDebugMessageControl = NULL;
+static void APIENTRY trace_glDebugMessageControl(GLenum source, GLenum type, GLenum severity, GLsizei count, const GLuint *ids, GLboolean enabled) {
+	trace_real_glDebugMessageControl(source, type, severity, count, ids, enabled);
+	trace_begin_call(733);
+	trace_put(&source, sizeof(source));
+	trace_put(&type, sizeof(type));
+	trace_put(&severity, sizeof(severity));
+	trace_put(&count, sizeof(count));
+	trace_put_data(ids, ids == NULL ? 0 : (size_t)(count * sizeof(GLuint)));
+	trace_put(&enabled, sizeof(enabled));
+	trace_end_call();
+}
+static PFNGLDEBUGMESSAGEINSERTPROC trace_real_glDebugMessageInsert = NULL;
+static void APIENTRY trace_glDebugMessageInsert(GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar *buf) {
+	trace_real_glDebugMessageInsert(source, type, id, severity, length, buf);
+	trace_begin_call(734);
+	trace_put(&source, sizeof(source));
+	trace_put(&type, sizeof(type));
+	trace_put(&id, sizeof(id));
+	trace_put(&severity, sizeof(severity));
+	trace_put(&length, sizeof(length));
+	trace_put_string(buf, length);
+	trace_end_call();
+}
+static PFNGLDEBUGMESSAGECALLBACKPROC trace_real_glDebugMessageCallback = NULL;
+static void APIENTRY trace_glDebugMessageCallback(GLDEBUGPROC callback, const void *userParam) {
+	trace_real_glDebugMessageCallback(callback, userParam);
+	trace_begin_call(735);
+	trace_put_unsupported(callback != NULL);
+	trace_put_unsupported(userParam != NULL);
+	trace_end_call();
+}
+static PFNGLGETDEBUGMESSAGELOGPROC trace_real_glGetDebugMessageLog = NULL;
+static GLuint APIENTRY trace_glGetDebugMessageLog(GLuint count, GLsizei bufSize, GLenum *sources, GLenum *types, GLuint *ids, GLenum *severities, GLsizei *lengths, GLchar *messageLog) {
+	GLuint glad_result;
+	glad_result = trace_real_glGetDebugMessageLog(count, bufSize, sources, types, ids, severities, lengths, messageLog);
+	trace_begin_call(736);
+	trace_put(&count, sizeof(count));
+	trace_put(&bufSize, sizeof(bufSize));
+	trace_put(&glad_result, sizeof(glad_result));
+	trace_end_call();
+	return glad_result;
+}
+static PFNGLPUSHDEBUGGROUPPROC trace_real_glPushDebugGroup = NULL;
+static void APIENTRY trace_glPushDebugGroup(GLenum source, GLuint id, GLsizei length, const GLchar *message) {
+	trace_real_glPushDebugGroup(source, id, length, message);
+	trace_begin_call(737);
+	trace_put(&source, sizeof(source));
+	trace_put(&id, sizeof(id));
+	trace_put(&length, sizeof(length));
+	trace_put_string(message, length);
+	trace_end_call();
+}
+static PFNGLPOPDEBUGGROUPPROC trace_real_glPopDebugGroup = NULL;
+static void APIENTRY trace_glPopDebugGroup(void) {
+	trace_real_glPopDebugGroup();
+	trace_begin_call(738);
+	trace_end_call();
+}
+static PFNGLOBJECTLABELPROC trace_real_glObjectLabel = NULL;
+static void APIENTRY trace_glObjectLabel(GLenum identifier, GLuint name, GLsizei length, const GLchar *label) {
+	trace_real_glObjectLabel(identifier, name, length, label);
+	trace_begin_call(739);
+	trace_put(&identifier, sizeof(identifier));
+	trace_put(&name, sizeof(name));
+	trace_put(&length, sizeof(length));
+	trace_put_string(label, length);
+	trace_end_call();
+}
+static PFNGLGETOBJECTLABELPROC trace_real_glGetObjectLabel = NULL;
+static void APIENTRY trace_glGetObjectLabel(GLenum identifier, GLuint name, GLsizei bufSize, GLsizei *length, GLchar *label) {
+	trace_real_glGetObjectLabel(identifier, name, bufSize, length, label);
+	trace_begin_call(740);
+	trace_put(&identifier, sizeof(identifier));
+	trace_put(&name, sizeof(name));
+	trace_put(&bufSize, sizeof(bufSize));
+	trace_end_call();
+}
+static PFNGLOBJECTPTRLABELPROC trace_real_glObjectPtrLabel = NULL;
+static void APIENTRY trace_glObjectPtrLabel(const void *ptr, GLsizei length, const GLchar *label) {
+	trace_real_glObjectPtrLabel(ptr, length, label);
+	trace_begin_call(741);
+	trace_put_unsupported(ptr != NULL);
+	trace_put(&length, sizeof(length));
+	trace_put_unsupported(label != NULL);
+	trace_end_call();
+}
+static PFNGLGETOBJECTPTRLABELPROC trace_real_glGetObjectPtrLabel = NULL;
+static void APIENTRY trace_glGetObjectPtrLabel(const void *ptr, GLsizei bufSize, GLsizei *length, GLchar *label) {
+	trace_real_glGetObjectPtrLabel(ptr, bufSize, length, label);
+	trace_begin_call(742);
+	trace_put_unsupported(ptr != NULL);
+	trace_put(&bufSize, sizeof(bufSize));
+	trace_end_call();
+}
+static PFNGLMAXSHADERCOMPILERTHREADSKHRPROC trace_real_glMaxShaderCompilerThreadsKHR = NULL;
+static void APIENTRY trace_glMaxShaderCompilerThreadsKHR(GLuint count) {
+	trace_real_glMaxShaderCompilerThreadsKHR(count);
+	trace_begin_call(743);
+	trace_put(&count, sizeof(count));
+	trace_end_call();
+}
+
+static void trace_install(void) {
+	trace_real_glCullFace = glad_glCullFace;
+	if(trace_real_glCullFace != NULL) glad_glCullFace = trace_glCullFace;
+	trace_real_glFrontFace = glad_glFrontFace;
+	if(trace_real_glFrontFace != NULL) glad_glFrontFace = trace_glFrontFace;
+	trace_real_glHint = glad_glHint;
+	if(trace_real_glHint != NULL) glad_glHint = trace_glHint;
+	trace_real_glLineWidth = glad_glLineWidth;
+	if(trace_real_glLineWidth != NULL) glad_glLineWidth = trace_glLineWidth;
+	trace_real_glPointSize = glad_glPointSize;
+	if(trace_real_glPointSize != NULL) glad_glPointSize = trace_glPointSize;
+	trace_real_glPolygonMode = glad_glPolygonMode;
+	if(trace_real_glPolygonMode != NULL) glad_glPolygonMode = trace_glPolygonMode;
+	trace_real_glScissor = glad_glScissor;
+	if(trace_real_glScissor != NULL) glad_glScissor = trace_glScissor;
+	trace_real_glTexParameterf = glad_glTexParameterf;
+	if(trace_real_glTexParameterf != NULL) glad_glTexParameterf = trace_glTexParameterf;
+	trace_real_glTexParameterfv = glad_glTexParameterfv;
+	if(trace_real_glTexParameterfv != NULL) glad_glTexParameterfv = trace_glTexParameterfv;
+	trace_real_glTexParameteri = glad_glTexParameteri;
+	if(trace_real_glTexParameteri != NULL) glad_glTexParameteri = trace_glTexParameteri;
+	trace_real_glTexParameteriv = glad_glTexParameteriv;
+	if(trace_real_glTexParameteriv != NULL) glad_glTexParameteriv = trace_glTexParameteriv;
+	trace_real_glTexImage1D = glad_glTexImage1D;
+	if(trace_real_glTexImage1D != NULL) glad_glTexImage1D = trace_glTexImage1D;
+	trace_real_glTexImage2D = glad_glTexImage2D;
+	if(trace_real_glTexImage2D != NULL) glad_glTexImage2D = trace_glTexImage2D;
+	trace_real_glDrawBuffer = glad_glDrawBuffer;
+	if(trace_real_glDrawBuffer != NULL) glad_glDrawBuffer = trace_glDrawBuffer;
+	trace_real_glClear = glad_glClear;
+	if(trace_real_glClear != NULL) glad_glClear = trace_glClear;
+	trace_real_glClearColor = glad_glClearColor;
+	if(trace_real_glClearColor != NULL) glad_glClearColor = trace_glClearColor;
+	trace_real_glClearStencil = glad_glClearStencil;
+	if(trace_real_glClearStencil != NULL) glad_glClearStencil = trace_glClearStencil;
+	trace_real_glClearDepth = glad_glClearDepth;
+	if(trace_real_glClearDepth != NULL) glad_glClearDepth = trace_glClearDepth;
+	trace_real_glStencilMask = glad_glStencilMask;
+	if(trace_real_glStencilMask != NULL) glad_glStencilMask = trace_glStencilMask;
+	trace_real_glColorMask = glad_glColorMask;
+	if(trace_real_glColorMask != NULL) glad_glColorMask = trace_glColorMask;
+	trace_real_glDepthMask = glad_glDepthMask;
+	if(trace_real_glDepthMask != NULL) glad_glDepthMask = trace_glDepthMask;
+	trace_real_glDisable = glad_glDisable;
+	if(trace_real_glDisable != NULL) glad_glDisable = trace_glDisable;
+	trace_real_glEnable = glad_glEnable;
+	if(trace_real_glEnable != NULL) glad_glEnable = trace_glEnable;
+	trace_real_glFinish = glad_glFinish;
+	if(trace_real_glFinish != NULL) glad_glFinish = trace_glFinish;
+	trace_real_glFlush = glad_glFlush;
+	if(trace_real_glFlush != NULL) glad_glFlush = trace_glFlush;
+	trace_real_glBlendFunc = glad_glBlendFunc;
+	if(trace_real_glBlendFunc != NULL) glad_glBlendFunc = trace_glBlendFunc;
+	trace_real_glLogicOp = glad_glLogicOp;
+	if(trace_real_glLogicOp != NULL) glad_glLogicOp = trace_glLogicOp;
+	trace_real_glStencilFunc = glad_glStencilFunc;
+	if(trace_real_glStencilFunc != NULL) glad_glStencilFunc = trace_glStencilFunc;
+	trace_real_glStencilOp = glad_glStencilOp;
+	if(trace_real_glStencilOp != NULL) glad_glStencilOp = trace_glStencilOp;
+	trace_real_glDepthFunc = glad_glDepthFunc;
+	if(trace_real_glDepthFunc != NULL) glad_glDepthFunc = trace_glDepthFunc;
+	trace_real_glPixelStoref = glad_glPixelStoref;
+	if(trace_real_glPixelStoref != NULL) glad_glPixelStoref = trace_glPixelStoref;
+	trace_real_glPixelStorei = glad_glPixelStorei;
+	if(trace_real_glPixelStorei != NULL) glad_glPixelStorei = trace_glPixelStorei;
+	trace_real_glReadBuffer = glad_glReadBuffer;
+	if(trace_real_glReadBuffer != NULL) glad_glReadBuffer = trace_glReadBuffer;
+	trace_real_glReadPixels = glad_glReadPixels;
+	if(trace_real_glReadPixels != NULL) glad_glReadPixels = trace_glReadPixels;
+	trace_real_glGetBooleanv = glad_glGetBooleanv;
+	if(trace_real_glGetBooleanv != NULL) glad_glGetBooleanv = trace_glGetBooleanv;
+	trace_real_glGetDoublev = glad_glGetDoublev;
+	if(trace_real_glGetDoublev != NULL) glad_glGetDoublev = trace_glGetDoublev;
+	trace_real_glGetError = glad_glGetError;
+	if(trace_real_glGetError != NULL) glad_glGetError = trace_glGetError;
+	trace_real_glGetFloatv = glad_glGetFloatv;
+	if(trace_real_glGetFloatv != NULL) glad_glGetFloatv = trace_glGetFloatv;
+	trace_real_glGetIntegerv = glad_glGetIntegerv;
+	if(trace_real_glGetIntegerv != NULL) glad_glGetIntegerv = trace_glGetIntegerv;
+	trace_real_glGetString = glad_glGetString;
+	if(trace_real_glGetString != NULL) glad_glGetString = trace_glGetString;
+	trace_real_glGetTexImage = glad_glGetTexImage;
+	if(trace_real_glGetTexImage != NULL) glad_glGetTexImage = trace_glGetTexImage;
+	trace_real_glGetTexParameterfv = glad_glGetTexParameterfv;
+	if(trace_real_glGetTexParameterfv != NULL) glad_glGetTexParameterfv = trace_glGetTexParameterfv;
+	trace_real_glGetTexParameteriv = glad_glGetTexParameteriv;
+	if(trace_real_glGetTexParameteriv != NULL) glad_glGetTexParameteriv = trace_glGetTexParameteriv;
+	trace_real_glGetTexLevelParameterfv = glad_glGetTexLevelParameterfv;
+	if(trace_real_glGetTexLevelParameterfv != NULL) glad_glGetTexLevelParameterfv = trace_glGetTexLevelParameterfv;
+	trace_real_glGetTexLevelParameteriv = glad_glGetTexLevelParameteriv;
+	if(trace_real_glGetTexLevelParameteriv != NULL) glad_glGetTexLevelParameteriv = trace_glGetTexLevelParameteriv;
+	trace_real_glIsEnabled = glad_glIsEnabled;
+	if(trace_real_glIsEnabled != NULL) glad_glIsEnabled = trace_glIsEnabled;
+	trace_real_glDepthRange = glad_glDepthRange;
+	if(trace_real_glDepthRange != NULL) glad_glDepthRange = trace_glDepthRange;
+	trace_real_glViewport = glad_glViewport;
+	if(trace_real_glViewport != NULL) glad_glViewport = trace_glViewport;
+	trace_real_glNewList = glad_glNewList;
+	if(trace_real_glNewList != NULL) glad_glNewList = trace_glNewList;
+	trace_real_glEndList = glad_glEndList;
+	if(trace_real_glEndList != NULL) glad_glEndList = trace_glEndList;
+	trace_real_glCallList = glad_glCallList;
+	if(trace_real_glCallList != NULL) glad_glCallList = trace_glCallList;
+	trace_real_glCallLists = glad_glCallLists;
+	if(trace_real_glCallLists != NULL) glad_glCallLists = trace_glCallLists;
+	trace_real_glDeleteLists = glad_glDeleteLists;
+	if(trace_real_glDeleteLists != NULL) glad_glDeleteLists = trace_glDeleteLists;
+	trace_real_glGenLists = glad_glGenLists;
+	if(trace_real_glGenLists != NULL) glad_glGenLists = trace_glGenLists;
+	trace_real_glListBase = glad_glListBase;
+	if(trace_real_glListBase != NULL) glad_glListBase = trace_glListBase;
+	trace_real_glBegin = glad_glBegin;
+	if(trace_real_glBegin != NULL) glad_glBegin = trace_glBegin;
+	trace_real_glBitmap = glad_glBitmap;
+	if(trace_real_glBitmap != NULL) glad_glBitmap = trace_glBitmap;
+	trace_real_glColor3b = glad_glColor3b;
+	if(trace_real_glColor3b != NULL) glad_glColor3b = trace_glColor3b;
+	trace_real_glColor3bv = glad_glColor3bv;
+	if(trace_real_glColor3bv != NULL) glad_glColor3bv = trace_glColor3bv;
+	trace_real_glColor3d = glad_glColor3d;
+	if(trace_real_glColor3d != NULL) glad_glColor3d = trace_glColor3d;
+	trace_real_glColor3dv = glad_glColor3dv;
+	if(trace_real_glColor3dv != NULL) glad_glColor3dv = trace_glColor3dv;
+	trace_real_glColor3f = glad_glColor3f;
+	if(trace_real_glColor3f != NULL) glad_glColor3f = trace_glColor3f;
+	trace_real_glColor3fv = glad_glColor3fv;
+	if(trace_real_glColor3fv != NULL) glad_glColor3fv = trace_glColor3fv;
+	trace_real_glColor3i = glad_glColor3i;
+	if(trace_real_glColor3i != NULL) glad_glColor3i = trace_glColor3i;
+	trace_real_glColor3iv = glad_glColor3iv;
+	if(trace_real_glColor3iv != NULL) glad_glColor3iv = trace_glColor3iv;
+	trace_real_glColor3s = glad_glColor3s;
+	if(trace_real_glColor3s != NULL) glad_glColor3s = trace_glColor3s;
+	trace_real_glColor3sv = glad_glColor3sv;
+	if(trace_real_glColor3sv != NULL) glad_glColor3sv = trace_glColor3sv;
+	trace_real_glColor3ub = glad_glColor3ub;
+	if(trace_real_glColor3ub != NULL) glad_glColor3ub = trace_glColor3ub;
+	trace_real_glColor3ubv = glad_glColor3ubv;
+	if(trace_real_glColor3ubv != NULL) glad_glColor3ubv = trace_glColor3ubv;
+	trace_real_glColor3ui = glad_glColor3ui;
+	if(trace_real_glColor3ui != NULL) glad_glColor3ui = trace_glColor3ui;
+	trace_real_glColor3uiv = glad_glColor3uiv;
+	if(trace_real_glColor3uiv != NULL) glad_glColor3uiv = trace_glColor3uiv;
+	trace_real_glColor3us = glad_glColor3us;
+	if(trace_real_glColor3us != NULL) glad_glColor3us = trace_glColor3us;
+	trace_real_glColor3usv = glad_glColor3usv;
+	if(trace_real_glColor3usv != NULL) glad_glColor3usv = trace_glColor3usv;
+	trace_real_glColor4b = glad_glColor4b;
+	if(trace_real_glColor4b != NULL) glad_glColor4b = trace_glColor4b;
+	trace_real_glColor4bv = glad_glColor4bv;
+	if(trace_real_glColor4bv != NULL) glad_glColor4bv = trace_glColor4bv;
+	trace_real_glColor4d = glad_glColor4d;
+	if(trace_real_glColor4d != NULL) glad_glColor4d = trace_glColor4d;
+	trace_real_glColor4dv = glad_glColor4dv;
+	if(trace_real_glColor4dv != NULL) glad_glColor4dv = trace_glColor4dv;
+	trace_real_glColor4f = glad_glColor4f;
+	if(trace_real_glColor4f != NULL) glad_glColor4f = trace_glColor4f;
+	trace_real_glColor4fv = glad_glColor4fv;
+	if(trace_real_glColor4fv != NULL) glad_glColor4fv = trace_glColor4fv;
+	trace_real_glColor4i = glad_glColor4i;
+	if(trace_real_glColor4i != NULL) glad_glColor4i = trace_glColor4i;
+	trace_real_glColor4iv = glad_glColor4iv;
+	if(trace_real_glColor4iv != NULL) glad_glColor4iv = trace_glColor4iv;
+	trace_real_glColor4s = glad_glColor4s;
+	if(trace_real_glColor4s != NULL) glad_glColor4s = trace_glColor4s;
+	trace_real_glColor4sv = glad_glColor4sv;
+	if(trace_real_glColor4sv != NULL) glad_glColor4sv = trace_glColor4sv;
+	trace_real_glColor4ub = glad_glColor4ub;
+	if(trace_real_glColor4ub != NULL) glad_glColor4ub = trace_glColor4ub;
+	trace_real_glColor4ubv = glad_glColor4ubv;
+	if(trace_real_glColor4ubv != NULL) glad_glColor4ubv = trace_glColor4ubv;
+	trace_real_glColor4ui = glad_glColor4ui;
+	if(trace_real_glColor4ui != NULL) glad_glColor4ui = trace_glColor4ui;
+	trace_real_glColor4uiv = glad_glColor4uiv;
+	if(trace_real_glColor4uiv != NULL) glad_glColor4uiv = trace_glColor4uiv;
+	trace_real_glColor4us = glad_glColor4us;
+	if(trace_real_glColor4us != NULL) glad_glColor4us = trace_glColor4us;
+	trace_real_glColor4usv = glad_glColor4usv;
+	if(trace_real_glColor4usv != NULL) glad_glColor4usv = trace_glColor4usv;
+	trace_real_glEdgeFlag = glad_glEdgeFlag;
+	if(trace_real_glEdgeFlag != NULL) glad_glEdgeFlag = trace_glEdgeFlag;
+	trace_real_glEdgeFlagv = glad_glEdgeFlagv;
+	if(trace_real_glEdgeFlagv != NULL) glad_glEdgeFlagv = trace_glEdgeFlagv;
+	trace_real_glEnd = glad_glEnd;
+	if(trace_real_glEnd != NULL) glad_glEnd = trace_glEnd;
+	trace_real_glIndexd = glad_glIndexd;
+	if(trace_real_glIndexd != NULL) glad_glIndexd = trace_glIndexd;
+	trace_real_glIndexdv = glad_glIndexdv;
+	if(trace_real_glIndexdv != NULL) glad_glIndexdv = trace_glIndexdv;
+	trace_real_glIndexf = glad_glIndexf;
+	if(trace_real_glIndexf != NULL) glad_glIndexf = trace_glIndexf;
+	trace_real_glIndexfv = glad_glIndexfv;
+	if(trace_real_glIndexfv != NULL) glad_glIndexfv = trace_glIndexfv;
+	trace_real_glIndexi = glad_glIndexi;
+	if(trace_real_glIndexi != NULL) glad_glIndexi = trace_glIndexi;
+	trace_real_glIndexiv = glad_glIndexiv;
+	if(trace_real_glIndexiv != NULL) glad_glIndexiv = trace_glIndexiv;
+	trace_real_glIndexs = glad_glIndexs;
+	if(trace_real_glIndexs != NULL) glad_glIndexs = trace_glIndexs;
+	trace_real_glIndexsv = glad_glIndexsv;
+	if(trace_real_glIndexsv != NULL) glad_glIndexsv = trace_glIndexsv;
+	trace_real_glNormal3b = glad_glNormal3b;
+	if(trace_real_glNormal3b != NULL) glad_glNormal3b = trace_glNormal3b;
+	trace_real_glNormal3bv = glad_glNormal3bv;
+	if(trace_real_glNormal3bv != NULL) glad_glNormal3bv = trace_glNormal3bv;
+	trace_real_glNormal3d = glad_glNormal3d;
+	if(trace_real_glNormal3d != NULL) glad_glNormal3d = trace_glNormal3d;
+	trace_real_glNormal3dv = glad_glNormal3dv;
+	if(trace_real_glNormal3dv != NULL) glad_glNormal3dv = trace_glNormal3dv;
+	trace_real_glNormal3f = glad_glNormal3f;
+	if(trace_real_glNormal3f != NULL) glad_glNormal3f = trace_glNormal3f;
+	trace_real_glNormal3fv = glad_glNormal3fv;
+	if(trace_real_glNormal3fv != NULL) glad_glNormal3fv = trace_glNormal3fv;
+	trace_real_glNormal3i = glad_glNormal3i;
+	if(trace_real_glNormal3i != NULL) glad_glNormal3i = trace_glNormal3i;
+	trace_real_glNormal3iv = glad_glNormal3iv;
+	if(trace_real_glNormal3iv != NULL) glad_glNormal3iv = trace_glNormal3iv;
+	trace_real_glNormal3s = glad_glNormal3s;
+	if(trace_real_glNormal3s != NULL) glad_glNormal3s = trace_glNormal3s;
+	trace_real_glNormal3sv = glad_glNormal3sv;
+	if(trace_real_glNormal3sv != NULL) glad_glNormal3sv = trace_glNormal3sv;
+	trace_real_glRasterPos2d = glad_glRasterPos2d;
+	if(trace_real_glRasterPos2d != NULL) glad_glRasterPos2d = trace_glRasterPos2d;
+	trace_real_glRasterPos2dv = glad_glRasterPos2dv;
+	if(trace_real_glRasterPos2dv != NULL) glad_glRasterPos2dv = trace_glRasterPos2dv;
+	trace_real_glRasterPos2f = glad_glRasterPos2f;
+	if(trace_real_glRasterPos2f != NULL) glad_glRasterPos2f = trace_glRasterPos2f;
+	trace_real_glRasterPos2fv = glad_glRasterPos2fv;
+	if(trace_real_glRasterPos2fv != NULL) glad_glRasterPos2fv = trace_glRasterPos2fv;
+	trace_real_glRasterPos2i = glad_glRasterPos2i;
+	if(trace_real_glRasterPos2i != NULL) glad_glRasterPos2i = trace_glRasterPos2i;
+	trace_real_glRasterPos2iv = glad_glRasterPos2iv;
+	if(trace_real_glRasterPos2iv != NULL) glad_glRasterPos2iv = trace_glRasterPos2iv;
+	trace_real_glRasterPos2s = glad_glRasterPos2s;
+	if(trace_real_glRasterPos2s != NULL) glad_glRasterPos2s = trace_glRasterPos2s;
+	trace_real_glRasterPos2sv = glad_glRasterPos2sv;
+	if(trace_real_glRasterPos2sv != NULL) glad_glRasterPos2sv = trace_glRasterPos2sv;
+	trace_real_glRasterPos3d = glad_glRasterPos3d;
+	if(trace_real_glRasterPos3d != NULL) glad_glRasterPos3d = trace_glRasterPos3d;
+	trace_real_glRasterPos3dv = glad_glRasterPos3dv;
+	if(trace_real_glRasterPos3dv != NULL) glad_glRasterPos3dv = trace_glRasterPos3dv;
+	trace_real_glRasterPos3f = glad_glRasterPos3f;
+	if(trace_real_glRasterPos3f != NULL) glad_glRasterPos3f = trace_glRasterPos3f;
+	trace_real_glRasterPos3fv = glad_glRasterPos3fv;
+	if(trace_real_glRasterPos3fv != NULL) glad_glRasterPos3fv = trace_glRasterPos3fv;
+	trace_real_glRasterPos3i = glad_glRasterPos3i;
+	if(trace_real_glRasterPos3i != NULL) glad_glRasterPos3i = trace_glRasterPos3i;
+	trace_real_glRasterPos3iv = glad_glRasterPos3iv;
+	if(trace_real_glRasterPos3iv != NULL) glad_glRasterPos3iv = trace_glRasterPos3iv;
+	trace_real_glRasterPos3s = glad_glRasterPos3s;
+	if(trace_real_glRasterPos3s != NULL) glad_glRasterPos3s = trace_glRasterPos3s;
+	trace_real_glRasterPos3sv = glad_glRasterPos3sv;
+	if(trace_real_glRasterPos3sv != NULL) glad_glRasterPos3sv = trace_glRasterPos3sv;
+	trace_real_glRasterPos4d = glad_glRasterPos4d;
+	if(trace_real_glRasterPos4d != NULL) glad_glRasterPos4d = trace_glRasterPos4d;
+	trace_real_glRasterPos4dv = glad_glRasterPos4dv;
+	if(trace_real_glRasterPos4dv != NULL) glad_glRasterPos4dv = trace_glRasterPos4dv;
+	trace_real_glRasterPos4f = glad_glRasterPos4f;
+	if(trace_real_glRasterPos4f != NULL) glad_glRasterPos4f = trace_glRasterPos4f;
+	trace_real_glRasterPos4fv = glad_glRasterPos4fv;
+	if(trace_real_glRasterPos4fv != NULL) glad_glRasterPos4fv = trace_glRasterPos4fv;
+	trace_real_glRasterPos4i = glad_glRasterPos4i;
+	if(trace_real_glRasterPos4i != NULL) glad_glRasterPos4i = trace_glRasterPos4i;
+	trace_real_glRasterPos4iv = glad_glRasterPos4iv;
+	if(trace_real_glRasterPos4iv != NULL) glad_glRasterPos4iv = trace_glRasterPos4iv;
+	trace_real_glRasterPos4s = glad_glRasterPos4s;
+	if(trace_real_glRasterPos4s != NULL) glad_glRasterPos4s = trace_glRasterPos4s;
+	trace_real_glRasterPos4sv = glad_glRasterPos4sv;
+	if(trace_real_glRasterPos4sv != NULL) glad_glRasterPos4sv = trace_glRasterPos4sv;
+	trace_real_glRectd = glad_glRectd;
+	if(trace_real_glRectd != NULL) glad_glRectd = trace_glRectd;
+	trace_real_glRectdv = glad_glRectdv;
+	if(trace_real_glRectdv != NULL) glad_glRectdv = trace_glRectdv;
+	trace_real_glRectf = glad_glRectf;
+	if(trace_real_glRectf != NULL) glad_glRectf = trace_glRectf;
+	trace_real_glRectfv = glad_glRectfv;
+	if(trace_real_glRectfv != NULL) glad_glRectfv = trace_glRectfv;
+	trace_real_glRecti = glad_glRecti;
+	if(trace_real_glRecti != NULL) glad_glRecti = trace_glRecti;
+	trace_real_glRectiv = glad_glRectiv;
+	if(trace_real_glRectiv != NULL) glad_glRectiv = trace_glRectiv;
+	trace_real_glRects = glad_glRects;
+	if(trace_real_glRects != NULL) glad_glRects = trace_glRects;
+	trace_real_glRectsv = glad_glRectsv;
+	if(trace_real_glRectsv != NULL) glad_glRectsv = trace_glRectsv;
+	trace_real_glTexCoord1d = glad_glTexCoord1d;
+	if(trace_real_glTexCoord1d != NULL) glad_glTexCoord1d = trace_glTexCoord1d;
+	trace_real_glTexCoord1dv = glad_glTexCoord1dv;
+	if(trace_real_glTexCoord1dv != NULL) glad_glTexCoord1dv = trace_glTexCoord1dv;
+	trace_real_glTexCoord1f = glad_glTexCoord1f;
+	if(trace_real_glTexCoord1f != NULL) glad_glTexCoord1f = trace_glTexCoord1f;
+	trace_real_glTexCoord1fv = glad_glTexCoord1fv;
+	if(trace_real_glTexCoord1fv != NULL) glad_glTexCoord1fv = trace_glTexCoord1fv;
+	trace_real_glTexCoord1i = glad_glTexCoord1i;
+	if(trace_real_glTexCoord1i != NULL) glad_glTexCoord1i = trace_glTexCoord1i;
+	trace_real_glTexCoord1iv = glad_glTexCoord1iv;
+	if(trace_real_glTexCoord1iv != NULL) glad_glTexCoord1iv = trace_glTexCoord1iv;
+	trace_real_glTexCoord1s = glad_glTexCoord1s;
+	if(trace_real_glTexCoord1s != NULL) glad_glTexCoord1s = trace_glTexCoord1s;
+	trace_real_glTexCoord1sv = glad_glTexCoord1sv;
+	if(trace_real_glTexCoord1sv != NULL) glad_glTexCoord1sv = trace_glTexCoord1sv;
+	trace_real_glTexCoord2d = glad_glTexCoord2d;
+	if(trace_real_glTexCoord2d != NULL) glad_glTexCoord2d = trace_glTexCoord2d;
+	trace_real_glTexCoord2dv = glad_glTexCoord2dv;
+	if(trace_real_glTexCoord2dv != NULL) glad_glTexCoord2dv = trace_glTexCoord2dv;
+	trace_real_glTexCoord2f = glad_glTexCoord2f;
+	if(trace_real_glTexCoord2f != NULL) glad_glTexCoord2f = trace_glTexCoord2f;
+	trace_real_glTexCoord2fv = glad_glTexCoord2fv;
+	if(trace_real_glTexCoord2fv != NULL) glad_glTexCoord2fv = trace_glTexCoord2fv;
+	trace_real_glTexCoord2i = glad_glTexCoord2i;
+	if(trace_real_glTexCoord2i != NULL) glad_glTexCoord2i = trace_glTexCoord2i;
+	trace_real_glTexCoord2iv = glad_glTexCoord2iv;
+	if(trace_real_glTexCoord2iv != NULL) glad_glTexCoord2iv = trace_glTexCoord2iv;
+	trace_real_glTexCoord2s = glad_glTexCoord2s;
+	if(trace_real_glTexCoord2s != NULL) glad_glTexCoord2s = trace_glTexCoord2s;
+	trace_real_glTexCoord2sv = glad_glTexCoord2sv;
+	if(trace_real_glTexCoord2sv != NULL) glad_glTexCoord2sv = trace_glTexCoord2sv;
+	trace_real_glTexCoord3d = glad_glTexCoord3d;
+	if(trace_real_glTexCoord3d != NULL) glad_glTexCoord3d = trace_glTexCoord3d;
+	trace_real_glTexCoord3dv = glad_glTexCoord3dv;
+	if(trace_real_glTexCoord3dv != NULL) glad_glTexCoord3dv = trace_glTexCoord3dv;
+	trace_real_glTexCoord3f = glad_glTexCoord3f;
+	if(trace_real_glTexCoord3f != NULL) glad_glTexCoord3f = trace_glTexCoord3f;
+	trace_real_glTexCoord3fv = glad_glTexCoord3fv;
+	if(trace_real_glTexCoord3fv != NULL) glad_glTexCoord3fv = trace_glTexCoord3fv;
+	trace_real_glTexCoord3i = glad_glTexCoord3i;
+	if(trace_real_glTexCoord3i != NULL) glad_glTexCoord3i = trace_glTexCoord3i;
+	trace_real_glTexCoord3iv = glad_glTexCoord3iv;
+	if(trace_real_glTexCoord3iv != NULL) glad_glTexCoord3iv = trace_glTexCoord3iv;
+	trace_real_glTexCoord3s = glad_glTexCoord3s;
+	if(trace_real_glTexCoord3s != NULL) glad_glTexCoord3s = trace_glTexCoord3s;
+	trace_real_glTexCoord3sv = glad_glTexCoord3sv;
+	if(trace_real_glTexCoord3sv != NULL) glad_glTexCoord3sv = trace_glTexCoord3sv;
+	trace_real_glTexCoord4d = glad_glTexCoord4d;
+	if(trace_real_glTexCoord4d != NULL) glad_glTexCoord4d = trace_glTexCoord4d;
+	trace_real_glTexCoord4dv = glad_glTexCoord4dv;
+	if(trace_real_glTexCoord4dv != NULL) glad_glTexCoord4dv = trace_glTexCoord4dv;
+	trace_real_glTexCoord4f = glad_glTexCoord4f;
+	if(trace_real_glTexCoord4f != NULL) glad_glTexCoord4f = trace_glTexCoord4f;
+	trace_real_glTexCoord4fv = glad_glTexCoord4fv;
+	if(trace_real_glTexCoord4fv != NULL) glad_glTexCoord4fv = trace_glTexCoord4fv;
+	trace_real_glTexCoord4i = glad_glTexCoord4i;
+	if(trace_real_glTexCoord4i != NULL) glad_glTexCoord4i = trace_glTexCoord4i;
+	trace_real_glTexCoord4iv = glad_glTexCoord4iv;
+	if(trace_real_glTexCoord4iv != NULL) glad_glTexCoord4iv = trace_glTexCoord4iv;
+	trace_real_glTexCoord4s = glad_glTexCoord4s;
+	if(trace_real_glTexCoord4s != NULL) glad_glTexCoord4s = trace_glTexCoord4s;
+	trace_real_glTexCoord4sv = glad_glTexCoord4sv;
+	if(trace_real_glTexCoord4sv != NULL) glad_glTexCoord4sv = trace_glTexCoord4sv;
+	trace_real_glVertex2d = glad_glVertex2d;
+	if(trace_real_glVertex2d != NULL) glad_glVertex2d = trace_glVertex2d;
+	trace_real_glVertex2dv = glad_glVertex2dv;
+	if(trace_real_glVertex2dv != NULL) glad_glVertex2dv = trace_glVertex2dv;
+	trace_real_glVertex2f = glad_glVertex2f;
+	if(trace_real_glVertex2f != NULL) glad_glVertex2f = trace_glVertex2f;
+	trace_real_glVertex2fv = glad_glVertex2fv;
+	if(trace_real_glVertex2fv != NULL) glad_glVertex2fv = trace_glVertex2fv;
+	trace_real_glVertex2i = glad_glVertex2i;
+	if(trace_real_glVertex2i != NULL) glad_glVertex2i = trace_glVertex2i;
+	trace_real_glVertex2iv = glad_glVertex2iv;
+	if(trace_real_glVertex2iv != NULL) glad_glVertex2iv = trace_glVertex2iv;
+	trace_real_glVertex2s = glad_glVertex2s;
+	if(trace_real_glVertex2s != NULL) glad_glVertex2s = trace_glVertex2s;
+	trace_real_glVertex2sv = glad_glVertex2sv;
+	if(trace_real_glVertex2sv != NULL) glad_glVertex2sv = trace_glVertex2sv;
+	trace_real_glVertex3d = glad_glVertex3d;
+	if(trace_real_glVertex3d != NULL) glad_glVertex3d = trace_glVertex3d;
+	trace_real_glVertex3dv = glad_glVertex3dv;
+	if(trace_real_glVertex3dv != NULL) glad_glVertex3dv = trace_glVertex3dv;
+	trace_real_glVertex3f = glad_glVertex3f;
+	if(trace_real_glVertex3f != NULL) glad_glVertex3f = trace_glVertex3f;
+	trace_real_glVertex3fv = glad_glVertex3fv;
+	if(trace_real_glVertex3fv != NULL) glad_glVertex3fv = trace_glVertex3fv;
+	trace_real_glVertex3i = glad_glVertex3i;
+	if(trace_real_glVertex3i != NULL) glad_glVertex3i = trace_glVertex3i;
+	trace_real_glVertex3iv = glad_glVertex3iv;
+	if(trace_real_glVertex3iv != NULL) glad_glVertex3iv = trace_glVertex3iv;
+	trace_real_glVertex3s = glad_glVertex3s;
+	if(trace_real_glVertex3s != NULL) glad_glVertex3s = trace_glVertex3s;
+	trace_real_glVertex3sv = glad_glVertex3sv;
+	if(trace_real_glVertex3sv != NULL) glad_glVertex3sv = trace_glVertex3sv;
+	trace_real_glVertex4d = glad_glVertex4d;
+	if(trace_real_glVertex4d != NULL) glad_glVertex4d = trace_glVertex4d;
+	trace_real_glVertex4dv = glad_glVertex4dv;
+	if(trace_real_glVertex4dv != NULL) glad_glVertex4dv = trace_glVertex4dv;
+	trace_real_glVertex4f = glad_glVertex4f;
+	if(trace_real_glVertex4f != NULL) glad_glVertex4f = trace_glVertex4f;
+	trace_real_glVertex4fv = glad_glVertex4fv;
+	if(trace_real_glVertex4fv != NULL) glad_glVertex4fv = trace_glVertex4fv;
+	trace_real_glVertex4i = glad_glVertex4i;
+	if(trace_real_glVertex4i != NULL) glad_glVertex4i = trace_glVertex4i;
+	trace_real_glVertex4iv = glad_glVertex4iv;
+	if(trace_real_glVertex4iv != NULL) glad_glVertex4iv = trace_glVertex4iv;
+	trace_real_glVertex4s = glad_glVertex4s;
+	if(trace_real_glVertex4s != NULL) glad_glVertex4s = trace_glVertex4s;
+	trace_real_glVertex4sv = glad_glVertex4sv;
+	if(trace_real_glVertex4sv != NULL) glad_glVertex4sv = trace_glVertex4sv;
+	trace_real_glClipPlane = glad_glClipPlane;
+	if(trace_real_glClipPlane != NULL) glad_glClipPlane = trace_glClipPlane;
+	trace_real_glColorMaterial = glad_glColorMaterial;
+	if(trace_real_glColorMaterial != NULL) glad_glColorMaterial = trace_glColorMaterial;
+	trace_real_glFogf = glad_glFogf;
+	if(trace_real_glFogf != NULL) glad_glFogf = trace_glFogf;
+	trace_real_glFogfv = glad_glFogfv;
+	if(trace_real_glFogfv != NULL) glad_glFogfv = trace_glFogfv;
+	trace_real_glFogi = glad_glFogi;
+	if(trace_real_glFogi != NULL) glad_glFogi = trace_glFogi;
+	trace_real_glFogiv = glad_glFogiv;
+	if(trace_real_glFogiv != NULL) glad_glFogiv = trace_glFogiv;
+	trace_real_glLightf = glad_glLightf;
+	if(trace_real_glLightf != NULL) glad_glLightf = trace_glLightf;
+	trace_real_glLightfv = glad_glLightfv;
+	if(trace_real_glLightfv != NULL) glad_glLightfv = trace_glLightfv;
+	trace_real_glLighti = glad_glLighti;
+	if(trace_real_glLighti != NULL) glad_glLighti = trace_glLighti;
+	trace_real_glLightiv = glad_glLightiv;
+	if(trace_real_glLightiv != NULL) glad_glLightiv = trace_glLightiv;
+	trace_real_glLightModelf = glad_glLightModelf;
+	if(trace_real_glLightModelf != NULL) glad_glLightModelf = trace_glLightModelf;
+	trace_real_glLightModelfv = glad_glLightModelfv;
+	if(trace_real_glLightModelfv != NULL) glad_glLightModelfv = trace_glLightModelfv;
+	trace_real_glLightModeli = glad_glLightModeli;
+	if(trace_real_glLightModeli != NULL) glad_glLightModeli = trace_glLightModeli;
+	trace_real_glLightModeliv = glad_glLightModeliv;
+	if(trace_real_glLightModeliv != NULL) glad_glLightModeliv = trace_glLightModeliv;
+	trace_real_glLineStipple = glad_glLineStipple;
+	if(trace_real_glLineStipple != NULL) glad_glLineStipple = trace_glLineStipple;
+	trace_real_glMaterialf = glad_glMaterialf;
+	if(trace_real_glMaterialf != NULL) glad_glMaterialf = trace_glMaterialf;
+	trace_real_glMaterialfv = glad_glMaterialfv;
+	if(trace_real_glMaterialfv != NULL) glad_glMaterialfv = trace_glMaterialfv;
+	trace_real_glMateriali = glad_glMateriali;
+	if(trace_real_glMateriali != NULL) glad_glMateriali = trace_glMateriali;
+	trace_real_glMaterialiv = glad_glMaterialiv;
+	if(trace_real_glMaterialiv != NULL) glad_glMaterialiv = trace_glMaterialiv;
+	trace_real_glPolygonStipple = glad_glPolygonStipple;
+	if(trace_real_glPolygonStipple != NULL) glad_glPolygonStipple = trace_glPolygonStipple;
+	trace_real_glShadeModel = glad_glShadeModel;
+	if(trace_real_glShadeModel != NULL) glad_glShadeModel = trace_glShadeModel;
+	trace_real_glTexEnvf = glad_glTexEnvf;
+	if(trace_real_glTexEnvf != NULL) glad_glTexEnvf = trace_glTexEnvf;
+	trace_real_glTexEnvfv = glad_glTexEnvfv;
+	if(trace_real_glTexEnvfv != NULL) glad_glTexEnvfv = trace_glTexEnvfv;
+	trace_real_glTexEnvi = glad_glTexEnvi;
+	if(trace_real_glTexEnvi != NULL) glad_glTexEnvi = trace_glTexEnvi;
+	trace_real_glTexEnviv = glad_glTexEnviv;
+	if(trace_real_glTexEnviv != NULL) glad_glTexEnviv = trace_glTexEnviv;
+	trace_real_glTexGend = glad_glTexGend;
+	if(trace_real_glTexGend != NULL) glad_glTexGend = trace_glTexGend;
+	trace_real_glTexGendv = glad_glTexGendv;
+	if(trace_real_glTexGendv != NULL) glad_glTexGendv = trace_glTexGendv;
+	trace_real_glTexGenf = glad_glTexGenf;
+	if(trace_real_glTexGenf != NULL) glad_glTexGenf = trace_glTexGenf;
+	trace_real_glTexGenfv = glad_glTexGenfv;
+	if(trace_real_glTexGenfv != NULL) glad_glTexGenfv = trace_glTexGenfv;
+	trace_real_glTexGeni = glad_glTexGeni;
+	if(trace_real_glTexGeni != NULL) glad_glTexGeni = trace_glTexGeni;
+	trace_real_glTexGeniv = glad_glTexGeniv;
+	if(trace_real_glTexGeniv != NULL) glad_glTexGeniv = trace_glTexGeniv;
+	trace_real_glFeedbackBuffer = glad_glFeedbackBuffer;
+	if(trace_real_glFeedbackBuffer != NULL) glad_glFeedbackBuffer = trace_glFeedbackBuffer;
+	trace_real_glSelectBuffer = glad_glSelectBuffer;
+	if(trace_real_glSelectBuffer != NULL) glad_glSelectBuffer = trace_glSelectBuffer;
+	trace_real_glRenderMode = glad_glRenderMode;
+	if(trace_real_glRenderMode != NULL) glad_glRenderMode = trace_glRenderMode;
+	trace_real_glInitNames = glad_glInitNames;
+	if(trace_real_glInitNames != NULL) glad_glInitNames = trace_glInitNames;
+	trace_real_glLoadName = glad_glLoadName;
+	if(trace_real_glLoadName != NULL) glad_glLoadName = trace_glLoadName;
+	trace_real_glPassThrough = glad_glPassThrough;
+	if(trace_real_glPassThrough != NULL) glad_glPassThrough = trace_glPassThrough;
+	trace_real_glPopName = glad_glPopName;
+	if(trace_real_glPopName != NULL) glad_glPopName = trace_glPopName;
+	trace_real_glPushName = glad_glPushName;
+	if(trace_real_glPushName != NULL) glad_glPushName = trace_glPushName;
+	trace_real_glClearAccum = glad_glClearAccum;
+	if(trace_real_glClearAccum != NULL) glad_glClearAccum = trace_glClearAccum;
+	trace_real_glClearIndex = glad_glClearIndex;
+	if(trace_real_glClearIndex != NULL) glad_glClearIndex = trace_glClearIndex;
+	trace_real_glIndexMask = glad_glIndexMask;
+	if(trace_real_glIndexMask != NULL) glad_glIndexMask = trace_glIndexMask;
+	trace_real_glAccum = glad_glAccum;
+	if(trace_real_glAccum != NULL) glad_glAccum = trace_glAccum;
+	trace_real_glPopAttrib = glad_glPopAttrib;
+	if(trace_real_glPopAttrib != NULL) glad_glPopAttrib = trace_glPopAttrib;
+	trace_real_glPushAttrib = glad_glPushAttrib;
+	if(trace_real_glPushAttrib != NULL) glad_glPushAttrib = trace_glPushAttrib;
+	trace_real_glMap1d = glad_glMap1d;
+	if(trace_real_glMap1d != NULL) glad_glMap1d = trace_glMap1d;
+	trace_real_glMap1f = glad_glMap1f;
+	if(trace_real_glMap1f != NULL) glad_glMap1f = trace_glMap1f;
+	trace_real_glMap2d = glad_glMap2d;
+	if(trace_real_glMap2d != NULL) glad_glMap2d = trace_glMap2d;
+	trace_real_glMap2f = glad_glMap2f;
+	if(trace_real_glMap2f != NULL) glad_glMap2f = trace_glMap2f;
+	trace_real_glMapGrid1d = glad_glMapGrid1d;
+	if(trace_real_glMapGrid1d != NULL) glad_glMapGrid1d = trace_glMapGrid1d;
+	trace_real_glMapGrid1f = glad_glMapGrid1f;
+	if(trace_real_glMapGrid1f != NULL) glad_glMapGrid1f = trace_glMapGrid1f;
+	trace_real_glMapGrid2d = glad_glMapGrid2d;
+	if(trace_real_glMapGrid2d != NULL) glad_glMapGrid2d = trace_glMapGrid2d;
+	trace_real_glMapGrid2f = glad_glMapGrid2f;
+	if(trace_real_glMapGrid2f != NULL) glad_glMapGrid2f = trace_glMapGrid2f;
+	trace_real_glEvalCoord1d = glad_glEvalCoord1d;
+	if(trace_real_glEvalCoord1d != NULL) glad_glEvalCoord1d = trace_glEvalCoord1d;
+	trace_real_glEvalCoord1dv = glad_glEvalCoord1dv;
+	if(trace_real_glEvalCoord1dv != NULL) glad_glEvalCoord1dv = trace_glEvalCoord1dv;
+	trace_real_glEvalCoord1f = glad_glEvalCoord1f;
+	if(trace_real_glEvalCoord1f != NULL) glad_glEvalCoord1f = trace_glEvalCoord1f;
+	trace_real_glEvalCoord1fv = glad_glEvalCoord1fv;
+	if(trace_real_glEvalCoord1fv != NULL) glad_glEvalCoord1fv = trace_glEvalCoord1fv;
+	trace_real_glEvalCoord2d = glad_glEvalCoord2d;
+	if(trace_real_glEvalCoord2d != NULL) glad_glEvalCoord2d = trace_glEvalCoord2d;
+	trace_real_glEvalCoord2dv = glad_glEvalCoord2dv;
+	if(trace_real_glEvalCoord2dv != NULL) glad_glEvalCoord2dv = trace_glEvalCoord2dv;
+	trace_real_glEvalCoord2f = glad_glEvalCoord2f;
+	if(trace_real_glEvalCoord2f != NULL) glad_glEvalCoord2f = trace_glEvalCoord2f;
+	trace_real_glEvalCoord2fv = glad_glEvalCoord2fv;
+	if(trace_real_glEvalCoord2fv != NULL) glad_glEvalCoord2fv = trace_glEvalCoord2fv;
+	trace_real_glEvalMesh1 = glad_glEvalMesh1;
+	if(trace_real_glEvalMesh1 != NULL) glad_glEvalMesh1 = trace_glEvalMesh1;
+	trace_real_glEvalPoint1 = glad_glEvalPoint1;
+	if(trace_real_glEvalPoint1 != NULL) glad_glEvalPoint1 = trace_glEvalPoint1;
+	trace_real_glEvalMesh2 = glad_glEvalMesh2;
+	if(trace_real_glEvalMesh2 != NULL) glad_glEvalMesh2 = trace_glEvalMesh2;
+	trace_real_glEvalPoint2 = glad_glEvalPoint2;
+	if(trace_real_glEvalPoint2 != NULL) glad_glEvalPoint2 = trace_glEvalPoint2;
+	trace_real_glAlphaFunc = glad_glAlphaFunc;
+	if(trace_real_glAlphaFunc != NULL) glad_glAlphaFunc = trace_glAlphaFunc;
+	trace_real_glPixelZoom = glad_glPixelZoom;
+	if(trace_real_glPixelZoom != NULL) glad_glPixelZoom = trace_glPixelZoom;
+	trace_real_glPixelTransferf = glad_glPixelTransferf;
+	if(trace_real_glPixelTransferf != NULL) glad_glPixelTransferf = trace_glPixelTransferf;
+	trace_real_glPixelTransferi = glad_glPixelTransferi;
+	if(trace_real_glPixelTransferi != NULL) glad_glPixelTransferi = trace_glPixelTransferi;
+	trace_real_glPixelMapfv = glad_glPixelMapfv;
+	if(trace_real_glPixelMapfv != NULL) glad_glPixelMapfv = trace_glPixelMapfv;
+	trace_real_glPixelMapuiv = glad_glPixelMapuiv;
+	if(trace_real_glPixelMapuiv != NULL) glad_glPixelMapuiv = trace_glPixelMapuiv;
+	trace_real_glPixelMapusv = glad_glPixelMapusv;
+	if(trace_real_glPixelMapusv != NULL) glad_glPixelMapusv = trace_glPixelMapusv;
+	trace_real_glCopyPixels = glad_glCopyPixels;
+	if(trace_real_glCopyPixels != NULL) glad_glCopyPixels = trace_glCopyPixels;
+	trace_real_glDrawPixels = glad_glDrawPixels;
+	if(trace_real_glDrawPixels != NULL) glad_glDrawPixels = trace_glDrawPixels;
+	trace_real_glGetClipPlane = glad_glGetClipPlane;
+	if(trace_real_glGetClipPlane != NULL) glad_glGetClipPlane = trace_glGetClipPlane;
+	trace_real_glGetLightfv = glad_glGetLightfv;
+	if(trace_real_glGetLightfv != NULL) glad_glGetLightfv = trace_glGetLightfv;
+	trace_real_glGetLightiv = glad_glGetLightiv;
+	if(trace_real_glGetLightiv != NULL) glad_glGetLightiv = trace_glGetLightiv;
+	trace_real_glGetMapdv = glad_glGetMapdv;
+	if(trace_real_glGetMapdv != NULL) glad_glGetMapdv = trace_glGetMapdv;
+	trace_real_glGetMapfv = glad_glGetMapfv;
+	if(trace_real_glGetMapfv != NULL) glad_glGetMapfv = trace_glGetMapfv;
+	trace_real_glGetMapiv = glad_glGetMapiv;
+	if(trace_real_glGetMapiv != NULL) glad_glGetMapiv = trace_glGetMapiv;
+	trace_real_glGetMaterialfv = glad_glGetMaterialfv;
+	if(trace_real_glGetMaterialfv != NULL) glad_glGetMaterialfv = trace_glGetMaterialfv;
+	trace_real_glGetMaterialiv = glad_glGetMaterialiv;
+	if(trace_real_glGetMaterialiv != NULL) glad_glGetMaterialiv = trace_glGetMaterialiv;
+	trace_real_glGetPixelMapfv = glad_glGetPixelMapfv;
+	if(trace_real_glGetPixelMapfv != NULL) glad_glGetPixelMapfv = trace_glGetPixelMapfv;
+	trace_real_glGetPixelMapuiv = glad_glGetPixelMapuiv;
+	if(trace_real_glGetPixelMapuiv != NULL) glad_glGetPixelMapuiv = trace_glGetPixelMapuiv;
+	trace_real_glGetPixelMapusv = glad_glGetPixelMapusv;
+	if(trace_real_glGetPixelMapusv != NULL) glad_glGetPixelMapusv = trace_glGetPixelMapusv;
+	trace_real_glGetPolygonStipple = glad_glGetPolygonStipple;
+	if(trace_real_glGetPolygonStipple != NULL) glad_glGetPolygonStipple = trace_glGetPolygonStipple;
+	trace_real_glGetTexEnvfv = glad_glGetTexEnvfv;
+	if(trace_real_glGetTexEnvfv != NULL) glad_glGetTexEnvfv = trace_glGetTexEnvfv;
+	trace_real_glGetTexEnviv = glad_glGetTexEnviv;
+	if(trace_real_glGetTexEnviv != NULL) glad_glGetTexEnviv = trace_glGetTexEnviv;
+	trace_real_glGetTexGendv = glad_glGetTexGendv;
+	if(trace_real_glGetTexGendv != NULL) glad_glGetTexGendv = trace_glGetTexGendv;
+	trace_real_glGetTexGenfv = glad_glGetTexGenfv;
+	if(trace_real_glGetTexGenfv != NULL) glad_glGetTexGenfv = trace_glGetTexGenfv;
+	trace_real_glGetTexGeniv = glad_glGetTexGeniv;
+	if(trace_real_glGetTexGeniv != NULL) glad_glGetTexGeniv = trace_glGetTexGeniv;
+	trace_real_glIsList = glad_glIsList;
+	if(trace_real_glIsList != NULL) glad_glIsList = trace_glIsList;
+	trace_real_glFrustum = glad_glFrustum;
+	if(trace_real_glFrustum != NULL) glad_glFrustum = trace_glFrustum;
+	trace_real_glLoadIdentity = glad_glLoadIdentity;
+	if(trace_real_glLoadIdentity != NULL) glad_glLoadIdentity = trace_glLoadIdentity;
+	trace_real_glLoadMatrixf = glad_glLoadMatrixf;
+	if(trace_real_glLoadMatrixf != NULL) glad_glLoadMatrixf = trace_glLoadMatrixf;
+	trace_real_glLoadMatrixd = glad_glLoadMatrixd;
+	if(trace_real_glLoadMatrixd != NULL) glad_glLoadMatrixd = trace_glLoadMatrixd;
+	trace_real_glMatrixMode = glad_glMatrixMode;
+	if(trace_real_glMatrixMode != NULL) glad_glMatrixMode = trace_glMatrixMode;
+	trace_real_glMultMatrixf = glad_glMultMatrixf;
+	if(trace_real_glMultMatrixf != NULL) glad_glMultMatrixf = trace_glMultMatrixf;
+	trace_real_glMultMatrixd = glad_glMultMatrixd;
+	if(trace_real_glMultMatrixd != NULL) glad_glMultMatrixd = trace_glMultMatrixd;
+	trace_real_glOrtho = glad_glOrtho;
+	if(trace_real_glOrtho != NULL) glad_glOrtho = trace_glOrtho;
+	trace_real_glPopMatrix = glad_glPopMatrix;
+	if(trace_real_glPopMatrix != NULL) glad_glPopMatrix = trace_glPopMatrix;
+	trace_real_glPushMatrix = glad_glPushMatrix;
+	if(trace_real_glPushMatrix != NULL) glad_glPushMatrix = trace_glPushMatrix;
+	trace_real_glRotated = glad_glRotated;
+	if(trace_real_glRotated != NULL) glad_glRotated = trace_glRotated;
+	trace_real_glRotatef = glad_glRotatef;
+	if(trace_real_glRotatef != NULL) glad_glRotatef = trace_glRotatef;
+	trace_real_glScaled = glad_glScaled;
+	if(trace_real_glScaled != NULL) glad_glScaled = trace_glScaled;
+	trace_real_glScalef = glad_glScalef;
+	if(trace_real_glScalef != NULL) glad_glScalef = trace_glScalef;
+	trace_real_glTranslated = glad_glTranslated;
+	if(trace_real_glTranslated != NULL) glad_glTranslated = trace_glTranslated;
+	trace_real_glTranslatef = glad_glTranslatef;
+	if(trace_real_glTranslatef != NULL) glad_glTranslatef = trace_glTranslatef;
+	trace_real_glDrawArrays = glad_glDrawArrays;
+	if(trace_real_glDrawArrays != NULL) glad_glDrawArrays = trace_glDrawArrays;
+	trace_real_glDrawElements = glad_glDrawElements;
+	if(trace_real_glDrawElements != NULL) glad_glDrawElements = trace_glDrawElements;
+	trace_real_glGetPointerv = glad_glGetPointerv;
+	if(trace_real_glGetPointerv != NULL) glad_glGetPointerv = trace_glGetPointerv;
+	trace_real_glPolygonOffset = glad_glPolygonOffset;
+	if(trace_real_glPolygonOffset != NULL) glad_glPolygonOffset = trace_glPolygonOffset;
+	trace_real_glCopyTexImage1D = glad_glCopyTexImage1D;
+	if(trace_real_glCopyTexImage1D != NULL) glad_glCopyTexImage1D = trace_glCopyTexImage1D;
+	trace_real_glCopyTexImage2D = glad_glCopyTexImage2D;
+	if(trace_real_glCopyTexImage2D != NULL) glad_glCopyTexImage2D = trace_glCopyTexImage2D;
+	trace_real_glCopyTexSubImage1D = glad_glCopyTexSubImage1D;
+	if(trace_real_glCopyTexSubImage1D != NULL) glad_glCopyTexSubImage1D = trace_glCopyTexSubImage1D;
+	trace_real_glCopyTexSubImage2D = glad_glCopyTexSubImage2D;
+	if(trace_real_glCopyTexSubImage2D != NULL) glad_glCopyTexSubImage2D = trace_glCopyTexSubImage2D;
+	trace_real_glTexSubImage1D = glad_glTexSubImage1D;
+	if(trace_real_glTexSubImage1D != NULL) glad_glTexSubImage1D = trace_glTexSubImage1D;
+	trace_real_glTexSubImage2D = glad_glTexSubImage2D;
+	if(trace_real_glTexSubImage2D != NULL) glad_glTexSubImage2D = trace_glTexSubImage2D;
+	trace_real_glBindTexture = glad_glBindTexture;
+	if(trace_real_glBindTexture != NULL) glad_glBindTexture = trace_glBindTexture;
+	trace_real_glDeleteTextures = glad_glDeleteTextures;
+	if(trace_real_glDeleteTextures != NULL) glad_glDeleteTextures = trace_glDeleteTextures;
+	trace_real_glGenTextures = glad_glGenTextures;
+	if(trace_real_glGenTextures != NULL) glad_glGenTextures = trace_glGenTextures;
+	trace_real_glIsTexture = glad_glIsTexture;
+	if(trace_real_glIsTexture != NULL) glad_glIsTexture = trace_glIsTexture;
+	trace_real_glArrayElement = glad_glArrayElement;
+	if(trace_real_glArrayElement != NULL) glad_glArrayElement = trace_glArrayElement;
+	trace_real_glColorPointer = glad_glColorPointer;
+	if(trace_real_glColorPointer != NULL) glad_glColorPointer = trace_glColorPointer;
+	trace_real_glDisableClientState = glad_glDisableClientState;
+	if(trace_real_glDisableClientState != NULL) glad_glDisableClientState = trace_glDisableClientState;
+	trace_real_glEdgeFlagPointer = glad_glEdgeFlagPointer;
+	if(trace_real_glEdgeFlagPointer != NULL) glad_glEdgeFlagPointer = trace_glEdgeFlagPointer;
+	trace_real_glEnableClientState = glad_glEnableClientState;
+	if(trace_real_glEnableClientState != NULL) glad_glEnableClientState = trace_glEnableClientState;
+	trace_real_glIndexPointer = glad_glIndexPointer;
+	if(trace_real_glIndexPointer != NULL) glad_glIndexPointer = trace_glIndexPointer;
+	trace_real_glInterleavedArrays = glad_glInterleavedArrays;
+	if(trace_real_glInterleavedArrays != NULL) glad_glInterleavedArrays = trace_glInterleavedArrays;
+	trace_real_glNormalPointer = glad_glNormalPointer;
+	if(trace_real_glNormalPointer != NULL) glad_glNormalPointer = trace_glNormalPointer;
+	trace_real_glTexCoordPointer = glad_glTexCoordPointer;
+	if(trace_real_glTexCoordPointer != NULL) glad_glTexCoordPointer = trace_glTexCoordPointer;
+	trace_real_glVertexPointer = glad_glVertexPointer;
+	if(trace_real_glVertexPointer != NULL) glad_glVertexPointer = trace_glVertexPointer;
+	trace_real_glAreTexturesResident = glad_glAreTexturesResident;
+	if(trace_real_glAreTexturesResident != NULL) glad_glAreTexturesResident = trace_glAreTexturesResident;
+	trace_real_glPrioritizeTextures = glad_glPrioritizeTextures;
+	if(trace_real_glPrioritizeTextures != NULL) glad_glPrioritizeTextures = trace_glPrioritizeTextures;
+	trace_real_glIndexub = glad_glIndexub;
+	if(trace_real_glIndexub != NULL) glad_glIndexub = trace_glIndexub;
+	trace_real_glIndexubv = glad_glIndexubv;
+	if(trace_real_glIndexubv != NULL) glad_glIndexubv = trace_glIndexubv;
+	trace_real_glPopClientAttrib = glad_glPopClientAttrib;
+	if(trace_real_glPopClientAttrib != NULL) glad_glPopClientAttrib = trace_glPopClientAttrib;
+	trace_real_glPushClientAttrib = glad_glPushClientAttrib;
+	if(trace_real_glPushClientAttrib != NULL) glad_glPushClientAttrib = trace_glPushClientAttrib;
+	trace_real_glDrawRangeElements = glad_glDrawRangeElements;
+	if(trace_real_glDrawRangeElements != NULL) glad_glDrawRangeElements = trace_glDrawRangeElements;
+	trace_real_glTexImage3D = glad_glTexImage3D;
+	if(trace_real_glTexImage3D != NULL) glad_glTexImage3D = trace_glTexImage3D;
+	trace_real_glTexSubImage3D = glad_glTexSubImage3D;
+	if(trace_real_glTexSubImage3D != NULL) glad_glTexSubImage3D = trace_glTexSubImage3D;
+	trace_real_glCopyTexSubImage3D = glad_glCopyTexSubImage3D;
+	if(trace_real_glCopyTexSubImage3D != NULL) glad_glCopyTexSubImage3D = trace_glCopyTexSubImage3D;
+	trace_real_glActiveTexture = glad_glActiveTexture;
+	if(trace_real_glActiveTexture != NULL) glad_glActiveTexture = trace_glActiveTexture;
+	trace_real_glSampleCoverage = glad_glSampleCoverage;
+	if(trace_real_glSampleCoverage != NULL) glad_glSampleCoverage = trace_glSampleCoverage;
+	trace_real_glCompressedTexImage3D = glad_glCompressedTexImage3D;
+	if(trace_real_glCompressedTexImage3D != NULL) glad_glCompressedTexImage3D = trace_glCompressedTexImage3D;
+	trace_real_glCompressedTexImage2D = glad_glCompressedTexImage2D;
+	if(trace_real_glCompressedTexImage2D != NULL) glad_glCompressedTexImage2D = trace_glCompressedTexImage2D;
+	trace_real_glCompressedTexImage1D = glad_glCompressedTexImage1D;
+	if(trace_real_glCompressedTexImage1D != NULL) glad_glCompressedTexImage1D = trace_glCompressedTexImage1D;
+	trace_real_glCompressedTexSubImage3D = glad_glCompressedTexSubImage3D;
+	if(trace_real_glCompressedTexSubImage3D != NULL) glad_glCompressedTexSubImage3D = trace_glCompressedTexSubImage3D;
+	trace_real_glCompressedTexSubImage2D = glad_glCompressedTexSubImage2D;
+	if(trace_real_glCompressedTexSubImage2D != NULL) glad_glCompressedTexSubImage2D = trace_glCompressedTexSubImage2D;
+	trace_real_glCompressedTexSubImage1D = glad_glCompressedTexSubImage1D;
+	if(trace_real_glCompressedTexSubImage1D != NULL) glad_glCompressedTexSubImage1D = trace_glCompressedTexSubImage1D;
+	trace_real_glGetCompressedTexImage = glad_glGetCompressedTexImage;
+	if(trace_real_glGetCompressedTexImage != NULL) glad_glGetCompressedTexImage = trace_glGetCompressedTexImage;
+	trace_real_glClientActiveTexture = glad_glClientActiveTexture;
+	if(trace_real_glClientActiveTexture != NULL) glad_glClientActiveTexture = trace_glClientActiveTexture;
+	trace_real_glMultiTexCoord1d = glad_glMultiTexCoord1d;
+	if(trace_real_glMultiTexCoord1d != NULL) glad_glMultiTexCoord1d = trace_glMultiTexCoord1d;
+	trace_real_glMultiTexCoord1dv = glad_glMultiTexCoord1dv;
+	if(trace_real_glMultiTexCoord1dv != NULL) glad_glMultiTexCoord1dv = trace_glMultiTexCoord1dv;
+	trace_real_glMultiTexCoord1f = glad_glMultiTexCoord1f;
+	if(trace_real_glMultiTexCoord1f != NULL) glad_glMultiTexCoord1f = trace_glMultiTexCoord1f;
+	trace_real_glMultiTexCoord1fv = glad_glMultiTexCoord1fv;
+	if(trace_real_glMultiTexCoord1fv != NULL) glad_glMultiTexCoord1fv = trace_glMultiTexCoord1fv;
+	trace_real_glMultiTexCoord1i = glad_glMultiTexCoord1i;
+	if(trace_real_glMultiTexCoord1i != NULL) glad_glMultiTexCoord1i = trace_glMultiTexCoord1i;
+	trace_real_glMultiTexCoord1iv = glad_glMultiTexCoord1iv;
+	if(trace_real_glMultiTexCoord1iv != NULL) glad_glMultiTexCoord1iv = trace_glMultiTexCoord1iv;
+	trace_real_glMultiTexCoord1s = glad_glMultiTexCoord1s;
+	if(trace_real_glMultiTexCoord1s != NULL) glad_glMultiTexCoord1s = trace_glMultiTexCoord1s;
+	trace_real_glMultiTexCoord1sv = glad_glMultiTexCoord1sv;
+	if(trace_real_glMultiTexCoord1sv != NULL) glad_glMultiTexCoord1sv = trace_glMultiTexCoord1sv;
+	trace_real_glMultiTexCoord2d = glad_glMultiTexCoord2d;
+	if(trace_real_glMultiTexCoord2d != NULL) glad_glMultiTexCoord2d = trace_glMultiTexCoord2d;
+	trace_real_glMultiTexCoord2dv = glad_glMultiTexCoord2dv;
+	if(trace_real_glMultiTexCoord2dv != NULL) glad_glMultiTexCoord2dv = trace_glMultiTexCoord2dv;
+	trace_real_glMultiTexCoord2f = glad_glMultiTexCoord2f;
+	if(trace_real_glMultiTexCoord2f != NULL) glad_glMultiTexCoord2f = trace_glMultiTexCoord2f;
+	trace_real_glMultiTexCoord2fv = glad_glMultiTexCoord2fv;
+	if(trace_real_glMultiTexCoord2fv != NULL) glad_glMultiTexCoord2fv = trace_glMultiTexCoord2fv;
+	trace_real_glMultiTexCoord2i = glad_glMultiTexCoord2i;
+	if(trace_real_glMultiTexCoord2i != NULL) glad_glMultiTexCoord2i = trace_glMultiTexCoord2i;
+	trace_real_glMultiTexCoord2iv = glad_glMultiTexCoord2iv;
+	if(trace_real_glMultiTexCoord2iv != NULL) glad_glMultiTexCoord2iv = trace_glMultiTexCoord2iv;
+	trace_real_glMultiTexCoord2s = glad_glMultiTexCoord2s;
+	if(trace_real_glMultiTexCoord2s != NULL) glad_glMultiTexCoord2s = trace_glMultiTexCoord2s;
+	trace_real_glMultiTexCoord2sv = glad_glMultiTexCoord2sv;
+	if(trace_real_glMultiTexCoord2sv != NULL) glad_glMultiTexCoord2sv = trace_glMultiTexCoord2sv;
+	trace_real_glMultiTexCoord3d = glad_glMultiTexCoord3d;
+	if(trace_real_glMultiTexCoord3d != NULL) glad_glMultiTexCoord3d = trace_glMultiTexCoord3d;
+	trace_real_glMultiTexCoord3dv = glad_glMultiTexCoord3dv;
+	if(trace_real_glMultiTexCoord3dv != NULL) glad_glMultiTexCoord3dv = trace_glMultiTexCoord3dv;
+	trace_real_glMultiTexCoord3f = glad_glMultiTexCoord3f;
+	if(trace_real_glMultiTexCoord3f != NULL) glad_glMultiTexCoord3f = trace_glMultiTexCoord3f;
+	trace_real_glMultiTexCoord3fv = glad_glMultiTexCoord3fv;
+	if(trace_real_glMultiTexCoord3fv != NULL) glad_glMultiTexCoord3fv = trace_glMultiTexCoord3fv;
+	trace_real_glMultiTexCoord3i = glad_glMultiTexCoord3i;
+	if(trace_real_glMultiTexCoord3i != NULL) glad_glMultiTexCoord3i = trace_glMultiTexCoord3i;
+	trace_real_glMultiTexCoord3iv = glad_glMultiTexCoord3iv;
+	if(trace_real_glMultiTexCoord3iv != NULL) glad_glMultiTexCoord3iv = trace_glMultiTexCoord3iv;
+	trace_real_glMultiTexCoord3s = glad_glMultiTexCoord3s;
+	if(trace_real_glMultiTexCoord3s != NULL) glad_glMultiTexCoord3s = trace_glMultiTexCoord3s;
+	trace_real_glMultiTexCoord3sv = glad_glMultiTexCoord3sv;
+	if(trace_real_glMultiTexCoord3sv != NULL) glad_glMultiTexCoord3sv = trace_glMultiTexCoord3sv;
+	trace_real_glMultiTexCoord4d = glad_glMultiTexCoord4d;
+	if(trace_real_glMultiTexCoord4d != NULL) glad_glMultiTexCoord4d = trace_glMultiTexCoord4d;
+	trace_real_glMultiTexCoord4dv = glad_glMultiTexCoord4dv;
+	if(trace_real_glMultiTexCoord4dv != NULL) glad_glMultiTexCoord4dv = trace_glMultiTexCoord4dv;
+	trace_real_glMultiTexCoord4f = glad_glMultiTexCoord4f;
+	if(trace_real_glMultiTexCoord4f != NULL) glad_glMultiTexCoord4f = trace_glMultiTexCoord4f;
+	trace_real_glMultiTexCoord4fv = glad_glMultiTexCoord4fv;
+	if(trace_real_glMultiTexCoord4fv != NULL) glad_glMultiTexCoord4fv = trace_glMultiTexCoord4fv;
+	trace_real_glMultiTexCoord4i = glad_glMultiTexCoord4i;
+	if(trace_real_glMultiTexCoord4i != NULL) glad_glMultiTexCoord4i = trace_glMultiTexCoord4i;
+	trace_real_glMultiTexCoord4iv = glad_glMultiTexCoord4iv;
+	if(trace_real_glMultiTexCoord4iv != NULL) glad_glMultiTexCoord4iv = trace_glMultiTexCoord4iv;
+	trace_real_glMultiTexCoord4s = glad_glMultiTexCoord4s;
+	if(trace_real_glMultiTexCoord4s != NULL) glad_glMultiTexCoord4s = trace_glMultiTexCoord4s;
+	trace_real_glMultiTexCoord4sv = glad_glMultiTexCoord4sv;
+	if(trace_real_glMultiTexCoord4sv != NULL) glad_glMultiTexCoord4sv = trace_glMultiTexCoord4sv;
+	trace_real_glLoadTransposeMatrixf = glad_glLoadTransposeMatrixf;
+	if(trace_real_glLoadTransposeMatrixf != NULL) glad_glLoadTransposeMatrixf = trace_glLoadTransposeMatrixf;
+	trace_real_glLoadTransposeMatrixd = glad_glLoadTransposeMatrixd;
+	if(trace_real_glLoadTransposeMatrixd != NULL) glad_glLoadTransposeMatrixd = trace_glLoadTransposeMatrixd;
+	trace_real_glMultTransposeMatrixf = glad_glMultTransposeMatrixf;
+	if(trace_real_glMultTransposeMatrixf != NULL) glad_glMultTransposeMatrixf = trace_glMultTransposeMatrixf;
+	trace_real_glMultTransposeMatrixd = glad_glMultTransposeMatrixd;
+	if(trace_real_glMultTransposeMatrixd != NULL) glad_glMultTransposeMatrixd = trace_glMultTransposeMatrixd;
+	trace_real_glBlendFuncSeparate = glad_glBlendFuncSeparate;
+	if(trace_real_glBlendFuncSeparate != NULL) glad_glBlendFuncSeparate = trace_glBlendFuncSeparate;
+	trace_real_glMultiDrawArrays = glad_glMultiDrawArrays;
+	if(trace_real_glMultiDrawArrays != NULL) glad_glMultiDrawArrays = trace_glMultiDrawArrays;
+	trace_real_glMultiDrawElements = glad_glMultiDrawElements;
+	if(trace_real_glMultiDrawElements != NULL) glad_glMultiDrawElements = trace_glMultiDrawElements;
+	trace_real_glPointParameterf = glad_glPointParameterf;
+	if(trace_real_glPointParameterf != NULL) glad_glPointParameterf = trace_glPointParameterf;
+	trace_real_glPointParameterfv = glad_glPointParameterfv;
+	if(trace_real_glPointParameterfv != NULL) glad_glPointParameterfv = trace_glPointParameterfv;
+	trace_real_glPointParameteri = glad_glPointParameteri;
+	if(trace_real_glPointParameteri != NULL) glad_glPointParameteri = trace_glPointParameteri;
+	trace_real_glPointParameteriv = glad_glPointParameteriv;
+	if(trace_real_glPointParameteriv != NULL) glad_glPointParameteriv = trace_glPointParameteriv;
+	trace_real_glFogCoordf = glad_glFogCoordf;
+	if(trace_real_glFogCoordf != NULL) glad_glFogCoordf = trace_glFogCoordf;
+	trace_real_glFogCoordfv = glad_glFogCoordfv;
+	if(trace_real_glFogCoordfv != NULL) glad_glFogCoordfv = trace_glFogCoordfv;
+	trace_real_glFogCoordd = glad_glFogCoordd;
+	if(trace_real_glFogCoordd != NULL) glad_glFogCoordd = trace_glFogCoordd;
+	trace_real_glFogCoorddv = glad_glFogCoorddv;
+	if(trace_real_glFogCoorddv != NULL) glad_glFogCoorddv = trace_glFogCoorddv;
+	trace_real_glFogCoordPointer = glad_glFogCoordPointer;
+	if(trace_real_glFogCoordPointer != NULL) glad_glFogCoordPointer = trace_glFogCoordPointer;
+	trace_real_glSecondaryColor3b = glad_glSecondaryColor3b;
+	if(trace_real_glSecondaryColor3b != NULL) glad_glSecondaryColor3b = trace_glSecondaryColor3b;
+	trace_real_glSecondaryColor3bv = glad_glSecondaryColor3bv;
+	if(trace_real_glSecondaryColor3bv != NULL) glad_glSecondaryColor3bv = trace_glSecondaryColor3bv;
+	trace_real_glSecondaryColor3d = glad_glSecondaryColor3d;
+	if(trace_real_glSecondaryColor3d != NULL) glad_glSecondaryColor3d = trace_glSecondaryColor3d;
+	trace_real_glSecondaryColor3dv = glad_glSecondaryColor3dv;
+	if(trace_real_glSecondaryColor3dv != NULL) glad_glSecondaryColor3dv = trace_glSecondaryColor3dv;
+	trace_real_glSecondaryColor3f = glad_glSecondaryColor3f;
+	if(trace_real_glSecondaryColor3f != NULL) glad_glSecondaryColor3f = trace_glSecondaryColor3f;
+	trace_real_glSecondaryColor3fv = glad_glSecondaryColor3fv;
+	if(trace_real_glSecondaryColor3fv != NULL) glad_glSecondaryColor3fv = trace_glSecondaryColor3fv;
+	trace_real_glSecondaryColor3i = glad_glSecondaryColor3i;
+	if(trace_real_glSecondaryColor3i != NULL) glad_glSecondaryColor3i = trace_glSecondaryColor3i;
+	trace_real_glSecondaryColor3iv = glad_glSecondaryColor3iv;
+	if(trace_real_glSecondaryColor3iv != NULL) glad_glSecondaryColor3iv = trace_glSecondaryColor3iv;
+	trace_real_glSecondaryColor3s = glad_glSecondaryColor3s;
+	if(trace_real_glSecondaryColor3s != NULL) glad_glSecondaryColor3s = trace_glSecondaryColor3s;
+	trace_real_glSecondaryColor3sv = glad_glSecondaryColor3sv;
+	if(trace_real_glSecondaryColor3sv != NULL) glad_glSecondaryColor3sv = trace_glSecondaryColor3sv;
+	trace_real_glSecondaryColor3ub = glad_glSecondaryColor3ub;
+	if(trace_real_glSecondaryColor3ub != NULL) glad_glSecondaryColor3ub = trace_glSecondaryColor3ub;
+	trace_real_glSecondaryColor3ubv = glad_glSecondaryColor3ubv;
+	if(trace_real_glSecondaryColor3ubv != NULL) glad_glSecondaryColor3ubv = trace_glSecondaryColor3ubv;
+	trace_real_glSecondaryColor3ui = glad_glSecondaryColor3ui;
+	if(trace_real_glSecondaryColor3ui != NULL) glad_glSecondaryColor3ui = trace_glSecondaryColor3ui;
+	trace_real_glSecondaryColor3uiv = glad_glSecondaryColor3uiv;
+	if(trace_real_glSecondaryColor3uiv != NULL) glad_glSecondaryColor3uiv = trace_glSecondaryColor3uiv;
+	trace_real_glSecondaryColor3us = glad_glSecondaryColor3us;
+	if(trace_real_glSecondaryColor3us != NULL) glad_glSecondaryColor3us = trace_glSecondaryColor3us;
+	trace_real_glSecondaryColor3usv = glad_glSecondaryColor3usv;
+	if(trace_real_glSecondaryColor3usv != NULL) glad_glSecondaryColor3usv = trace_glSecondaryColor3usv;
+	trace_real_glSecondaryColorPointer = glad_glSecondaryColorPointer;
+	if(trace_real_glSecondaryColorPointer != NULL) glad_glSecondaryColorPointer = trace_glSecondaryColorPointer;
+	trace_real_glWindowPos2d = glad_glWindowPos2d;
+	if(trace_real_glWindowPos2d != NULL) glad_glWindowPos2d = trace_glWindowPos2d;
+	trace_real_glWindowPos2dv = glad_glWindowPos2dv;
+	if(trace_real_glWindowPos2dv != NULL) glad_glWindowPos2dv = trace_glWindowPos2dv;
+	trace_real_glWindowPos2f = glad_glWindowPos2f;
+	if(trace_real_glWindowPos2f != NULL) glad_glWindowPos2f = trace_glWindowPos2f;
+	trace_real_glWindowPos2fv = glad_glWindowPos2fv;
+	if(trace_real_glWindowPos2fv != NULL) glad_glWindowPos2fv = trace_glWindowPos2fv;
+	trace_real_glWindowPos2i = glad_glWindowPos2i;
+	if(trace_real_glWindowPos2i != NULL) glad_glWindowPos2i = trace_glWindowPos2i;
+	trace_real_glWindowPos2iv = glad_glWindowPos2iv;
+	if(trace_real_glWindowPos2iv != NULL) glad_glWindowPos2iv = trace_glWindowPos2iv;
+	trace_real_glWindowPos2s = glad_glWindowPos2s;
+	if(trace_real_glWindowPos2s != NULL) glad_glWindowPos2s = trace_glWindowPos2s;
+	trace_real_glWindowPos2sv = glad_glWindowPos2sv;
+	if(trace_real_glWindowPos2sv != NULL) glad_glWindowPos2sv = trace_glWindowPos2sv;
+	trace_real_glWindowPos3d = glad_glWindowPos3d;
+	if(trace_real_glWindowPos3d != NULL) glad_glWindowPos3d = trace_glWindowPos3d;
+	trace_real_glWindowPos3dv = glad_glWindowPos3dv;
+	if(trace_real_glWindowPos3dv != NULL) glad_glWindowPos3dv = trace_glWindowPos3dv;
+	trace_real_glWindowPos3f = glad_glWindowPos3f;
+	if(trace_real_glWindowPos3f != NULL) glad_glWindowPos3f = trace_glWindowPos3f;
+	trace_real_glWindowPos3fv = glad_glWindowPos3fv;
+	if(trace_real_glWindowPos3fv != NULL) glad_glWindowPos3fv = trace_glWindowPos3fv;
+	trace_real_glWindowPos3i = glad_glWindowPos3i;
+	if(trace_real_glWindowPos3i != NULL) glad_glWindowPos3i = trace_glWindowPos3i;
+	trace_real_glWindowPos3iv = glad_glWindowPos3iv;
+	if(trace_real_glWindowPos3iv != NULL) glad_glWindowPos3iv = trace_glWindowPos3iv;
+	trace_real_glWindowPos3s = glad_glWindowPos3s;
+	if(trace_real_glWindowPos3s != NULL) glad_glWindowPos3s = trace_glWindowPos3s;
+	trace_real_glWindowPos3sv = glad_glWindowPos3sv;
+	if(trace_real_glWindowPos3sv != NULL) glad_glWindowPos3sv = trace_glWindowPos3sv;
+	trace_real_glBlendColor = glad_glBlendColor;
+	if(trace_real_glBlendColor != NULL) glad_glBlendColor = trace_glBlendColor;
+	trace_real_glBlendEquation = glad_glBlendEquation;
+	if(trace_real_glBlendEquation != NULL) glad_glBlendEquation = trace_glBlendEquation;
+	trace_real_glGenQueries = glad_glGenQueries;
+	if(trace_real_glGenQueries != NULL) glad_glGenQueries = trace_glGenQueries;
+	trace_real_glDeleteQueries = glad_glDeleteQueries;
+	if(trace_real_glDeleteQueries != NULL) glad_glDeleteQueries = trace_glDeleteQueries;
+	trace_real_glIsQuery = glad_glIsQuery;
+	if(trace_real_glIsQuery != NULL) glad_glIsQuery = trace_glIsQuery;
+	trace_real_glBeginQuery = glad_glBeginQuery;
+	if(trace_real_glBeginQuery != NULL) glad_glBeginQuery = trace_glBeginQuery;
+	trace_real_glEndQuery = glad_glEndQuery;
+	if(trace_real_glEndQuery != NULL) glad_glEndQuery = trace_glEndQuery;
+	trace_real_glGetQueryiv = glad_glGetQueryiv;
+	if(trace_real_glGetQueryiv != NULL) glad_glGetQueryiv = trace_glGetQueryiv;
+	trace_real_glGetQueryObjectiv = glad_glGetQueryObjectiv;
+	if(trace_real_glGetQueryObjectiv != NULL) glad_glGetQueryObjectiv = trace_glGetQueryObjectiv;
+	trace_real_glGetQueryObjectuiv = glad_glGetQueryObjectuiv;
+	if(trace_real_glGetQueryObjectuiv != NULL) glad_glGetQueryObjectuiv = trace_glGetQueryObjectuiv;
+	trace_real_glBindBuffer = glad_glBindBuffer;
+	if(trace_real_glBindBuffer != NULL) glad_glBindBuffer = trace_glBindBuffer;
+	trace_real_glDeleteBuffers = glad_glDeleteBuffers;
+	if(trace_real_glDeleteBuffers != NULL) glad_glDeleteBuffers = trace_glDeleteBuffers;
+	trace_real_glGenBuffers = glad_glGenBuffers;
+	if(trace_real_glGenBuffers != NULL) glad_glGenBuffers = trace_glGenBuffers;
+	trace_real_glIsBuffer = glad_glIsBuffer;
+	if(trace_real_glIsBuffer != NULL) glad_glIsBuffer = trace_glIsBuffer;
+	trace_real_glBufferData = glad_glBufferData;
+	if(trace_real_glBufferData != NULL) glad_glBufferData = trace_glBufferData;
+	trace_real_glBufferSubData = glad_glBufferSubData;
+	if(trace_real_glBufferSubData != NULL) glad_glBufferSubData = trace_glBufferSubData;
+	trace_real_glGetBufferSubData = glad_glGetBufferSubData;
+	if(trace_real_glGetBufferSubData != NULL) glad_glGetBufferSubData = trace_glGetBufferSubData;
+	trace_real_glMapBuffer = glad_glMapBuffer;
+	if(trace_real_glMapBuffer != NULL) glad_glMapBuffer = trace_glMapBuffer;
+	trace_real_glUnmapBuffer = glad_glUnmapBuffer;
+	if(trace_real_glUnmapBuffer != NULL) glad_glUnmapBuffer = trace_glUnmapBuffer;
+	trace_real_glGetBufferParameteriv = glad_glGetBufferParameteriv;
+	if(trace_real_glGetBufferParameteriv != NULL) glad_glGetBufferParameteriv = trace_glGetBufferParameteriv;
+	trace_real_glGetBufferPointerv = glad_glGetBufferPointerv;
+	if(trace_real_glGetBufferPointerv != NULL) glad_glGetBufferPointerv = trace_glGetBufferPointerv;
+	trace_real_glBlendEquationSeparate = glad_glBlendEquationSeparate;
+	if(trace_real_glBlendEquationSeparate != NULL) glad_glBlendEquationSeparate = trace_glBlendEquationSeparate;
+	trace_real_glDrawBuffers = glad_glDrawBuffers;
+	if(trace_real_glDrawBuffers != NULL) glad_glDrawBuffers = trace_glDrawBuffers;
+	trace_real_glStencilOpSeparate = glad_glStencilOpSeparate;
+	if(trace_real_glStencilOpSeparate != NULL) glad_glStencilOpSeparate = trace_glStencilOpSeparate;
+	trace_real_glStencilFuncSeparate = glad_glStencilFuncSeparate;
+	if(trace_real_glStencilFuncSeparate != NULL) glad_glStencilFuncSeparate = trace_glStencilFuncSeparate;
+	trace_real_glStencilMaskSeparate = glad_glStencilMaskSeparate;
+	if(trace_real_glStencilMaskSeparate != NULL) glad_glStencilMaskSeparate = trace_glStencilMaskSeparate;
+	trace_real_glAttachShader = glad_glAttachShader;
+	if(trace_real_glAttachShader != NULL) glad_glAttachShader = trace_glAttachShader;
+	trace_real_glBindAttribLocation = glad_glBindAttribLocation;
+	if(trace_real_glBindAttribLocation != NULL) glad_glBindAttribLocation = trace_glBindAttribLocation;
+	trace_real_glCompileShader = glad_glCompileShader;
+	if(trace_real_glCompileShader != NULL) glad_glCompileShader = trace_glCompileShader;
+	trace_real_glCreateProgram = glad_glCreateProgram;
+	if(trace_real_glCreateProgram != NULL) glad_glCreateProgram = trace_glCreateProgram;
+	trace_real_glCreateShader = glad_glCreateShader;
+	if(trace_real_glCreateShader != NULL) glad_glCreateShader = trace_glCreateShader;
+	trace_real_glDeleteProgram = glad_glDeleteProgram;
+	if(trace_real_glDeleteProgram != NULL) glad_glDeleteProgram = trace_glDeleteProgram;
+	trace_real_glDeleteShader = glad_glDeleteShader;
+	if(trace_real_glDeleteShader != NULL) glad_glDeleteShader = trace_glDeleteShader;
+	trace_real_glDetachShader = glad_glDetachShader;
+	if(trace_real_glDetachShader != NULL) glad_glDetachShader = trace_glDetachShader;
+	trace_real_glDisableVertexAttribArray = glad_glDisableVertexAttribArray;
+	if(trace_real_glDisableVertexAttribArray != NULL) glad_glDisableVertexAttribArray = trace_glDisableVertexAttribArray;
+	trace_real_glEnableVertexAttribArray = glad_glEnableVertexAttribArray;
+	if(trace_real_glEnableVertexAttribArray != NULL) glad_glEnableVertexAttribArray = trace_glEnableVertexAttribArray;
+	trace_real_glGetActiveAttrib = glad_glGetActiveAttrib;
+	if(trace_real_glGetActiveAttrib != NULL) glad_glGetActiveAttrib = trace_glGetActiveAttrib;
+	trace_real_glGetActiveUniform = glad_glGetActiveUniform;
+	if(trace_real_glGetActiveUniform != NULL) glad_glGetActiveUniform = trace_glGetActiveUniform;
+	trace_real_glGetAttachedShaders = glad_glGetAttachedShaders;
+	if(trace_real_glGetAttachedShaders != NULL) glad_glGetAttachedShaders = trace_glGetAttachedShaders;
+	trace_real_glGetAttribLocation = glad_glGetAttribLocation;
+	if(trace_real_glGetAttribLocation != NULL) glad_glGetAttribLocation = trace_glGetAttribLocation;
+	trace_real_glGetProgramiv = glad_glGetProgramiv;
+	if(trace_real_glGetProgramiv != NULL) glad_glGetProgramiv = trace_glGetProgramiv;
+	trace_real_glGetProgramInfoLog = glad_glGetProgramInfoLog;
+	if(trace_real_glGetProgramInfoLog != NULL) glad_glGetProgramInfoLog = trace_glGetProgramInfoLog;
+	trace_real_glGetShaderiv = glad_glGetShaderiv;
+	if(trace_real_glGetShaderiv != NULL) glad_glGetShaderiv = trace_glGetShaderiv;
+	trace_real_glGetShaderInfoLog = glad_glGetShaderInfoLog;
+	if(trace_real_glGetShaderInfoLog != NULL) glad_glGetShaderInfoLog = trace_glGetShaderInfoLog;
+	trace_real_glGetShaderSource = glad_glGetShaderSource;
+	if(trace_real_glGetShaderSource != NULL) glad_glGetShaderSource = trace_glGetShaderSource;
+	trace_real_glGetUniformLocation = glad_glGetUniformLocation;
+	if(trace_real_glGetUniformLocation != NULL) glad_glGetUniformLocation = trace_glGetUniformLocation;
+	trace_real_glGetUniformfv = glad_glGetUniformfv;
+	if(trace_real_glGetUniformfv != NULL) glad_glGetUniformfv = trace_glGetUniformfv;
+	trace_real_glGetUniformiv = glad_glGetUniformiv;
+	if(trace_real_glGetUniformiv != NULL) glad_glGetUniformiv = trace_glGetUniformiv;
+	trace_real_glGetVertexAttribdv = glad_glGetVertexAttribdv;
+	if(trace_real_glGetVertexAttribdv != NULL) glad_glGetVertexAttribdv = trace_glGetVertexAttribdv;
+	trace_real_glGetVertexAttribfv = glad_glGetVertexAttribfv;
+	if(trace_real_glGetVertexAttribfv != NULL) glad_glGetVertexAttribfv = trace_glGetVertexAttribfv;
+	trace_real_glGetVertexAttribiv = glad_glGetVertexAttribiv;
+	if(trace_real_glGetVertexAttribiv != NULL) glad_glGetVertexAttribiv = trace_glGetVertexAttribiv;
+	trace_real_glGetVertexAttribPointerv = glad_glGetVertexAttribPointerv;
+	if(trace_real_glGetVertexAttribPointerv != NULL) glad_glGetVertexAttribPointerv = trace_glGetVertexAttribPointerv;
+	trace_real_glIsProgram = glad_glIsProgram;
+	if(trace_real_glIsProgram != NULL) glad_glIsProgram = trace_glIsProgram;
+	trace_real_glIsShader = glad_glIsShader;
+	if(trace_real_glIsShader != NULL) glad_glIsShader = trace_glIsShader;
+	trace_real_glLinkProgram = glad_glLinkProgram;
+	if(trace_real_glLinkProgram != NULL) glad_glLinkProgram = trace_glLinkProgram;
+	trace_real_glShaderSource = glad_glShaderSource;
+	if(trace_real_glShaderSource != NULL) glad_glShaderSource = trace_glShaderSource;
+	trace_real_glUseProgram = glad_glUseProgram;
+	if(trace_real_glUseProgram != NULL) glad_glUseProgram = trace_glUseProgram;
+	trace_real_glUniform1f = glad_glUniform1f;
+	if(trace_real_glUniform1f != NULL) glad_glUniform1f = trace_glUniform1f;
+	trace_real_glUniform2f = glad_glUniform2f;
+	if(trace_real_glUniform2f != NULL) glad_glUniform2f = trace_glUniform2f;
+	trace_real_glUniform3f = glad_glUniform3f;
+	if(trace_real_glUniform3f != NULL) glad_glUniform3f = trace_glUniform3f;
+	trace_real_glUniform4f = glad_glUniform4f;
+	if(trace_real_glUniform4f != NULL) glad_glUniform4f = trace_glUniform4f;
+	trace_real_glUniform1i = glad_glUniform1i;
+	if(trace_real_glUniform1i != NULL) glad_glUniform1i = trace_glUniform1i;
+	trace_real_glUniform2i = glad_glUniform2i;
+	if(trace_real_glUniform2i != NULL) glad_glUniform2i = trace_glUniform2i;
+	trace_real_glUniform3i = glad_glUniform3i;
+	if(trace_real_glUniform3i != NULL) glad_glUniform3i = trace_glUniform3i;
+	trace_real_glUniform4i = glad_glUniform4i;
+	if(trace_real_glUniform4i != NULL) glad_glUniform4i = trace_glUniform4i;
+	trace_real_glUniform1fv = glad_glUniform1fv;
+	if(trace_real_glUniform1fv != NULL) glad_glUniform1fv = trace_glUniform1fv;
+	trace_real_glUniform2fv = glad_glUniform2fv;
+	if(trace_real_glUniform2fv != NULL) glad_glUniform2fv = trace_glUniform2fv;
+	trace_real_glUniform3fv = glad_glUniform3fv;
+	if(trace_real_glUniform3fv != NULL) glad_glUniform3fv = trace_glUniform3fv;
+	trace_real_glUniform4fv = glad_glUniform4fv;
+	if(trace_real_glUniform4fv != NULL) glad_glUniform4fv = trace_glUniform4fv;
+	trace_real_glUniform1iv = glad_glUniform1iv;
+	if(trace_real_glUniform1iv != NULL) glad_glUniform1iv = trace_glUniform1iv;
+	trace_real_glUniform2iv = glad_glUniform2iv;
+	if(trace_real_glUniform2iv != NULL) glad_glUniform2iv = trace_glUniform2iv;
+	trace_real_glUniform3iv = glad_glUniform3iv;
+	if(trace_real_glUniform3iv != NULL) glad_glUniform3iv = trace_glUniform3iv;
+	trace_real_glUniform4iv = glad_glUniform4iv;
+	if(trace_real_glUniform4iv != NULL) glad_glUniform4iv = trace_glUniform4iv;
+	trace_real_glUniformMatrix2fv = glad_glUniformMatrix2fv;
+	if(trace_real_glUniformMatrix2fv != NULL) glad_glUniformMatrix2fv = trace_glUniformMatrix2fv;
+	trace_real_glUniformMatrix3fv = glad_glUniformMatrix3fv;
+	if(trace_real_glUniformMatrix3fv != NULL) glad_glUniformMatrix3fv = trace_glUniformMatrix3fv;
+	trace_real_glUniformMatrix4fv = glad_glUniformMatrix4fv;
+	if(trace_real_glUniformMatrix4fv != NULL) glad_glUniformMatrix4fv = trace_glUniformMatrix4fv;
+	trace_real_glValidateProgram = glad_glValidateProgram;
+	if(trace_real_glValidateProgram != NULL) glad_glValidateProgram = trace_glValidateProgram;
+	trace_real_glVertexAttrib1d = glad_glVertexAttrib1d;
+	if(trace_real_glVertexAttrib1d != NULL) glad_glVertexAttrib1d = trace_glVertexAttrib1d;
+	trace_real_glVertexAttrib1dv = glad_glVertexAttrib1dv;
+	if(trace_real_glVertexAttrib1dv != NULL) glad_glVertexAttrib1dv = trace_glVertexAttrib1dv;
+	trace_real_glVertexAttrib1f = glad_glVertexAttrib1f;
+	if(trace_real_glVertexAttrib1f != NULL) glad_glVertexAttrib1f = trace_glVertexAttrib1f;
+	trace_real_glVertexAttrib1fv = glad_glVertexAttrib1fv;
+	if(trace_real_glVertexAttrib1fv != NULL) glad_glVertexAttrib1fv = trace_glVertexAttrib1fv;
+	trace_real_glVertexAttrib1s = glad_glVertexAttrib1s;
+	if(trace_real_glVertexAttrib1s != NULL) glad_glVertexAttrib1s = trace_glVertexAttrib1s;
+	trace_real_glVertexAttrib1sv = glad_glVertexAttrib1sv;
+	if(trace_real_glVertexAttrib1sv != NULL) glad_glVertexAttrib1sv = trace_glVertexAttrib1sv;
+	trace_real_glVertexAttrib2d = glad_glVertexAttrib2d;
+	if(trace_real_glVertexAttrib2d != NULL) glad_glVertexAttrib2d = trace_glVertexAttrib2d;
+	trace_real_glVertexAttrib2dv = glad_glVertexAttrib2dv;
+	if(trace_real_glVertexAttrib2dv != NULL) glad_glVertexAttrib2dv = trace_glVertexAttrib2dv;
+	trace_real_glVertexAttrib2f = glad_glVertexAttrib2f;
+	if(trace_real_glVertexAttrib2f != NULL) glad_glVertexAttrib2f = trace_glVertexAttrib2f;
+	trace_real_glVertexAttrib2fv = glad_glVertexAttrib2fv;
+	if(trace_real_glVertexAttrib2fv != NULL) glad_glVertexAttrib2fv = trace_glVertexAttrib2fv;
+	trace_real_glVertexAttrib2s = glad_glVertexAttrib2s;
+	if(trace_real_glVertexAttrib2s != NULL) glad_glVertexAttrib2s = trace_glVertexAttrib2s;
+	trace_real_glVertexAttrib2sv = glad_glVertexAttrib2sv;
+	if(trace_real_glVertexAttrib2sv != NULL) glad_glVertexAttrib2sv = trace_glVertexAttrib2sv;
+	trace_real_glVertexAttrib3d = glad_glVertexAttrib3d;
+	if(trace_real_glVertexAttrib3d != NULL) glad_glVertexAttrib3d = trace_glVertexAttrib3d;
+	trace_real_glVertexAttrib3dv = glad_glVertexAttrib3dv;
+	if(trace_real_glVertexAttrib3dv != NULL) glad_glVertexAttrib3dv = trace_glVertexAttrib3dv;
+	trace_real_glVertexAttrib3f = glad_glVertexAttrib3f;
+	if(trace_real_glVertexAttrib3f != NULL) glad_glVertexAttrib3f = trace_glVertexAttrib3f;
+	trace_real_glVertexAttrib3fv = glad_glVertexAttrib3fv;
+	if(trace_real_glVertexAttrib3fv != NULL) glad_glVertexAttrib3fv = trace_glVertexAttrib3fv;
+	trace_real_glVertexAttrib3s = glad_glVertexAttrib3s;
+	if(trace_real_glVertexAttrib3s != NULL) glad_glVertexAttrib3s = trace_glVertexAttrib3s;
+	trace_real_glVertexAttrib3sv = glad_glVertexAttrib3sv;
+	if(trace_real_glVertexAttrib3sv != NULL) glad_glVertexAttrib3sv = trace_glVertexAttrib3sv;
+	trace_real_glVertexAttrib4Nbv = glad_glVertexAttrib4Nbv;
+	if(trace_real_glVertexAttrib4Nbv != NULL) glad_glVertexAttrib4Nbv = trace_glVertexAttrib4Nbv;
+	trace_real_glVertexAttrib4Niv = glad_glVertexAttrib4Niv;
+	if(trace_real_glVertexAttrib4Niv != NULL) glad_glVertexAttrib4Niv = trace_glVertexAttrib4Niv;
+	trace_real_glVertexAttrib4Nsv = glad_glVertexAttrib4Nsv;
+	if(trace_real_glVertexAttrib4Nsv != NULL) glad_glVertexAttrib4Nsv = trace_glVertexAttrib4Nsv;
+	trace_real_glVertexAttrib4Nub = glad_glVertexAttrib4Nub;
+	if(trace_real_glVertexAttrib4Nub != NULL) glad_glVertexAttrib4Nub = trace_glVertexAttrib4Nub;
+	trace_real_glVertexAttrib4Nubv = glad_glVertexAttrib4Nubv;
+	if(trace_real_glVertexAttrib4Nubv != NULL) glad_glVertexAttrib4Nubv = trace_glVertexAttrib4Nubv;
+	trace_real_glVertexAttrib4Nuiv = glad_glVertexAttrib4Nuiv;
+	if(trace_real_glVertexAttrib4Nuiv != NULL) glad_glVertexAttrib4Nuiv = trace_glVertexAttrib4Nuiv;
+	trace_real_glVertexAttrib4Nusv = glad_glVertexAttrib4Nusv;
+	if(trace_real_glVertexAttrib4Nusv != NULL) glad_glVertexAttrib4Nusv = trace_glVertexAttrib4Nusv;
+	trace_real_glVertexAttrib4bv = glad_glVertexAttrib4bv;
+	if(trace_real_glVertexAttrib4bv != NULL) glad_glVertexAttrib4bv = trace_glVertexAttrib4bv;
+	trace_real_glVertexAttrib4d = glad_glVertexAttrib4d;
+	if(trace_real_glVertexAttrib4d != NULL) glad_glVertexAttrib4d = trace_glVertexAttrib4d;
+	trace_real_glVertexAttrib4dv = glad_glVertexAttrib4dv;
+	if(trace_real_glVertexAttrib4dv != NULL) glad_glVertexAttrib4dv = trace_glVertexAttrib4dv;
+	trace_real_glVertexAttrib4f = glad_glVertexAttrib4f;
+	if(trace_real_glVertexAttrib4f != NULL) glad_glVertexAttrib4f = trace_glVertexAttrib4f;
+	trace_real_glVertexAttrib4fv = glad_glVertexAttrib4fv;
+	if(trace_real_glVertexAttrib4fv != NULL) glad_glVertexAttrib4fv = trace_glVertexAttrib4fv;
+	trace_real_glVertexAttrib4iv = glad_glVertexAttrib4iv;
+	if(trace_real_glVertexAttrib4iv != NULL) glad_glVertexAttrib4iv = trace_glVertexAttrib4iv;
+	trace_real_glVertexAttrib4s = glad_glVertexAttrib4s;
+	if(trace_real_glVertexAttrib4s != NULL) glad_glVertexAttrib4s = trace_glVertexAttrib4s;
+	trace_real_glVertexAttrib4sv = glad_glVertexAttrib4sv;
+	if(trace_real_glVertexAttrib4sv != NULL) glad_glVertexAttrib4sv = trace_glVertexAttrib4sv;
+	trace_real_glVertexAttrib4ubv = glad_glVertexAttrib4ubv;
+	if(trace_real_glVertexAttrib4ubv != NULL) glad_glVertexAttrib4ubv = trace_glVertexAttrib4ubv;
+	trace_real_glVertexAttrib4uiv = glad_glVertexAttrib4uiv;
+	if(trace_real_glVertexAttrib4uiv != NULL) glad_glVertexAttrib4uiv = trace_glVertexAttrib4uiv;
+	trace_real_glVertexAttrib4usv = glad_glVertexAttrib4usv;
+	if(trace_real_glVertexAttrib4usv != NULL) glad_glVertexAttrib4usv = trace_glVertexAttrib4usv;
+	trace_real_glVertexAttribPointer = glad_glVertexAttribPointer;
+	if(trace_real_glVertexAttribPointer != NULL) glad_glVertexAttribPointer = trace_glVertexAttribPointer;
+	trace_real_glUniformMatrix2x3fv = glad_glUniformMatrix2x3fv;
+	if(trace_real_glUniformMatrix2x3fv != NULL) glad_glUniformMatrix2x3fv = trace_glUniformMatrix2x3fv;
+	trace_real_glUniformMatrix3x2fv = glad_glUniformMatrix3x2fv;
+	if(trace_real_glUniformMatrix3x2fv != NULL) glad_glUniformMatrix3x2fv = trace_glUniformMatrix3x2fv;
+	trace_real_glUniformMatrix2x4fv = glad_glUniformMatrix2x4fv;
+	if(trace_real_glUniformMatrix2x4fv != NULL) glad_glUniformMatrix2x4fv = trace_glUniformMatrix2x4fv;
+	trace_real_glUniformMatrix4x2fv = glad_glUniformMatrix4x2fv;
+	if(trace_real_glUniformMatrix4x2fv != NULL) glad_glUniformMatrix4x2fv = trace_glUniformMatrix4x2fv;
+	trace_real_glUniformMatrix3x4fv = glad_glUniformMatrix3x4fv;
+	if(trace_real_glUniformMatrix3x4fv != NULL) glad_glUniformMatrix3x4fv = trace_glUniformMatrix3x4fv;
+	trace_real_glUniformMatrix4x3fv = glad_glUniformMatrix4x3fv;
+	if(trace_real_glUniformMatrix4x3fv != NULL) glad_glUniformMatrix4x3fv = trace_glUniformMatrix4x3fv;
+	trace_real_glColorMaski = glad_glColorMaski;
+	if(trace_real_glColorMaski != NULL) glad_glColorMaski = trace_glColorMaski;
+	trace_real_glGetBooleani_v = glad_glGetBooleani_v;
+	if(trace_real_glGetBooleani_v != NULL) glad_glGetBooleani_v = trace_glGetBooleani_v;
+	trace_real_glGetIntegeri_v = glad_glGetIntegeri_v;
+	if(trace_real_glGetIntegeri_v != NULL) glad_glGetIntegeri_v = trace_glGetIntegeri_v;
+	trace_real_glEnablei = glad_glEnablei;
+	if(trace_real_glEnablei != NULL) glad_glEnablei = trace_glEnablei;
+	trace_real_glDisablei = glad_glDisablei;
+	if(trace_real_glDisablei != NULL) glad_glDisablei = trace_glDisablei;
+	trace_real_glIsEnabledi = glad_glIsEnabledi;
+	if(trace_real_glIsEnabledi != NULL) glad_glIsEnabledi = trace_glIsEnabledi;
+	trace_real_glBeginTransformFeedback = glad_glBeginTransformFeedback;
+	if(trace_real_glBeginTransformFeedback != NULL) glad_glBeginTransformFeedback = trace_glBeginTransformFeedback;
+	trace_real_glEndTransformFeedback = glad_glEndTransformFeedback;
+	if(trace_real_glEndTransformFeedback != NULL) glad_glEndTransformFeedback = trace_glEndTransformFeedback;
+	trace_real_glBindBufferRange = glad_glBindBufferRange;
+	if(trace_real_glBindBufferRange != NULL) glad_glBindBufferRange = trace_glBindBufferRange;
+	trace_real_glBindBufferBase = glad_glBindBufferBase;
+	if(trace_real_glBindBufferBase != NULL) glad_glBindBufferBase = trace_glBindBufferBase;
+	trace_real_glTransformFeedbackVaryings = glad_glTransformFeedbackVaryings;
+	if(trace_real_glTransformFeedbackVaryings != NULL) glad_glTransformFeedbackVaryings = trace_glTransformFeedbackVaryings;
+	trace_real_glGetTransformFeedbackVarying = glad_glGetTransformFeedbackVarying;
+	if(trace_real_glGetTransformFeedbackVarying != NULL) glad_glGetTransformFeedbackVarying = trace_glGetTransformFeedbackVarying;
+	trace_real_glClampColor = glad_glClampColor;
+	if(trace_real_glClampColor != NULL) glad_glClampColor = trace_glClampColor;
+	trace_real_glBeginConditionalRender = glad_glBeginConditionalRender;
+	if(trace_real_glBeginConditionalRender != NULL) glad_glBeginConditionalRender = trace_glBeginConditionalRender;
+	trace_real_glEndConditionalRender = glad_glEndConditionalRender;
+	if(trace_real_glEndConditionalRender != NULL) glad_glEndConditionalRender = trace_glEndConditionalRender;
+	trace_real_glVertexAttribIPointer = glad_glVertexAttribIPointer;
+	if(trace_real_glVertexAttribIPointer != NULL) glad_glVertexAttribIPointer = trace_glVertexAttribIPointer;
+	trace_real_glGetVertexAttribIiv = glad_glGetVertexAttribIiv;
+	if(trace_real_glGetVertexAttribIiv != NULL) glad_glGetVertexAttribIiv = trace_glGetVertexAttribIiv;
+	trace_real_glGetVertexAttribIuiv = glad_glGetVertexAttribIuiv;
+	if(trace_real_glGetVertexAttribIuiv != NULL) glad_glGetVertexAttribIuiv = trace_glGetVertexAttribIuiv;
+	trace_real_glVertexAttribI1i = glad_glVertexAttribI1i;
+	if(trace_real_glVertexAttribI1i != NULL) glad_glVertexAttribI1i = trace_glVertexAttribI1i;
+	trace_real_glVertexAttribI2i = glad_glVertexAttribI2i;
+	if(trace_real_glVertexAttribI2i != NULL) glad_glVertexAttribI2i = trace_glVertexAttribI2i;
+	trace_real_glVertexAttribI3i = glad_glVertexAttribI3i;
+	if(trace_real_glVertexAttribI3i != NULL) glad_glVertexAttribI3i = trace_glVertexAttribI3i;
+	trace_real_glVertexAttribI4i = glad_glVertexAttribI4i;
+	if(trace_real_glVertexAttribI4i != NULL) glad_glVertexAttribI4i = trace_glVertexAttribI4i;
+	trace_real_glVertexAttribI1ui = glad_glVertexAttribI1ui;
+	if(trace_real_glVertexAttribI1ui != NULL) glad_glVertexAttribI1ui = trace_glVertexAttribI1ui;
+	trace_real_glVertexAttribI2ui = glad_glVertexAttribI2ui;
+	if(trace_real_glVertexAttribI2ui != NULL) glad_glVertexAttribI2ui = trace_glVertexAttribI2ui;
+	trace_real_glVertexAttribI3ui = glad_glVertexAttribI3ui;
+	if(trace_real_glVertexAttribI3ui != NULL) glad_glVertexAttribI3ui = trace_glVertexAttribI3ui;
+	trace_real_glVertexAttribI4ui = glad_glVertexAttribI4ui;
+	if(trace_real_glVertexAttribI4ui != NULL) glad_glVertexAttribI4ui = trace_glVertexAttribI4ui;
+	trace_real_glVertexAttribI1iv = glad_glVertexAttribI1iv;
+	if(trace_real_glVertexAttribI1iv != NULL) glad_glVertexAttribI1iv = trace_glVertexAttribI1iv;
+	trace_real_glVertexAttribI2iv = glad_glVertexAttribI2iv;
+	if(trace_real_glVertexAttribI2iv != NULL) glad_glVertexAttribI2iv = trace_glVertexAttribI2iv;
+	trace_real_glVertexAttribI3iv = glad_glVertexAttribI3iv;
+	if(trace_real_glVertexAttribI3iv != NULL) glad_glVertexAttribI3iv = trace_glVertexAttribI3iv;
+	trace_real_glVertexAttribI4iv = glad_glVertexAttribI4iv;
+	if(trace_real_glVertexAttribI4iv != NULL) glad_glVertexAttribI4iv = trace_glVertexAttribI4iv;
+	trace_real_glVertexAttribI1uiv = glad_glVertexAttribI1uiv;
+	if(trace_real_glVertexAttribI1uiv != NULL) glad_glVertexAttribI1uiv = trace_glVertexAttribI1uiv;
+	trace_real_glVertexAttribI2uiv = glad_glVertexAttribI2uiv;
+	if(trace_real_glVertexAttribI2uiv != NULL) glad_glVertexAttribI2uiv = trace_glVertexAttribI2uiv;
+	trace_real_glVertexAttribI3uiv = glad_glVertexAttribI3uiv;
+	if(trace_real_glVertexAttribI3uiv != NULL) glad_glVertexAttribI3uiv = trace_glVertexAttribI3uiv;
+	trace_real_glVertexAttribI4uiv = glad_glVertexAttribI4uiv;
+	if(trace_real_glVertexAttribI4uiv != NULL) glad_glVertexAttribI4uiv = trace_glVertexAttribI4uiv;
+	trace_real_glVertexAttribI4bv = glad_glVertexAttribI4bv;
+	if(trace_real_glVertexAttribI4bv != NULL) glad_glVertexAttribI4bv = trace_glVertexAttribI4bv;
+	trace_real_glVertexAttribI4sv = glad_glVertexAttribI4sv;
+	if(trace_real_glVertexAttribI4sv != NULL) glad_glVertexAttribI4sv = trace_glVertexAttribI4sv;
+	trace_real_glVertexAttribI4ubv = glad_glVertexAttribI4ubv;
+	if(trace_real_glVertexAttribI4ubv != NULL) glad_glVertexAttribI4ubv = trace_glVertexAttribI4ubv;
+	trace_real_glVertexAttribI4usv = glad_glVertexAttribI4usv;
+	if(trace_real_glVertexAttribI4usv != NULL) glad_glVertexAttribI4usv = trace_glVertexAttribI4usv;
+	trace_real_glGetUniformuiv = glad_glGetUniformuiv;
+	if(trace_real_glGetUniformuiv != NULL) glad_glGetUniformuiv = trace_glGetUniformuiv;
+	trace_real_glBindFragDataLocation = glad_glBindFragDataLocation;
+	if(trace_real_glBindFragDataLocation != NULL) glad_glBindFragDataLocation = trace_glBindFragDataLocation;
+	trace_real_glGetFragDataLocation = glad_glGetFragDataLocation;
+	if(trace_real_glGetFragDataLocation != NULL) glad_glGetFragDataLocation = trace_glGetFragDataLocation;
+	trace_real_glUniform1ui = glad_glUniform1ui;
+	if(trace_real_glUniform1ui != NULL) glad_glUniform1ui = trace_glUniform1ui;
+	trace_real_glUniform2ui = glad_glUniform2ui;
+	if(trace_real_glUniform2ui != NULL) glad_glUniform2ui = trace_glUniform2ui;
+	trace_real_glUniform3ui = glad_glUniform3ui;
+	if(trace_real_glUniform3ui != NULL) glad_glUniform3ui = trace_glUniform3ui;
+	trace_real_glUniform4ui = glad_glUniform4ui;
+	if(trace_real_glUniform4ui != NULL) glad_glUniform4ui = trace_glUniform4ui;
+	trace_real_glUniform1uiv = glad_glUniform1uiv;
+	if(trace_real_glUniform1uiv != NULL) glad_glUniform1uiv = trace_glUniform1uiv;
+	trace_real_glUniform2uiv = glad_glUniform2uiv;
+	if(trace_real_glUniform2uiv != NULL) glad_glUniform2uiv = trace_glUniform2uiv;
+	trace_real_glUniform3uiv = glad_glUniform3uiv;
+	if(trace_real_glUniform3uiv != NULL) glad_glUniform3uiv = trace_glUniform3uiv;
+	trace_real_glUniform4uiv = glad_glUniform4uiv;
+	if(trace_real_glUniform4uiv != NULL) glad_glUniform4uiv = trace_glUniform4uiv;
+	trace_real_glTexParameterIiv = glad_glTexParameterIiv;
+	if(trace_real_glTexParameterIiv != NULL) glad_glTexParameterIiv = trace_glTexParameterIiv;
+	trace_real_glTexParameterIuiv = glad_glTexParameterIuiv;
+	if(trace_real_glTexParameterIuiv != NULL) glad_glTexParameterIuiv = trace_glTexParameterIuiv;
+	trace_real_glGetTexParameterIiv = glad_glGetTexParameterIiv;
+	if(trace_real_glGetTexParameterIiv != NULL) glad_glGetTexParameterIiv = trace_glGetTexParameterIiv;
+	trace_real_glGetTexParameterIuiv = glad_glGetTexParameterIuiv;
+	if(trace_real_glGetTexParameterIuiv != NULL) glad_glGetTexParameterIuiv = trace_glGetTexParameterIuiv;
+	trace_real_glClearBufferiv = glad_glClearBufferiv;
+	if(trace_real_glClearBufferiv != NULL) glad_glClearBufferiv = trace_glClearBufferiv;
+	trace_real_glClearBufferuiv = glad_glClearBufferuiv;
+	if(trace_real_glClearBufferuiv != NULL) glad_glClearBufferuiv = trace_glClearBufferuiv;
+	trace_real_glClearBufferfv = glad_glClearBufferfv;
+	if(trace_real_glClearBufferfv != NULL) glad_glClearBufferfv = trace_glClearBufferfv;
+	trace_real_glClearBufferfi = glad_glClearBufferfi;
+	if(trace_real_glClearBufferfi != NULL) glad_glClearBufferfi = trace_glClearBufferfi;
+	trace_real_glGetStringi = glad_glGetStringi;
+	if(trace_real_glGetStringi != NULL) glad_glGetStringi = trace_glGetStringi;
+	trace_real_glIsRenderbuffer = glad_glIsRenderbuffer;
+	if(trace_real_glIsRenderbuffer != NULL) glad_glIsRenderbuffer = trace_glIsRenderbuffer;
+	trace_real_glBindRenderbuffer = glad_glBindRenderbuffer;
+	if(trace_real_glBindRenderbuffer != NULL) glad_glBindRenderbuffer = trace_glBindRenderbuffer;
+	trace_real_glDeleteRenderbuffers = glad_glDeleteRenderbuffers;
+	if(trace_real_glDeleteRenderbuffers != NULL) glad_glDeleteRenderbuffers = trace_glDeleteRenderbuffers;
+	trace_real_glGenRenderbuffers = glad_glGenRenderbuffers;
+	if(trace_real_glGenRenderbuffers != NULL) glad_glGenRenderbuffers = trace_glGenRenderbuffers;
+	trace_real_glRenderbufferStorage = glad_glRenderbufferStorage;
+	if(trace_real_glRenderbufferStorage != NULL) glad_glRenderbufferStorage = trace_glRenderbufferStorage;
+	trace_real_glGetRenderbufferParameteriv = glad_glGetRenderbufferParameteriv;
+	if(trace_real_glGetRenderbufferParameteriv != NULL) glad_glGetRenderbufferParameteriv = trace_glGetRenderbufferParameteriv;
+	trace_real_glIsFramebuffer = glad_glIsFramebuffer;
+	if(trace_real_glIsFramebuffer != NULL) glad_glIsFramebuffer = trace_glIsFramebuffer;
+	trace_real_glBindFramebuffer = glad_glBindFramebuffer;
+	if(trace_real_glBindFramebuffer != NULL) glad_glBindFramebuffer = trace_glBindFramebuffer;
+	trace_real_glDeleteFramebuffers = glad_glDeleteFramebuffers;
+	if(trace_real_glDeleteFramebuffers != NULL) glad_glDeleteFramebuffers = trace_glDeleteFramebuffers;
+	trace_real_glGenFramebuffers = glad_glGenFramebuffers;
+	if(trace_real_glGenFramebuffers != NULL) glad_glGenFramebuffers = trace_glGenFramebuffers;
+	trace_real_glCheckFramebufferStatus = glad_glCheckFramebufferStatus;
+	if(trace_real_glCheckFramebufferStatus != NULL) glad_glCheckFramebufferStatus = trace_glCheckFramebufferStatus;
+	trace_real_glFramebufferTexture1D = glad_glFramebufferTexture1D;
+	if(trace_real_glFramebufferTexture1D != NULL) glad_glFramebufferTexture1D = trace_glFramebufferTexture1D;
+	trace_real_glFramebufferTexture2D = glad_glFramebufferTexture2D;
+	if(trace_real_glFramebufferTexture2D != NULL) glad_glFramebufferTexture2D = trace_glFramebufferTexture2D;
+	trace_real_glFramebufferTexture3D = glad_glFramebufferTexture3D;
+	if(trace_real_glFramebufferTexture3D != NULL) glad_glFramebufferTexture3D = trace_glFramebufferTexture3D;
+	trace_real_glFramebufferRenderbuffer = glad_glFramebufferRenderbuffer;
+	if(trace_real_glFramebufferRenderbuffer != NULL) glad_glFramebufferRenderbuffer = trace_glFramebufferRenderbuffer;
+	trace_real_glGetFramebufferAttachmentParameteriv = glad_glGetFramebufferAttachmentParameteriv;
+	if(trace_real_glGetFramebufferAttachmentParameteriv != NULL) glad_glGetFramebufferAttachmentParameteriv = trace_glGetFramebufferAttachmentParameteriv;
+	trace_real_glGenerateMipmap = glad_glGenerateMipmap;
+	if(trace_real_glGenerateMipmap != NULL) glad_glGenerateMipmap = trace_glGenerateMipmap;
+	trace_real_glBlitFramebuffer = glad_glBlitFramebuffer;
+	if(trace_real_glBlitFramebuffer != NULL) glad_glBlitFramebuffer = trace_glBlitFramebuffer;
+	trace_real_glRenderbufferStorageMultisample = glad_glRenderbufferStorageMultisample;
+	if(trace_real_glRenderbufferStorageMultisample != NULL) glad_glRenderbufferStorageMultisample = trace_glRenderbufferStorageMultisample;
+	trace_real_glFramebufferTextureLayer = glad_glFramebufferTextureLayer;
+	if(trace_real_glFramebufferTextureLayer != NULL) glad_glFramebufferTextureLayer = trace_glFramebufferTextureLayer;
+	trace_real_glMapBufferRange = glad_glMapBufferRange;
+	if(trace_real_glMapBufferRange != NULL) glad_glMapBufferRange = trace_glMapBufferRange;
+	trace_real_glFlushMappedBufferRange = glad_glFlushMappedBufferRange;
+	if(trace_real_glFlushMappedBufferRange != NULL) glad_glFlushMappedBufferRange = trace_glFlushMappedBufferRange;
+	trace_real_glBindVertexArray = glad_glBindVertexArray;
+	if(trace_real_glBindVertexArray != NULL) glad_glBindVertexArray = trace_glBindVertexArray;
+	trace_real_glDeleteVertexArrays = glad_glDeleteVertexArrays;
+	if(trace_real_glDeleteVertexArrays != NULL) glad_glDeleteVertexArrays = trace_glDeleteVertexArrays;
+	trace_real_glGenVertexArrays = glad_glGenVertexArrays;
+	if(trace_real_glGenVertexArrays != NULL) glad_glGenVertexArrays = trace_glGenVertexArrays;
+	trace_real_glIsVertexArray = glad_glIsVertexArray;
+	if(trace_real_glIsVertexArray != NULL) glad_glIsVertexArray = trace_glIsVertexArray;
+	trace_real_glDrawArraysInstanced = glad_glDrawArraysInstanced;
+	if(trace_real_glDrawArraysInstanced != NULL) glad_glDrawArraysInstanced = trace_glDrawArraysInstanced;
+	trace_real_glDrawElementsInstanced = glad_glDrawElementsInstanced;
+	if(trace_real_glDrawElementsInstanced != NULL) glad_glDrawElementsInstanced = trace_glDrawElementsInstanced;
+	trace_real_glTexBuffer = glad_glTexBuffer;
+	if(trace_real_glTexBuffer != NULL) glad_glTexBuffer = trace_glTexBuffer;
+	trace_real_glPrimitiveRestartIndex = glad_glPrimitiveRestartIndex;
+	if(trace_real_glPrimitiveRestartIndex != NULL) glad_glPrimitiveRestartIndex = trace_glPrimitiveRestartIndex;
+	trace_real_glCopyBufferSubData = glad_glCopyBufferSubData;
+	if(trace_real_glCopyBufferSubData != NULL) glad_glCopyBufferSubData = trace_glCopyBufferSubData;
+	trace_real_glGetUniformIndices = glad_glGetUniformIndices;
+	if(trace_real_glGetUniformIndices != NULL) glad_glGetUniformIndices = trace_glGetUniformIndices;
+	trace_real_glGetActiveUniformsiv = glad_glGetActiveUniformsiv;
+	if(trace_real_glGetActiveUniformsiv != NULL) glad_glGetActiveUniformsiv = trace_glGetActiveUniformsiv;
+	trace_real_glGetActiveUniformName = glad_glGetActiveUniformName;
+	if(trace_real_glGetActiveUniformName != NULL) glad_glGetActiveUniformName = trace_glGetActiveUniformName;
+	trace_real_glGetUniformBlockIndex = glad_glGetUniformBlockIndex;
+	if(trace_real_glGetUniformBlockIndex != NULL) glad_glGetUniformBlockIndex = trace_glGetUniformBlockIndex;
+	trace_real_glGetActiveUniformBlockiv = glad_glGetActiveUniformBlockiv;
+	if(trace_real_glGetActiveUniformBlockiv != NULL) glad_glGetActiveUniformBlockiv = trace_glGetActiveUniformBlockiv;
+	trace_real_glGetActiveUniformBlockName = glad_glGetActiveUniformBlockName;
+	if(trace_real_glGetActiveUniformBlockName != NULL) glad_glGetActiveUniformBlockName = trace_glGetActiveUniformBlockName;
+	trace_real_glUniformBlockBinding = glad_glUniformBlockBinding;
+	if(trace_real_glUniformBlockBinding != NULL) glad_glUniformBlockBinding = trace_glUniformBlockBinding;
+	trace_real_glDrawElementsBaseVertex = glad_glDrawElementsBaseVertex;
+	if(trace_real_glDrawElementsBaseVertex != NULL) glad_glDrawElementsBaseVertex = trace_glDrawElementsBaseVertex;
+	trace_real_glDrawRangeElementsBaseVertex = glad_glDrawRangeElementsBaseVertex;
+	if(trace_real_glDrawRangeElementsBaseVertex != NULL) glad_glDrawRangeElementsBaseVertex = trace_glDrawRangeElementsBaseVertex;
+	trace_real_glDrawElementsInstancedBaseVertex = glad_glDrawElementsInstancedBaseVertex;
+	if(trace_real_glDrawElementsInstancedBaseVertex != NULL) glad_glDrawElementsInstancedBaseVertex = trace_glDrawElementsInstancedBaseVertex;
+	trace_real_glMultiDrawElementsBaseVertex = glad_glMultiDrawElementsBaseVertex;
+	if(trace_real_glMultiDrawElementsBaseVertex != NULL) glad_glMultiDrawElementsBaseVertex = trace_glMultiDrawElementsBaseVertex;
+	trace_real_glProvokingVertex = glad_glProvokingVertex;
+	if(trace_real_glProvokingVertex != NULL) glad_glProvokingVertex = trace_glProvokingVertex;
+	trace_real_glFenceSync = glad_glFenceSync;
+	if(trace_real_glFenceSync != NULL) glad_glFenceSync = trace_glFenceSync;
+	trace_real_glIsSync = glad_glIsSync;
+	if(trace_real_glIsSync != NULL) glad_glIsSync = trace_glIsSync;
+	trace_real_glDeleteSync = glad_glDeleteSync;
+	if(trace_real_glDeleteSync != NULL) glad_glDeleteSync = trace_glDeleteSync;
+	trace_real_glClientWaitSync = glad_glClientWaitSync;
+	if(trace_real_glClientWaitSync != NULL) glad_glClientWaitSync = trace_glClientWaitSync;
+	trace_real_glWaitSync = glad_glWaitSync;
+	if(trace_real_glWaitSync != NULL) glad_glWaitSync = trace_glWaitSync;
+	trace_real_glGetInteger64v = glad_glGetInteger64v;
+	if(trace_real_glGetInteger64v != NULL) glad_glGetInteger64v = trace_glGetInteger64v;
+	trace_real_glGetSynciv = glad_glGetSynciv;
+	if(trace_real_glGetSynciv != NULL) glad_glGetSynciv = trace_glGetSynciv;
+	trace_real_glGetInteger64i_v = glad_glGetInteger64i_v;
+	if(trace_real_glGetInteger64i_v != NULL) glad_glGetInteger64i_v = trace_glGetInteger64i_v;
+	trace_real_glGetBufferParameteri64v = glad_glGetBufferParameteri64v;
+	if(trace_real_glGetBufferParameteri64v != NULL) glad_glGetBufferParameteri64v = trace_glGetBufferParameteri64v;
+	trace_real_glFramebufferTexture = glad_glFramebufferTexture;
+	if(trace_real_glFramebufferTexture != NULL) glad_glFramebufferTexture = trace_glFramebufferTexture;
+	trace_real_glTexImage2DMultisample = glad_glTexImage2DMultisample;
+	if(trace_real_glTexImage2DMultisample != NULL) glad_glTexImage2DMultisample = trace_glTexImage2DMultisample;
+	trace_real_glTexImage3DMultisample = glad_glTexImage3DMultisample;
+	if(trace_real_glTexImage3DMultisample != NULL) glad_glTexImage3DMultisample = trace_glTexImage3DMultisample;
+	trace_real_glGetMultisamplefv = glad_glGetMultisamplefv;
+	if(trace_real_glGetMultisamplefv != NULL) glad_glGetMultisamplefv = trace_glGetMultisamplefv;
+	trace_real_glSampleMaski = glad_glSampleMaski;
+	if(trace_real_glSampleMaski != NULL) glad_glSampleMaski = trace_glSampleMaski;
+	trace_real_glBindFragDataLocationIndexed = glad_glBindFragDataLocationIndexed;
+	if(trace_real_glBindFragDataLocationIndexed != NULL) glad_glBindFragDataLocationIndexed = trace_glBindFragDataLocationIndexed;
+	trace_real_glGetFragDataIndex = glad_glGetFragDataIndex;
+	if(trace_real_glGetFragDataIndex != NULL) glad_glGetFragDataIndex = trace_glGetFragDataIndex;
+	trace_real_glGenSamplers = glad_glGenSamplers;
+	if(trace_real_glGenSamplers != NULL) glad_glGenSamplers = trace_glGenSamplers;
+	trace_real_glDeleteSamplers = glad_glDeleteSamplers;
+	if(trace_real_glDeleteSamplers != NULL) glad_glDeleteSamplers = trace_glDeleteSamplers;
+	trace_real_glIsSampler = glad_glIsSampler;
+	if(trace_real_glIsSampler != NULL) glad_glIsSampler = trace_glIsSampler;
+	trace_real_glBindSampler = glad_glBindSampler;
+	if(trace_real_glBindSampler != NULL) glad_glBindSampler = trace_glBindSampler;
+	trace_real_glSamplerParameteri = glad_glSamplerParameteri;
+	if(trace_real_glSamplerParameteri != NULL) glad_glSamplerParameteri = trace_glSamplerParameteri;
+	trace_real_glSamplerParameteriv = glad_glSamplerParameteriv;
+	if(trace_real_glSamplerParameteriv != NULL) glad_glSamplerParameteriv = trace_glSamplerParameteriv;
+	trace_real_glSamplerParameterf = glad_glSamplerParameterf;
+	if(trace_real_glSamplerParameterf != NULL) glad_glSamplerParameterf = trace_glSamplerParameterf;
+	trace_real_glSamplerParameterfv = glad_glSamplerParameterfv;
+	if(trace_real_glSamplerParameterfv != NULL) glad_glSamplerParameterfv = trace_glSamplerParameterfv;
+	trace_real_glSamplerParameterIiv = glad_glSamplerParameterIiv;
+	if(trace_real_glSamplerParameterIiv != NULL) glad_glSamplerParameterIiv = trace_glSamplerParameterIiv;
+	trace_real_glSamplerParameterIuiv = glad_glSamplerParameterIuiv;
+	if(trace_real_glSamplerParameterIuiv != NULL) glad_glSamplerParameterIuiv = trace_glSamplerParameterIuiv;
+	trace_real_glGetSamplerParameteriv = glad_glGetSamplerParameteriv;
+	if(trace_real_glGetSamplerParameteriv != NULL) glad_glGetSamplerParameteriv = trace_glGetSamplerParameteriv;
+	trace_real_glGetSamplerParameterIiv = glad_glGetSamplerParameterIiv;
+	if(trace_real_glGetSamplerParameterIiv != NULL) glad_glGetSamplerParameterIiv = trace_glGetSamplerParameterIiv;
+	trace_real_glGetSamplerParameterfv = glad_glGetSamplerParameterfv;
+	if(trace_real_glGetSamplerParameterfv != NULL) glad_glGetSamplerParameterfv = trace_glGetSamplerParameterfv;
+	trace_real_glGetSamplerParameterIuiv = glad_glGetSamplerParameterIuiv;
+	if(trace_real_glGetSamplerParameterIuiv != NULL) glad_glGetSamplerParameterIuiv = trace_glGetSamplerParameterIuiv;
+	trace_real_glQueryCounter = glad_glQueryCounter;
+	if(trace_real_glQueryCounter != NULL) glad_glQueryCounter = trace_glQueryCounter;
+	trace_real_glGetQueryObjecti64v = glad_glGetQueryObjecti64v;
+	if(trace_real_glGetQueryObjecti64v != NULL) glad_glGetQueryObjecti64v = trace_glGetQueryObjecti64v;
+	trace_real_glGetQueryObjectui64v = glad_glGetQueryObjectui64v;
+	if(trace_real_glGetQueryObjectui64v != NULL) glad_glGetQueryObjectui64v = trace_glGetQueryObjectui64v;
+	trace_real_glVertexAttribDivisor = glad_glVertexAttribDivisor;
+	if(trace_real_glVertexAttribDivisor != NULL) glad_glVertexAttribDivisor = trace_glVertexAttribDivisor;
+	trace_real_glVertexAttribP1ui = glad_glVertexAttribP1ui;
+	if(trace_real_glVertexAttribP1ui != NULL) glad_glVertexAttribP1ui = trace_glVertexAttribP1ui;
+	trace_real_glVertexAttribP1uiv = glad_glVertexAttribP1uiv;
+	if(trace_real_glVertexAttribP1uiv != NULL) glad_glVertexAttribP1uiv = trace_glVertexAttribP1uiv;
+	trace_real_glVertexAttribP2ui = glad_glVertexAttribP2ui;
+	if(trace_real_glVertexAttribP2ui != NULL) glad_glVertexAttribP2ui = trace_glVertexAttribP2ui;
+	trace_real_glVertexAttribP2uiv = glad_glVertexAttribP2uiv;
+	if(trace_real_glVertexAttribP2uiv != NULL) glad_glVertexAttribP2uiv = trace_glVertexAttribP2uiv;
+	trace_real_glVertexAttribP3ui = glad_glVertexAttribP3ui;
+	if(trace_real_glVertexAttribP3ui != NULL) glad_glVertexAttribP3ui = trace_glVertexAttribP3ui;
+	trace_real_glVertexAttribP3uiv = glad_glVertexAttribP3uiv;
+	if(trace_real_glVertexAttribP3uiv != NULL) glad_glVertexAttribP3uiv = trace_glVertexAttribP3uiv;
+	trace_real_glVertexAttribP4ui = glad_glVertexAttribP4ui;
+	if(trace_real_glVertexAttribP4ui != NULL) glad_glVertexAttribP4ui = trace_glVertexAttribP4ui;
+	trace_real_glVertexAttribP4uiv = glad_glVertexAttribP4uiv;
+	if(trace_real_glVertexAttribP4uiv != NULL) glad_glVertexAttribP4uiv = trace_glVertexAttribP4uiv;
+	trace_real_glVertexP2ui = glad_glVertexP2ui;
+	if(trace_real_glVertexP2ui != NULL) glad_glVertexP2ui = trace_glVertexP2ui;
+	trace_real_glVertexP2uiv = glad_glVertexP2uiv;
+	if(trace_real_glVertexP2uiv != NULL) glad_glVertexP2uiv = trace_glVertexP2uiv;
+	trace_real_glVertexP3ui = glad_glVertexP3ui;
+	if(trace_real_glVertexP3ui != NULL) glad_glVertexP3ui = trace_glVertexP3ui;
+	trace_real_glVertexP3uiv = glad_glVertexP3uiv;
+	if(trace_real_glVertexP3uiv != NULL) glad_glVertexP3uiv = trace_glVertexP3uiv;
+	trace_real_glVertexP4ui = glad_glVertexP4ui;
+	if(trace_real_glVertexP4ui != NULL) glad_glVertexP4ui = trace_glVertexP4ui;
+	trace_real_glVertexP4uiv = glad_glVertexP4uiv;
+	if(trace_real_glVertexP4uiv != NULL) glad_glVertexP4uiv = trace_glVertexP4uiv;
+	trace_real_glTexCoordP1ui = glad_glTexCoordP1ui;
+	if(trace_real_glTexCoordP1ui != NULL) glad_glTexCoordP1ui = trace_glTexCoordP1ui;
+	trace_real_glTexCoordP1uiv = glad_glTexCoordP1uiv;
+	if(trace_real_glTexCoordP1uiv != NULL) glad_glTexCoordP1uiv = trace_glTexCoordP1uiv;
+	trace_real_glTexCoordP2ui = glad_glTexCoordP2ui;
+	if(trace_real_glTexCoordP2ui != NULL) glad_glTexCoordP2ui = trace_glTexCoordP2ui;
+	trace_real_glTexCoordP2uiv = glad_glTexCoordP2uiv;
+	if(trace_real_glTexCoordP2uiv != NULL) glad_glTexCoordP2uiv = trace_glTexCoordP2uiv;
+	trace_real_glTexCoordP3ui = glad_glTexCoordP3ui;
+	if(trace_real_glTexCoordP3ui != NULL) glad_glTexCoordP3ui = trace_glTexCoordP3ui;
+	trace_real_glTexCoordP3uiv = glad_glTexCoordP3uiv;
+	if(trace_real_glTexCoordP3uiv != NULL) glad_glTexCoordP3uiv = trace_glTexCoordP3uiv;
+	trace_real_glTexCoordP4ui = glad_glTexCoordP4ui;
+	if(trace_real_glTexCoordP4ui != NULL) glad_glTexCoordP4ui = trace_glTexCoordP4ui;
+	trace_real_glTexCoordP4uiv = glad_glTexCoordP4uiv;
+	if(trace_real_glTexCoordP4uiv != NULL) glad_glTexCoordP4uiv = trace_glTexCoordP4uiv;
+	trace_real_glMultiTexCoordP1ui = glad_glMultiTexCoordP1ui;
+	if(trace_real_glMultiTexCoordP1ui != NULL) glad_glMultiTexCoordP1ui = trace_glMultiTexCoordP1ui;
+	trace_real_glMultiTexCoordP1uiv = glad_glMultiTexCoordP1uiv;
+	if(trace_real_glMultiTexCoordP1uiv != NULL) glad_glMultiTexCoordP1uiv = trace_glMultiTexCoordP1uiv;
+	trace_real_glMultiTexCoordP2ui = glad_glMultiTexCoordP2ui;
+	if(trace_real_glMultiTexCoordP2ui != NULL) glad_glMultiTexCoordP2ui = trace_glMultiTexCoordP2ui;
+	trace_real_glMultiTexCoordP2uiv = glad_glMultiTexCoordP2uiv;
+	if(trace_real_glMultiTexCoordP2uiv != NULL) glad_glMultiTexCoordP2uiv = trace_glMultiTexCoordP2uiv;
+	trace_real_glMultiTexCoordP3ui = glad_glMultiTexCoordP3ui;
+	if(trace_real_glMultiTexCoordP3ui != NULL) glad_glMultiTexCoordP3ui = trace_glMultiTexCoordP3ui;
+	trace_real_glMultiTexCoordP3uiv = glad_glMultiTexCoordP3uiv;
+	if(trace_real_glMultiTexCoordP3uiv != NULL) glad_glMultiTexCoordP3uiv = trace_glMultiTexCoordP3uiv;
+	trace_real_glMultiTexCoordP4ui = glad_glMultiTexCoordP4ui;
+	if(trace_real_glMultiTexCoordP4ui != NULL) glad_glMultiTexCoordP4ui = trace_glMultiTexCoordP4ui;
+	trace_real_glMultiTexCoordP4uiv = glad_glMultiTexCoordP4uiv;
+	if(trace_real_glMultiTexCoordP4uiv != NULL) glad_glMultiTexCoordP4uiv = trace_glMultiTexCoordP4uiv;
+	trace_real_glNormalP3ui = glad_glNormalP3ui;
+	if(trace_real_glNormalP3ui != NULL) glad_glNormalP3ui = trace_glNormalP3ui;
+	trace_real_glNormalP3uiv = glad_glNormalP3uiv;
+	if(trace_real_glNormalP3uiv != NULL) glad_glNormalP3uiv = trace_glNormalP3uiv;
+	trace_real_glColorP3ui = glad_glColorP3ui;
+	if(trace_real_glColorP3ui != NULL) glad_glColorP3ui = trace_glColorP3ui;
+	trace_real_glColorP3uiv = glad_glColorP3uiv;
+	if(trace_real_glColorP3uiv != NULL) glad_glColorP3uiv = trace_glColorP3uiv;
+	trace_real_glColorP4ui = glad_glColorP4ui;
+	if(trace_real_glColorP4ui != NULL) glad_glColorP4ui = trace_glColorP4ui;
+	trace_real_glColorP4uiv = glad_glColorP4uiv;
+	if(trace_real_glColorP4uiv != NULL) glad_glColorP4uiv = trace_glColorP4uiv;
+	trace_real_glSecondaryColorP3ui = glad_glSecondaryColorP3ui;
+	if(trace_real_glSecondaryColorP3ui != NULL) glad_glSecondaryColorP3ui = trace_glSecondaryColorP3ui;
+	trace_real_glSecondaryColorP3uiv = glad_glSecondaryColorP3uiv;
+	if(trace_real_glSecondaryColorP3uiv != NULL) glad_glSecondaryColorP3uiv = trace_glSecondaryColorP3uiv;
+	trace_real_glBufferStorage = glad_glBufferStorage;
+	if(trace_real_glBufferStorage != NULL) glad_glBufferStorage = trace_glBufferStorage;
+	trace_real_glDebugMessageControlARB = glad_glDebugMessageControlARB;
+	if(trace_real_glDebugMessageControlARB != NULL) glad_glDebugMessageControlARB = trace_glDebugMessageControlARB;
+	trace_real_glDebugMessageInsertARB = glad_glDebugMessageInsertARB;
+	if(trace_real_glDebugMessageInsertARB != NULL) glad_glDebugMessageInsertARB = trace_glDebugMessageInsertARB;
+	trace_real_glDebugMessageCallbackARB = glad_glDebugMessageCallbackARB;
+	if(trace_real_glDebugMessageCallbackARB != NULL) glad_glDebugMessageCallbackARB = trace_glDebugMessageCallbackARB;
+	trace_real_glGetDebugMessageLogARB = glad_glGetDebugMessageLogARB;
+	if(trace_real_glGetDebugMessageLogARB != NULL) glad_glGetDebugMessageLogARB = trace_glGetDebugMessageLogARB;
+	trace_real_glGetProgramBinary = glad_glGetProgramBinary;
+	if(trace_real_glGetProgramBinary != NULL) glad_glGetProgramBinary = trace_glGetProgramBinary;
+	trace_real_glProgramBinary = glad_glProgramBinary;
+	if(trace_real_glProgramBinary != NULL) glad_glProgramBinary = trace_glProgramBinary;
+	trace_real_glProgramParameteri = glad_glProgramParameteri;
+	if(trace_real_glProgramParameteri != NULL) glad_glProgramParameteri = trace_glProgramParameteri;
+	trace_real_glMaxShaderCompilerThreadsARB = glad_glMaxShaderCompilerThreadsARB;
+	if(trace_real_glMaxShaderCompilerThreadsARB != NULL) glad_glMaxShaderCompilerThreadsARB = trace_glMaxShaderCompilerThreadsARB;
+	trace_real_glDebugMessageControl = glad_glDebugMessageControl;
+	if(trace_real_glDebugMessageControl != NULL) glad_glDebugMessageControl = trace_glDebugMessageControl;
+	trace_real_glDebugMessageInsert = glad_glDebugMessageInsert;
+	if(trace_real_glDebugMessageInsert != NULL) glad_glDebugMessageInsert = trace_glDebugMessageInsert;
+	trace_real_glDebugMessageCallback = glad_glDebugMessageCallback;
+	if(trace_real_glDebugMessageCallback != NULL) glad_glDebugMessageCallback = trace_glDebugMessageCallback;
+	trace_real_glGetDebugMessageLog = glad_glGetDebugMessageLog;
+	if(trace_real_glGetDebugMessageLog != NULL) glad_glGetDebugMessageLog = trace_glGetDebugMessageLog;
+	trace_real_glPushDebugGroup = glad_glPushDebugGroup;
+	if(trace_real_glPushDebugGroup != NULL) glad_glPushDebugGroup = trace_glPushDebugGroup;
+	trace_real_glPopDebugGroup = glad_glPopDebugGroup;
+	if(trace_real_glPopDebugGroup != NULL) glad_glPopDebugGroup = trace_glPopDebugGroup;
+	trace_real_glObjectLabel = glad_glObjectLabel;
+	if(trace_real_glObjectLabel != NULL) glad_glObjectLabel = trace_glObjectLabel;
+	trace_real_glGetObjectLabel = glad_glGetObjectLabel;
+	if(trace_real_glGetObjectLabel != NULL) glad_glGetObjectLabel = trace_glGetObjectLabel;
+	trace_real_glObjectPtrLabel = glad_glObjectPtrLabel;
+	if(trace_real_glObjectPtrLabel != NULL) glad_glObjectPtrLabel = trace_glObjectPtrLabel;
+	trace_real_glGetObjectPtrLabel = glad_glGetObjectPtrLabel;
+	if(trace_real_glGetObjectPtrLabel != NULL) glad_glGetObjectPtrLabel = trace_glGetObjectPtrLabel;
+	trace_real_glMaxShaderCompilerThreadsKHR = glad_glMaxShaderCompilerThreadsKHR;
+	if(trace_real_glMaxShaderCompilerThreadsKHR != NULL) glad_glMaxShaderCompilerThreadsKHR = trace_glMaxShaderCompilerThreadsKHR;
+}
+
+static void trace_uninstall(void) {
+	if(glad_glCullFace == trace_glCullFace) glad_glCullFace = trace_real_glCullFace;
+	if(glad_glFrontFace == trace_glFrontFace) glad_glFrontFace = trace_real_glFrontFace;
+	if(glad_glHint == trace_glHint) glad_glHint = trace_real_glHint;
+	if(glad_glLineWidth == trace_glLineWidth) glad_glLineWidth = trace_real_glLineWidth;
+	if(glad_glPointSize == trace_glPointSize) glad_glPointSize = trace_real_glPointSize;
+	if(glad_glPolygonMode == trace_glPolygonMode) glad_glPolygonMode = trace_real_glPolygonMode;
+	if(glad_glScissor == trace_glScissor) glad_glScissor = trace_real_glScissor;
+	if(glad_glTexParameterf == trace_glTexParameterf) glad_glTexParameterf = trace_real_glTexParameterf;
+	if(glad_glTexParameterfv == trace_glTexParameterfv) glad_glTexParameterfv = trace_real_glTexParameterfv;
+	if(glad_glTexParameteri == trace_glTexParameteri) glad_glTexParameteri = trace_real_glTexParameteri;
+	if(glad_glTexParameteriv == trace_glTexParameteriv) glad_glTexParameteriv = trace_real_glTexParameteriv;
+	if(glad_glTexImage1D == trace_glTexImage1D) glad_glTexImage1D = trace_real_glTexImage1D;
+	if(glad_glTexImage2D == trace_glTexImage2D) glad_glTexImage2D = trace_real_glTexImage2D;
+	if(glad_glDrawBuffer == trace_glDrawBuffer) glad_glDrawBuffer = trace_real_glDrawBuffer;
+	if(glad_glClear == trace_glClear) glad_glClear = trace_real_glClear;
+	if(glad_glClearColor == trace_glClearColor) glad_glClearColor = trace_real_glClearColor;
+	if(glad_glClearStencil == trace_glClearStencil) glad_glClearStencil = trace_real_glClearStencil;
+	if(glad_glClearDepth == trace_glClearDepth) glad_glClearDepth = trace_real_glClearDepth;
+	if(glad_glStencilMask == trace_glStencilMask) glad_glStencilMask = trace_real_glStencilMask;
+	if(glad_glColorMask == trace_glColorMask) glad_glColorMask = trace_real_glColorMask;
+	if(glad_glDepthMask == trace_glDepthMask) glad_glDepthMask = trace_real_glDepthMask;
+	if(glad_glDisable == trace_glDisable) glad_glDisable = trace_real_glDisable;
+	if(glad_glEnable == trace_glEnable) glad_glEnable = trace_real_glEnable;
+	if(glad_glFinish == trace_glFinish) glad_glFinish = trace_real_glFinish;
+	if(glad_glFlush == trace_glFlush) glad_glFlush = trace_real_glFlush;
+	if(glad_glBlendFunc == trace_glBlendFunc) glad_glBlendFunc = trace_real_glBlendFunc;
+	if(glad_glLogicOp == trace_glLogicOp) glad_glLogicOp = trace_real_glLogicOp;
+	if(glad_glStencilFunc == trace_glStencilFunc) glad_glStencilFunc = trace_real_glStencilFunc;
+	if(glad_glStencilOp == trace_glStencilOp) glad_glStencilOp = trace_real_glStencilOp;
+	if(glad_glDepthFunc == trace_glDepthFunc) glad_glDepthFunc = trace_real_glDepthFunc;
+	if(glad_glPixelStoref == trace_glPixelStoref) glad_glPixelStoref = trace_real_glPixelStoref;
+	if(glad_glPixelStorei == trace_glPixelStorei) glad_glPixelStorei = trace_real_glPixelStorei;
+	if(glad_glReadBuffer == trace_glReadBuffer) glad_glReadBuffer = trace_real_glReadBuffer;
+	if(glad_glReadPixels == trace_glReadPixels) glad_glReadPixels = trace_real_glReadPixels;
+	if(glad_glGetBooleanv == trace_glGetBooleanv) glad_glGetBooleanv = trace_real_glGetBooleanv;
+	if(glad_glGetDoublev == trace_glGetDoublev) glad_glGetDoublev = trace_real_glGetDoublev;
+	if(glad_glGetError == trace_glGetError) glad_glGetError = trace_real_glGetError;
+	if(glad_glGetFloatv == trace_glGetFloatv) glad_glGetFloatv = trace_real_glGetFloatv;
+	if(glad_glGetIntegerv == trace_glGetIntegerv) glad_glGetIntegerv = trace_real_glGetIntegerv;
+	if(glad_glGetString == trace_glGetString) glad_glGetString = trace_real_glGetString;
+	if(glad_glGetTexImage == trace_glGetTexImage) glad_glGetTexImage = trace_real_glGetTexImage;
+	if(glad_glGetTexParameterfv == trace_glGetTexParameterfv) glad_glGetTexParameterfv = trace_real_glGetTexParameterfv;
+	if(glad_glGetTexParameteriv == trace_glGetTexParameteriv) glad_glGetTexParameteriv = trace_real_glGetTexParameteriv;
+	if(glad_glGetTexLevelParameterfv == trace_glGetTexLevelParameterfv) glad_glGetTexLevelParameterfv = trace_real_glGetTexLevelParameterfv;
+	if(glad_glGetTexLevelParameteriv == trace_glGetTexLevelParameteriv) glad_glGetTexLevelParameteriv = trace_real_glGetTexLevelParameteriv;
+	if(glad_glIsEnabled == trace_glIsEnabled) glad_glIsEnabled = trace_real_glIsEnabled;
+	if(glad_glDepthRange == trace_glDepthRange) glad_glDepthRange = trace_real_glDepthRange;
+	if(glad_glViewport == trace_glViewport) glad_glViewport = trace_real_glViewport;
+	if(glad_glNewList == trace_glNewList) glad_glNewList = trace_real_glNewList;
+	if(glad_glEndList == trace_glEndList) glad_glEndList = trace_real_glEndList;
+	if(glad_glCallList == trace_glCallList) glad_glCallList = trace_real_glCallList;
+	if(glad_glCallLists == trace_glCallLists) glad_glCallLists = trace_real_glCallLists;
+	if(glad_glDeleteLists == trace_glDeleteLists) glad_glDeleteLists = trace_real_glDeleteLists;
+	if(glad_glGenLists == trace_glGenLists) glad_glGenLists = trace_real_glGenLists;
+	if(glad_glListBase == trace_glListBase) glad_glListBase = trace_real_glListBase;
+	if(glad_glBegin == trace_glBegin) glad_glBegin = trace_real_glBegin;
+	if(glad_glBitmap == trace_glBitmap) glad_glBitmap = trace_real_glBitmap;
+	if(glad_glColor3b == trace_glColor3b) glad_glColor3b = trace_real_glColor3b;
+	if(glad_glColor3bv == trace_glColor3bv) glad_glColor3bv = trace_real_glColor3bv;
+	if(glad_glColor3d == trace_glColor3d) glad_glColor3d = trace_real_glColor3d;
+	if(glad_glColor3dv == trace_glColor3dv) glad_glColor3dv = trace_real_glColor3dv;
+	if(glad_glColor3f == trace_glColor3f) glad_glColor3f = trace_real_glColor3f;
+	if(glad_glColor3fv == trace_glColor3fv) glad_glColor3fv = trace_real_glColor3fv;
+	if(glad_glColor3i == trace_glColor3i) glad_glColor3i = trace_real_glColor3i;
+	if(glad_glColor3iv == trace_glColor3iv) glad_glColor3iv = trace_real_glColor3iv;
+	if(glad_glColor3s == trace_glColor3s) glad_glColor3s = trace_real_glColor3s;
+	if(glad_glColor3sv == trace_glColor3sv) glad_glColor3sv = trace_real_glColor3sv;
+	if(glad_glColor3ub == trace_glColor3ub) glad_glColor3ub = trace_real_glColor3ub;
+	if(glad_glColor3ubv == trace_glColor3ubv) glad_glColor3ubv = trace_real_glColor3ubv;
+	if(glad_glColor3ui == trace_glColor3ui) glad_glColor3ui = trace_real_glColor3ui;
+	if(glad_glColor3uiv == trace_glColor3uiv) glad_glColor3uiv = trace_real_glColor3uiv;
+	if(glad_glColor3us == trace_glColor3us) glad_glColor3us = trace_real_glColor3us;
+	if(glad_glColor3usv == trace_glColor3usv) glad_glColor3usv = trace_real_glColor3usv;
+	if(glad_glColor4b == trace_glColor4b) glad_glColor4b = trace_real_glColor4b;
+	if(glad_glColor4bv == trace_glColor4bv) glad_glColor4bv = trace_real_glColor4bv;
+	if(glad_glColor4d == trace_glColor4d) glad_glColor4d = trace_real_glColor4d;
+	if(glad_glColor4dv == trace_glColor4dv) glad_glColor4dv = trace_real_glColor4dv;
+	if(glad_glColor4f == trace_glColor4f) glad_glColor4f = trace_real_glColor4f;
+	if(glad_glColor4fv == trace_glColor4fv) glad_glColor4fv = trace_real_glColor4fv;
+	if(glad_glColor4i == trace_glColor4i) glad_glColor4i = trace_real_glColor4i;
+	if(glad_glColor4iv == trace_glColor4iv) glad_glColor4iv = trace_real_glColor4iv;
+	if(glad_glColor4s == trace_glColor4s) glad_glColor4s = trace_real_glColor4s;
+	if(glad_glColor4sv == trace_glColor4sv) glad_glColor4sv = trace_real_glColor4sv;
+	if(glad_glColor4ub == trace_glColor4ub) glad_glColor4ub = trace_real_glColor4ub;
+	if(glad_glColor4ubv == trace_glColor4ubv) glad_glColor4ubv = trace_real_glColor4ubv;
+	if(glad_glColor4ui == trace_glColor4ui) glad_glColor4ui = trace_real_glColor4ui;
+	if(glad_glColor4uiv == trace_glColor4uiv) glad_glColor4uiv = trace_real_glColor4uiv;
+	if(glad_glColor4us == trace_glColor4us) glad_glColor4us = trace_real_glColor4us;
+	if(glad_glColor4usv == trace_glColor4usv) glad_glColor4usv = trace_real_glColor4usv;
+	if(glad_glEdgeFlag == trace_glEdgeFlag) glad_glEdgeFlag = trace_real_glEdgeFlag;
+	if(glad_glEdgeFlagv == trace_glEdgeFlagv) glad_glEdgeFlagv = trace_real_glEdgeFlagv;
+	if(glad_glEnd == trace_glEnd) glad_glEnd = trace_real_glEnd;
+	if(glad_glIndexd == trace_glIndexd) glad_glIndexd = trace_real_glIndexd;
+	if(glad_glIndexdv == trace_glIndexdv) glad_glIndexdv = trace_real_glIndexdv;
+	if(glad_glIndexf == trace_glIndexf) glad_glIndexf = trace_real_glIndexf;
+	if(glad_glIndexfv == trace_glIndexfv) glad_glIndexfv = trace_real_glIndexfv;
+	if(glad_glIndexi == trace_glIndexi) glad_glIndexi = trace_real_glIndexi;
+	if(glad_glIndexiv == trace_glIndexiv) glad_glIndexiv = trace_real_glIndexiv;
+	if(glad_glIndexs == trace_glIndexs) glad_glIndexs = trace_real_glIndexs;
+	if(glad_glIndexsv == trace_glIndexsv) glad_glIndexsv = trace_real_glIndexsv;
+	if(glad_glNormal3b == trace_glNormal3b) glad_glNormal3b = trace_real_glNormal3b;
+	if(glad_glNormal3bv == trace_glNormal3bv) glad_glNormal3bv = trace_real_glNormal3bv;
+	if(glad_glNormal3d == trace_glNormal3d) glad_glNormal3d = trace_real_glNormal3d;
+	if(glad_glNormal3dv == trace_glNormal3dv) glad_glNormal3dv = trace_real_glNormal3dv;
+	if(glad_glNormal3f == trace_glNormal3f) glad_glNormal3f = trace_real_glNormal3f;
+	if(glad_glNormal3fv == trace_glNormal3fv) glad_glNormal3fv = trace_real_glNormal3fv;
+	if(glad_glNormal3i == trace_glNormal3i) glad_glNormal3i = trace_real_glNormal3i;
+	if(glad_glNormal3iv == trace_glNormal3iv) glad_glNormal3iv = trace_real_glNormal3iv;
+	if(glad_glNormal3s == trace_glNormal3s) glad_glNormal3s = trace_real_glNormal3s;
+	if(glad_glNormal3sv == trace_glNormal3sv) glad_glNormal3sv = trace_real_glNormal3sv;
+	if(glad_glRasterPos2d == trace_glRasterPos2d) glad_glRasterPos2d = trace_real_glRasterPos2d;
+	if(glad_glRasterPos2dv == trace_glRasterPos2dv) glad_glRasterPos2dv = trace_real_glRasterPos2dv;
+	if(glad_glRasterPos2f == trace_glRasterPos2f) glad_glRasterPos2f = trace_real_glRasterPos2f;
+	if(glad_glRasterPos2fv == trace_glRasterPos2fv) glad_glRasterPos2fv = trace_real_glRasterPos2fv;
+	if(glad_glRasterPos2i == trace_glRasterPos2i) glad_glRasterPos2i = trace_real_glRasterPos2i;
+	if(glad_glRasterPos2iv == trace_glRasterPos2iv) glad_glRasterPos2iv = trace_real_glRasterPos2iv;
+	if(glad_glRasterPos2s == trace_glRasterPos2s) glad_glRasterPos2s = trace_real_glRasterPos2s;
+	if(glad_glRasterPos2sv == trace_glRasterPos2sv) glad_glRasterPos2sv = trace_real_glRasterPos2sv;
+	if(glad_glRasterPos3d == trace_glRasterPos3d) glad_glRasterPos3d = trace_real_glRasterPos3d;
+	if(glad_glRasterPos3dv == trace_glRasterPos3dv) glad_glRasterPos3dv = trace_real_glRasterPos3dv;
+	if(glad_glRasterPos3f == trace_glRasterPos3f) glad_glRasterPos3f = trace_real_glRasterPos3f;
+	if(glad_glRasterPos3fv == trace_glRasterPos3fv) glad_glRasterPos3fv = trace_real_glRasterPos3fv;
+	if(glad_glRasterPos3i == trace_glRasterPos3i) glad_glRasterPos3i = trace_real_glRasterPos3i;
+	if(glad_glRasterPos3iv == trace_glRasterPos3iv) glad_glRasterPos3iv = trace_real_glRasterPos3iv;
+	if(glad_glRasterPos3s == trace_glRasterPos3s) glad_glRasterPos3s = trace_real_glRasterPos3s;
+	if(glad_glRasterPos3sv == trace_glRasterPos3sv) glad_glRasterPos3sv = trace_real_glRasterPos3sv;
+	if(glad_glRasterPos4d == trace_glRasterPos4d) glad_glRasterPos4d = trace_real_glRasterPos4d;
+	if(glad_glRasterPos4dv == trace_glRasterPos4dv) glad_glRasterPos4dv = trace_real_glRasterPos4dv;
+	if(glad_glRasterPos4f == trace_glRasterPos4f) glad_glRasterPos4f = trace_real_glRasterPos4f;
+	if(glad_glRasterPos4fv == trace_glRasterPos4fv) glad_glRasterPos4fv = trace_real_glRasterPos4fv;
+	if(glad_glRasterPos4i == trace_glRasterPos4i) glad_glRasterPos4i = trace_real_glRasterPos4i;
+	if(glad_glRasterPos4iv == trace_glRasterPos4iv) glad_glRasterPos4iv = trace_real_glRasterPos4iv;
+	if(glad_glRasterPos4s == trace_glRasterPos4s) glad_glRasterPos4s = trace_real_glRasterPos4s;
+	if(glad_glRasterPos4sv == trace_glRasterPos4sv) glad_glRasterPos4sv = trace_real_glRasterPos4sv;
+	if(glad_glRectd == trace_glRectd) glad_glRectd = trace_real_glRectd;
+	if(glad_glRectdv == trace_glRectdv) glad_glRectdv = trace_real_glRectdv;
+	if(glad_glRectf == trace_glRectf) glad_glRectf = trace_real_glRectf;
+	if(glad_glRectfv == trace_glRectfv) glad_glRectfv = trace_real_glRectfv;
+	if(glad_glRecti == trace_glRecti) glad_glRecti = trace_real_glRecti;
+	if(glad_glRectiv == trace_glRectiv) glad_glRectiv = trace_real_glRectiv;
+	if(glad_glRects == trace_glRects) glad_glRects = trace_real_glRects;
+	if(glad_glRectsv == trace_glRectsv) glad_glRectsv = trace_real_glRectsv;
+	if(glad_glTexCoord1d == trace_glTexCoord1d) glad_glTexCoord1d = trace_real_glTexCoord1d;
+	if(glad_glTexCoord1dv == trace_glTexCoord1dv) glad_glTexCoord1dv = trace_real_glTexCoord1dv;
+	if(glad_glTexCoord1f == trace_glTexCoord1f) glad_glTexCoord1f = trace_real_glTexCoord1f;
+	if(glad_glTexCoord1fv == trace_glTexCoord1fv) glad_glTexCoord1fv = trace_real_glTexCoord1fv;
+	if(glad_glTexCoord1i == trace_glTexCoord1i) glad_glTexCoord1i = trace_real_glTexCoord1i;
+	if(glad_glTexCoord1iv == trace_glTexCoord1iv) glad_glTexCoord1iv = trace_real_glTexCoord1iv;
+	if(glad_glTexCoord1s == trace_glTexCoord1s) glad_glTexCoord1s = trace_real_glTexCoord1s;
+	if(glad_glTexCoord1sv == trace_glTexCoord1sv) glad_glTexCoord1sv = trace_real_glTexCoord1sv;
+	if(glad_glTexCoord2d == trace_glTexCoord2d) glad_glTexCoord2d = trace_real_glTexCoord2d;
+	if(glad_glTexCoord2dv == trace_glTexCoord2dv) glad_glTexCoord2dv = trace_real_glTexCoord2dv;
+	if(glad_glTexCoord2f == trace_glTexCoord2f) glad_glTexCoord2f = trace_real_glTexCoord2f;
+	if(glad_glTexCoord2fv == trace_glTexCoord2fv) glad_glTexCoord2fv = trace_real_glTexCoord2fv;
+	if(glad_glTexCoord2i == trace_glTexCoord2i) glad_glTexCoord2i = trace_real_glTexCoord2i;
+	if(glad_glTexCoord2iv == trace_glTexCoord2iv) glad_glTexCoord2iv = trace_real_glTexCoord2iv;
+	if(glad_glTexCoord2s == trace_glTexCoord2s) glad_glTexCoord2s = trace_real_glTexCoord2s;
+	if(glad_glTexCoord2sv == trace_glTexCoord2sv) glad_glTexCoord2sv = trace_real_glTexCoord2sv;
+	if(glad_glTexCoord3d == trace_glTexCoord3d) glad_glTexCoord3d = trace_real_glTexCoord3d;
+	if(glad_glTexCoord3dv == trace_glTexCoord3dv) glad_glTexCoord3dv = trace_real_glTexCoord3dv;
+	if(glad_glTexCoord3f == trace_glTexCoord3f) glad_glTexCoord3f = trace_real_glTexCoord3f;
+	if(glad_glTexCoord3fv == trace_glTexCoord3fv) glad_glTexCoord3fv = trace_real_glTexCoord3fv;
+	if(glad_glTexCoord3i == trace_glTexCoord3i) glad_glTexCoord3i = trace_real_glTexCoord3i;
+	if(glad_glTexCoord3iv == trace_glTexCoord3iv) glad_glTexCoord3iv = trace_real_glTexCoord3iv;
+	if(glad_glTexCoord3s == trace_glTexCoord3s) glad_glTexCoord3s = trace_real_glTexCoord3s;
+	if(glad_glTexCoord3sv == trace_glTexCoord3sv) glad_glTexCoord3sv = trace_real_glTexCoord3sv;
+	if(glad_glTexCoord4d == trace_glTexCoord4d) glad_glTexCoord4d = trace_real_glTexCoord4d;
+	if(glad_glTexCoord4dv == trace_glTexCoord4dv) glad_glTexCoord4dv = trace_real_glTexCoord4dv;
+	if(glad_glTexCoord4f == trace_glTexCoord4f) glad_glTexCoord4f = trace_real_glTexCoord4f;
+	if(glad_glTexCoord4fv == trace_glTexCoord4fv) glad_glTexCoord4fv = trace_real_glTexCoord4fv;
+	if(glad_glTexCoord4i == trace_glTexCoord4i) glad_glTexCoord4i = trace_real_glTexCoord4i;
+	if(glad_glTexCoord4iv == trace_glTexCoord4iv) glad_glTexCoord4iv = trace_real_glTexCoord4iv;
+	if(glad_glTexCoord4s == trace_glTexCoord4s) glad_glTexCoord4s = trace_real_glTexCoord4s;
+	if(glad_glTexCoord4sv == trace_glTexCoord4sv) glad_glTexCoord4sv = trace_real_glTexCoord4sv;
+	if(glad_glVertex2d == trace_glVertex2d) glad_glVertex2d = trace_real_glVertex2d;
+	if(glad_glVertex2dv == trace_glVertex2dv) glad_glVertex2dv = trace_real_glVertex2dv;
+	if(glad_glVertex2f == trace_glVertex2f) glad_glVertex2f = trace_real_glVertex2f;
+	if(glad_glVertex2fv == trace_glVertex2fv) glad_glVertex2fv = trace_real_glVertex2fv;
+	if(glad_glVertex2i == trace_glVertex2i) glad_glVertex2i = trace_real_glVertex2i;
+	if(glad_glVertex2iv == trace_glVertex2iv) glad_glVertex2iv = trace_real_glVertex2iv;
+	if(glad_glVertex2s == trace_glVertex2s) glad_glVertex2s = trace_real_glVertex2s;
+	if(glad_glVertex2sv == trace_glVertex2sv) glad_glVertex2sv = trace_real_glVertex2sv;
+	if(glad_glVertex3d == trace_glVertex3d) glad_glVertex3d = trace_real_glVertex3d;
+	if(glad_glVertex3dv == trace_glVertex3dv) glad_glVertex3dv = trace_real_glVertex3dv;
+	if(glad_glVertex3f == trace_glVertex3f) glad_glVertex3f = trace_real_glVertex3f;
+	if(glad_glVertex3fv == trace_glVertex3fv) glad_glVertex3fv = trace_real_glVertex3fv;
+	if(glad_glVertex3i == trace_glVertex3i) glad_glVertex3i = trace_real_glVertex3i;
+	if(glad_glVertex3iv == trace_glVertex3iv) glad_glVertex3iv = trace_real_glVertex3iv;
+	if(glad_glVertex3s == trace_glVertex3s) glad_glVertex3s = trace_real_glVertex3s;
+	if(glad_glVertex3sv == trace_glVertex3sv) glad_glVertex3sv = trace_real_glVertex3sv;
+	if(glad_glVertex4d == trace_glVertex4d) glad_glVertex4d = trace_real_glVertex4d;
+	if(glad_glVertex4dv == trace_glVertex4dv) glad_glVertex4dv = trace_real_glVertex4dv;
+	if(glad_glVertex4f == trace_glVertex4f) glad_glVertex4f = trace_real_glVertex4f;
+	if(glad_glVertex4fv == trace_glVertex4fv) glad_glVertex4fv = trace_real_glVertex4fv;
+	if(glad_glVertex4i == trace_glVertex4i) glad_glVertex4i = trace_real_glVertex4i;
+	if(glad_glVertex4iv == trace_glVertex4iv) glad_glVertex4iv = trace_real_glVertex4iv;
+	if(glad_glVertex4s == trace_glVertex4s) glad_glVertex4s = trace_real_glVertex4s;
+	if(glad_glVertex4sv == trace_glVertex4sv) glad_glVertex4sv = trace_real_glVertex4sv;
+	if(glad_glClipPlane == trace_glClipPlane) glad_glClipPlane = trace_real_glClipPlane;
+	if(glad_glColorMaterial == trace_glColorMaterial) glad_glColorMaterial = trace_real_glColorMaterial;
+	if(glad_glFogf == trace_glFogf) glad_glFogf = trace_real_glFogf;
+	if(glad_glFogfv == trace_glFogfv) glad_glFogfv = trace_real_glFogfv;
+	if(glad_glFogi == trace_glFogi) glad_glFogi = trace_real_glFogi;
+	if(glad_glFogiv == trace_glFogiv) glad_glFogiv = trace_real_glFogiv;
+	if(glad_glLightf == trace_glLightf) glad_glLightf = trace_real_glLightf;
+	if(glad_glLightfv == trace_glLightfv) glad_glLightfv = trace_real_glLightfv;
+	if(glad_glLighti == trace_glLighti) glad_glLighti = trace_real_glLighti;
+	if(glad_glLightiv == trace_glLightiv) glad_glLightiv = trace_real_glLightiv;
+	if(glad_glLightModelf == trace_glLightModelf) glad_glLightModelf = trace_real_glLightModelf;
+	if(glad_glLightModelfv == trace_glLightModelfv) glad_glLightModelfv = trace_real_glLightModelfv;
+	if(glad_glLightModeli == trace_glLightModeli) glad_glLightModeli = trace_real_glLightModeli;
+	if(glad_glLightModeliv == trace_glLightModeliv) glad_glLightModeliv = trace_real_glLightModeliv;
+	if(glad_glLineStipple == trace_glLineStipple) glad_glLineStipple = trace_real_glLineStipple;
+	if(glad_glMaterialf == trace_glMaterialf) glad_glMaterialf = trace_real_glMaterialf;
+	if(glad_glMaterialfv == trace_glMaterialfv) glad_glMaterialfv = trace_real_glMaterialfv;
+	if(glad_glMateriali == trace_glMateriali) glad_glMateriali = trace_real_glMateriali;
+	if(glad_glMaterialiv == trace_glMaterialiv) glad_glMaterialiv = trace_real_glMaterialiv;
+	if(glad_glPolygonStipple == trace_glPolygonStipple) glad_glPolygonStipple = trace_real_glPolygonStipple;
+	if(glad_glShadeModel == trace_glShadeModel) glad_glShadeModel = trace_real_glShadeModel;
+	if(glad_glTexEnvf == trace_glTexEnvf) glad_glTexEnvf = trace_real_glTexEnvf;
+	if(glad_glTexEnvfv == trace_glTexEnvfv) glad_glTexEnvfv = trace_real_glTexEnvfv;
+	if(glad_glTexEnvi == trace_glTexEnvi) glad_glTexEnvi = trace_real_glTexEnvi;
+	if(glad_glTexEnviv == trace_glTexEnviv) glad_glTexEnviv = trace_real_glTexEnviv;
+	if(glad_glTexGend == trace_glTexGend) glad_glTexGend = trace_real_glTexGend;
+	if(glad_glTexGendv == trace_glTexGendv) glad_glTexGendv = trace_real_glTexGendv;
+	if(glad_glTexGenf == trace_glTexGenf) glad_glTexGenf = trace_real_glTexGenf;
+	if(glad_glTexGenfv == trace_glTexGenfv) glad_glTexGenfv = trace_real_glTexGenfv;
+	if(glad_glTexGeni == trace_glTexGeni) glad_glTexGeni = trace_real_glTexGeni;
+	if(glad_glTexGeniv == trace_glTexGeniv) glad_glTexGeniv = trace_real_glTexGeniv;
+	if(glad_glFeedbackBuffer == trace_glFeedbackBuffer) glad_glFeedbackBuffer = trace_real_glFeedbackBuffer;
+	if(glad_glSelectBuffer == trace_glSelectBuffer) glad_glSelectBuffer = trace_real_glSelectBuffer;
+	if(glad_glRenderMode == trace_glRenderMode) glad_glRenderMode = trace_real_glRenderMode;
+	if(glad_glInitNames == trace_glInitNames) glad_glInitNames = trace_real_glInitNames;
+	if(glad_glLoadName == trace_glLoadName) glad_glLoadName = trace_real_glLoadName;
+	if(glad_glPassThrough == trace_glPassThrough) glad_glPassThrough = trace_real_glPassThrough;
+	if(glad_glPopName == trace_glPopName) glad_glPopName = trace_real_glPopName;
+	if(glad_glPushName == trace_glPushName) glad_glPushName = trace_real_glPushName;
+	if(glad_glClearAccum == trace_glClearAccum) glad_glClearAccum = trace_real_glClearAccum;
+	if(glad_glClearIndex == trace_glClearIndex) glad_glClearIndex = trace_real_glClearIndex;
+	if(glad_glIndexMask == trace_glIndexMask) glad_glIndexMask = trace_real_glIndexMask;
+	if(glad_glAccum == trace_glAccum) glad_glAccum = trace_real_glAccum;
+	if(glad_glPopAttrib == trace_glPopAttrib) glad_glPopAttrib = trace_real_glPopAttrib;
+	if(glad_glPushAttrib == trace_glPushAttrib) glad_glPushAttrib = trace_real_glPushAttrib;
+	if(glad_glMap1d == trace_glMap1d) glad_glMap1d = trace_real_glMap1d;
+	if(glad_glMap1f == trace_glMap1f) glad_glMap1f = trace_real_glMap1f;
+	if(glad_glMap2d == trace_glMap2d) glad_glMap2d = trace_real_glMap2d;
+	if(glad_glMap2f == trace_glMap2f) glad_glMap2f = trace_real_glMap2f;
+	if(glad_glMapGrid1d == trace_glMapGrid1d) glad_glMapGrid1d = trace_real_glMapGrid1d;
+	if(glad_glMapGrid1f == trace_glMapGrid1f) glad_glMapGrid1f = trace_real_glMapGrid1f;
+	if(glad_glMapGrid2d == trace_glMapGrid2d) glad_glMapGrid2d = trace_real_glMapGrid2d;
+	if(glad_glMapGrid2f == trace_glMapGrid2f) glad_glMapGrid2f = trace_real_glMapGrid2f;
+	if(glad_glEvalCoord1d == trace_glEvalCoord1d) glad_glEvalCoord1d = trace_real_glEvalCoord1d;
+	if(glad_glEvalCoord1dv == trace_glEvalCoord1dv) glad_glEvalCoord1dv = trace_real_glEvalCoord1dv;
+	if(glad_glEvalCoord1f == trace_glEvalCoord1f) glad_glEvalCoord1f = trace_real_glEvalCoord1f;
+	if(glad_glEvalCoord1fv == trace_glEvalCoord1fv) glad_glEvalCoord1fv = trace_real_glEvalCoord1fv;
+	if(glad_glEvalCoord2d == trace_glEvalCoord2d) glad_glEvalCoord2d = trace_real_glEvalCoord2d;
+	if(glad_glEvalCoord2dv == trace_glEvalCoord2dv) glad_glEvalCoord2dv = trace_real_glEvalCoord2dv;
+	if(glad_glEvalCoord2f == trace_glEvalCoord2f) glad_glEvalCoord2f = trace_real_glEvalCoord2f;
+	if(glad_glEvalCoord2fv == trace_glEvalCoord2fv) glad_glEvalCoord2fv = trace_real_glEvalCoord2fv;
+	if(glad_glEvalMesh1 == trace_glEvalMesh1) glad_glEvalMesh1 = trace_real_glEvalMesh1;
+	if(glad_glEvalPoint1 == trace_glEvalPoint1) glad_glEvalPoint1 = trace_real_glEvalPoint1;
+	if(glad_glEvalMesh2 == trace_glEvalMesh2) glad_glEvalMesh2 = trace_real_glEvalMesh2;
+	if(glad_glEvalPoint2 == trace_glEvalPoint2) glad_glEvalPoint2 = trace_real_glEvalPoint2;
+	if(glad_glAlphaFunc == trace_glAlphaFunc) glad_glAlphaFunc = trace_real_glAlphaFunc;
+	if(glad_glPixelZoom == trace_glPixelZoom) glad_glPixelZoom = trace_real_glPixelZoom;
+	if(glad_glPixelTransferf == trace_glPixelTransferf) glad_glPixelTransferf = trace_real_glPixelTransferf;
+	if(glad_glPixelTransferi == trace_glPixelTransferi) glad_glPixelTransferi = trace_real_glPixelTransferi;
+	if(glad_glPixelMapfv == trace_glPixelMapfv) glad_glPixelMapfv = trace_real_glPixelMapfv;
+	if(glad_glPixelMapuiv == trace_glPixelMapuiv) glad_glPixelMapuiv = trace_real_glPixelMapuiv;
+	if(glad_glPixelMapusv == trace_glPixelMapusv) glad_glPixelMapusv = trace_real_glPixelMapusv;
+	if(glad_glCopyPixels == trace_glCopyPixels) glad_glCopyPixels = trace_real_glCopyPixels;
+	if(glad_glDrawPixels == trace_glDrawPixels) glad_glDrawPixels = trace_real_glDrawPixels;
+	if(glad_glGetClipPlane == trace_glGetClipPlane) glad_glGetClipPlane = trace_real_glGetClipPlane;
+	if(glad_glGetLightfv == trace_glGetLightfv) glad_glGetLightfv = trace_real_glGetLightfv;
+	if(glad_glGetLightiv == trace_glGetLightiv) glad_glGetLightiv = trace_real_glGetLightiv;
+	if(glad_glGetMapdv == trace_glGetMapdv) glad_glGetMapdv = trace_real_glGetMapdv;
+	if(glad_glGetMapfv == trace_glGetMapfv) glad_glGetMapfv = trace_real_glGetMapfv;
+	if(glad_glGetMapiv == trace_glGetMapiv) glad_glGetMapiv = trace_real_glGetMapiv;
+	if(glad_glGetMaterialfv == trace_glGetMaterialfv) glad_glGetMaterialfv = trace_real_glGetMaterialfv;
+	if(glad_glGetMaterialiv == trace_glGetMaterialiv) glad_glGetMaterialiv = trace_real_glGetMaterialiv;
+	if(glad_glGetPixelMapfv == trace_glGetPixelMapfv) glad_glGetPixelMapfv = trace_real_glGetPixelMapfv;
+	if(glad_glGetPixelMapuiv == trace_glGetPixelMapuiv) glad_glGetPixelMapuiv = trace_real_glGetPixelMapuiv;
+	if(glad_glGetPixelMapusv == trace_glGetPixelMapusv) glad_glGetPixelMapusv = trace_real_glGetPixelMapusv;
+	if(glad_glGetPolygonStipple == trace_glGetPolygonStipple) glad_glGetPolygonStipple = trace_real_glGetPolygonStipple;
+	if(glad_glGetTexEnvfv == trace_glGetTexEnvfv) glad_glGetTexEnvfv = trace_real_glGetTexEnvfv;
+	if(glad_glGetTexEnviv == trace_glGetTexEnviv) glad_glGetTexEnviv = trace_real_glGetTexEnviv;
+	if(glad_glGetTexGendv == trace_glGetTexGendv) glad_glGetTexGendv = trace_real_glGetTexGendv;
+	if(glad_glGetTexGenfv == trace_glGetTexGenfv) glad_glGetTexGenfv = trace_real_glGetTexGenfv;
+	if(glad_glGetTexGeniv == trace_glGetTexGeniv) glad_glGetTexGeniv = trace_real_glGetTexGeniv;
+	if(glad_glIsList == trace_glIsList) glad_glIsList = trace_real_glIsList;
+	if(glad_glFrustum == trace_glFrustum) glad_glFrustum = trace_real_glFrustum;
+	if(glad_glLoadIdentity == trace_glLoadIdentity) glad_glLoadIdentity = trace_real_glLoadIdentity;
+	if(glad_glLoadMatrixf == trace_glLoadMatrixf) glad_glLoadMatrixf = trace_real_glLoadMatrixf;
+	if(glad_glLoadMatrixd == trace_glLoadMatrixd) glad_glLoadMatrixd = trace_real_glLoadMatrixd;
+	if(glad_glMatrixMode == trace_glMatrixMode) glad_glMatrixMode = trace_real_glMatrixMode;
+	if(glad_glMultMatrixf == trace_glMultMatrixf) glad_glMultMatrixf = trace_real_glMultMatrixf;
+	if(glad_glMultMatrixd == trace_glMultMatrixd) glad_glMultMatrixd = trace_real_glMultMatrixd;
+	if(glad_glOrtho == trace_glOrtho) glad_glOrtho = trace_real_glOrtho;
+	if(glad_glPopMatrix == trace_glPopMatrix) glad_glPopMatrix = trace_real_glPopMatrix;
+	if(glad_glPushMatrix == trace_glPushMatrix) glad_glPushMatrix = trace_real_glPushMatrix;
+	if(glad_glRotated == trace_glRotated) glad_glRotated = trace_real_glRotated;
+	if(glad_glRotatef == trace_glRotatef) glad_glRotatef = trace_real_glRotatef;
+	if(glad_glScaled == trace_glScaled) glad_glScaled = trace_real_glScaled;
+	if(glad_glScalef == trace_glScalef) glad_glScalef = trace_real_glScalef;
+	if(glad_glTranslated == trace_glTranslated) glad_glTranslated = trace_real_glTranslated;
+	if(glad_glTranslatef == trace_glTranslatef) glad_glTranslatef = trace_real_glTranslatef;
+	if(glad_glDrawArrays == trace_glDrawArrays) glad_glDrawArrays = trace_real_glDrawArrays;
+	if(glad_glDrawElements == trace_glDrawElements) glad_glDrawElements = trace_real_glDrawElements;
+	if(glad_glGetPointerv == trace_glGetPointerv) glad_glGetPointerv = trace_real_glGetPointerv;
+	if(glad_glPolygonOffset == trace_glPolygonOffset) glad_glPolygonOffset = trace_real_glPolygonOffset;
+	if(glad_glCopyTexImage1D == trace_glCopyTexImage1D) glad_glCopyTexImage1D = trace_real_glCopyTexImage1D;
+	if(glad_glCopyTexImage2D == trace_glCopyTexImage2D) glad_glCopyTexImage2D = trace_real_glCopyTexImage2D;
+	if(glad_glCopyTexSubImage1D == trace_glCopyTexSubImage1D) glad_glCopyTexSubImage1D = trace_real_glCopyTexSubImage1D;
+	if(glad_glCopyTexSubImage2D == trace_glCopyTexSubImage2D) glad_glCopyTexSubImage2D = trace_real_glCopyTexSubImage2D;
+	if(glad_glTexSubImage1D == trace_glTexSubImage1D) glad_glTexSubImage1D = trace_real_glTexSubImage1D;
+	if(glad_glTexSubImage2D == trace_glTexSubImage2D) glad_glTexSubImage2D = trace_real_glTexSubImage2D;
+	if(glad_glBindTexture == trace_glBindTexture) glad_glBindTexture = trace_real_glBindTexture;
+	if(glad_glDeleteTextures == trace_glDeleteTextures) glad_glDeleteTextures = trace_real_glDeleteTextures;
+	if(glad_glGenTextures == trace_glGenTextures) glad_glGenTextures = trace_real_glGenTextures;
+	if(glad_glIsTexture == trace_glIsTexture) glad_glIsTexture = trace_real_glIsTexture;
+	if(glad_glArrayElement == trace_glArrayElement) glad_glArrayElement = trace_real_glArrayElement;
+	if(glad_glColorPointer == trace_glColorPointer) glad_glColorPointer = trace_real_glColorPointer;
+	if(glad_glDisableClientState == trace_glDisableClientState) glad_glDisableClientState = trace_real_glDisableClientState;
+	if(glad_glEdgeFlagPointer == trace_glEdgeFlagPointer) glad_glEdgeFlagPointer = trace_real_glEdgeFlagPointer;
+	if(glad_glEnableClientState == trace_glEnableClientState) glad_glEnableClientState = trace_real_glEnableClientState;
+	if(glad_glIndexPointer == trace_glIndexPointer) glad_glIndexPointer = trace_real_glIndexPointer;
+	if(glad_glInterleavedArrays == trace_glInterleavedArrays) glad_glInterleavedArrays = trace_real_glInterleavedArrays;
+	if(glad_glNormalPointer == trace_glNormalPointer) glad_glNormalPointer = trace_real_glNormalPointer;
+	if(glad_glTexCoordPointer == trace_glTexCoordPointer) glad_glTexCoordPointer = trace_real_glTexCoordPointer;
+	if(glad_glVertexPointer == trace_glVertexPointer) glad_glVertexPointer = trace_real_glVertexPointer;
+	if(glad_glAreTexturesResident == trace_glAreTexturesResident) glad_glAreTexturesResident = trace_real_glAreTexturesResident;
+	if(glad_glPrioritizeTextures == trace_glPrioritizeTextures) glad_glPrioritizeTextures = trace_real_glPrioritizeTextures;
+	if(glad_glIndexub == trace_glIndexub) glad_glIndexub = trace_real_glIndexub;
+	if(glad_glIndexubv == trace_glIndexubv) glad_glIndexubv = trace_real_glIndexubv;
+	if(glad_glPopClientAttrib == trace_glPopClientAttrib) glad_glPopClientAttrib = trace_real_glPopClientAttrib;
+	if(glad_glPushClientAttrib == trace_glPushClientAttrib) glad_glPushClientAttrib = trace_real_glPushClientAttrib;
+	if(glad_glDrawRangeElements == trace_glDrawRangeElements) glad_glDrawRangeElements = trace_real_glDrawRangeElements;
+	if(glad_glTexImage3D == trace_glTexImage3D) glad_glTexImage3D = trace_real_glTexImage3D;
+	if(glad_glTexSubImage3D == trace_glTexSubImage3D) glad_glTexSubImage3D = trace_real_glTexSubImage3D;
+	if(glad_glCopyTexSubImage3D == trace_glCopyTexSubImage3D) glad_glCopyTexSubImage3D = trace_real_glCopyTexSubImage3D;
+	if(glad_glActiveTexture == trace_glActiveTexture) glad_glActiveTexture = trace_real_glActiveTexture;
+	if(glad_glSampleCoverage == trace_glSampleCoverage) glad_glSampleCoverage = trace_real_glSampleCoverage;
+	if(glad_glCompressedTexImage3D == trace_glCompressedTexImage3D) glad_glCompressedTexImage3D = trace_real_glCompressedTexImage3D;
+	if(glad_glCompressedTexImage2D == trace_glCompressedTexImage2D) glad_glCompressedTexImage2D = trace_real_glCompressedTexImage2D;
+	if(glad_glCompressedTexImage1D == trace_glCompressedTexImage1D) glad_glCompressedTexImage1D = trace_real_glCompressedTexImage1D;
+	if(glad_glCompressedTexSubImage3D == trace_glCompressedTexSubImage3D) glad_glCompressedTexSubImage3D = trace_real_glCompressedTexSubImage3D;
+	if(glad_glCompressedTexSubImage2D == trace_glCompressedTexSubImage2D) glad_glCompressedTexSubImage2D = trace_real_glCompressedTexSubImage2D;
+	if(glad_glCompressedTexSubImage1D == trace_glCompressedTexSubImage1D) glad_glCompressedTexSubImage1D = trace_real_glCompressedTexSubImage1D;
+	if(glad_glGetCompressedTexImage == trace_glGetCompressedTexImage) glad_glGetCompressedTexImage = trace_real_glGetCompressedTexImage;
+	if(glad_glClientActiveTexture == trace_glClientActiveTexture) glad_glClientActiveTexture = trace_real_glClientActiveTexture;
+	if(glad_glMultiTexCoord1d == trace_glMultiTexCoord1d) glad_glMultiTexCoord1d = trace_real_glMultiTexCoord1d;
+	if(glad_glMultiTexCoord1dv == trace_glMultiTexCoord1dv) glad_glMultiTexCoord1dv = trace_real_glMultiTexCoord1dv;
+	if(glad_glMultiTexCoord1f == trace_glMultiTexCoord1f) glad_glMultiTexCoord1f = trace_real_glMultiTexCoord1f;
+	if(glad_glMultiTexCoord1fv == trace_glMultiTexCoord1fv) glad_glMultiTexCoord1fv = trace_real_glMultiTexCoord1fv;
+	if(glad_glMultiTexCoord1i == trace_glMultiTexCoord1i) glad_glMultiTexCoord1i = trace_real_glMultiTexCoord1i;
+	if(glad_glMultiTexCoord1iv == trace_glMultiTexCoord1iv) glad_glMultiTexCoord1iv = trace_real_glMultiTexCoord1iv;
+	if(glad_glMultiTexCoord1s == trace_glMultiTexCoord1s) glad_glMultiTexCoord1s = trace_real_glMultiTexCoord1s;
+	if(glad_glMultiTexCoord1sv == trace_glMultiTexCoord1sv) glad_glMultiTexCoord1sv = trace_real_glMultiTexCoord1sv;
+	if(glad_glMultiTexCoord2d == trace_glMultiTexCoord2d) glad_glMultiTexCoord2d = trace_real_glMultiTexCoord2d;
+	if(glad_glMultiTexCoord2dv == trace_glMultiTexCoord2dv) glad_glMultiTexCoord2dv = trace_real_glMultiTexCoord2dv;
+	if(glad_glMultiTexCoord2f == trace_glMultiTexCoord2f) glad_glMultiTexCoord2f = trace_real_glMultiTexCoord2f;
+	if(glad_glMultiTexCoord2fv == trace_glMultiTexCoord2fv) glad_glMultiTexCoord2fv = trace_real_glMultiTexCoord2fv;
+	if(glad_glMultiTexCoord2i == trace_glMultiTexCoord2i) glad_glMultiTexCoord2i = trace_real_glMultiTexCoord2i;
+	if(glad_glMultiTexCoord2iv == trace_glMultiTexCoord2iv) glad_glMultiTexCoord2iv = trace_real_glMultiTexCoord2iv;
+	if(glad_glMultiTexCoord2s == trace_glMultiTexCoord2s) glad_glMultiTexCoord2s = trace_real_glMultiTexCoord2s;
+	if(glad_glMultiTexCoord2sv == trace_glMultiTexCoord2sv) glad_glMultiTexCoord2sv = trace_real_glMultiTexCoord2sv;
+	if(glad_glMultiTexCoord3d == trace_glMultiTexCoord3d) glad_glMultiTexCoord3d = trace_real_glMultiTexCoord3d;
+	if(glad_glMultiTexCoord3dv == trace_glMultiTexCoord3dv) glad_glMultiTexCoord3dv = trace_real_glMultiTexCoord3dv;
+	if(glad_glMultiTexCoord3f == trace_glMultiTexCoord3f) glad_glMultiTexCoord3f = trace_real_glMultiTexCoord3f;
+	if(glad_glMultiTexCoord3fv == trace_glMultiTexCoord3fv) glad_glMultiTexCoord3fv = trace_real_glMultiTexCoord3fv;
+	if(glad_glMultiTexCoord3i == trace_glMultiTexCoord3i) glad_glMultiTexCoord3i = trace_real_glMultiTexCoord3i;
+	if(glad_glMultiTexCoord3iv == trace_glMultiTexCoord3iv) glad_glMultiTexCoord3iv = trace_real_glMultiTexCoord3iv;
+	if(glad_glMultiTexCoord3s == trace_glMultiTexCoord3s) glad_glMultiTexCoord3s = trace_real_glMultiTexCoord3s;
+	if(glad_glMultiTexCoord3sv == trace_glMultiTexCoord3sv) glad_glMultiTexCoord3sv = trace_real_glMultiTexCoord3sv;
+	if(glad_glMultiTexCoord4d == trace_glMultiTexCoord4d) glad_glMultiTexCoord4d = trace_real_glMultiTexCoord4d;
+	if(glad_glMultiTexCoord4dv == trace_glMultiTexCoord4dv) glad_glMultiTexCoord4dv = trace_real_glMultiTexCoord4dv;
+	if(glad_glMultiTexCoord4f == trace_glMultiTexCoord4f) glad_glMultiTexCoord4f = trace_real_glMultiTexCoord4f;
+	if(glad_glMultiTexCoord4fv == trace_glMultiTexCoord4fv) glad_glMultiTexCoord4fv = trace_real_glMultiTexCoord4fv;
+	if(glad_glMultiTexCoord4i == trace_glMultiTexCoord4i) glad_glMultiTexCoord4i = trace_real_glMultiTexCoord4i;
+	if(glad_glMultiTexCoord4iv == trace_glMultiTexCoord4iv) glad_glMultiTexCoord4iv = trace_real_glMultiTexCoord4iv;
+	if(glad_glMultiTexCoord4s == trace_glMultiTexCoord4s) glad_glMultiTexCoord4s = trace_real_glMultiTexCoord4s;
+	if(glad_glMultiTexCoord4sv == trace_glMultiTexCoord4sv) glad_glMultiTexCoord4sv = trace_real_glMultiTexCoord4sv;
+	if(glad_glLoadTransposeMatrixf == trace_glLoadTransposeMatrixf) glad_glLoadTransposeMatrixf = trace_real_glLoadTransposeMatrixf;
+	if(glad_glLoadTransposeMatrixd == trace_glLoadTransposeMatrixd) glad_glLoadTransposeMatrixd = trace_real_glLoadTransposeMatrixd;
+	if(glad_glMultTransposeMatrixf == trace_glMultTransposeMatrixf) glad_glMultTransposeMatrixf = trace_real_glMultTransposeMatrixf;
+	if(glad_glMultTransposeMatrixd == trace_glMultTransposeMatrixd) glad_glMultTransposeMatrixd = trace_real_glMultTransposeMatrixd;
+	if(glad_glBlendFuncSeparate == trace_glBlendFuncSeparate) glad_glBlendFuncSeparate = trace_real_glBlendFuncSeparate;
+	if(glad_glMultiDrawArrays == trace_glMultiDrawArrays) glad_glMultiDrawArrays = trace_real_glMultiDrawArrays;
+	if(glad_glMultiDrawElements == trace_glMultiDrawElements) glad_glMultiDrawElements = trace_real_glMultiDrawElements;
+	if(glad_glPointParameterf == trace_glPointParameterf) glad_glPointParameterf = trace_real_glPointParameterf;
+	if(glad_glPointParameterfv == trace_glPointParameterfv) glad_glPointParameterfv = trace_real_glPointParameterfv;
+	if(glad_glPointParameteri == trace_glPointParameteri) glad_glPointParameteri = trace_real_glPointParameteri;
+	if(glad_glPointParameteriv == trace_glPointParameteriv) glad_glPointParameteriv = trace_real_glPointParameteriv;
+	if(glad_glFogCoordf == trace_glFogCoordf) glad_glFogCoordf = trace_real_glFogCoordf;
+	if(glad_glFogCoordfv == trace_glFogCoordfv) glad_glFogCoordfv = trace_real_glFogCoordfv;
+	if(glad_glFogCoordd == trace_glFogCoordd) glad_glFogCoordd = trace_real_glFogCoordd;
+	if(glad_glFogCoorddv == trace_glFogCoorddv) glad_glFogCoorddv = trace_real_glFogCoorddv;
+	if(glad_glFogCoordPointer == trace_glFogCoordPointer) glad_glFogCoordPointer = trace_real_glFogCoordPointer;
+	if(glad_glSecondaryColor3b == trace_glSecondaryColor3b) glad_glSecondaryColor3b = trace_real_glSecondaryColor3b;
+	if(glad_glSecondaryColor3bv == trace_glSecondaryColor3bv) glad_glSecondaryColor3bv = trace_real_glSecondaryColor3bv;
+	if(glad_glSecondaryColor3d == trace_glSecondaryColor3d) glad_glSecondaryColor3d = trace_real_glSecondaryColor3d;
+	if(glad_glSecondaryColor3dv == trace_glSecondaryColor3dv) glad_glSecondaryColor3dv = trace_real_glSecondaryColor3dv;
+	if(glad_glSecondaryColor3f == trace_glSecondaryColor3f) glad_glSecondaryColor3f = trace_real_glSecondaryColor3f;
+	if(glad_glSecondaryColor3fv == trace_glSecondaryColor3fv) glad_glSecondaryColor3fv = trace_real_glSecondaryColor3fv;
+	if(glad_glSecondaryColor3i == trace_glSecondaryColor3i) glad_glSecondaryColor3i = trace_real_glSecondaryColor3i;
+	if(glad_glSecondaryColor3iv == trace_glSecondaryColor3iv) glad_glSecondaryColor3iv = trace_real_glSecondaryColor3iv;
+	if(glad_glSecondaryColor3s == trace_glSecondaryColor3s) glad_glSecondaryColor3s = trace_real_glSecondaryColor3s;
+	if(glad_glSecondaryColor3sv == trace_glSecondaryColor3sv) glad_glSecondaryColor3sv = trace_real_glSecondaryColor3sv;
+	if(glad_glSecondaryColor3ub == trace_glSecondaryColor3ub) glad_glSecondaryColor3ub = trace_real_glSecondaryColor3ub;
+	if(glad_glSecondaryColor3ubv == trace_glSecondaryColor3ubv) glad_glSecondaryColor3ubv = trace_real_glSecondaryColor3ubv;
+	if(glad_glSecondaryColor3ui == trace_glSecondaryColor3ui) glad_glSecondaryColor3ui = trace_real_glSecondaryColor3ui;
+	if(glad_glSecondaryColor3uiv == trace_glSecondaryColor3uiv) glad_glSecondaryColor3uiv = trace_real_glSecondaryColor3uiv;
+	if(glad_glSecondaryColor3us == trace_glSecondaryColor3us) glad_glSecondaryColor3us = trace_real_glSecondaryColor3us;
+	if(glad_glSecondaryColor3usv == trace_glSecondaryColor3usv) glad_glSecondaryColor3usv = trace_real_glSecondaryColor3usv;
+	if(glad_glSecondaryColorPointer == trace_glSecondaryColorPointer) glad_glSecondaryColorPointer = trace_real_glSecondaryColorPointer;
+	if(glad_glWindowPos2d == trace_glWindowPos2d) glad_glWindowPos2d = trace_real_glWindowPos2d;
+	if(glad_glWindowPos2dv == trace_glWindowPos2dv) glad_glWindowPos2dv = trace_real_glWindowPos2dv;
+	if(glad_glWindowPos2f == trace_glWindowPos2f) glad_glWindowPos2f = trace_real_glWindowPos2f;
+	if(glad_glWindowPos2fv == trace_glWindowPos2fv) glad_glWindowPos2fv = trace_real_glWindowPos2fv;
+	if(glad_glWindowPos2i == trace_glWindowPos2i) glad_glWindowPos2i = trace_real_glWindowPos2i;
+	if(glad_glWindowPos2iv == trace_glWindowPos2iv) glad_glWindowPos2iv = trace_real_glWindowPos2iv;
+	if(glad_glWindowPos2s == trace_glWindowPos2s) glad_glWindowPos2s = trace_real_glWindowPos2s;
+	if(glad_glWindowPos2sv == trace_glWindowPos2sv) glad_glWindowPos2sv = trace_real_glWindowPos2sv;
+	if(glad_glWindowPos3d == trace_glWindowPos3d) glad_glWindowPos3d = trace_real_glWindowPos3d;
+	if(glad_glWindowPos3dv == trace_glWindowPos3dv) glad_glWindowPos3dv = trace_real_glWindowPos3dv;
+	if(glad_glWindowPos3f == trace_glWindowPos3f) glad_glWindowPos3f = trace_real_glWindowPos3f;
+	if(glad_glWindowPos3fv == trace_glWindowPos3fv) glad_glWindowPos3fv = trace_real_glWindowPos3fv;
+	if(glad_glWindowPos3i == trace_glWindowPos3i) glad_glWindowPos3i = trace_real_glWindowPos3i;
+	if(glad_glWindowPos3iv == trace_glWindowPos3iv) glad_glWindowPos3iv = trace_real_glWindowPos3iv;
+	if(glad_glWindowPos3s == trace_glWindowPos3s) glad_glWindowPos3s = trace_real_glWindowPos3s;
+	if(glad_glWindowPos3sv == trace_glWindowPos3sv) glad_glWindowPos3sv = trace_real_glWindowPos3sv;
+	if(glad_glBlendColor == trace_glBlendColor) glad_glBlendColor = trace_real_glBlendColor;
+	if(glad_glBlendEquation == trace_glBlendEquation) glad_glBlendEquation = trace_real_glBlendEquation;
+	if(glad_glGenQueries == trace_glGenQueries) glad_glGenQueries = trace_real_glGenQueries;
+	if(glad_glDeleteQueries == trace_glDeleteQueries) glad_glDeleteQueries = trace_real_glDeleteQueries;
+	if(glad_glIsQuery == trace_glIsQuery) glad_glIsQuery = trace_real_glIsQuery;
+	if(glad_glBeginQuery == trace_glBeginQuery) glad_glBeginQuery = trace_real_glBeginQuery;
+	if(glad_glEndQuery == trace_glEndQuery) glad_glEndQuery = trace_real_glEndQuery;
+	if(glad_glGetQueryiv == trace_glGetQueryiv) glad_glGetQueryiv = trace_real_glGetQueryiv;
+	if(glad_glGetQueryObjectiv == trace_glGetQueryObjectiv) glad_glGetQueryObjectiv = trace_real_glGetQueryObjectiv;
+	if(glad_glGetQueryObjectuiv == trace_glGetQueryObjectuiv) glad_glGetQueryObjectuiv = trace_real_glGetQueryObjectuiv;
+	if(glad_glBindBuffer == trace_glBindBuffer) glad_glBindBuffer = trace_real_glBindBuffer;
+	if(glad_glDeleteBuffers == trace_glDeleteBuffers) glad_glDeleteBuffers = trace_real_glDeleteBuffers;
+	if(glad_glGenBuffers == trace_glGenBuffers) glad_glGenBuffers = trace_real_glGenBuffers;
+	if(glad_glIsBuffer == trace_glIsBuffer) glad_glIsBuffer = trace_real_glIsBuffer;
+	if(glad_glBufferData == trace_glBufferData) glad_glBufferData = trace_real_glBufferData;
+	if(glad_glBufferSubData == trace_glBufferSubData) glad_glBufferSubData = trace_real_glBufferSubData;
+	if(glad_glGetBufferSubData == trace_glGetBufferSubData) glad_glGetBufferSubData = trace_real_glGetBufferSubData;
+	if(glad_glMapBuffer == trace_glMapBuffer) glad_glMapBuffer = trace_real_glMapBuffer;
+	if(glad_glUnmapBuffer == trace_glUnmapBuffer) glad_glUnmapBuffer = trace_real_glUnmapBuffer;
+	if(glad_glGetBufferParameteriv == trace_glGetBufferParameteriv) glad_glGetBufferParameteriv = trace_real_glGetBufferParameteriv;
+	if(glad_glGetBufferPointerv == trace_glGetBufferPointerv) glad_glGetBufferPointerv = trace_real_glGetBufferPointerv;
+	if(glad_glBlendEquationSeparate == trace_glBlendEquationSeparate) glad_glBlendEquationSeparate = trace_real_glBlendEquationSeparate;
+	if(glad_glDrawBuffers == trace_glDrawBuffers) glad_glDrawBuffers = trace_real_glDrawBuffers;
+	if(glad_glStencilOpSeparate == trace_glStencilOpSeparate) glad_glStencilOpSeparate = trace_real_glStencilOpSeparate;
+	if(glad_glStencilFuncSeparate == trace_glStencilFuncSeparate) glad_glStencilFuncSeparate = trace_real_glStencilFuncSeparate;
+	if(glad_glStencilMaskSeparate == trace_glStencilMaskSeparate) glad_glStencilMaskSeparate = trace_real_glStencilMaskSeparate;
+	if(glad_glAttachShader == trace_glAttachShader) glad_glAttachShader = trace_real_glAttachShader;
+	if(glad_glBindAttribLocation == trace_glBindAttribLocation) glad_glBindAttribLocation = trace_real_glBindAttribLocation;
+	if(glad_glCompileShader == trace_glCompileShader) glad_glCompileShader = trace_real_glCompileShader;
+	if(glad_glCreateProgram == trace_glCreateProgram) glad_glCreateProgram = trace_real_glCreateProgram;
+	if(glad_glCreateShader == trace_glCreateShader) glad_glCreateShader = trace_real_glCreateShader;
+	if(glad_glDeleteProgram == trace_glDeleteProgram) glad_glDeleteProgram = trace_real_glDeleteProgram;
+	if(glad_glDeleteShader == trace_glDeleteShader) glad_glDeleteShader = trace_real_glDeleteShader;
+	if(glad_glDetachShader == trace_glDetachShader) glad_glDetachShader = trace_real_glDetachShader;
+	if(glad_glDisableVertexAttribArray == trace_glDisableVertexAttribArray) glad_glDisableVertexAttribArray = trace_real_glDisableVertexAttribArray;
+	if(glad_glEnableVertexAttribArray == trace_glEnableVertexAttribArray) glad_glEnableVertexAttribArray = trace_real_glEnableVertexAttribArray;
+	if(glad_glGetActiveAttrib == trace_glGetActiveAttrib) glad_glGetActiveAttrib = trace_real_glGetActiveAttrib;
+	if(glad_glGetActiveUniform == trace_glGetActiveUniform) glad_glGetActiveUniform = trace_real_glGetActiveUniform;
+	if(glad_glGetAttachedShaders == trace_glGetAttachedShaders) glad_glGetAttachedShaders = trace_real_glGetAttachedShaders;
+	if(glad_glGetAttribLocation == trace_glGetAttribLocation) glad_glGetAttribLocation = trace_real_glGetAttribLocation;
+	if(glad_glGetProgramiv == trace_glGetProgramiv) glad_glGetProgramiv = trace_real_glGetProgramiv;
+	if(glad_glGetProgramInfoLog == trace_glGetProgramInfoLog) glad_glGetProgramInfoLog = trace_real_glGetProgramInfoLog;
+	if(glad_glGetShaderiv == trace_glGetShaderiv) glad_glGetShaderiv = trace_real_glGetShaderiv;
+	if(glad_glGetShaderInfoLog == trace_glGetShaderInfoLog) glad_glGetShaderInfoLog = trace_real_glGetShaderInfoLog;
+	if(glad_glGetShaderSource == trace_glGetShaderSource) glad_glGetShaderSource = trace_real_glGetShaderSource;
+	if(glad_glGetUniformLocation == trace_glGetUniformLocation) glad_glGetUniformLocation = trace_real_glGetUniformLocation;
+	if(glad_glGetUniformfv == trace_glGetUniformfv) glad_glGetUniformfv = trace_real_glGetUniformfv;
+	if(glad_glGetUniformiv == trace_glGetUniformiv) glad_glGetUniformiv = trace_real_glGetUniformiv;
+	if(glad_glGetVertexAttribdv == trace_glGetVertexAttribdv) glad_glGetVertexAttribdv = trace_real_glGetVertexAttribdv;
+	if(glad_glGetVertexAttribfv == trace_glGetVertexAttribfv) glad_glGetVertexAttribfv = trace_real_glGetVertexAttribfv;
+	if(glad_glGetVertexAttribiv == trace_glGetVertexAttribiv) glad_glGetVertexAttribiv = trace_real_glGetVertexAttribiv;
+	if(glad_glGetVertexAttribPointerv == trace_glGetVertexAttribPointerv) glad_glGetVertexAttribPointerv = trace_real_glGetVertexAttribPointerv;
+	if(glad_glIsProgram == trace_glIsProgram) glad_glIsProgram = trace_real_glIsProgram;
+	if(glad_glIsShader == trace_glIsShader) glad_glIsShader = trace_real_glIsShader;
+	if(glad_glLinkProgram == trace_glLinkProgram) glad_glLinkProgram = trace_real_glLinkProgram;
+	if(glad_glShaderSource == trace_glShaderSource) glad_glShaderSource = trace_real_glShaderSource;
+	if(glad_glUseProgram == trace_glUseProgram) glad_glUseProgram = trace_real_glUseProgram;
+	if(glad_glUniform1f == trace_glUniform1f) glad_glUniform1f = trace_real_glUniform1f;
+	if(glad_glUniform2f == trace_glUniform2f) glad_glUniform2f = trace_real_glUniform2f;
+	if(glad_glUniform3f == trace_glUniform3f) glad_glUniform3f = trace_real_glUniform3f;
+	if(glad_glUniform4f == trace_glUniform4f) glad_glUniform4f = trace_real_glUniform4f;
+	if(glad_glUniform1i == trace_glUniform1i) glad_glUniform1i = trace_real_glUniform1i;
+	if(glad_glUniform2i == trace_glUniform2i) glad_glUniform2i = trace_real_glUniform2i;
+	if(glad_glUniform3i == trace_glUniform3i) glad_glUniform3i = trace_real_glUniform3i;
+	if(glad_glUniform4i == trace_glUniform4i) glad_glUniform4i = trace_real_glUniform4i;
+	if(glad_glUniform1fv == trace_glUniform1fv) glad_glUniform1fv = trace_real_glUniform1fv;
+	if(glad_glUniform2fv == trace_glUniform2fv) glad_glUniform2fv = trace_real_glUniform2fv;
+	if(glad_glUniform3fv == trace_glUniform3fv) glad_glUniform3fv = trace_real_glUniform3fv;
+	if(glad_glUniform4fv == trace_glUniform4fv) glad_glUniform4fv = trace_real_glUniform4fv;
+	if(glad_glUniform1iv == trace_glUniform1iv) glad_glUniform1iv = trace_real_glUniform1iv;
+	if(glad_glUniform2iv == trace_glUniform2iv) glad_glUniform2iv = trace_real_glUniform2iv;
+	if(glad_glUniform3iv == trace_glUniform3iv) glad_glUniform3iv = trace_real_glUniform3iv;
+	if(glad_glUniform4iv == trace_glUniform4iv) glad_glUniform4iv = trace_real_glUniform4iv;
+	if(glad_glUniformMatrix2fv == trace_glUniformMatrix2fv) glad_glUniformMatrix2fv = trace_real_glUniformMatrix2fv;
+	if(glad_glUniformMatrix3fv == trace_glUniformMatrix3fv) glad_glUniformMatrix3fv = trace_real_glUniformMatrix3fv;
+	if(glad_glUniformMatrix4fv == trace_glUniformMatrix4fv) glad_glUniformMatrix4fv = trace_real_glUniformMatrix4fv;
+	if(glad_glValidateProgram == trace_glValidateProgram) glad_glValidateProgram = trace_real_glValidateProgram;
+	if(glad_glVertexAttrib1d == trace_glVertexAttrib1d) glad_glVertexAttrib1d = trace_real_glVertexAttrib1d;
+	if(glad_glVertexAttrib1dv == trace_glVertexAttrib1dv) glad_glVertexAttrib1dv = trace_real_glVertexAttrib1dv;
+	if(glad_glVertexAttrib1f == trace_glVertexAttrib1f) glad_glVertexAttrib1f = trace_real_glVertexAttrib1f;
+	if(glad_glVertexAttrib1fv == trace_glVertexAttrib1fv) glad_glVertexAttrib1fv = trace_real_glVertexAttrib1fv;
+	if(glad_glVertexAttrib1s == trace_glVertexAttrib1s) glad_glVertexAttrib1s = trace_real_glVertexAttrib1s;
+	if(glad_glVertexAttrib1sv == trace_glVertexAttrib1sv) glad_glVertexAttrib1sv = trace_real_glVertexAttrib1sv;
+	if(glad_glVertexAttrib2d == trace_glVertexAttrib2d) glad_glVertexAttrib2d = trace_real_glVertexAttrib2d;
+	if(glad_glVertexAttrib2dv == trace_glVertexAttrib2dv) glad_glVertexAttrib2dv = trace_real_glVertexAttrib2dv;
+	if(glad_glVertexAttrib2f == trace_glVertexAttrib2f) glad_glVertexAttrib2f = trace_real_glVertexAttrib2f;
+	if(glad_glVertexAttrib2fv == trace_glVertexAttrib2fv) glad_glVertexAttrib2fv = trace_real_glVertexAttrib2fv;
+	if(glad_glVertexAttrib2s == trace_glVertexAttrib2s) glad_glVertexAttrib2s = trace_real_glVertexAttrib2s;
+	if(glad_glVertexAttrib2sv == trace_glVertexAttrib2sv) glad_glVertexAttrib2sv = trace_real_glVertexAttrib2sv;
+	if(glad_glVertexAttrib3d == trace_glVertexAttrib3d) glad_glVertexAttrib3d = trace_real_glVertexAttrib3d;
+	if(glad_glVertexAttrib3dv == trace_glVertexAttrib3dv) glad_glVertexAttrib3dv = trace_real_glVertexAttrib3dv;
+	if(glad_glVertexAttrib3f == trace_glVertexAttrib3f) glad_glVertexAttrib3f = trace_real_glVertexAttrib3f;
+	if(glad_glVertexAttrib3fv == trace_glVertexAttrib3fv) glad_glVertexAttrib3fv = trace_real_glVertexAttrib3fv;
+	if(glad_glVertexAttrib3s == trace_glVertexAttrib3s) glad_glVertexAttrib3s = trace_real_glVertexAttrib3s;
+	if(glad_glVertexAttrib3sv == trace_glVertexAttrib3sv) glad_glVertexAttrib3sv = trace_real_glVertexAttrib3sv;
+	if(glad_glVertexAttrib4Nbv == trace_glVertexAttrib4Nbv) glad_glVertexAttrib4Nbv = trace_real_glVertexAttrib4Nbv;
+	if(glad_glVertexAttrib4Niv == trace_glVertexAttrib4Niv) glad_glVertexAttrib4Niv = trace_real_glVertexAttrib4Niv;
+	if(glad_glVertexAttrib4Nsv == trace_glVertexAttrib4Nsv) glad_glVertexAttrib4Nsv = trace_real_glVertexAttrib4Nsv;
+	if(glad_glVertexAttrib4Nub == trace_glVertexAttrib4Nub) glad_glVertexAttrib4Nub = trace_real_glVertexAttrib4Nub;
+	if(glad_glVertexAttrib4Nubv == trace_glVertexAttrib4Nubv) glad_glVertexAttrib4Nubv = trace_real_glVertexAttrib4Nubv;
+	if(glad_glVertexAttrib4Nuiv == trace_glVertexAttrib4Nuiv) glad_glVertexAttrib4Nuiv = trace_real_glVertexAttrib4Nuiv;
+	if(glad_glVertexAttrib4Nusv == trace_glVertexAttrib4Nusv) glad_glVertexAttrib4Nusv = trace_real_glVertexAttrib4Nusv;
+	if(glad_glVertexAttrib4bv == trace_glVertexAttrib4bv) glad_glVertexAttrib4bv = trace_real_glVertexAttrib4bv;
+	if(glad_glVertexAttrib4d == trace_glVertexAttrib4d) glad_glVertexAttrib4d = trace_real_glVertexAttrib4d;
+	if(glad_glVertexAttrib4dv == trace_glVertexAttrib4dv) glad_glVertexAttrib4dv = trace_real_glVertexAttrib4dv;
+	if(glad_glVertexAttrib4f == trace_glVertexAttrib4f) glad_glVertexAttrib4f = trace_real_glVertexAttrib4f;
+	if(glad_glVertexAttrib4fv == trace_glVertexAttrib4fv) glad_glVertexAttrib4fv = trace_real_glVertexAttrib4fv;
+	if(glad_glVertexAttrib4iv == trace_glVertexAttrib4iv) glad_glVertexAttrib4iv = trace_real_glVertexAttrib4iv;
+	if(glad_glVertexAttrib4s == trace_glVertexAttrib4s) glad_glVertexAttrib4s = trace_real_glVertexAttrib4s;
+	if(glad_glVertexAttrib4sv == trace_glVertexAttrib4sv) glad_glVertexAttrib4sv = trace_real_glVertexAttrib4sv;
+	if(glad_glVertexAttrib4ubv == trace_glVertexAttrib4ubv) glad_glVertexAttrib4ubv = trace_real_glVertexAttrib4ubv;
+	if(glad_glVertexAttrib4uiv == trace_glVertexAttrib4uiv) glad_glVertexAttrib4uiv = trace_real_glVertexAttrib4uiv;
+	if(glad_glVertexAttrib4usv == trace_glVertexAttrib4usv) glad_glVertexAttrib4usv = trace_real_glVertexAttrib4usv;
+	if(glad_glVertexAttribPointer == trace_glVertexAttribPointer) glad_glVertexAttribPointer = trace_real_glVertexAttribPointer;
+	if(glad_glUniformMatrix2x3fv == trace_glUniformMatrix2x3fv) glad_glUniformMatrix2x3fv = trace_real_glUniformMatrix2x3fv;
+	if(glad_glUniformMatrix3x2fv == trace_glUniformMatrix3x2fv) glad_glUniformMatrix3x2fv = trace_real_glUniformMatrix3x2fv;
+	if(glad_glUniformMatrix2x4fv == trace_glUniformMatrix2x4fv) glad_glUniformMatrix2x4fv = trace_real_glUniformMatrix2x4fv;
+	if(glad_glUniformMatrix4x2fv == trace_glUniformMatrix4x2fv) glad_glUniformMatrix4x2fv = trace_real_glUniformMatrix4x2fv;
+	if(glad_glUniformMatrix3x4fv == trace_glUniformMatrix3x4fv) glad_glUniformMatrix3x4fv = trace_real_glUniformMatrix3x4fv;
+	if(glad_glUniformMatrix4x3fv == trace_glUniformMatrix4x3fv) glad_glUniformMatrix4x3fv = trace_real_glUniformMatrix4x3fv;
+	if(glad_glColorMaski == trace_glColorMaski) glad_glColorMaski = trace_real_glColorMaski;
+	if(glad_glGetBooleani_v == trace_glGetBooleani_v) glad_glGetBooleani_v = trace_real_glGetBooleani_v;
+	if(glad_glGetIntegeri_v == trace_glGetIntegeri_v) glad_glGetIntegeri_v = trace_real_glGetIntegeri_v;
+	if(glad_glEnablei == trace_glEnablei) glad_glEnablei = trace_real_glEnablei;
+	if(glad_glDisablei == trace_glDisablei) glad_glDisablei = trace_real_glDisablei;
+	if(glad_glIsEnabledi == trace_glIsEnabledi) glad_glIsEnabledi = trace_real_glIsEnabledi;
+	if(glad_glBeginTransformFeedback == trace_glBeginTransformFeedback) glad_glBeginTransformFeedback = trace_real_glBeginTransformFeedback;
+	if(glad_glEndTransformFeedback == trace_glEndTransformFeedback) glad_glEndTransformFeedback = trace_real_glEndTransformFeedback;
+	if(glad_glBindBufferRange == trace_glBindBufferRange) glad_glBindBufferRange = trace_real_glBindBufferRange;
+	if(glad_glBindBufferBase == trace_glBindBufferBase) glad_glBindBufferBase = trace_real_glBindBufferBase;
+	if(glad_glTransformFeedbackVaryings == trace_glTransformFeedbackVaryings) glad_glTransformFeedbackVaryings = trace_real_glTransformFeedbackVaryings;
+	if(glad_glGetTransformFeedbackVarying == trace_glGetTransformFeedbackVarying) glad_glGetTransformFeedbackVarying = trace_real_glGetTransformFeedbackVarying;
+	if(glad_glClampColor == trace_glClampColor) glad_glClampColor = trace_real_glClampColor;
+	if(glad_glBeginConditionalRender == trace_glBeginConditionalRender) glad_glBeginConditionalRender = trace_real_glBeginConditionalRender;
+	if(glad_glEndConditionalRender == trace_glEndConditionalRender) glad_glEndConditionalRender = trace_real_glEndConditionalRender;
+	if(glad_glVertexAttribIPointer == trace_glVertexAttribIPointer) glad_glVertexAttribIPointer = trace_real_glVertexAttribIPointer;
+	if(glad_glGetVertexAttribIiv == trace_glGetVertexAttribIiv) glad_glGetVertexAttribIiv = trace_real_glGetVertexAttribIiv;
+	if(glad_glGetVertexAttribIuiv == trace_glGetVertexAttribIuiv) glad_glGetVertexAttribIuiv = trace_real_glGetVertexAttribIuiv;
+	if(glad_glVertexAttribI1i == trace_glVertexAttribI1i) glad_glVertexAttribI1i = trace_real_glVertexAttribI1i;
+	if(glad_glVertexAttribI2i == trace_glVertexAttribI2i) glad_glVertexAttribI2i = trace_real_glVertexAttribI2i;
+	if(glad_glVertexAttribI3i == trace_glVertexAttribI3i) glad_glVertexAttribI3i = trace_real_glVertexAttribI3i;
+	if(glad_glVertexAttribI4i == trace_glVertexAttribI4i) glad_glVertexAttribI4i = trace_real_glVertexAttribI4i;
+	if(glad_glVertexAttribI1ui == trace_glVertexAttribI1ui) glad_glVertexAttribI1ui = trace_real_glVertexAttribI1ui;
+	if(glad_glVertexAttribI2ui == trace_glVertexAttribI2ui) glad_glVertexAttribI2ui = trace_real_glVertexAttribI2ui;
+	if(glad_glVertexAttribI3ui == trace_glVertexAttribI3ui) glad_glVertexAttribI3ui = trace_real_glVertexAttribI3ui;
+	if(glad_glVertexAttribI4ui == trace_glVertexAttribI4ui) glad_glVertexAttribI4ui = trace_real_glVertexAttribI4ui;
+	if(glad_glVertexAttribI1iv == trace_glVertexAttribI1iv) glad_glVertexAttribI1iv = trace_real_glVertexAttribI1iv;
+	if(glad_glVertexAttribI2iv == trace_glVertexAttribI2iv) glad_glVertexAttribI2iv = trace_real_glVertexAttribI2iv;
+	if(glad_glVertexAttribI3iv == trace_glVertexAttribI3iv) glad_glVertexAttribI3iv = trace_real_glVertexAttribI3iv;
+	if(glad_glVertexAttribI4iv == trace_glVertexAttribI4iv) glad_glVertexAttribI4iv = trace_real_glVertexAttribI4iv;
+	if(glad_glVertexAttribI1uiv == trace_glVertexAttribI1uiv) glad_glVertexAttribI1uiv = trace_real_glVertexAttribI1uiv;
+	if(glad_glVertexAttribI2uiv == trace_glVertexAttribI2uiv) glad_glVertexAttribI2uiv = trace_real_glVertexAttribI2uiv;
+	if(glad_glVertexAttribI3uiv == trace_glVertexAttribI3uiv) glad_glVertexAttribI3uiv = trace_real_glVertexAttribI3uiv;
+	if(glad_glVertexAttribI4uiv == trace_glVertexAttribI4uiv) glad_glVertexAttribI4uiv = trace_real_glVertexAttribI4uiv;
+	if(glad_glVertexAttribI4bv == trace_glVertexAttribI4bv) glad_glVertexAttribI4bv = trace_real_glVertexAttribI4bv;
+	if(glad_glVertexAttribI4sv == trace_glVertexAttribI4sv) glad_glVertexAttribI4sv = trace_real_glVertexAttribI4sv;
+	if(glad_glVertexAttribI4ubv == trace_glVertexAttribI4ubv) glad_glVertexAttribI4ubv = trace_real_glVertexAttribI4ubv;
+	if(glad_glVertexAttribI4usv == trace_glVertexAttribI4usv) glad_glVertexAttribI4usv = trace_real_glVertexAttribI4usv;
+	if(glad_glGetUniformuiv == trace_glGetUniformuiv) glad_glGetUniformuiv = trace_real_glGetUniformuiv;
+	if(glad_glBindFragDataLocation == trace_glBindFragDataLocation) glad_glBindFragDataLocation = trace_real_glBindFragDataLocation;
+	if(glad_glGetFragDataLocation == trace_glGetFragDataLocation) glad_glGetFragDataLocation = trace_real_glGetFragDataLocation;
+	if(glad_glUniform1ui == trace_glUniform1ui) glad_glUniform1ui = trace_real_glUniform1ui;
+	if(glad_glUniform2ui == trace_glUniform2ui) glad_glUniform2ui = trace_real_glUniform2ui;
+	if(glad_glUniform3ui == trace_glUniform3ui) glad_glUniform3ui = trace_real_glUniform3ui;
+	if(glad_glUniform4ui == trace_glUniform4ui) glad_glUniform4ui = trace_real_glUniform4ui;
+	if(glad_glUniform1uiv == trace_glUniform1uiv) glad_glUniform1uiv = trace_real_glUniform1uiv;
+	if(glad_glUniform2uiv == trace_glUniform2uiv) glad_glUniform2uiv = trace_real_glUniform2uiv;
+	if(glad_glUniform3uiv == trace_glUniform3uiv) glad_glUniform3uiv = trace_real_glUniform3uiv;
+	if(glad_glUniform4uiv == trace_glUniform4uiv) glad_glUniform4uiv = trace_real_glUniform4uiv;
+	if(glad_glTexParameterIiv == trace_glTexParameterIiv) glad_glTexParameterIiv = trace_real_glTexParameterIiv;
+	if(glad_glTexParameterIuiv == trace_glTexParameterIuiv) glad_glTexParameterIuiv = trace_real_glTexParameterIuiv;
+	if(glad_glGetTexParameterIiv == trace_glGetTexParameterIiv) glad_glGetTexParameterIiv = trace_real_glGetTexParameterIiv;
+	if(glad_glGetTexParameterIuiv == trace_glGetTexParameterIuiv) glad_glGetTexParameterIuiv = trace_real_glGetTexParameterIuiv;
+	if(glad_glClearBufferiv == trace_glClearBufferiv) glad_glClearBufferiv = trace_real_glClearBufferiv;
+	if(glad_glClearBufferuiv == trace_glClearBufferuiv) glad_glClearBufferuiv = trace_real_glClearBufferuiv;
+	if(glad_glClearBufferfv == trace_glClearBufferfv) glad_glClearBufferfv = trace_real_glClearBufferfv;
+	if(glad_glClearBufferfi == trace_glClearBufferfi) glad_glClearBufferfi = trace_real_glClearBufferfi;
+	if(glad_glGetStringi == trace_glGetStringi) glad_glGetStringi = trace_real_glGetStringi;
+	if(glad_glIsRenderbuffer == trace_glIsRenderbuffer) glad_glIsRenderbuffer = trace_real_glIsRenderbuffer;
+	if(glad_glBindRenderbuffer == trace_glBindRenderbuffer) glad_glBindRenderbuffer = trace_real_glBindRenderbuffer;
+	if(glad_glDeleteRenderbuffers == trace_glDeleteRenderbuffers) glad_glDeleteRenderbuffers = trace_real_glDeleteRenderbuffers;
+	if(glad_glGenRenderbuffers == trace_glGenRenderbuffers) glad_glGenRenderbuffers = trace_real_glGenRenderbuffers;
+	if(glad_glRenderbufferStorage == trace_glRenderbufferStorage) glad_glRenderbufferStorage = trace_real_glRenderbufferStorage;
+	if(glad_glGetRenderbufferParameteriv == trace_glGetRenderbufferParameteriv) glad_glGetRenderbufferParameteriv = trace_real_glGetRenderbufferParameteriv;
+	if(glad_glIsFramebuffer == trace_glIsFramebuffer) glad_glIsFramebuffer = trace_real_glIsFramebuffer;
+	if(glad_glBindFramebuffer == trace_glBindFramebuffer) glad_glBindFramebuffer = trace_real_glBindFramebuffer;
+	if(glad_glDeleteFramebuffers == trace_glDeleteFramebuffers) glad_glDeleteFramebuffers = trace_real_glDeleteFramebuffers;
+	if(glad_glGenFramebuffers == trace_glGenFramebuffers) glad_glGenFramebuffers = trace_real_glGenFramebuffers;
+	if(glad_glCheckFramebufferStatus == trace_glCheckFramebufferStatus) glad_glCheckFramebufferStatus = trace_real_glCheckFramebufferStatus;
+	if(glad_glFramebufferTexture1D == trace_glFramebufferTexture1D) glad_glFramebufferTexture1D = trace_real_glFramebufferTexture1D;
+	if(glad_glFramebufferTexture2D == trace_glFramebufferTexture2D) glad_glFramebufferTexture2D = trace_real_glFramebufferTexture2D;
+	if(glad_glFramebufferTexture3D == trace_glFramebufferTexture3D) glad_glFramebufferTexture3D = trace_real_glFramebufferTexture3D;
+	if(glad_glFramebufferRenderbuffer == trace_glFramebufferRenderbuffer) glad_glFramebufferRenderbuffer = trace_real_glFramebufferRenderbuffer;
+	if(glad_glGetFramebufferAttachmentParameteriv == trace_glGetFramebufferAttachmentParameteriv) glad_glGetFramebufferAttachmentParameteriv = trace_real_glGetFramebufferAttachmentParameteriv;
+	if(glad_glGenerateMipmap == trace_glGenerateMipmap) glad_glGenerateMipmap = trace_real_glGenerateMipmap;
+	if(glad_glBlitFramebuffer == trace_glBlitFramebuffer) glad_glBlitFramebuffer = trace_real_glBlitFramebuffer;
+	if(glad_glRenderbufferStorageMultisample == trace_glRenderbufferStorageMultisample) glad_glRenderbufferStorageMultisample = trace_real_glRenderbufferStorageMultisample;
+	if(glad_glFramebufferTextureLayer == trace_glFramebufferTextureLayer) glad_glFramebufferTextureLayer = trace_real_glFramebufferTextureLayer;
+	if(glad_glMapBufferRange == trace_glMapBufferRange) glad_glMapBufferRange = trace_real_glMapBufferRange;
+	if(glad_glFlushMappedBufferRange == trace_glFlushMappedBufferRange) glad_glFlushMappedBufferRange = trace_real_glFlushMappedBufferRange;
+	if(glad_glBindVertexArray == trace_glBindVertexArray) glad_glBindVertexArray = trace_real_glBindVertexArray;
+	if(glad_glDeleteVertexArrays == trace_glDeleteVertexArrays) glad_glDeleteVertexArrays = trace_real_glDeleteVertexArrays;
+	if(glad_glGenVertexArrays == trace_glGenVertexArrays) glad_glGenVertexArrays = trace_real_glGenVertexArrays;
+	if(glad_glIsVertexArray == trace_glIsVertexArray) glad_glIsVertexArray = trace_real_glIsVertexArray;
+	if(glad_glDrawArraysInstanced == trace_glDrawArraysInstanced) glad_glDrawArraysInstanced = trace_real_glDrawArraysInstanced;
+	if(glad_glDrawElementsInstanced == trace_glDrawElementsInstanced) glad_glDrawElementsInstanced = trace_real_glDrawElementsInstanced;
+	if(glad_glTexBuffer == trace_glTexBuffer) glad_glTexBuffer = trace_real_glTexBuffer;
+	if(glad_glPrimitiveRestartIndex == trace_glPrimitiveRestartIndex) glad_glPrimitiveRestartIndex = trace_real_glPrimitiveRestartIndex;
+	if(glad_glCopyBufferSubData == trace_glCopyBufferSubData) glad_glCopyBufferSubData = trace_real_glCopyBufferSubData;
+	if(glad_glGetUniformIndices == trace_glGetUniformIndices) glad_glGetUniformIndices = trace_real_glGetUniformIndices;
+	if(glad_glGetActiveUniformsiv == trace_glGetActiveUniformsiv) glad_glGetActiveUniformsiv = trace_real_glGetActiveUniformsiv;
+	if(glad_glGetActiveUniformName == trace_glGetActiveUniformName) glad_glGetActiveUniformName = trace_real_glGetActiveUniformName;
+	if(glad_glGetUniformBlockIndex == trace_glGetUniformBlockIndex) glad_glGetUniformBlockIndex = trace_real_glGetUniformBlockIndex;
+	if(glad_glGetActiveUniformBlockiv == trace_glGetActiveUniformBlockiv) glad_glGetActiveUniformBlockiv = trace_real_glGetActiveUniformBlockiv;
+	if(glad_glGetActiveUniformBlockName == trace_glGetActiveUniformBlockName) glad_glGetActiveUniformBlockName = trace_real_glGetActiveUniformBlockName;
+	if(glad_glUniformBlockBinding == trace_glUniformBlockBinding) glad_glUniformBlockBinding = trace_real_glUniformBlockBinding;
+	if(glad_glDrawElementsBaseVertex == trace_glDrawElementsBaseVertex) glad_glDrawElementsBaseVertex = trace_real_glDrawElementsBaseVertex;
+	if(glad_glDrawRangeElementsBaseVertex == trace_glDrawRangeElementsBaseVertex) glad_glDrawRangeElementsBaseVertex = trace_real_glDrawRangeElementsBaseVertex;
+	if(glad_glDrawElementsInstancedBaseVertex == trace_glDrawElementsInstancedBaseVertex) glad_glDrawElementsInstancedBaseVertex = trace_real_glDrawElementsInstancedBaseVertex;
+	if(glad_glMultiDrawElementsBaseVertex == trace_glMultiDrawElementsBaseVertex) glad_glMultiDrawElementsBaseVertex = trace_real_glMultiDrawElementsBaseVertex;
+	if(glad_glProvokingVertex == trace_glProvokingVertex) glad_glProvokingVertex = trace_real_glProvokingVertex;
+	if(glad_glFenceSync == trace_glFenceSync) glad_glFenceSync = trace_real_glFenceSync;
+	if(glad_glIsSync == trace_glIsSync) glad_glIsSync = trace_real_glIsSync;
+	if(glad_glDeleteSync == trace_glDeleteSync) glad_glDeleteSync = trace_real_glDeleteSync;
+	if(glad_glClientWaitSync == trace_glClientWaitSync) glad_glClientWaitSync = trace_real_glClientWaitSync;
+	if(glad_glWaitSync == trace_glWaitSync) glad_glWaitSync = trace_real_glWaitSync;
+	if(glad_glGetInteger64v == trace_glGetInteger64v) glad_glGetInteger64v = trace_real_glGetInteger64v;
+	if(glad_glGetSynciv == trace_glGetSynciv) glad_glGetSynciv = trace_real_glGetSynciv;
+	if(glad_glGetInteger64i_v == trace_glGetInteger64i_v) glad_glGetInteger64i_v = trace_real_glGetInteger64i_v;
+	if(glad_glGetBufferParameteri64v == trace_glGetBufferParameteri64v) glad_glGetBufferParameteri64v = trace_real_glGetBufferParameteri64v;
+	if(glad_glFramebufferTexture == trace_glFramebufferTexture) glad_glFramebufferTexture = trace_real_glFramebufferTexture;
+	if(glad_glTexImage2DMultisample == trace_glTexImage2DMultisample) glad_glTexImage2DMultisample = trace_real_glTexImage2DMultisample;
+	if(glad_glTexImage3DMultisample == trace_glTexImage3DMultisample) glad_glTexImage3DMultisample = trace_real_glTexImage3DMultisample;
+	if(glad_glGetMultisamplefv == trace_glGetMultisamplefv) glad_glGetMultisamplefv = trace_real_glGetMultisamplefv;
+	if(glad_glSampleMaski == trace_glSampleMaski) glad_glSampleMaski = trace_real_glSampleMaski;
+	if(glad_glBindFragDataLocationIndexed == trace_glBindFragDataLocationIndexed) glad_glBindFragDataLocationIndexed = trace_real_glBindFragDataLocationIndexed;
+	if(glad_glGetFragDataIndex == trace_glGetFragDataIndex) glad_glGetFragDataIndex = trace_real_glGetFragDataIndex;
+	if(glad_glGenSamplers == trace_glGenSamplers) glad_glGenSamplers = trace_real_glGenSamplers;
+	if(glad_glDeleteSamplers == trace_glDeleteSamplers) glad_glDeleteSamplers = trace_real_glDeleteSamplers;
+	if(glad_glIsSampler == trace_glIsSampler) glad_glIsSampler = trace_real_glIsSampler;
+	if(glad_glBindSampler == trace_glBindSampler) glad_glBindSampler = trace_real_glBindSampler;
+	if(glad_glSamplerParameteri == trace_glSamplerParameteri) glad_glSamplerParameteri = trace_real_glSamplerParameteri;
+	if(glad_glSamplerParameteriv == trace_glSamplerParameteriv) glad_glSamplerParameteriv = trace_real_glSamplerParameteriv;
+	if(glad_glSamplerParameterf == trace_glSamplerParameterf) glad_glSamplerParameterf = trace_real_glSamplerParameterf;
+	if(glad_glSamplerParameterfv == trace_glSamplerParameterfv) glad_glSamplerParameterfv = trace_real_glSamplerParameterfv;
+	if(glad_glSamplerParameterIiv == trace_glSamplerParameterIiv) glad_glSamplerParameterIiv = trace_real_glSamplerParameterIiv;
+	if(glad_glSamplerParameterIuiv == trace_glSamplerParameterIuiv) glad_glSamplerParameterIuiv = trace_real_glSamplerParameterIuiv;
+	if(glad_glGetSamplerParameteriv == trace_glGetSamplerParameteriv) glad_glGetSamplerParameteriv = trace_real_glGetSamplerParameteriv;
+	if(glad_glGetSamplerParameterIiv == trace_glGetSamplerParameterIiv) glad_glGetSamplerParameterIiv = trace_real_glGetSamplerParameterIiv;
+	if(glad_glGetSamplerParameterfv == trace_glGetSamplerParameterfv) glad_glGetSamplerParameterfv = trace_real_glGetSamplerParameterfv;
+	if(glad_glGetSamplerParameterIuiv == trace_glGetSamplerParameterIuiv) glad_glGetSamplerParameterIuiv = trace_real_glGetSamplerParameterIuiv;
+	if(glad_glQueryCounter == trace_glQueryCounter) glad_glQueryCounter = trace_real_glQueryCounter;
+	if(glad_glGetQueryObjecti64v == trace_glGetQueryObjecti64v) glad_glGetQueryObjecti64v = trace_real_glGetQueryObjecti64v;
+	if(glad_glGetQueryObjectui64v == trace_glGetQueryObjectui64v) glad_glGetQueryObjectui64v = trace_real_glGetQueryObjectui64v;
+	if(glad_glVertexAttribDivisor == trace_glVertexAttribDivisor) glad_glVertexAttribDivisor = trace_real_glVertexAttribDivisor;
+	if(glad_glVertexAttribP1ui == trace_glVertexAttribP1ui) glad_glVertexAttribP1ui = trace_real_glVertexAttribP1ui;
+	if(glad_glVertexAttribP1uiv == trace_glVertexAttribP1uiv) glad_glVertexAttribP1uiv = trace_real_glVertexAttribP1uiv;
+	if(glad_glVertexAttribP2ui == trace_glVertexAttribP2ui) glad_glVertexAttribP2ui = trace_real_glVertexAttribP2ui;
+	if(glad_glVertexAttribP2uiv == trace_glVertexAttribP2uiv) glad_glVertexAttribP2uiv = trace_real_glVertexAttribP2uiv;
+	if(glad_glVertexAttribP3ui == trace_glVertexAttribP3ui) glad_glVertexAttribP3ui = trace_real_glVertexAttribP3ui;
+	if(glad_glVertexAttribP3uiv == trace_glVertexAttribP3uiv) glad_glVertexAttribP3uiv = trace_real_glVertexAttribP3uiv;
+	if(glad_glVertexAttribP4ui == trace_glVertexAttribP4ui) glad_glVertexAttribP4ui = trace_real_glVertexAttribP4ui;
+	if(glad_glVertexAttribP4uiv == trace_glVertexAttribP4uiv) glad_glVertexAttribP4uiv = trace_real_glVertexAttribP4uiv;
+	if(glad_glVertexP2ui == trace_glVertexP2ui) glad_glVertexP2ui = trace_real_glVertexP2ui;
+	if(glad_glVertexP2uiv == trace_glVertexP2uiv) glad_glVertexP2uiv = trace_real_glVertexP2uiv;
+	if(glad_glVertexP3ui == trace_glVertexP3ui) glad_glVertexP3ui = trace_real_glVertexP3ui;
+	if(glad_glVertexP3uiv == trace_glVertexP3uiv) glad_glVertexP3uiv = trace_real_glVertexP3uiv;
+	if(glad_glVertexP4ui == trace_glVertexP4ui) glad_glVertexP4ui = trace_real_glVertexP4ui;
+	if(glad_glVertexP4uiv == trace_glVertexP4uiv) glad_glVertexP4uiv = trace_real_glVertexP4uiv;
+	if(glad_glTexCoordP1ui == trace_glTexCoordP1ui) glad_glTexCoordP1ui = trace_real_glTexCoordP1ui;
+	if(glad_glTexCoordP1uiv == trace_glTexCoordP1uiv) glad_glTexCoordP1uiv = trace_real_glTexCoordP1uiv;
+	if(glad_glTexCoordP2ui == trace_glTexCoordP2ui) glad_glTexCoordP2ui = trace_real_glTexCoordP2ui;
+	if(glad_glTexCoordP2uiv == trace_glTexCoordP2uiv) glad_glTexCoordP2uiv = trace_real_glTexCoordP2uiv;
+	if(glad_glTexCoordP3ui == trace_glTexCoordP3ui) glad_glTexCoordP3ui = trace_real_glTexCoordP3ui;
+	if(glad_glTexCoordP3uiv == trace_glTexCoordP3uiv) glad_glTexCoordP3uiv = trace_real_glTexCoordP3uiv;
+	if(glad_glTexCoordP4ui == trace_glTexCoordP4ui) glad_glTexCoordP4ui = trace_real_glTexCoordP4ui;
+	if(glad_glTexCoordP4uiv == trace_glTexCoordP4uiv) glad_glTexCoordP4uiv = trace_real_glTexCoordP4uiv;
+	if(glad_glMultiTexCoordP1ui == trace_glMultiTexCoordP1ui) glad_glMultiTexCoordP1ui = trace_real_glMultiTexCoordP1ui;
+	if(glad_glMultiTexCoordP1uiv == trace_glMultiTexCoordP1uiv) glad_glMultiTexCoordP1uiv = trace_real_glMultiTexCoordP1uiv;
+	if(glad_glMultiTexCoordP2ui == trace_glMultiTexCoordP2ui) glad_glMultiTexCoordP2ui = trace_real_glMultiTexCoordP2ui;
+	if(glad_glMultiTexCoordP2uiv == trace_glMultiTexCoordP2uiv) glad_glMultiTexCoordP2uiv = trace_real_glMultiTexCoordP2uiv;
+	if(glad_glMultiTexCoordP3ui == trace_glMultiTexCoordP3ui) glad_glMultiTexCoordP3ui = trace_real_glMultiTexCoordP3ui;
+	if(glad_glMultiTexCoordP3uiv == trace_glMultiTexCoordP3uiv) glad_glMultiTexCoordP3uiv = trace_real_glMultiTexCoordP3uiv;
+	if(glad_glMultiTexCoordP4ui == trace_glMultiTexCoordP4ui) glad_glMultiTexCoordP4ui = trace_real_glMultiTexCoordP4ui;
+	if(glad_glMultiTexCoordP4uiv == trace_glMultiTexCoordP4uiv) glad_glMultiTexCoordP4uiv = trace_real_glMultiTexCoordP4uiv;
+	if(glad_glNormalP3ui == trace_glNormalP3ui) glad_glNormalP3ui = trace_real_glNormalP3ui;
+	if(glad_glNormalP3uiv == trace_glNormalP3uiv) glad_glNormalP3uiv = trace_real_glNormalP3uiv;
+	if(glad_glColorP3ui == trace_glColorP3ui) glad_glColorP3ui = trace_real_glColorP3ui;
+	if(glad_glColorP3uiv == trace_glColorP3uiv) glad_glColorP3uiv = trace_real_glColorP3uiv;
+	if(glad_glColorP4ui == trace_glColorP4ui) glad_glColorP4ui = trace_real_glColorP4ui;
+	if(glad_glColorP4uiv == trace_glColorP4uiv) glad_glColorP4uiv = trace_real_glColorP4uiv;
+	if(glad_glSecondaryColorP3ui == trace_glSecondaryColorP3ui) glad_glSecondaryColorP3ui = trace_real_glSecondaryColorP3ui;
+	if(glad_glSecondaryColorP3uiv == trace_glSecondaryColorP3uiv) glad_glSecondaryColorP3uiv = trace_real_glSecondaryColorP3uiv;
+	if(glad_glBufferStorage == trace_glBufferStorage) glad_glBufferStorage = trace_real_glBufferStorage;
+	if(glad_glDebugMessageControlARB == trace_glDebugMessageControlARB) glad_glDebugMessageControlARB = trace_real_glDebugMessageControlARB;
+	if(glad_glDebugMessageInsertARB == trace_glDebugMessageInsertARB) glad_glDebugMessageInsertARB = trace_real_glDebugMessageInsertARB;
+	if(glad_glDebugMessageCallbackARB == trace_glDebugMessageCallbackARB) glad_glDebugMessageCallbackARB = trace_real_glDebugMessageCallbackARB;
+	if(glad_glGetDebugMessageLogARB == trace_glGetDebugMessageLogARB) glad_glGetDebugMessageLogARB = trace_real_glGetDebugMessageLogARB;
+	if(glad_glGetProgramBinary == trace_glGetProgramBinary) glad_glGetProgramBinary = trace_real_glGetProgramBinary;
+	if(glad_glProgramBinary == trace_glProgramBinary) glad_glProgramBinary = trace_real_glProgramBinary;
+	if(glad_glProgramParameteri == trace_glProgramParameteri) glad_glProgramParameteri = trace_real_glProgramParameteri;
+	if(glad_glMaxShaderCompilerThreadsARB == trace_glMaxShaderCompilerThreadsARB) glad_glMaxShaderCompilerThreadsARB = trace_real_glMaxShaderCompilerThreadsARB;
+	if(glad_glDebugMessageControl == trace_glDebugMessageControl) glad_glDebugMessageControl = trace_real_glDebugMessageControl;
+	if(glad_glDebugMessageInsert == trace_glDebugMessageInsert) glad_glDebugMessageInsert = trace_real_glDebugMessageInsert;
+	if(glad_glDebugMessageCallback == trace_glDebugMessageCallback) glad_glDebugMessageCallback = trace_real_glDebugMessageCallback;
+	if(glad_glGetDebugMessageLog == trace_glGetDebugMessageLog) glad_glGetDebugMessageLog = trace_real_glGetDebugMessageLog;
+	if(glad_glPushDebugGroup == trace_glPushDebugGroup) glad_glPushDebugGroup = trace_real_glPushDebugGroup;
+	if(glad_glPopDebugGroup == trace_glPopDebugGroup) glad_glPopDebugGroup = trace_real_glPopDebugGroup;
+	if(glad_glObjectLabel == trace_glObjectLabel) glad_glObjectLabel = trace_real_glObjectLabel;
+	if(glad_glGetObjectLabel == trace_glGetObjectLabel) glad_glGetObjectLabel = trace_real_glGetObjectLabel;
+	if(glad_glObjectPtrLabel == trace_glObjectPtrLabel) glad_glObjectPtrLabel = trace_real_glObjectPtrLabel;
+	if(glad_glGetObjectPtrLabel == trace_glGetObjectPtrLabel) glad_glGetObjectPtrLabel = trace_real_glGetObjectPtrLabel;
+	if(glad_glMaxShaderCompilerThreadsKHR == trace_glMaxShaderCompilerThreadsKHR) glad_glMaxShaderCompilerThreadsKHR = trace_real_glMaxShaderCompilerThreadsKHR;
+}
+
+static int trace_replay_call(struct gladTraceReplay *glad_replay, unsigned int id) {
+	switch(id) {
+	case 0: {
+		GLenum mode;
+		trace_get(glad_replay, &mode, sizeof(mode));
+		if(glad_replay->unsupported) return 0;
+		glad_glCullFace(mode);
+	} break;
+	case 1: {
+		GLenum mode;
+		trace_get(glad_replay, &mode, sizeof(mode));
+		if(glad_replay->unsupported) return 0;
+		glad_glFrontFace(mode);
+	} break;
+	case 2: {
+		GLenum target;
+		GLenum mode;
+		trace_get(glad_replay, &target, sizeof(target));
+		trace_get(glad_replay, &mode, sizeof(mode));
+		if(glad_replay->unsupported) return 0;
+		glad_glHint(target, mode);
+	} break;
+	case 3: {
+		GLfloat width;
+		trace_get(glad_replay, &width, sizeof(width));
+		if(glad_replay->unsupported) return 0;
+		glad_glLineWidth(width);
+	} break;
+	case 4: {
+		GLfloat size;
+		trace_get(glad_replay, &size, sizeof(size));
+		if(glad_replay->unsupported) return 0;
+		glad_glPointSize(size);
+	} break;
+	case 5: {
+		GLenum face;
+		GLenum mode;
+		trace_get(glad_replay, &face, sizeof(face));
+		trace_get(glad_replay, &mode, sizeof(mode));
+		if(glad_replay->unsupported) return 0;
+		glad_glPolygonMode(face, mode);
+	} break;
+	case 6: {
+		GLint x;
+		GLint y;
+		GLsizei width;
+		GLsizei height;
+		trace_get(glad_replay, &x, sizeof(x));
+		trace_get(glad_replay, &y, sizeof(y));
+		trace_get(glad_replay, &width, sizeof(width));
+		trace_get(glad_replay, &height, sizeof(height));
+		if(glad_replay->unsupported) return 0;
+		glad_glScissor(x, y, width, height);
+	} break;
+	case 7: {
+		GLenum target;
+		GLenum pname;
+		GLfloat param;
+		trace_get(glad_replay, &target, sizeof(target));
+		trace_get(glad_replay, &pname, sizeof(pname));
+		trace_get(glad_replay, &param, sizeof(param));
+		if(glad_replay->unsupported) return 0;
+		glad_glTexParameterf(target, pname, param);
+	} break;
+	case 8: {
+		GLenum target;
+		GLenum pname;
+		const GLfloat *params;
+		trace_get(glad_replay, &target, sizeof(target));
+		trace_get(glad_replay, &pname, sizeof(pname));
+		params = (const GLfloat *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glTexParameterfv(target, pname, params);
+	} break;
+	case 9: {
+		GLenum target;
+		GLenum pname;
+		GLint param;
+		trace_get(glad_replay, &target, sizeof(target));
+		trace_get(glad_replay, &pname, sizeof(pname));
+		trace_get(glad_replay, &param, sizeof(param));
+		if(glad_replay->unsupported) return 0;
+		glad_glTexParameteri(target, pname, param);
+	} break;
+	case 10: {
+		GLenum target;
+		GLenum pname;
+		const GLint *params;
+		trace_get(glad_replay, &target, sizeof(target));
+		trace_get(glad_replay, &pname, sizeof(pname));
+		params = (const GLint *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glTexParameteriv(target, pname, params);
+	} break;
+	case 11: {
+		GLenum target;
+		GLint level;
+		GLint internalformat;
+		GLsizei width;
+		GLint border;
+		GLenum format;
+		GLenum type;
+		const void *pixels;
+		trace_get(glad_replay, &target, sizeof(target));
+		trace_get(glad_replay, &level, sizeof(level));
+		trace_get(glad_replay, &internalformat, sizeof(internalformat));
+		trace_get(glad_replay, &width, sizeof(width));
+		trace_get(glad_replay, &border, sizeof(border));
+		trace_get(glad_replay, &format, sizeof(format));
+		trace_get(glad_replay, &type, sizeof(type));
+		pixels = (const void *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glTexImage1D(target, level, internalformat, width, border, format, type, pixels);
+	} break;
+	case 12: {
+		GLenum target;
+		GLint level;
+		GLint internalformat;
+		GLsizei width;
+		GLsizei height;
+		GLint border;
+		GLenum format;
+		GLenum type;
+		const void *pixels;
+		trace_get(glad_replay, &target, sizeof(target));
+		trace_get(glad_replay, &level, sizeof(level));
+		trace_get(glad_replay, &internalformat, sizeof(internalformat));
+		trace_get(glad_replay, &width, sizeof(width));
+		trace_get(glad_replay, &height, sizeof(height));
+		trace_get(glad_replay, &border, sizeof(border));
+		trace_get(glad_replay, &format, sizeof(format));
+		trace_get(glad_replay, &type, sizeof(type));
+		pixels = (const void *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glTexImage2D(target, level, internalformat, width, height, border, format, type, pixels);
+	} break;
+	case 13: {
+		GLenum buf;
+		trace_get(glad_replay, &buf, sizeof(buf));
+		if(glad_replay->unsupported) return 0;
+		glad_glDrawBuffer(buf);
+	} break;
+	case 14: {
+		GLbitfield mask;
+		trace_get(glad_replay, &mask, sizeof(mask));
+		if(glad_replay->unsupported) return 0;
+		glad_glClear(mask);
+	} break;
+	case 15: {
+		GLfloat red;
+		GLfloat green;
+		GLfloat blue;
+		GLfloat alpha;
+		trace_get(glad_replay, &red, sizeof(red));
+		trace_get(glad_replay, &green, sizeof(green));
+		trace_get(glad_replay, &blue, sizeof(blue));
+		trace_get(glad_replay, &alpha, sizeof(alpha));
+		if(glad_replay->unsupported) return 0;
+		glad_glClearColor(red, green, blue, alpha);
+	} break;
+	case 16: {
+		GLint s;
+		trace_get(glad_replay, &s, sizeof(s));
+		if(glad_replay->unsupported) return 0;
+		glad_glClearStencil(s);
+	} break;
+	case 17: {
+		GLdouble depth;
+		trace_get(glad_replay, &depth, sizeof(depth));
+		if(glad_replay->unsupported) return 0;
+		glad_glClearDepth(depth);
+	} break;
+	case 18: {
+		GLuint mask;
+		trace_get(glad_replay, &mask, sizeof(mask));
+		if(glad_replay->unsupported) return 0;
+		glad_glStencilMask(mask);
+	} break;
+	case 19: {
+		GLboolean red;
+		GLboolean green;
+		GLboolean blue;
+		GLboolean alpha;
+		trace_get(glad_replay, &red, sizeof(red));
+		trace_get(glad_replay, &green, sizeof(green));
+		trace_get(glad_replay, &blue, sizeof(blue));
+		trace_get(glad_replay, &alpha, sizeof(alpha));
+		if(glad_replay->unsupported) return 0;
+		glad_glColorMask(red, green, blue, alpha);
+	} break;
+	case 20: {
+		GLboolean flag;
+		trace_get(glad_replay, &flag, sizeof(flag));
+		if(glad_replay->unsupported) return 0;
+		glad_glDepthMask(flag);
+	} break;
+	case 21: {
+		GLenum cap;
+		trace_get(glad_replay, &cap, sizeof(cap));
+		if(glad_replay->unsupported) return 0;
+		glad_glDisable(cap);
+	} break;
+	case 22: {
+		GLenum cap;
+		trace_get(glad_replay, &cap, sizeof(cap));
+		if(glad_replay->unsupported) return 0;
+		glad_glEnable(cap);
+	} break;
+	case 23: {
+		if(glad_replay->unsupported) return 0;
+		glad_glFinish();
+	} break;
+	case 24: {
+		if(glad_replay->unsupported) return 0;
+		glad_glFlush();
+	} break;
+	case 25: {
+		GLenum sfactor;
+		GLenum dfactor;
+		trace_get(glad_replay, &sfactor, sizeof(sfactor));
+		trace_get(glad_replay, &dfactor, sizeof(dfactor));
+		if(glad_replay->unsupported) return 0;
+		glad_glBlendFunc(sfactor, dfactor);
+	} break;
+	case 26: {
+		GLenum opcode;
+		trace_get(glad_replay, &opcode, sizeof(opcode));
+		if(glad_replay->unsupported) return 0;
+		glad_glLogicOp(opcode);
+	} break;
+	case 27: {
+		GLenum func;
+		GLint ref;
+		GLuint mask;
+		trace_get(glad_replay, &func, sizeof(func));
+		trace_get(glad_replay, &ref, sizeof(ref));
+		trace_get(glad_replay, &mask, sizeof(mask));
+		if(glad_replay->unsupported) return 0;
+		glad_glStencilFunc(func, ref, mask);
+	} break;
+	case 28: {
+		GLenum fail;
+		GLenum zfail;
+		GLenum zpass;
+		trace_get(glad_replay, &fail, sizeof(fail));
+		trace_get(glad_replay, &zfail, sizeof(zfail));
+		trace_get(glad_replay, &zpass, sizeof(zpass));
+		if(glad_replay->unsupported) return 0;
+		glad_glStencilOp(fail, zfail, zpass);
+	} break;
+	case 29: {
+		GLenum func;
+		trace_get(glad_replay, &func, sizeof(func));
+		if(glad_replay->unsupported) return 0;
+		glad_glDepthFunc(func);
+	} break;
+	case 30: {
+		GLenum pname;
+		GLfloat param;
+		trace_get(glad_replay, &pname, sizeof(pname));
+		trace_get(glad_replay, &param, sizeof(param));
+		if(glad_replay->unsupported) return 0;
+		glad_glPixelStoref(pname, param);
+	} break;
+	case 31: {
+		GLenum pname;
+		GLint param;
+		trace_get(glad_replay, &pname, sizeof(pname));
+		trace_get(glad_replay, &param, sizeof(param));
+		if(glad_replay->unsupported) return 0;
+		glad_glPixelStorei(pname, param);
+	} break;
+	case 32: {
+		GLenum src;
+		trace_get(glad_replay, &src, sizeof(src));
+		if(glad_replay->unsupported) return 0;
+		glad_glReadBuffer(src);
+	} break;
+	case 33: {
+		GLint x;
+		GLint y;
+		GLsizei width;
+		GLsizei height;
+		GLenum format;
+		GLenum type;
+		void *pixels;
+		trace_get(glad_replay, &x, sizeof(x));
+		trace_get(glad_replay, &y, sizeof(y));
+		trace_get(glad_replay, &width, sizeof(width));
+		trace_get(glad_replay, &height, sizeof(height));
+		trace_get(glad_replay, &format, sizeof(format));
+		trace_get(glad_replay, &type, sizeof(type));
+		pixels = (void *)trace_scratch(glad_replay, 0, (size_t)width * (size_t)height * 16 + 64);
+		if(glad_replay->unsupported) return 0;
+		glad_glReadPixels(x, y, width, height, format, type, pixels);
+	} break;
+	case 34: {
+		GLenum pname;
+		GLboolean *data;
+		trace_get(glad_replay, &pname, sizeof(pname));
+		data = (GLboolean *)trace_scratch(glad_replay, 0, TRACE_SCRATCH_DEFAULT);
+		if(glad_replay->unsupported) return 0;
+		glad_glGetBooleanv(pname, data);
+	} break;
+	case 35: {
+		GLenum pname;
+		GLdouble *data;
+		trace_get(glad_replay, &pname, sizeof(pname));
+		data = (GLdouble *)trace_scratch(glad_replay, 0, TRACE_SCRATCH_DEFAULT);
+		if(glad_replay->unsupported) return 0;
+		glad_glGetDoublev(pname, data);
+	} break;
+	case 36: {
+		GLenum glad_result;
+		GLenum recorded_result;
+		trace_get(glad_replay, &recorded_result, sizeof(recorded_result));
+		if(glad_replay->unsupported) return 0;
+		glad_result = glad_glGetError();
+		(void)glad_result;
+		(void)recorded_result;
+	} break;
+	case 37: {
+		GLenum pname;
+		GLfloat *data;
+		trace_get(glad_replay, &pname, sizeof(pname));
+		data = (GLfloat *)trace_scratch(glad_replay, 0, TRACE_SCRATCH_DEFAULT);
+		if(glad_replay->unsupported) return 0;
+		glad_glGetFloatv(pname, data);
+	} break;
+	case 38: {
+		GLenum pname;
+		GLint *data;
+		trace_get(glad_replay, &pname, sizeof(pname));
+		data = (GLint *)trace_scratch(glad_replay, 0, TRACE_SCRATCH_DEFAULT);
+		if(glad_replay->unsupported) return 0;
+		glad_glGetIntegerv(pname, data);
+	} break;
+	case 39: {
+		GLenum name;
+		const GLubyte * glad_result;
+		trace_get(glad_replay, &name, sizeof(name));
+		if(glad_replay->unsupported) return 0;
+		glad_result = glad_glGetString(name);
+		(void)glad_result;
+	} break;
+	case 40: {
+		GLenum target;
+		GLint level;
+		GLenum format;
+		GLenum type;
+		void *pixels;
+		trace_get(glad_replay, &target, sizeof(target));
+		trace_get(glad_replay, &level, sizeof(level));
+		trace_get(glad_replay, &format, sizeof(format));
+		trace_get(glad_replay, &type, sizeof(type));
+		pixels = NULL;
+		glad_replay->unsupported = 1;
+		if(glad_replay->unsupported) return 0;
+		glad_glGetTexImage(target, level, format, type, pixels);
+	} break;
+	case 41: {
+		GLenum target;
+		GLenum pname;
+		GLfloat *params;
+		trace_get(glad_replay, &target, sizeof(target));
+		trace_get(glad_replay, &pname, sizeof(pname));
+		params = (GLfloat *)trace_scratch(glad_replay, 0, TRACE_SCRATCH_DEFAULT);
+		if(glad_replay->unsupported) return 0;
+		glad_glGetTexParameterfv(target, pname, params);
+	} break;
+	case 42: {
+		GLenum target;
+		GLenum pname;
+		GLint *params;
+		trace_get(glad_replay, &target, sizeof(target));
+		trace_get(glad_replay, &pname, sizeof(pname));
+		params = (GLint *)trace_scratch(glad_replay, 0, TRACE_SCRATCH_DEFAULT);
+		if(glad_replay->unsupported) return 0;
+		glad_glGetTexParameteriv(target, pname, params);
+	} break;
+	case 43: {
+		GLenum target;
+		GLint level;
+		GLenum pname;
+		GLfloat *params;
+		trace_get(glad_replay, &target, sizeof(target));
+		trace_get(glad_replay, &level, sizeof(level));
+		trace_get(glad_replay, &pname, sizeof(pname));
+		params = (GLfloat *)trace_scratch(glad_replay, 0, TRACE_SCRATCH_DEFAULT);
+		if(glad_replay->unsupported) return 0;
+		glad_glGetTexLevelParameterfv(target, level, pname, params);
+	} break;
+	case 44: {
+		GLenum target;
+		GLint level;
+		GLenum pname;
+		GLint *params;
+		trace_get(glad_replay, &target, sizeof(target));
+		trace_get(glad_replay, &level, sizeof(level));
+		trace_get(glad_replay, &pname, sizeof(pname));
+		params = (GLint *)trace_scratch(glad_replay, 0, TRACE_SCRATCH_DEFAULT);
+		if(glad_replay->unsupported) return 0;
+		glad_glGetTexLevelParameteriv(target, level, pname, params);
+	} break;
+	case 45: {
+		GLenum cap;
+		GLboolean glad_result;
+		GLboolean recorded_result;
+		trace_get(glad_replay, &cap, sizeof(cap));
+		trace_get(glad_replay, &recorded_result, sizeof(recorded_result));
+		if(glad_replay->unsupported) return 0;
+		glad_result = glad_glIsEnabled(cap);
+		(void)glad_result;
+		(void)recorded_result;
+	} break;
+	case 46: {
+		GLdouble n;
+		GLdouble f;
+		trace_get(glad_replay, &n, sizeof(n));
+		trace_get(glad_replay, &f, sizeof(f));
+		if(glad_replay->unsupported) return 0;
+		glad_glDepthRange(n, f);
+	} break;
+	case 47: {
+		GLint x;
+		GLint y;
+		GLsizei width;
+		GLsizei height;
+		trace_get(glad_replay, &x, sizeof(x));
+		trace_get(glad_replay, &y, sizeof(y));
+		trace_get(glad_replay, &width, sizeof(width));
+		trace_get(glad_replay, &height, sizeof(height));
+		if(glad_replay->unsupported) return 0;
+		glad_glViewport(x, y, width, height);
+	} break;
+	case 48: {
+		GLuint list;
+		GLenum mode;
+		trace_get(glad_replay, &list, sizeof(list));
+		trace_get(glad_replay, &mode, sizeof(mode));
+		if(glad_replay->unsupported) return 0;
+		glad_glNewList(list, mode);
+	} break;
+	case 49: {
+		if(glad_replay->unsupported) return 0;
+		glad_glEndList();
+	} break;
+	case 50: {
+		GLuint list;
+		trace_get(glad_replay, &list, sizeof(list));
+		if(glad_replay->unsupported) return 0;
+		glad_glCallList(list);
+	} break;
+	case 51: {
+		GLsizei n;
+		GLenum type;
+		const void *lists;
+		trace_get(glad_replay, &n, sizeof(n));
+		trace_get(glad_replay, &type, sizeof(type));
+		trace_get_unsupported(glad_replay);
+		lists = NULL;
+		if(glad_replay->unsupported) return 0;
+		glad_glCallLists(n, type, lists);
+	} break;
+	case 52: {
+		GLuint list;
+		GLsizei range;
+		trace_get(glad_replay, &list, sizeof(list));
+		trace_get(glad_replay, &range, sizeof(range));
+		if(glad_replay->unsupported) return 0;
+		glad_glDeleteLists(list, range);
+	} break;
+	case 53: {
+		GLsizei range;
+		GLuint glad_result;
+		GLuint recorded_result;
+		trace_get(glad_replay, &range, sizeof(range));
+		trace_get(glad_replay, &recorded_result, sizeof(recorded_result));
+		if(glad_replay->unsupported) return 0;
+		glad_result = glad_glGenLists(range);
+		(void)glad_result;
+		(void)recorded_result;
+	} break;
+	case 54: {
+		GLuint base;
+		trace_get(glad_replay, &base, sizeof(base));
+		if(glad_replay->unsupported) return 0;
+		glad_glListBase(base);
+	} break;
+	case 55: {
+		GLenum mode;
+		trace_get(glad_replay, &mode, sizeof(mode));
+		if(glad_replay->unsupported) return 0;
+		glad_glBegin(mode);
+	} break;
+	case 56: {
+		GLsizei width;
+		GLsizei height;
+		GLfloat xorig;
+		GLfloat yorig;
+		GLfloat xmove;
+		GLfloat ymove;
+		const GLubyte *bitmap;
+		trace_get(glad_replay, &width, sizeof(width));
+		trace_get(glad_replay, &height, sizeof(height));
+		trace_get(glad_replay, &xorig, sizeof(xorig));
+		trace_get(glad_replay, &yorig, sizeof(yorig));
+		trace_get(glad_replay, &xmove, sizeof(xmove));
+		trace_get(glad_replay, &ymove, sizeof(ymove));
+		trace_get_unsupported(glad_replay);
+		bitmap = NULL;
+		if(glad_replay->unsupported) return 0;
+		glad_glBitmap(width, height, xorig, yorig, xmove, ymove, bitmap);
+	} break;
+	case 57: {
+		GLbyte red;
+		GLbyte green;
+		GLbyte blue;
+		trace_get(glad_replay, &red, sizeof(red));
+		trace_get(glad_replay, &green, sizeof(green));
+		trace_get(glad_replay, &blue, sizeof(blue));
+		if(glad_replay->unsupported) return 0;
+		glad_glColor3b(red, green, blue);
+	} break;
+	case 58: {
+		const GLbyte *v;
+		v = (const GLbyte *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glColor3bv(v);
+	} break;
+	case 59: {
+		GLdouble red;
+		GLdouble green;
+		GLdouble blue;
+		trace_get(glad_replay, &red, sizeof(red));
+		trace_get(glad_replay, &green, sizeof(green));
+		trace_get(glad_replay, &blue, sizeof(blue));
+		if(glad_replay->unsupported) return 0;
+		glad_glColor3d(red, green, blue);
+	} break;
+	case 60: {
+		const GLdouble *v;
+		v = (const GLdouble *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glColor3dv(v);
+	} break;
+	case 61: {
+		GLfloat red;
+		GLfloat green;
+		GLfloat blue;
+		trace_get(glad_replay, &red, sizeof(red));
+		trace_get(glad_replay, &green, sizeof(green));
+		trace_get(glad_replay, &blue, sizeof(blue));
+		if(glad_replay->unsupported) return 0;
+		glad_glColor3f(red, green, blue);
+	} break;
+	case 62: {
+		const GLfloat *v;
+		v = (const GLfloat *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glColor3fv(v);
+	} break;
+	case 63: {
+		GLint red;
+		GLint green;
+		GLint blue;
+		trace_get(glad_replay, &red, sizeof(red));
+		trace_get(glad_replay, &green, sizeof(green));
+		trace_get(glad_replay, &blue, sizeof(blue));
+		if(glad_replay->unsupported) return 0;
+		glad_glColor3i(red, green, blue);
+	} break;
+	case 64: {
+		const GLint *v;
+		v = (const GLint *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glColor3iv(v);
+	} break;
+	case 65: {
+		GLshort red;
+		GLshort green;
+		GLshort blue;
+		trace_get(glad_replay, &red, sizeof(red));
+		trace_get(glad_replay, &green, sizeof(green));
+		trace_get(glad_replay, &blue, sizeof(blue));
+		if(glad_replay->unsupported) return 0;
+		glad_glColor3s(red, green, blue);
+	} break;
+	case 66: {
+		const GLshort *v;
+		v = (const GLshort *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glColor3sv(v);
+	} break;
+	case 67: {
+		GLubyte red;
+		GLubyte green;
+		GLubyte blue;
+		trace_get(glad_replay, &red, sizeof(red));
+		trace_get(glad_replay, &green, sizeof(green));
+		trace_get(glad_replay, &blue, sizeof(blue));
+		if(glad_replay->unsupported) return 0;
+		glad_glColor3ub(red, green, blue);
+	} break;
+	case 68: {
+		const GLubyte *v;
+		v = (const GLubyte *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glColor3ubv(v);
+	} break;
+	case 69: {
+		GLuint red;
+		GLuint green;
+		GLuint blue;
+		trace_get(glad_replay, &red, sizeof(red));
+		trace_get(glad_replay, &green, sizeof(green));
+		trace_get(glad_replay, &blue, sizeof(blue));
+		if(glad_replay->unsupported) return 0;
+		glad_glColor3ui(red, green, blue);
+	} break;
+	case 70: {
+		const GLuint *v;
+		v = (const GLuint *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glColor3uiv(v);
+	} break;
+	case 71: {
+		GLushort red;
+		GLushort green;
+		GLushort blue;
+		trace_get(glad_replay, &red, sizeof(red));
+		trace_get(glad_replay, &green, sizeof(green));
+		trace_get(glad_replay, &blue, sizeof(blue));
+		if(glad_replay->unsupported) return 0;
+		glad_glColor3us(red, green, blue);
+	} break;
+	case 72: {
+		const GLushort *v;
+		v = (const GLushort *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glColor3usv(v);
+	} break;
+	case 73: {
+		GLbyte red;
+		GLbyte green;
+		GLbyte blue;
+		GLbyte alpha;
+		trace_get(glad_replay, &red, sizeof(red));
+		trace_get(glad_replay, &green, sizeof(green));
+		trace_get(glad_replay, &blue, sizeof(blue));
+		trace_get(glad_replay, &alpha, sizeof(alpha));
+		if(glad_replay->unsupported) return 0;
+		glad_glColor4b(red, green, blue, alpha);
+	} break;
+	case 74: {
+		const GLbyte *v;
+		v = (const GLbyte *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glColor4bv(v);
+	} break;
+	case 75: {
+		GLdouble red;
+		GLdouble green;
+		GLdouble blue;
+		GLdouble alpha;
+		trace_get(glad_replay, &red, sizeof(red));
+		trace_get(glad_replay, &green, sizeof(green));
+		trace_get(glad_replay, &blue, sizeof(blue));
+		trace_get(glad_replay, &alpha, sizeof(alpha));
+		if(glad_replay->unsupported) return 0;
+		glad_glColor4d(red, green, blue, alpha);
+	} break;
+	case 76: {
+		const GLdouble *v;
+		v = (const GLdouble *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glColor4dv(v);
+	} break;
+	case 77: {
+		GLfloat red;
+		GLfloat green;
+		GLfloat blue;
+		GLfloat alpha;
+		trace_get(glad_replay, &red, sizeof(red));
+		trace_get(glad_replay, &green, sizeof(green));
+		trace_get(glad_replay, &blue, sizeof(blue));
+		trace_get(glad_replay, &alpha, sizeof(alpha));
+		if(glad_replay->unsupported) return 0;
+		glad_glColor4f(red, green, blue, alpha);
+	} break;
+	case 78: {
+		const GLfloat *v;
+		v = (const GLfloat *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glColor4fv(v);
+	} break;
+	case 79: {
+		GLint red;
+		GLint green;
+		GLint blue;
+		GLint alpha;
+		trace_get(glad_replay, &red, sizeof(red));
+		trace_get(glad_replay, &green, sizeof(green));
+		trace_get(glad_replay, &blue, sizeof(blue));
+		trace_get(glad_replay, &alpha, sizeof(alpha));
+		if(glad_replay->unsupported) return 0;
+		glad_glColor4i(red, green, blue, alpha);
+	} break;
+	case 80: {
+		const GLint *v;
+		v = (const GLint *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glColor4iv(v);
+	} break;
+	case 81: {
+		GLshort red;
+		GLshort green;
+		GLshort blue;
+		GLshort alpha;
+		trace_get(glad_replay, &red, sizeof(red));
+		trace_get(glad_replay, &green, sizeof(green));
+		trace_get(glad_replay, &blue, sizeof(blue));
+		trace_get(glad_replay, &alpha, sizeof(alpha));
+		if(glad_replay->unsupported) return 0;
+		glad_glColor4s(red, green, blue, alpha);
+	} break;
+	case 82: {
+		const GLshort *v;
+		v = (const GLshort *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glColor4sv(v);
+	} break;
+	case 83: {
+		GLubyte red;
+		GLubyte green;
+		GLubyte blue;
+		GLubyte alpha;
+		trace_get(glad_replay, &red, sizeof(red));
+		trace_get(glad_replay, &green, sizeof(green));
+		trace_get(glad_replay, &blue, sizeof(blue));
+		trace_get(glad_replay, &alpha, sizeof(alpha));
+		if(glad_replay->unsupported) return 0;
+		glad_glColor4ub(red, green, blue, alpha);
+	} break;
+	case 84: {
+		const GLubyte *v;
+		v = (const GLubyte *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glColor4ubv(v);
+	} break;
+	case 85: {
+		GLuint red;
+		GLuint green;
+		GLuint blue;
+		GLuint alpha;
+		trace_get(glad_replay, &red, sizeof(red));
+		trace_get(glad_replay, &green, sizeof(green));
+		trace_get(glad_replay, &blue, sizeof(blue));
+		trace_get(glad_replay, &alpha, sizeof(alpha));
+		if(glad_replay->unsupported) return 0;
+		glad_glColor4ui(red, green, blue, alpha);
+	} break;
+	case 86: {
+		const GLuint *v;
+		v = (const GLuint *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glColor4uiv(v);
+	} break;
+	case 87: {
+		GLushort red;
+		GLushort green;
+		GLushort blue;
+		GLushort alpha;
+		trace_get(glad_replay, &red, sizeof(red));
+		trace_get(glad_replay, &green, sizeof(green));
+		trace_get(glad_replay, &blue, sizeof(blue));
+		trace_get(glad_replay, &alpha, sizeof(alpha));
+		if(glad_replay->unsupported) return 0;
+		glad_glColor4us(red, green, blue, alpha);
+	} break;
+	case 88: {
+		const GLushort *v;
+		v = (const GLushort *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glColor4usv(v);
+	} break;
+	case 89: {
+		GLboolean flag;
+		trace_get(glad_replay, &flag, sizeof(flag));
+		if(glad_replay->unsupported) return 0;
+		glad_glEdgeFlag(flag);
+	} break;
+	case 90: {
+		const GLboolean *flag;
+		trace_get_unsupported(glad_replay);
+		flag = NULL;
+		if(glad_replay->unsupported) return 0;
+		glad_glEdgeFlagv(flag);
+	} break;
+	case 91: {
+		if(glad_replay->unsupported) return 0;
+		glad_glEnd();
+	} break;
+	case 92: {
+		GLdouble c;
+		trace_get(glad_replay, &c, sizeof(c));
+		if(glad_replay->unsupported) return 0;
+		glad_glIndexd(c);
+	} break;
+	case 93: {
+		const GLdouble *c;
+		trace_get_unsupported(glad_replay);
+		c = NULL;
+		if(glad_replay->unsupported) return 0;
+		glad_glIndexdv(c);
+	} break;
+	case 94: {
+		GLfloat c;
+		trace_get(glad_replay, &c, sizeof(c));
+		if(glad_replay->unsupported) return 0;
+		glad_glIndexf(c);
+	} break;
+	case 95: {
+		const GLfloat *c;
+		trace_get_unsupported(glad_replay);
+		c = NULL;
+		if(glad_replay->unsupported) return 0;
+		glad_glIndexfv(c);
+	} break;
+	case 96: {
+		GLint c;
+		trace_get(glad_replay, &c, sizeof(c));
+		if(glad_replay->unsupported) return 0;
+		glad_glIndexi(c);
+	} break;
+	case 97: {
+		const GLint *c;
+		trace_get_unsupported(glad_replay);
+		c = NULL;
+		if(glad_replay->unsupported) return 0;
+		glad_glIndexiv(c);
+	} break;
+	case 98: {
+		GLshort c;
+		trace_get(glad_replay, &c, sizeof(c));
+		if(glad_replay->unsupported) return 0;
+		glad_glIndexs(c);
+	} break;
+	case 99: {
+		const GLshort *c;
+		trace_get_unsupported(glad_replay);
+		c = NULL;
+		if(glad_replay->unsupported) return 0;
+		glad_glIndexsv(c);
+	} break;
+	case 100: {
+		GLbyte nx;
+		GLbyte ny;
+		GLbyte nz;
+		trace_get(glad_replay, &nx, sizeof(nx));
+		trace_get(glad_replay, &ny, sizeof(ny));
+		trace_get(glad_replay, &nz, sizeof(nz));
+		if(glad_replay->unsupported) return 0;
+		glad_glNormal3b(nx, ny, nz);
+	} break;
+	case 101: {
+		const GLbyte *v;
+		v = (const GLbyte *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glNormal3bv(v);
+	} break;
+	case 102: {
+		GLdouble nx;
+		GLdouble ny;
+		GLdouble nz;
+		trace_get(glad_replay, &nx, sizeof(nx));
+		trace_get(glad_replay, &ny, sizeof(ny));
+		trace_get(glad_replay, &nz, sizeof(nz));
+		if(glad_replay->unsupported) return 0;
+		glad_glNormal3d(nx, ny, nz);
+	} break;
+	case 103: {
+		const GLdouble *v;
+		v = (const GLdouble *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glNormal3dv(v);
+	} break;
+	case 104: {
+		GLfloat nx;
+		GLfloat ny;
+		GLfloat nz;
+		trace_get(glad_replay, &nx, sizeof(nx));
+		trace_get(glad_replay, &ny, sizeof(ny));
+		trace_get(glad_replay, &nz, sizeof(nz));
+		if(glad_replay->unsupported) return 0;
+		glad_glNormal3f(nx, ny, nz);
+	} break;
+	case 105: {
+		const GLfloat *v;
+		v = (const GLfloat *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glNormal3fv(v);
+	} break;
+	case 106: {
+		GLint nx;
+		GLint ny;
+		GLint nz;
+		trace_get(glad_replay, &nx, sizeof(nx));
+		trace_get(glad_replay, &ny, sizeof(ny));
+		trace_get(glad_replay, &nz, sizeof(nz));
+		if(glad_replay->unsupported) return 0;
+		glad_glNormal3i(nx, ny, nz);
+	} break;
+	case 107: {
+		const GLint *v;
+		v = (const GLint *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glNormal3iv(v);
+	} break;
+	case 108: {
+		GLshort nx;
+		GLshort ny;
+		GLshort nz;
+		trace_get(glad_replay, &nx, sizeof(nx));
+		trace_get(glad_replay, &ny, sizeof(ny));
+		trace_get(glad_replay, &nz, sizeof(nz));
+		if(glad_replay->unsupported) return 0;
+		glad_glNormal3s(nx, ny, nz);
+	} break;
+	case 109: {
+		const GLshort *v;
+		v = (const GLshort *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glNormal3sv(v);
+	} break;
+	case 110: {
+		GLdouble x;
+		GLdouble y;
+		trace_get(glad_replay, &x, sizeof(x));
+		trace_get(glad_replay, &y, sizeof(y));
+		if(glad_replay->unsupported) return 0;
+		glad_glRasterPos2d(x, y);
+	} break;
+	case 111: {
+		const GLdouble *v;
+		v = (const GLdouble *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glRasterPos2dv(v);
+	} break;
+	case 112: {
+		GLfloat x;
+		GLfloat y;
+		trace_get(glad_replay, &x, sizeof(x));
+		trace_get(glad_replay, &y, sizeof(y));
+		if(glad_replay->unsupported) return 0;
+		glad_glRasterPos2f(x, y);
+	} break;
+	case 113: {
+		const GLfloat *v;
+		v = (const GLfloat *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glRasterPos2fv(v);
+	} break;
+	case 114: {
+		GLint x;
+		GLint y;
+		trace_get(glad_replay, &x, sizeof(x));
+		trace_get(glad_replay, &y, sizeof(y));
+		if(glad_replay->unsupported) return 0;
+		glad_glRasterPos2i(x, y);
+	} break;
+	case 115: {
+		const GLint *v;
+		v = (const GLint *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glRasterPos2iv(v);
+	} break;
+	case 116: {
+		GLshort x;
+		GLshort y;
+		trace_get(glad_replay, &x, sizeof(x));
+		trace_get(glad_replay, &y, sizeof(y));
+		if(glad_replay->unsupported) return 0;
+		glad_glRasterPos2s(x, y);
+	} break;
+	case 117: {
+		const GLshort *v;
+		v = (const GLshort *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glRasterPos2sv(v);
+	} break;
+	case 118: {
+		GLdouble x;
+		GLdouble y;
+		GLdouble z;
+		trace_get(glad_replay, &x, sizeof(x));
+		trace_get(glad_replay, &y, sizeof(y));
+		trace_get(glad_replay, &z, sizeof(z));
+		if(glad_replay->unsupported) return 0;
+		glad_glRasterPos3d(x, y, z);
+	} break;
+	case 119: {
+		const GLdouble *v;
+		v = (const GLdouble *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glRasterPos3dv(v);
+	} break;
+	case 120: {
+		GLfloat x;
+		GLfloat y;
+		GLfloat z;
+		trace_get(glad_replay, &x, sizeof(x));
+		trace_get(glad_replay, &y, sizeof(y));
+		trace_get(glad_replay, &z, sizeof(z));
+		if(glad_replay->unsupported) return 0;
+		glad_glRasterPos3f(x, y, z);
+	} break;
+	case 121: {
+		const GLfloat *v;
+		v = (const GLfloat *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glRasterPos3fv(v);
+	} break;
+	case 122: {
+		GLint x;
+		GLint y;
+		GLint z;
+		trace_get(glad_replay, &x, sizeof(x));
+		trace_get(glad_replay, &y, sizeof(y));
+		trace_get(glad_replay, &z, sizeof(z));
+		if(glad_replay->unsupported) return 0;
+		glad_glRasterPos3i(x, y, z);
+	} break;
+	case 123: {
+		const GLint *v;
+		v = (const GLint *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glRasterPos3iv(v);
+	} break;
+	case 124: {
+		GLshort x;
+		GLshort y;
+		GLshort z;
+		trace_get(glad_replay, &x, sizeof(x));
+		trace_get(glad_replay, &y, sizeof(y));
+		trace_get(glad_replay, &z, sizeof(z));
+		if(glad_replay->unsupported) return 0;
+		glad_glRasterPos3s(x, y, z);
+	} break;
+	case 125: {
+		const GLshort *v;
+		v = (const GLshort *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glRasterPos3sv(v);
+	} break;
+	case 126: {
+		GLdouble x;
+		GLdouble y;
+		GLdouble z;
+		GLdouble w;
+		trace_get(glad_replay, &x, sizeof(x));
+		trace_get(glad_replay, &y, sizeof(y));
+		trace_get(glad_replay, &z, sizeof(z));
+		trace_get(glad_replay, &w, sizeof(w));
+		if(glad_replay->unsupported) return 0;
+		glad_glRasterPos4d(x, y, z, w);
+	} break;
+	case 127: {
+		const GLdouble *v;
+		v = (const GLdouble *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glRasterPos4dv(v);
+	} break;
+	case 128: {
+		GLfloat x;
+		GLfloat y;
+		GLfloat z;
+		GLfloat w;
+		trace_get(glad_replay, &x, sizeof(x));
+		trace_get(glad_replay, &y, sizeof(y));
+		trace_get(glad_replay, &z, sizeof(z));
+		trace_get(glad_replay, &w, sizeof(w));
+		if(glad_replay->unsupported) return 0;
+		glad_glRasterPos4f(x, y, z, w);
+	} break;
+	case 129: {
+		const GLfloat *v;
+		v = (const GLfloat *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glRasterPos4fv(v);
+	} break;
+	case 130: {
+		GLint x;
+		GLint y;
+		GLint z;
+		GLint w;
+		trace_get(glad_replay, &x, sizeof(x));
+		trace_get(glad_replay, &y, sizeof(y));
+		trace_get(glad_replay, &z, sizeof(z));
+		trace_get(glad_replay, &w, sizeof(w));
+		if(glad_replay->unsupported) return 0;
+		glad_glRasterPos4i(x, y, z, w);
+	} break;
+	case 131: {
+		const GLint *v;
+		v = (const GLint *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glRasterPos4iv(v);
+	} break;
+	case 132: {
+		GLshort x;
+		GLshort y;
+		GLshort z;
+		GLshort w;
+		trace_get(glad_replay, &x, sizeof(x));
+		trace_get(glad_replay, &y, sizeof(y));
+		trace_get(glad_replay, &z, sizeof(z));
+		trace_get(glad_replay, &w, sizeof(w));
+		if(glad_replay->unsupported) return 0;
+		glad_glRasterPos4s(x, y, z, w);
+	} break;
+	case 133: {
+		const GLshort *v;
+		v = (const GLshort *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glRasterPos4sv(v);
+	} break;
+	case 134: {
+		GLdouble x1;
+		GLdouble y1;
+		GLdouble x2;
+		GLdouble y2;
+		trace_get(glad_replay, &x1, sizeof(x1));
+		trace_get(glad_replay, &y1, sizeof(y1));
+		trace_get(glad_replay, &x2, sizeof(x2));
+		trace_get(glad_replay, &y2, sizeof(y2));
+		if(glad_replay->unsupported) return 0;
+		glad_glRectd(x1, y1, x2, y2);
+	} break;
+	case 135: {
+		const GLdouble *v1;
+		const GLdouble *v2;
+		trace_get_unsupported(glad_replay);
+		v1 = NULL;
+		trace_get_unsupported(glad_replay);
+		v2 = NULL;
+		if(glad_replay->unsupported) return 0;
+		glad_glRectdv(v1, v2);
+	} break;
+	case 136: {
+		GLfloat x1;
+		GLfloat y1;
+		GLfloat x2;
+		GLfloat y2;
+		trace_get(glad_replay, &x1, sizeof(x1));
+		trace_get(glad_replay, &y1, sizeof(y1));
+		trace_get(glad_replay, &x2, sizeof(x2));
+		trace_get(glad_replay, &y2, sizeof(y2));
+		if(glad_replay->unsupported) return 0;
+		glad_glRectf(x1, y1, x2, y2);
+	} break;
+	case 137: {
+		const GLfloat *v1;
+		const GLfloat *v2;
+		trace_get_unsupported(glad_replay);
+		v1 = NULL;
+		trace_get_unsupported(glad_replay);
+		v2 = NULL;
+		if(glad_replay->unsupported) return 0;
+		glad_glRectfv(v1, v2);
+	} break;
+	case 138: {
+		GLint x1;
+		GLint y1;
+		GLint x2;
+		GLint y2;
+		trace_get(glad_replay, &x1, sizeof(x1));
+		trace_get(glad_replay, &y1, sizeof(y1));
+		trace_get(glad_replay, &x2, sizeof(x2));
+		trace_get(glad_replay, &y2, sizeof(y2));
+		if(glad_replay->unsupported) return 0;
+		glad_glRecti(x1, y1, x2, y2);
+	} break;
+	case 139: {
+		const GLint *v1;
+		const GLint *v2;
+		trace_get_unsupported(glad_replay);
+		v1 = NULL;
+		trace_get_unsupported(glad_replay);
+		v2 = NULL;
+		if(glad_replay->unsupported) return 0;
+		glad_glRectiv(v1, v2);
+	} break;
+	case 140: {
+		GLshort x1;
+		GLshort y1;
+		GLshort x2;
+		GLshort y2;
+		trace_get(glad_replay, &x1, sizeof(x1));
+		trace_get(glad_replay, &y1, sizeof(y1));
+		trace_get(glad_replay, &x2, sizeof(x2));
+		trace_get(glad_replay, &y2, sizeof(y2));
+		if(glad_replay->unsupported) return 0;
+		glad_glRects(x1, y1, x2, y2);
+	} break;
+	case 141: {
+		const GLshort *v1;
+		const GLshort *v2;
+		trace_get_unsupported(glad_replay);
+		v1 = NULL;
+		trace_get_unsupported(glad_replay);
+		v2 = NULL;
+		if(glad_replay->unsupported) return 0;
+		glad_glRectsv(v1, v2);
+	} break;
+	case 142: {
+		GLdouble s;
+		trace_get(glad_replay, &s, sizeof(s));
+		if(glad_replay->unsupported) return 0;
+		glad_glTexCoord1d(s);
+	} break;
+	case 143: {
+		const GLdouble *v;
+		v = (const GLdouble *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glTexCoord1dv(v);
+	} break;
+	case 144: {
+		GLfloat s;
+		trace_get(glad_replay, &s, sizeof(s));
+		if(glad_replay->unsupported) return 0;
+		glad_glTexCoord1f(s);
+	} break;
+	case 145: {
+		const GLfloat *v;
+		v = (const GLfloat *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glTexCoord1fv(v);
+	} break;
+	case 146: {
+		GLint s;
+		trace_get(glad_replay, &s, sizeof(s));
+		if(glad_replay->unsupported) return 0;
+		glad_glTexCoord1i(s);
+	} break;
+	case 147: {
+		const GLint *v;
+		v = (const GLint *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glTexCoord1iv(v);
+	} break;
+	case 148: {
+		GLshort s;
+		trace_get(glad_replay, &s, sizeof(s));
+		if(glad_replay->unsupported) return 0;
+		glad_glTexCoord1s(s);
+	} break;
+	case 149: {
+		const GLshort *v;
+		v = (const GLshort *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glTexCoord1sv(v);
+	} break;
+	case 150: {
+		GLdouble s;
+		GLdouble t;
+		trace_get(glad_replay, &s, sizeof(s));
+		trace_get(glad_replay, &t, sizeof(t));
+		if(glad_replay->unsupported) return 0;
+		glad_glTexCoord2d(s, t);
+	} break;
+	case 151: {
+		const GLdouble *v;
+		v = (const GLdouble *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glTexCoord2dv(v);
+	} break;
+	case 152: {
+		GLfloat s;
+		GLfloat t;
+		trace_get(glad_replay, &s, sizeof(s));
+		trace_get(glad_replay, &t, sizeof(t));
+		if(glad_replay->unsupported) return 0;
+		glad_glTexCoord2f(s, t);
+	} break;
+	case 153: {
+		const GLfloat *v;
+		v = (const GLfloat *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glTexCoord2fv(v);
+	} break;
+	case 154: {
+		GLint s;
+		GLint t;
+		trace_get(glad_replay, &s, sizeof(s));
+		trace_get(glad_replay, &t, sizeof(t));
+		if(glad_replay->unsupported) return 0;
+		glad_glTexCoord2i(s, t);
+	} break;
+	case 155: {
+		const GLint *v;
+		v = (const GLint *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glTexCoord2iv(v);
+	} break;
+	case 156: {
+		GLshort s;
+		GLshort t;
+		trace_get(glad_replay, &s, sizeof(s));
+		trace_get(glad_replay, &t, sizeof(t));
+		if(glad_replay->unsupported) return 0;
+		glad_glTexCoord2s(s, t);
+	} break;
+	case 157: {
+		const GLshort *v;
+		v = (const GLshort *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glTexCoord2sv(v);
+	} break;
+	case 158: {
+		GLdouble s;
+		GLdouble t;
+		GLdouble r;
+		trace_get(glad_replay, &s, sizeof(s));
+		trace_get(glad_replay, &t, sizeof(t));
+		trace_get(glad_replay, &r, sizeof(r));
+		if(glad_replay->unsupported) return 0;
+		glad_glTexCoord3d(s, t, r);
+	} break;
+	case 159: {
+		const GLdouble *v;
+		v = (const GLdouble *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glTexCoord3dv(v);
+	} break;
+	case 160: {
+		GLfloat s;
+		GLfloat t;
+		GLfloat r;
+		trace_get(glad_replay, &s, sizeof(s));
+		trace_get(glad_replay, &t, sizeof(t));
+		trace_get(glad_replay, &r, sizeof(r));
+		if(glad_replay->unsupported) return 0;
+		glad_glTexCoord3f(s, t, r);
+	} break;
+	case 161: {
+		const GLfloat *v;
+		v = (const GLfloat *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glTexCoord3fv(v);
+	} break;
+	case 162: {
+		GLint s;
+		GLint t;
+		GLint r;
+		trace_get(glad_replay, &s, sizeof(s));
+		trace_get(glad_replay, &t, sizeof(t));
+		trace_get(glad_replay, &r, sizeof(r));
+		if(glad_replay->unsupported) return 0;
+		glad_glTexCoord3i(s, t, r);
+	} break;
+	case 163: {
+		const GLint *v;
+		v = (const GLint *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glTexCoord3iv(v);
+	} break;
+	case 164: {
+		GLshort s;
+		GLshort t;
+		GLshort r;
+		trace_get(glad_replay, &s, sizeof(s));
+		trace_get(glad_replay, &t, sizeof(t));
+		trace_get(glad_replay, &r, sizeof(r));
+		if(glad_replay->unsupported) return 0;
+		glad_glTexCoord3s(s, t, r);
+	} break;
+	case 165: {
+		const GLshort *v;
+		v = (const GLshort *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glTexCoord3sv(v);
+	} break;
+	case 166: {
+		GLdouble s;
+		GLdouble t;
+		GLdouble r;
+		GLdouble q;
+		trace_get(glad_replay, &s, sizeof(s));
+		trace_get(glad_replay, &t, sizeof(t));
+		trace_get(glad_replay, &r, sizeof(r));
+		trace_get(glad_replay, &q, sizeof(q));
+		if(glad_replay->unsupported) return 0;
+		glad_glTexCoord4d(s, t, r, q);
+	} break;
+	case 167: {
+		const GLdouble *v;
+		v = (const GLdouble *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glTexCoord4dv(v);
+	} break;
+	case 168: {
+		GLfloat s;
+		GLfloat t;
+		GLfloat r;
+		GLfloat q;
+		trace_get(glad_replay, &s, sizeof(s));
+		trace_get(glad_replay, &t, sizeof(t));
+		trace_get(glad_replay, &r, sizeof(r));
+		trace_get(glad_replay, &q, sizeof(q));
+		if(glad_replay->unsupported) return 0;
+		glad_glTexCoord4f(s, t, r, q);
+	} break;
+	case 169: {
+		const GLfloat *v;
+		v = (const GLfloat *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glTexCoord4fv(v);
+	} break;
+	case 170: {
+		GLint s;
+		GLint t;
+		GLint r;
+		GLint q;
+		trace_get(glad_replay, &s, sizeof(s));
+		trace_get(glad_replay, &t, sizeof(t));
+		trace_get(glad_replay, &r, sizeof(r));
+		trace_get(glad_replay, &q, sizeof(q));
+		if(glad_replay->unsupported) return 0;
+		glad_glTexCoord4i(s, t, r, q);
+	} break;
+	case 171: {
+		const GLint *v;
+		v = (const GLint *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glTexCoord4iv(v);
+	} break;
+	case 172: {
+		GLshort s;
+		GLshort t;
+		GLshort r;
+		GLshort q;
+		trace_get(glad_replay, &s, sizeof(s));
+		trace_get(glad_replay, &t, sizeof(t));
+		trace_get(glad_replay, &r, sizeof(r));
+		trace_get(glad_replay, &q, sizeof(q));
+		if(glad_replay->unsupported) return 0;
+		glad_glTexCoord4s(s, t, r, q);
+	} break;
+	case 173: {
+		const GLshort *v;
+		v = (const GLshort *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glTexCoord4sv(v);
+	} break;
+	case 174: {
+		GLdouble x;
+		GLdouble y;
+		trace_get(glad_replay, &x, sizeof(x));
+		trace_get(glad_replay, &y, sizeof(y));
+		if(glad_replay->unsupported) return 0;
+		glad_glVertex2d(x, y);
+	} break;
+	case 175: {
+		const GLdouble *v;
+		v = (const GLdouble *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glVertex2dv(v);
+	} break;
+	case 176: {
+		GLfloat x;
+		GLfloat y;
+		trace_get(glad_replay, &x, sizeof(x));
+		trace_get(glad_replay, &y, sizeof(y));
+		if(glad_replay->unsupported) return 0;
+		glad_glVertex2f(x, y);
+	} break;
+	case 177: {
+		const GLfloat *v;
+		v = (const GLfloat *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glVertex2fv(v);
+	} break;
+	case 178: {
+		GLint x;
+		GLint y;
+		trace_get(glad_replay, &x, sizeof(x));
+		trace_get(glad_replay, &y, sizeof(y));
+		if(glad_replay->unsupported) return 0;
+		glad_glVertex2i(x, y);
+	} break;
+	case 179: {
+		const GLint *v;
+		v = (const GLint *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glVertex2iv(v);
+	} break;
+	case 180: {
+		GLshort x;
+		GLshort y;
+		trace_get(glad_replay, &x, sizeof(x));
+		trace_get(glad_replay, &y, sizeof(y));
+		if(glad_replay->unsupported) return 0;
+		glad_glVertex2s(x, y);
+	} break;
+	case 181: {
+		const GLshort *v;
+		v = (const GLshort *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glVertex2sv(v);
+	} break;
+	case 182: {
+		GLdouble x;
+		GLdouble y;
+		GLdouble z;
+		trace_get(glad_replay, &x, sizeof(x));
+		trace_get(glad_replay, &y, sizeof(y));
+		trace_get(glad_replay, &z, sizeof(z));
+		if(glad_replay->unsupported) return 0;
+		glad_glVertex3d(x, y, z);
+	} break;
+	case 183: {
+		const GLdouble *v;
+		v = (const GLdouble *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glVertex3dv(v);
+	} break;
+	case 184: {
+		GLfloat x;
+		GLfloat y;
+		GLfloat z;
+		trace_get(glad_replay, &x, sizeof(x));
+		trace_get(glad_replay, &y, sizeof(y));
+		trace_get(glad_replay, &z, sizeof(z));
+		if(glad_replay->unsupported) return 0;
+		glad_glVertex3f(x, y, z);
+	} break;
+	case 185: {
+		const GLfloat *v;
+		v = (const GLfloat *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glVertex3fv(v);
+	} break;
+	case 186: {
+		GLint x;
+		GLint y;
+		GLint z;
+		trace_get(glad_replay, &x, sizeof(x));
+		trace_get(glad_replay, &y, sizeof(y));
+		trace_get(glad_replay, &z, sizeof(z));
+		if(glad_replay->unsupported) return 0;
+		glad_glVertex3i(x, y, z);
+	} break;
+	case 187: {
+		const GLint *v;
+		v = (const GLint *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glVertex3iv(v);
+	} break;
+	case 188: {
+		GLshort x;
+		GLshort y;
+		GLshort z;
+		trace_get(glad_replay, &x, sizeof(x));
+		trace_get(glad_replay, &y, sizeof(y));
+		trace_get(glad_replay, &z, sizeof(z));
+		if(glad_replay->unsupported) return 0;
+		glad_glVertex3s(x, y, z);
+	} break;
+	case 189: {
+		const GLshort *v;
+		v = (const GLshort *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glVertex3sv(v);
+	} break;
+	case 190: {
+		GLdouble x;
+		GLdouble y;
+		GLdouble z;
+		GLdouble w;
+		trace_get(glad_replay, &x, sizeof(x));
+		trace_get(glad_replay, &y, sizeof(y));
+		trace_get(glad_replay, &z, sizeof(z));
+		trace_get(glad_replay, &w, sizeof(w));
+		if(glad_replay->unsupported) return 0;
+		glad_glVertex4d(x, y, z, w);
+	} break;
+	case 191: {
+		const GLdouble *v;
+		v = (const GLdouble *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glVertex4dv(v);
+	} break;
+	case 192: {
+		GLfloat x;
+		GLfloat y;
+		GLfloat z;
+		GLfloat w;
+		trace_get(glad_replay, &x, sizeof(x));
+		trace_get(glad_replay, &y, sizeof(y));
+		trace_get(glad_replay, &z, sizeof(z));
+		trace_get(glad_replay, &w, sizeof(w));
+		if(glad_replay->unsupported) return 0;
+		glad_glVertex4f(x, y, z, w);
+	} break;
+	case 193: {
+		const GLfloat *v;
+		v = (const GLfloat *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glVertex4fv(v);
+	} break;
+	case 194: {
+		GLint x;
+		GLint y;
+		GLint z;
+		GLint w;
+		trace_get(glad_replay, &x, sizeof(x));
+		trace_get(glad_replay, &y, sizeof(y));
+		trace_get(glad_replay, &z, sizeof(z));
+		trace_get(glad_replay, &w, sizeof(w));
+		if(glad_replay->unsupported) return 0;
+		glad_glVertex4i(x, y, z, w);
+	} break;
+	case 195: {
+		const GLint *v;
+		v = (const GLint *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glVertex4iv(v);
+	} break;
+	case 196: {
+		GLshort x;
+		GLshort y;
+		GLshort z;
+		GLshort w;
+		trace_get(glad_replay, &x, sizeof(x));
+		trace_get(glad_replay, &y, sizeof(y));
+		trace_get(glad_replay, &z, sizeof(z));
+		trace_get(glad_replay, &w, sizeof(w));
+		if(glad_replay->unsupported) return 0;
+		glad_glVertex4s(x, y, z, w);
+	} break;
+	case 197: {
+		const GLshort *v;
+		v = (const GLshort *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glVertex4sv(v);
+	} break;
+	case 198: {
+		GLenum plane;
+		const GLdouble *equation;
+		trace_get(glad_replay, &plane, sizeof(plane));
+		trace_get_unsupported(glad_replay);
+		equation = NULL;
+		if(glad_replay->unsupported) return 0;
+		glad_glClipPlane(plane, equation);
+	} break;
+	case 199: {
+		GLenum face;
+		GLenum mode;
+		trace_get(glad_replay, &face, sizeof(face));
+		trace_get(glad_replay, &mode, sizeof(mode));
+		if(glad_replay->unsupported) return 0;
+		glad_glColorMaterial(face, mode);
+	} break;
+	case 200: {
+		GLenum pname;
+		GLfloat param;
+		trace_get(glad_replay, &pname, sizeof(pname));
+		trace_get(glad_replay, &param, sizeof(param));
+		if(glad_replay->unsupported) return 0;
+		glad_glFogf(pname, param);
+	} break;
+	case 201: {
+		GLenum pname;
+		const GLfloat *params;
+		trace_get(glad_replay, &pname, sizeof(pname));
+		trace_get_unsupported(glad_replay);
+		params = NULL;
+		if(glad_replay->unsupported) return 0;
+		glad_glFogfv(pname, params);
+	} break;
+	case 202: {
+		GLenum pname;
+		GLint param;
+		trace_get(glad_replay, &pname, sizeof(pname));
+		trace_get(glad_replay, &param, sizeof(param));
+		if(glad_replay->unsupported) return 0;
+		glad_glFogi(pname, param);
+	} break;
+	case 203: {
+		GLenum pname;
+		const GLint *params;
+		trace_get(glad_replay, &pname, sizeof(pname));
+		trace_get_unsupported(glad_replay);
+		params = NULL;
+		if(glad_replay->unsupported) return 0;
+		glad_glFogiv(pname, params);
+	} break;
+	case 204: {
+		GLenum light;
+		GLenum pname;
+		GLfloat param;
+		trace_get(glad_replay, &light, sizeof(light));
+		trace_get(glad_replay, &pname, sizeof(pname));
+		trace_get(glad_replay, &param, sizeof(param));
+		if(glad_replay->unsupported) return 0;
+		glad_glLightf(light, pname, param);
+	} break;
+	case 205: {
+		GLenum light;
+		GLenum pname;
+		const GLfloat *params;
+		trace_get(glad_replay, &light, sizeof(light));
+		trace_get(glad_replay, &pname, sizeof(pname));
+		trace_get_unsupported(glad_replay);
+		params = NULL;
+		if(glad_replay->unsupported) return 0;
+		glad_glLightfv(light, pname, params);
+	} break;
+	case 206: {
+		GLenum light;
+		GLenum pname;
+		GLint param;
+		trace_get(glad_replay, &light, sizeof(light));
+		trace_get(glad_replay, &pname, sizeof(pname));
+		trace_get(glad_replay, &param, sizeof(param));
+		if(glad_replay->unsupported) return 0;
+		glad_glLighti(light, pname, param);
+	} break;
+	case 207: {
+		GLenum light;
+		GLenum pname;
+		const GLint *params;
+		trace_get(glad_replay, &light, sizeof(light));
+		trace_get(glad_replay, &pname, sizeof(pname));
+		trace_get_unsupported(glad_replay);
+		params = NULL;
+		if(glad_replay->unsupported) return 0;
+		glad_glLightiv(light, pname, params);
+	} break;
+	case 208: {
+		GLenum pname;
+		GLfloat param;
+		trace_get(glad_replay, &pname, sizeof(pname));
+		trace_get(glad_replay, &param, sizeof(param));
+		if(glad_replay->unsupported) return 0;
+		glad_glLightModelf(pname, param);
+	} break;
+	case 209: {
+		GLenum pname;
+		const GLfloat *params;
+		trace_get(glad_replay, &pname, sizeof(pname));
+		trace_get_unsupported(glad_replay);
+		params = NULL;
+		if(glad_replay->unsupported) return 0;
+		glad_glLightModelfv(pname, params);
+	} break;
+	case 210: {
+		GLenum pname;
+		GLint param;
+		trace_get(glad_replay, &pname, sizeof(pname));
+		trace_get(glad_replay, &param, sizeof(param));
+		if(glad_replay->unsupported) return 0;
+		glad_glLightModeli(pname, param);
+	} break;
+	case 211: {
+		GLenum pname;
+		const GLint *params;
+		trace_get(glad_replay, &pname, sizeof(pname));
+		trace_get_unsupported(glad_replay);
+		params = NULL;
+		if(glad_replay->unsupported) return 0;
+		glad_glLightModeliv(pname, params);
+	} break;
+	case 212: {
+		GLint factor;
+		GLushort pattern;
+		trace_get(glad_replay, &factor, sizeof(factor));
+		trace_get(glad_replay, &pattern, sizeof(pattern));
+		if(glad_replay->unsupported) return 0;
+		glad_glLineStipple(factor, pattern);
+	} break;
+	case 213: {
+		GLenum face;
+		GLenum pname;
+		GLfloat param;
+		trace_get(glad_replay, &face, sizeof(face));
+		trace_get(glad_replay, &pname, sizeof(pname));
+		trace_get(glad_replay, &param, sizeof(param));
+		if(glad_replay->unsupported) return 0;
+		glad_glMaterialf(face, pname, param);
+	} break;
+	case 214: {
+		GLenum face;
+		GLenum pname;
+		const GLfloat *params;
+		trace_get(glad_replay, &face, sizeof(face));
+		trace_get(glad_replay, &pname, sizeof(pname));
+		trace_get_unsupported(glad_replay);
+		params = NULL;
+		if(glad_replay->unsupported) return 0;
+		glad_glMaterialfv(face, pname, params);
+	} break;
+	case 215: {
+		GLenum face;
+		GLenum pname;
+		GLint param;
+		trace_get(glad_replay, &face, sizeof(face));
+		trace_get(glad_replay, &pname, sizeof(pname));
+		trace_get(glad_replay, &param, sizeof(param));
+		if(glad_replay->unsupported) return 0;
+		glad_glMateriali(face, pname, param);
+	} break;
+	case 216: {
+		GLenum face;
+		GLenum pname;
+		const GLint *params;
+		trace_get(glad_replay, &face, sizeof(face));
+		trace_get(glad_replay, &pname, sizeof(pname));
+		trace_get_unsupported(glad_replay);
+		params = NULL;
+		if(glad_replay->unsupported) return 0;
+		glad_glMaterialiv(face, pname, params);
+	} break;
+	case 217: {
+		const GLubyte *mask;
+		trace_get_unsupported(glad_replay);
+		mask = NULL;
+		if(glad_replay->unsupported) return 0;
+		glad_glPolygonStipple(mask);
+	} break;
+	case 218: {
+		GLenum mode;
+		trace_get(glad_replay, &mode, sizeof(mode));
+		if(glad_replay->unsupported) return 0;
+		glad_glShadeModel(mode);
+	} break;
+	case 219: {
+		GLenum target;
+		GLenum pname;
+		GLfloat param;
+		trace_get(glad_replay, &target, sizeof(target));
+		trace_get(glad_replay, &pname, sizeof(pname));
+		trace_get(glad_replay, &param, sizeof(param));
+		if(glad_replay->unsupported) return 0;
+		glad_glTexEnvf(target, pname, param);
+	} break;
+	case 220: {
+		GLenum target;
+		GLenum pname;
+		const GLfloat *params;
+		trace_get(glad_replay, &target, sizeof(target));
+		trace_get(glad_replay, &pname, sizeof(pname));
+		trace_get_unsupported(glad_replay);
+		params = NULL;
+		if(glad_replay->unsupported) return 0;
+		glad_glTexEnvfv(target, pname, params);
+	} break;
+	case 221: {
+		GLenum target;
+		GLenum pname;
+		GLint param;
+		trace_get(glad_replay, &target, sizeof(target));
+		trace_get(glad_replay, &pname, sizeof(pname));
+		trace_get(glad_replay, &param, sizeof(param));
+		if(glad_replay->unsupported) return 0;
+		glad_glTexEnvi(target, pname, param);
+	} break;
+	case 222: {
+		GLenum target;
+		GLenum pname;
+		const GLint *params;
+		trace_get(glad_replay, &target, sizeof(target));
+		trace_get(glad_replay, &pname, sizeof(pname));
+		trace_get_unsupported(glad_replay);
+		params = NULL;
+		if(glad_replay->unsupported) return 0;
+		glad_glTexEnviv(target, pname, params);
+	} break;
+	case 223: {
+		GLenum coord;
+		GLenum pname;
+		GLdouble param;
+		trace_get(glad_replay, &coord, sizeof(coord));
+		trace_get(glad_replay, &pname, sizeof(pname));
+		trace_get(glad_replay, &param, sizeof(param));
+		if(glad_replay->unsupported) return 0;
+		glad_glTexGend(coord, pname, param);
+	} break;
+	case 224: {
+		GLenum coord;
+		GLenum pname;
+		const GLdouble *params;
+		trace_get(glad_replay, &coord, sizeof(coord));
+		trace_get(glad_replay, &pname, sizeof(pname));
+		trace_get_unsupported(glad_replay);
+		params = NULL;
+		if(glad_replay->unsupported) return 0;
+		glad_glTexGendv(coord, pname, params);
+	} break;
+	case 225: {
+		GLenum coord;
+		GLenum pname;
+		GLfloat param;
+		trace_get(glad_replay, &coord, sizeof(coord));
+		trace_get(glad_replay, &pname, sizeof(pname));
+		trace_get(glad_replay, &param, sizeof(param));
+		if(glad_replay->unsupported) return 0;
+		glad_glTexGenf(coord, pname, param);
+	} break;
+	case 226: {
+		GLenum coord;
+		GLenum pname;
+		const GLfloat *params;
+		trace_get(glad_replay, &coord, sizeof(coord));
+		trace_get(glad_replay, &pname, sizeof(pname));
+		trace_get_unsupported(glad_replay);
+		params = NULL;
+		if(glad_replay->unsupported) return 0;
+		glad_glTexGenfv(coord, pname, params);
+	} break;
+	case 227: {
+		GLenum coord;
+		GLenum pname;
+		GLint param;
+		trace_get(glad_replay, &coord, sizeof(coord));
+		trace_get(glad_replay, &pname, sizeof(pname));
+		trace_get(glad_replay, &param, sizeof(param));
+		if(glad_replay->unsupported) return 0;
+		glad_glTexGeni(coord, pname, param);
+	} break;
+	case 228: {
+		GLenum coord;
+		GLenum pname;
+		const GLint *params;
+		trace_get(glad_replay, &coord, sizeof(coord));
+		trace_get(glad_replay, &pname, sizeof(pname));
+		trace_get_unsupported(glad_replay);
+		params = NULL;
+		if(glad_replay->unsupported) return 0;
+		glad_glTexGeniv(coord, pname, params);
+	} break;
+	case 229: {
+		GLsizei size;
+		GLenum type;
+		GLfloat *buffer;
+		trace_get(glad_replay, &size, sizeof(size));
+		trace_get(glad_replay, &type, sizeof(type));
+		buffer = (GLfloat *)trace_scratch(glad_replay, 0, TRACE_SCRATCH_DEFAULT);
+		if(glad_replay->unsupported) return 0;
+		glad_glFeedbackBuffer(size, type, buffer);
+	} break;
+	case 230: {
+		GLsizei size;
+		GLuint *buffer;
+		trace_get(glad_replay, &size, sizeof(size));
+		buffer = (GLuint *)trace_scratch(glad_replay, 0, TRACE_SCRATCH_DEFAULT);
+		if(glad_replay->unsupported) return 0;
+		glad_glSelectBuffer(size, buffer);
+	} break;
+	case 231: {
+		GLenum mode;
+		GLint glad_result;
+		GLint recorded_result;
+		trace_get(glad_replay, &mode, sizeof(mode));
+		trace_get(glad_replay, &recorded_result, sizeof(recorded_result));
+		if(glad_replay->unsupported) return 0;
+		glad_result = glad_glRenderMode(mode);
+		(void)glad_result;
+		(void)recorded_result;
+	} break;
+	case 232: {
+		if(glad_replay->unsupported) return 0;
+		glad_glInitNames();
+	} break;
+	case 233: {
+		GLuint name;
+		trace_get(glad_replay, &name, sizeof(name));
+		if(glad_replay->unsupported) return 0;
+		glad_glLoadName(name);
+	} break;
+	case 234: {
+		GLfloat token;
+		trace_get(glad_replay, &token, sizeof(token));
+		if(glad_replay->unsupported) return 0;
+		glad_glPassThrough(token);
+	} break;
+	case 235: {
+		if(glad_replay->unsupported) return 0;
+		glad_glPopName();
+	} break;
+	case 236: {
+		GLuint name;
+		trace_get(glad_replay, &name, sizeof(name));
+		if(glad_replay->unsupported) return 0;
+		glad_glPushName(name);
+	} break;
+	case 237: {
+		GLfloat red;
+		GLfloat green;
+		GLfloat blue;
+		GLfloat alpha;
+		trace_get(glad_replay, &red, sizeof(red));
+		trace_get(glad_replay, &green, sizeof(green));
+		trace_get(glad_replay, &blue, sizeof(blue));
+		trace_get(glad_replay, &alpha, sizeof(alpha));
+		if(glad_replay->unsupported) return 0;
+		glad_glClearAccum(red, green, blue, alpha);
+	} break;
+	case 238: {
+		GLfloat c;
+		trace_get(glad_replay, &c, sizeof(c));
+		if(glad_replay->unsupported) return 0;
+		glad_glClearIndex(c);
+	} break;
+	case 239: {
+		GLuint mask;
+		trace_get(glad_replay, &mask, sizeof(mask));
+		if(glad_replay->unsupported) return 0;
+		glad_glIndexMask(mask);
+	} break;
+	case 240: {
+		GLenum op;
+		GLfloat value;
+		trace_get(glad_replay, &op, sizeof(op));
+		trace_get(glad_replay, &value, sizeof(value));
+		if(glad_replay->unsupported) return 0;
+		glad_glAccum(op, value);
+	} break;
+	case 241: {
+		if(glad_replay->unsupported) return 0;
+		glad_glPopAttrib();
+	} break;
+	case 242: {
+		GLbitfield mask;
+		trace_get(glad_replay, &mask, sizeof(mask));
+		if(glad_replay->unsupported) return 0;
+		glad_glPushAttrib(mask);
+	} break;
+	case 243: {
+		GLenum target;
+		GLdouble u1;
+		GLdouble u2;
+		GLint stride;
+		GLint order;
+		const GLdouble *points;
+		trace_get(glad_replay, &target, sizeof(target));
+		trace_get(glad_replay, &u1, sizeof(u1));
+		trace_get(glad_replay, &u2, sizeof(u2));
+		trace_get(glad_replay, &stride, sizeof(stride));
+		trace_get(glad_replay, &order, sizeof(order));
+		trace_get_unsupported(glad_replay);
+		points = NULL;
+		if(glad_replay->unsupported) return 0;
+		glad_glMap1d(target, u1, u2, stride, order, points);
+	} break;
+	case 244: {
+		GLenum target;
+		GLfloat u1;
+		GLfloat u2;
+		GLint stride;
+		GLint order;
+		const GLfloat *points;
+		trace_get(glad_replay, &target, sizeof(target));
+		trace_get(glad_replay, &u1, sizeof(u1));
+		trace_get(glad_replay, &u2, sizeof(u2));
+		trace_get(glad_replay, &stride, sizeof(stride));
+		trace_get(glad_replay, &order, sizeof(order));
+		trace_get_unsupported(glad_replay);
+		points = NULL;
+		if(glad_replay->unsupported) return 0;
+		glad_glMap1f(target, u1, u2, stride, order, points);
+	} break;
+	case 245: {
+		GLenum target;
+		GLdouble u1;
+		GLdouble u2;
+		GLint ustride;
+		GLint uorder;
+		GLdouble v1;
+		GLdouble v2;
+		GLint vstride;
+		GLint vorder;
+		const GLdouble *points;
+		trace_get(glad_replay, &target, sizeof(target));
+		trace_get(glad_replay, &u1, sizeof(u1));
+		trace_get(glad_replay, &u2, sizeof(u2));
+		trace_get(glad_replay, &ustride, sizeof(ustride));
+		trace_get(glad_replay, &uorder, sizeof(uorder));
+		trace_get(glad_replay, &v1, sizeof(v1));
+		trace_get(glad_replay, &v2, sizeof(v2));
+		trace_get(glad_replay, &vstride, sizeof(vstride));
+		trace_get(glad_replay, &vorder, sizeof(vorder));
+		trace_get_unsupported(glad_replay);
+		points = NULL;
+		if(glad_replay->unsupported) return 0;
+		glad_glMap2d(target, u1, u2, ustride, uorder, v1, v2, vstride, vorder, points);
+	} break;
+	case 246: {
+		GLenum target;
+		GLfloat u1;
+		GLfloat u2;
+		GLint ustride;
+		GLint uorder;
+		GLfloat v1;
+		GLfloat v2;
+		GLint vstride;
+		GLint vorder;
+		const GLfloat *points;
+		trace_get(glad_replay, &target, sizeof(target));
+		trace_get(glad_replay, &u1, sizeof(u1));
+		trace_get(glad_replay, &u2, sizeof(u2));
+		trace_get(glad_replay, &ustride, sizeof(ustride));
+		trace_get(glad_replay, &uorder, sizeof(uorder));
+		trace_get(glad_replay, &v1, sizeof(v1));
+		trace_get(glad_replay, &v2, sizeof(v2));
+		trace_get(glad_replay, &vstride, sizeof(vstride));
+		trace_get(glad_replay, &vorder, sizeof(vorder));
+		trace_get_unsupported(glad_replay);
+		points = NULL;
+		if(glad_replay->unsupported) return 0;
+		glad_glMap2f(target, u1, u2, ustride, uorder, v1, v2, vstride, vorder, points);
+	} break;
+	case 247: {
+		GLint un;
+		GLdouble u1;
+		GLdouble u2;
+		trace_get(glad_replay, &un, sizeof(un));
+		trace_get(glad_replay, &u1, sizeof(u1));
+		trace_get(glad_replay, &u2, sizeof(u2));
+		if(glad_replay->unsupported) return 0;
+		glad_glMapGrid1d(un, u1, u2);
+	} break;
+	case 248: {
+		GLint un;
+		GLfloat u1;
+		GLfloat u2;
+		trace_get(glad_replay, &un, sizeof(un));
+		trace_get(glad_replay, &u1, sizeof(u1));
+		trace_get(glad_replay, &u2, sizeof(u2));
+		if(glad_replay->unsupported) return 0;
+		glad_glMapGrid1f(un, u1, u2);
+	} break;
+	case 249: {
+		GLint un;
+		GLdouble u1;
+		GLdouble u2;
+		GLint vn;
+		GLdouble v1;
+		GLdouble v2;
+		trace_get(glad_replay, &un, sizeof(un));
+		trace_get(glad_replay, &u1, sizeof(u1));
+		trace_get(glad_replay, &u2, sizeof(u2));
+		trace_get(glad_replay, &vn, sizeof(vn));
+		trace_get(glad_replay, &v1, sizeof(v1));
+		trace_get(glad_replay, &v2, sizeof(v2));
+		if(glad_replay->unsupported) return 0;
+		glad_glMapGrid2d(un, u1, u2, vn, v1, v2);
+	} break;
+	case 250: {
+		GLint un;
+		GLfloat u1;
+		GLfloat u2;
+		GLint vn;
+		GLfloat v1;
+		GLfloat v2;
+		trace_get(glad_replay, &un, sizeof(un));
+		trace_get(glad_replay, &u1, sizeof(u1));
+		trace_get(glad_replay, &u2, sizeof(u2));
+		trace_get(glad_replay, &vn, sizeof(vn));
+		trace_get(glad_replay, &v1, sizeof(v1));
+		trace_get(glad_replay, &v2, sizeof(v2));
+		if(glad_replay->unsupported) return 0;
+		glad_glMapGrid2f(un, u1, u2, vn, v1, v2);
+	} break;
+	case 251: {
+		GLdouble u;
+		trace_get(glad_replay, &u, sizeof(u));
+		if(glad_replay->unsupported) return 0;
+		glad_glEvalCoord1d(u);
+	} break;
+	case 252: {
+		const GLdouble *u;
+		u = (const GLdouble *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glEvalCoord1dv(u);
+	} break;
+	case 253: {
+		GLfloat u;
+		trace_get(glad_replay, &u, sizeof(u));
+		if(glad_replay->unsupported) return 0;
+		glad_glEvalCoord1f(u);
+	} break;
+	case 254: {
+		const GLfloat *u;
+		u = (const GLfloat *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glEvalCoord1fv(u);
+	} break;
+	case 255: {
+		GLdouble u;
+		GLdouble v;
+		trace_get(glad_replay, &u, sizeof(u));
+		trace_get(glad_replay, &v, sizeof(v));
+		if(glad_replay->unsupported) return 0;
+		glad_glEvalCoord2d(u, v);
+	} break;
+	case 256: {
+		const GLdouble *u;
+		u = (const GLdouble *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glEvalCoord2dv(u);
+	} break;
+	case 257: {
+		GLfloat u;
+		GLfloat v;
+		trace_get(glad_replay, &u, sizeof(u));
+		trace_get(glad_replay, &v, sizeof(v));
+		if(glad_replay->unsupported) return 0;
+		glad_glEvalCoord2f(u, v);
+	} break;
+	case 258: {
+		const GLfloat *u;
+		u = (const GLfloat *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glEvalCoord2fv(u);
+	} break;
+	case 259: {
+		GLenum mode;
+		GLint i1;
+		GLint i2;
+		trace_get(glad_replay, &mode, sizeof(mode));
+		trace_get(glad_replay, &i1, sizeof(i1));
+		trace_get(glad_replay, &i2, sizeof(i2));
+		if(glad_replay->unsupported) return 0;
+		glad_glEvalMesh1(mode, i1, i2);
+	} break;
+	case 260: {
+		GLint i;
+		trace_get(glad_replay, &i, sizeof(i));
+		if(glad_replay->unsupported) return 0;
+		glad_glEvalPoint1(i);
+	} break;
+	case 261: {
+		GLenum mode;
+		GLint i1;
+		GLint i2;
+		GLint j1;
+		GLint j2;
+		trace_get(glad_replay, &mode, sizeof(mode));
+		trace_get(glad_replay, &i1, sizeof(i1));
+		trace_get(glad_replay, &i2, sizeof(i2));
+		trace_get(glad_replay, &j1, sizeof(j1));
+		trace_get(glad_replay, &j2, sizeof(j2));
+		if(glad_replay->unsupported) return 0;
+		glad_glEvalMesh2(mode, i1, i2, j1, j2);
+	} break;
+	case 262: {
+		GLint i;
+		GLint j;
+		trace_get(glad_replay, &i, sizeof(i));
+		trace_get(glad_replay, &j, sizeof(j));
+		if(glad_replay->unsupported) return 0;
+		glad_glEvalPoint2(i, j);
+	} break;
+	case 263: {
+		GLenum func;
+		GLfloat ref;
+		trace_get(glad_replay, &func, sizeof(func));
+		trace_get(glad_replay, &ref, sizeof(ref));
+		if(glad_replay->unsupported) return 0;
+		glad_glAlphaFunc(func, ref);
+	} break;
+	case 264: {
+		GLfloat xfactor;
+		GLfloat yfactor;
+		trace_get(glad_replay, &xfactor, sizeof(xfactor));
+		trace_get(glad_replay, &yfactor, sizeof(yfactor));
+		if(glad_replay->unsupported) return 0;
+		glad_glPixelZoom(xfactor, yfactor);
+	} break;
+	case 265: {
+		GLenum pname;
+		GLfloat param;
+		trace_get(glad_replay, &pname, sizeof(pname));
+		trace_get(glad_replay, &param, sizeof(param));
+		if(glad_replay->unsupported) return 0;
+		glad_glPixelTransferf(pname, param);
+	} break;
+	case 266: {
+		GLenum pname;
+		GLint param;
+		trace_get(glad_replay, &pname, sizeof(pname));
+		trace_get(glad_replay, &param, sizeof(param));
+		if(glad_replay->unsupported) return 0;
+		glad_glPixelTransferi(pname, param);
+	} break;
+	case 267: {
+		GLenum map;
+		GLsizei mapsize;
+		const GLfloat *values;
+		trace_get(glad_replay, &map, sizeof(map));
+		trace_get(glad_replay, &mapsize, sizeof(mapsize));
+		trace_get_unsupported(glad_replay);
+		values = NULL;
+		if(glad_replay->unsupported) return 0;
+		glad_glPixelMapfv(map, mapsize, values);
+	} break;
+	case 268: {
+		GLenum map;
+		GLsizei mapsize;
+		const GLuint *values;
+		trace_get(glad_replay, &map, sizeof(map));
+		trace_get(glad_replay, &mapsize, sizeof(mapsize));
+		trace_get_unsupported(glad_replay);
+		values = NULL;
+		if(glad_replay->unsupported) return 0;
+		glad_glPixelMapuiv(map, mapsize, values);
+	} break;
+	case 269: {
+		GLenum map;
+		GLsizei mapsize;
+		const GLushort *values;
+		trace_get(glad_replay, &map, sizeof(map));
+		trace_get(glad_replay, &mapsize, sizeof(mapsize));
+		trace_get_unsupported(glad_replay);
+		values = NULL;
+		if(glad_replay->unsupported) return 0;
+		glad_glPixelMapusv(map, mapsize, values);
+	} break;
+	case 270: {
+		GLint x;
+		GLint y;
+		GLsizei width;
+		GLsizei height;
+		GLenum type;
+		trace_get(glad_replay, &x, sizeof(x));
+		trace_get(glad_replay, &y, sizeof(y));
+		trace_get(glad_replay, &width, sizeof(width));
+		trace_get(glad_replay, &height, sizeof(height));
+		trace_get(glad_replay, &type, sizeof(type));
+		if(glad_replay->unsupported) return 0;
+		glad_glCopyPixels(x, y, width, height, type);
+	} break;
+	case 271: {
+		GLsizei width;
+		GLsizei height;
+		GLenum format;
+		GLenum type;
+		const void *pixels;
+		trace_get(glad_replay, &width, sizeof(width));
+		trace_get(glad_replay, &height, sizeof(height));
+		trace_get(glad_replay, &format, sizeof(format));
+		trace_get(glad_replay, &type, sizeof(type));
+		trace_get_unsupported(glad_replay);
+		pixels = NULL;
+		if(glad_replay->unsupported) return 0;
+		glad_glDrawPixels(width, height, format, type, pixels);
+	} break;
+	case 272: {
+		GLenum plane;
+		GLdouble *equation;
+		trace_get(glad_replay, &plane, sizeof(plane));
+		equation = (GLdouble *)trace_scratch(glad_replay, 0, TRACE_SCRATCH_DEFAULT);
+		if(glad_replay->unsupported) return 0;
+		glad_glGetClipPlane(plane, equation);
+	} break;
+	case 273: {
+		GLenum light;
+		GLenum pname;
+		GLfloat *params;
+		trace_get(glad_replay, &light, sizeof(light));
+		trace_get(glad_replay, &pname, sizeof(pname));
+		params = (GLfloat *)trace_scratch(glad_replay, 0, TRACE_SCRATCH_DEFAULT);
+		if(glad_replay->unsupported) return 0;
+		glad_glGetLightfv(light, pname, params);
+	} break;
+	case 274: {
+		GLenum light;
+		GLenum pname;
+		GLint *params;
+		trace_get(glad_replay, &light, sizeof(light));
+		trace_get(glad_replay, &pname, sizeof(pname));
+		params = (GLint *)trace_scratch(glad_replay, 0, TRACE_SCRATCH_DEFAULT);
+		if(glad_replay->unsupported) return 0;
+		glad_glGetLightiv(light, pname, params);
+	} break;
+	case 275: {
+		GLenum target;
+		GLenum query;
+		GLdouble *v;
+		trace_get(glad_replay, &target, sizeof(target));
+		trace_get(glad_replay, &query, sizeof(query));
+		v = (GLdouble *)trace_scratch(glad_replay, 0, TRACE_SCRATCH_DEFAULT);
+		if(glad_replay->unsupported) return 0;
+		glad_glGetMapdv(target, query, v);
+	} break;
+	case 276: {
+		GLenum target;
+		GLenum query;
+		GLfloat *v;
+		trace_get(glad_replay, &target, sizeof(target));
+		trace_get(glad_replay, &query, sizeof(query));
+		v = (GLfloat *)trace_scratch(glad_replay, 0, TRACE_SCRATCH_DEFAULT);
+		if(glad_replay->unsupported) return 0;
+		glad_glGetMapfv(target, query, v);
+	} break;
+	case 277: {
+		GLenum target;
+		GLenum query;
+		GLint *v;
+		trace_get(glad_replay, &target, sizeof(target));
+		trace_get(glad_replay, &query, sizeof(query));
+		v = (GLint *)trace_scratch(glad_replay, 0, TRACE_SCRATCH_DEFAULT);
+		if(glad_replay->unsupported) return 0;
+		glad_glGetMapiv(target, query, v);
+	} break;
+	case 278: {
+		GLenum face;
+		GLenum pname;
+		GLfloat *params;
+		trace_get(glad_replay, &face, sizeof(face));
+		trace_get(glad_replay, &pname, sizeof(pname));
+		params = (GLfloat *)trace_scratch(glad_replay, 0, TRACE_SCRATCH_DEFAULT);
+		if(glad_replay->unsupported) return 0;
+		glad_glGetMaterialfv(face, pname, params);
+	} break;
+	case 279: {
+		GLenum face;
+		GLenum pname;
+		GLint *params;
+		trace_get(glad_replay, &face, sizeof(face));
+		trace_get(glad_replay, &pname, sizeof(pname));
+		params = (GLint *)trace_scratch(glad_replay, 0, TRACE_SCRATCH_DEFAULT);
+		if(glad_replay->unsupported) return 0;
+		glad_glGetMaterialiv(face, pname, params);
+	} break;
+	case 280: {
+		GLenum map;
+		GLfloat *values;
+		trace_get(glad_replay, &map, sizeof(map));
+		values = (GLfloat *)trace_scratch(glad_replay, 0, TRACE_SCRATCH_DEFAULT);
+		if(glad_replay->unsupported) return 0;
+		glad_glGetPixelMapfv(map, values);
+	} break;
+	case 281: {
+		GLenum map;
+		GLuint *values;
+		trace_get(glad_replay, &map, sizeof(map));
+		values = (GLuint *)trace_scratch(glad_replay, 0, TRACE_SCRATCH_DEFAULT);
+		if(glad_replay->unsupported) return 0;
+		glad_glGetPixelMapuiv(map, values);
+	} break;
+	case 282: {
+		GLenum map;
+		GLushort *values;
+		trace_get(glad_replay, &map, sizeof(map));
+		values = (GLushort *)trace_scratch(glad_replay, 0, TRACE_SCRATCH_DEFAULT);
+		if(glad_replay->unsupported) return 0;
+		glad_glGetPixelMapusv(map, values);
+	} break;
+	case 283: {
+		GLubyte *mask;
+		mask = (GLubyte *)trace_scratch(glad_replay, 0, TRACE_SCRATCH_DEFAULT);
+		if(glad_replay->unsupported) return 0;
+		glad_glGetPolygonStipple(mask);
+	} break;
+	case 284: {
+		GLenum target;
+		GLenum pname;
+		GLfloat *params;
+		trace_get(glad_replay, &target, sizeof(target));
+		trace_get(glad_replay, &pname, sizeof(pname));
+		params = (GLfloat *)trace_scratch(glad_replay, 0, TRACE_SCRATCH_DEFAULT);
+		if(glad_replay->unsupported) return 0;
+		glad_glGetTexEnvfv(target, pname, params);
+	} break;
+	case 285: {
+		GLenum target;
+		GLenum pname;
+		GLint *params;
+		trace_get(glad_replay, &target, sizeof(target));
+		trace_get(glad_replay, &pname, sizeof(pname));
+		params = (GLint *)trace_scratch(glad_replay, 0, TRACE_SCRATCH_DEFAULT);
+		if(glad_replay->unsupported) return 0;
+		glad_glGetTexEnviv(target, pname, params);
+	} break;
+	case 286: {
+		GLenum coord;
+		GLenum pname;
+		GLdouble *params;
+		trace_get(glad_replay, &coord, sizeof(coord));
+		trace_get(glad_replay, &pname, sizeof(pname));
+		params = (GLdouble *)trace_scratch(glad_replay, 0, TRACE_SCRATCH_DEFAULT);
+		if(glad_replay->unsupported) return 0;
+		glad_glGetTexGendv(coord, pname, params);
+	} break;
+	case 287: {
+		GLenum coord;
+		GLenum pname;
+		GLfloat *params;
+		trace_get(glad_replay, &coord, sizeof(coord));
+		trace_get(glad_replay, &pname, sizeof(pname));
+		params = (GLfloat *)trace_scratch(glad_replay, 0, TRACE_SCRATCH_DEFAULT);
+		if(glad_replay->unsupported) return 0;
+		glad_glGetTexGenfv(coord, pname, params);
+	} break;
+	case 288: {
+		GLenum coord;
+		GLenum pname;
+		GLint *params;
+		trace_get(glad_replay, &coord, sizeof(coord));
+		trace_get(glad_replay, &pname, sizeof(pname));
+		params = (GLint *)trace_scratch(glad_replay, 0, TRACE_SCRATCH_DEFAULT);
+		if(glad_replay->unsupported) return 0;
+		glad_glGetTexGeniv(coord, pname, params);
+	} break;
+	case 289: {
+		GLuint list;
+		GLboolean glad_result;
+		GLboolean recorded_result;
+		trace_get(glad_replay, &list, sizeof(list));
+		trace_get(glad_replay, &recorded_result, sizeof(recorded_result));
+		if(glad_replay->unsupported) return 0;
+		glad_result = glad_glIsList(list);
+		(void)glad_result;
+		(void)recorded_result;
+	} break;
+	case 290: {
+		GLdouble left;
+		GLdouble right;
+		GLdouble bottom;
+		GLdouble top;
+		GLdouble zNear;
+		GLdouble zFar;
+		trace_get(glad_replay, &left, sizeof(left));
+		trace_get(glad_replay, &right, sizeof(right));
+		trace_get(glad_replay, &bottom, sizeof(bottom));
+		trace_get(glad_replay, &top, sizeof(top));
+		trace_get(glad_replay, &zNear, sizeof(zNear));
+		trace_get(glad_replay, &zFar, sizeof(zFar));
+		if(glad_replay->unsupported) return 0;
+		glad_glFrustum(left, right, bottom, top, zNear, zFar);
+	} break;
+	case 291: {
+		if(glad_replay->unsupported) return 0;
+		glad_glLoadIdentity();
+	} break;
+	case 292: {
+		const GLfloat *m;
+		trace_get_unsupported(glad_replay);
+		m = NULL;
+		if(glad_replay->unsupported) return 0;
+		glad_glLoadMatrixf(m);
+	} break;
+	case 293: {
+		const GLdouble *m;
+		trace_get_unsupported(glad_replay);
+		m = NULL;
+		if(glad_replay->unsupported) return 0;
+		glad_glLoadMatrixd(m);
+	} break;
+	case 294: {
+		GLenum mode;
+		trace_get(glad_replay, &mode, sizeof(mode));
+		if(glad_replay->unsupported) return 0;
+		glad_glMatrixMode(mode);
+	} break;
+	case 295: {
+		const GLfloat *m;
+		trace_get_unsupported(glad_replay);
+		m = NULL;
+		if(glad_replay->unsupported) return 0;
+		glad_glMultMatrixf(m);
+	} break;
+	case 296: {
+		const GLdouble *m;
+		trace_get_unsupported(glad_replay);
+		m = NULL;
+		if(glad_replay->unsupported) return 0;
+		glad_glMultMatrixd(m);
+	} break;
+	case 297: {
+		GLdouble left;
+		GLdouble right;
+		GLdouble bottom;
+		GLdouble top;
+		GLdouble zNear;
+		GLdouble zFar;
+		trace_get(glad_replay, &left, sizeof(left));
+		trace_get(glad_replay, &right, sizeof(right));
+		trace_get(glad_replay, &bottom, sizeof(bottom));
+		trace_get(glad_replay, &top, sizeof(top));
+		trace_get(glad_replay, &zNear, sizeof(zNear));
+		trace_get(glad_replay, &zFar, sizeof(zFar));
+		if(glad_replay->unsupported) return 0;
+		glad_glOrtho(left, right, bottom, top, zNear, zFar);
+	} break;
+	case 298: {
+		if(glad_replay->unsupported) return 0;
+		glad_glPopMatrix();
+	} break;
+	case 299: {
+		if(glad_replay->unsupported) return 0;
+		glad_glPushMatrix();
+	} break;
+	case 300: {
+		GLdouble angle;
+		GLdouble x;
+		GLdouble y;
+		GLdouble z;
+		trace_get(glad_replay, &angle, sizeof(angle));
+		trace_get(glad_replay, &x, sizeof(x));
+		trace_get(glad_replay, &y, sizeof(y));
+		trace_get(glad_replay, &z, sizeof(z));
+		if(glad_replay->unsupported) return 0;
+		glad_glRotated(angle, x, y, z);
+	} break;
+	case 301: {
+		GLfloat angle;
+		GLfloat x;
+		GLfloat y;
+		GLfloat z;
+		trace_get(glad_replay, &angle, sizeof(angle));
+		trace_get(glad_replay, &x, sizeof(x));
+		trace_get(glad_replay, &y, sizeof(y));
+		trace_get(glad_replay, &z, sizeof(z));
+		if(glad_replay->unsupported) return 0;
+		glad_glRotatef(angle, x, y, z);
+	} break;
+	case 302: {
+		GLdouble x;
+		GLdouble y;
+		GLdouble z;
+		trace_get(glad_replay, &x, sizeof(x));
+		trace_get(glad_replay, &y, sizeof(y));
+		trace_get(glad_replay, &z, sizeof(z));
+		if(glad_replay->unsupported) return 0;
+		glad_glScaled(x, y, z);
+	} break;
+	case 303: {
+		GLfloat x;
+		GLfloat y;
+		GLfloat z;
+		trace_get(glad_replay, &x, sizeof(x));
+		trace_get(glad_replay, &y, sizeof(y));
+		trace_get(glad_replay, &z, sizeof(z));
+		if(glad_replay->unsupported) return 0;
+		glad_glScalef(x, y, z);
+	} break;
+	case 304: {
+		GLdouble x;
+		GLdouble y;
+		GLdouble z;
+		trace_get(glad_replay, &x, sizeof(x));
+		trace_get(glad_replay, &y, sizeof(y));
+		trace_get(glad_replay, &z, sizeof(z));
+		if(glad_replay->unsupported) return 0;
+		glad_glTranslated(x, y, z);
+	} break;
+	case 305: {
+		GLfloat x;
+		GLfloat y;
+		GLfloat z;
+		trace_get(glad_replay, &x, sizeof(x));
+		trace_get(glad_replay, &y, sizeof(y));
+		trace_get(glad_replay, &z, sizeof(z));
+		if(glad_replay->unsupported) return 0;
+		glad_glTranslatef(x, y, z);
+	} break;
+	case 306: {
+		GLenum mode;
+		GLint first;
+		GLsizei count;
+		trace_get(glad_replay, &mode, sizeof(mode));
+		trace_get(glad_replay, &first, sizeof(first));
+		trace_get(glad_replay, &count, sizeof(count));
+		if(glad_replay->unsupported) return 0;
+		glad_glDrawArrays(mode, first, count);
+	} break;
+	case 307: {
+		GLenum mode;
+		GLsizei count;
+		GLenum type;
+		const void *indices;
+		trace_get(glad_replay, &mode, sizeof(mode));
+		trace_get(glad_replay, &count, sizeof(count));
+		trace_get(glad_replay, &type, sizeof(type));
+		indices = trace_get_offset(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glDrawElements(mode, count, type, indices);
+	} break;
+	case 308: {
+		GLenum pname;
+		void **params;
+		trace_get(glad_replay, &pname, sizeof(pname));
+		params = NULL;
+		glad_replay->unsupported = 1;
+		if(glad_replay->unsupported) return 0;
+		glad_glGetPointerv(pname, params);
+	} break;
+	case 309: {
+		GLfloat factor;
+		GLfloat units;
+		trace_get(glad_replay, &factor, sizeof(factor));
+		trace_get(glad_replay, &units, sizeof(units));
+		if(glad_replay->unsupported) return 0;
+		glad_glPolygonOffset(factor, units);
+	} break;
+	case 310: {
+		GLenum target;
+		GLint level;
+		GLenum internalformat;
+		GLint x;
+		GLint y;
+		GLsizei width;
+		GLint border;
+		trace_get(glad_replay, &target, sizeof(target));
+		trace_get(glad_replay, &level, sizeof(level));
+		trace_get(glad_replay, &internalformat, sizeof(internalformat));
+		trace_get(glad_replay, &x, sizeof(x));
+		trace_get(glad_replay, &y, sizeof(y));
+		trace_get(glad_replay, &width, sizeof(width));
+		trace_get(glad_replay, &border, sizeof(border));
+		if(glad_replay->unsupported) return 0;
+		glad_glCopyTexImage1D(target, level, internalformat, x, y, width, border);
+	} break;
+	case 311: {
+		GLenum target;
+		GLint level;
+		GLenum internalformat;
+		GLint x;
+		GLint y;
+		GLsizei width;
+		GLsizei height;
+		GLint border;
+		trace_get(glad_replay, &target, sizeof(target));
+		trace_get(glad_replay, &level, sizeof(level));
+		trace_get(glad_replay, &internalformat, sizeof(internalformat));
+		trace_get(glad_replay, &x, sizeof(x));
+		trace_get(glad_replay, &y, sizeof(y));
+		trace_get(glad_replay, &width, sizeof(width));
+		trace_get(glad_replay, &height, sizeof(height));
+		trace_get(glad_replay, &border, sizeof(border));
+		if(glad_replay->unsupported) return 0;
+		glad_glCopyTexImage2D(target, level, internalformat, x, y, width, height, border);
+	} break;
+	case 312: {
+		GLenum target;
+		GLint level;
+		GLint xoffset;
+		GLint x;
+		GLint y;
+		GLsizei width;
+		trace_get(glad_replay, &target, sizeof(target));
+		trace_get(glad_replay, &level, sizeof(level));
+		trace_get(glad_replay, &xoffset, sizeof(xoffset));
+		trace_get(glad_replay, &x, sizeof(x));
+		trace_get(glad_replay, &y, sizeof(y));
+		trace_get(glad_replay, &width, sizeof(width));
+		if(glad_replay->unsupported) return 0;
+		glad_glCopyTexSubImage1D(target, level, xoffset, x, y, width);
+	} break;
+	case 313: {
+		GLenum target;
+		GLint level;
+		GLint xoffset;
+		GLint yoffset;
+		GLint x;
+		GLint y;
+		GLsizei width;
+		GLsizei height;
+		trace_get(glad_replay, &target, sizeof(target));
+		trace_get(glad_replay, &level, sizeof(level));
+		trace_get(glad_replay, &xoffset, sizeof(xoffset));
+		trace_get(glad_replay, &yoffset, sizeof(yoffset));
+		trace_get(glad_replay, &x, sizeof(x));
+		trace_get(glad_replay, &y, sizeof(y));
+		trace_get(glad_replay, &width, sizeof(width));
+		trace_get(glad_replay, &height, sizeof(height));
+		if(glad_replay->unsupported) return 0;
+		glad_glCopyTexSubImage2D(target, level, xoffset, yoffset, x, y, width, height);
+	} break;
+	case 314: {
+		GLenum target;
+		GLint level;
+		GLint xoffset;
+		GLsizei width;
+		GLenum format;
+		GLenum type;
+		const void *pixels;
+		trace_get(glad_replay, &target, sizeof(target));
+		trace_get(glad_replay, &level, sizeof(level));
+		trace_get(glad_replay, &xoffset, sizeof(xoffset));
+		trace_get(glad_replay, &width, sizeof(width));
+		trace_get(glad_replay, &format, sizeof(format));
+		trace_get(glad_replay, &type, sizeof(type));
+		pixels = (const void *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glTexSubImage1D(target, level, xoffset, width, format, type, pixels);
+	} break;
+	case 315: {
+		GLenum target;
+		GLint level;
+		GLint xoffset;
+		GLint yoffset;
+		GLsizei width;
+		GLsizei height;
+		GLenum format;
+		GLenum type;
+		const void *pixels;
+		trace_get(glad_replay, &target, sizeof(target));
+		trace_get(glad_replay, &level, sizeof(level));
+		trace_get(glad_replay, &xoffset, sizeof(xoffset));
+		trace_get(glad_replay, &yoffset, sizeof(yoffset));
+		trace_get(glad_replay, &width, sizeof(width));
+		trace_get(glad_replay, &height, sizeof(height));
+		trace_get(glad_replay, &format, sizeof(format));
+		trace_get(glad_replay, &type, sizeof(type));
+		pixels = (const void *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glTexSubImage2D(target, level, xoffset, yoffset, width, height, format, type, pixels);
+	} break;
+	case 316: {
+		GLenum target;
+		GLuint texture;
+		trace_get(glad_replay, &target, sizeof(target));
+		trace_get(glad_replay, &texture, sizeof(texture));
+		texture = trace_map_name(glad_replay, TRACE_NS_TEXTURE, texture);
+		if(glad_replay->unsupported) return 0;
+		glad_glBindTexture(target, texture);
+	} break;
+	case 317: {
+		GLsizei n;
+		const GLuint *recorded_textures;
+		GLuint *textures;
+		trace_get(glad_replay, &n, sizeof(n));
+		recorded_textures = (const GLuint *)trace_get_data(glad_replay);
+		textures = trace_map_names(glad_replay, 0, TRACE_NS_TEXTURE, recorded_textures, n);
+		if(glad_replay->unsupported) return 0;
+		glad_glDeleteTextures(n, textures);
+		trace_unbind_names(glad_replay, TRACE_NS_TEXTURE, recorded_textures, n);
+	} break;
+	case 318: {
+		GLsizei n;
+		const GLuint *recorded_textures;
+		GLuint *textures;
+		trace_get(glad_replay, &n, sizeof(n));
+		recorded_textures = (const GLuint *)trace_get_data(glad_replay);
+		textures = (GLuint *)trace_scratch(glad_replay, 0, (size_t)n * sizeof(GLuint));
+		if(glad_replay->unsupported) return 0;
+		if(!trace_names_bound(glad_replay, TRACE_NS_TEXTURE, recorded_textures, n)) {
+			glad_glGenTextures(n, textures);
+			trace_bind_names(glad_replay, TRACE_NS_TEXTURE, recorded_textures, textures, n);
+		}
+	} break;
+	case 319: {
+		GLuint texture;
+		GLboolean glad_result;
+		GLboolean recorded_result;
+		trace_get(glad_replay, &texture, sizeof(texture));
+		texture = trace_map_name(glad_replay, TRACE_NS_TEXTURE, texture);
+		trace_get(glad_replay, &recorded_result, sizeof(recorded_result));
+		if(glad_replay->unsupported) return 0;
+		glad_result = glad_glIsTexture(texture);
+		(void)glad_result;
+		(void)recorded_result;
+	} break;
+	case 320: {
+		GLint i;
+		trace_get(glad_replay, &i, sizeof(i));
+		if(glad_replay->unsupported) return 0;
+		glad_glArrayElement(i);
+	} break;
+	case 321: {
+		GLint size;
+		GLenum type;
+		GLsizei stride;
+		const void *pointer;
+		trace_get(glad_replay, &size, sizeof(size));
+		trace_get(glad_replay, &type, sizeof(type));
+		trace_get(glad_replay, &stride, sizeof(stride));
+		trace_get_unsupported(glad_replay);
+		pointer = NULL;
+		if(glad_replay->unsupported) return 0;
+		glad_glColorPointer(size, type, stride, pointer);
+	} break;
+	case 322: {
+		GLenum array;
+		trace_get(glad_replay, &array, sizeof(array));
+		if(glad_replay->unsupported) return 0;
+		glad_glDisableClientState(array);
+	} break;
+	case 323: {
+		GLsizei stride;
+		const void *pointer;
+		trace_get(glad_replay, &stride, sizeof(stride));
+		trace_get_unsupported(glad_replay);
+		pointer = NULL;
+		if(glad_replay->unsupported) return 0;
+		glad_glEdgeFlagPointer(stride, pointer);
+	} break;
+	case 324: {
+		GLenum array;
+		trace_get(glad_replay, &array, sizeof(array));
+		if(glad_replay->unsupported) return 0;
+		glad_glEnableClientState(array);
+	} break;
+	case 325: {
+		GLenum type;
+		GLsizei stride;
+		const void *pointer;
+		trace_get(glad_replay, &type, sizeof(type));
+		trace_get(glad_replay, &stride, sizeof(stride));
+		trace_get_unsupported(glad_replay);
+		pointer = NULL;
+		if(glad_replay->unsupported) return 0;
+		glad_glIndexPointer(type, stride, pointer);
+	} break;
+	case 326: {
+		GLenum format;
+		GLsizei stride;
+		const void *pointer;
+		trace_get(glad_replay, &format, sizeof(format));
+		trace_get(glad_replay, &stride, sizeof(stride));
+		trace_get_unsupported(glad_replay);
+		pointer = NULL;
+		if(glad_replay->unsupported) return 0;
+		glad_glInterleavedArrays(format, stride, pointer);
+	} break;
+	case 327: {
+		GLenum type;
+		GLsizei stride;
+		const void *pointer;
+		trace_get(glad_replay, &type, sizeof(type));
+		trace_get(glad_replay, &stride, sizeof(stride));
+		trace_get_unsupported(glad_replay);
+		pointer = NULL;
+		if(glad_replay->unsupported) return 0;
+		glad_glNormalPointer(type, stride, pointer);
+	} break;
+	case 328: {
+		GLint size;
+		GLenum type;
+		GLsizei stride;
+		const void *pointer;
+		trace_get(glad_replay, &size, sizeof(size));
+		trace_get(glad_replay, &type, sizeof(type));
+		trace_get(glad_replay, &stride, sizeof(stride));
+		trace_get_unsupported(glad_replay);
+		pointer = NULL;
+		if(glad_replay->unsupported) return 0;
+		glad_glTexCoordPointer(size, type, stride, pointer);
+	} break;
+	case 329: {
+		GLint size;
+		GLenum type;
+		GLsizei stride;
+		const void *pointer;
+		trace_get(glad_replay, &size, sizeof(size));
+		trace_get(glad_replay, &type, sizeof(type));
+		trace_get(glad_replay, &stride, sizeof(stride));
+		trace_get_unsupported(glad_replay);
+		pointer = NULL;
+		if(glad_replay->unsupported) return 0;
+		glad_glVertexPointer(size, type, stride, pointer);
+	} break;
+	case 330: {
+		GLsizei n;
+		const GLuint *textures;
+		GLboolean *residences;
+		GLboolean glad_result;
+		GLboolean recorded_result;
+		trace_get(glad_replay, &n, sizeof(n));
+		trace_get_unsupported(glad_replay);
+		textures = NULL;
+		residences = (GLboolean *)trace_scratch(glad_replay, 0, TRACE_SCRATCH_DEFAULT);
+		trace_get(glad_replay, &recorded_result, sizeof(recorded_result));
+		if(glad_replay->unsupported) return 0;
+		glad_result = glad_glAreTexturesResident(n, textures, residences);
+		(void)glad_result;
+		(void)recorded_result;
+	} break;
+	case 331: {
+		GLsizei n;
+		const GLuint *textures;
+		const GLfloat *priorities;
+		trace_get(glad_replay, &n, sizeof(n));
+		trace_get_unsupported(glad_replay);
+		textures = NULL;
+		trace_get_unsupported(glad_replay);
+		priorities = NULL;
+		if(glad_replay->unsupported) return 0;
+		glad_glPrioritizeTextures(n, textures, priorities);
+	} break;
+	case 332: {
+		GLubyte c;
+		trace_get(glad_replay, &c, sizeof(c));
+		if(glad_replay->unsupported) return 0;
+		glad_glIndexub(c);
+	} break;
+	case 333: {
+		const GLubyte *c;
+		trace_get_unsupported(glad_replay);
+		c = NULL;
+		if(glad_replay->unsupported) return 0;
+		glad_glIndexubv(c);
+	} break;
+	case 334: {
+		if(glad_replay->unsupported) return 0;
+		glad_glPopClientAttrib();
+	} break;
+	case 335: {
+		GLbitfield mask;
+		trace_get(glad_replay, &mask, sizeof(mask));
+		if(glad_replay->unsupported) return 0;
+		glad_glPushClientAttrib(mask);
+	} break;
+	case 336: {
+		GLenum mode;
+		GLuint start;
+		GLuint end;
+		GLsizei count;
+		GLenum type;
+		const void *indices;
+		trace_get(glad_replay, &mode, sizeof(mode));
+		trace_get(glad_replay, &start, sizeof(start));
+		trace_get(glad_replay, &end, sizeof(end));
+		trace_get(glad_replay, &count, sizeof(count));
+		trace_get(glad_replay, &type, sizeof(type));
+		indices = trace_get_offset(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glDrawRangeElements(mode, start, end, count, type, indices);
+	} break;
+	case 337: {
+		GLenum target;
+		GLint level;
+		GLint internalformat;
+		GLsizei width;
+		GLsizei height;
+		GLsizei depth;
+		GLint border;
+		GLenum format;
+		GLenum type;
+		const void *pixels;
+		trace_get(glad_replay, &target, sizeof(target));
+		trace_get(glad_replay, &level, sizeof(level));
+		trace_get(glad_replay, &internalformat, sizeof(internalformat));
+		trace_get(glad_replay, &width, sizeof(width));
+		trace_get(glad_replay, &height, sizeof(height));
+		trace_get(glad_replay, &depth, sizeof(depth));
+		trace_get(glad_replay, &border, sizeof(border));
+		trace_get(glad_replay, &format, sizeof(format));
+		trace_get(glad_replay, &type, sizeof(type));
+		pixels = (const void *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glTexImage3D(target, level, internalformat, width, height, depth, border, format, type, pixels);
+	} break;
+	case 338: {
+		GLenum target;
+		GLint level;
+		GLint xoffset;
+		GLint yoffset;
+		GLint zoffset;
+		GLsizei width;
+		GLsizei height;
+		GLsizei depth;
+		GLenum format;
+		GLenum type;
+		const void *pixels;
+		trace_get(glad_replay, &target, sizeof(target));
+		trace_get(glad_replay, &level, sizeof(level));
+		trace_get(glad_replay, &xoffset, sizeof(xoffset));
+		trace_get(glad_replay, &yoffset, sizeof(yoffset));
+		trace_get(glad_replay, &zoffset, sizeof(zoffset));
+		trace_get(glad_replay, &width, sizeof(width));
+		trace_get(glad_replay, &height, sizeof(height));
+		trace_get(glad_replay, &depth, sizeof(depth));
+		trace_get(glad_replay, &format, sizeof(format));
+		trace_get(glad_replay, &type, sizeof(type));
+		pixels = (const void *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glTexSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
+	} break;
+	case 339: {
+		GLenum target;
+		GLint level;
+		GLint xoffset;
+		GLint yoffset;
+		GLint zoffset;
+		GLint x;
+		GLint y;
+		GLsizei width;
+		GLsizei height;
+		trace_get(glad_replay, &target, sizeof(target));
+		trace_get(glad_replay, &level, sizeof(level));
+		trace_get(glad_replay, &xoffset, sizeof(xoffset));
+		trace_get(glad_replay, &yoffset, sizeof(yoffset));
+		trace_get(glad_replay, &zoffset, sizeof(zoffset));
+		trace_get(glad_replay, &x, sizeof(x));
+		trace_get(glad_replay, &y, sizeof(y));
+		trace_get(glad_replay, &width, sizeof(width));
+		trace_get(glad_replay, &height, sizeof(height));
+		if(glad_replay->unsupported) return 0;
+		glad_glCopyTexSubImage3D(target, level, xoffset, yoffset, zoffset, x, y, width, height);
+	} break;
+	case 340: {
+		GLenum texture;
+		trace_get(glad_replay, &texture, sizeof(texture));
+		if(glad_replay->unsupported) return 0;
+		glad_glActiveTexture(texture);
+	} break;
+	case 341: {
+		GLfloat value;
+		GLboolean invert;
+		trace_get(glad_replay, &value, sizeof(value));
+		trace_get(glad_replay, &invert, sizeof(invert));
+		if(glad_replay->unsupported) return 0;
+		glad_glSampleCoverage(value, invert);
+	} break;
+	case 342: {
+		GLenum target;
+		GLint level;
+		GLenum internalformat;
+		GLsizei width;
+		GLsizei height;
+		GLsizei depth;
+		GLint border;
+		GLsizei imageSize;
+		const void *data;
+		trace_get(glad_replay, &target, sizeof(target));
+		trace_get(glad_replay, &level, sizeof(level));
+		trace_get(glad_replay, &internalformat, sizeof(internalformat));
+		trace_get(glad_replay, &width, sizeof(width));
+		trace_get(glad_replay, &height, sizeof(height));
+		trace_get(glad_replay, &depth, sizeof(depth));
+		trace_get(glad_replay, &border, sizeof(border));
+		trace_get(glad_replay, &imageSize, sizeof(imageSize));
+		data = (const void *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glCompressedTexImage3D(target, level, internalformat, width, height, depth, border, imageSize, data);
+	} break;
+	case 343: {
+		GLenum target;
+		GLint level;
+		GLenum internalformat;
+		GLsizei width;
+		GLsizei height;
+		GLint border;
+		GLsizei imageSize;
+		const void *data;
+		trace_get(glad_replay, &target, sizeof(target));
+		trace_get(glad_replay, &level, sizeof(level));
+		trace_get(glad_replay, &internalformat, sizeof(internalformat));
+		trace_get(glad_replay, &width, sizeof(width));
+		trace_get(glad_replay, &height, sizeof(height));
+		trace_get(glad_replay, &border, sizeof(border));
+		trace_get(glad_replay, &imageSize, sizeof(imageSize));
+		data = (const void *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glCompressedTexImage2D(target, level, internalformat, width, height, border, imageSize, data);
+	} break;
+	case 344: {
+		GLenum target;
+		GLint level;
+		GLenum internalformat;
+		GLsizei width;
+		GLint border;
+		GLsizei imageSize;
+		const void *data;
+		trace_get(glad_replay, &target, sizeof(target));
+		trace_get(glad_replay, &level, sizeof(level));
+		trace_get(glad_replay, &internalformat, sizeof(internalformat));
+		trace_get(glad_replay, &width, sizeof(width));
+		trace_get(glad_replay, &border, sizeof(border));
+		trace_get(glad_replay, &imageSize, sizeof(imageSize));
+		data = (const void *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glCompressedTexImage1D(target, level, internalformat, width, border, imageSize, data);
+	} break;
+	case 345: {
+		GLenum target;
+		GLint level;
+		GLint xoffset;
+		GLint yoffset;
+		GLint zoffset;
+		GLsizei width;
+		GLsizei height;
+		GLsizei depth;
+		GLenum format;
+		GLsizei imageSize;
+		const void *data;
+		trace_get(glad_replay, &target, sizeof(target));
+		trace_get(glad_replay, &level, sizeof(level));
+		trace_get(glad_replay, &xoffset, sizeof(xoffset));
+		trace_get(glad_replay, &yoffset, sizeof(yoffset));
+		trace_get(glad_replay, &zoffset, sizeof(zoffset));
+		trace_get(glad_replay, &width, sizeof(width));
+		trace_get(glad_replay, &height, sizeof(height));
+		trace_get(glad_replay, &depth, sizeof(depth));
+		trace_get(glad_replay, &format, sizeof(format));
+		trace_get(glad_replay, &imageSize, sizeof(imageSize));
+		data = (const void *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glCompressedTexSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
+	} break;
+	case 346: {
+		GLenum target;
+		GLint level;
+		GLint xoffset;
+		GLint yoffset;
+		GLsizei width;
+		GLsizei height;
+		GLenum format;
+		GLsizei imageSize;
+		const void *data;
+		trace_get(glad_replay, &target, sizeof(target));
+		trace_get(glad_replay, &level, sizeof(level));
+		trace_get(glad_replay, &xoffset, sizeof(xoffset));
+		trace_get(glad_replay, &yoffset, sizeof(yoffset));
+		trace_get(glad_replay, &width, sizeof(width));
+		trace_get(glad_replay, &height, sizeof(height));
+		trace_get(glad_replay, &format, sizeof(format));
+		trace_get(glad_replay, &imageSize, sizeof(imageSize));
+		data = (const void *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glCompressedTexSubImage2D(target, level, xoffset, yoffset, width, height, format, imageSize, data);
+	} break;
+	case 347: {
+		GLenum target;
+		GLint level;
+		GLint xoffset;
+		GLsizei width;
+		GLenum format;
+		GLsizei imageSize;
+		const void *data;
+		trace_get(glad_replay, &target, sizeof(target));
+		trace_get(glad_replay, &level, sizeof(level));
+		trace_get(glad_replay, &xoffset, sizeof(xoffset));
+		trace_get(glad_replay, &width, sizeof(width));
+		trace_get(glad_replay, &format, sizeof(format));
+		trace_get(glad_replay, &imageSize, sizeof(imageSize));
+		data = (const void *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glCompressedTexSubImage1D(target, level, xoffset, width, format, imageSize, data);
+	} break;
+	case 348: {
+		GLenum target;
+		GLint level;
+		void *img;
+		trace_get(glad_replay, &target, sizeof(target));
+		trace_get(glad_replay, &level, sizeof(level));
+		img = NULL;
+		glad_replay->unsupported = 1;
+		if(glad_replay->unsupported) return 0;
+		glad_glGetCompressedTexImage(target, level, img);
+	} break;
+	case 349: {
+		GLenum texture;
+		trace_get(glad_replay, &texture, sizeof(texture));
+		if(glad_replay->unsupported) return 0;
+		glad_glClientActiveTexture(texture);
+	} break;
+	case 350: {
+		GLenum target;
+		GLdouble s;
+		trace_get(glad_replay, &target, sizeof(target));
+		trace_get(glad_replay, &s, sizeof(s));
+		if(glad_replay->unsupported) return 0;
+		glad_glMultiTexCoord1d(target, s);
+	} break;
+	case 351: {
+		GLenum target;
+		const GLdouble *v;
+		trace_get(glad_replay, &target, sizeof(target));
+		v = (const GLdouble *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glMultiTexCoord1dv(target, v);
+	} break;
+	case 352: {
+		GLenum target;
+		GLfloat s;
+		trace_get(glad_replay, &target, sizeof(target));
+		trace_get(glad_replay, &s, sizeof(s));
+		if(glad_replay->unsupported) return 0;
+		glad_glMultiTexCoord1f(target, s);
+	} break;
+	case 353: {
+		GLenum target;
+		const GLfloat *v;
+		trace_get(glad_replay, &target, sizeof(target));
+		v = (const GLfloat *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glMultiTexCoord1fv(target, v);
+	} break;
+	case 354: {
+		GLenum target;
+		GLint s;
+		trace_get(glad_replay, &target, sizeof(target));
+		trace_get(glad_replay, &s, sizeof(s));
+		if(glad_replay->unsupported) return 0;
+		glad_glMultiTexCoord1i(target, s);
+	} break;
+	case 355: {
+		GLenum target;
+		const GLint *v;
+		trace_get(glad_replay, &target, sizeof(target));
+		v = (const GLint *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glMultiTexCoord1iv(target, v);
+	} break;
+	case 356: {
+		GLenum target;
+		GLshort s;
+		trace_get(glad_replay, &target, sizeof(target));
+		trace_get(glad_replay, &s, sizeof(s));
+		if(glad_replay->unsupported) return 0;
+		glad_glMultiTexCoord1s(target, s);
+	} break;
+	case 357: {
+		GLenum target;
+		const GLshort *v;
+		trace_get(glad_replay, &target, sizeof(target));
+		v = (const GLshort *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glMultiTexCoord1sv(target, v);
+	} break;
+	case 358: {
+		GLenum target;
+		GLdouble s;
+		GLdouble t;
+		trace_get(glad_replay, &target, sizeof(target));
+		trace_get(glad_replay, &s, sizeof(s));
+		trace_get(glad_replay, &t, sizeof(t));
+		if(glad_replay->unsupported) return 0;
+		glad_glMultiTexCoord2d(target, s, t);
+	} break;
+	case 359: {
+		GLenum target;
+		const GLdouble *v;
+		trace_get(glad_replay, &target, sizeof(target));
+		v = (const GLdouble *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glMultiTexCoord2dv(target, v);
+	} break;
+	case 360: {
+		GLenum target;
+		GLfloat s;
+		GLfloat t;
+		trace_get(glad_replay, &target, sizeof(target));
+		trace_get(glad_replay, &s, sizeof(s));
+		trace_get(glad_replay, &t, sizeof(t));
+		if(glad_replay->unsupported) return 0;
+		glad_glMultiTexCoord2f(target, s, t);
+	} break;
+	case 361: {
+		GLenum target;
+		const GLfloat *v;
+		trace_get(glad_replay, &target, sizeof(target));
+		v = (const GLfloat *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glMultiTexCoord2fv(target, v);
+	} break;
+	case 362: {
+		GLenum target;
+		GLint s;
+		GLint t;
+		trace_get(glad_replay, &target, sizeof(target));
+		trace_get(glad_replay, &s, sizeof(s));
+		trace_get(glad_replay, &t, sizeof(t));
+		if(glad_replay->unsupported) return 0;
+		glad_glMultiTexCoord2i(target, s, t);
+	} break;
+	case 363: {
+		GLenum target;
+		const GLint *v;
+		trace_get(glad_replay, &target, sizeof(target));
+		v = (const GLint *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glMultiTexCoord2iv(target, v);
+	} break;
+	case 364: {
+		GLenum target;
+		GLshort s;
+		GLshort t;
+		trace_get(glad_replay, &target, sizeof(target));
+		trace_get(glad_replay, &s, sizeof(s));
+		trace_get(glad_replay, &t, sizeof(t));
+		if(glad_replay->unsupported) return 0;
+		glad_glMultiTexCoord2s(target, s, t);
+	} break;
+	case 365: {
+		GLenum target;
+		const GLshort *v;
+		trace_get(glad_replay, &target, sizeof(target));
+		v = (const GLshort *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glMultiTexCoord2sv(target, v);
+	} break;
+	case 366: {
+		GLenum target;
+		GLdouble s;
+		GLdouble t;
+		GLdouble r;
+		trace_get(glad_replay, &target, sizeof(target));
+		trace_get(glad_replay, &s, sizeof(s));
+		trace_get(glad_replay, &t, sizeof(t));
+		trace_get(glad_replay, &r, sizeof(r));
+		if(glad_replay->unsupported) return 0;
+		glad_glMultiTexCoord3d(target, s, t, r);
+	} break;
+	case 367: {
+		GLenum target;
+		const GLdouble *v;
+		trace_get(glad_replay, &target, sizeof(target));
+		v = (const GLdouble *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glMultiTexCoord3dv(target, v);
+	} break;
+	case 368: {
+		GLenum target;
+		GLfloat s;
+		GLfloat t;
+		GLfloat r;
+		trace_get(glad_replay, &target, sizeof(target));
+		trace_get(glad_replay, &s, sizeof(s));
+		trace_get(glad_replay, &t, sizeof(t));
+		trace_get(glad_replay, &r, sizeof(r));
+		if(glad_replay->unsupported) return 0;
+		glad_glMultiTexCoord3f(target, s, t, r);
+	} break;
+	case 369: {
+		GLenum target;
+		const GLfloat *v;
+		trace_get(glad_replay, &target, sizeof(target));
+		v = (const GLfloat *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glMultiTexCoord3fv(target, v);
+	} break;
+	case 370: {
+		GLenum target;
+		GLint s;
+		GLint t;
+		GLint r;
+		trace_get(glad_replay, &target, sizeof(target));
+		trace_get(glad_replay, &s, sizeof(s));
+		trace_get(glad_replay, &t, sizeof(t));
+		trace_get(glad_replay, &r, sizeof(r));
+		if(glad_replay->unsupported) return 0;
+		glad_glMultiTexCoord3i(target, s, t, r);
+	} break;
+	case 371: {
+		GLenum target;
+		const GLint *v;
+		trace_get(glad_replay, &target, sizeof(target));
+		v = (const GLint *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glMultiTexCoord3iv(target, v);
+	} break;
+	case 372: {
+		GLenum target;
+		GLshort s;
+		GLshort t;
+		GLshort r;
+		trace_get(glad_replay, &target, sizeof(target));
+		trace_get(glad_replay, &s, sizeof(s));
+		trace_get(glad_replay, &t, sizeof(t));
+		trace_get(glad_replay, &r, sizeof(r));
+		if(glad_replay->unsupported) return 0;
+		glad_glMultiTexCoord3s(target, s, t, r);
+	} break;
+	case 373: {
+		GLenum target;
+		const GLshort *v;
+		trace_get(glad_replay, &target, sizeof(target));
+		v = (const GLshort *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glMultiTexCoord3sv(target, v);
+	} break;
+	case 374: {
+		GLenum target;
+		GLdouble s;
+		GLdouble t;
+		GLdouble r;
+		GLdouble q;
+		trace_get(glad_replay, &target, sizeof(target));
+		trace_get(glad_replay, &s, sizeof(s));
+		trace_get(glad_replay, &t, sizeof(t));
+		trace_get(glad_replay, &r, sizeof(r));
+		trace_get(glad_replay, &q, sizeof(q));
+		if(glad_replay->unsupported) return 0;
+		glad_glMultiTexCoord4d(target, s, t, r, q);
+	} break;
+	case 375: {
+		GLenum target;
+		const GLdouble *v;
+		trace_get(glad_replay, &target, sizeof(target));
+		v = (const GLdouble *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glMultiTexCoord4dv(target, v);
+	} break;
+	case 376: {
+		GLenum target;
+		GLfloat s;
+		GLfloat t;
+		GLfloat r;
+		GLfloat q;
+		trace_get(glad_replay, &target, sizeof(target));
+		trace_get(glad_replay, &s, sizeof(s));
+		trace_get(glad_replay, &t, sizeof(t));
+		trace_get(glad_replay, &r, sizeof(r));
+		trace_get(glad_replay, &q, sizeof(q));
+		if(glad_replay->unsupported) return 0;
+		glad_glMultiTexCoord4f(target, s, t, r, q);
+	} break;
+	case 377: {
+		GLenum target;
+		const GLfloat *v;
+		trace_get(glad_replay, &target, sizeof(target));
+		v = (const GLfloat *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glMultiTexCoord4fv(target, v);
+	} break;
+	case 378: {
+		GLenum target;
+		GLint s;
+		GLint t;
+		GLint r;
+		GLint q;
+		trace_get(glad_replay, &target, sizeof(target));
+		trace_get(glad_replay, &s, sizeof(s));
+		trace_get(glad_replay, &t, sizeof(t));
+		trace_get(glad_replay, &r, sizeof(r));
+		trace_get(glad_replay, &q, sizeof(q));
+		if(glad_replay->unsupported) return 0;
+		glad_glMultiTexCoord4i(target, s, t, r, q);
+	} break;
+	case 379: {
+		GLenum target;
+		const GLint *v;
+		trace_get(glad_replay, &target, sizeof(target));
+		v = (const GLint *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glMultiTexCoord4iv(target, v);
+	} break;
+	case 380: {
+		GLenum target;
+		GLshort s;
+		GLshort t;
+		GLshort r;
+		GLshort q;
+		trace_get(glad_replay, &target, sizeof(target));
+		trace_get(glad_replay, &s, sizeof(s));
+		trace_get(glad_replay, &t, sizeof(t));
+		trace_get(glad_replay, &r, sizeof(r));
+		trace_get(glad_replay, &q, sizeof(q));
+		if(glad_replay->unsupported) return 0;
+		glad_glMultiTexCoord4s(target, s, t, r, q);
+	} break;
+	case 381: {
+		GLenum target;
+		const GLshort *v;
+		trace_get(glad_replay, &target, sizeof(target));
+		v = (const GLshort *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glMultiTexCoord4sv(target, v);
+	} break;
+	case 382: {
+		const GLfloat *m;
+		trace_get_unsupported(glad_replay);
+		m = NULL;
+		if(glad_replay->unsupported) return 0;
+		glad_glLoadTransposeMatrixf(m);
+	} break;
+	case 383: {
+		const GLdouble *m;
+		trace_get_unsupported(glad_replay);
+		m = NULL;
+		if(glad_replay->unsupported) return 0;
+		glad_glLoadTransposeMatrixd(m);
+	} break;
+	case 384: {
+		const GLfloat *m;
+		trace_get_unsupported(glad_replay);
+		m = NULL;
+		if(glad_replay->unsupported) return 0;
+		glad_glMultTransposeMatrixf(m);
+	} break;
+	case 385: {
+		const GLdouble *m;
+		trace_get_unsupported(glad_replay);
+		m = NULL;
+		if(glad_replay->unsupported) return 0;
+		glad_glMultTransposeMatrixd(m);
+	} break;
+	case 386: {
+		GLenum sfactorRGB;
+		GLenum dfactorRGB;
+		GLenum sfactorAlpha;
+		GLenum dfactorAlpha;
+		trace_get(glad_replay, &sfactorRGB, sizeof(sfactorRGB));
+		trace_get(glad_replay, &dfactorRGB, sizeof(dfactorRGB));
+		trace_get(glad_replay, &sfactorAlpha, sizeof(sfactorAlpha));
+		trace_get(glad_replay, &dfactorAlpha, sizeof(dfactorAlpha));
+		if(glad_replay->unsupported) return 0;
+		glad_glBlendFuncSeparate(sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha);
+	} break;
+	case 387: {
+		GLenum mode;
+		const GLint *first;
+		const GLsizei *count;
+		GLsizei drawcount;
+		trace_get(glad_replay, &mode, sizeof(mode));
+		first = (const GLint *)trace_get_data(glad_replay);
+		count = (const GLsizei *)trace_get_data(glad_replay);
+		trace_get(glad_replay, &drawcount, sizeof(drawcount));
+		if(glad_replay->unsupported) return 0;
+		glad_glMultiDrawArrays(mode, first, count, drawcount);
+	} break;
+	case 388: {
+		GLenum mode;
+		const GLsizei *count;
+		GLenum type;
+		const void *const*indices;
+		GLsizei drawcount;
+		trace_get(glad_replay, &mode, sizeof(mode));
+		trace_get_unsupported(glad_replay);
+		count = NULL;
+		trace_get(glad_replay, &type, sizeof(type));
+		trace_get_unsupported(glad_replay);
+		indices = NULL;
+		trace_get(glad_replay, &drawcount, sizeof(drawcount));
+		if(glad_replay->unsupported) return 0;
+		glad_glMultiDrawElements(mode, count, type, indices, drawcount);
+	} break;
+	case 389: {
+		GLenum pname;
+		GLfloat param;
+		trace_get(glad_replay, &pname, sizeof(pname));
+		trace_get(glad_replay, &param, sizeof(param));
+		if(glad_replay->unsupported) return 0;
+		glad_glPointParameterf(pname, param);
+	} break;
+	case 390: {
+		GLenum pname;
+		const GLfloat *params;
+		trace_get(glad_replay, &pname, sizeof(pname));
+		params = (const GLfloat *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glPointParameterfv(pname, params);
+	} break;
+	case 391: {
+		GLenum pname;
+		GLint param;
+		trace_get(glad_replay, &pname, sizeof(pname));
+		trace_get(glad_replay, &param, sizeof(param));
+		if(glad_replay->unsupported) return 0;
+		glad_glPointParameteri(pname, param);
+	} break;
+	case 392: {
+		GLenum pname;
+		const GLint *params;
+		trace_get(glad_replay, &pname, sizeof(pname));
+		params = (const GLint *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glPointParameteriv(pname, params);
+	} break;
+	case 393: {
+		GLfloat coord;
+		trace_get(glad_replay, &coord, sizeof(coord));
+		if(glad_replay->unsupported) return 0;
+		glad_glFogCoordf(coord);
+	} break;
+	case 394: {
+		const GLfloat *coord;
+		trace_get_unsupported(glad_replay);
+		coord = NULL;
+		if(glad_replay->unsupported) return 0;
+		glad_glFogCoordfv(coord);
+	} break;
+	case 395: {
+		GLdouble coord;
+		trace_get(glad_replay, &coord, sizeof(coord));
+		if(glad_replay->unsupported) return 0;
+		glad_glFogCoordd(coord);
+	} break;
+	case 396: {
+		const GLdouble *coord;
+		trace_get_unsupported(glad_replay);
+		coord = NULL;
+		if(glad_replay->unsupported) return 0;
+		glad_glFogCoorddv(coord);
+	} break;
+	case 397: {
+		GLenum type;
+		GLsizei stride;
+		const void *pointer;
+		trace_get(glad_replay, &type, sizeof(type));
+		trace_get(glad_replay, &stride, sizeof(stride));
+		trace_get_unsupported(glad_replay);
+		pointer = NULL;
+		if(glad_replay->unsupported) return 0;
+		glad_glFogCoordPointer(type, stride, pointer);
+	} break;
+	case 398: {
+		GLbyte red;
+		GLbyte green;
+		GLbyte blue;
+		trace_get(glad_replay, &red, sizeof(red));
+		trace_get(glad_replay, &green, sizeof(green));
+		trace_get(glad_replay, &blue, sizeof(blue));
+		if(glad_replay->unsupported) return 0;
+		glad_glSecondaryColor3b(red, green, blue);
+	} break;
+	case 399: {
+		const GLbyte *v;
+		v = (const GLbyte *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glSecondaryColor3bv(v);
+	} break;
+	case 400: {
+		GLdouble red;
+		GLdouble green;
+		GLdouble blue;
+		trace_get(glad_replay, &red, sizeof(red));
+		trace_get(glad_replay, &green, sizeof(green));
+		trace_get(glad_replay, &blue, sizeof(blue));
+		if(glad_replay->unsupported) return 0;
+		glad_glSecondaryColor3d(red, green, blue);
+	} break;
+	case 401: {
+		const GLdouble *v;
+		v = (const GLdouble *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glSecondaryColor3dv(v);
+	} break;
+	case 402: {
+		GLfloat red;
+		GLfloat green;
+		GLfloat blue;
+		trace_get(glad_replay, &red, sizeof(red));
+		trace_get(glad_replay, &green, sizeof(green));
+		trace_get(glad_replay, &blue, sizeof(blue));
+		if(glad_replay->unsupported) return 0;
+		glad_glSecondaryColor3f(red, green, blue);
+	} break;
+	case 403: {
+		const GLfloat *v;
+		v = (const GLfloat *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glSecondaryColor3fv(v);
+	} break;
+	case 404: {
+		GLint red;
+		GLint green;
+		GLint blue;
+		trace_get(glad_replay, &red, sizeof(red));
+		trace_get(glad_replay, &green, sizeof(green));
+		trace_get(glad_replay, &blue, sizeof(blue));
+		if(glad_replay->unsupported) return 0;
+		glad_glSecondaryColor3i(red, green, blue);
+	} break;
+	case 405: {
+		const GLint *v;
+		v = (const GLint *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glSecondaryColor3iv(v);
+	} break;
+	case 406: {
+		GLshort red;
+		GLshort green;
+		GLshort blue;
+		trace_get(glad_replay, &red, sizeof(red));
+		trace_get(glad_replay, &green, sizeof(green));
+		trace_get(glad_replay, &blue, sizeof(blue));
+		if(glad_replay->unsupported) return 0;
+		glad_glSecondaryColor3s(red, green, blue);
+	} break;
+	case 407: {
+		const GLshort *v;
+		v = (const GLshort *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glSecondaryColor3sv(v);
+	} break;
+	case 408: {
+		GLubyte red;
+		GLubyte green;
+		GLubyte blue;
+		trace_get(glad_replay, &red, sizeof(red));
+		trace_get(glad_replay, &green, sizeof(green));
+		trace_get(glad_replay, &blue, sizeof(blue));
+		if(glad_replay->unsupported) return 0;
+		glad_glSecondaryColor3ub(red, green, blue);
+	} break;
+	case 409: {
+		const GLubyte *v;
+		v = (const GLubyte *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glSecondaryColor3ubv(v);
+	} break;
+	case 410: {
+		GLuint red;
+		GLuint green;
+		GLuint blue;
+		trace_get(glad_replay, &red, sizeof(red));
+		trace_get(glad_replay, &green, sizeof(green));
+		trace_get(glad_replay, &blue, sizeof(blue));
+		if(glad_replay->unsupported) return 0;
+		glad_glSecondaryColor3ui(red, green, blue);
+	} break;
+	case 411: {
+		const GLuint *v;
+		v = (const GLuint *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glSecondaryColor3uiv(v);
+	} break;
+	case 412: {
+		GLushort red;
+		GLushort green;
+		GLushort blue;
+		trace_get(glad_replay, &red, sizeof(red));
+		trace_get(glad_replay, &green, sizeof(green));
+		trace_get(glad_replay, &blue, sizeof(blue));
+		if(glad_replay->unsupported) return 0;
+		glad_glSecondaryColor3us(red, green, blue);
+	} break;
+	case 413: {
+		const GLushort *v;
+		v = (const GLushort *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glSecondaryColor3usv(v);
+	} break;
+	case 414: {
+		GLint size;
+		GLenum type;
+		GLsizei stride;
+		const void *pointer;
+		trace_get(glad_replay, &size, sizeof(size));
+		trace_get(glad_replay, &type, sizeof(type));
+		trace_get(glad_replay, &stride, sizeof(stride));
+		trace_get_unsupported(glad_replay);
+		pointer = NULL;
+		if(glad_replay->unsupported) return 0;
+		glad_glSecondaryColorPointer(size, type, stride, pointer);
+	} break;
+	case 415: {
+		GLdouble x;
+		GLdouble y;
+		trace_get(glad_replay, &x, sizeof(x));
+		trace_get(glad_replay, &y, sizeof(y));
+		if(glad_replay->unsupported) return 0;
+		glad_glWindowPos2d(x, y);
+	} break;
+	case 416: {
+		const GLdouble *v;
+		v = (const GLdouble *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glWindowPos2dv(v);
+	} break;
+	case 417: {
+		GLfloat x;
+		GLfloat y;
+		trace_get(glad_replay, &x, sizeof(x));
+		trace_get(glad_replay, &y, sizeof(y));
+		if(glad_replay->unsupported) return 0;
+		glad_glWindowPos2f(x, y);
+	} break;
+	case 418: {
+		const GLfloat *v;
+		v = (const GLfloat *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glWindowPos2fv(v);
+	} break;
+	case 419: {
+		GLint x;
+		GLint y;
+		trace_get(glad_replay, &x, sizeof(x));
+		trace_get(glad_replay, &y, sizeof(y));
+		if(glad_replay->unsupported) return 0;
+		glad_glWindowPos2i(x, y);
+	} break;
+	case 420: {
+		const GLint *v;
+		v = (const GLint *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glWindowPos2iv(v);
+	} break;
+	case 421: {
+		GLshort x;
+		GLshort y;
+		trace_get(glad_replay, &x, sizeof(x));
+		trace_get(glad_replay, &y, sizeof(y));
+		if(glad_replay->unsupported) return 0;
+		glad_glWindowPos2s(x, y);
+	} break;
+	case 422: {
+		const GLshort *v;
+		v = (const GLshort *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glWindowPos2sv(v);
+	} break;
+	case 423: {
+		GLdouble x;
+		GLdouble y;
+		GLdouble z;
+		trace_get(glad_replay, &x, sizeof(x));
+		trace_get(glad_replay, &y, sizeof(y));
+		trace_get(glad_replay, &z, sizeof(z));
+		if(glad_replay->unsupported) return 0;
+		glad_glWindowPos3d(x, y, z);
+	} break;
+	case 424: {
+		const GLdouble *v;
+		v = (const GLdouble *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glWindowPos3dv(v);
+	} break;
+	case 425: {
+		GLfloat x;
+		GLfloat y;
+		GLfloat z;
+		trace_get(glad_replay, &x, sizeof(x));
+		trace_get(glad_replay, &y, sizeof(y));
+		trace_get(glad_replay, &z, sizeof(z));
+		if(glad_replay->unsupported) return 0;
+		glad_glWindowPos3f(x, y, z);
+	} break;
+	case 426: {
+		const GLfloat *v;
+		v = (const GLfloat *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glWindowPos3fv(v);
+	} break;
+	case 427: {
+		GLint x;
+		GLint y;
+		GLint z;
+		trace_get(glad_replay, &x, sizeof(x));
+		trace_get(glad_replay, &y, sizeof(y));
+		trace_get(glad_replay, &z, sizeof(z));
+		if(glad_replay->unsupported) return 0;
+		glad_glWindowPos3i(x, y, z);
+	} break;
+	case 428: {
+		const GLint *v;
+		v = (const GLint *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glWindowPos3iv(v);
+	} break;
+	case 429: {
+		GLshort x;
+		GLshort y;
+		GLshort z;
+		trace_get(glad_replay, &x, sizeof(x));
+		trace_get(glad_replay, &y, sizeof(y));
+		trace_get(glad_replay, &z, sizeof(z));
+		if(glad_replay->unsupported) return 0;
+		glad_glWindowPos3s(x, y, z);
+	} break;
+	case 430: {
+		const GLshort *v;
+		v = (const GLshort *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glWindowPos3sv(v);
+	} break;
+	case 431: {
+		GLfloat red;
+		GLfloat green;
+		GLfloat blue;
+		GLfloat alpha;
+		trace_get(glad_replay, &red, sizeof(red));
+		trace_get(glad_replay, &green, sizeof(green));
+		trace_get(glad_replay, &blue, sizeof(blue));
+		trace_get(glad_replay, &alpha, sizeof(alpha));
+		if(glad_replay->unsupported) return 0;
+		glad_glBlendColor(red, green, blue, alpha);
+	} break;
+	case 432: {
+		GLenum mode;
+		trace_get(glad_replay, &mode, sizeof(mode));
+		if(glad_replay->unsupported) return 0;
+		glad_glBlendEquation(mode);
+	} break;
+	case 433: {
+		GLsizei n;
+		const GLuint *recorded_ids;
+		GLuint *ids;
+		trace_get(glad_replay, &n, sizeof(n));
+		recorded_ids = (const GLuint *)trace_get_data(glad_replay);
+		ids = (GLuint *)trace_scratch(glad_replay, 0, (size_t)n * sizeof(GLuint));
+		if(glad_replay->unsupported) return 0;
+		if(!trace_names_bound(glad_replay, TRACE_NS_QUERY, recorded_ids, n)) {
+			glad_glGenQueries(n, ids);
+			trace_bind_names(glad_replay, TRACE_NS_QUERY, recorded_ids, ids, n);
+		}
+	} break;
+	case 434: {
+		GLsizei n;
+		const GLuint *recorded_ids;
+		GLuint *ids;
+		trace_get(glad_replay, &n, sizeof(n));
+		recorded_ids = (const GLuint *)trace_get_data(glad_replay);
+		ids = trace_map_names(glad_replay, 0, TRACE_NS_QUERY, recorded_ids, n);
+		if(glad_replay->unsupported) return 0;
+		glad_glDeleteQueries(n, ids);
+		trace_unbind_names(glad_replay, TRACE_NS_QUERY, recorded_ids, n);
+	} break;
+	case 435: {
+		GLuint id;
+		GLboolean glad_result;
+		GLboolean recorded_result;
+		trace_get(glad_replay, &id, sizeof(id));
+		id = trace_map_name(glad_replay, TRACE_NS_QUERY, id);
+		trace_get(glad_replay, &recorded_result, sizeof(recorded_result));
+		if(glad_replay->unsupported) return 0;
+		glad_result = glad_glIsQuery(id);
+		(void)glad_result;
+		(void)recorded_result;
+	} break;
+	case 436: {
+		GLenum target;
+		GLuint id;
+		trace_get(glad_replay, &target, sizeof(target));
+		trace_get(glad_replay, &id, sizeof(id));
+		id = trace_map_name(glad_replay, TRACE_NS_QUERY, id);
+		if(glad_replay->unsupported) return 0;
+		glad_glBeginQuery(target, id);
+	} break;
+	case 437: {
+		GLenum target;
+		trace_get(glad_replay, &target, sizeof(target));
+		if(glad_replay->unsupported) return 0;
+		glad_glEndQuery(target);
+	} break;
+	case 438: {
+		GLenum target;
+		GLenum pname;
+		GLint *params;
+		trace_get(glad_replay, &target, sizeof(target));
+		trace_get(glad_replay, &pname, sizeof(pname));
+		params = (GLint *)trace_scratch(glad_replay, 0, TRACE_SCRATCH_DEFAULT);
+		if(glad_replay->unsupported) return 0;
+		glad_glGetQueryiv(target, pname, params);
+	} break;
+	case 439: {
+		GLuint id;
+		GLenum pname;
+		GLint *params;
+		trace_get(glad_replay, &id, sizeof(id));
+		id = trace_map_name(glad_replay, TRACE_NS_QUERY, id);
+		trace_get(glad_replay, &pname, sizeof(pname));
+		params = (GLint *)trace_scratch(glad_replay, 0, TRACE_SCRATCH_DEFAULT);
+		if(glad_replay->unsupported) return 0;
+		glad_glGetQueryObjectiv(id, pname, params);
+	} break;
+	case 440: {
+		GLuint id;
+		GLenum pname;
+		GLuint *params;
+		trace_get(glad_replay, &id, sizeof(id));
+		id = trace_map_name(glad_replay, TRACE_NS_QUERY, id);
+		trace_get(glad_replay, &pname, sizeof(pname));
+		params = (GLuint *)trace_scratch(glad_replay, 0, TRACE_SCRATCH_DEFAULT);
+		if(glad_replay->unsupported) return 0;
+		glad_glGetQueryObjectuiv(id, pname, params);
+	} break;
+	case 441: {
+		GLenum target;
+		GLuint buffer;
+		trace_get(glad_replay, &target, sizeof(target));
+		trace_get(glad_replay, &buffer, sizeof(buffer));
+		buffer = trace_map_name(glad_replay, TRACE_NS_BUFFER, buffer);
+		if(glad_replay->unsupported) return 0;
+		glad_glBindBuffer(target, buffer);
+	} break;
+	case 442: {
+		GLsizei n;
+		const GLuint *recorded_buffers;
+		GLuint *buffers;
+		trace_get(glad_replay, &n, sizeof(n));
+		recorded_buffers = (const GLuint *)trace_get_data(glad_replay);
+		buffers = trace_map_names(glad_replay, 0, TRACE_NS_BUFFER, recorded_buffers, n);
+		if(glad_replay->unsupported) return 0;
+		glad_glDeleteBuffers(n, buffers);
+		trace_unbind_names(glad_replay, TRACE_NS_BUFFER, recorded_buffers, n);
+	} break;
+	case 443: {
+		GLsizei n;
+		const GLuint *recorded_buffers;
+		GLuint *buffers;
+		trace_get(glad_replay, &n, sizeof(n));
+		recorded_buffers = (const GLuint *)trace_get_data(glad_replay);
+		buffers = (GLuint *)trace_scratch(glad_replay, 0, (size_t)n * sizeof(GLuint));
+		if(glad_replay->unsupported) return 0;
+		if(!trace_names_bound(glad_replay, TRACE_NS_BUFFER, recorded_buffers, n)) {
+			glad_glGenBuffers(n, buffers);
+			trace_bind_names(glad_replay, TRACE_NS_BUFFER, recorded_buffers, buffers, n);
+		}
+	} break;
+	case 444: {
+		GLuint buffer;
+		GLboolean glad_result;
+		GLboolean recorded_result;
+		trace_get(glad_replay, &buffer, sizeof(buffer));
+		buffer = trace_map_name(glad_replay, TRACE_NS_BUFFER, buffer);
+		trace_get(glad_replay, &recorded_result, sizeof(recorded_result));
+		if(glad_replay->unsupported) return 0;
+		glad_result = glad_glIsBuffer(buffer);
+		(void)glad_result;
+		(void)recorded_result;
+	} break;
+	case 445: {
+		GLenum target;
+		GLsizeiptr size;
+		const void *data;
+		GLenum usage;
+		trace_get(glad_replay, &target, sizeof(target));
+		trace_get(glad_replay, &size, sizeof(size));
+		data = (const void *)trace_get_data(glad_replay);
+		trace_get(glad_replay, &usage, sizeof(usage));
+		if(glad_replay->unsupported) return 0;
+		glad_glBufferData(target, size, data, usage);
+	} break;
+	case 446: {
+		GLenum target;
+		GLintptr offset;
+		GLsizeiptr size;
+		const void *data;
+		trace_get(glad_replay, &target, sizeof(target));
+		trace_get(glad_replay, &offset, sizeof(offset));
+		trace_get(glad_replay, &size, sizeof(size));
+		data = (const void *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glBufferSubData(target, offset, size, data);
+	} break;
+	case 447: {
+		GLenum target;
+		GLintptr offset;
+		GLsizeiptr size;
+		void *data;
+		trace_get(glad_replay, &target, sizeof(target));
+		trace_get(glad_replay, &offset, sizeof(offset));
+		trace_get(glad_replay, &size, sizeof(size));
+		data = (void *)trace_scratch(glad_replay, 0, (size_t)size);
+		if(glad_replay->unsupported) return 0;
+		glad_glGetBufferSubData(target, offset, size, data);
+	} break;
+	case 448: {
+		GLenum target;
+		GLenum access;
+		void * glad_result;
+		trace_get(glad_replay, &target, sizeof(target));
+		trace_get(glad_replay, &access, sizeof(access));
+		if(glad_replay->unsupported) return 0;
+		glad_result = glad_glMapBuffer(target, access);
+		(void)glad_result;
+		trace_replay_map(glad_replay, target, glad_result);
+	} break;
+	case 449: {
+		GLenum target;
+		GLboolean glad_result;
+		GLboolean recorded_result;
+		trace_get(glad_replay, &target, sizeof(target));
+		trace_get(glad_replay, &recorded_result, sizeof(recorded_result));
+		if(glad_replay->unsupported) return 0;
+		glad_result = glad_glUnmapBuffer(target);
+		(void)glad_result;
+		(void)recorded_result;
+		trace_replay_unmap(glad_replay, target);
+	} break;
+	case 450: {
+		GLenum target;
+		GLenum pname;
+		GLint *params;
+		trace_get(glad_replay, &target, sizeof(target));
+		trace_get(glad_replay, &pname, sizeof(pname));
+		params = (GLint *)trace_scratch(glad_replay, 0, TRACE_SCRATCH_DEFAULT);
+		if(glad_replay->unsupported) return 0;
+		glad_glGetBufferParameteriv(target, pname, params);
+	} break;
+	case 451: {
+		GLenum target;
+		GLenum pname;
+		void **params;
+		trace_get(glad_replay, &target, sizeof(target));
+		trace_get(glad_replay, &pname, sizeof(pname));
+		params = NULL;
+		glad_replay->unsupported = 1;
+		if(glad_replay->unsupported) return 0;
+		glad_glGetBufferPointerv(target, pname, params);
+	} break;
+	case 452: {
+		GLenum modeRGB;
+		GLenum modeAlpha;
+		trace_get(glad_replay, &modeRGB, sizeof(modeRGB));
+		trace_get(glad_replay, &modeAlpha, sizeof(modeAlpha));
+		if(glad_replay->unsupported) return 0;
+		glad_glBlendEquationSeparate(modeRGB, modeAlpha);
+	} break;
+	case 453: {
+		GLsizei n;
+		const GLenum *bufs;
+		trace_get(glad_replay, &n, sizeof(n));
+		bufs = (const GLenum *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glDrawBuffers(n, bufs);
+	} break;
+	case 454: {
+		GLenum face;
+		GLenum sfail;
+		GLenum dpfail;
+		GLenum dppass;
+		trace_get(glad_replay, &face, sizeof(face));
+		trace_get(glad_replay, &sfail, sizeof(sfail));
+		trace_get(glad_replay, &dpfail, sizeof(dpfail));
+		trace_get(glad_replay, &dppass, sizeof(dppass));
+		if(glad_replay->unsupported) return 0;
+		glad_glStencilOpSeparate(face, sfail, dpfail, dppass);
+	} break;
+	case 455: {
+		GLenum face;
+		GLenum func;
+		GLint ref;
+		GLuint mask;
+		trace_get(glad_replay, &face, sizeof(face));
+		trace_get(glad_replay, &func, sizeof(func));
+		trace_get(glad_replay, &ref, sizeof(ref));
+		trace_get(glad_replay, &mask, sizeof(mask));
+		if(glad_replay->unsupported) return 0;
+		glad_glStencilFuncSeparate(face, func, ref, mask);
+	} break;
+	case 456: {
+		GLenum face;
+		GLuint mask;
+		trace_get(glad_replay, &face, sizeof(face));
+		trace_get(glad_replay, &mask, sizeof(mask));
+		if(glad_replay->unsupported) return 0;
+		glad_glStencilMaskSeparate(face, mask);
+	} break;
+	case 457: {
+		GLuint program;
+		GLuint shader;
+		trace_get(glad_replay, &program, sizeof(program));
+		program = trace_map_name(glad_replay, TRACE_NS_PROGRAM, program);
+		trace_get(glad_replay, &shader, sizeof(shader));
+		shader = trace_map_name(glad_replay, TRACE_NS_PROGRAM, shader);
+		if(glad_replay->unsupported) return 0;
+		glad_glAttachShader(program, shader);
+	} break;
+	case 458: {
+		GLuint program;
+		GLuint index;
+		const GLchar *name;
+		trace_get(glad_replay, &program, sizeof(program));
+		program = trace_map_name(glad_replay, TRACE_NS_PROGRAM, program);
+		trace_get(glad_replay, &index, sizeof(index));
+		name = (const GLchar *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glBindAttribLocation(program, index, name);
+	} break;
+	case 459: {
+		GLuint shader;
+		trace_get(glad_replay, &shader, sizeof(shader));
+		shader = trace_map_name(glad_replay, TRACE_NS_PROGRAM, shader);
+		if(glad_replay->unsupported) return 0;
+		glad_glCompileShader(shader);
+	} break;
+	case 460: {
+		GLuint glad_result;
+		GLuint recorded_result;
+		trace_get(glad_replay, &recorded_result, sizeof(recorded_result));
+		if(glad_replay->unsupported) return 0;
+		glad_result = glad_glCreateProgram();
+		(void)glad_result;
+		(void)recorded_result;
+		trace_bind_name(glad_replay, TRACE_NS_PROGRAM, recorded_result, glad_result);
+	} break;
+	case 461: {
+		GLenum type;
+		GLuint glad_result;
+		GLuint recorded_result;
+		trace_get(glad_replay, &type, sizeof(type));
+		trace_get(glad_replay, &recorded_result, sizeof(recorded_result));
+		if(glad_replay->unsupported) return 0;
+		glad_result = glad_glCreateShader(type);
+		(void)glad_result;
+		(void)recorded_result;
+		trace_bind_name(glad_replay, TRACE_NS_PROGRAM, recorded_result, glad_result);
+	} break;
+	case 462: {
+		GLuint program;
+		trace_get(glad_replay, &program, sizeof(program));
+		program = trace_map_name(glad_replay, TRACE_NS_PROGRAM, program);
+		if(glad_replay->unsupported) return 0;
+		glad_glDeleteProgram(program);
+	} break;
+	case 463: {
+		GLuint shader;
+		trace_get(glad_replay, &shader, sizeof(shader));
+		shader = trace_map_name(glad_replay, TRACE_NS_PROGRAM, shader);
+		if(glad_replay->unsupported) return 0;
+		glad_glDeleteShader(shader);
+	} break;
+	case 464: {
+		GLuint program;
+		GLuint shader;
+		trace_get(glad_replay, &program, sizeof(program));
+		program = trace_map_name(glad_replay, TRACE_NS_PROGRAM, program);
+		trace_get(glad_replay, &shader, sizeof(shader));
+		shader = trace_map_name(glad_replay, TRACE_NS_PROGRAM, shader);
+		if(glad_replay->unsupported) return 0;
+		glad_glDetachShader(program, shader);
+	} break;
+	case 465: {
+		GLuint index;
+		trace_get(glad_replay, &index, sizeof(index));
+		if(glad_replay->unsupported) return 0;
+		glad_glDisableVertexAttribArray(index);
+	} break;
+	case 466: {
+		GLuint index;
+		trace_get(glad_replay, &index, sizeof(index));
+		if(glad_replay->unsupported) return 0;
+		glad_glEnableVertexAttribArray(index);
+	} break;
+	case 467: {
+		GLuint program;
+		GLuint index;
+		GLsizei bufSize;
+		GLsizei *length;
+		GLint *size;
+		GLenum *type;
+		GLchar *name;
+		trace_get(glad_replay, &program, sizeof(program));
+		program = trace_map_name(glad_replay, TRACE_NS_PROGRAM, program);
+		trace_get(glad_replay, &index, sizeof(index));
+		trace_get(glad_replay, &bufSize, sizeof(bufSize));
+		length = (GLsizei *)trace_scratch(glad_replay, 0, TRACE_SCRATCH_DEFAULT);
+		size = (GLint *)trace_scratch(glad_replay, 1, TRACE_SCRATCH_DEFAULT);
+		type = (GLenum *)trace_scratch(glad_replay, 2, TRACE_SCRATCH_DEFAULT);
+		name = (GLchar *)trace_scratch(glad_replay, 3, TRACE_SCRATCH_DEFAULT);
+		if(glad_replay->unsupported) return 0;
+		glad_glGetActiveAttrib(program, index, bufSize, length, size, type, name);
+	} break;
+	case 468: {
+		GLuint program;
+		GLuint index;
+		GLsizei bufSize;
+		GLsizei *length;
+		GLint *size;
+		GLenum *type;
+		GLchar *name;
+		trace_get(glad_replay, &program, sizeof(program));
+		program = trace_map_name(glad_replay, TRACE_NS_PROGRAM, program);
+		trace_get(glad_replay, &index, sizeof(index));
+		trace_get(glad_replay, &bufSize, sizeof(bufSize));
+		length = (GLsizei *)trace_scratch(glad_replay, 0, TRACE_SCRATCH_DEFAULT);
+		size = (GLint *)trace_scratch(glad_replay, 1, TRACE_SCRATCH_DEFAULT);
+		type = (GLenum *)trace_scratch(glad_replay, 2, TRACE_SCRATCH_DEFAULT);
+		name = (GLchar *)trace_scratch(glad_replay, 3, TRACE_SCRATCH_DEFAULT);
+		if(glad_replay->unsupported) return 0;
+		glad_glGetActiveUniform(program, index, bufSize, length, size, type, name);
+	} break;
+	case 469: {
+		GLuint program;
+		GLsizei maxCount;
+		GLsizei *count;
+		GLuint *shaders;
+		trace_get(glad_replay, &program, sizeof(program));
+		program = trace_map_name(glad_replay, TRACE_NS_PROGRAM, program);
+		trace_get(glad_replay, &maxCount, sizeof(maxCount));
+		count = (GLsizei *)trace_scratch(glad_replay, 0, TRACE_SCRATCH_DEFAULT);
+		shaders = (GLuint *)trace_scratch(glad_replay, 1, (size_t)maxCount * sizeof(GLuint));
+		if(glad_replay->unsupported) return 0;
+		glad_glGetAttachedShaders(program, maxCount, count, shaders);
+	} break;
+	case 470: {
+		GLuint program;
+		const GLchar *name;
+		GLint glad_result;
+		GLint recorded_result;
+		trace_get(glad_replay, &program, sizeof(program));
+		program = trace_map_name(glad_replay, TRACE_NS_PROGRAM, program);
+		name = (const GLchar *)trace_get_data(glad_replay);
+		trace_get(glad_replay, &recorded_result, sizeof(recorded_result));
+		if(glad_replay->unsupported) return 0;
+		glad_result = glad_glGetAttribLocation(program, name);
+		(void)glad_result;
+		(void)recorded_result;
+	} break;
+	case 471: {
+		GLuint program;
+		GLenum pname;
+		GLint *params;
+		trace_get(glad_replay, &program, sizeof(program));
+		program = trace_map_name(glad_replay, TRACE_NS_PROGRAM, program);
+		trace_get(glad_replay, &pname, sizeof(pname));
+		params = (GLint *)trace_scratch(glad_replay, 0, TRACE_SCRATCH_DEFAULT);
+		if(glad_replay->unsupported) return 0;
+		glad_glGetProgramiv(program, pname, params);
+	} break;
+	case 472: {
+		GLuint program;
+		GLsizei bufSize;
+		GLsizei *length;
+		GLchar *infoLog;
+		trace_get(glad_replay, &program, sizeof(program));
+		program = trace_map_name(glad_replay, TRACE_NS_PROGRAM, program);
+		trace_get(glad_replay, &bufSize, sizeof(bufSize));
+		length = (GLsizei *)trace_scratch(glad_replay, 0, TRACE_SCRATCH_DEFAULT);
+		infoLog = (GLchar *)trace_scratch(glad_replay, 1, TRACE_SCRATCH_DEFAULT);
+		if(glad_replay->unsupported) return 0;
+		glad_glGetProgramInfoLog(program, bufSize, length, infoLog);
+	} break;
+	case 473: {
+		GLuint shader;
+		GLenum pname;
+		GLint *params;
+		trace_get(glad_replay, &shader, sizeof(shader));
+		shader = trace_map_name(glad_replay, TRACE_NS_PROGRAM, shader);
+		trace_get(glad_replay, &pname, sizeof(pname));
+		params = (GLint *)trace_scratch(glad_replay, 0, TRACE_SCRATCH_DEFAULT);
+		if(glad_replay->unsupported) return 0;
+		glad_glGetShaderiv(shader, pname, params);
+	} break;
+	case 474: {
+		GLuint shader;
+		GLsizei bufSize;
+		GLsizei *length;
+		GLchar *infoLog;
+		trace_get(glad_replay, &shader, sizeof(shader));
+		shader = trace_map_name(glad_replay, TRACE_NS_PROGRAM, shader);
+		trace_get(glad_replay, &bufSize, sizeof(bufSize));
+		length = (GLsizei *)trace_scratch(glad_replay, 0, TRACE_SCRATCH_DEFAULT);
+		infoLog = (GLchar *)trace_scratch(glad_replay, 1, TRACE_SCRATCH_DEFAULT);
+		if(glad_replay->unsupported) return 0;
+		glad_glGetShaderInfoLog(shader, bufSize, length, infoLog);
+	} break;
+	case 475: {
+		GLuint shader;
+		GLsizei bufSize;
+		GLsizei *length;
+		GLchar *source;
+		trace_get(glad_replay, &shader, sizeof(shader));
+		shader = trace_map_name(glad_replay, TRACE_NS_PROGRAM, shader);
+		trace_get(glad_replay, &bufSize, sizeof(bufSize));
+		length = (GLsizei *)trace_scratch(glad_replay, 0, TRACE_SCRATCH_DEFAULT);
+		source = (GLchar *)trace_scratch(glad_replay, 1, TRACE_SCRATCH_DEFAULT);
+		if(glad_replay->unsupported) return 0;
+		glad_glGetShaderSource(shader, bufSize, length, source);
+	} break;
+	case 476: {
+		GLuint program;
+		const GLchar *name;
+		GLint glad_result;
+		GLint recorded_result;
+		trace_get(glad_replay, &program, sizeof(program));
+		program = trace_map_name(glad_replay, TRACE_NS_PROGRAM, program);
+		name = (const GLchar *)trace_get_data(glad_replay);
+		trace_get(glad_replay, &recorded_result, sizeof(recorded_result));
+		if(glad_replay->unsupported) return 0;
+		glad_result = glad_glGetUniformLocation(program, name);
+		(void)glad_result;
+		(void)recorded_result;
+		trace_bind_location(glad_replay, program, recorded_result, glad_result);
+	} break;
+	case 477: {
+		GLuint program;
+		GLint location;
+		GLfloat *params;
+		trace_get(glad_replay, &program, sizeof(program));
+		program = trace_map_name(glad_replay, TRACE_NS_PROGRAM, program);
+		trace_get(glad_replay, &location, sizeof(location));
+		params = (GLfloat *)trace_scratch(glad_replay, 0, TRACE_SCRATCH_DEFAULT);
+		if(glad_replay->unsupported) return 0;
+		glad_glGetUniformfv(program, location, params);
+	} break;
+	case 478: {
+		GLuint program;
+		GLint location;
+		GLint *params;
+		trace_get(glad_replay, &program, sizeof(program));
+		program = trace_map_name(glad_replay, TRACE_NS_PROGRAM, program);
+		trace_get(glad_replay, &location, sizeof(location));
+		params = (GLint *)trace_scratch(glad_replay, 0, TRACE_SCRATCH_DEFAULT);
+		if(glad_replay->unsupported) return 0;
+		glad_glGetUniformiv(program, location, params);
+	} break;
+	case 479: {
+		GLuint index;
+		GLenum pname;
+		GLdouble *params;
+		trace_get(glad_replay, &index, sizeof(index));
+		trace_get(glad_replay, &pname, sizeof(pname));
+		params = (GLdouble *)trace_scratch(glad_replay, 0, TRACE_SCRATCH_DEFAULT);
+		if(glad_replay->unsupported) return 0;
+		glad_glGetVertexAttribdv(index, pname, params);
+	} break;
+	case 480: {
+		GLuint index;
+		GLenum pname;
+		GLfloat *params;
+		trace_get(glad_replay, &index, sizeof(index));
+		trace_get(glad_replay, &pname, sizeof(pname));
+		params = (GLfloat *)trace_scratch(glad_replay, 0, TRACE_SCRATCH_DEFAULT);
+		if(glad_replay->unsupported) return 0;
+		glad_glGetVertexAttribfv(index, pname, params);
+	} break;
+	case 481: {
+		GLuint index;
+		GLenum pname;
+		GLint *params;
+		trace_get(glad_replay, &index, sizeof(index));
+		trace_get(glad_replay, &pname, sizeof(pname));
+		params = (GLint *)trace_scratch(glad_replay, 0, TRACE_SCRATCH_DEFAULT);
+		if(glad_replay->unsupported) return 0;
+		glad_glGetVertexAttribiv(index, pname, params);
+	} break;
+	case 482: {
+		GLuint index;
+		GLenum pname;
+		void **pointer;
+		trace_get(glad_replay, &index, sizeof(index));
+		trace_get(glad_replay, &pname, sizeof(pname));
+		pointer = NULL;
+		glad_replay->unsupported = 1;
+		if(glad_replay->unsupported) return 0;
+		glad_glGetVertexAttribPointerv(index, pname, pointer);
+	} break;
+	case 483: {
+		GLuint program;
+		GLboolean glad_result;
+		GLboolean recorded_result;
+		trace_get(glad_replay, &program, sizeof(program));
+		program = trace_map_name(glad_replay, TRACE_NS_PROGRAM, program);
+		trace_get(glad_replay, &recorded_result, sizeof(recorded_result));
+		if(glad_replay->unsupported) return 0;
+		glad_result = glad_glIsProgram(program);
+		(void)glad_result;
+		(void)recorded_result;
+	} break;
+	case 484: {
+		GLuint shader;
+		GLboolean glad_result;
+		GLboolean recorded_result;
+		trace_get(glad_replay, &shader, sizeof(shader));
+		shader = trace_map_name(glad_replay, TRACE_NS_PROGRAM, shader);
+		trace_get(glad_replay, &recorded_result, sizeof(recorded_result));
+		if(glad_replay->unsupported) return 0;
+		glad_result = glad_glIsShader(shader);
+		(void)glad_result;
+		(void)recorded_result;
+	} break;
+	case 485: {
+		GLuint program;
+		trace_get(glad_replay, &program, sizeof(program));
+		program = trace_map_name(glad_replay, TRACE_NS_PROGRAM, program);
+		if(glad_replay->unsupported) return 0;
+		glad_glLinkProgram(program);
+	} break;
+	case 486: {
+		GLuint shader;
+		GLsizei count;
+		const GLchar *const*string;
+		const GLint *length;
+		trace_get(glad_replay, &shader, sizeof(shader));
+		shader = trace_map_name(glad_replay, TRACE_NS_PROGRAM, shader);
+		trace_get(glad_replay, &count, sizeof(count));
+		string = trace_get_strings(glad_replay, 0, count);
+		length = NULL;
+		if(glad_replay->unsupported) return 0;
+		glad_glShaderSource(shader, count, string, length);
+	} break;
+	case 487: {
+		GLuint program;
+		trace_get(glad_replay, &program, sizeof(program));
+		program = trace_map_name(glad_replay, TRACE_NS_PROGRAM, program);
+		if(glad_replay->unsupported) return 0;
+		glad_glUseProgram(program);
+		glad_replay->program = program;
+	} break;
+	case 488: {
+		GLint location;
+		GLfloat v0;
+		trace_get(glad_replay, &location, sizeof(location));
+		location = trace_map_location(glad_replay, location);
+		trace_get(glad_replay, &v0, sizeof(v0));
+		if(glad_replay->unsupported) return 0;
+		glad_glUniform1f(location, v0);
+	} break;
+	case 489: {
+		GLint location;
+		GLfloat v0;
+		GLfloat v1;
+		trace_get(glad_replay, &location, sizeof(location));
+		location = trace_map_location(glad_replay, location);
+		trace_get(glad_replay, &v0, sizeof(v0));
+		trace_get(glad_replay, &v1, sizeof(v1));
+		if(glad_replay->unsupported) return 0;
+		glad_glUniform2f(location, v0, v1);
+	} break;
+	case 490: {
+		GLint location;
+		GLfloat v0;
+		GLfloat v1;
+		GLfloat v2;
+		trace_get(glad_replay, &location, sizeof(location));
+		location = trace_map_location(glad_replay, location);
+		trace_get(glad_replay, &v0, sizeof(v0));
+		trace_get(glad_replay, &v1, sizeof(v1));
+		trace_get(glad_replay, &v2, sizeof(v2));
+		if(glad_replay->unsupported) return 0;
+		glad_glUniform3f(location, v0, v1, v2);
+	} break;
+	case 491: {
+		GLint location;
+		GLfloat v0;
+		GLfloat v1;
+		GLfloat v2;
+		GLfloat v3;
+		trace_get(glad_replay, &location, sizeof(location));
+		location = trace_map_location(glad_replay, location);
+		trace_get(glad_replay, &v0, sizeof(v0));
+		trace_get(glad_replay, &v1, sizeof(v1));
+		trace_get(glad_replay, &v2, sizeof(v2));
+		trace_get(glad_replay, &v3, sizeof(v3));
+		if(glad_replay->unsupported) return 0;
+		glad_glUniform4f(location, v0, v1, v2, v3);
+	} break;
+	case 492: {
+		GLint location;
+		GLint v0;
+		trace_get(glad_replay, &location, sizeof(location));
+		location = trace_map_location(glad_replay, location);
+		trace_get(glad_replay, &v0, sizeof(v0));
+		if(glad_replay->unsupported) return 0;
+		glad_glUniform1i(location, v0);
+	} break;
+	case 493: {
+		GLint location;
+		GLint v0;
+		GLint v1;
+		trace_get(glad_replay, &location, sizeof(location));
+		location = trace_map_location(glad_replay, location);
+		trace_get(glad_replay, &v0, sizeof(v0));
+		trace_get(glad_replay, &v1, sizeof(v1));
+		if(glad_replay->unsupported) return 0;
+		glad_glUniform2i(location, v0, v1);
+	} break;
+	case 494: {
+		GLint location;
+		GLint v0;
+		GLint v1;
+		GLint v2;
+		trace_get(glad_replay, &location, sizeof(location));
+		location = trace_map_location(glad_replay, location);
+		trace_get(glad_replay, &v0, sizeof(v0));
+		trace_get(glad_replay, &v1, sizeof(v1));
+		trace_get(glad_replay, &v2, sizeof(v2));
+		if(glad_replay->unsupported) return 0;
+		glad_glUniform3i(location, v0, v1, v2);
+	} break;
+	case 495: {
+		GLint location;
+		GLint v0;
+		GLint v1;
+		GLint v2;
+		GLint v3;
+		trace_get(glad_replay, &location, sizeof(location));
+		location = trace_map_location(glad_replay, location);
+		trace_get(glad_replay, &v0, sizeof(v0));
+		trace_get(glad_replay, &v1, sizeof(v1));
+		trace_get(glad_replay, &v2, sizeof(v2));
+		trace_get(glad_replay, &v3, sizeof(v3));
+		if(glad_replay->unsupported) return 0;
+		glad_glUniform4i(location, v0, v1, v2, v3);
+	} break;
+	case 496: {
+		GLint location;
+		GLsizei count;
+		const GLfloat *value;
+		trace_get(glad_replay, &location, sizeof(location));
+		location = trace_map_location(glad_replay, location);
+		trace_get(glad_replay, &count, sizeof(count));
+		value = (const GLfloat *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glUniform1fv(location, count, value);
+	} break;
+	case 497: {
+		GLint location;
+		GLsizei count;
+		const GLfloat *value;
+		trace_get(glad_replay, &location, sizeof(location));
+		location = trace_map_location(glad_replay, location);
+		trace_get(glad_replay, &count, sizeof(count));
+		value = (const GLfloat *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glUniform2fv(location, count, value);
+	} break;
+	case 498: {
+		GLint location;
+		GLsizei count;
+		const GLfloat *value;
+		trace_get(glad_replay, &location, sizeof(location));
+		location = trace_map_location(glad_replay, location);
+		trace_get(glad_replay, &count, sizeof(count));
+		value = (const GLfloat *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glUniform3fv(location, count, value);
+	} break;
+	case 499: {
+		GLint location;
+		GLsizei count;
+		const GLfloat *value;
+		trace_get(glad_replay, &location, sizeof(location));
+		location = trace_map_location(glad_replay, location);
+		trace_get(glad_replay, &count, sizeof(count));
+		value = (const GLfloat *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glUniform4fv(location, count, value);
+	} break;
+	case 500: {
+		GLint location;
+		GLsizei count;
+		const GLint *value;
+		trace_get(glad_replay, &location, sizeof(location));
+		location = trace_map_location(glad_replay, location);
+		trace_get(glad_replay, &count, sizeof(count));
+		value = (const GLint *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glUniform1iv(location, count, value);
+	} break;
+	case 501: {
+		GLint location;
+		GLsizei count;
+		const GLint *value;
+		trace_get(glad_replay, &location, sizeof(location));
+		location = trace_map_location(glad_replay, location);
+		trace_get(glad_replay, &count, sizeof(count));
+		value = (const GLint *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glUniform2iv(location, count, value);
+	} break;
+	case 502: {
+		GLint location;
+		GLsizei count;
+		const GLint *value;
+		trace_get(glad_replay, &location, sizeof(location));
+		location = trace_map_location(glad_replay, location);
+		trace_get(glad_replay, &count, sizeof(count));
+		value = (const GLint *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glUniform3iv(location, count, value);
+	} break;
+	case 503: {
+		GLint location;
+		GLsizei count;
+		const GLint *value;
+		trace_get(glad_replay, &location, sizeof(location));
+		location = trace_map_location(glad_replay, location);
+		trace_get(glad_replay, &count, sizeof(count));
+		value = (const GLint *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glUniform4iv(location, count, value);
+	} break;
+	case 504: {
+		GLint location;
+		GLsizei count;
+		GLboolean transpose;
+		const GLfloat *value;
+		trace_get(glad_replay, &location, sizeof(location));
+		location = trace_map_location(glad_replay, location);
+		trace_get(glad_replay, &count, sizeof(count));
+		trace_get(glad_replay, &transpose, sizeof(transpose));
+		value = (const GLfloat *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glUniformMatrix2fv(location, count, transpose, value);
+	} break;
+	case 505: {
+		GLint location;
+		GLsizei count;
+		GLboolean transpose;
+		const GLfloat *value;
+		trace_get(glad_replay, &location, sizeof(location));
+		location = trace_map_location(glad_replay, location);
+		trace_get(glad_replay, &count, sizeof(count));
+		trace_get(glad_replay, &transpose, sizeof(transpose));
+		value = (const GLfloat *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glUniformMatrix3fv(location, count, transpose, value);
+	} break;
+	case 506: {
+		GLint location;
+		GLsizei count;
+		GLboolean transpose;
+		const GLfloat *value;
+		trace_get(glad_replay, &location, sizeof(location));
+		location = trace_map_location(glad_replay, location);
+		trace_get(glad_replay, &count, sizeof(count));
+		trace_get(glad_replay, &transpose, sizeof(transpose));
+		value = (const GLfloat *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glUniformMatrix4fv(location, count, transpose, value);
+	} break;
+	case 507: {
+		GLuint program;
+		trace_get(glad_replay, &program, sizeof(program));
+		program = trace_map_name(glad_replay, TRACE_NS_PROGRAM, program);
+		if(glad_replay->unsupported) return 0;
+		glad_glValidateProgram(program);
+	} break;
+	case 508: {
+		GLuint index;
+		GLdouble x;
+		trace_get(glad_replay, &index, sizeof(index));
+		trace_get(glad_replay, &x, sizeof(x));
+		if(glad_replay->unsupported) return 0;
+		glad_glVertexAttrib1d(index, x);
+	} break;
+	case 509: {
+		GLuint index;
+		const GLdouble *v;
+		trace_get(glad_replay, &index, sizeof(index));
+		v = (const GLdouble *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glVertexAttrib1dv(index, v);
+	} break;
+	case 510: {
+		GLuint index;
+		GLfloat x;
+		trace_get(glad_replay, &index, sizeof(index));
+		trace_get(glad_replay, &x, sizeof(x));
+		if(glad_replay->unsupported) return 0;
+		glad_glVertexAttrib1f(index, x);
+	} break;
+	case 511: {
+		GLuint index;
+		const GLfloat *v;
+		trace_get(glad_replay, &index, sizeof(index));
+		v = (const GLfloat *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glVertexAttrib1fv(index, v);
+	} break;
+	case 512: {
+		GLuint index;
+		GLshort x;
+		trace_get(glad_replay, &index, sizeof(index));
+		trace_get(glad_replay, &x, sizeof(x));
+		if(glad_replay->unsupported) return 0;
+		glad_glVertexAttrib1s(index, x);
+	} break;
+	case 513: {
+		GLuint index;
+		const GLshort *v;
+		trace_get(glad_replay, &index, sizeof(index));
+		v = (const GLshort *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glVertexAttrib1sv(index, v);
+	} break;
+	case 514: {
+		GLuint index;
+		GLdouble x;
+		GLdouble y;
+		trace_get(glad_replay, &index, sizeof(index));
+		trace_get(glad_replay, &x, sizeof(x));
+		trace_get(glad_replay, &y, sizeof(y));
+		if(glad_replay->unsupported) return 0;
+		glad_glVertexAttrib2d(index, x, y);
+	} break;
+	case 515: {
+		GLuint index;
+		const GLdouble *v;
+		trace_get(glad_replay, &index, sizeof(index));
+		v = (const GLdouble *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glVertexAttrib2dv(index, v);
+	} break;
+	case 516: {
+		GLuint index;
+		GLfloat x;
+		GLfloat y;
+		trace_get(glad_replay, &index, sizeof(index));
+		trace_get(glad_replay, &x, sizeof(x));
+		trace_get(glad_replay, &y, sizeof(y));
+		if(glad_replay->unsupported) return 0;
+		glad_glVertexAttrib2f(index, x, y);
+	} break;
+	case 517: {
+		GLuint index;
+		const GLfloat *v;
+		trace_get(glad_replay, &index, sizeof(index));
+		v = (const GLfloat *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glVertexAttrib2fv(index, v);
+	} break;
+	case 518: {
+		GLuint index;
+		GLshort x;
+		GLshort y;
+		trace_get(glad_replay, &index, sizeof(index));
+		trace_get(glad_replay, &x, sizeof(x));
+		trace_get(glad_replay, &y, sizeof(y));
+		if(glad_replay->unsupported) return 0;
+		glad_glVertexAttrib2s(index, x, y);
+	} break;
+	case 519: {
+		GLuint index;
+		const GLshort *v;
+		trace_get(glad_replay, &index, sizeof(index));
+		v = (const GLshort *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glVertexAttrib2sv(index, v);
+	} break;
+	case 520: {
+		GLuint index;
+		GLdouble x;
+		GLdouble y;
+		GLdouble z;
+		trace_get(glad_replay, &index, sizeof(index));
+		trace_get(glad_replay, &x, sizeof(x));
+		trace_get(glad_replay, &y, sizeof(y));
+		trace_get(glad_replay, &z, sizeof(z));
+		if(glad_replay->unsupported) return 0;
+		glad_glVertexAttrib3d(index, x, y, z);
+	} break;
+	case 521: {
+		GLuint index;
+		const GLdouble *v;
+		trace_get(glad_replay, &index, sizeof(index));
+		v = (const GLdouble *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glVertexAttrib3dv(index, v);
+	} break;
+	case 522: {
+		GLuint index;
+		GLfloat x;
+		GLfloat y;
+		GLfloat z;
+		trace_get(glad_replay, &index, sizeof(index));
+		trace_get(glad_replay, &x, sizeof(x));
+		trace_get(glad_replay, &y, sizeof(y));
+		trace_get(glad_replay, &z, sizeof(z));
+		if(glad_replay->unsupported) return 0;
+		glad_glVertexAttrib3f(index, x, y, z);
+	} break;
+	case 523: {
+		GLuint index;
+		const GLfloat *v;
+		trace_get(glad_replay, &index, sizeof(index));
+		v = (const GLfloat *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glVertexAttrib3fv(index, v);
+	} break;
+	case 524: {
+		GLuint index;
+		GLshort x;
+		GLshort y;
+		GLshort z;
+		trace_get(glad_replay, &index, sizeof(index));
+		trace_get(glad_replay, &x, sizeof(x));
+		trace_get(glad_replay, &y, sizeof(y));
+		trace_get(glad_replay, &z, sizeof(z));
+		if(glad_replay->unsupported) return 0;
+		glad_glVertexAttrib3s(index, x, y, z);
+	} break;
+	case 525: {
+		GLuint index;
+		const GLshort *v;
+		trace_get(glad_replay, &index, sizeof(index));
+		v = (const GLshort *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glVertexAttrib3sv(index, v);
+	} break;
+	case 526: {
+		GLuint index;
+		const GLbyte *v;
+		trace_get(glad_replay, &index, sizeof(index));
+		v = (const GLbyte *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glVertexAttrib4Nbv(index, v);
+	} break;
+	case 527: {
+		GLuint index;
+		const GLint *v;
+		trace_get(glad_replay, &index, sizeof(index));
+		v = (const GLint *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glVertexAttrib4Niv(index, v);
+	} break;
+	case 528: {
+		GLuint index;
+		const GLshort *v;
+		trace_get(glad_replay, &index, sizeof(index));
+		v = (const GLshort *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glVertexAttrib4Nsv(index, v);
+	} break;
+	case 529: {
+		GLuint index;
+		GLubyte x;
+		GLubyte y;
+		GLubyte z;
+		GLubyte w;
+		trace_get(glad_replay, &index, sizeof(index));
+		trace_get(glad_replay, &x, sizeof(x));
+		trace_get(glad_replay, &y, sizeof(y));
+		trace_get(glad_replay, &z, sizeof(z));
+		trace_get(glad_replay, &w, sizeof(w));
+		if(glad_replay->unsupported) return 0;
+		glad_glVertexAttrib4Nub(index, x, y, z, w);
+	} break;
+	case 530: {
+		GLuint index;
+		const GLubyte *v;
+		trace_get(glad_replay, &index, sizeof(index));
+		v = (const GLubyte *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glVertexAttrib4Nubv(index, v);
+	} break;
+	case 531: {
+		GLuint index;
+		const GLuint *v;
+		trace_get(glad_replay, &index, sizeof(index));
+		v = (const GLuint *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glVertexAttrib4Nuiv(index, v);
+	} break;
+	case 532: {
+		GLuint index;
+		const GLushort *v;
+		trace_get(glad_replay, &index, sizeof(index));
+		v = (const GLushort *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glVertexAttrib4Nusv(index, v);
+	} break;
+	case 533: {
+		GLuint index;
+		const GLbyte *v;
+		trace_get(glad_replay, &index, sizeof(index));
+		v = (const GLbyte *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glVertexAttrib4bv(index, v);
+	} break;
+	case 534: {
+		GLuint index;
+		GLdouble x;
+		GLdouble y;
+		GLdouble z;
+		GLdouble w;
+		trace_get(glad_replay, &index, sizeof(index));
+		trace_get(glad_replay, &x, sizeof(x));
+		trace_get(glad_replay, &y, sizeof(y));
+		trace_get(glad_replay, &z, sizeof(z));
+		trace_get(glad_replay, &w, sizeof(w));
+		if(glad_replay->unsupported) return 0;
+		glad_glVertexAttrib4d(index, x, y, z, w);
+	} break;
+	case 535: {
+		GLuint index;
+		const GLdouble *v;
+		trace_get(glad_replay, &index, sizeof(index));
+		v = (const GLdouble *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glVertexAttrib4dv(index, v);
+	} break;
+	case 536: {
+		GLuint index;
+		GLfloat x;
+		GLfloat y;
+		GLfloat z;
+		GLfloat w;
+		trace_get(glad_replay, &index, sizeof(index));
+		trace_get(glad_replay, &x, sizeof(x));
+		trace_get(glad_replay, &y, sizeof(y));
+		trace_get(glad_replay, &z, sizeof(z));
+		trace_get(glad_replay, &w, sizeof(w));
+		if(glad_replay->unsupported) return 0;
+		glad_glVertexAttrib4f(index, x, y, z, w);
+	} break;
+	case 537: {
+		GLuint index;
+		const GLfloat *v;
+		trace_get(glad_replay, &index, sizeof(index));
+		v = (const GLfloat *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glVertexAttrib4fv(index, v);
+	} break;
+	case 538: {
+		GLuint index;
+		const GLint *v;
+		trace_get(glad_replay, &index, sizeof(index));
+		v = (const GLint *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glVertexAttrib4iv(index, v);
+	} break;
+	case 539: {
+		GLuint index;
+		GLshort x;
+		GLshort y;
+		GLshort z;
+		GLshort w;
+		trace_get(glad_replay, &index, sizeof(index));
+		trace_get(glad_replay, &x, sizeof(x));
+		trace_get(glad_replay, &y, sizeof(y));
+		trace_get(glad_replay, &z, sizeof(z));
+		trace_get(glad_replay, &w, sizeof(w));
+		if(glad_replay->unsupported) return 0;
+		glad_glVertexAttrib4s(index, x, y, z, w);
+	} break;
+	case 540: {
+		GLuint index;
+		const GLshort *v;
+		trace_get(glad_replay, &index, sizeof(index));
+		v = (const GLshort *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glVertexAttrib4sv(index, v);
+	} break;
+	case 541: {
+		GLuint index;
+		const GLubyte *v;
+		trace_get(glad_replay, &index, sizeof(index));
+		v = (const GLubyte *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glVertexAttrib4ubv(index, v);
+	} break;
+	case 542: {
+		GLuint index;
+		const GLuint *v;
+		trace_get(glad_replay, &index, sizeof(index));
+		v = (const GLuint *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glVertexAttrib4uiv(index, v);
+	} break;
+	case 543: {
+		GLuint index;
+		const GLushort *v;
+		trace_get(glad_replay, &index, sizeof(index));
+		v = (const GLushort *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glVertexAttrib4usv(index, v);
+	} break;
+	case 544: {
+		GLuint index;
+		GLint size;
+		GLenum type;
+		GLboolean normalized;
+		GLsizei stride;
+		const void *pointer;
+		trace_get(glad_replay, &index, sizeof(index));
+		trace_get(glad_replay, &size, sizeof(size));
+		trace_get(glad_replay, &type, sizeof(type));
+		trace_get(glad_replay, &normalized, sizeof(normalized));
+		trace_get(glad_replay, &stride, sizeof(stride));
+		pointer = trace_get_offset(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glVertexAttribPointer(index, size, type, normalized, stride, pointer);
+	} break;
+	case 545: {
+		GLint location;
+		GLsizei count;
+		GLboolean transpose;
+		const GLfloat *value;
+		trace_get(glad_replay, &location, sizeof(location));
+		location = trace_map_location(glad_replay, location);
+		trace_get(glad_replay, &count, sizeof(count));
+		trace_get(glad_replay, &transpose, sizeof(transpose));
+		value = (const GLfloat *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glUniformMatrix2x3fv(location, count, transpose, value);
+	} break;
+	case 546: {
+		GLint location;
+		GLsizei count;
+		GLboolean transpose;
+		const GLfloat *value;
+		trace_get(glad_replay, &location, sizeof(location));
+		location = trace_map_location(glad_replay, location);
+		trace_get(glad_replay, &count, sizeof(count));
+		trace_get(glad_replay, &transpose, sizeof(transpose));
+		value = (const GLfloat *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glUniformMatrix3x2fv(location, count, transpose, value);
+	} break;
+	case 547: {
+		GLint location;
+		GLsizei count;
+		GLboolean transpose;
+		const GLfloat *value;
+		trace_get(glad_replay, &location, sizeof(location));
+		location = trace_map_location(glad_replay, location);
+		trace_get(glad_replay, &count, sizeof(count));
+		trace_get(glad_replay, &transpose, sizeof(transpose));
+		value = (const GLfloat *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glUniformMatrix2x4fv(location, count, transpose, value);
+	} break;
+	case 548: {
+		GLint location;
+		GLsizei count;
+		GLboolean transpose;
+		const GLfloat *value;
+		trace_get(glad_replay, &location, sizeof(location));
+		location = trace_map_location(glad_replay, location);
+		trace_get(glad_replay, &count, sizeof(count));
+		trace_get(glad_replay, &transpose, sizeof(transpose));
+		value = (const GLfloat *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glUniformMatrix4x2fv(location, count, transpose, value);
+	} break;
+	case 549: {
+		GLint location;
+		GLsizei count;
+		GLboolean transpose;
+		const GLfloat *value;
+		trace_get(glad_replay, &location, sizeof(location));
+		location = trace_map_location(glad_replay, location);
+		trace_get(glad_replay, &count, sizeof(count));
+		trace_get(glad_replay, &transpose, sizeof(transpose));
+		value = (const GLfloat *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glUniformMatrix3x4fv(location, count, transpose, value);
+	} break;
+	case 550: {
+		GLint location;
+		GLsizei count;
+		GLboolean transpose;
+		const GLfloat *value;
+		trace_get(glad_replay, &location, sizeof(location));
+		location = trace_map_location(glad_replay, location);
+		trace_get(glad_replay, &count, sizeof(count));
+		trace_get(glad_replay, &transpose, sizeof(transpose));
+		value = (const GLfloat *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glUniformMatrix4x3fv(location, count, transpose, value);
+	} break;
+	case 551: {
+		GLuint index;
+		GLboolean r;
+		GLboolean g;
+		GLboolean b;
+		GLboolean a;
+		trace_get(glad_replay, &index, sizeof(index));
+		trace_get(glad_replay, &r, sizeof(r));
+		trace_get(glad_replay, &g, sizeof(g));
+		trace_get(glad_replay, &b, sizeof(b));
+		trace_get(glad_replay, &a, sizeof(a));
+		if(glad_replay->unsupported) return 0;
+		glad_glColorMaski(index, r, g, b, a);
+	} break;
+	case 552: {
+		GLenum target;
+		GLuint index;
+		GLboolean *data;
+		trace_get(glad_replay, &target, sizeof(target));
+		trace_get(glad_replay, &index, sizeof(index));
+		data = (GLboolean *)trace_scratch(glad_replay, 0, TRACE_SCRATCH_DEFAULT);
+		if(glad_replay->unsupported) return 0;
+		glad_glGetBooleani_v(target, index, data);
+	} break;
+	case 553: {
+		GLenum target;
+		GLuint index;
+		GLint *data;
+		trace_get(glad_replay, &target, sizeof(target));
+		trace_get(glad_replay, &index, sizeof(index));
+		data = (GLint *)trace_scratch(glad_replay, 0, TRACE_SCRATCH_DEFAULT);
+		if(glad_replay->unsupported) return 0;
+		glad_glGetIntegeri_v(target, index, data);
+	} break;
+	case 554: {
+		GLenum target;
+		GLuint index;
+		trace_get(glad_replay, &target, sizeof(target));
+		trace_get(glad_replay, &index, sizeof(index));
+		if(glad_replay->unsupported) return 0;
+		glad_glEnablei(target, index);
+	} break;
+	case 555: {
+		GLenum target;
+		GLuint index;
+		trace_get(glad_replay, &target, sizeof(target));
+		trace_get(glad_replay, &index, sizeof(index));
+		if(glad_replay->unsupported) return 0;
+		glad_glDisablei(target, index);
+	} break;
+	case 556: {
+		GLenum target;
+		GLuint index;
+		GLboolean glad_result;
+		GLboolean recorded_result;
+		trace_get(glad_replay, &target, sizeof(target));
+		trace_get(glad_replay, &index, sizeof(index));
+		trace_get(glad_replay, &recorded_result, sizeof(recorded_result));
+		if(glad_replay->unsupported) return 0;
+		glad_result = glad_glIsEnabledi(target, index);
+		(void)glad_result;
+		(void)recorded_result;
+	} break;
+	case 557: {
+		GLenum primitiveMode;
+		trace_get(glad_replay, &primitiveMode, sizeof(primitiveMode));
+		if(glad_replay->unsupported) return 0;
+		glad_glBeginTransformFeedback(primitiveMode);
+	} break;
+	case 558: {
+		if(glad_replay->unsupported) return 0;
+		glad_glEndTransformFeedback();
+	} break;
+	case 559: {
+		GLenum target;
+		GLuint index;
+		GLuint buffer;
+		GLintptr offset;
+		GLsizeiptr size;
+		trace_get(glad_replay, &target, sizeof(target));
+		trace_get(glad_replay, &index, sizeof(index));
+		trace_get(glad_replay, &buffer, sizeof(buffer));
+		buffer = trace_map_name(glad_replay, TRACE_NS_BUFFER, buffer);
+		trace_get(glad_replay, &offset, sizeof(offset));
+		trace_get(glad_replay, &size, sizeof(size));
+		if(glad_replay->unsupported) return 0;
+		glad_glBindBufferRange(target, index, buffer, offset, size);
+	} break;
+	case 560: {
+		GLenum target;
+		GLuint index;
+		GLuint buffer;
+		trace_get(glad_replay, &target, sizeof(target));
+		trace_get(glad_replay, &index, sizeof(index));
+		trace_get(glad_replay, &buffer, sizeof(buffer));
+		buffer = trace_map_name(glad_replay, TRACE_NS_BUFFER, buffer);
+		if(glad_replay->unsupported) return 0;
+		glad_glBindBufferBase(target, index, buffer);
+	} break;
+	case 561: {
+		GLuint program;
+		GLsizei count;
+		const GLchar *const*varyings;
+		GLenum bufferMode;
+		trace_get(glad_replay, &program, sizeof(program));
+		program = trace_map_name(glad_replay, TRACE_NS_PROGRAM, program);
+		trace_get(glad_replay, &count, sizeof(count));
+		varyings = trace_get_strings(glad_replay, 0, count);
+		trace_get(glad_replay, &bufferMode, sizeof(bufferMode));
+		if(glad_replay->unsupported) return 0;
+		glad_glTransformFeedbackVaryings(program, count, varyings, bufferMode);
+	} break;
+	case 562: {
+		GLuint program;
+		GLuint index;
+		GLsizei bufSize;
+		GLsizei *length;
+		GLsizei *size;
+		GLenum *type;
+		GLchar *name;
+		trace_get(glad_replay, &program, sizeof(program));
+		program = trace_map_name(glad_replay, TRACE_NS_PROGRAM, program);
+		trace_get(glad_replay, &index, sizeof(index));
+		trace_get(glad_replay, &bufSize, sizeof(bufSize));
+		length = (GLsizei *)trace_scratch(glad_replay, 0, TRACE_SCRATCH_DEFAULT);
+		size = (GLsizei *)trace_scratch(glad_replay, 1, TRACE_SCRATCH_DEFAULT);
+		type = (GLenum *)trace_scratch(glad_replay, 2, TRACE_SCRATCH_DEFAULT);
+		name = (GLchar *)trace_scratch(glad_replay, 3, TRACE_SCRATCH_DEFAULT);
+		if(glad_replay->unsupported) return 0;
+		glad_glGetTransformFeedbackVarying(program, index, bufSize, length, size, type, name);
+	} break;
+	case 563: {
+		GLenum target;
+		GLenum clamp;
+		trace_get(glad_replay, &target, sizeof(target));
+		trace_get(glad_replay, &clamp, sizeof(clamp));
+		if(glad_replay->unsupported) return 0;
+		glad_glClampColor(target, clamp);
+	} break;
+	case 564: {
+		GLuint id;
+		GLenum mode;
+		trace_get(glad_replay, &id, sizeof(id));
+		trace_get(glad_replay, &mode, sizeof(mode));
+		if(glad_replay->unsupported) return 0;
+		glad_glBeginConditionalRender(id, mode);
+	} break;
+	case 565: {
+		if(glad_replay->unsupported) return 0;
+		glad_glEndConditionalRender();
+	} break;
+	case 566: {
+		GLuint index;
+		GLint size;
+		GLenum type;
+		GLsizei stride;
+		const void *pointer;
+		trace_get(glad_replay, &index, sizeof(index));
+		trace_get(glad_replay, &size, sizeof(size));
+		trace_get(glad_replay, &type, sizeof(type));
+		trace_get(glad_replay, &stride, sizeof(stride));
+		pointer = trace_get_offset(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glVertexAttribIPointer(index, size, type, stride, pointer);
+	} break;
+	case 567: {
+		GLuint index;
+		GLenum pname;
+		GLint *params;
+		trace_get(glad_replay, &index, sizeof(index));
+		trace_get(glad_replay, &pname, sizeof(pname));
+		params = (GLint *)trace_scratch(glad_replay, 0, TRACE_SCRATCH_DEFAULT);
+		if(glad_replay->unsupported) return 0;
+		glad_glGetVertexAttribIiv(index, pname, params);
+	} break;
+	case 568: {
+		GLuint index;
+		GLenum pname;
+		GLuint *params;
+		trace_get(glad_replay, &index, sizeof(index));
+		trace_get(glad_replay, &pname, sizeof(pname));
+		params = (GLuint *)trace_scratch(glad_replay, 0, TRACE_SCRATCH_DEFAULT);
+		if(glad_replay->unsupported) return 0;
+		glad_glGetVertexAttribIuiv(index, pname, params);
+	} break;
+	case 569: {
+		GLuint index;
+		GLint x;
+		trace_get(glad_replay, &index, sizeof(index));
+		trace_get(glad_replay, &x, sizeof(x));
+		if(glad_replay->unsupported) return 0;
+		glad_glVertexAttribI1i(index, x);
+	} break;
+	case 570: {
+		GLuint index;
+		GLint x;
+		GLint y;
+		trace_get(glad_replay, &index, sizeof(index));
+		trace_get(glad_replay, &x, sizeof(x));
+		trace_get(glad_replay, &y, sizeof(y));
+		if(glad_replay->unsupported) return 0;
+		glad_glVertexAttribI2i(index, x, y);
+	} break;
+	case 571: {
+		GLuint index;
+		GLint x;
+		GLint y;
+		GLint z;
+		trace_get(glad_replay, &index, sizeof(index));
+		trace_get(glad_replay, &x, sizeof(x));
+		trace_get(glad_replay, &y, sizeof(y));
+		trace_get(glad_replay, &z, sizeof(z));
+		if(glad_replay->unsupported) return 0;
+		glad_glVertexAttribI3i(index, x, y, z);
+	} break;
+	case 572: {
+		GLuint index;
+		GLint x;
+		GLint y;
+		GLint z;
+		GLint w;
+		trace_get(glad_replay, &index, sizeof(index));
+		trace_get(glad_replay, &x, sizeof(x));
+		trace_get(glad_replay, &y, sizeof(y));
+		trace_get(glad_replay, &z, sizeof(z));
+		trace_get(glad_replay, &w, sizeof(w));
+		if(glad_replay->unsupported) return 0;
+		glad_glVertexAttribI4i(index, x, y, z, w);
+	} break;
+	case 573: {
+		GLuint index;
+		GLuint x;
+		trace_get(glad_replay, &index, sizeof(index));
+		trace_get(glad_replay, &x, sizeof(x));
+		if(glad_replay->unsupported) return 0;
+		glad_glVertexAttribI1ui(index, x);
+	} break;
+	case 574: {
+		GLuint index;
+		GLuint x;
+		GLuint y;
+		trace_get(glad_replay, &index, sizeof(index));
+		trace_get(glad_replay, &x, sizeof(x));
+		trace_get(glad_replay, &y, sizeof(y));
+		if(glad_replay->unsupported) return 0;
+		glad_glVertexAttribI2ui(index, x, y);
+	} break;
+	case 575: {
+		GLuint index;
+		GLuint x;
+		GLuint y;
+		GLuint z;
+		trace_get(glad_replay, &index, sizeof(index));
+		trace_get(glad_replay, &x, sizeof(x));
+		trace_get(glad_replay, &y, sizeof(y));
+		trace_get(glad_replay, &z, sizeof(z));
+		if(glad_replay->unsupported) return 0;
+		glad_glVertexAttribI3ui(index, x, y, z);
+	} break;
+	case 576: {
+		GLuint index;
+		GLuint x;
+		GLuint y;
+		GLuint z;
+		GLuint w;
+		trace_get(glad_replay, &index, sizeof(index));
+		trace_get(glad_replay, &x, sizeof(x));
+		trace_get(glad_replay, &y, sizeof(y));
+		trace_get(glad_replay, &z, sizeof(z));
+		trace_get(glad_replay, &w, sizeof(w));
+		if(glad_replay->unsupported) return 0;
+		glad_glVertexAttribI4ui(index, x, y, z, w);
+	} break;
+	case 577: {
+		GLuint index;
+		const GLint *v;
+		trace_get(glad_replay, &index, sizeof(index));
+		v = (const GLint *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glVertexAttribI1iv(index, v);
+	} break;
+	case 578: {
+		GLuint index;
+		const GLint *v;
+		trace_get(glad_replay, &index, sizeof(index));
+		v = (const GLint *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glVertexAttribI2iv(index, v);
+	} break;
+	case 579: {
+		GLuint index;
+		const GLint *v;
+		trace_get(glad_replay, &index, sizeof(index));
+		v = (const GLint *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glVertexAttribI3iv(index, v);
+	} break;
+	case 580: {
+		GLuint index;
+		const GLint *v;
+		trace_get(glad_replay, &index, sizeof(index));
+		v = (const GLint *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glVertexAttribI4iv(index, v);
+	} break;
+	case 581: {
+		GLuint index;
+		const GLuint *v;
+		trace_get(glad_replay, &index, sizeof(index));
+		v = (const GLuint *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glVertexAttribI1uiv(index, v);
+	} break;
+	case 582: {
+		GLuint index;
+		const GLuint *v;
+		trace_get(glad_replay, &index, sizeof(index));
+		v = (const GLuint *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glVertexAttribI2uiv(index, v);
+	} break;
+	case 583: {
+		GLuint index;
+		const GLuint *v;
+		trace_get(glad_replay, &index, sizeof(index));
+		v = (const GLuint *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glVertexAttribI3uiv(index, v);
+	} break;
+	case 584: {
+		GLuint index;
+		const GLuint *v;
+		trace_get(glad_replay, &index, sizeof(index));
+		v = (const GLuint *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glVertexAttribI4uiv(index, v);
+	} break;
+	case 585: {
+		GLuint index;
+		const GLbyte *v;
+		trace_get(glad_replay, &index, sizeof(index));
+		v = (const GLbyte *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glVertexAttribI4bv(index, v);
+	} break;
+	case 586: {
+		GLuint index;
+		const GLshort *v;
+		trace_get(glad_replay, &index, sizeof(index));
+		v = (const GLshort *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glVertexAttribI4sv(index, v);
+	} break;
+	case 587: {
+		GLuint index;
+		const GLubyte *v;
+		trace_get(glad_replay, &index, sizeof(index));
+		v = (const GLubyte *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glVertexAttribI4ubv(index, v);
+	} break;
+	case 588: {
+		GLuint index;
+		const GLushort *v;
+		trace_get(glad_replay, &index, sizeof(index));
+		v = (const GLushort *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glVertexAttribI4usv(index, v);
+	} break;
+	case 589: {
+		GLuint program;
+		GLint location;
+		GLuint *params;
+		trace_get(glad_replay, &program, sizeof(program));
+		program = trace_map_name(glad_replay, TRACE_NS_PROGRAM, program);
+		trace_get(glad_replay, &location, sizeof(location));
+		params = (GLuint *)trace_scratch(glad_replay, 0, TRACE_SCRATCH_DEFAULT);
+		if(glad_replay->unsupported) return 0;
+		glad_glGetUniformuiv(program, location, params);
+	} break;
+	case 590: {
+		GLuint program;
+		GLuint color;
+		const GLchar *name;
+		trace_get(glad_replay, &program, sizeof(program));
+		program = trace_map_name(glad_replay, TRACE_NS_PROGRAM, program);
+		trace_get(glad_replay, &color, sizeof(color));
+		name = (const GLchar *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glBindFragDataLocation(program, color, name);
+	} break;
+	case 591: {
+		GLuint program;
+		const GLchar *name;
+		GLint glad_result;
+		GLint recorded_result;
+		trace_get(glad_replay, &program, sizeof(program));
+		program = trace_map_name(glad_replay, TRACE_NS_PROGRAM, program);
+		name = (const GLchar *)trace_get_data(glad_replay);
+		trace_get(glad_replay, &recorded_result, sizeof(recorded_result));
+		if(glad_replay->unsupported) return 0;
+		glad_result = glad_glGetFragDataLocation(program, name);
+		(void)glad_result;
+		(void)recorded_result;
+	} break;
+	case 592: {
+		GLint location;
+		GLuint v0;
+		trace_get(glad_replay, &location, sizeof(location));
+		location = trace_map_location(glad_replay, location);
+		trace_get(glad_replay, &v0, sizeof(v0));
+		if(glad_replay->unsupported) return 0;
+		glad_glUniform1ui(location, v0);
+	} break;
+	case 593: {
+		GLint location;
+		GLuint v0;
+		GLuint v1;
+		trace_get(glad_replay, &location, sizeof(location));
+		location = trace_map_location(glad_replay, location);
+		trace_get(glad_replay, &v0, sizeof(v0));
+		trace_get(glad_replay, &v1, sizeof(v1));
+		if(glad_replay->unsupported) return 0;
+		glad_glUniform2ui(location, v0, v1);
+	} break;
+	case 594: {
+		GLint location;
+		GLuint v0;
+		GLuint v1;
+		GLuint v2;
+		trace_get(glad_replay, &location, sizeof(location));
+		location = trace_map_location(glad_replay, location);
+		trace_get(glad_replay, &v0, sizeof(v0));
+		trace_get(glad_replay, &v1, sizeof(v1));
+		trace_get(glad_replay, &v2, sizeof(v2));
+		if(glad_replay->unsupported) return 0;
+		glad_glUniform3ui(location, v0, v1, v2);
+	} break;
+	case 595: {
+		GLint location;
+		GLuint v0;
+		GLuint v1;
+		GLuint v2;
+		GLuint v3;
+		trace_get(glad_replay, &location, sizeof(location));
+		location = trace_map_location(glad_replay, location);
+		trace_get(glad_replay, &v0, sizeof(v0));
+		trace_get(glad_replay, &v1, sizeof(v1));
+		trace_get(glad_replay, &v2, sizeof(v2));
+		trace_get(glad_replay, &v3, sizeof(v3));
+		if(glad_replay->unsupported) return 0;
+		glad_glUniform4ui(location, v0, v1, v2, v3);
+	} break;
+	case 596: {
+		GLint location;
+		GLsizei count;
+		const GLuint *value;
+		trace_get(glad_replay, &location, sizeof(location));
+		location = trace_map_location(glad_replay, location);
+		trace_get(glad_replay, &count, sizeof(count));
+		value = (const GLuint *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glUniform1uiv(location, count, value);
+	} break;
+	case 597: {
+		GLint location;
+		GLsizei count;
+		const GLuint *value;
+		trace_get(glad_replay, &location, sizeof(location));
+		location = trace_map_location(glad_replay, location);
+		trace_get(glad_replay, &count, sizeof(count));
+		value = (const GLuint *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glUniform2uiv(location, count, value);
+	} break;
+	case 598: {
+		GLint location;
+		GLsizei count;
+		const GLuint *value;
+		trace_get(glad_replay, &location, sizeof(location));
+		location = trace_map_location(glad_replay, location);
+		trace_get(glad_replay, &count, sizeof(count));
+		value = (const GLuint *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glUniform3uiv(location, count, value);
+	} break;
+	case 599: {
+		GLint location;
+		GLsizei count;
+		const GLuint *value;
+		trace_get(glad_replay, &location, sizeof(location));
+		location = trace_map_location(glad_replay, location);
+		trace_get(glad_replay, &count, sizeof(count));
+		value = (const GLuint *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glUniform4uiv(location, count, value);
+	} break;
+	case 600: {
+		GLenum target;
+		GLenum pname;
+		const GLint *params;
+		trace_get(glad_replay, &target, sizeof(target));
+		trace_get(glad_replay, &pname, sizeof(pname));
+		params = (const GLint *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glTexParameterIiv(target, pname, params);
+	} break;
+	case 601: {
+		GLenum target;
+		GLenum pname;
+		const GLuint *params;
+		trace_get(glad_replay, &target, sizeof(target));
+		trace_get(glad_replay, &pname, sizeof(pname));
+		params = (const GLuint *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glTexParameterIuiv(target, pname, params);
+	} break;
+	case 602: {
+		GLenum target;
+		GLenum pname;
+		GLint *params;
+		trace_get(glad_replay, &target, sizeof(target));
+		trace_get(glad_replay, &pname, sizeof(pname));
+		params = (GLint *)trace_scratch(glad_replay, 0, TRACE_SCRATCH_DEFAULT);
+		if(glad_replay->unsupported) return 0;
+		glad_glGetTexParameterIiv(target, pname, params);
+	} break;
+	case 603: {
+		GLenum target;
+		GLenum pname;
+		GLuint *params;
+		trace_get(glad_replay, &target, sizeof(target));
+		trace_get(glad_replay, &pname, sizeof(pname));
+		params = (GLuint *)trace_scratch(glad_replay, 0, TRACE_SCRATCH_DEFAULT);
+		if(glad_replay->unsupported) return 0;
+		glad_glGetTexParameterIuiv(target, pname, params);
+	} break;
+	case 604: {
+		GLenum buffer;
+		GLint drawbuffer;
+		const GLint *value;
+		trace_get(glad_replay, &buffer, sizeof(buffer));
+		trace_get(glad_replay, &drawbuffer, sizeof(drawbuffer));
+		value = (const GLint *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glClearBufferiv(buffer, drawbuffer, value);
+	} break;
+	case 605: {
+		GLenum buffer;
+		GLint drawbuffer;
+		const GLuint *value;
+		trace_get(glad_replay, &buffer, sizeof(buffer));
+		trace_get(glad_replay, &drawbuffer, sizeof(drawbuffer));
+		value = (const GLuint *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glClearBufferuiv(buffer, drawbuffer, value);
+	} break;
+	case 606: {
+		GLenum buffer;
+		GLint drawbuffer;
+		const GLfloat *value;
+		trace_get(glad_replay, &buffer, sizeof(buffer));
+		trace_get(glad_replay, &drawbuffer, sizeof(drawbuffer));
+		value = (const GLfloat *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glClearBufferfv(buffer, drawbuffer, value);
+	} break;
+	case 607: {
+		GLenum buffer;
+		GLint drawbuffer;
+		GLfloat depth;
+		GLint stencil;
+		trace_get(glad_replay, &buffer, sizeof(buffer));
+		trace_get(glad_replay, &drawbuffer, sizeof(drawbuffer));
+		trace_get(glad_replay, &depth, sizeof(depth));
+		trace_get(glad_replay, &stencil, sizeof(stencil));
+		if(glad_replay->unsupported) return 0;
+		glad_glClearBufferfi(buffer, drawbuffer, depth, stencil);
+	} break;
+	case 608: {
+		GLenum name;
+		GLuint index;
+		const GLubyte * glad_result;
+		trace_get(glad_replay, &name, sizeof(name));
+		trace_get(glad_replay, &index, sizeof(index));
+		if(glad_replay->unsupported) return 0;
+		glad_result = glad_glGetStringi(name, index);
+		(void)glad_result;
+	} break;
+	case 609: {
+		GLuint renderbuffer;
+		GLboolean glad_result;
+		GLboolean recorded_result;
+		trace_get(glad_replay, &renderbuffer, sizeof(renderbuffer));
+		renderbuffer = trace_map_name(glad_replay, TRACE_NS_RENDERBUFFER, renderbuffer);
+		trace_get(glad_replay, &recorded_result, sizeof(recorded_result));
+		if(glad_replay->unsupported) return 0;
+		glad_result = glad_glIsRenderbuffer(renderbuffer);
+		(void)glad_result;
+		(void)recorded_result;
+	} break;
+	case 610: {
+		GLenum target;
+		GLuint renderbuffer;
+		trace_get(glad_replay, &target, sizeof(target));
+		trace_get(glad_replay, &renderbuffer, sizeof(renderbuffer));
+		renderbuffer = trace_map_name(glad_replay, TRACE_NS_RENDERBUFFER, renderbuffer);
+		if(glad_replay->unsupported) return 0;
+		glad_glBindRenderbuffer(target, renderbuffer);
+	} break;
+	case 611: {
+		GLsizei n;
+		const GLuint *recorded_renderbuffers;
+		GLuint *renderbuffers;
+		trace_get(glad_replay, &n, sizeof(n));
+		recorded_renderbuffers = (const GLuint *)trace_get_data(glad_replay);
+		renderbuffers = trace_map_names(glad_replay, 0, TRACE_NS_RENDERBUFFER, recorded_renderbuffers, n);
+		if(glad_replay->unsupported) return 0;
+		glad_glDeleteRenderbuffers(n, renderbuffers);
+		trace_unbind_names(glad_replay, TRACE_NS_RENDERBUFFER, recorded_renderbuffers, n);
+	} break;
+	case 612: {
+		GLsizei n;
+		const GLuint *recorded_renderbuffers;
+		GLuint *renderbuffers;
+		trace_get(glad_replay, &n, sizeof(n));
+		recorded_renderbuffers = (const GLuint *)trace_get_data(glad_replay);
+		renderbuffers = (GLuint *)trace_scratch(glad_replay, 0, (size_t)n * sizeof(GLuint));
+		if(glad_replay->unsupported) return 0;
+		if(!trace_names_bound(glad_replay, TRACE_NS_RENDERBUFFER, recorded_renderbuffers, n)) {
+			glad_glGenRenderbuffers(n, renderbuffers);
+			trace_bind_names(glad_replay, TRACE_NS_RENDERBUFFER, recorded_renderbuffers, renderbuffers, n);
+		}
+	} break;
+	case 613: {
+		GLenum target;
+		GLenum internalformat;
+		GLsizei width;
+		GLsizei height;
+		trace_get(glad_replay, &target, sizeof(target));
+		trace_get(glad_replay, &internalformat, sizeof(internalformat));
+		trace_get(glad_replay, &width, sizeof(width));
+		trace_get(glad_replay, &height, sizeof(height));
+		if(glad_replay->unsupported) return 0;
+		glad_glRenderbufferStorage(target, internalformat, width, height);
+	} break;
+	case 614: {
+		GLenum target;
+		GLenum pname;
+		GLint *params;
+		trace_get(glad_replay, &target, sizeof(target));
+		trace_get(glad_replay, &pname, sizeof(pname));
+		params = (GLint *)trace_scratch(glad_replay, 0, TRACE_SCRATCH_DEFAULT);
+		if(glad_replay->unsupported) return 0;
+		glad_glGetRenderbufferParameteriv(target, pname, params);
+	} break;
+	case 615: {
+		GLuint framebuffer;
+		GLboolean glad_result;
+		GLboolean recorded_result;
+		trace_get(glad_replay, &framebuffer, sizeof(framebuffer));
+		framebuffer = trace_map_name(glad_replay, TRACE_NS_FRAMEBUFFER, framebuffer);
+		trace_get(glad_replay, &recorded_result, sizeof(recorded_result));
+		if(glad_replay->unsupported) return 0;
+		glad_result = glad_glIsFramebuffer(framebuffer);
+		(void)glad_result;
+		(void)recorded_result;
+	} break;
+	case 616: {
+		GLenum target;
+		GLuint framebuffer;
+		trace_get(glad_replay, &target, sizeof(target));
+		trace_get(glad_replay, &framebuffer, sizeof(framebuffer));
+		framebuffer = trace_map_name(glad_replay, TRACE_NS_FRAMEBUFFER, framebuffer);
+		if(glad_replay->unsupported) return 0;
+		glad_glBindFramebuffer(target, framebuffer);
+	} break;
+	case 617: {
+		GLsizei n;
+		const GLuint *recorded_framebuffers;
+		GLuint *framebuffers;
+		trace_get(glad_replay, &n, sizeof(n));
+		recorded_framebuffers = (const GLuint *)trace_get_data(glad_replay);
+		framebuffers = trace_map_names(glad_replay, 0, TRACE_NS_FRAMEBUFFER, recorded_framebuffers, n);
+		if(glad_replay->unsupported) return 0;
+		glad_glDeleteFramebuffers(n, framebuffers);
+		trace_unbind_names(glad_replay, TRACE_NS_FRAMEBUFFER, recorded_framebuffers, n);
+	} break;
+	case 618: {
+		GLsizei n;
+		const GLuint *recorded_framebuffers;
+		GLuint *framebuffers;
+		trace_get(glad_replay, &n, sizeof(n));
+		recorded_framebuffers = (const GLuint *)trace_get_data(glad_replay);
+		framebuffers = (GLuint *)trace_scratch(glad_replay, 0, (size_t)n * sizeof(GLuint));
+		if(glad_replay->unsupported) return 0;
+		if(!trace_names_bound(glad_replay, TRACE_NS_FRAMEBUFFER, recorded_framebuffers, n)) {
+			glad_glGenFramebuffers(n, framebuffers);
+			trace_bind_names(glad_replay, TRACE_NS_FRAMEBUFFER, recorded_framebuffers, framebuffers, n);
+		}
+	} break;
+	case 619: {
+		GLenum target;
+		GLenum glad_result;
+		GLenum recorded_result;
+		trace_get(glad_replay, &target, sizeof(target));
+		trace_get(glad_replay, &recorded_result, sizeof(recorded_result));
+		if(glad_replay->unsupported) return 0;
+		glad_result = glad_glCheckFramebufferStatus(target);
+		(void)glad_result;
+		(void)recorded_result;
+	} break;
+	case 620: {
+		GLenum target;
+		GLenum attachment;
+		GLenum textarget;
+		GLuint texture;
+		GLint level;
+		trace_get(glad_replay, &target, sizeof(target));
+		trace_get(glad_replay, &attachment, sizeof(attachment));
+		trace_get(glad_replay, &textarget, sizeof(textarget));
+		trace_get(glad_replay, &texture, sizeof(texture));
+		texture = trace_map_name(glad_replay, TRACE_NS_TEXTURE, texture);
+		trace_get(glad_replay, &level, sizeof(level));
+		if(glad_replay->unsupported) return 0;
+		glad_glFramebufferTexture1D(target, attachment, textarget, texture, level);
+	} break;
+	case 621: {
+		GLenum target;
+		GLenum attachment;
+		GLenum textarget;
+		GLuint texture;
+		GLint level;
+		trace_get(glad_replay, &target, sizeof(target));
+		trace_get(glad_replay, &attachment, sizeof(attachment));
+		trace_get(glad_replay, &textarget, sizeof(textarget));
+		trace_get(glad_replay, &texture, sizeof(texture));
+		texture = trace_map_name(glad_replay, TRACE_NS_TEXTURE, texture);
+		trace_get(glad_replay, &level, sizeof(level));
+		if(glad_replay->unsupported) return 0;
+		glad_glFramebufferTexture2D(target, attachment, textarget, texture, level);
+	} break;
+	case 622: {
+		GLenum target;
+		GLenum attachment;
+		GLenum textarget;
+		GLuint texture;
+		GLint level;
+		GLint zoffset;
+		trace_get(glad_replay, &target, sizeof(target));
+		trace_get(glad_replay, &attachment, sizeof(attachment));
+		trace_get(glad_replay, &textarget, sizeof(textarget));
+		trace_get(glad_replay, &texture, sizeof(texture));
+		texture = trace_map_name(glad_replay, TRACE_NS_TEXTURE, texture);
+		trace_get(glad_replay, &level, sizeof(level));
+		trace_get(glad_replay, &zoffset, sizeof(zoffset));
+		if(glad_replay->unsupported) return 0;
+		glad_glFramebufferTexture3D(target, attachment, textarget, texture, level, zoffset);
+	} break;
+	case 623: {
+		GLenum target;
+		GLenum attachment;
+		GLenum renderbuffertarget;
+		GLuint renderbuffer;
+		trace_get(glad_replay, &target, sizeof(target));
+		trace_get(glad_replay, &attachment, sizeof(attachment));
+		trace_get(glad_replay, &renderbuffertarget, sizeof(renderbuffertarget));
+		trace_get(glad_replay, &renderbuffer, sizeof(renderbuffer));
+		renderbuffer = trace_map_name(glad_replay, TRACE_NS_RENDERBUFFER, renderbuffer);
+		if(glad_replay->unsupported) return 0;
+		glad_glFramebufferRenderbuffer(target, attachment, renderbuffertarget, renderbuffer);
+	} break;
+	case 624: {
+		GLenum target;
+		GLenum attachment;
+		GLenum pname;
+		GLint *params;
+		trace_get(glad_replay, &target, sizeof(target));
+		trace_get(glad_replay, &attachment, sizeof(attachment));
+		trace_get(glad_replay, &pname, sizeof(pname));
+		params = (GLint *)trace_scratch(glad_replay, 0, TRACE_SCRATCH_DEFAULT);
+		if(glad_replay->unsupported) return 0;
+		glad_glGetFramebufferAttachmentParameteriv(target, attachment, pname, params);
+	} break;
+	case 625: {
+		GLenum target;
+		trace_get(glad_replay, &target, sizeof(target));
+		if(glad_replay->unsupported) return 0;
+		glad_glGenerateMipmap(target);
+	} break;
+	case 626: {
+		GLint srcX0;
+		GLint srcY0;
+		GLint srcX1;
+		GLint srcY1;
+		GLint dstX0;
+		GLint dstY0;
+		GLint dstX1;
+		GLint dstY1;
+		GLbitfield mask;
+		GLenum filter;
+		trace_get(glad_replay, &srcX0, sizeof(srcX0));
+		trace_get(glad_replay, &srcY0, sizeof(srcY0));
+		trace_get(glad_replay, &srcX1, sizeof(srcX1));
+		trace_get(glad_replay, &srcY1, sizeof(srcY1));
+		trace_get(glad_replay, &dstX0, sizeof(dstX0));
+		trace_get(glad_replay, &dstY0, sizeof(dstY0));
+		trace_get(glad_replay, &dstX1, sizeof(dstX1));
+		trace_get(glad_replay, &dstY1, sizeof(dstY1));
+		trace_get(glad_replay, &mask, sizeof(mask));
+		trace_get(glad_replay, &filter, sizeof(filter));
+		if(glad_replay->unsupported) return 0;
+		glad_glBlitFramebuffer(srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
+	} break;
+	case 627: {
+		GLenum target;
+		GLsizei samples;
+		GLenum internalformat;
+		GLsizei width;
+		GLsizei height;
+		trace_get(glad_replay, &target, sizeof(target));
+		trace_get(glad_replay, &samples, sizeof(samples));
+		trace_get(glad_replay, &internalformat, sizeof(internalformat));
+		trace_get(glad_replay, &width, sizeof(width));
+		trace_get(glad_replay, &height, sizeof(height));
+		if(glad_replay->unsupported) return 0;
+		glad_glRenderbufferStorageMultisample(target, samples, internalformat, width, height);
+	} break;
+	case 628: {
+		GLenum target;
+		GLenum attachment;
+		GLuint texture;
+		GLint level;
+		GLint layer;
+		trace_get(glad_replay, &target, sizeof(target));
+		trace_get(glad_replay, &attachment, sizeof(attachment));
+		trace_get(glad_replay, &texture, sizeof(texture));
+		texture = trace_map_name(glad_replay, TRACE_NS_TEXTURE, texture);
+		trace_get(glad_replay, &level, sizeof(level));
+		trace_get(glad_replay, &layer, sizeof(layer));
+		if(glad_replay->unsupported) return 0;
+		glad_glFramebufferTextureLayer(target, attachment, texture, level, layer);
+	} break;
+	case 629: {
+		GLenum target;
+		GLintptr offset;
+		GLsizeiptr length;
+		GLbitfield access;
+		void * glad_result;
+		trace_get(glad_replay, &target, sizeof(target));
+		trace_get(glad_replay, &offset, sizeof(offset));
+		trace_get(glad_replay, &length, sizeof(length));
+		trace_get(glad_replay, &access, sizeof(access));
+		if(glad_replay->unsupported) return 0;
+		glad_result = glad_glMapBufferRange(target, offset, length, access & ~(GLbitfield)GL_MAP_FLUSH_EXPLICIT_BIT);
+		(void)glad_result;
+		trace_replay_map(glad_replay, target, glad_result);
+	} break;
+	case 630: {
+		GLenum target;
+		GLintptr offset;
+		GLsizeiptr length;
+		trace_get(glad_replay, &target, sizeof(target));
+		trace_get(glad_replay, &offset, sizeof(offset));
+		trace_get(glad_replay, &length, sizeof(length));
+		glad_replay->unsupported = 1;
+		if(glad_replay->unsupported) return 0;
+		glad_glFlushMappedBufferRange(target, offset, length);
+	} break;
+	case 631: {
+		GLuint array;
+		trace_get(glad_replay, &array, sizeof(array));
+		array = trace_map_name(glad_replay, TRACE_NS_VERTEX_ARRAY, array);
+		if(glad_replay->unsupported) return 0;
+		glad_glBindVertexArray(array);
+	} break;
+	case 632: {
+		GLsizei n;
+		const GLuint *recorded_arrays;
+		GLuint *arrays;
+		trace_get(glad_replay, &n, sizeof(n));
+		recorded_arrays = (const GLuint *)trace_get_data(glad_replay);
+		arrays = trace_map_names(glad_replay, 0, TRACE_NS_VERTEX_ARRAY, recorded_arrays, n);
+		if(glad_replay->unsupported) return 0;
+		glad_glDeleteVertexArrays(n, arrays);
+		trace_unbind_names(glad_replay, TRACE_NS_VERTEX_ARRAY, recorded_arrays, n);
+	} break;
+	case 633: {
+		GLsizei n;
+		const GLuint *recorded_arrays;
+		GLuint *arrays;
+		trace_get(glad_replay, &n, sizeof(n));
+		recorded_arrays = (const GLuint *)trace_get_data(glad_replay);
+		arrays = (GLuint *)trace_scratch(glad_replay, 0, (size_t)n * sizeof(GLuint));
+		if(glad_replay->unsupported) return 0;
+		if(!trace_names_bound(glad_replay, TRACE_NS_VERTEX_ARRAY, recorded_arrays, n)) {
+			glad_glGenVertexArrays(n, arrays);
+			trace_bind_names(glad_replay, TRACE_NS_VERTEX_ARRAY, recorded_arrays, arrays, n);
+		}
+	} break;
+	case 634: {
+		GLuint array;
+		GLboolean glad_result;
+		GLboolean recorded_result;
+		trace_get(glad_replay, &array, sizeof(array));
+		array = trace_map_name(glad_replay, TRACE_NS_VERTEX_ARRAY, array);
+		trace_get(glad_replay, &recorded_result, sizeof(recorded_result));
+		if(glad_replay->unsupported) return 0;
+		glad_result = glad_glIsVertexArray(array);
+		(void)glad_result;
+		(void)recorded_result;
+	} break;
+	case 635: {
+		GLenum mode;
+		GLint first;
+		GLsizei count;
+		GLsizei instancecount;
+		trace_get(glad_replay, &mode, sizeof(mode));
+		trace_get(glad_replay, &first, sizeof(first));
+		trace_get(glad_replay, &count, sizeof(count));
+		trace_get(glad_replay, &instancecount, sizeof(instancecount));
+		if(glad_replay->unsupported) return 0;
+		glad_glDrawArraysInstanced(mode, first, count, instancecount);
+	} break;
+	case 636: {
+		GLenum mode;
+		GLsizei count;
+		GLenum type;
+		const void *indices;
+		GLsizei instancecount;
+		trace_get(glad_replay, &mode, sizeof(mode));
+		trace_get(glad_replay, &count, sizeof(count));
+		trace_get(glad_replay, &type, sizeof(type));
+		indices = trace_get_offset(glad_replay);
+		trace_get(glad_replay, &instancecount, sizeof(instancecount));
+		if(glad_replay->unsupported) return 0;
+		glad_glDrawElementsInstanced(mode, count, type, indices, instancecount);
+	} break;
+	case 637: {
+		GLenum target;
+		GLenum internalformat;
+		GLuint buffer;
+		trace_get(glad_replay, &target, sizeof(target));
+		trace_get(glad_replay, &internalformat, sizeof(internalformat));
+		trace_get(glad_replay, &buffer, sizeof(buffer));
+		buffer = trace_map_name(glad_replay, TRACE_NS_BUFFER, buffer);
+		if(glad_replay->unsupported) return 0;
+		glad_glTexBuffer(target, internalformat, buffer);
+	} break;
+	case 638: {
+		GLuint index;
+		trace_get(glad_replay, &index, sizeof(index));
+		if(glad_replay->unsupported) return 0;
+		glad_glPrimitiveRestartIndex(index);
+	} break;
+	case 639: {
+		GLenum readTarget;
+		GLenum writeTarget;
+		GLintptr readOffset;
+		GLintptr writeOffset;
+		GLsizeiptr size;
+		trace_get(glad_replay, &readTarget, sizeof(readTarget));
+		trace_get(glad_replay, &writeTarget, sizeof(writeTarget));
+		trace_get(glad_replay, &readOffset, sizeof(readOffset));
+		trace_get(glad_replay, &writeOffset, sizeof(writeOffset));
+		trace_get(glad_replay, &size, sizeof(size));
+		if(glad_replay->unsupported) return 0;
+		glad_glCopyBufferSubData(readTarget, writeTarget, readOffset, writeOffset, size);
+	} break;
+	case 640: {
+		GLuint program;
+		GLsizei uniformCount;
+		const GLchar *const*uniformNames;
+		GLuint *uniformIndices;
+		trace_get(glad_replay, &program, sizeof(program));
+		program = trace_map_name(glad_replay, TRACE_NS_PROGRAM, program);
+		trace_get(glad_replay, &uniformCount, sizeof(uniformCount));
+		uniformNames = trace_get_strings(glad_replay, 0, uniformCount);
+		uniformIndices = (GLuint *)trace_scratch(glad_replay, 1, (size_t)uniformCount * sizeof(GLuint));
+		if(glad_replay->unsupported) return 0;
+		glad_glGetUniformIndices(program, uniformCount, uniformNames, uniformIndices);
+	} break;
+	case 641: {
+		GLuint program;
+		GLsizei uniformCount;
+		const GLuint *uniformIndices;
+		GLenum pname;
+		GLint *params;
+		trace_get(glad_replay, &program, sizeof(program));
+		program = trace_map_name(glad_replay, TRACE_NS_PROGRAM, program);
+		trace_get(glad_replay, &uniformCount, sizeof(uniformCount));
+		uniformIndices = (const GLuint *)trace_get_data(glad_replay);
+		trace_get(glad_replay, &pname, sizeof(pname));
+		params = (GLint *)trace_scratch(glad_replay, 0, (size_t)uniformCount * sizeof(GLint));
+		if(glad_replay->unsupported) return 0;
+		glad_glGetActiveUniformsiv(program, uniformCount, uniformIndices, pname, params);
+	} break;
+	case 642: {
+		GLuint program;
+		GLuint uniformIndex;
+		GLsizei bufSize;
+		GLsizei *length;
+		GLchar *uniformName;
+		trace_get(glad_replay, &program, sizeof(program));
+		program = trace_map_name(glad_replay, TRACE_NS_PROGRAM, program);
+		trace_get(glad_replay, &uniformIndex, sizeof(uniformIndex));
+		trace_get(glad_replay, &bufSize, sizeof(bufSize));
+		length = (GLsizei *)trace_scratch(glad_replay, 0, TRACE_SCRATCH_DEFAULT);
+		uniformName = (GLchar *)trace_scratch(glad_replay, 1, TRACE_SCRATCH_DEFAULT);
+		if(glad_replay->unsupported) return 0;
+		glad_glGetActiveUniformName(program, uniformIndex, bufSize, length, uniformName);
+	} break;
+	case 643: {
+		GLuint program;
+		const GLchar *uniformBlockName;
+		GLuint glad_result;
+		GLuint recorded_result;
+		trace_get(glad_replay, &program, sizeof(program));
+		program = trace_map_name(glad_replay, TRACE_NS_PROGRAM, program);
+		uniformBlockName = (const GLchar *)trace_get_data(glad_replay);
+		trace_get(glad_replay, &recorded_result, sizeof(recorded_result));
+		if(glad_replay->unsupported) return 0;
+		glad_result = glad_glGetUniformBlockIndex(program, uniformBlockName);
+		(void)glad_result;
+		(void)recorded_result;
+	} break;
+	case 644: {
+		GLuint program;
+		GLuint uniformBlockIndex;
+		GLenum pname;
+		GLint *params;
+		trace_get(glad_replay, &program, sizeof(program));
+		program = trace_map_name(glad_replay, TRACE_NS_PROGRAM, program);
+		trace_get(glad_replay, &uniformBlockIndex, sizeof(uniformBlockIndex));
+		trace_get(glad_replay, &pname, sizeof(pname));
+		params = (GLint *)trace_scratch(glad_replay, 0, TRACE_SCRATCH_DEFAULT);
+		if(glad_replay->unsupported) return 0;
+		glad_glGetActiveUniformBlockiv(program, uniformBlockIndex, pname, params);
+	} break;
+	case 645: {
+		GLuint program;
+		GLuint uniformBlockIndex;
+		GLsizei bufSize;
+		GLsizei *length;
+		GLchar *uniformBlockName;
+		trace_get(glad_replay, &program, sizeof(program));
+		program = trace_map_name(glad_replay, TRACE_NS_PROGRAM, program);
+		trace_get(glad_replay, &uniformBlockIndex, sizeof(uniformBlockIndex));
+		trace_get(glad_replay, &bufSize, sizeof(bufSize));
+		length = (GLsizei *)trace_scratch(glad_replay, 0, TRACE_SCRATCH_DEFAULT);
+		uniformBlockName = (GLchar *)trace_scratch(glad_replay, 1, TRACE_SCRATCH_DEFAULT);
+		if(glad_replay->unsupported) return 0;
+		glad_glGetActiveUniformBlockName(program, uniformBlockIndex, bufSize, length, uniformBlockName);
+	} break;
+	case 646: {
+		GLuint program;
+		GLuint uniformBlockIndex;
+		GLuint uniformBlockBinding;
+		trace_get(glad_replay, &program, sizeof(program));
+		program = trace_map_name(glad_replay, TRACE_NS_PROGRAM, program);
+		trace_get(glad_replay, &uniformBlockIndex, sizeof(uniformBlockIndex));
+		trace_get(glad_replay, &uniformBlockBinding, sizeof(uniformBlockBinding));
+		if(glad_replay->unsupported) return 0;
+		glad_glUniformBlockBinding(program, uniformBlockIndex, uniformBlockBinding);
+	} break;
+	case 647: {
+		GLenum mode;
+		GLsizei count;
+		GLenum type;
+		const void *indices;
+		GLint basevertex;
+		trace_get(glad_replay, &mode, sizeof(mode));
+		trace_get(glad_replay, &count, sizeof(count));
+		trace_get(glad_replay, &type, sizeof(type));
+		indices = trace_get_offset(glad_replay);
+		trace_get(glad_replay, &basevertex, sizeof(basevertex));
+		if(glad_replay->unsupported) return 0;
+		glad_glDrawElementsBaseVertex(mode, count, type, indices, basevertex);
+	} break;
+	case 648: {
+		GLenum mode;
+		GLuint start;
+		GLuint end;
+		GLsizei count;
+		GLenum type;
+		const void *indices;
+		GLint basevertex;
+		trace_get(glad_replay, &mode, sizeof(mode));
+		trace_get(glad_replay, &start, sizeof(start));
+		trace_get(glad_replay, &end, sizeof(end));
+		trace_get(glad_replay, &count, sizeof(count));
+		trace_get(glad_replay, &type, sizeof(type));
+		indices = trace_get_offset(glad_replay);
+		trace_get(glad_replay, &basevertex, sizeof(basevertex));
+		if(glad_replay->unsupported) return 0;
+		glad_glDrawRangeElementsBaseVertex(mode, start, end, count, type, indices, basevertex);
+	} break;
+	case 649: {
+		GLenum mode;
+		GLsizei count;
+		GLenum type;
+		const void *indices;
+		GLsizei instancecount;
+		GLint basevertex;
+		trace_get(glad_replay, &mode, sizeof(mode));
+		trace_get(glad_replay, &count, sizeof(count));
+		trace_get(glad_replay, &type, sizeof(type));
+		indices = trace_get_offset(glad_replay);
+		trace_get(glad_replay, &instancecount, sizeof(instancecount));
+		trace_get(glad_replay, &basevertex, sizeof(basevertex));
+		if(glad_replay->unsupported) return 0;
+		glad_glDrawElementsInstancedBaseVertex(mode, count, type, indices, instancecount, basevertex);
+	} break;
+	case 650: {
+		GLenum mode;
+		const GLsizei *count;
+		GLenum type;
+		const void *const*indices;
+		GLsizei drawcount;
+		const GLint *basevertex;
+		trace_get(glad_replay, &mode, sizeof(mode));
+		trace_get_unsupported(glad_replay);
+		count = NULL;
+		trace_get(glad_replay, &type, sizeof(type));
+		trace_get_unsupported(glad_replay);
+		indices = NULL;
+		trace_get(glad_replay, &drawcount, sizeof(drawcount));
+		trace_get_unsupported(glad_replay);
+		basevertex = NULL;
+		if(glad_replay->unsupported) return 0;
+		glad_glMultiDrawElementsBaseVertex(mode, count, type, indices, drawcount, basevertex);
+	} break;
+	case 651: {
+		GLenum mode;
+		trace_get(glad_replay, &mode, sizeof(mode));
+		if(glad_replay->unsupported) return 0;
+		glad_glProvokingVertex(mode);
+	} break;
+	case 652: {
+		GLenum condition;
+		GLbitfield flags;
+		GLsync glad_result;
+		GLsync recorded_result;
+		trace_get(glad_replay, &condition, sizeof(condition));
+		trace_get(glad_replay, &flags, sizeof(flags));
+		trace_get(glad_replay, &recorded_result, sizeof(recorded_result));
+		if(glad_replay->unsupported) return 0;
+		glad_result = glad_glFenceSync(condition, flags);
+		(void)glad_result;
+		(void)recorded_result;
+		trace_bind_sync(glad_replay, recorded_result, glad_result);
+	} break;
+	case 653: {
+		GLsync sync;
+		GLboolean glad_result;
+		GLboolean recorded_result;
+		trace_get(glad_replay, &sync, sizeof(sync));
+		sync = trace_map_sync(glad_replay, sync);
+		trace_get(glad_replay, &recorded_result, sizeof(recorded_result));
+		if(glad_replay->unsupported) return 0;
+		glad_result = glad_glIsSync(sync);
+		(void)glad_result;
+		(void)recorded_result;
+	} break;
+	case 654: {
+		GLsync sync;
+		trace_get(glad_replay, &sync, sizeof(sync));
+		sync = trace_map_sync(glad_replay, sync);
+		if(glad_replay->unsupported) return 0;
+		glad_glDeleteSync(sync);
+	} break;
+	case 655: {
+		GLsync sync;
+		GLbitfield flags;
+		GLuint64 timeout;
+		GLenum glad_result;
+		GLenum recorded_result;
+		trace_get(glad_replay, &sync, sizeof(sync));
+		sync = trace_map_sync(glad_replay, sync);
+		trace_get(glad_replay, &flags, sizeof(flags));
+		trace_get(glad_replay, &timeout, sizeof(timeout));
+		trace_get(glad_replay, &recorded_result, sizeof(recorded_result));
+		if(glad_replay->unsupported) return 0;
+		glad_result = glad_glClientWaitSync(sync, flags, timeout);
+		(void)glad_result;
+		(void)recorded_result;
+	} break;
+	case 656: {
+		GLsync sync;
+		GLbitfield flags;
+		GLuint64 timeout;
+		trace_get(glad_replay, &sync, sizeof(sync));
+		sync = trace_map_sync(glad_replay, sync);
+		trace_get(glad_replay, &flags, sizeof(flags));
+		trace_get(glad_replay, &timeout, sizeof(timeout));
+		if(glad_replay->unsupported) return 0;
+		glad_glWaitSync(sync, flags, timeout);
+	} break;
+	case 657: {
+		GLenum pname;
+		GLint64 *data;
+		trace_get(glad_replay, &pname, sizeof(pname));
+		data = (GLint64 *)trace_scratch(glad_replay, 0, TRACE_SCRATCH_DEFAULT);
+		if(glad_replay->unsupported) return 0;
+		glad_glGetInteger64v(pname, data);
+	} break;
+	case 658: {
+		GLsync sync;
+		GLenum pname;
+		GLsizei count;
+		GLsizei *length;
+		GLint *values;
+		trace_get(glad_replay, &sync, sizeof(sync));
+		sync = trace_map_sync(glad_replay, sync);
+		trace_get(glad_replay, &pname, sizeof(pname));
+		trace_get(glad_replay, &count, sizeof(count));
+		length = (GLsizei *)trace_scratch(glad_replay, 0, TRACE_SCRATCH_DEFAULT);
+		values = (GLint *)trace_scratch(glad_replay, 1, (size_t)count * sizeof(GLint));
+		if(glad_replay->unsupported) return 0;
+		glad_glGetSynciv(sync, pname, count, length, values);
+	} break;
+	case 659: {
+		GLenum target;
+		GLuint index;
+		GLint64 *data;
+		trace_get(glad_replay, &target, sizeof(target));
+		trace_get(glad_replay, &index, sizeof(index));
+		data = (GLint64 *)trace_scratch(glad_replay, 0, TRACE_SCRATCH_DEFAULT);
+		if(glad_replay->unsupported) return 0;
+		glad_glGetInteger64i_v(target, index, data);
+	} break;
+	case 660: {
+		GLenum target;
+		GLenum pname;
+		GLint64 *params;
+		trace_get(glad_replay, &target, sizeof(target));
+		trace_get(glad_replay, &pname, sizeof(pname));
+		params = (GLint64 *)trace_scratch(glad_replay, 0, TRACE_SCRATCH_DEFAULT);
+		if(glad_replay->unsupported) return 0;
+		glad_glGetBufferParameteri64v(target, pname, params);
+	} break;
+	case 661: {
+		GLenum target;
+		GLenum attachment;
+		GLuint texture;
+		GLint level;
+		trace_get(glad_replay, &target, sizeof(target));
+		trace_get(glad_replay, &attachment, sizeof(attachment));
+		trace_get(glad_replay, &texture, sizeof(texture));
+		texture = trace_map_name(glad_replay, TRACE_NS_TEXTURE, texture);
+		trace_get(glad_replay, &level, sizeof(level));
+		if(glad_replay->unsupported) return 0;
+		glad_glFramebufferTexture(target, attachment, texture, level);
+	} break;
+	case 662: {
+		GLenum target;
+		GLsizei samples;
+		GLenum internalformat;
+		GLsizei width;
+		GLsizei height;
+		GLboolean fixedsamplelocations;
+		trace_get(glad_replay, &target, sizeof(target));
+		trace_get(glad_replay, &samples, sizeof(samples));
+		trace_get(glad_replay, &internalformat, sizeof(internalformat));
+		trace_get(glad_replay, &width, sizeof(width));
+		trace_get(glad_replay, &height, sizeof(height));
+		trace_get(glad_replay, &fixedsamplelocations, sizeof(fixedsamplelocations));
+		if(glad_replay->unsupported) return 0;
+		glad_glTexImage2DMultisample(target, samples, internalformat, width, height, fixedsamplelocations);
+	} break;
+	case 663: {
+		GLenum target;
+		GLsizei samples;
+		GLenum internalformat;
+		GLsizei width;
+		GLsizei height;
+		GLsizei depth;
+		GLboolean fixedsamplelocations;
+		trace_get(glad_replay, &target, sizeof(target));
+		trace_get(glad_replay, &samples, sizeof(samples));
+		trace_get(glad_replay, &internalformat, sizeof(internalformat));
+		trace_get(glad_replay, &width, sizeof(width));
+		trace_get(glad_replay, &height, sizeof(height));
+		trace_get(glad_replay, &depth, sizeof(depth));
+		trace_get(glad_replay, &fixedsamplelocations, sizeof(fixedsamplelocations));
+		if(glad_replay->unsupported) return 0;
+		glad_glTexImage3DMultisample(target, samples, internalformat, width, height, depth, fixedsamplelocations);
+	} break;
+	case 664: {
+		GLenum pname;
+		GLuint index;
+		GLfloat *val;
+		trace_get(glad_replay, &pname, sizeof(pname));
+		trace_get(glad_replay, &index, sizeof(index));
+		val = (GLfloat *)trace_scratch(glad_replay, 0, TRACE_SCRATCH_DEFAULT);
+		if(glad_replay->unsupported) return 0;
+		glad_glGetMultisamplefv(pname, index, val);
+	} break;
+	case 665: {
+		GLuint maskNumber;
+		GLbitfield mask;
+		trace_get(glad_replay, &maskNumber, sizeof(maskNumber));
+		trace_get(glad_replay, &mask, sizeof(mask));
+		if(glad_replay->unsupported) return 0;
+		glad_glSampleMaski(maskNumber, mask);
+	} break;
+	case 666: {
+		GLuint program;
+		GLuint colorNumber;
+		GLuint index;
+		const GLchar *name;
+		trace_get(glad_replay, &program, sizeof(program));
+		program = trace_map_name(glad_replay, TRACE_NS_PROGRAM, program);
+		trace_get(glad_replay, &colorNumber, sizeof(colorNumber));
+		trace_get(glad_replay, &index, sizeof(index));
+		name = (const GLchar *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glBindFragDataLocationIndexed(program, colorNumber, index, name);
+	} break;
+	case 667: {
+		GLuint program;
+		const GLchar *name;
+		GLint glad_result;
+		GLint recorded_result;
+		trace_get(glad_replay, &program, sizeof(program));
+		program = trace_map_name(glad_replay, TRACE_NS_PROGRAM, program);
+		name = (const GLchar *)trace_get_data(glad_replay);
+		trace_get(glad_replay, &recorded_result, sizeof(recorded_result));
+		if(glad_replay->unsupported) return 0;
+		glad_result = glad_glGetFragDataIndex(program, name);
+		(void)glad_result;
+		(void)recorded_result;
+	} break;
+	case 668: {
+		GLsizei count;
+		const GLuint *recorded_samplers;
+		GLuint *samplers;
+		trace_get(glad_replay, &count, sizeof(count));
+		recorded_samplers = (const GLuint *)trace_get_data(glad_replay);
+		samplers = (GLuint *)trace_scratch(glad_replay, 0, (size_t)count * sizeof(GLuint));
+		if(glad_replay->unsupported) return 0;
+		if(!trace_names_bound(glad_replay, TRACE_NS_SAMPLER, recorded_samplers, count)) {
+			glad_glGenSamplers(count, samplers);
+			trace_bind_names(glad_replay, TRACE_NS_SAMPLER, recorded_samplers, samplers, count);
+		}
+	} break;
+	case 669: {
+		GLsizei count;
+		const GLuint *recorded_samplers;
+		GLuint *samplers;
+		trace_get(glad_replay, &count, sizeof(count));
+		recorded_samplers = (const GLuint *)trace_get_data(glad_replay);
+		samplers = trace_map_names(glad_replay, 0, TRACE_NS_SAMPLER, recorded_samplers, count);
+		if(glad_replay->unsupported) return 0;
+		glad_glDeleteSamplers(count, samplers);
+		trace_unbind_names(glad_replay, TRACE_NS_SAMPLER, recorded_samplers, count);
+	} break;
+	case 670: {
+		GLuint sampler;
+		GLboolean glad_result;
+		GLboolean recorded_result;
+		trace_get(glad_replay, &sampler, sizeof(sampler));
+		sampler = trace_map_name(glad_replay, TRACE_NS_SAMPLER, sampler);
+		trace_get(glad_replay, &recorded_result, sizeof(recorded_result));
+		if(glad_replay->unsupported) return 0;
+		glad_result = glad_glIsSampler(sampler);
+		(void)glad_result;
+		(void)recorded_result;
+	} break;
+	case 671: {
+		GLuint unit;
+		GLuint sampler;
+		trace_get(glad_replay, &unit, sizeof(unit));
+		trace_get(glad_replay, &sampler, sizeof(sampler));
+		sampler = trace_map_name(glad_replay, TRACE_NS_SAMPLER, sampler);
+		if(glad_replay->unsupported) return 0;
+		glad_glBindSampler(unit, sampler);
+	} break;
+	case 672: {
+		GLuint sampler;
+		GLenum pname;
+		GLint param;
+		trace_get(glad_replay, &sampler, sizeof(sampler));
+		sampler = trace_map_name(glad_replay, TRACE_NS_SAMPLER, sampler);
+		trace_get(glad_replay, &pname, sizeof(pname));
+		trace_get(glad_replay, &param, sizeof(param));
+		if(glad_replay->unsupported) return 0;
+		glad_glSamplerParameteri(sampler, pname, param);
+	} break;
+	case 673: {
+		GLuint sampler;
+		GLenum pname;
+		const GLint *param;
+		trace_get(glad_replay, &sampler, sizeof(sampler));
+		sampler = trace_map_name(glad_replay, TRACE_NS_SAMPLER, sampler);
+		trace_get(glad_replay, &pname, sizeof(pname));
+		param = (const GLint *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glSamplerParameteriv(sampler, pname, param);
+	} break;
+	case 674: {
+		GLuint sampler;
+		GLenum pname;
+		GLfloat param;
+		trace_get(glad_replay, &sampler, sizeof(sampler));
+		sampler = trace_map_name(glad_replay, TRACE_NS_SAMPLER, sampler);
+		trace_get(glad_replay, &pname, sizeof(pname));
+		trace_get(glad_replay, &param, sizeof(param));
+		if(glad_replay->unsupported) return 0;
+		glad_glSamplerParameterf(sampler, pname, param);
+	} break;
+	case 675: {
+		GLuint sampler;
+		GLenum pname;
+		const GLfloat *param;
+		trace_get(glad_replay, &sampler, sizeof(sampler));
+		sampler = trace_map_name(glad_replay, TRACE_NS_SAMPLER, sampler);
+		trace_get(glad_replay, &pname, sizeof(pname));
+		param = (const GLfloat *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glSamplerParameterfv(sampler, pname, param);
+	} break;
+	case 676: {
+		GLuint sampler;
+		GLenum pname;
+		const GLint *param;
+		trace_get(glad_replay, &sampler, sizeof(sampler));
+		sampler = trace_map_name(glad_replay, TRACE_NS_SAMPLER, sampler);
+		trace_get(glad_replay, &pname, sizeof(pname));
+		param = (const GLint *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glSamplerParameterIiv(sampler, pname, param);
+	} break;
+	case 677: {
+		GLuint sampler;
+		GLenum pname;
+		const GLuint *param;
+		trace_get(glad_replay, &sampler, sizeof(sampler));
+		sampler = trace_map_name(glad_replay, TRACE_NS_SAMPLER, sampler);
+		trace_get(glad_replay, &pname, sizeof(pname));
+		param = (const GLuint *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glSamplerParameterIuiv(sampler, pname, param);
+	} break;
+	case 678: {
+		GLuint sampler;
+		GLenum pname;
+		GLint *params;
+		trace_get(glad_replay, &sampler, sizeof(sampler));
+		sampler = trace_map_name(glad_replay, TRACE_NS_SAMPLER, sampler);
+		trace_get(glad_replay, &pname, sizeof(pname));
+		params = (GLint *)trace_scratch(glad_replay, 0, TRACE_SCRATCH_DEFAULT);
+		if(glad_replay->unsupported) return 0;
+		glad_glGetSamplerParameteriv(sampler, pname, params);
+	} break;
+	case 679: {
+		GLuint sampler;
+		GLenum pname;
+		GLint *params;
+		trace_get(glad_replay, &sampler, sizeof(sampler));
+		sampler = trace_map_name(glad_replay, TRACE_NS_SAMPLER, sampler);
+		trace_get(glad_replay, &pname, sizeof(pname));
+		params = (GLint *)trace_scratch(glad_replay, 0, TRACE_SCRATCH_DEFAULT);
+		if(glad_replay->unsupported) return 0;
+		glad_glGetSamplerParameterIiv(sampler, pname, params);
+	} break;
+	case 680: {
+		GLuint sampler;
+		GLenum pname;
+		GLfloat *params;
+		trace_get(glad_replay, &sampler, sizeof(sampler));
+		sampler = trace_map_name(glad_replay, TRACE_NS_SAMPLER, sampler);
+		trace_get(glad_replay, &pname, sizeof(pname));
+		params = (GLfloat *)trace_scratch(glad_replay, 0, TRACE_SCRATCH_DEFAULT);
+		if(glad_replay->unsupported) return 0;
+		glad_glGetSamplerParameterfv(sampler, pname, params);
+	} break;
+	case 681: {
+		GLuint sampler;
+		GLenum pname;
+		GLuint *params;
+		trace_get(glad_replay, &sampler, sizeof(sampler));
+		sampler = trace_map_name(glad_replay, TRACE_NS_SAMPLER, sampler);
+		trace_get(glad_replay, &pname, sizeof(pname));
+		params = (GLuint *)trace_scratch(glad_replay, 0, TRACE_SCRATCH_DEFAULT);
+		if(glad_replay->unsupported) return 0;
+		glad_glGetSamplerParameterIuiv(sampler, pname, params);
+	} break;
+	case 682: {
+		GLuint id;
+		GLenum target;
+		trace_get(glad_replay, &id, sizeof(id));
+		id = trace_map_name(glad_replay, TRACE_NS_QUERY, id);
+		trace_get(glad_replay, &target, sizeof(target));
+		if(glad_replay->unsupported) return 0;
+		glad_glQueryCounter(id, target);
+	} break;
+	case 683: {
+		GLuint id;
+		GLenum pname;
+		GLint64 *params;
+		trace_get(glad_replay, &id, sizeof(id));
+		id = trace_map_name(glad_replay, TRACE_NS_QUERY, id);
+		trace_get(glad_replay, &pname, sizeof(pname));
+		params = (GLint64 *)trace_scratch(glad_replay, 0, TRACE_SCRATCH_DEFAULT);
+		if(glad_replay->unsupported) return 0;
+		glad_glGetQueryObjecti64v(id, pname, params);
+	} break;
+	case 684: {
+		GLuint id;
+		GLenum pname;
+		GLuint64 *params;
+		trace_get(glad_replay, &id, sizeof(id));
+		id = trace_map_name(glad_replay, TRACE_NS_QUERY, id);
+		trace_get(glad_replay, &pname, sizeof(pname));
+		params = (GLuint64 *)trace_scratch(glad_replay, 0, TRACE_SCRATCH_DEFAULT);
+		if(glad_replay->unsupported) return 0;
+		glad_glGetQueryObjectui64v(id, pname, params);
+	} break;
+	case 685: {
+		GLuint index;
+		GLuint divisor;
+		trace_get(glad_replay, &index, sizeof(index));
+		trace_get(glad_replay, &divisor, sizeof(divisor));
+		if(glad_replay->unsupported) return 0;
+		glad_glVertexAttribDivisor(index, divisor);
+	} break;
+	case 686: {
+		GLuint index;
+		GLenum type;
+		GLboolean normalized;
+		GLuint value;
+		trace_get(glad_replay, &index, sizeof(index));
+		trace_get(glad_replay, &type, sizeof(type));
+		trace_get(glad_replay, &normalized, sizeof(normalized));
+		trace_get(glad_replay, &value, sizeof(value));
+		if(glad_replay->unsupported) return 0;
+		glad_glVertexAttribP1ui(index, type, normalized, value);
+	} break;
+	case 687: {
+		GLuint index;
+		GLenum type;
+		GLboolean normalized;
+		const GLuint *value;
+		trace_get(glad_replay, &index, sizeof(index));
+		trace_get(glad_replay, &type, sizeof(type));
+		trace_get(glad_replay, &normalized, sizeof(normalized));
+		value = (const GLuint *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glVertexAttribP1uiv(index, type, normalized, value);
+	} break;
+	case 688: {
+		GLuint index;
+		GLenum type;
+		GLboolean normalized;
+		GLuint value;
+		trace_get(glad_replay, &index, sizeof(index));
+		trace_get(glad_replay, &type, sizeof(type));
+		trace_get(glad_replay, &normalized, sizeof(normalized));
+		trace_get(glad_replay, &value, sizeof(value));
+		if(glad_replay->unsupported) return 0;
+		glad_glVertexAttribP2ui(index, type, normalized, value);
+	} break;
+	case 689: {
+		GLuint index;
+		GLenum type;
+		GLboolean normalized;
+		const GLuint *value;
+		trace_get(glad_replay, &index, sizeof(index));
+		trace_get(glad_replay, &type, sizeof(type));
+		trace_get(glad_replay, &normalized, sizeof(normalized));
+		value = (const GLuint *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glVertexAttribP2uiv(index, type, normalized, value);
+	} break;
+	case 690: {
+		GLuint index;
+		GLenum type;
+		GLboolean normalized;
+		GLuint value;
+		trace_get(glad_replay, &index, sizeof(index));
+		trace_get(glad_replay, &type, sizeof(type));
+		trace_get(glad_replay, &normalized, sizeof(normalized));
+		trace_get(glad_replay, &value, sizeof(value));
+		if(glad_replay->unsupported) return 0;
+		glad_glVertexAttribP3ui(index, type, normalized, value);
+	} break;
+	case 691: {
+		GLuint index;
+		GLenum type;
+		GLboolean normalized;
+		const GLuint *value;
+		trace_get(glad_replay, &index, sizeof(index));
+		trace_get(glad_replay, &type, sizeof(type));
+		trace_get(glad_replay, &normalized, sizeof(normalized));
+		value = (const GLuint *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glVertexAttribP3uiv(index, type, normalized, value);
+	} break;
+	case 692: {
+		GLuint index;
+		GLenum type;
+		GLboolean normalized;
+		GLuint value;
+		trace_get(glad_replay, &index, sizeof(index));
+		trace_get(glad_replay, &type, sizeof(type));
+		trace_get(glad_replay, &normalized, sizeof(normalized));
+		trace_get(glad_replay, &value, sizeof(value));
+		if(glad_replay->unsupported) return 0;
+		glad_glVertexAttribP4ui(index, type, normalized, value);
+	} break;
+	case 693: {
+		GLuint index;
+		GLenum type;
+		GLboolean normalized;
+		const GLuint *value;
+		trace_get(glad_replay, &index, sizeof(index));
+		trace_get(glad_replay, &type, sizeof(type));
+		trace_get(glad_replay, &normalized, sizeof(normalized));
+		value = (const GLuint *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glVertexAttribP4uiv(index, type, normalized, value);
+	} break;
+	case 694: {
+		GLenum type;
+		GLuint value;
+		trace_get(glad_replay, &type, sizeof(type));
+		trace_get(glad_replay, &value, sizeof(value));
+		if(glad_replay->unsupported) return 0;
+		glad_glVertexP2ui(type, value);
+	} break;
+	case 695: {
+		GLenum type;
+		const GLuint *value;
+		trace_get(glad_replay, &type, sizeof(type));
+		value = (const GLuint *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glVertexP2uiv(type, value);
+	} break;
+	case 696: {
+		GLenum type;
+		GLuint value;
+		trace_get(glad_replay, &type, sizeof(type));
+		trace_get(glad_replay, &value, sizeof(value));
+		if(glad_replay->unsupported) return 0;
+		glad_glVertexP3ui(type, value);
+	} break;
+	case 697: {
+		GLenum type;
+		const GLuint *value;
+		trace_get(glad_replay, &type, sizeof(type));
+		value = (const GLuint *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glVertexP3uiv(type, value);
+	} break;
+	case 698: {
+		GLenum type;
+		GLuint value;
+		trace_get(glad_replay, &type, sizeof(type));
+		trace_get(glad_replay, &value, sizeof(value));
+		if(glad_replay->unsupported) return 0;
+		glad_glVertexP4ui(type, value);
+	} break;
+	case 699: {
+		GLenum type;
+		const GLuint *value;
+		trace_get(glad_replay, &type, sizeof(type));
+		value = (const GLuint *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glVertexP4uiv(type, value);
+	} break;
+	case 700: {
+		GLenum type;
+		GLuint coords;
+		trace_get(glad_replay, &type, sizeof(type));
+		trace_get(glad_replay, &coords, sizeof(coords));
+		if(glad_replay->unsupported) return 0;
+		glad_glTexCoordP1ui(type, coords);
+	} break;
+	case 701: {
+		GLenum type;
+		const GLuint *coords;
+		trace_get(glad_replay, &type, sizeof(type));
+		coords = (const GLuint *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glTexCoordP1uiv(type, coords);
+	} break;
+	case 702: {
+		GLenum type;
+		GLuint coords;
+		trace_get(glad_replay, &type, sizeof(type));
+		trace_get(glad_replay, &coords, sizeof(coords));
+		if(glad_replay->unsupported) return 0;
+		glad_glTexCoordP2ui(type, coords);
+	} break;
+	case 703: {
+		GLenum type;
+		const GLuint *coords;
+		trace_get(glad_replay, &type, sizeof(type));
+		coords = (const GLuint *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glTexCoordP2uiv(type, coords);
+	} break;
+	case 704: {
+		GLenum type;
+		GLuint coords;
+		trace_get(glad_replay, &type, sizeof(type));
+		trace_get(glad_replay, &coords, sizeof(coords));
+		if(glad_replay->unsupported) return 0;
+		glad_glTexCoordP3ui(type, coords);
+	} break;
+	case 705: {
+		GLenum type;
+		const GLuint *coords;
+		trace_get(glad_replay, &type, sizeof(type));
+		coords = (const GLuint *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glTexCoordP3uiv(type, coords);
+	} break;
+	case 706: {
+		GLenum type;
+		GLuint coords;
+		trace_get(glad_replay, &type, sizeof(type));
+		trace_get(glad_replay, &coords, sizeof(coords));
+		if(glad_replay->unsupported) return 0;
+		glad_glTexCoordP4ui(type, coords);
+	} break;
+	case 707: {
+		GLenum type;
+		const GLuint *coords;
+		trace_get(glad_replay, &type, sizeof(type));
+		coords = (const GLuint *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glTexCoordP4uiv(type, coords);
+	} break;
+	case 708: {
+		GLenum texture;
+		GLenum type;
+		GLuint coords;
+		trace_get(glad_replay, &texture, sizeof(texture));
+		trace_get(glad_replay, &type, sizeof(type));
+		trace_get(glad_replay, &coords, sizeof(coords));
+		if(glad_replay->unsupported) return 0;
+		glad_glMultiTexCoordP1ui(texture, type, coords);
+	} break;
+	case 709: {
+		GLenum texture;
+		GLenum type;
+		const GLuint *coords;
+		trace_get(glad_replay, &texture, sizeof(texture));
+		trace_get(glad_replay, &type, sizeof(type));
+		coords = (const GLuint *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glMultiTexCoordP1uiv(texture, type, coords);
+	} break;
+	case 710: {
+		GLenum texture;
+		GLenum type;
+		GLuint coords;
+		trace_get(glad_replay, &texture, sizeof(texture));
+		trace_get(glad_replay, &type, sizeof(type));
+		trace_get(glad_replay, &coords, sizeof(coords));
+		if(glad_replay->unsupported) return 0;
+		glad_glMultiTexCoordP2ui(texture, type, coords);
+	} break;
+	case 711: {
+		GLenum texture;
+		GLenum type;
+		const GLuint *coords;
+		trace_get(glad_replay, &texture, sizeof(texture));
+		trace_get(glad_replay, &type, sizeof(type));
+		coords = (const GLuint *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glMultiTexCoordP2uiv(texture, type, coords);
+	} break;
+	case 712: {
+		GLenum texture;
+		GLenum type;
+		GLuint coords;
+		trace_get(glad_replay, &texture, sizeof(texture));
+		trace_get(glad_replay, &type, sizeof(type));
+		trace_get(glad_replay, &coords, sizeof(coords));
+		if(glad_replay->unsupported) return 0;
+		glad_glMultiTexCoordP3ui(texture, type, coords);
+	} break;
+	case 713: {
+		GLenum texture;
+		GLenum type;
+		const GLuint *coords;
+		trace_get(glad_replay, &texture, sizeof(texture));
+		trace_get(glad_replay, &type, sizeof(type));
+		coords = (const GLuint *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glMultiTexCoordP3uiv(texture, type, coords);
+	} break;
+	case 714: {
+		GLenum texture;
+		GLenum type;
+		GLuint coords;
+		trace_get(glad_replay, &texture, sizeof(texture));
+		trace_get(glad_replay, &type, sizeof(type));
+		trace_get(glad_replay, &coords, sizeof(coords));
+		if(glad_replay->unsupported) return 0;
+		glad_glMultiTexCoordP4ui(texture, type, coords);
+	} break;
+	case 715: {
+		GLenum texture;
+		GLenum type;
+		const GLuint *coords;
+		trace_get(glad_replay, &texture, sizeof(texture));
+		trace_get(glad_replay, &type, sizeof(type));
+		coords = (const GLuint *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glMultiTexCoordP4uiv(texture, type, coords);
+	} break;
+	case 716: {
+		GLenum type;
+		GLuint coords;
+		trace_get(glad_replay, &type, sizeof(type));
+		trace_get(glad_replay, &coords, sizeof(coords));
+		if(glad_replay->unsupported) return 0;
+		glad_glNormalP3ui(type, coords);
+	} break;
+	case 717: {
+		GLenum type;
+		const GLuint *coords;
+		trace_get(glad_replay, &type, sizeof(type));
+		coords = (const GLuint *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glNormalP3uiv(type, coords);
+	} break;
+	case 718: {
+		GLenum type;
+		GLuint color;
+		trace_get(glad_replay, &type, sizeof(type));
+		trace_get(glad_replay, &color, sizeof(color));
+		if(glad_replay->unsupported) return 0;
+		glad_glColorP3ui(type, color);
+	} break;
+	case 719: {
+		GLenum type;
+		const GLuint *color;
+		trace_get(glad_replay, &type, sizeof(type));
+		color = (const GLuint *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glColorP3uiv(type, color);
+	} break;
+	case 720: {
+		GLenum type;
+		GLuint color;
+		trace_get(glad_replay, &type, sizeof(type));
+		trace_get(glad_replay, &color, sizeof(color));
+		if(glad_replay->unsupported) return 0;
+		glad_glColorP4ui(type, color);
+	} break;
+	case 721: {
+		GLenum type;
+		const GLuint *color;
+		trace_get(glad_replay, &type, sizeof(type));
+		color = (const GLuint *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glColorP4uiv(type, color);
+	} break;
+	case 722: {
+		GLenum type;
+		GLuint color;
+		trace_get(glad_replay, &type, sizeof(type));
+		trace_get(glad_replay, &color, sizeof(color));
+		if(glad_replay->unsupported) return 0;
+		glad_glSecondaryColorP3ui(type, color);
+	} break;
+	case 723: {
+		GLenum type;
+		const GLuint *color;
+		trace_get(glad_replay, &type, sizeof(type));
+		color = (const GLuint *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glSecondaryColorP3uiv(type, color);
+	} break;
+	case 724: {
+		GLenum target;
+		GLsizeiptr size;
+		const void *data;
+		GLbitfield flags;
+		trace_get(glad_replay, &target, sizeof(target));
+		trace_get(glad_replay, &size, sizeof(size));
+		data = (const void *)trace_get_data(glad_replay);
+		trace_get(glad_replay, &flags, sizeof(flags));
+		if(glad_replay->unsupported) return 0;
+		glad_glBufferStorage(target, size, data, flags);
+	} break;
+	case 725: {
+		GLenum source;
+		GLenum type;
+		GLenum severity;
+		GLsizei count;
+		const GLuint *ids;
+		GLboolean enabled;
+		trace_get(glad_replay, &source, sizeof(source));
+		trace_get(glad_replay, &type, sizeof(type));
+		trace_get(glad_replay, &severity, sizeof(severity));
+		trace_get(glad_replay, &count, sizeof(count));
+		ids = (const GLuint *)trace_get_data(glad_replay);
+		trace_get(glad_replay, &enabled, sizeof(enabled));
+		if(glad_replay->unsupported) return 0;
+		glad_glDebugMessageControlARB(source, type, severity, count, ids, enabled);
+	} break;
+	case 726: {
+		GLenum source;
+		GLenum type;
+		GLuint id;
+		GLenum severity;
+		GLsizei length;
+		const GLchar *buf;
+		trace_get(glad_replay, &source, sizeof(source));
+		trace_get(glad_replay, &type, sizeof(type));
+		trace_get(glad_replay, &id, sizeof(id));
+		trace_get(glad_replay, &severity, sizeof(severity));
+		trace_get(glad_replay, &length, sizeof(length));
+		buf = (const GLchar *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glDebugMessageInsertARB(source, type, id, severity, length, buf);
+	} break;
+	case 727: {
+		GLDEBUGPROCARB callback = NULL;
+		const void *userParam;
+		trace_get_unsupported(glad_replay);
+		trace_get_unsupported(glad_replay);
+		userParam = NULL;
+		glad_replay->unsupported = 1;
+		if(glad_replay->unsupported) return 0;
+		glad_glDebugMessageCallbackARB(callback, userParam);
+	} break;
+	case 728: {
+		GLuint count;
+		GLsizei bufSize;
+		GLenum *sources;
+		GLenum *types;
+		GLuint *ids;
+		GLenum *severities;
+		GLsizei *lengths;
+		GLchar *messageLog;
+		GLuint glad_result;
+		GLuint recorded_result;
+		trace_get(glad_replay, &count, sizeof(count));
+		trace_get(glad_replay, &bufSize, sizeof(bufSize));
+		sources = (GLenum *)trace_scratch(glad_replay, 0, (size_t)count * 4);
+		types = (GLenum *)trace_scratch(glad_replay, 1, (size_t)count * 4);
+		ids = (GLuint *)trace_scratch(glad_replay, 2, (size_t)count * 4);
+		severities = (GLenum *)trace_scratch(glad_replay, 3, (size_t)count * 4);
+		lengths = (GLsizei *)trace_scratch(glad_replay, 4, (size_t)count * 4);
+		messageLog = (GLchar *)trace_scratch(glad_replay, 5, (size_t)bufSize);
+		trace_get(glad_replay, &recorded_result, sizeof(recorded_result));
+		if(glad_replay->unsupported) return 0;
+		glad_result = glad_glGetDebugMessageLogARB(count, bufSize, sources, types, ids, severities, lengths, messageLog);
+		(void)glad_result;
+		(void)recorded_result;
+	} break;
+	case 729: {
+		GLuint program;
+		GLsizei bufSize;
+		GLsizei *length;
+		GLenum *binaryFormat;
+		void *binary;
+		trace_get(glad_replay, &program, sizeof(program));
+		program = trace_map_name(glad_replay, TRACE_NS_PROGRAM, program);
+		trace_get(glad_replay, &bufSize, sizeof(bufSize));
+		length = (GLsizei *)trace_scratch(glad_replay, 0, TRACE_SCRATCH_DEFAULT);
+		binaryFormat = (GLenum *)trace_scratch(glad_replay, 1, TRACE_SCRATCH_DEFAULT);
+		binary = (void *)trace_scratch(glad_replay, 2, (size_t)bufSize);
+		if(glad_replay->unsupported) return 0;
+		glad_glGetProgramBinary(program, bufSize, length, binaryFormat, binary);
+	} break;
+	case 730: {
+		GLuint program;
+		GLenum binaryFormat;
+		const void *binary;
+		GLsizei length;
+		trace_get(glad_replay, &program, sizeof(program));
+		program = trace_map_name(glad_replay, TRACE_NS_PROGRAM, program);
+		trace_get(glad_replay, &binaryFormat, sizeof(binaryFormat));
+		binary = (const void *)trace_get_data(glad_replay);
+		trace_get(glad_replay, &length, sizeof(length));
+		if(glad_replay->unsupported) return 0;
+		glad_glProgramBinary(program, binaryFormat, binary, length);
+	} break;
+	case 731: {
+		GLuint program;
+		GLenum pname;
+		GLint value;
+		trace_get(glad_replay, &program, sizeof(program));
+		program = trace_map_name(glad_replay, TRACE_NS_PROGRAM, program);
+		trace_get(glad_replay, &pname, sizeof(pname));
+		trace_get(glad_replay, &value, sizeof(value));
+		if(glad_replay->unsupported) return 0;
+		glad_glProgramParameteri(program, pname, value);
+	} break;
+	case 732: {
+		GLuint count;
+		trace_get(glad_replay, &count, sizeof(count));
+		if(glad_replay->unsupported) return 0;
+		glad_glMaxShaderCompilerThreadsARB(count);
+	} break;
+	case 733: {
+		GLenum source;
+		GLenum type;
+		GLenum severity;
+		GLsizei count;
+		const GLuint *ids;
+		GLboolean enabled;
+		trace_get(glad_replay, &source, sizeof(source));
+		trace_get(glad_replay, &type, sizeof(type));
+		trace_get(glad_replay, &severity, sizeof(severity));
+		trace_get(glad_replay, &count, sizeof(count));
+		ids = (const GLuint *)trace_get_data(glad_replay);
+		trace_get(glad_replay, &enabled, sizeof(enabled));
+		if(glad_replay->unsupported) return 0;
+		glad_glDebugMessageControl(source, type, severity, count, ids, enabled);
+	} break;
+	case 734: {
+		GLenum source;
+		GLenum type;
+		GLuint id;
+		GLenum severity;
+		GLsizei length;
+		const GLchar *buf;
+		trace_get(glad_replay, &source, sizeof(source));
+		trace_get(glad_replay, &type, sizeof(type));
+		trace_get(glad_replay, &id, sizeof(id));
+		trace_get(glad_replay, &severity, sizeof(severity));
+		trace_get(glad_replay, &length, sizeof(length));
+		buf = (const GLchar *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glDebugMessageInsert(source, type, id, severity, length, buf);
+	} break;
+	case 735: {
+		GLDEBUGPROC callback = NULL;
+		const void *userParam;
+		trace_get_unsupported(glad_replay);
+		trace_get_unsupported(glad_replay);
+		userParam = NULL;
+		glad_replay->unsupported = 1;
+		if(glad_replay->unsupported) return 0;
+		glad_glDebugMessageCallback(callback, userParam);
+	} break;
+	case 736: {
+		GLuint count;
+		GLsizei bufSize;
+		GLenum *sources;
+		GLenum *types;
+		GLuint *ids;
+		GLenum *severities;
+		GLsizei *lengths;
+		GLchar *messageLog;
+		GLuint glad_result;
+		GLuint recorded_result;
+		trace_get(glad_replay, &count, sizeof(count));
+		trace_get(glad_replay, &bufSize, sizeof(bufSize));
+		sources = (GLenum *)trace_scratch(glad_replay, 0, (size_t)count * 4);
+		types = (GLenum *)trace_scratch(glad_replay, 1, (size_t)count * 4);
+		ids = (GLuint *)trace_scratch(glad_replay, 2, (size_t)count * 4);
+		severities = (GLenum *)trace_scratch(glad_replay, 3, (size_t)count * 4);
+		lengths = (GLsizei *)trace_scratch(glad_replay, 4, (size_t)count * 4);
+		messageLog = (GLchar *)trace_scratch(glad_replay, 5, (size_t)bufSize);
+		trace_get(glad_replay, &recorded_result, sizeof(recorded_result));
+		if(glad_replay->unsupported) return 0;
+		glad_result = glad_glGetDebugMessageLog(count, bufSize, sources, types, ids, severities, lengths, messageLog);
+		(void)glad_result;
+		(void)recorded_result;
+	} break;
+	case 737: {
+		GLenum source;
+		GLuint id;
+		GLsizei length;
+		const GLchar *message;
+		trace_get(glad_replay, &source, sizeof(source));
+		trace_get(glad_replay, &id, sizeof(id));
+		trace_get(glad_replay, &length, sizeof(length));
+		message = (const GLchar *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glPushDebugGroup(source, id, length, message);
+	} break;
+	case 738: {
+		if(glad_replay->unsupported) return 0;
+		glad_glPopDebugGroup();
+	} break;
+	case 739: {
+		GLenum identifier;
+		GLuint name;
+		GLsizei length;
+		const GLchar *label;
+		trace_get(glad_replay, &identifier, sizeof(identifier));
+		trace_get(glad_replay, &name, sizeof(name));
+		trace_get(glad_replay, &length, sizeof(length));
+		label = (const GLchar *)trace_get_data(glad_replay);
+		if(glad_replay->unsupported) return 0;
+		glad_glObjectLabel(identifier, name, length, label);
+	} break;
+	case 740: {
+		GLenum identifier;
+		GLuint name;
+		GLsizei bufSize;
+		GLsizei *length;
+		GLchar *label;
+		trace_get(glad_replay, &identifier, sizeof(identifier));
+		trace_get(glad_replay, &name, sizeof(name));
+		trace_get(glad_replay, &bufSize, sizeof(bufSize));
+		length = (GLsizei *)trace_scratch(glad_replay, 0, TRACE_SCRATCH_DEFAULT);
+		label = (GLchar *)trace_scratch(glad_replay, 1, TRACE_SCRATCH_DEFAULT);
+		if(glad_replay->unsupported) return 0;
+		glad_glGetObjectLabel(identifier, name, bufSize, length, label);
+	} break;
+	case 741: {
+		const void *ptr;
+		GLsizei length;
+		const GLchar *label;
+		trace_get_unsupported(glad_replay);
+		ptr = NULL;
+		trace_get(glad_replay, &length, sizeof(length));
+		trace_get_unsupported(glad_replay);
+		label = NULL;
+		if(glad_replay->unsupported) return 0;
+		glad_glObjectPtrLabel(ptr, length, label);
+	} break;
+	case 742: {
+		const void *ptr;
+		GLsizei bufSize;
+		GLsizei *length;
+		GLchar *label;
+		trace_get_unsupported(glad_replay);
+		ptr = NULL;
+		trace_get(glad_replay, &bufSize, sizeof(bufSize));
+		length = (GLsizei *)trace_scratch(glad_replay, 0, TRACE_SCRATCH_DEFAULT);
+		label = (GLchar *)trace_scratch(glad_replay, 1, TRACE_SCRATCH_DEFAULT);
+		if(glad_replay->unsupported) return 0;
+		glad_glGetObjectPtrLabel(ptr, bufSize, length, label);
+	} break;
+	case 743: {
+		GLuint count;
+		trace_get(glad_replay, &count, sizeof(count));
+		if(glad_replay->unsupported) return 0;
+		glad_glMaxShaderCompilerThreadsKHR(count);
+	} break;
+	default:
+		return 0;
+	}
+	return 1;
+}
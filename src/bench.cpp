@@ -0,0 +1,186 @@
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "bench.hpp"
+
+
+#ifndef BUILD_PROFILE
+#define BUILD_PROFILE "custom"
+#endif
+
+
+u64 bench_now_ns()
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (u64)now.tv_sec * 1000000000ull + (u64)now.tv_nsec;
+}
+
+
+void init_bench(Bench *bench)
+{
+    bench->filter = NULL;
+    bench->suite = "";
+    bench->sample_count = 20;
+    bench->min_sample_ns = 10e6;
+    bench->warmup_ns = 50e6;
+    bench->out = NULL;
+    bench->first_isa = CPU_ISA_SSE2;
+    bench->last_isa = cpu_best_isa();
+    bench->run_count = 0;
+    bench->failed = false;
+}
+
+
+void bench_begin_output(Bench *bench)
+{
+    if (bench->out)
+    {
+        fprintf(bench->out, "# build=%s cpu=%s\n", BUILD_PROFILE, cpu_isa_name(cpu_best_isa()));
+        fprintf(bench->out, "# suite\tname\titems\titerations\tsamples\t"
+                            "mean_ns\tmedian_ns\tstddev_ns\tmin_ns\tmax_ns\n");
+    }
+}
+
+
+void bench_suite(Bench *bench, const char *suite)
+{
+    bench->suite = suite;
+}
+
+
+bool bench_enabled(Bench *bench, const char *name)
+{
+    if (bench->filter == NULL)
+    {
+        return true;
+    }
+
+    char full_name[256];
+    snprintf(full_name, sizeof(full_name), "%s/%s", bench->suite, name);
+    return strstr(full_name, bench->filter) != NULL;
+}
+
+
+void bench_fail(Bench *bench, const char *name, const char *reason)
+{
+    fprintf(stderr, "FAIL %s/%s: %s\n", bench->suite, name, reason);
+    bench->failed = true;
+}
+
+
+internal u64 time_iterations(BenchFunction *function, void *context, u64 iterations)
+{
+    u64 start = bench_now_ns();
+    function(context, iterations);
+    bench_clobber_memory();
+    return bench_now_ns() - start;
+}
+
+
+internal int compare_f64(const void *a, const void *b)
+{
+    f64 x = *(const f64 *)a;
+    f64 y = *(const f64 *)b;
+    return x < y ? -1 : (x > y ? 1 : 0);
+}
+
+
+// Grows the iteration count until one sample takes at least min_sample_ns.
+internal u64 calibrate(Bench *bench, BenchFunction *function, void *context)
+{
+    u64 iterations = 1;
+    for (;;)
+    {
+        f64 elapsed = (f64)time_iterations(function, context, iterations);
+        if (elapsed >= bench->min_sample_ns || iterations >= (1ull << 40))
+        {
+            return iterations;
+        }
+
+        // Overshoot a little so the next try usually lands
+        f64 scale = elapsed > 0.0 ? 1.2 * bench->min_sample_ns / elapsed : 10.0;
+        scale = scale < 1.5 ? 1.5 : (scale > 10.0 ? 10.0 : scale);
+        iterations = (u64)ceil((f64)iterations * scale);
+    }
+}
+
+
+bool bench_run(Bench *bench, const char *name, u64 items,
+               BenchFunction *function, void *context,
+               BenchResult *result)
+{
+    if (!bench_enabled(bench, name))
+    {
+        return false;
+    }
+
+    u64 iterations = calibrate(bench, function, context);
+
+    u64 warmup_start = bench_now_ns();
+    while ((f64)(bench_now_ns() - warmup_start) < bench->warmup_ns)
+    {
+        time_iterations(function, context, iterations);
+    }
+
+    f64 samples[BENCH_MAX_SAMPLES];
+    u32 sample_count = bench->sample_count;
+    sample_count = sample_count > BENCH_MAX_SAMPLES ? BENCH_MAX_SAMPLES : sample_count;
+    sample_count = sample_count < 2 ? 2 : sample_count;
+
+    f64 sum = 0.0;
+    for (u32 i = 0; i < sample_count; ++i)
+    {
+        samples[i] = (f64)time_iterations(function, context, iterations) / (f64)iterations;
+        sum += samples[i];
+    }
+
+    BenchResult stats;
+    stats.iterations = iterations;
+    stats.samples = sample_count;
+    stats.mean_ns = sum / sample_count;
+
+    f64 variance = 0.0;
+    for (u32 i = 0; i < sample_count; ++i)
+    {
+        variance += (samples[i] - stats.mean_ns) * (samples[i] - stats.mean_ns);
+    }
+    stats.stddev_ns = sqrt(variance / (sample_count - 1));
+
+    qsort(samples, sample_count, sizeof(f64), compare_f64);
+    stats.min_ns = samples[0];
+    stats.max_ns = samples[sample_count - 1];
+    stats.median_ns = (sample_count & 1)
+        ? samples[sample_count / 2]
+        : 0.5 * (samples[sample_count / 2 - 1] + samples[sample_count / 2]);
+
+    char full_name[256];
+    snprintf(full_name, sizeof(full_name), "%s/%s", bench->suite, name);
+    printf("  %-48s %12.2f ns %10.2f ns/item  ±%5.1f%%  (%llu x %u)\n",
+           full_name,
+           stats.median_ns,
+           stats.median_ns / (f64)(items ? items : 1),
+           stats.mean_ns > 0.0 ? 100.0 * stats.stddev_ns / stats.mean_ns : 0.0,
+           (unsigned long long)iterations,
+           sample_count);
+    fflush(stdout);
+
+    if (bench->out)
+    {
+        fprintf(bench->out, "%s\t%s\t%llu\t%llu\t%u\t%.4f\t%.4f\t%.4f\t%.4f\t%.4f\n",
+                bench->suite, name,
+                (unsigned long long)items,
+                (unsigned long long)iterations,
+                sample_count,
+                stats.mean_ns, stats.median_ns, stats.stddev_ns, stats.min_ns, stats.max_ns);
+    }
+
+    ++bench->run_count;
+    if (result)
+    {
+        *result = stats;
+    }
+    return true;
+}
@@ -0,0 +1,103 @@
+#pragma once
+
+#include <stdio.h>
+
+#include "platform.hpp"
+#include "cpu.hpp"
+
+
+// Microbenchmark harness.
+//
+// A benchmark is a function that runs its operation `iterations` times.
+// bench_run() warms it up, grows the iteration count until one sample
+// takes at least min_sample_ns, then times sample_count samples and prints
+// median/mean/stddev per iteration. With an output file every result is
+// also written as one tab separated line, which bench_compare reads.
+//
+// Suites are plain functions taking a Bench (see bench_main.cpp). Use
+// bench_do_not_optimize() on results the compiler could otherwise discard.
+
+
+#define BENCH_MAX_SAMPLES 256
+
+
+struct BenchResult
+{
+    u64 iterations;         // per sample
+    u32 samples;
+    f64 mean_ns;            // all per iteration
+    f64 median_ns;
+    f64 stddev_ns;
+    f64 min_ns;
+    f64 max_ns;
+};
+
+
+struct Bench
+{
+    const char *filter;     // substring of "suite/name", NULL runs all
+    const char *suite;
+    u32         sample_count;
+    f64         min_sample_ns;
+    f64         warmup_ns;
+    FILE       *out;        // machine readable results, may be NULL
+
+    // Instruction sets the SIMD suites should cover
+    CpuIsa      first_isa;
+    CpuIsa      last_isa;
+
+    u32         run_count;
+    bool        failed;
+};
+
+
+typedef void BenchFunction(void *context, u64 iterations);
+
+
+void init_bench(Bench *bench);
+
+// Writes the results header (build, cpu) to bench->out.
+void bench_begin_output(Bench *bench);
+
+void bench_suite(Bench *bench, const char *suite);
+
+// False if the filter skipped it. `items` is how many things one iteration
+// processes, for the per-item column; pass 1 when that means nothing.
+bool bench_run(Bench *bench, const char *name, u64 items,
+               BenchFunction *function, void *context,
+               BenchResult *result = NULL);
+
+// Whether bench_run() would run `name` in the current suite, to skip setup.
+bool bench_enabled(Bench *bench, const char *name);
+
+// Marks the run as failed (e.g. a kernel gave wrong results) and logs why.
+void bench_fail(Bench *bench, const char *name, const char *reason);
+
+u64 bench_now_ns();
+
+
+template <typename Function>
+bool bench_run(Bench *bench, const char *name, u64 items, Function &&function,
+               BenchResult *result = NULL)
+{
+    return bench_run(bench, name, items,
+                     [](void *context, u64 iterations) { (*(Function *)context)(iterations); },
+                     (void *)&function, result);
+}
+
+
+// Makes the compiler assume `value` is read, so the computation producing
+// it is kept.
+template <typename T>
+inline void bench_do_not_optimize(const T &value)
+{
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+
+// Makes the compiler assume all memory is read and written, so stores to
+// buffers are kept.
+inline void bench_clobber_memory()
+{
+    asm volatile("" : : : "memory");
+}
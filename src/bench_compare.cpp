@@ -0,0 +1,214 @@
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "platform.hpp"
+
+
+// Compares two `bench --out` files.
+//
+//   bench_compare baseline.tsv new.tsv [--threshold PERCENT]
+//
+// A benchmark counts as changed when Welch's t-test on the sample means is
+// significant at 95% and the means differ by more than the threshold
+// (default 3%), so noise on tiny differences is not reported. Exits with 1
+// when anything regressed, for use in scripts.
+
+
+#define COMPARE_MAX_RESULTS 1024
+
+
+struct CompareResult
+{
+    char name[160];
+    u32  samples;
+    f64  mean_ns;
+    f64  median_ns;
+    f64  stddev_ns;
+};
+
+
+struct CompareFile
+{
+    char           header[160];
+    CompareResult  results[COMPARE_MAX_RESULTS];
+    u32            count;
+};
+
+
+bool load_results(const char *path, CompareFile *file)
+{
+    FILE *input = fopen(path, "r");
+    if (input == NULL)
+    {
+        fprintf(stderr, "Failed to open %s\n", path);
+        return false;
+    }
+
+    file->header[0] = 0;
+    file->count = 0;
+
+    char line[512];
+    while (fgets(line, sizeof(line), input))
+    {
+        if (line[0] == '#')
+        {
+            if (file->header[0] == 0)
+            {
+                snprintf(file->header, sizeof(file->header), "%s", line + 2);
+                file->header[strcspn(file->header, "\n")] = 0;
+            }
+            continue;
+        }
+        if (file->count == COMPARE_MAX_RESULTS)
+        {
+            fprintf(stderr, "%s: more than %d results, ignoring the rest\n", path, COMPARE_MAX_RESULTS);
+            break;
+        }
+
+        char suite[64], name[96];
+        unsigned long long items, iterations;
+        CompareResult *result = &file->results[file->count];
+        f64 min_ns, max_ns;
+        if (sscanf(line, "%63[^\t]\t%95[^\t]\t%llu\t%llu\t%u\t%lf\t%lf\t%lf\t%lf\t%lf",
+                   suite, name, &items, &iterations, &result->samples,
+                   &result->mean_ns, &result->median_ns, &result->stddev_ns,
+                   &min_ns, &max_ns) != 10)
+        {
+            continue;
+        }
+        snprintf(result->name, sizeof(result->name), "%s/%s", suite, name);
+        ++file->count;
+    }
+
+    fclose(input);
+    return true;
+}
+
+
+// Two-sided 95% critical value of Student's t distribution
+f64 t_critical_95(f64 degrees_of_freedom)
+{
+    local_persist const f64 table[] =
+    {
+        12.706, 4.303, 3.182, 2.776, 2.571, 2.447, 2.365, 2.306, 2.262, 2.228,
+        2.201, 2.179, 2.160, 2.145, 2.131, 2.120, 2.110, 2.101, 2.093, 2.086,
+        2.080, 2.074, 2.069, 2.064, 2.060, 2.056, 2.052, 2.048, 2.045, 2.042,
+    };
+
+    u32 df = degrees_of_freedom < 1.0 ? 1 : (u32)degrees_of_freedom;
+    if (df <= 30)
+    {
+        return table[df - 1];
+    }
+    return df <= 60 ? 2.000 : (df <= 120 ? 1.980 : 1.960);
+}
+
+
+CompareResult *find_result(CompareFile *file, const char *name)
+{
+    for (u32 i = 0; i < file->count; ++i)
+    {
+        if (strcmp(file->results[i].name, name) == 0)
+        {
+            return &file->results[i];
+        }
+    }
+    return NULL;
+}
+
+
+int main(int argc, char *argv[])
+{
+    const char *paths[2] = {};
+    u32 path_count = 0;
+    f64 threshold = 3.0;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        if (strcmp(argv[i], "--threshold") == 0 && i + 1 < argc)
+        {
+            threshold = atof(argv[++i]);
+        }
+        else if (path_count < 2)
+        {
+            paths[path_count++] = argv[i];
+        }
+    }
+    if (path_count != 2)
+    {
+        fprintf(stderr, "Usage: bench_compare baseline.tsv new.tsv [--threshold PERCENT]\n");
+        return 2;
+    }
+
+    // Too big for the stack
+    CompareFile *files = (CompareFile *)malloc(2 * sizeof(CompareFile));
+    if (!load_results(paths[0], &files[0]) || !load_results(paths[1], &files[1]))
+    {
+        free(files);
+        return 2;
+    }
+
+    printf("baseline: %s (%s)\n", paths[0], files[0].header);
+    printf("new:      %s (%s)\n", paths[1], files[1].header);
+    printf("  %-48s %12s %12s %8s %7s\n", "benchmark", "baseline", "new", "change", "t");
+
+    u32 regressions = 0;
+    u32 improvements = 0;
+    for (u32 i = 0; i < files[1].count; ++i)
+    {
+        CompareResult *after = &files[1].results[i];
+        CompareResult *before = find_result(&files[0], after->name);
+        if (before == NULL)
+        {
+            printf("  %-48s %12s %9.2f ns %8s\n", after->name, "-", after->mean_ns, "new");
+            continue;
+        }
+
+        // Welch's t-test, the two runs need not have the same variance
+        f64 variance_before = before->stddev_ns * before->stddev_ns / before->samples;
+        f64 variance_after = after->stddev_ns * after->stddev_ns / after->samples;
+        f64 standard_error = sqrt(variance_before + variance_after);
+        f64 t = standard_error > 0.0 ? (after->mean_ns - before->mean_ns) / standard_error : 0.0;
+        f64 degrees_of_freedom = 1.0;
+        if (variance_before + variance_after > 0.0)
+        {
+            degrees_of_freedom = (variance_before + variance_after) * (variance_before + variance_after)
+                / (variance_before * variance_before / (before->samples - 1)
+                   + variance_after * variance_after / (after->samples - 1));
+        }
+
+        f64 change = 100.0 * (after->mean_ns - before->mean_ns) / before->mean_ns;
+        bool significant = fabs(t) > t_critical_95(degrees_of_freedom) && fabs(change) > threshold;
+        const char *verdict = "";
+        if (significant && change > 0.0)
+        {
+            verdict = "REGRESSION";
+            ++regressions;
+        }
+        else if (significant)
+        {
+            verdict = "faster";
+            ++improvements;
+        }
+
+        printf("  %-48s %9.2f ns %9.2f ns %+7.1f%% %7.2f  %s\n",
+               after->name, before->mean_ns, after->mean_ns, change, t, verdict);
+    }
+
+    for (u32 i = 0; i < files[0].count; ++i)
+    {
+        if (find_result(&files[1], files[0].results[i].name) == NULL)
+        {
+            printf("  %-48s %9.2f ns %12s %8s\n", files[0].results[i].name,
+                   files[0].results[i].mean_ns, "-", "missing");
+        }
+    }
+
+    printf("%u regressions, %u improvements (95%% confidence, >%.1f%% change)\n",
+           regressions, improvements, threshold);
+
+    free(files);
+    return regressions ? 1 : 0;
+}
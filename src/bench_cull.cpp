@@ -0,0 +1,161 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "platform.hpp"
+#include "math.hpp"
+#include "cull.hpp"
+#include "jobs.hpp"
+#include "bench.hpp"
+
+
+// Frustum culling of N random boxes scattered around the camera, about a
+// tenth of them visible.
+//
+//   aabb/N/<isa>:   cull_range() on one thread, per instruction set
+//   aabb/N/jobs:    cull() split over the job system, best instruction set
+//   sphere/...:     the same with the bounding spheres
+//
+// One iteration culls all N objects.
+
+
+#define BENCH_MAX_OBJECTS 1000000
+
+
+void init_cull_scene(CullBounds *bounds, u32 count)
+{
+    for (u32 i = 0; i < count; ++i)
+    {
+        Vec3 center = vec3((f32)rand() / RAND_MAX - 0.5f,
+                           (f32)rand() / RAND_MAX - 0.5f,
+                           (f32)rand() / RAND_MAX - 0.5f) * 1000.0f;
+        Vec3 extent = vec3(1.0f, 1.0f, 1.0f) * (0.5f + 4.0f * (f32)rand() / RAND_MAX);
+        set_cull_bounds(bounds, i, center - extent, center + extent);
+    }
+    bounds->count = count;
+}
+
+
+// Both lists come from the same test, only FMA rounding right on a plane may
+// tell them apart
+bool same_visible(const u32 *a, u32 a_count, const u32 *b, u32 b_count)
+{
+    u32 i = 0;
+    u32 j = 0;
+    u32 differences = 0;
+    while (i < a_count || j < b_count)
+    {
+        if (i < a_count && j < b_count && a[i] == b[j])
+        {
+            ++i;
+            ++j;
+            continue;
+        }
+        ++differences;
+        if (j == b_count || (i < a_count && a[i] < b[j]))
+        {
+            ++i;
+        }
+        else
+        {
+            ++j;
+        }
+    }
+    return differences <= a_count / 100000;
+}
+
+
+void bench_cull(Bench *bench, const char *name, const Frustum *frustum, CullBounds *bounds,
+                CullShape shape, bool parallel, const u32 *expected, u32 expected_count,
+                u32 *visible)
+{
+    if (!bench_enabled(bench, name))
+    {
+        return;
+    }
+
+    u32 visible_count = parallel
+        ? cull(frustum, bounds, shape, visible)
+        : cull_range(frustum, bounds, shape, 0, bounds->count, visible);
+    if (!same_visible(expected, expected_count, visible, visible_count))
+    {
+        char reason[64];
+        snprintf(reason, sizeof(reason), "%u visible, scalar found %u", visible_count, expected_count);
+        bench_fail(bench, name, reason);
+        return;
+    }
+
+    bench_run(bench, name, bounds->count, [&](u64 iterations)
+    {
+        for (u64 i = 0; i < iterations; ++i)
+        {
+            u32 count = parallel
+                ? cull(frustum, bounds, shape, visible)
+                : cull_range(frustum, bounds, shape, 0, bounds->count, visible);
+            bench_do_not_optimize(count);
+        }
+    });
+}
+
+
+void run_cull_benchmarks(Bench *bench)
+{
+    bench_suite(bench, "cull");
+
+    memory_index memory_size = Megabytes(64);
+    void *memory = platform_reserve_memory(memory_size);
+    if (memory == NULL)
+    {
+        bench_fail(bench, "*", "failed to reserve benchmark memory");
+        return;
+    }
+
+    MemoryArena arena;
+    initialize_arena(&arena, memory_size, memory);
+
+    CullBounds bounds;
+    push_cull_bounds(&bounds, &arena, BENCH_MAX_OBJECTS);
+    u32 *expected = push_array(&arena, BENCH_MAX_OBJECTS, u32);
+    u32 *visible = push_array(&arena, BENCH_MAX_OBJECTS, u32);
+
+    srand(1);
+    init_cull_scene(&bounds, BENCH_MAX_OBJECTS);
+
+    Mat4 view = look_at(vec3(0.0f, 0.0f, 0.0f), vec3(1.0f, 0.2f, -1.0f), vec3(0.0f, 1.0f, 0.0f));
+    Frustum frustum = frustum_from_matrix(perspective(radians(60.0f), 16.0f / 9.0f, 0.1f, 1000.0f) * view);
+
+    const CullShape shapes[] = {CULL_AABB, CULL_SPHERE};
+    const u32 counts[] = {1000, 10000, 100000, 1000000};
+
+    CpuIsa selected = cull_kernels_isa();
+    for (u32 s = 0; s < sizeof(shapes) / sizeof(shapes[0]); ++s)
+    {
+        const char *shape_name = shapes[s] == CULL_AABB ? "aabb" : "sphere";
+        for (u32 c = 0; c < sizeof(counts) / sizeof(counts[0]); ++c)
+        {
+            bounds.count = counts[c];
+            u32 expected_count = cull_range_scalar(&frustum, &bounds, shapes[s], 0, bounds.count, expected);
+
+            char name[64];
+            snprintf(name, sizeof(name), "%s/%u/scalar", shape_name, counts[c]);
+            select_cull_kernels(CPU_ISA_SCALAR);
+            bench_cull(bench, name, &frustum, &bounds, shapes[s], false, expected, expected_count, visible);
+
+            for (u32 isa = bench->first_isa; isa <= bench->last_isa; ++isa)
+            {
+                snprintf(name, sizeof(name), "%s/%u/%s", shape_name, counts[c], cpu_isa_name((CpuIsa)isa));
+                select_cull_kernels((CpuIsa)isa);
+                bench_cull(bench, name, &frustum, &bounds, shapes[s], false, expected, expected_count, visible);
+            }
+
+            if (counts[c] >= CULL_PARALLEL_MIN && jobs_thread_count() > 1)
+            {
+                snprintf(name, sizeof(name), "%s/%u/jobs", shape_name, counts[c]);
+                select_cull_kernels(bench->last_isa);
+                bench_cull(bench, name, &frustum, &bounds, shapes[s], true, expected, expected_count, visible);
+            }
+        }
+    }
+    select_cull_kernels(selected);
+
+    platform_release_memory(memory, memory_size);
+}
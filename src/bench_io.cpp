@@ -0,0 +1,244 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+
+#include "platform.hpp"
+#include "file_io.hpp"
+#include "bench.hpp"
+
+
+// Loading BENCH_IO_FILES small files (1 to 16 KB) into an arena, each into
+// its own BENCH_IO_SLOT.
+//
+//   sync:          open, read and close one after the other on this thread
+//   threads:       file_io.hpp's fallback, pread on the background jobs
+//   uring:         one submit for all of them, three linked operations each
+//   uring_fixed:   the same reading into a registered arena
+//
+// warm/ has the files in the page cache. cold/ drops them from it first
+// (POSIX_FADV_DONTNEED), which costs what cold/evict costs on its own:
+// there the depth of the queue matters, the device works on many reads at
+// once instead of one per thread. Items are files.
+
+
+#define BENCH_IO_FILES 2000
+#define BENCH_IO_SLOT  Kilobytes(16)
+
+
+struct BenchIoFiles
+{
+    char  (*names)[96];
+    u32    *sizes;
+    u32    *hashes;
+    u8     *arena;
+    u32     completed;
+    u32     failed;
+};
+
+
+internal u32 hash_bytes(const u8 *bytes, u32 size)
+{
+    u32 hash = 2166136261u;
+    for (u32 i = 0; i < size; ++i)
+    {
+        hash = (hash ^ bytes[i]) * 16777619u;
+    }
+    return hash;
+}
+
+
+internal bool files_match(BenchIoFiles *files)
+{
+    for (u32 i = 0; i < BENCH_IO_FILES; ++i)
+    {
+        if (hash_bytes(files->arena + i * BENCH_IO_SLOT, files->sizes[i]) != files->hashes[i])
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+
+internal void evict_files(BenchIoFiles *files)
+{
+    for (u32 i = 0; i < BENCH_IO_FILES; ++i)
+    {
+        int file = open(files->names[i], O_RDONLY);
+        if (file >= 0)
+        {
+            posix_fadvise(file, 0, 0, POSIX_FADV_DONTNEED);
+            close(file);
+        }
+    }
+}
+
+
+internal void load_files_sync(BenchIoFiles *files)
+{
+    for (u32 i = 0; i < BENCH_IO_FILES; ++i)
+    {
+        int file = open(files->names[i], O_RDONLY);
+        if (file < 0 || read(file, files->arena + i * BENCH_IO_SLOT, BENCH_IO_SLOT) != files->sizes[i])
+        {
+            ++files->failed;
+        }
+        close(file);
+    }
+}
+
+
+internal void file_loaded(void *user, u8 *buffer, i64 result)
+{
+    BenchIoFiles *files = (BenchIoFiles *)user;
+    u32 index = (u32)((buffer - files->arena) / BENCH_IO_SLOT);
+    files->failed += result != files->sizes[index];
+    ++files->completed;
+}
+
+
+// Keeps IO_MAX_REQUESTS in flight, refilling as they complete
+internal void load_files_async(BenchIoFiles *files)
+{
+    u32 queued = 0;
+    files->completed = 0;
+    while (files->completed < BENCH_IO_FILES)
+    {
+        while (queued < BENCH_IO_FILES
+               && io_read_file(files->names[queued], files->arena + queued * BENCH_IO_SLOT, BENCH_IO_SLOT,
+                               file_loaded, files))
+        {
+            ++queued;
+        }
+        io_submit();
+        io_complete(true);
+    }
+}
+
+
+void run_io_benchmarks(Bench *bench)
+{
+    bench_suite(bench, "io");
+    if (!bench_enabled(bench, "warm/") && !bench_enabled(bench, "cold/"))
+    {
+        return;
+    }
+
+    char directory[64];
+    snprintf(directory, sizeof(directory), "/tmp/bench_io_%d", (int)getpid());
+    mkdir(directory, 0700);
+
+    srand(11);
+    BenchIoFiles files = {};
+    files.names = (char (*)[96])malloc(BENCH_IO_FILES * sizeof(*files.names));
+    files.sizes = (u32 *)malloc(BENCH_IO_FILES * sizeof(u32));
+    files.hashes = (u32 *)malloc(BENCH_IO_FILES * sizeof(u32));
+    memory_index arena_size = BENCH_IO_FILES * BENCH_IO_SLOT;
+    files.arena = (u8 *)platform_reserve_memory(arena_size);
+    memset(files.arena, 0, arena_size);
+
+    bool ok = true;
+    for (u32 i = 0; i < BENCH_IO_FILES; ++i)
+    {
+        snprintf(files.names[i], sizeof(files.names[i]), "%s/asset_%04u.bin", directory, i);
+        files.sizes[i] = 1024 + (u32)rand() % (15 * 1024);
+        for (u32 j = 0; j < files.sizes[i]; ++j)
+        {
+            files.arena[j] = (u8)rand();
+        }
+        files.hashes[i] = hash_bytes(files.arena, files.sizes[i]);
+
+        FILE *file = fopen(files.names[i], "wb");
+        ok = ok && file && fwrite(files.arena, 1, files.sizes[i], file) == files.sizes[i];
+        ok = file && fclose(file) == 0 && ok;
+    }
+    if (!ok)
+    {
+        bench_fail(bench, "*", "could not write the files");
+    }
+
+    const char *modes[] = {"sync", "threads", "uring", "uring_fixed"};
+    for (u32 cold = 0; cold < 2; ++cold)
+    {
+        for (u32 mode = 0; mode < 4; ++mode)
+        {
+            char name[64];
+            snprintf(name, sizeof(name), "%s/%s", cold ? "cold" : "warm", modes[mode]);
+            if (!bench_enabled(bench, name))
+            {
+                continue;
+            }
+
+            if (mode > 0)
+            {
+                init_io(mode >= 2);
+                if (mode >= 2 && io_backend() != IO_BACKEND_URING)
+                {
+                    printf("  %s: io_uring not available\n", name);
+                    shutdown_io();
+                    continue;
+                }
+                if (mode == 3 && !io_register_buffer(files.arena, arena_size))
+                {
+                    printf("  %s: could not register the arena (RLIMIT_MEMLOCK)\n", name);
+                }
+            }
+
+            files.failed = 0;
+            memset(files.arena, 0, arena_size);
+            bench_run(bench, name, BENCH_IO_FILES, [&](u64 iterations)
+            {
+                for (u64 i = 0; i < iterations; ++i)
+                {
+                    if (cold)
+                    {
+                        evict_files(&files);
+                    }
+                    if (mode == 0)
+                    {
+                        load_files_sync(&files);
+                    }
+                    else
+                    {
+                        load_files_async(&files);
+                    }
+                    bench_clobber_memory();
+                }
+            });
+            if (files.failed)
+            {
+                bench_fail(bench, name, "reads came back short or failed");
+            }
+            else if (!files_match(&files))
+            {
+                bench_fail(bench, name, "a file came back with the wrong contents");
+            }
+
+            if (mode > 0)
+            {
+                shutdown_io();
+            }
+        }
+    }
+
+    bench_run(bench, "cold/evict", BENCH_IO_FILES, [&](u64 iterations)
+    {
+        for (u64 i = 0; i < iterations; ++i)
+        {
+            evict_files(&files);
+        }
+    });
+
+    for (u32 i = 0; i < BENCH_IO_FILES; ++i)
+    {
+        unlink(files.names[i]);
+    }
+    rmdir(directory);
+    platform_release_memory(files.arena, arena_size);
+    free(files.hashes);
+    free(files.sizes);
+    free(files.names);
+}
@@ -0,0 +1,126 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "platform.hpp"
+#include "cpu.hpp"
+#include "math.hpp"
+#include "cull.hpp"
+#include "image_filter.hpp"
+#include "jobs.hpp"
+#include "bench.hpp"
+
+
+// Runs every microbenchmark suite.
+//
+//   bench [--filter TEXT] [--out results.tsv] [--samples N] [--min-time MS]
+//         [--isa scalar|sse2|avx2|avx512] [--threads N]
+//
+// --filter keeps benchmarks whose "suite/name" contains TEXT. --isa limits
+// the SIMD suites to one instruction set instead of every one the CPU has.
+// --threads sets the job system's worker count (default one per core).
+// Compare two --out files with bench_compare.
+
+
+void run_math_benchmarks(Bench *bench);
+void run_cull_benchmarks(Bench *bench);
+void run_transform_benchmarks(Bench *bench);
+void run_pool_benchmarks(Bench *bench);
+void run_texture_benchmarks(Bench *bench);
+void run_obj_benchmarks(Bench *bench);
+void run_mesh_benchmarks(Bench *bench);
+void run_pack_benchmarks(Bench *bench);
+void run_io_benchmarks(Bench *bench);
+
+
+int main(int argc, char *argv[])
+{
+    Bench bench;
+    init_bench(&bench);
+    const char *out_path = NULL;
+    u32 worker_count = 0;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        if (strcmp(argv[i], "--filter") == 0 && i + 1 < argc)
+        {
+            bench.filter = argv[++i];
+        }
+        else if (strcmp(argv[i], "--out") == 0 && i + 1 < argc)
+        {
+            out_path = argv[++i];
+        }
+        else if (strcmp(argv[i], "--samples") == 0 && i + 1 < argc)
+        {
+            bench.sample_count = (u32)atoi(argv[++i]);
+        }
+        else if (strcmp(argv[i], "--min-time") == 0 && i + 1 < argc)
+        {
+            bench.min_sample_ns = atof(argv[++i]) * 1e6;
+        }
+        else if (strcmp(argv[i], "--threads") == 0 && i + 1 < argc)
+        {
+            worker_count = (u32)atoi(argv[++i]);
+        }
+        else if (strcmp(argv[i], "--isa") == 0 && i + 1 < argc)
+        {
+            CpuIsa isa;
+            if (!parse_cpu_isa(argv[++i], &isa) || !cpu_isa_supported(isa))
+            {
+                fprintf(stderr, "Unknown or unsupported instruction set: %s\n", argv[i]);
+                return 1;
+            }
+            bench.first_isa = isa;
+            bench.last_isa = isa;
+        }
+        else
+        {
+            fprintf(stderr, "Unknown argument: %s\n", argv[i]);
+            return 1;
+        }
+    }
+
+    if (out_path)
+    {
+        bench.out = fopen(out_path, "w");
+        if (bench.out == NULL)
+        {
+            fprintf(stderr, "Failed to open %s\n", out_path);
+            return 1;
+        }
+    }
+
+    select_math_kernels(bench.last_isa);
+    select_cull_kernels(bench.last_isa);
+    select_image_filter_kernels(bench.last_isa);
+    init_jobs(worker_count);
+
+    printf("%u samples of at least %.1f ms each, cpu supports %s, %u job threads\n",
+           bench.sample_count, bench.min_sample_ns / 1e6, cpu_isa_name(cpu_best_isa()),
+           jobs_thread_count());
+    printf("  %-48s %15s %18s %8s\n", "benchmark", "median", "per item", "stddev");
+    bench_begin_output(&bench);
+
+    run_math_benchmarks(&bench);
+    run_cull_benchmarks(&bench);
+    run_transform_benchmarks(&bench);
+    run_pool_benchmarks(&bench);
+    run_texture_benchmarks(&bench);
+    run_obj_benchmarks(&bench);
+    run_mesh_benchmarks(&bench);
+    run_pack_benchmarks(&bench);
+    run_io_benchmarks(&bench);
+
+    shutdown_jobs();
+
+    if (bench.out)
+    {
+        fclose(bench.out);
+        printf("%u results written to %s\n", bench.run_count, out_path);
+    }
+    if (bench.run_count == 0)
+    {
+        fprintf(stderr, "No benchmark matched the filter\n");
+    }
+    return bench.failed ? 1 : 0;
+}
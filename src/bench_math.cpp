@@ -0,0 +1,383 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "platform.hpp"
+#include "math.hpp"
+#include "bench.hpp"
+
+
+// Per-object matrix math at scene scale, against plain scalar loops and a
+// glm-style implementation (vec4 columns with operator overloads, AoS
+// points, the way the LearnOpenGL chapters use glm).
+//
+//   points: transform N points by one model matrix
+//   mul:    N independent matrix products a[i] * b[i]
+//   mvp:    N model-view-projection matrices from one view-projection
+//
+// One iteration processes all BENCH_OBJECTS. The dispatched kernels run
+// once per instruction set in the Bench's range.
+
+
+#define BENCH_OBJECTS     100000
+#define BENCH_MAX_ERROR   1e-3f
+
+
+// glm-style ###################################################################
+
+
+struct GlmVec3
+{
+    f32 x, y, z;
+};
+
+
+struct GlmVec4
+{
+    f32 x, y, z, w;
+
+    GlmVec4() = default;
+    GlmVec4(f32 x, f32 y, f32 z, f32 w) : x(x), y(y), z(z), w(w) {}
+    GlmVec4(GlmVec3 v, f32 w) : x(v.x), y(v.y), z(v.z), w(w) {}
+
+    f32 operator[](u32 i) const { return (&x)[i]; }
+};
+
+
+inline GlmVec4 operator+(GlmVec4 a, GlmVec4 b) { return GlmVec4(a.x + b.x, a.y + b.y, a.z + b.z, a.w + b.w); }
+inline GlmVec4 operator*(GlmVec4 a, f32 s) { return GlmVec4(a.x * s, a.y * s, a.z * s, a.w * s); }
+
+
+struct GlmMat4
+{
+    GlmVec4 value[4];
+
+    GlmVec4 &operator[](u32 i) { return value[i]; }
+    const GlmVec4 &operator[](u32 i) const { return value[i]; }
+};
+
+
+inline GlmVec4 operator*(const GlmMat4 &m, const GlmVec4 &v)
+{
+    return m[0] * v[0] + m[1] * v[1] + m[2] * v[2] + m[3] * v[3];
+}
+
+
+inline GlmMat4 operator*(const GlmMat4 &a, const GlmMat4 &b)
+{
+    GlmMat4 result;
+    result[0] = a[0] * b[0][0] + a[1] * b[0][1] + a[2] * b[0][2] + a[3] * b[0][3];
+    result[1] = a[0] * b[1][0] + a[1] * b[1][1] + a[2] * b[1][2] + a[3] * b[1][3];
+    result[2] = a[0] * b[2][0] + a[1] * b[2][1] + a[2] * b[2][2] + a[3] * b[2][3];
+    result[3] = a[0] * b[3][0] + a[1] * b[3][1] + a[2] * b[3][2] + a[3] * b[3][3];
+    return result;
+}
+
+
+// Harness #####################################################################
+
+
+struct BenchData
+{
+    Vec3SoA  points;
+    Vec3SoA  points_out;
+    GlmVec3 *glm_points;
+    GlmVec3 *glm_points_out;
+    GlmMat4 *glm_a;
+    GlmMat4 *glm_b;
+    GlmMat4 *glm_out;
+    GlmMat4  glm_view_projection;
+
+    Mat4    *a;
+    Mat4    *b;
+    Mat4    *out;
+    Mat4     view_projection;
+};
+
+
+f32 random_unit()
+{
+    return (f32)rand() / (f32)RAND_MAX * 2.0f - 1.0f;
+}
+
+
+Mat4 random_transform()
+{
+    Vec3 axis = vec3(random_unit(), random_unit(), random_unit() + 2.0f);
+    return compose_transform(vec3(random_unit(), random_unit(), random_unit()) * 100.0f,
+                             quat_from_axis_angle(normalize(axis), random_unit() * PI32),
+                             vec3(1.0f, 1.0f, 1.0f) * (1.5f + random_unit()));
+}
+
+
+void init_bench_data(BenchData *data, MemoryArena *arena)
+{
+    u32 count = BENCH_OBJECTS;
+    data->points.x = push_array(arena, count, f32);
+    data->points.y = push_array(arena, count, f32);
+    data->points.z = push_array(arena, count, f32);
+    data->points_out.x = push_array(arena, count, f32);
+    data->points_out.y = push_array(arena, count, f32);
+    data->points_out.z = push_array(arena, count, f32);
+    data->glm_points = push_array(arena, count, GlmVec3);
+    data->glm_points_out = push_array(arena, count, GlmVec3);
+    data->a = push_array(arena, count, Mat4);
+    data->b = push_array(arena, count, Mat4);
+    data->out = push_array(arena, count, Mat4);
+    data->glm_a = push_array(arena, count, GlmMat4);
+    data->glm_b = push_array(arena, count, GlmMat4);
+    data->glm_out = push_array(arena, count, GlmMat4);
+
+    for (u32 i = 0; i < count; ++i)
+    {
+        Vec3 p = vec3(random_unit(), random_unit(), random_unit()) * 10.0f;
+        data->points.x[i] = p.x;
+        data->points.y[i] = p.y;
+        data->points.z[i] = p.z;
+        data->glm_points[i] = {p.x, p.y, p.z};
+        data->a[i] = random_transform();
+        data->b[i] = random_transform();
+        memcpy(&data->glm_a[i], &data->a[i], sizeof(GlmMat4));
+        memcpy(&data->glm_b[i], &data->b[i], sizeof(GlmMat4));
+    }
+
+    Mat4 view = look_at(vec3(0.0f, 50.0f, 200.0f), vec3(0.0f, 0.0f, 0.0f), vec3(0.0f, 1.0f, 0.0f));
+    data->view_projection = perspective(radians(60.0f), 16.0f / 9.0f, 0.1f, 1000.0f) * view;
+    memcpy(&data->glm_view_projection, &data->view_projection, sizeof(GlmMat4));
+}
+
+
+enum BenchKernel
+{
+    BENCH_POINTS_GLM,
+    BENCH_POINTS_SCALAR,
+    BENCH_POINTS_SIMD,
+    BENCH_MUL_GLM,
+    BENCH_MUL_SCALAR,
+    BENCH_MUL_SSE,
+    BENCH_MUL_BATCH,
+    BENCH_MVP_GLM,
+    BENCH_MVP_SCALAR,
+    BENCH_MVP_BATCH,
+    BENCH_KERNEL_COUNT
+};
+
+
+const char *bench_kernel_name(BenchKernel kernel)
+{
+    switch (kernel)
+    {
+        case BENCH_POINTS_GLM:    return "points/glm";
+        case BENCH_POINTS_SCALAR: return "points/scalar";
+        case BENCH_POINTS_SIMD:   return "points/soa";
+        case BENCH_MUL_GLM:       return "mul/glm";
+        case BENCH_MUL_SCALAR:    return "mul/scalar";
+        case BENCH_MUL_SSE:       return "mul/mat4_operator";
+        case BENCH_MUL_BATCH:     return "mul/batch";
+        case BENCH_MVP_GLM:       return "mvp/glm";
+        case BENCH_MVP_SCALAR:    return "mvp/scalar";
+        case BENCH_MVP_BATCH:     return "mvp/batch";
+        default:                  return "?";
+    }
+}
+
+
+void run_kernel(BenchData *data, BenchKernel kernel)
+{
+    u32 count = BENCH_OBJECTS;
+    switch (kernel)
+    {
+        case BENCH_POINTS_GLM:
+        {
+            const GlmMat4 &model = data->glm_a[0];
+            for (u32 i = 0; i < count; ++i)
+            {
+                GlmVec4 p = model * GlmVec4(data->glm_points[i], 1.0f);
+                data->glm_points_out[i] = {p.x, p.y, p.z};
+            }
+        } break;
+
+        case BENCH_POINTS_SCALAR:
+            transform_points_soa_scalar(&data->a[0], data->points, data->points_out, count);
+            break;
+
+        case BENCH_POINTS_SIMD:
+            transform_points_soa(&data->a[0], data->points, data->points_out, count);
+            break;
+
+        case BENCH_MUL_GLM:
+        {
+            for (u32 i = 0; i < count; ++i)
+            {
+                data->glm_out[i] = data->glm_a[i] * data->glm_b[i];
+            }
+        } break;
+
+        case BENCH_MUL_SCALAR:
+            multiply_mat4_batch_scalar(data->out, data->a, data->b, count);
+            break;
+
+        case BENCH_MUL_SSE:
+            for (u32 i = 0; i < count; ++i)
+            {
+                data->out[i] = data->a[i] * data->b[i];
+            }
+            break;
+
+        case BENCH_MUL_BATCH:
+            multiply_mat4_batch(data->out, data->a, data->b, count);
+            break;
+
+        case BENCH_MVP_GLM:
+        {
+            const GlmMat4 &vp = data->glm_view_projection;
+            for (u32 i = 0; i < count; ++i)
+            {
+                data->glm_out[i] = vp * data->glm_a[i];
+            }
+        } break;
+
+        case BENCH_MVP_SCALAR:
+            compute_mvp_batch_scalar(data->out, &data->view_projection, data->a, count);
+            break;
+
+        case BENCH_MVP_BATCH:
+            compute_mvp_batch(data->out, &data->view_projection, data->a, count);
+            break;
+
+        default:
+            break;
+    }
+}
+
+
+// Largest difference against the scalar result of the same operation, so a
+// fast but wrong kernel shows up in the report.
+f32 kernel_error(BenchData *data, BenchKernel kernel, MemoryArena *arena)
+{
+    TemporaryMemory temp = begin_temporary_memory(arena);
+    u32 count = BENCH_OBJECTS;
+    f32 error = 0.0f;
+
+    if (kernel <= BENCH_POINTS_SIMD)
+    {
+        Vec3SoA expected;
+        expected.x = push_array(arena, count, f32);
+        expected.y = push_array(arena, count, f32);
+        expected.z = push_array(arena, count, f32);
+        transform_points_soa_scalar(&data->a[0], data->points, expected, count);
+
+        for (u32 i = 0; i < count; ++i)
+        {
+            Vec3 got = kernel == BENCH_POINTS_GLM
+                ? vec3(data->glm_points_out[i].x, data->glm_points_out[i].y, data->glm_points_out[i].z)
+                : vec3(data->points_out.x[i], data->points_out.y[i], data->points_out.z[i]);
+            Vec3 difference = got - vec3(expected.x[i], expected.y[i], expected.z[i]);
+            error = fmaxf(error, length(difference));
+        }
+    }
+    else
+    {
+        Mat4 *expected = push_array(arena, count, Mat4);
+        if (kernel <= BENCH_MUL_BATCH)
+        {
+            multiply_mat4_batch_scalar(expected, data->a, data->b, count);
+        }
+        else
+        {
+            compute_mvp_batch_scalar(expected, &data->view_projection, data->a, count);
+        }
+
+        bool glm = kernel == BENCH_MUL_GLM || kernel == BENCH_MVP_GLM;
+        for (u32 i = 0; i < count; ++i)
+        {
+            const f32 *got = glm ? &data->glm_out[i].value[0].x : &data->out[i].e[0][0];
+            for (u32 j = 0; j < 16; ++j)
+            {
+                f32 difference = got[j] - (&expected[i].e[0][0])[j];
+                error = fmaxf(error, fabsf(difference));
+            }
+        }
+    }
+
+    end_temporary_memory(temp);
+    return error;
+}
+
+
+bool is_dispatched(BenchKernel kernel)
+{
+    return kernel == BENCH_POINTS_SIMD || kernel == BENCH_MUL_BATCH || kernel == BENCH_MVP_BATCH;
+}
+
+
+void bench_kernel(Bench *bench, BenchData *data, BenchKernel kernel, const char *name,
+                  MemoryArena *arena)
+{
+    if (!bench_enabled(bench, name))
+    {
+        return;
+    }
+
+    // A fast but wrong kernel should not make it into the results
+    run_kernel(data, kernel);
+    f32 error = kernel_error(data, kernel, arena);
+    if (!(error <= BENCH_MAX_ERROR))
+    {
+        char reason[64];
+        snprintf(reason, sizeof(reason), "max error %g against scalar", error);
+        bench_fail(bench, name, reason);
+        return;
+    }
+
+    bench_run(bench, name, BENCH_OBJECTS, [&](u64 iterations)
+    {
+        for (u64 i = 0; i < iterations; ++i)
+        {
+            run_kernel(data, kernel);
+        }
+    });
+}
+
+
+void run_math_benchmarks(Bench *bench)
+{
+    bench_suite(bench, "math");
+
+    memory_index memory_size = Megabytes(128);
+    void *memory = platform_reserve_memory(memory_size);
+    if (memory == NULL)
+    {
+        bench_fail(bench, "*", "failed to reserve benchmark memory");
+        return;
+    }
+
+    MemoryArena arena;
+    initialize_arena(&arena, memory_size, memory);
+
+    BenchData data;
+    srand(1);
+    init_bench_data(&data, &arena);
+
+    CpuIsa selected = math_kernels_isa();
+    for (u32 kernel = 0; kernel < BENCH_KERNEL_COUNT; ++kernel)
+    {
+        const char *name = bench_kernel_name((BenchKernel)kernel);
+        if (!is_dispatched((BenchKernel)kernel))
+        {
+            bench_kernel(bench, &data, (BenchKernel)kernel, name, &arena);
+            continue;
+        }
+
+        for (u32 isa = bench->first_isa; isa <= bench->last_isa; ++isa)
+        {
+            char isa_name[64];
+            snprintf(isa_name, sizeof(isa_name), "%s/%s", name, cpu_isa_name((CpuIsa)isa));
+            select_math_kernels((CpuIsa)isa);
+            bench_kernel(bench, &data, (BenchKernel)kernel, isa_name, &arena);
+        }
+    }
+    select_math_kernels(selected);
+
+    platform_release_memory(memory, memory_size);
+}
@@ -0,0 +1,482 @@
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "platform.hpp"
+#include "mesh.hpp"
+#include "obj.hpp"
+#include "cooked_mesh.hpp"
+#include "mesh_optimize.hpp"
+#include "mesh_simplify.hpp"
+#include "vertex_format.hpp"
+#include "file_io.hpp"
+#include "stream.hpp"
+#include "bench.hpp"
+
+
+// Loading the obj suite's grid mesh from a file until its vertices and
+// indices are ready for glBufferData(), which the benchmark stands in for
+// with a copy into buffers of the same size.
+//
+//   load/obj:    load_obj(), mapping and parsing the text
+//   load/cmesh:  map_cooked_mesh(), the blobs are used where they are mapped
+//   optimize/grid:   optimize_mesh() on the grid with its triangles
+//                    shuffled, printing the ACMR, ATVR and overdraw (see
+//                    analyze_overdraw()) before and after
+//   optimize/torus:  the same on a torus, which unlike the grid hides part
+//                    of itself from the side, so there is overdraw to cut
+//   simplify:    generate_mesh_lods() on the grid, printing each LOD
+//
+// Items are triangles, but for quantize/, quantize_vertices() on the grid
+// in each VertexFormat, which fails if a dequantized vertex is further
+// off than vertex_format.hpp allows. Items are vertices there. Both files are in the page cache after the first
+// load, so this is the cost of the format, not of the disk.
+//
+// stream/ is the .cmesh on its way to glBufferSubData() in
+// STREAM_MESH_STRIP copies, in the page cache (warm/) and dropped from it
+// first (cold/, POSIX_FADV_DONTNEED). Items are bytes of the file.
+//
+//   mapped:      the strips copied straight from map_cooked_mesh(), all of
+//                it on the GL thread, page faults included
+//   read:        io_read_file() into a registered arena, what stream.cpp
+//                leaves to the background before uploading
+//   strips:      the strips copied from the arena, the GL thread's part
+
+
+#define BENCH_TORUS_RINGS 512             // around the axis
+#define BENCH_TORUS_SIDES 128             // around the tube
+
+
+char *make_grid_obj(memory_index *size);
+
+
+internal void copy_strips(u8 *destination, const void *source, u64 size)
+{
+    for (u64 offset = 0; offset < size; offset += STREAM_MESH_STRIP)
+    {
+        u64 bytes = size - offset < STREAM_MESH_STRIP ? size - offset : STREAM_MESH_STRIP;
+        memcpy(destination + offset, (const u8 *)source + offset, bytes);
+    }
+}
+
+
+internal void evict_file(const char *path)
+{
+    int file = open(path, O_RDONLY);
+    if (file >= 0)
+    {
+        posix_fadvise(file, 0, 0, POSIX_FADV_DONTNEED);
+        close(file);
+    }
+}
+
+
+internal void file_read(void *user, u8 *buffer, i64 result)
+{
+    (void)buffer;
+    *(i64 *)user = result;
+}
+
+
+// In the ring's plane, outward facing and counterclockwise
+internal void make_torus(Mesh *mesh)
+{
+    mesh->vertex_count = BENCH_TORUS_RINGS * BENCH_TORUS_SIDES;
+    mesh->index_count = mesh->vertex_count * 6;
+    mesh->vertices = (Vertex *)malloc((u64)mesh->vertex_count * sizeof(Vertex));
+    mesh->indices = (u32 *)malloc((u64)mesh->index_count * sizeof(u32));
+    mesh->lod_count = 0;
+
+    for (u32 ring = 0; ring < BENCH_TORUS_RINGS; ++ring)
+    {
+        f32 u = 2.0f * PI32 * (f32)ring / BENCH_TORUS_RINGS;
+        for (u32 side = 0; side < BENCH_TORUS_SIDES; ++side)
+        {
+            f32 v = 2.0f * PI32 * (f32)side / BENCH_TORUS_SIDES;
+            Vec3 normal = vec3(cosf(v) * cosf(u), sinf(v), cosf(v) * sinf(u));
+            Vertex *vertex = &mesh->vertices[ring * BENCH_TORUS_SIDES + side];
+            vertex->position = vec3(cosf(u), 0.0f, sinf(u)) + 0.4f * normal;
+            vertex->normal = normal;
+            vertex->uv = vec2((f32)ring / BENCH_TORUS_RINGS, (f32)side / BENCH_TORUS_SIDES);
+        }
+    }
+
+    u32 *index = mesh->indices;
+    for (u32 ring = 0; ring < BENCH_TORUS_RINGS; ++ring)
+    {
+        u32 next_ring = (ring + 1) % BENCH_TORUS_RINGS;
+        for (u32 side = 0; side < BENCH_TORUS_SIDES; ++side)
+        {
+            u32 next_side = (side + 1) % BENCH_TORUS_SIDES;
+            u32 a = ring * BENCH_TORUS_SIDES + side;
+            u32 b = ring * BENCH_TORUS_SIDES + next_side;
+            u32 c = next_ring * BENCH_TORUS_SIDES + next_side;
+            u32 d = next_ring * BENCH_TORUS_SIDES + side;
+            *index++ = a; *index++ = b; *index++ = c;
+            *index++ = a; *index++ = c; *index++ = d;
+        }
+    }
+}
+
+
+// As an exporter might leave them
+internal void shuffle_triangles(u32 *indices, u32 index_count)
+{
+    for (u32 i = index_count / 3 - 1; i > 0; --i)
+    {
+        u32 j = (u32)rand() % (i + 1);
+        for (u32 c = 0; c < 3; ++c)
+        {
+            u32 index = indices[i * 3 + c];
+            indices[i * 3 + c] = indices[j * 3 + c];
+            indices[j * 3 + c] = index;
+        }
+    }
+}
+
+
+// optimize_mesh() on a copy of `mesh` with its triangles shuffled
+internal void bench_optimize(Bench *bench, const char *name, const Mesh *mesh, MemoryArena *scratch)
+{
+    if (!bench_enabled(bench, name))
+    {
+        return;
+    }
+
+    u32 *shuffled = (u32 *)malloc((u64)mesh->index_count * sizeof(u32));
+    memcpy(shuffled, mesh->indices, (u64)mesh->index_count * sizeof(u32));
+    shuffle_triangles(shuffled, mesh->index_count);
+
+    Mesh optimized = *mesh;
+    optimized.vertices = (Vertex *)malloc((u64)mesh->vertex_count * sizeof(Vertex));
+    optimized.indices = (u32 *)malloc((u64)mesh->index_count * sizeof(u32));
+    MeshOptimizeStats stats = {};
+    bench_run(bench, name, mesh->index_count / 3, [&](u64 iterations)
+    {
+        for (u64 i = 0; i < iterations; ++i)
+        {
+            memcpy(optimized.vertices, mesh->vertices, (u64)mesh->vertex_count * sizeof(Vertex));
+            memcpy(optimized.indices, shuffled, (u64)mesh->index_count * sizeof(u32));
+            optimized.vertex_count = mesh->vertex_count;
+            if (!optimize_mesh(&optimized, scratch, &stats))
+            {
+                bench_fail(bench, name, "out of scratch");
+                return;
+            }
+            bench_clobber_memory();
+        }
+    });
+
+    OverdrawStats before = analyze_overdraw(shuffled, mesh->index_count, mesh->vertices, mesh->vertex_count,
+                                            scratch);
+    OverdrawStats after = analyze_overdraw(optimized.indices, optimized.index_count, optimized.vertices,
+                                           optimized.vertex_count, scratch);
+    if (before.covered != after.covered)
+    {
+        bench_fail(bench, name, "the optimized mesh covers different pixels");
+    }
+    printf("  %s/%s: ACMR %.3f -> %.3f, ATVR %.3f -> %.3f (%u entry FIFO), overdraw %.3f -> %.3f\n",
+           bench->suite, name, stats.before.acmr, stats.after.acmr, stats.before.atvr, stats.after.atvr,
+           MESH_CACHE_SIZE, before.overdraw, after.overdraw);
+
+    free(optimized.indices);
+    free(optimized.vertices);
+    free(shuffled);
+}
+
+
+// NULL when every vertex comes back within the format's steps, which a
+// little float rounding on top of is allowed
+internal const char *check_quantized(const Mesh *mesh, const void *quantized, VertexFormat format,
+                                     const VertexDequantization *dequantization)
+{
+    f32 position_step = 0.0f;
+    f32 uv_step = 0.0f;
+    f32 normal_step = 0.0f;
+    if (format == VERTEX_FORMAT_UNORM16)
+    {
+        position_step = 1.0f / 131070.0f;
+        uv_step = 1.0f / 131070.0f;
+        normal_step = 1.0f / 1022.0f;
+    }
+    else if (format == VERTEX_FORMAT_HALF)
+    {
+        position_step = 1.0f / 4096.0f;
+        uv_step = 1.0f / 131070.0f;
+        normal_step = 1.0f / 1022.0f;
+    }
+
+    f32 position_tolerance[3];
+    f32 uv_tolerance[2];
+    for (u32 c = 0; c < 3; ++c)
+    {
+        position_tolerance[c] = position_step * dequantization->position_scale.e[c]
+                              + 1e-6f * (fabsf(dequantization->position_offset.e[c])
+                                         + fabsf(dequantization->position_scale.e[c]));
+    }
+    for (u32 c = 0; c < 2; ++c)
+    {
+        uv_tolerance[c] = uv_step * dequantization->uv_scale.e[c]
+                        + 1e-6f * (fabsf(dequantization->uv_offset.e[c]) + fabsf(dequantization->uv_scale.e[c]));
+    }
+    f32 normal_tolerance = normal_step + 1e-6f;
+
+    for (u32 i = 0; i < mesh->vertex_count; ++i)
+    {
+        const Vertex *expected = &mesh->vertices[i];
+        Vertex vertex = dequantize_vertex(quantized, i, format, dequantization);
+        for (u32 c = 0; c < 3; ++c)
+        {
+            if (fabsf(vertex.position.e[c] - expected->position.e[c]) > position_tolerance[c])
+            {
+                return "a position is further off than the format allows";
+            }
+            if (fabsf(vertex.normal.e[c] - clamp(-1.0f, expected->normal.e[c], 1.0f)) > normal_tolerance)
+            {
+                return "a normal is further off than the format allows";
+            }
+        }
+        for (u32 c = 0; c < 2; ++c)
+        {
+            if (fabsf(vertex.uv.e[c] - expected->uv.e[c]) > uv_tolerance[c])
+            {
+                return "a UV is further off than the format allows";
+            }
+        }
+    }
+    return NULL;
+}
+
+
+void run_mesh_benchmarks(Bench *bench)
+{
+    bench_suite(bench, "mesh");
+
+    char obj_path[64];
+    char cmesh_path[64];
+    snprintf(obj_path, sizeof(obj_path), "/tmp/bench_mesh_%d.obj", (int)getpid());
+    snprintf(cmesh_path, sizeof(cmesh_path), "/tmp/bench_mesh_%d.cmesh", (int)getpid());
+
+    memory_index text_size;
+    char *text = make_grid_obj(&text_size);
+    FILE *file = fopen(obj_path, "wb");
+    bool ok = file && fwrite(text, 1, text_size, file) == text_size;
+    ok = file && fclose(file) == 0 && ok;
+    free(text);
+
+    memory_index arena_size = Megabytes(64);
+    MemoryArena arena;
+    initialize_arena(&arena, arena_size, malloc(arena_size));
+    Mesh mesh = {};
+    ok = ok && load_obj(obj_path, &arena, &mesh) && write_cooked_mesh(cmesh_path, &mesh);
+    if (!ok)
+    {
+        bench_fail(bench, "*", "failed to write the mesh files");
+        unlink(obj_path);
+        free(arena.base);
+        return;
+    }
+
+    u64 triangles = mesh.index_count / 3;
+    u8 *vertex_buffer = (u8 *)malloc((u64)mesh.vertex_count * sizeof(Vertex));
+    u8 *index_buffer = (u8 *)malloc((u64)mesh.index_count * sizeof(u32));
+
+    bench_run(bench, "load/obj", triangles, [&](u64 iterations)
+    {
+        for (u64 i = 0; i < iterations; ++i)
+        {
+            reset_arena(&arena);
+            load_obj(obj_path, &arena, &mesh);
+            memcpy(vertex_buffer, mesh.vertices, (u64)mesh.vertex_count * sizeof(Vertex));
+            memcpy(index_buffer, mesh.indices, (u64)mesh.index_count * sizeof(u32));
+            bench_clobber_memory();
+        }
+    });
+
+    CookedMesh cooked;
+    if (!map_cooked_mesh(cmesh_path, &cooked)
+        || cooked.header->vertex_count != mesh.vertex_count
+        || cooked.header->index_count != mesh.index_count
+        || memcmp(cooked.vertices, mesh.vertices, cooked.header->vertex_bytes) != 0)
+    {
+        bench_fail(bench, "load/cmesh", "cooked mesh differs from the OBJ");
+    }
+    unmap_cooked_mesh(&cooked);
+
+    bench_run(bench, "load/cmesh", triangles, [&](u64 iterations)
+    {
+        for (u64 i = 0; i < iterations; ++i)
+        {
+            map_cooked_mesh(cmesh_path, &cooked);
+            memcpy(vertex_buffer, cooked.vertices, cooked.header->vertex_bytes);
+            memcpy(index_buffer, cooked.indices, cooked.header->index_bytes);
+            bench_clobber_memory();
+            unmap_cooked_mesh(&cooked);
+        }
+    });
+
+    if (bench_enabled(bench, "stream/"))
+    {
+        memory_index file_size = 0;
+        const u8 *mapped = platform_map_file(cmesh_path, &file_size);
+        platform_unmap_file(mapped, file_size);
+        u8 *file = (u8 *)platform_reserve_memory(file_size);
+        memset(file, 0, file_size);
+        init_io();
+        io_register_buffer(file, file_size);
+
+        i64 read_result = 0;
+        for (u32 cold = 0; cold < 2; ++cold)
+        {
+            char name[64];
+            snprintf(name, sizeof(name), "stream/%s/mapped", cold ? "cold" : "warm");
+            bench_run(bench, name, file_size, [&](u64 iterations)
+            {
+                for (u64 i = 0; i < iterations; ++i)
+                {
+                    if (cold)
+                    {
+                        evict_file(cmesh_path);
+                    }
+                    map_cooked_mesh(cmesh_path, &cooked);
+                    copy_strips(vertex_buffer, cooked.vertices, cooked.header->vertex_bytes);
+                    copy_strips(index_buffer, cooked.indices, cooked.header->index_bytes);
+                    bench_clobber_memory();
+                    unmap_cooked_mesh(&cooked);
+                }
+            });
+
+            snprintf(name, sizeof(name), "stream/%s/read", cold ? "cold" : "warm");
+            bench_run(bench, name, file_size, [&](u64 iterations)
+            {
+                for (u64 i = 0; i < iterations; ++i)
+                {
+                    if (cold)
+                    {
+                        evict_file(cmesh_path);
+                    }
+                    io_read_file(cmesh_path, file, file_size, file_read, &read_result);
+                    io_submit();
+                    while (io_pending())
+                    {
+                        io_complete(true);
+                    }
+                    bench_clobber_memory();
+                }
+            });
+        }
+
+        if ((bench_enabled(bench, "stream/warm/read") || bench_enabled(bench, "stream/cold/read"))
+            && read_result != (i64)file_size)
+        {
+            bench_fail(bench, "stream/read", "the read came back short or failed");
+        }
+
+        io_read_file(cmesh_path, file, file_size, file_read, &read_result);
+        io_submit();
+        while (io_pending())
+        {
+            io_complete(true);
+        }
+        if (read_result != (i64)file_size || !view_cooked_mesh(file, file_size, &cooked))
+        {
+            bench_fail(bench, "stream/strips", "could not read the cooked mesh");
+        }
+        else
+        {
+            bench_run(bench, "stream/strips", file_size, [&](u64 iterations)
+            {
+                for (u64 i = 0; i < iterations; ++i)
+                {
+                    view_cooked_mesh(file, file_size, &cooked);
+                    copy_strips(vertex_buffer, cooked.vertices, cooked.header->vertex_bytes);
+                    copy_strips(index_buffer, cooked.indices, cooked.header->index_bytes);
+                    bench_clobber_memory();
+                }
+            });
+        }
+        cooked = {};
+
+        shutdown_io();
+        platform_release_memory(file, file_size);
+    }
+
+    u8 *quantized = (u8 *)malloc((u64)mesh.vertex_count * sizeof(Vertex));
+    for (u32 format = 0; format < VERTEX_FORMAT_COUNT; ++format)
+    {
+        char name[64];
+        snprintf(name, sizeof(name), "quantize/%s", vertex_format_name((VertexFormat)format));
+        if (!bench_enabled(bench, name))
+        {
+            continue;
+        }
+
+        VertexDequantization dequantization =
+            vertex_dequantization(mesh.vertices, mesh.vertex_count, (VertexFormat)format);
+        bench_run(bench, name, mesh.vertex_count, [&](u64 iterations)
+        {
+            for (u64 i = 0; i < iterations; ++i)
+            {
+                quantize_vertices(quantized, mesh.vertices, mesh.vertex_count, (VertexFormat)format,
+                                  &dequantization);
+                bench_clobber_memory();
+            }
+        });
+
+        const char *reason = check_quantized(&mesh, quantized, (VertexFormat)format, &dequantization);
+        if (reason)
+        {
+            bench_fail(bench, name, reason);
+        }
+    }
+    free(quantized);
+
+    memory_index scratch_size = Megabytes(64);
+    MemoryArena scratch;
+    initialize_arena(&scratch, scratch_size, malloc(scratch_size));
+
+    srand(5);
+    bench_optimize(bench, "optimize/grid", &mesh, &scratch);
+    Mesh torus;
+    make_torus(&torus);
+    bench_optimize(bench, "optimize/torus", &torus, &scratch);
+    free(torus.indices);
+    free(torus.vertices);
+
+    u32 *lod_indices = (u32 *)malloc((u64)mesh.index_count * 2 * sizeof(u32));
+    Mesh simplified = {};
+    bench_run(bench, "simplify", triangles, [&](u64 iterations)
+    {
+        for (u64 i = 0; i < iterations; ++i)
+        {
+            simplified = mesh;
+            if (!generate_mesh_lods(&simplified, lod_indices, mesh.index_count * 2, &scratch))
+            {
+                bench_fail(bench, "simplify", "out of scratch");
+                return;
+            }
+            bench_clobber_memory();
+        }
+    });
+    if (bench_enabled(bench, "simplify"))
+    {
+        printf("  mesh/simplify:");
+        for (u32 i = 0; i < simplified.lod_count; ++i)
+        {
+            printf(" %u", simplified.lods[i].index_count / 3);
+        }
+        printf(" triangles\n");
+    }
+
+    free(lod_indices);
+    free(scratch.base);
+    free(index_buffer);
+    free(vertex_buffer);
+    free(arena.base);
+    release_obj_scratch();
+    unlink(cmesh_path);
+    unlink(obj_path);
+}
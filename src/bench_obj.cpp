@@ -0,0 +1,204 @@
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unordered_map>
+#include <vector>
+
+#include "platform.hpp"
+#include "mesh.hpp"
+#include "obj.hpp"
+#include "bench.hpp"
+
+
+// Loading a BENCH_GRID x BENCH_GRID vertex grid with positions, normals and
+// UVs (about 10 MB of OBJ text) from memory into an indexed mesh.
+//
+//   load/typical:  line by line with sscanf, std::vector and an
+//                  std::unordered_map on the index triple, the way most
+//                  importers written for tutorials do it
+//   load/fast:     parse_obj(), chunks in parallel on the job system
+//
+// Items are triangles. Both results are checked to be the same mesh.
+
+
+#define BENCH_GRID 256
+
+
+// Also the source of the mesh suite's files
+char *make_grid_obj(memory_index *size)
+{
+    memory_index capacity = (memory_index)BENCH_GRID * BENCH_GRID * 200;
+    char *text = (char *)malloc(capacity);
+    char *at = text;
+    char *end = text + capacity;
+
+    at += snprintf(at, end - at, "# %ux%u grid\no grid\n", BENCH_GRID, BENCH_GRID);
+    for (u32 y = 0; y < BENCH_GRID; ++y)
+    {
+        for (u32 x = 0; x < BENCH_GRID; ++x)
+        {
+            f32 u = (f32)x / (BENCH_GRID - 1);
+            f32 v = (f32)y / (BENCH_GRID - 1);
+            f32 height = 0.1f * sinf(u * 12.0f) * cosf(v * 9.0f);
+            at += snprintf(at, end - at, "v %.6f %.6f %.6f\nvt %.6f %.6f\nvn %.6f %.6f %.6f\n",
+                           u * 2.0f - 1.0f, height, v * 2.0f - 1.0f, u, v, -height, 1.0f, height * 0.5f);
+        }
+    }
+    for (u32 y = 0; y + 1 < BENCH_GRID; ++y)
+    {
+        for (u32 x = 0; x + 1 < BENCH_GRID; ++x)
+        {
+            u32 a = y * BENCH_GRID + x + 1;
+            u32 b = a + 1;
+            u32 c = b + BENCH_GRID;
+            u32 d = a + BENCH_GRID;
+            at += snprintf(at, end - at, "f %u/%u/%u %u/%u/%u %u/%u/%u %u/%u/%u\n",
+                           a, a, a, b, b, b, c, c, c, d, d, d);
+        }
+    }
+
+    *size = at - text;
+    return text;
+}
+
+
+struct TypicalMesh
+{
+    std::vector<Vertex> vertices;
+    std::vector<u32>    indices;
+};
+
+
+internal void load_obj_typical(const char *text, memory_index size, TypicalMesh *mesh)
+{
+    std::vector<Vec3> positions;
+    std::vector<Vec2> uvs;
+    std::vector<Vec3> normals;
+    std::unordered_map<u64, u32> vertex_ids;
+
+    const char *end = text + size;
+    char line[256];
+    for (const char *at = text; at < end;)
+    {
+        const char *line_end = (const char *)memchr(at, '\n', end - at);
+        line_end = line_end ? line_end : end;
+        memory_index length = line_end - at < (i64)sizeof(line) - 1 ? line_end - at : sizeof(line) - 1;
+        memcpy(line, at, length);
+        line[length] = 0;
+        at = line_end + 1;
+
+        Vec3 value = {};
+        if (strncmp(line, "v ", 2) == 0)
+        {
+            sscanf(line + 2, "%f %f %f", &value.x, &value.y, &value.z);
+            positions.push_back(value);
+        }
+        else if (strncmp(line, "vt ", 3) == 0)
+        {
+            sscanf(line + 3, "%f %f", &value.x, &value.y);
+            uvs.push_back({value.x, value.y});
+        }
+        else if (strncmp(line, "vn ", 3) == 0)
+        {
+            sscanf(line + 3, "%f %f %f", &value.x, &value.y, &value.z);
+            normals.push_back(value);
+        }
+        else if (strncmp(line, "f ", 2) == 0)
+        {
+            std::vector<u32> face;
+            char *save = NULL;
+            for (char *token = strtok_r(line + 2, " ", &save); token; token = strtok_r(NULL, " ", &save))
+            {
+                int p = 0, t = 0, n = 0;
+                sscanf(token, "%d/%d/%d", &p, &t, &n);
+                u64 key = ((u64)p << 42) | ((u64)t << 21) | (u64)n;
+                auto found = vertex_ids.find(key);
+                if (found == vertex_ids.end())
+                {
+                    Vertex vertex = {positions[p - 1], normals[n - 1], uvs[t - 1]};
+                    found = vertex_ids.emplace(key, (u32)mesh->vertices.size()).first;
+                    mesh->vertices.push_back(vertex);
+                }
+                face.push_back(found->second);
+            }
+            for (u32 i = 2; i < face.size(); ++i)
+            {
+                mesh->indices.push_back(face[0]);
+                mesh->indices.push_back(face[i - 1]);
+                mesh->indices.push_back(face[i]);
+            }
+        }
+    }
+}
+
+
+internal bool same_mesh(const Mesh *mesh, const TypicalMesh *expected)
+{
+    if (mesh->vertex_count != expected->vertices.size() || mesh->index_count != expected->indices.size())
+    {
+        return false;
+    }
+    for (u32 i = 0; i < mesh->index_count; ++i)
+    {
+        const Vertex *a = &mesh->vertices[mesh->indices[i]];
+        const Vertex *b = &expected->vertices[expected->indices[i]];
+        for (u32 j = 0; j < sizeof(Vertex) / sizeof(f32); ++j)
+        {
+            if (fabsf(((const f32 *)a)[j] - ((const f32 *)b)[j]) > 1e-6f)
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+
+void run_obj_benchmarks(Bench *bench)
+{
+    bench_suite(bench, "obj");
+
+    memory_index size;
+    char *text = make_grid_obj(&size);
+    u64 triangles = (u64)(BENCH_GRID - 1) * (BENCH_GRID - 1) * 2;
+
+    TypicalMesh expected;
+    load_obj_typical(text, size, &expected);
+
+    bench_run(bench, "load/typical", triangles, [&](u64 iterations)
+    {
+        for (u64 i = 0; i < iterations; ++i)
+        {
+            TypicalMesh mesh;
+            load_obj_typical(text, size, &mesh);
+            bench_do_not_optimize(mesh.indices.data());
+        }
+    });
+
+    // Room for the mesh, reset every load
+    memory_index arena_size = (memory_index)BENCH_GRID * BENCH_GRID * sizeof(Vertex)
+                            + triangles * 3 * sizeof(u32) + Kilobytes(64);
+    MemoryArena arena;
+    initialize_arena(&arena, arena_size, malloc(arena_size));
+
+    Mesh mesh = {};
+    bool ok = parse_obj(text, size, &arena, &mesh);
+    if (!ok || !same_mesh(&mesh, &expected))
+    {
+        bench_fail(bench, "load/fast", "mesh differs from the typical loader's");
+    }
+
+    bench_run(bench, "load/fast", triangles, [&](u64 iterations)
+    {
+        for (u64 i = 0; i < iterations; ++i)
+        {
+            reset_arena(&arena);
+            parse_obj(text, size, &arena, &mesh);
+            bench_do_not_optimize(mesh.indices);
+        }
+    });
+
+    free(arena.base);
+    free(text);
+}
@@ -0,0 +1,255 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+
+#include "platform.hpp"
+#include "lz4.hpp"
+#include "pack.hpp"
+#include "bench.hpp"
+
+
+// Startup loading of BENCH_PACK_FILES small assets (1 to 32 KB; text,
+// small integers and noise) into an arena, the way the frame arena gets
+// them.
+//
+//   startup/files:      open, fstat, read and close per file
+//   startup/pack:       open_pack() once, then find_pack_entry() and
+//                       read_pack_entry() per file. Entries are stored,
+//                       pack_assets' default, views into the mapping
+//                       instead of copies
+//   startup/compressed: the same with every entry flagged for LZ4
+//   lz4/compress:       compressing the text-like data, what pack_assets
+//                       spends
+//   lz4/decompress:     what read_pack_entry() spends
+//
+// Startup items are files, LZ4 items bytes. Everything is in the page
+// cache after the first run, so this measures syscalls and copies, not the
+// disk: from the cache decompressing costs more than reading the
+// uncompressed file, which is why packs store by default. From a cold
+// disk reading a third fewer bytes with one file and no seeks between
+// them can win.
+
+
+#define BENCH_PACK_FILES 1000
+
+
+internal void fill_asset(u8 *data, u32 size, u32 kind)
+{
+    const char *words[] = {"vertex ", "normal ", "0.5 ", "texture ", "1.0 ", "material ", "-0.25 ", "\n"};
+    u32 at = 0;
+    while (at < size)
+    {
+        if (kind == 0)
+        {
+            const char *word = words[rand() % 8];
+            for (; *word && at < size; ++word)
+            {
+                data[at++] = (u8)*word;
+            }
+        }
+        else if (kind == 1)
+        {
+            data[at++] = (u8)(rand() % 16);
+        }
+        else
+        {
+            data[at++] = (u8)rand();
+        }
+    }
+}
+
+
+internal bool read_file(const char *path, MemoryArena *arena)
+{
+    int file = open(path, O_RDONLY);
+    if (file < 0)
+    {
+        return false;
+    }
+
+    struct stat info;
+    bool ok = fstat(file, &info) == 0;
+    u8 *data = ok ? (u8 *)push_size(arena, (memory_index)info.st_size) : NULL;
+    ok = data && read(file, data, (memory_index)info.st_size) == info.st_size;
+    close(file);
+    return ok;
+}
+
+
+void run_pack_benchmarks(Bench *bench)
+{
+    bench_suite(bench, "pack");
+    if (!bench_enabled(bench, "startup/files") && !bench_enabled(bench, "startup/pack")
+        && !bench_enabled(bench, "startup/compressed") && !bench_enabled(bench, "lz4/compress")
+        && !bench_enabled(bench, "lz4/decompress"))
+    {
+        // Writing the files takes longer than some suites
+        return;
+    }
+
+    char directory[64];
+    char pack_path[96];
+    char compressed_path[96];
+    snprintf(directory, sizeof(directory), "/tmp/bench_pack_%d", (int)getpid());
+    snprintf(pack_path, sizeof(pack_path), "%s.pack", directory);
+    snprintf(compressed_path, sizeof(compressed_path), "%s_compressed.pack", directory);
+    mkdir(directory, 0700);
+
+    srand(7);
+    char (*names)[96] = (char (*)[96])malloc(BENCH_PACK_FILES * sizeof(*names));
+    PackInput *inputs = (PackInput *)calloc(BENCH_PACK_FILES, sizeof(PackInput));
+    memory_index total_size = 0;
+    bool ok = true;
+    for (u32 i = 0; i < BENCH_PACK_FILES; ++i)
+    {
+        snprintf(names[i], sizeof(names[i]), "%s/asset_%04u.bin", directory, i);
+        u32 size = 1024 + (u32)rand() % (31 * 1024);
+        u8 *data = (u8 *)malloc(size);
+        fill_asset(data, size, i % 4 == 3 ? 2 : i % 2);
+
+        FILE *file = fopen(names[i], "wb");
+        ok = ok && file && fwrite(data, 1, size, file) == size;
+        ok = file && fclose(file) == 0 && ok;
+        inputs[i] = {names[i], data, size, false};
+        total_size += size;
+    }
+
+    ok = ok && write_pack(pack_path, inputs, BENCH_PACK_FILES);
+    for (u32 i = 0; i < BENCH_PACK_FILES; ++i)
+    {
+        inputs[i].compress = true;
+    }
+    PackStats stats = {};
+    ok = ok && write_pack(compressed_path, inputs, BENCH_PACK_FILES, &stats);
+
+    memory_index arena_size = total_size + BENCH_PACK_FILES * ARENA_DEFAULT_ALIGNMENT;
+    MemoryArena arena;
+    initialize_arena(&arena, arena_size, malloc(arena_size));
+
+    const char *paths[] = {pack_path, compressed_path};
+    for (u32 p = 0; p < 2 && ok; ++p)
+    {
+        Pack pack = {};
+        reset_arena(&arena);
+        ok = open_pack(paths[p], &pack);
+        for (u32 i = 0; i < BENCH_PACK_FILES && ok; ++i)
+        {
+            const PackEntry *entry = find_pack_entry(&pack, names[i]);
+            const u8 *data = entry ? read_pack_entry(&pack, entry, &arena) : NULL;
+            ok = data && entry->size == inputs[i].size && memcmp(data, inputs[i].data, entry->size) == 0;
+        }
+        close_pack(&pack);
+    }
+    if (ok)
+    {
+        printf("  %u files, %llu bytes, %u compressed, %llu byte compressed pack\n", BENCH_PACK_FILES,
+               (unsigned long long)stats.input_bytes, stats.compressed_count, (unsigned long long)stats.file_size);
+    }
+    else
+    {
+        bench_fail(bench, "*", "pack does not give back the files");
+    }
+
+    bench_run(bench, "startup/files", BENCH_PACK_FILES, [&](u64 iterations)
+    {
+        for (u64 i = 0; i < iterations; ++i)
+        {
+            reset_arena(&arena);
+            for (u32 j = 0; j < BENCH_PACK_FILES; ++j)
+            {
+                read_file(names[j], &arena);
+            }
+            bench_clobber_memory();
+        }
+    });
+
+    auto load_pack = [&](const char *path, u64 iterations)
+    {
+        for (u64 i = 0; i < iterations; ++i)
+        {
+            reset_arena(&arena);
+            Pack startup_pack;
+            if (open_pack(path, &startup_pack))
+            {
+                for (u32 j = 0; j < BENCH_PACK_FILES; ++j)
+                {
+                    const PackEntry *entry = find_pack_entry(&startup_pack, names[j]);
+                    const u8 *data = read_pack_entry(&startup_pack, entry, &arena);
+
+                    // Touch stored entries like the copies get touched
+                    u64 sum = 0;
+                    for (u64 k = 0; k < entry->size; k += 4096)
+                    {
+                        sum += data[k];
+                    }
+                    bench_do_not_optimize(sum);
+                }
+                close_pack(&startup_pack);
+            }
+            bench_clobber_memory();
+        }
+    };
+
+    bench_run(bench, "startup/pack", BENCH_PACK_FILES, [&](u64 iterations)
+    {
+        load_pack(pack_path, iterations);
+    });
+
+    bench_run(bench, "startup/compressed", BENCH_PACK_FILES, [&](u64 iterations)
+    {
+        load_pack(compressed_path, iterations);
+    });
+
+    // The text-like assets back to back
+    memory_index text_size = 0;
+    u8 *text = (u8 *)malloc(total_size);
+    for (u32 i = 0; i < BENCH_PACK_FILES; i += 4)
+    {
+        memcpy(text + text_size, inputs[i].data, inputs[i].size);
+        text_size += inputs[i].size;
+    }
+    u64 capacity = lz4_compress_bound(text_size);
+    u8 *compressed = (u8 *)malloc(capacity);
+    u8 *decompressed = (u8 *)malloc(text_size);
+    u64 compressed_size = lz4_compress(text, text_size, compressed, capacity);
+    if (!lz4_decompress(compressed, compressed_size, decompressed, text_size)
+        || memcmp(text, decompressed, text_size) != 0)
+    {
+        bench_fail(bench, "lz4/decompress", "round trip differs");
+    }
+
+    bench_run(bench, "lz4/compress", text_size, [&](u64 iterations)
+    {
+        for (u64 i = 0; i < iterations; ++i)
+        {
+            bench_do_not_optimize(lz4_compress(text, text_size, compressed, capacity));
+        }
+    });
+
+    bench_run(bench, "lz4/decompress", text_size, [&](u64 iterations)
+    {
+        for (u64 i = 0; i < iterations; ++i)
+        {
+            lz4_decompress(compressed, compressed_size, decompressed, text_size);
+            bench_clobber_memory();
+        }
+    });
+
+    free(decompressed);
+    free(compressed);
+    free(text);
+    free(arena.base);
+    for (u32 i = 0; i < BENCH_PACK_FILES; ++i)
+    {
+        unlink(names[i]);
+        free((void *)inputs[i].data);
+    }
+    unlink(pack_path);
+    unlink(compressed_path);
+    rmdir(directory);
+    free(inputs);
+    free(names);
+}
@@ -0,0 +1,221 @@
+#include <stdlib.h>
+
+#include <thread>
+
+#include "platform.hpp"
+#include "pool.hpp"
+#include "bench.hpp"
+
+
+// Compares the pool allocator against malloc/free and new/delete. One
+// iteration is one alloc/free pair.
+//
+//   churn:  a window of live objects, every op frees the oldest and
+//           allocates a new one (steady state of a per-frame object list)
+//   batch:  allocate a batch, then free it in reverse
+//   threads: churn on several threads at once, each through its own cache
+//            or through the locked shared path
+
+
+#define BENCH_WINDOW      1024
+#define BENCH_BATCH       4096
+#define BENCH_THREADS     4
+#define BENCH_OBJECT_SIZE 64
+
+
+struct BenchObject
+{
+    u8 bytes[BENCH_OBJECT_SIZE];
+};
+
+
+enum BenchAllocator
+{
+    BENCH_MALLOC,
+    BENCH_NEW,
+    BENCH_POOL,
+    BENCH_POOL_CACHE,
+    BENCH_POOL_SHARED,
+};
+
+
+const char *bench_allocator_name(BenchAllocator allocator)
+{
+    switch (allocator)
+    {
+        case BENCH_MALLOC:      return "malloc";
+        case BENCH_NEW:         return "new";
+        case BENCH_POOL:        return "pool";
+        case BENCH_POOL_CACHE:  return "pool_cache";
+        case BENCH_POOL_SHARED: return "pool_locked";
+    }
+    return "?";
+}
+
+
+struct BenchContext
+{
+    BenchAllocator  allocator;
+    MemoryPool     *pool;
+    PoolCache       cache;
+    BenchObject    *window[BENCH_WINDOW];
+    u32             window_next;
+};
+
+
+inline BenchObject *bench_alloc(BenchContext *context)
+{
+    BenchObject *object = NULL;
+    switch (context->allocator)
+    {
+        case BENCH_MALLOC:      object = (BenchObject *)malloc(sizeof(BenchObject)); break;
+        case BENCH_NEW:         object = new BenchObject; break;
+        case BENCH_POOL:        object = pool_alloc_struct(context->pool, BenchObject); break;
+        case BENCH_POOL_CACHE:  object = pool_cache_alloc_struct(&context->cache, BenchObject); break;
+        case BENCH_POOL_SHARED: object = (BenchObject *)pool_alloc_shared(context->pool); break;
+    }
+    // Touch the object like a real user would
+    object->bytes[0] = 1;
+    return object;
+}
+
+
+inline void bench_free(BenchContext *context, BenchObject *object)
+{
+    switch (context->allocator)
+    {
+        case BENCH_MALLOC:      free(object); break;
+        case BENCH_NEW:         delete object; break;
+        case BENCH_POOL:        pool_free(context->pool, object); break;
+        case BENCH_POOL_CACHE:  pool_cache_free(&context->cache, object); break;
+        case BENCH_POOL_SHARED: pool_free_shared(context->pool, object); break;
+    }
+}
+
+
+void init_bench_context(BenchContext *context, BenchAllocator allocator, MemoryPool *pool)
+{
+    context->allocator = allocator;
+    context->pool = pool;
+    init_pool_cache(&context->cache, pool);
+    for (u32 i = 0; i < BENCH_WINDOW; ++i)
+    {
+        context->window[i] = bench_alloc(context);
+    }
+    context->window_next = 0;
+}
+
+
+void release_bench_context(BenchContext *context)
+{
+    for (u32 i = 0; i < BENCH_WINDOW; ++i)
+    {
+        bench_free(context, context->window[i]);
+    }
+    pool_cache_flush(&context->cache);
+}
+
+
+void bench_churn(BenchContext *context, u64 iterations)
+{
+    u32 slot = context->window_next;
+    for (u64 i = 0; i < iterations; ++i)
+    {
+        bench_free(context, context->window[slot]);
+        context->window[slot] = bench_alloc(context);
+        slot = (slot + 1) % BENCH_WINDOW;
+    }
+    context->window_next = slot;
+}
+
+
+void bench_batch(BenchContext *context, BenchObject **objects, u64 iterations)
+{
+    while (iterations > 0)
+    {
+        u32 count = iterations < BENCH_BATCH ? (u32)iterations : BENCH_BATCH;
+        for (u32 i = 0; i < count; ++i)
+        {
+            objects[i] = bench_alloc(context);
+        }
+        for (u32 i = count; i > 0; --i)
+        {
+            bench_free(context, objects[i - 1]);
+        }
+        iterations -= count;
+    }
+}
+
+
+void run_pool_benchmarks(Bench *bench)
+{
+    bench_suite(bench, "pool");
+
+    char name[64];
+    BenchObject *objects[BENCH_BATCH];
+
+    BenchAllocator single[] = {BENCH_MALLOC, BENCH_NEW, BENCH_POOL, BENCH_POOL_CACHE};
+    for (u32 i = 0; i < sizeof(single) / sizeof(single[0]); ++i)
+    {
+        MemoryPool pool;
+        init_pool_for(&pool, BenchObject, 4096);
+
+        BenchContext context;
+        init_bench_context(&context, single[i], &pool);
+
+        snprintf(name, sizeof(name), "churn/%s", bench_allocator_name(single[i]));
+        bench_run(bench, name, 1, [&](u64 iterations)
+        {
+            bench_churn(&context, iterations);
+        });
+
+        snprintf(name, sizeof(name), "batch/%s", bench_allocator_name(single[i]));
+        bench_run(bench, name, 1, [&](u64 iterations)
+        {
+            bench_batch(&context, objects, iterations);
+        });
+
+        release_bench_context(&context);
+        release_pool(&pool);
+    }
+
+    // One iteration is one pair on every thread, so ns/item is per pair
+    BenchAllocator threaded[] = {BENCH_MALLOC, BENCH_POOL_CACHE, BENCH_POOL_SHARED};
+    for (u32 i = 0; i < sizeof(threaded) / sizeof(threaded[0]); ++i)
+    {
+        snprintf(name, sizeof(name), "churn_%ux/%s", BENCH_THREADS, bench_allocator_name(threaded[i]));
+        if (!bench_enabled(bench, name))
+        {
+            continue;
+        }
+
+        MemoryPool pool;
+        init_pool_for(&pool, BenchObject, 4096);
+
+        BenchContext *contexts = new BenchContext[BENCH_THREADS];
+        for (u32 t = 0; t < BENCH_THREADS; ++t)
+        {
+            init_bench_context(&contexts[t], threaded[i], &pool);
+        }
+
+        bench_run(bench, name, BENCH_THREADS, [&](u64 iterations)
+        {
+            std::thread threads[BENCH_THREADS];
+            for (u32 t = 0; t < BENCH_THREADS; ++t)
+            {
+                threads[t] = std::thread(bench_churn, &contexts[t], iterations);
+            }
+            for (u32 t = 0; t < BENCH_THREADS; ++t)
+            {
+                threads[t].join();
+            }
+        });
+
+        for (u32 t = 0; t < BENCH_THREADS; ++t)
+        {
+            release_bench_context(&contexts[t]);
+        }
+        delete[] contexts;
+        release_pool(&pool);
+    }
+}
@@ -0,0 +1,275 @@
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "platform.hpp"
+#include "image.hpp"
+#include "block_compression.hpp"
+#include "image_filter.hpp"
+#include "jobs.hpp"
+#include "bench.hpp"
+
+
+// Decoding BENCH_IMAGES 1024x1024 images, the worker stage of the texture
+// loader (see texture.hpp).
+//
+//   decode/<format>/serial:   one after the other on the calling thread,
+//                             what loading on the GL thread costs
+//   decode/<format>/jobs:     one job per image on the job system
+//   compress/<bc>:            block compressing one image, what
+//                             cook_texture spends per level
+//   decompress/<bc>:          the fallback for GPUs without S3TC
+//   downsample/<isa>:         one 2x2 box filtered mip of the image as
+//                             floats, per instruction set, items are
+//                             output pixels
+//
+// One decode iteration decodes all BENCH_IMAGES. The upload stage needs a
+// GL context and is measured by the frame benchmark with --texture.
+
+
+#define BENCH_IMAGES      16
+#define BENCH_IMAGE_SIZE  1024
+#define BENCH_MIN_PSNR    30.0
+
+
+struct DecodeJob
+{
+    const u8     *data;
+    memory_index  size;
+    Image         image;
+    bool          ok;
+};
+
+
+internal void decode_job(void *data)
+{
+    DecodeJob *job = (DecodeJob *)data;
+    job->ok = decode_image(job->data, job->size, &job->image);
+}
+
+
+// Smooth gradients with some noise, compresses about like a photo texture
+void make_test_image(Image *image)
+{
+    image->width = BENCH_IMAGE_SIZE;
+    image->height = BENCH_IMAGE_SIZE;
+    image->pixels = (u8 *)malloc(BENCH_IMAGE_SIZE * BENCH_IMAGE_SIZE * 4);
+    for (u32 y = 0; y < BENCH_IMAGE_SIZE; ++y)
+    {
+        for (u32 x = 0; x < BENCH_IMAGE_SIZE; ++x)
+        {
+            u8 *pixel = image->pixels + (y * BENCH_IMAGE_SIZE + x) * 4;
+            u32 noise = (u32)rand() % 16;
+            pixel[0] = (u8)(x / 4 + noise);
+            pixel[1] = (u8)(y / 4 + noise);
+            pixel[2] = (u8)((x ^ y) / 8 + noise);
+            pixel[3] = 255;
+        }
+    }
+}
+
+
+void bench_decode(Bench *bench, const char *name, const u8 *data, memory_index size, bool parallel,
+                  const Image *expected)
+{
+    if (!bench_enabled(bench, name))
+    {
+        return;
+    }
+
+    DecodeJob jobs[BENCH_IMAGES];
+    for (u32 i = 0; i < BENCH_IMAGES; ++i)
+    {
+        jobs[i] = {data, size, {}, false};
+    }
+
+    bool failed = false;
+    bench_run(bench, name, BENCH_IMAGES, [&](u64 iterations)
+    {
+        for (u64 i = 0; i < iterations; ++i)
+        {
+            JobCounter counter = {};
+            for (u32 j = 0; j < BENCH_IMAGES; ++j)
+            {
+                if (parallel)
+                {
+                    jobs_submit(decode_job, &jobs[j], &counter);
+                }
+                else
+                {
+                    decode_job(&jobs[j]);
+                }
+            }
+            jobs_wait(&counter);
+
+            for (u32 j = 0; j < BENCH_IMAGES; ++j)
+            {
+                failed |= !jobs[j].ok;
+                free_image(&jobs[j].image);
+            }
+        }
+    });
+
+    // Lossy formats only have to keep the size
+    DecodeJob check = {data, size, {}, false};
+    decode_job(&check);
+    if (failed || !check.ok
+        || check.image.width != expected->width || check.image.height != expected->height
+        || (strstr(name, "png") && memcmp(check.image.pixels, expected->pixels,
+                                          (memory_index)expected->width * expected->height * 4) != 0))
+    {
+        bench_fail(bench, name, "decoded image does not match the source");
+    }
+    free_image(&check.image);
+}
+
+
+f64 block_psnr(BlockFormat format, const Image *source, const u8 *decoded)
+{
+    u32 channels = format == BLOCK_BC1 ? 3 : (format == BLOCK_BC3 ? 4 : 2);
+    f64 error = 0.0;
+    u64 count = (u64)source->width * source->height;
+    for (u64 i = 0; i < count; ++i)
+    {
+        for (u32 c = 0; c < channels; ++c)
+        {
+            f64 difference = (f64)decoded[i * 4 + c] - source->pixels[i * 4 + c];
+            error += difference * difference;
+        }
+    }
+    error /= (f64)(count * channels);
+    return error > 0.0 ? 10.0 * log10(255.0 * 255.0 / error) : 1000.0;
+}
+
+
+void bench_block_compression(Bench *bench, BlockFormat format, const char *format_name, const Image *source)
+{
+    u64 blocks_size = bc_image_bytes(format, source->width, source->height);
+    u64 block_count = blocks_size / bc_block_bytes(format);
+    u8 *blocks = (u8 *)malloc(blocks_size);
+    u8 *decoded = (u8 *)malloc((u64)source->width * source->height * 4);
+
+    char name[64];
+    snprintf(name, sizeof(name), "compress/%s", format_name);
+    encode_bc_image(format, source->pixels, source->width, source->height, blocks);
+    decode_bc_image(format, blocks, source->width, source->height, decoded);
+    f64 psnr = block_psnr(format, source, decoded);
+    if (psnr < BENCH_MIN_PSNR)
+    {
+        char reason[64];
+        snprintf(reason, sizeof(reason), "psnr %.1f dB, expected at least %.0f", psnr, BENCH_MIN_PSNR);
+        bench_fail(bench, name, reason);
+    }
+
+    bench_run(bench, name, block_count, [&](u64 iterations)
+    {
+        for (u64 i = 0; i < iterations; ++i)
+        {
+            encode_bc_image(format, source->pixels, source->width, source->height, blocks);
+            bench_clobber_memory();
+        }
+    });
+
+    snprintf(name, sizeof(name), "decompress/%s", format_name);
+    bench_run(bench, name, block_count, [&](u64 iterations)
+    {
+        for (u64 i = 0; i < iterations; ++i)
+        {
+            decode_bc_image(format, blocks, source->width, source->height, decoded);
+            bench_clobber_memory();
+        }
+    });
+
+    free(decoded);
+    free(blocks);
+}
+
+
+internal void bench_downsample(Bench *bench, const char *name, const f32 *source, f32 *destination,
+                               const f32 *expected)
+{
+    u32 next_size = BENCH_IMAGE_SIZE / 2;
+    u64 destination_size = (u64)next_size * next_size * 4 * sizeof(f32);
+    memset(destination, 0, destination_size);
+    downsample_rgba(source, BENCH_IMAGE_SIZE, BENCH_IMAGE_SIZE, destination, next_size, next_size);
+    if (expected && memcmp(destination, expected, destination_size) != 0)
+    {
+        bench_fail(bench, name, "differs from the scalar filter");
+    }
+
+    bench_run(bench, name, (u64)next_size * next_size, [&](u64 iterations)
+    {
+        for (u64 i = 0; i < iterations; ++i)
+        {
+            downsample_rgba(source, BENCH_IMAGE_SIZE, BENCH_IMAGE_SIZE, destination, next_size, next_size);
+            bench_clobber_memory();
+        }
+    });
+}
+
+
+void run_texture_benchmarks(Bench *bench)
+{
+    bench_suite(bench, "texture");
+
+    srand(1);
+    Image source;
+    make_test_image(&source);
+
+    u8 *png;
+    memory_index png_size;
+    u8 *jpeg;
+    memory_index jpeg_size;
+    if (!encode_png(&source, &png, &png_size) || !encode_jpeg(&source, 90, &jpeg, &jpeg_size))
+    {
+        bench_fail(bench, "*", "failed to encode the test images");
+        free_image(&source);
+        return;
+    }
+
+    bench_decode(bench, "decode/png/serial", png, png_size, false, &source);
+    if (jobs_thread_count() > 1)
+    {
+        bench_decode(bench, "decode/png/jobs", png, png_size, true, &source);
+    }
+
+    bench_decode(bench, "decode/jpeg/serial", jpeg, jpeg_size, false, &source);
+    if (jobs_thread_count() > 1)
+    {
+        bench_decode(bench, "decode/jpeg/jobs", jpeg, jpeg_size, true, &source);
+    }
+
+    bench_block_compression(bench, BLOCK_BC1, "bc1", &source);
+    bench_block_compression(bench, BLOCK_BC3, "bc3", &source);
+    bench_block_compression(bench, BLOCK_BC5, "bc5", &source);
+
+    u64 pixel_count = (u64)BENCH_IMAGE_SIZE * BENCH_IMAGE_SIZE;
+    f32 *linear = (f32 *)malloc(pixel_count * 4 * sizeof(f32));
+    f32 *expected = (f32 *)malloc(pixel_count * sizeof(f32));
+    f32 *filtered = (f32 *)malloc(pixel_count * sizeof(f32));
+    for (u64 i = 0; i < pixel_count * 4; ++i)
+    {
+        linear[i] = source.pixels[i] / 255.0f;
+    }
+
+    CpuIsa selected = image_filter_kernels_isa();
+    select_image_filter_kernels(CPU_ISA_SCALAR);
+    bench_downsample(bench, "downsample/scalar", linear, expected, NULL);
+    for (u32 isa = bench->first_isa; isa <= bench->last_isa; ++isa)
+    {
+        char name[64];
+        snprintf(name, sizeof(name), "downsample/%s", cpu_isa_name((CpuIsa)isa));
+        select_image_filter_kernels((CpuIsa)isa);
+        bench_downsample(bench, name, linear, filtered, expected);
+    }
+    select_image_filter_kernels(selected);
+
+    free(filtered);
+    free(expected);
+    free(linear);
+
+    free(png);
+    free(jpeg);
+    free_image(&source);
+}
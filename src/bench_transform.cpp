@@ -0,0 +1,241 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "platform.hpp"
+#include "math.hpp"
+#include "transform.hpp"
+#include "bench.hpp"
+
+
+// World matrix updates for a BENCH_NODES node hierarchy (1000 roots, random
+// parents up to 6 levels deep).
+//
+//   update/naive:       every world matrix recomputed in slot order, one
+//                       Mat4 product each, what a hierarchy without dirty
+//                       flags pays every frame
+//   update/static:      update_transforms() with nothing dirty
+//   update/1pct:        1% of the nodes changed (and their subtrees)
+//   update/all:         every root changed
+//   move/subtree:       one subtree moved to another root plus the update
+//   update/all_moved:   update/all after 10k moves scattered the slot order
+//   sort:               sort_transforms() of the whole hierarchy
+//
+// One iteration is one frame's update of all BENCH_NODES.
+
+
+#define BENCH_NODES     100000
+#define BENCH_ROOTS     1000
+#define BENCH_MAX_ERROR 1e-3f
+
+
+internal Quat random_orientation()
+{
+    Vec3 axis = normalize(vec3((f32)rand() / RAND_MAX, (f32)rand() / RAND_MAX, 1.0f));
+    return quat_from_axis_angle(axis, (f32)rand() / RAND_MAX * PI32);
+}
+
+
+internal Vec3 random_offset()
+{
+    return vec3((f32)rand() / RAND_MAX - 0.5f, (f32)rand() / RAND_MAX - 0.5f, (f32)rand() / RAND_MAX - 0.5f) * 10.0f;
+}
+
+
+void build_hierarchy(TransformHierarchy *transforms, MemoryArena *scratch)
+{
+    for (u32 i = 0; i < BENCH_NODES; ++i)
+    {
+        TransformHandle parent = TRANSFORM_NONE;
+        if (i >= BENCH_ROOTS)
+        {
+            do
+            {
+                parent = (TransformHandle)(rand() % i);
+            } while (transforms->depth[transforms->slot[parent]] >= 5);
+        }
+        create_transform(transforms, parent, random_offset(), random_orientation(), vec3(1.0f, 1.0f, 1.0f));
+    }
+    sort_transforms(transforms, scratch);
+    update_transforms(transforms);
+}
+
+
+// Largest difference against the world matrices multiplied out along each
+// node's parent chain
+f32 world_error(TransformHierarchy *transforms)
+{
+    f32 error = 0.0f;
+    for (u32 handle = 0; handle < BENCH_NODES; ++handle)
+    {
+        u32 slot = transforms->slot[handle];
+        Mat4 expected = transforms->local[slot];
+        for (u32 parent = transforms->parent[slot]; parent != TRANSFORM_NONE; parent = transforms->parent[parent])
+        {
+            expected = transforms->local[parent] * expected;
+        }
+
+        const f32 *got = &transforms->world[slot].e[0][0];
+        for (u32 j = 0; j < 16; ++j)
+        {
+            error = fmaxf(error, fabsf(got[j] - (&expected.e[0][0])[j]));
+        }
+    }
+    return error;
+}
+
+
+void check_world(Bench *bench, TransformHierarchy *transforms, const char *name)
+{
+    f32 error = world_error(transforms);
+    if (!(error <= BENCH_MAX_ERROR))
+    {
+        char reason[64];
+        snprintf(reason, sizeof(reason), "max error %g against the parent chains", error);
+        bench_fail(bench, name, reason);
+    }
+}
+
+
+void touch_transform(TransformHierarchy *transforms, TransformHandle handle)
+{
+    u32 slot = transforms->slot[handle];
+    set_local_transform(transforms, handle, transforms->position[slot], transforms->orientation[slot],
+                        transforms->scale[slot]);
+}
+
+
+void update_naive(TransformHierarchy *transforms)
+{
+    for (u32 slot = 0; slot < transforms->count; ++slot)
+    {
+        u32 parent = transforms->parent[slot];
+        transforms->world[slot] = parent == TRANSFORM_NONE
+            ? transforms->local[slot]
+            : transforms->world[parent] * transforms->local[slot];
+    }
+}
+
+
+void move_random_subtree(TransformHierarchy *transforms)
+{
+    TransformHandle handle = BENCH_ROOTS + (TransformHandle)(rand() % (BENCH_NODES - BENCH_ROOTS));
+    TransformHandle root = (TransformHandle)(rand() % BENCH_ROOTS);
+    move_transform(transforms, handle, root);
+}
+
+
+void run_transform_benchmarks(Bench *bench)
+{
+    bench_suite(bench, "transform");
+
+    memory_index memory_size = Megabytes(128);
+    void *memory = platform_reserve_memory(memory_size);
+    if (memory == NULL)
+    {
+        bench_fail(bench, "*", "failed to reserve benchmark memory");
+        return;
+    }
+
+    MemoryArena arena;
+    initialize_arena(&arena, memory_size, memory);
+
+    TransformHierarchy transforms;
+    push_transform_hierarchy(&transforms, &arena, BENCH_NODES);
+    srand(1);
+    build_hierarchy(&transforms, &arena);
+    check_world(bench, &transforms, "build");
+
+    bench_run(bench, "update/naive", BENCH_NODES, [&](u64 iterations)
+    {
+        for (u64 i = 0; i < iterations; ++i)
+        {
+            update_naive(&transforms);
+        }
+    });
+
+    bench_run(bench, "update/static", BENCH_NODES, [&](u64 iterations)
+    {
+        for (u64 i = 0; i < iterations; ++i)
+        {
+            bench_do_not_optimize(update_transforms(&transforms));
+        }
+    });
+
+    if (bench_enabled(bench, "update/1pct"))
+    {
+        bench_run(bench, "update/1pct", BENCH_NODES, [&](u64 iterations)
+        {
+            for (u64 i = 0; i < iterations; ++i)
+            {
+                for (u32 j = 0; j < BENCH_NODES / 100; ++j)
+                {
+                    touch_transform(&transforms, (TransformHandle)(rand() % BENCH_NODES));
+                }
+                update_transforms(&transforms);
+            }
+        });
+        check_world(bench, &transforms, "update/1pct");
+    }
+
+    if (bench_enabled(bench, "update/all"))
+    {
+        bench_run(bench, "update/all", BENCH_NODES, [&](u64 iterations)
+        {
+            for (u64 i = 0; i < iterations; ++i)
+            {
+                for (TransformHandle root = 0; root < BENCH_ROOTS; ++root)
+                {
+                    touch_transform(&transforms, root);
+                }
+                update_transforms(&transforms);
+            }
+        });
+        check_world(bench, &transforms, "update/all");
+    }
+
+    if (bench_enabled(bench, "move/subtree"))
+    {
+        bench_run(bench, "move/subtree", BENCH_NODES, [&](u64 iterations)
+        {
+            for (u64 i = 0; i < iterations; ++i)
+            {
+                move_random_subtree(&transforms);
+                update_transforms(&transforms);
+            }
+        });
+        check_world(bench, &transforms, "move/subtree");
+    }
+
+    for (u32 i = 0; i < 10000; ++i)
+    {
+        move_random_subtree(&transforms);
+    }
+    update_transforms(&transforms);
+
+    if (bench_enabled(bench, "update/all_moved"))
+    {
+        bench_run(bench, "update/all_moved", BENCH_NODES, [&](u64 iterations)
+        {
+            for (u64 i = 0; i < iterations; ++i)
+            {
+                for (TransformHandle root = 0; root < BENCH_ROOTS; ++root)
+                {
+                    touch_transform(&transforms, root);
+                }
+                update_transforms(&transforms);
+            }
+        });
+        check_world(bench, &transforms, "update/all_moved");
+    }
+
+    bench_run(bench, "sort", BENCH_NODES, [&](u64 iterations)
+    {
+        for (u64 i = 0; i < iterations; ++i)
+        {
+            sort_transforms(&transforms, &arena);
+        }
+    });
+    check_world(bench, &transforms, "sort");
+
+    platform_release_memory(memory, memory_size);
+}
@@ -0,0 +1,467 @@
+#include <math.h>
+#include <string.h>
+
+#include "block_compression.hpp"
+
+
+// BC1 COLORS #################################################################
+
+
+internal u16 pack_565(f32 r, f32 g, f32 b)
+{
+    r = r < 0.0f ? 0.0f : (r > 255.0f ? 255.0f : r);
+    g = g < 0.0f ? 0.0f : (g > 255.0f ? 255.0f : g);
+    b = b < 0.0f ? 0.0f : (b > 255.0f ? 255.0f : b);
+    u32 r5 = (u32)(r * 31.0f / 255.0f + 0.5f);
+    u32 g6 = (u32)(g * 63.0f / 255.0f + 0.5f);
+    u32 b5 = (u32)(b * 31.0f / 255.0f + 0.5f);
+    return (u16)((r5 << 11) | (g6 << 5) | b5);
+}
+
+
+internal void unpack_565(u16 color, i32 *rgb)
+{
+    i32 r = (color >> 11) & 31;
+    i32 g = (color >> 5) & 63;
+    i32 b = color & 31;
+    rgb[0] = (r << 3) | (r >> 2);
+    rgb[1] = (g << 2) | (g >> 4);
+    rgb[2] = (b << 3) | (b >> 2);
+}
+
+
+// Four color mode palette, what the block means when color0 > color1
+internal void bc1_palette(u16 color0, u16 color1, i32 palette[4][3])
+{
+    unpack_565(color0, palette[0]);
+    unpack_565(color1, palette[1]);
+    for (u32 c = 0; c < 3; ++c)
+    {
+        palette[2][c] = (2 * palette[0][c] + palette[1][c] + 1) / 3;
+        palette[3][c] = (palette[0][c] + 2 * palette[1][c] + 1) / 3;
+    }
+}
+
+
+// Nearest palette entry per pixel, returns the squared error
+internal u32 bc1_indices(const u8 *rgba, u16 color0, u16 color1, u8 *indices)
+{
+    i32 palette[4][3];
+    bc1_palette(color0, color1, palette);
+
+    u32 total = 0;
+    for (u32 i = 0; i < 16; ++i)
+    {
+        const u8 *pixel = rgba + i * 4;
+        u32 best = 0xFFFFFFFF;
+        for (u32 p = 0; p < 4; ++p)
+        {
+            i32 dr = pixel[0] - palette[p][0];
+            i32 dg = pixel[1] - palette[p][1];
+            i32 db = pixel[2] - palette[p][2];
+            u32 error = (u32)(dr * dr + dg * dg + db * db);
+            if (error < best)
+            {
+                best = error;
+                indices[i] = (u8)p;
+            }
+        }
+        total += best;
+    }
+    return total;
+}
+
+
+internal void write_bc1_block(u16 color0, u16 color1, const u8 *indices, u8 *block)
+{
+    u32 bits = 0;
+    for (u32 i = 0; i < 16; ++i)
+    {
+        bits |= (u32)indices[i] << (2 * i);
+    }
+    block[0] = (u8)color0;
+    block[1] = (u8)(color0 >> 8);
+    block[2] = (u8)color1;
+    block[3] = (u8)(color1 >> 8);
+    memcpy(block + 4, &bits, 4);
+}
+
+
+// Endpoints for the fitted indices by least squares, false if the indices
+// do not pin down two endpoints
+internal bool refit_bc1_endpoints(const u8 *rgba, const u8 *indices, u16 *color0, u16 *color1)
+{
+    local_persist const f32 weights[4] = {1.0f, 0.0f, 2.0f / 3.0f, 1.0f / 3.0f};
+
+    f32 aa = 0.0f, ab = 0.0f, bb = 0.0f;
+    f32 ax[3] = {}, bx[3] = {};
+    for (u32 i = 0; i < 16; ++i)
+    {
+        f32 a = weights[indices[i]];
+        f32 b = 1.0f - a;
+        aa += a * a;
+        ab += a * b;
+        bb += b * b;
+        for (u32 c = 0; c < 3; ++c)
+        {
+            ax[c] += a * rgba[i * 4 + c];
+            bx[c] += b * rgba[i * 4 + c];
+        }
+    }
+
+    f32 determinant = aa * bb - ab * ab;
+    if (fabsf(determinant) < 1e-6f)
+    {
+        return false;
+    }
+
+    f32 e0[3], e1[3];
+    for (u32 c = 0; c < 3; ++c)
+    {
+        e0[c] = (bb * ax[c] - ab * bx[c]) / determinant;
+        e1[c] = (aa * bx[c] - ab * ax[c]) / determinant;
+    }
+    *color0 = pack_565(e0[0], e0[1], e0[2]);
+    *color1 = pack_565(e1[0], e1[1], e1[2]);
+    return true;
+}
+
+
+// Always in four color mode (color0 > color1), which BC3 requires
+internal void encode_bc1_colors(const u8 *rgba, u8 *block)
+{
+    f32 mean[3] = {};
+    for (u32 i = 0; i < 16; ++i)
+    {
+        for (u32 c = 0; c < 3; ++c)
+        {
+            mean[c] += rgba[i * 4 + c];
+        }
+    }
+    for (u32 c = 0; c < 3; ++c)
+    {
+        mean[c] /= 16.0f;
+    }
+
+    f32 covariance[6] = {};     // rr rg rb gg gb bb
+    f32 low[3] = {255.0f, 255.0f, 255.0f};
+    f32 high[3] = {};
+    for (u32 i = 0; i < 16; ++i)
+    {
+        f32 d[3];
+        for (u32 c = 0; c < 3; ++c)
+        {
+            f32 value = rgba[i * 4 + c];
+            d[c] = value - mean[c];
+            low[c] = value < low[c] ? value : low[c];
+            high[c] = value > high[c] ? value : high[c];
+        }
+        covariance[0] += d[0] * d[0];
+        covariance[1] += d[0] * d[1];
+        covariance[2] += d[0] * d[2];
+        covariance[3] += d[1] * d[1];
+        covariance[4] += d[1] * d[2];
+        covariance[5] += d[2] * d[2];
+    }
+
+    // Principal axis by power iteration, starting from the bounding box
+    // diagonal
+    f32 axis[3] = {high[0] - low[0], high[1] - low[1], high[2] - low[2]};
+    for (u32 iteration = 0; iteration < 4; ++iteration)
+    {
+        f32 x = covariance[0] * axis[0] + covariance[1] * axis[1] + covariance[2] * axis[2];
+        f32 y = covariance[1] * axis[0] + covariance[3] * axis[1] + covariance[4] * axis[2];
+        f32 z = covariance[2] * axis[0] + covariance[4] * axis[1] + covariance[5] * axis[2];
+        f32 length = fmaxf(fabsf(x), fmaxf(fabsf(y), fabsf(z)));
+        if (length < 1e-6f)
+        {
+            break;
+        }
+        axis[0] = x / length;
+        axis[1] = y / length;
+        axis[2] = z / length;
+    }
+    f32 length_squared = axis[0] * axis[0] + axis[1] * axis[1] + axis[2] * axis[2];
+
+    u16 color0;
+    u16 color1;
+    if (length_squared < 1e-6f)
+    {
+        // One color
+        color0 = color1 = pack_565(mean[0], mean[1], mean[2]);
+    }
+    else
+    {
+        f32 t_min = 1e30f;
+        f32 t_max = -1e30f;
+        for (u32 i = 0; i < 16; ++i)
+        {
+            f32 t = ((rgba[i * 4 + 0] - mean[0]) * axis[0]
+                   + (rgba[i * 4 + 1] - mean[1]) * axis[1]
+                   + (rgba[i * 4 + 2] - mean[2]) * axis[2]) / length_squared;
+            t_min = t < t_min ? t : t_min;
+            t_max = t > t_max ? t : t_max;
+        }
+
+        // Pull the ends in a little, the extremes are usually outliers
+        f32 inset = (t_max - t_min) / 16.0f;
+        t_min += inset;
+        t_max -= inset;
+        color0 = pack_565(mean[0] + axis[0] * t_max, mean[1] + axis[1] * t_max, mean[2] + axis[2] * t_max);
+        color1 = pack_565(mean[0] + axis[0] * t_min, mean[1] + axis[1] * t_min, mean[2] + axis[2] * t_min);
+    }
+
+    u8 indices[16];
+    u32 error = bc1_indices(rgba, color0, color1, indices);
+
+    u16 refit0, refit1;
+    u8 refit_indices[16];
+    if (error > 0 && refit_bc1_endpoints(rgba, indices, &refit0, &refit1)
+        && bc1_indices(rgba, refit0, refit1, refit_indices) < error)
+    {
+        color0 = refit0;
+        color1 = refit1;
+        memcpy(indices, refit_indices, sizeof(indices));
+    }
+
+    if (color0 < color1)
+    {
+        u16 swap = color0;
+        color0 = color1;
+        color1 = swap;
+        for (u32 i = 0; i < 16; ++i)
+        {
+            indices[i] ^= 1;
+        }
+    }
+    else if (color0 == color1)
+    {
+        // Three color mode, only index 0 means color0
+        memset(indices, 0, sizeof(indices));
+    }
+
+    write_bc1_block(color0, color1, indices, block);
+}
+
+
+internal void decode_bc1_colors(const u8 *block, u8 *rgba, bool allow_transparent)
+{
+    u16 color0 = (u16)(block[0] | (block[1] << 8));
+    u16 color1 = (u16)(block[2] | (block[3] << 8));
+    u32 bits;
+    memcpy(&bits, block + 4, 4);
+
+    i32 palette[4][4];
+    unpack_565(color0, palette[0]);
+    unpack_565(color1, palette[1]);
+    palette[0][3] = palette[1][3] = palette[2][3] = palette[3][3] = 255;
+    for (u32 c = 0; c < 3; ++c)
+    {
+        if (color0 > color1 || !allow_transparent)
+        {
+            palette[2][c] = (2 * palette[0][c] + palette[1][c] + 1) / 3;
+            palette[3][c] = (palette[0][c] + 2 * palette[1][c] + 1) / 3;
+        }
+        else
+        {
+            palette[2][c] = (palette[0][c] + palette[1][c]) / 2;
+            palette[3][c] = 0;
+        }
+    }
+    if (color0 <= color1 && allow_transparent)
+    {
+        palette[3][3] = 0;
+    }
+
+    for (u32 i = 0; i < 16; ++i)
+    {
+        u32 index = (bits >> (2 * i)) & 3;
+        for (u32 c = 0; c < 4; ++c)
+        {
+            rgba[i * 4 + c] = (u8)palette[index][c];
+        }
+    }
+}
+
+
+// BC4 CHANNELS ###############################################################
+
+
+// One 8 bit channel of 16 pixels `stride` bytes apart
+internal void encode_bc4_channel(const u8 *values, u32 stride, u8 *block)
+{
+    u32 low = 255;
+    u32 high = 0;
+    for (u32 i = 0; i < 16; ++i)
+    {
+        u32 value = values[i * stride];
+        low = value < low ? value : low;
+        high = value > high ? value : high;
+    }
+
+    // high > low selects the eight value mode. Equal ends decode index 0 as
+    // high in either mode.
+    block[0] = (u8)high;
+    block[1] = (u8)low;
+
+    u64 bits = 0;
+    if (high > low)
+    {
+        u32 range = high - low;
+        for (u32 i = 0; i < 16; ++i)
+        {
+            // Position 0..7 from low to high, index 0 is high, 1 is low and
+            // 2..7 step down from high
+            u32 position = ((values[i * stride] - low) * 14 + range) / (2 * range);
+            u64 index = position == 7 ? 0 : (position == 0 ? 1 : 8 - position);
+            bits |= index << (3 * i);
+        }
+    }
+    for (u32 i = 0; i < 6; ++i)
+    {
+        block[2 + i] = (u8)(bits >> (8 * i));
+    }
+}
+
+
+internal void decode_bc4_channel(const u8 *block, u8 *values, u32 stride)
+{
+    u32 value0 = block[0];
+    u32 value1 = block[1];
+    u32 palette[8] = {value0, value1};
+    if (value0 > value1)
+    {
+        for (u32 i = 2; i < 8; ++i)
+        {
+            palette[i] = ((8 - i) * value0 + (i - 1) * value1 + 3) / 7;
+        }
+    }
+    else
+    {
+        for (u32 i = 2; i < 6; ++i)
+        {
+            palette[i] = ((6 - i) * value0 + (i - 1) * value1 + 2) / 5;
+        }
+        palette[6] = 0;
+        palette[7] = 255;
+    }
+
+    u64 bits = 0;
+    for (u32 i = 0; i < 6; ++i)
+    {
+        bits |= (u64)block[2 + i] << (8 * i);
+    }
+    for (u32 i = 0; i < 16; ++i)
+    {
+        values[i * stride] = (u8)palette[(bits >> (3 * i)) & 7];
+    }
+}
+
+
+// BLOCKS #####################################################################
+
+
+void encode_bc1_block(const u8 *rgba, u8 *block)
+{
+    encode_bc1_colors(rgba, block);
+}
+
+
+void encode_bc3_block(const u8 *rgba, u8 *block)
+{
+    encode_bc4_channel(rgba + 3, 4, block);
+    encode_bc1_colors(rgba, block + 8);
+}
+
+
+void encode_bc5_block(const u8 *rgba, u8 *block)
+{
+    encode_bc4_channel(rgba + 0, 4, block);
+    encode_bc4_channel(rgba + 1, 4, block + 8);
+}
+
+
+void decode_bc1_block(const u8 *block, u8 *rgba)
+{
+    decode_bc1_colors(block, rgba, true);
+}
+
+
+void decode_bc3_block(const u8 *block, u8 *rgba)
+{
+    decode_bc1_colors(block + 8, rgba, false);
+    decode_bc4_channel(block, rgba + 3, 4);
+}
+
+
+void decode_bc5_block(const u8 *block, u8 *rgba)
+{
+    decode_bc4_channel(block, rgba + 0, 4);
+    decode_bc4_channel(block + 8, rgba + 1, 4);
+    for (u32 i = 0; i < 16; ++i)
+    {
+        rgba[i * 4 + 2] = 0;
+        rgba[i * 4 + 3] = 255;
+    }
+}
+
+
+// IMAGES #####################################################################
+
+
+void encode_bc_image(BlockFormat format, const u8 *rgba, u32 width, u32 height, u8 *blocks)
+{
+    u32 block_bytes = bc_block_bytes(format);
+    for (u32 block_y = 0; block_y < height; block_y += 4)
+    {
+        for (u32 block_x = 0; block_x < width; block_x += 4)
+        {
+            u8 pixels[16 * 4];
+            for (u32 y = 0; y < 4; ++y)
+            {
+                u32 source_y = block_y + y < height ? block_y + y : height - 1;
+                for (u32 x = 0; x < 4; ++x)
+                {
+                    u32 source_x = block_x + x < width ? block_x + x : width - 1;
+                    memcpy(pixels + (y * 4 + x) * 4, rgba + ((u64)source_y * width + source_x) * 4, 4);
+                }
+            }
+
+            switch (format)
+            {
+                case BLOCK_BC1: encode_bc1_block(pixels, blocks); break;
+                case BLOCK_BC3: encode_bc3_block(pixels, blocks); break;
+                case BLOCK_BC5: encode_bc5_block(pixels, blocks); break;
+            }
+            blocks += block_bytes;
+        }
+    }
+}
+
+
+void decode_bc_image(BlockFormat format, const u8 *blocks, u32 width, u32 height, u8 *rgba)
+{
+    u32 block_bytes = bc_block_bytes(format);
+    for (u32 block_y = 0; block_y < height; block_y += 4)
+    {
+        for (u32 block_x = 0; block_x < width; block_x += 4)
+        {
+            u8 pixels[16 * 4];
+            switch (format)
+            {
+                case BLOCK_BC1: decode_bc1_block(blocks, pixels); break;
+                case BLOCK_BC3: decode_bc3_block(blocks, pixels); break;
+                case BLOCK_BC5: decode_bc5_block(blocks, pixels); break;
+            }
+            blocks += block_bytes;
+
+            for (u32 y = 0; y < 4 && block_y + y < height; ++y)
+            {
+                for (u32 x = 0; x < 4 && block_x + x < width; ++x)
+                {
+                    memcpy(rgba + ((u64)(block_y + y) * width + block_x + x) * 4, pixels + (y * 4 + x) * 4, 4);
+                }
+            }
+        }
+    }
+}
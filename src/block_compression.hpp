@@ -0,0 +1,55 @@
+#pragma once
+
+#include "platform.hpp"
+
+
+// 4x4 block compression, the S3TC/RGTC formats every desktop GPU samples
+// directly.
+//
+//   BC1 (DXT1):   RGB, 8 bytes a block, alpha is dropped
+//   BC3 (DXT5):   BC1 colors plus an 8 bit interpolated alpha block, 16 bytes
+//   BC5 (RGTC2):  two independent 8 bit channels (red, green), 16 bytes, for
+//                 tangent space normal maps
+//
+// The encoder fits endpoints along the principal axis of each block's
+// colors and refines them once by least squares, good enough for offline
+// cooking without being slow. The decoders follow the format specs, for
+// measuring the error and for GPUs without S3TC.
+
+
+#define BC_BLOCK_SIZE 4
+
+
+enum BlockFormat
+{
+    BLOCK_BC1,
+    BLOCK_BC3,
+    BLOCK_BC5,
+};
+
+
+inline u32 bc_block_bytes(BlockFormat format)
+{
+    return format == BLOCK_BC1 ? 8 : 16;
+}
+
+
+inline u64 bc_image_bytes(BlockFormat format, u32 width, u32 height)
+{
+    return (u64)((width + 3) / 4) * ((height + 3) / 4) * bc_block_bytes(format);
+}
+
+
+// `rgba` is 16 pixels, row by row.
+void encode_bc1_block(const u8 *rgba, u8 *block);
+void encode_bc3_block(const u8 *rgba, u8 *block);
+void encode_bc5_block(const u8 *rgba, u8 *block);
+
+void decode_bc1_block(const u8 *block, u8 *rgba);
+void decode_bc3_block(const u8 *block, u8 *rgba);
+void decode_bc5_block(const u8 *block, u8 *rgba);   // blue 0, alpha 255
+
+// Whole images, row by row. Blocks over the right and bottom edges repeat
+// the last column and row.
+void encode_bc_image(BlockFormat format, const u8 *rgba, u32 width, u32 height, u8 *blocks);
+void decode_bc_image(BlockFormat format, const u8 *blocks, u32 width, u32 height, u8 *rgba);
@@ -0,0 +1,212 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "platform.hpp"
+#include "jobs.hpp"
+#include "mesh.hpp"
+#include "obj.hpp"
+#include "cooked_mesh.hpp"
+#include "mesh_optimize.hpp"
+#include "mesh_simplify.hpp"
+#include "vertex_format.hpp"
+
+
+// Converts a Wavefront OBJ into a .cmesh (see cooked_mesh.hpp), so loading
+// never parses it again. Triangles and vertices are reordered for the
+// vertex cache, overdraw and vertex fetches (see mesh_optimize.hpp) unless
+// --no-optimize keeps the OBJ's order, and simplified into a chain of LODs
+// (see mesh_simplify.hpp) unless --no-lods keeps only the full mesh.
+// Vertices are stored quantized to 16 bytes (see vertex_format.hpp),
+// --vertex-format picks the layout.
+//
+//   cook_mesh input.obj output.cmesh [--no-optimize] [--no-lods]
+//             [--vertex-format float|unorm16|half]
+//
+// Prints the counts, the vertex cache stats before and after, every LOD,
+// the vertex and file sizes and how long the import took.
+
+
+internal f64 seconds_now()
+{
+    timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (f64)now.tv_sec + (f64)now.tv_nsec * 1e-9;
+}
+
+
+internal bool optimize_cooked_mesh(Mesh *mesh)
+{
+    memory_index scratch_size = (memory_index)mesh->vertex_count * (sizeof(Vertex) + 4 * sizeof(u32))
+                              + (memory_index)mesh->index_count * 4 * sizeof(u32) + Megabytes(1);
+    void *memory = platform_reserve_memory(scratch_size);
+    if (memory == NULL)
+    {
+        return false;
+    }
+    MemoryArena scratch;
+    initialize_arena(&scratch, scratch_size, memory);
+
+    MeshOptimizeStats stats;
+    f64 start = seconds_now();
+    bool ok = optimize_mesh(mesh, &scratch, &stats);
+    f64 optimize_ms = (seconds_now() - start) * 1000.0;
+    platform_release_memory(memory, scratch_size);
+
+    printf("  vertex cache (%u entries): ACMR %.3f -> %.3f, ATVR %.3f -> %.3f, optimized in %.1f ms\n",
+           MESH_CACHE_SIZE, stats.before.acmr, stats.after.acmr, stats.before.atvr, stats.after.atvr,
+           optimize_ms);
+    return ok;
+}
+
+
+// Leaves mesh->indices in `indices`, which has room for `capacity`
+internal bool simplify_cooked_mesh(Mesh *mesh, u32 *indices, u32 capacity)
+{
+    memory_index scratch_size = (memory_index)mesh->vertex_count * 96
+                              + (memory_index)mesh->index_count * 96 + Megabytes(1);
+    void *memory = platform_reserve_memory(scratch_size);
+    if (memory == NULL)
+    {
+        return false;
+    }
+    MemoryArena scratch;
+    initialize_arena(&scratch, scratch_size, memory);
+
+    f64 start = seconds_now();
+    bool ok = generate_mesh_lods(mesh, indices, capacity, &scratch);
+    f64 simplify_ms = (seconds_now() - start) * 1000.0;
+    platform_release_memory(memory, scratch_size);
+    if (!ok)
+    {
+        return false;
+    }
+
+    printf("  %u LODs, simplified in %.1f ms:", mesh->lod_count, simplify_ms);
+    for (u32 i = 0; i < mesh->lod_count; ++i)
+    {
+        printf("%s %u triangles (error %.3g)", i ? "," : "", mesh->lods[i].index_count / 3, mesh->lods[i].error);
+    }
+    printf("\n");
+    return true;
+}
+
+
+bool cook_mesh(const char *input_path, const char *output_path, bool optimize, bool lods, VertexFormat format)
+{
+    memory_index input_size;
+    const u8 *text = platform_map_file(input_path, &input_size);
+    if (text == NULL)
+    {
+        fprintf(stderr, "Failed to open %s\n", input_path);
+        return false;
+    }
+
+    // A vertex and an index per triangle corner at most, and a face of n
+    // corners takes at least 2n + 2 bytes for 3(n - 2) triangle corners
+    memory_index arena_size = input_size * 3 / 2 * (sizeof(Vertex) + sizeof(u32)) + Megabytes(1);
+    void *memory = platform_reserve_memory(arena_size);
+    MemoryArena arena;
+    initialize_arena(&arena, arena_size, memory);
+
+    Mesh mesh;
+    ObjStats stats;
+    f64 start = seconds_now();
+    bool ok = memory && parse_obj((const char *)text, input_size, &arena, &mesh, &stats);
+    f64 import_ms = (seconds_now() - start) * 1000.0;
+    platform_unmap_file(text, input_size);
+    release_obj_scratch();
+    if (!ok)
+    {
+        fprintf(stderr, "Failed to import %s\n", input_path);
+        platform_release_memory(memory, arena_size);
+        return false;
+    }
+
+    printf("%s: %u vertices, %u triangles (%u positions, %u normals, %u uvs), imported in %.1f ms\n",
+           input_path, mesh.vertex_count, stats.triangles, stats.positions, stats.normals, stats.uvs, import_ms);
+
+    if (optimize && !optimize_cooked_mesh(&mesh))
+    {
+        fprintf(stderr, "Not enough memory to optimize %s\n", input_path);
+        platform_release_memory(memory, arena_size);
+        return false;
+    }
+
+    u32 lod_capacity = mesh.index_count * 2;
+    u32 *lod_indices = lods ? (u32 *)malloc((memory_index)lod_capacity * sizeof(u32)) : NULL;
+    if (lods && !(lod_indices && simplify_cooked_mesh(&mesh, lod_indices, lod_capacity)))
+    {
+        fprintf(stderr, "Not enough memory to simplify %s\n", input_path);
+        free(lod_indices);
+        platform_release_memory(memory, arena_size);
+        return false;
+    }
+
+    ok = write_cooked_mesh(output_path, &mesh, format);
+    free(lod_indices);
+    platform_release_memory(memory, arena_size);
+    if (!ok)
+    {
+        fprintf(stderr, "Failed to write %s\n", output_path);
+        return false;
+    }
+
+    CookedMesh cooked;
+    if (!map_cooked_mesh(output_path, &cooked))
+    {
+        fprintf(stderr, "%s does not validate\n", output_path);
+        return false;
+    }
+    printf("  %s: %llu bytes (%llu of OBJ), %s vertices of %u bytes (%u as float), %u bit indices\n",
+           output_path, (unsigned long long)cooked.size, (unsigned long long)input_size,
+           vertex_format_name(format), cooked.header->vertex_stride, (u32)sizeof(Vertex),
+           cooked.header->index_size * 8);
+    unmap_cooked_mesh(&cooked);
+    return true;
+}
+
+
+int main(int argc, char *argv[])
+{
+    const char *paths[2] = {};
+    u32 path_count = 0;
+    bool optimize = true;
+    bool lods = true;
+    VertexFormat format = VERTEX_FORMAT_UNORM16;
+    for (int i = 1; i < argc; ++i)
+    {
+        if (strcmp(argv[i], "--no-optimize") == 0)
+        {
+            optimize = false;
+        }
+        else if (strcmp(argv[i], "--no-lods") == 0)
+        {
+            lods = false;
+        }
+        else if (strcmp(argv[i], "--vertex-format") == 0 && i + 1 < argc)
+        {
+            if (!parse_vertex_format(argv[++i], &format))
+            {
+                fprintf(stderr, "Unknown vertex format '%s' (float, unorm16, half)\n", argv[i]);
+                return 2;
+            }
+        }
+        else if (path_count < 2)
+        {
+            paths[path_count++] = argv[i];
+        }
+    }
+    if (path_count != 2)
+    {
+        fprintf(stderr, "Usage: cook_mesh input.obj output.cmesh [--no-optimize] [--no-lods] "
+                        "[--vertex-format float|unorm16|half]\n");
+        return 2;
+    }
+
+    init_jobs();
+    bool ok = cook_mesh(paths[0], paths[1], optimize, lods, format);
+    shutdown_jobs();
+    return ok ? 0 : 1;
+}
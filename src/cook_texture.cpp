@@ -0,0 +1,329 @@
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "platform.hpp"
+#include "image.hpp"
+#include "block_compression.hpp"
+#include "cooked_texture.hpp"
+#include "cpu.hpp"
+#include "image_filter.hpp"
+
+
+// Cooks a PNG or JPEG into a .ctex texture (see cooked_texture.hpp).
+//
+//   cook_texture input.png output.ctex [--format auto|rgba8|bc1|bc3|bc5]
+//                [--linear] [--no-mips] [--no-flip] [--isa scalar|sse2|avx2|avx512]
+//
+// auto is BC1 for opaque images and BC3 for the rest. Colors are sRGB
+// unless --linear (normal maps, masks), BC5 is always linear. Mips are box
+// filtered in linear space, so sRGB textures keep their brightness, with the
+// best kernels in image_filter.hpp unless --isa. They all give the same
+// bits. Prints the size and error of every level.
+
+
+#define COOK_ALIGNMENT 16
+
+
+struct Cook
+{
+    CookedTextureFormat format;
+    bool                automatic_format;
+    bool                srgb;
+    bool                mips;
+    bool                flip;
+};
+
+
+global_variable f32 srgb_to_linear_table[256];
+
+
+internal u8 linear_to_srgb(f32 value)
+{
+    value = value < 0.0f ? 0.0f : (value > 1.0f ? 1.0f : value);
+    f32 srgb = value <= 0.0031308f ? value * 12.92f : 1.055f * powf(value, 1.0f / 2.4f) - 0.055f;
+    return (u8)(srgb * 255.0f + 0.5f);
+}
+
+
+// Float RGBA, linear if `srgb`, for filtering
+internal f32 *to_float_image(const Image *image, bool srgb)
+{
+    u64 count = (u64)image->width * image->height * 4;
+    f32 *pixels = (f32 *)malloc(count * sizeof(f32));
+    for (u64 i = 0; i < count; ++i)
+    {
+        u8 value = image->pixels[i];
+        pixels[i] = (srgb && (i & 3) != 3) ? srgb_to_linear_table[value] : value / 255.0f;
+    }
+    return pixels;
+}
+
+
+internal void to_u8_image(const f32 *pixels, bool srgb, Image *image)
+{
+    u64 count = (u64)image->width * image->height * 4;
+    for (u64 i = 0; i < count; ++i)
+    {
+        f32 value = pixels[i];
+        if (srgb && (i & 3) != 3)
+        {
+            image->pixels[i] = linear_to_srgb(value);
+        }
+        else
+        {
+            value = value < 0.0f ? 0.0f : (value > 1.0f ? 1.0f : value);
+            image->pixels[i] = (u8)(value * 255.0f + 0.5f);
+        }
+    }
+}
+
+
+internal void flip_rows(Image *image)
+{
+    u64 row_bytes = (u64)image->width * 4;
+    u8 *row = (u8 *)malloc(row_bytes);
+    for (u32 y = 0; y < image->height / 2; ++y)
+    {
+        u8 *top = image->pixels + y * row_bytes;
+        u8 *bottom = image->pixels + (u64)(image->height - 1 - y) * row_bytes;
+        memcpy(row, top, row_bytes);
+        memcpy(top, bottom, row_bytes);
+        memcpy(bottom, row, row_bytes);
+    }
+    free(row);
+}
+
+
+internal bool is_opaque(const Image *image)
+{
+    u64 count = (u64)image->width * image->height;
+    for (u64 i = 0; i < count; ++i)
+    {
+        if (image->pixels[i * 4 + 3] != 255)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+
+// Peak signal to noise ratio over the channels the format keeps
+internal f64 level_psnr(CookedTextureFormat format, const Image *level, const u8 *data)
+{
+    if (format == COOKED_TEXTURE_RGBA8)
+    {
+        return INFINITY;
+    }
+
+    u64 count = (u64)level->width * level->height;
+    u8 *decoded = (u8 *)malloc(count * 4);
+    BlockFormat block_format = format == COOKED_TEXTURE_BC1 ? BLOCK_BC1
+                             : (format == COOKED_TEXTURE_BC3 ? BLOCK_BC3 : BLOCK_BC5);
+    decode_bc_image(block_format, data, level->width, level->height, decoded);
+
+    u32 channels = format == COOKED_TEXTURE_BC1 ? 3 : (format == COOKED_TEXTURE_BC3 ? 4 : 2);
+    f64 error = 0.0;
+    for (u64 i = 0; i < count; ++i)
+    {
+        for (u32 c = 0; c < channels; ++c)
+        {
+            f64 difference = (f64)decoded[i * 4 + c] - level->pixels[i * 4 + c];
+            error += difference * difference;
+        }
+    }
+    free(decoded);
+
+    error /= (f64)(count * channels);
+    return error > 0.0 ? 10.0 * log10(255.0 * 255.0 / error) : INFINITY;
+}
+
+
+internal u8 *encode_level(CookedTextureFormat format, const Image *level, u64 size)
+{
+    u8 *data = (u8 *)malloc(size);
+    switch (format)
+    {
+        case COOKED_TEXTURE_RGBA8: memcpy(data, level->pixels, size); break;
+        case COOKED_TEXTURE_BC1:   encode_bc_image(BLOCK_BC1, level->pixels, level->width, level->height, data); break;
+        case COOKED_TEXTURE_BC3:   encode_bc_image(BLOCK_BC3, level->pixels, level->width, level->height, data); break;
+        case COOKED_TEXTURE_BC5:   encode_bc_image(BLOCK_BC5, level->pixels, level->width, level->height, data); break;
+        default: break;
+    }
+    return data;
+}
+
+
+bool cook_texture(const char *input_path, const char *output_path, Cook *cook)
+{
+    Image image;
+    if (!load_image(input_path, &image))
+    {
+        fprintf(stderr, "Failed to load %s\n", input_path);
+        return false;
+    }
+
+    if (cook->flip)
+    {
+        flip_rows(&image);
+    }
+    if (cook->automatic_format)
+    {
+        cook->format = is_opaque(&image) ? COOKED_TEXTURE_BC1 : COOKED_TEXTURE_BC3;
+    }
+    if (cook->format == COOKED_TEXTURE_BC5)
+    {
+        cook->srgb = false;
+    }
+
+    CookedTextureHeader header = {};
+    header.magic = COOKED_TEXTURE_MAGIC;
+    header.version = COOKED_TEXTURE_VERSION;
+    header.format = cook->format;
+    header.flags = cook->srgb ? COOKED_TEXTURE_SRGB : 0;
+    header.width = image.width;
+    header.height = image.height;
+
+    u8 *level_data[COOKED_TEXTURE_MAX_LEVELS] = {};
+    f32 *filtered = to_float_image(&image, cook->srgb);
+
+    // The smaller levels reuse the source's pixels
+    Image level = image;
+    u64 offset = (sizeof(header) + COOK_ALIGNMENT - 1) & ~(u64)(COOK_ALIGNMENT - 1);
+    u64 file_size = 0;
+
+    printf("%s: %ux%u, %s%s\n", input_path, image.width, image.height,
+           cooked_texture_format_name(cook->format), cook->srgb ? " srgb" : "");
+    while (header.level_count < COOKED_TEXTURE_MAX_LEVELS)
+    {
+        CookedTextureLevel *entry = &header.levels[header.level_count];
+        entry->width = level.width;
+        entry->height = level.height;
+        entry->offset = offset;
+        entry->size = cooked_texture_level_size(cook->format, level.width, level.height);
+        level_data[header.level_count] = encode_level(cook->format, &level, entry->size);
+        file_size = entry->offset + entry->size;
+        offset = (file_size + COOK_ALIGNMENT - 1) & ~(u64)(COOK_ALIGNMENT - 1);
+
+        printf("  level %2u %5ux%-5u %10llu bytes  psnr %.2f dB\n", header.level_count,
+               level.width, level.height, (unsigned long long)entry->size,
+               level_psnr(cook->format, &level, level_data[header.level_count]));
+        ++header.level_count;
+
+        if (!cook->mips || (level.width == 1 && level.height == 1))
+        {
+            break;
+        }
+
+        u32 next_width = level.width > 1 ? level.width / 2 : 1;
+        u32 next_height = level.height > 1 ? level.height / 2 : 1;
+        f32 *next = (f32 *)malloc((u64)next_width * next_height * 4 * sizeof(f32));
+        downsample_rgba(filtered, level.width, level.height, next, next_width, next_height);
+        free(filtered);
+        filtered = next;
+
+        level.width = next_width;
+        level.height = next_height;
+        to_u8_image(filtered, cook->srgb, &level);
+    }
+    free(filtered);
+
+    bool ok = false;
+    FILE *output = fopen(output_path, "wb");
+    if (output)
+    {
+        ok = fwrite(&header, sizeof(header), 1, output) == 1;
+        for (u32 i = 0; i < header.level_count && ok; ++i)
+        {
+            CookedTextureLevel *entry = &header.levels[i];
+            ok = fseek(output, (long)entry->offset, SEEK_SET) == 0
+              && fwrite(level_data[i], 1, entry->size, output) == entry->size;
+        }
+        ok = fclose(output) == 0 && ok;
+    }
+    if (!ok)
+    {
+        fprintf(stderr, "Failed to write %s\n", output_path);
+    }
+    else
+    {
+        printf("  %s: %llu bytes (%llu for RGBA8 without mips)\n", output_path, (unsigned long long)file_size,
+               (unsigned long long)image.width * image.height * 4);
+    }
+
+    for (u32 i = 0; i < header.level_count; ++i)
+    {
+        free(level_data[i]);
+    }
+    free_image(&image);
+    return ok;
+}
+
+
+int main(int argc, char *argv[])
+{
+    const char *paths[2] = {};
+    u32 path_count = 0;
+    Cook cook = {};
+    cook.automatic_format = true;
+    cook.srgb = true;
+    cook.mips = true;
+    cook.flip = true;
+    CpuIsa isa = cpu_best_isa();
+
+    for (int i = 1; i < argc; ++i)
+    {
+        if (strcmp(argv[i], "--format") == 0 && i + 1 < argc)
+        {
+            const char *name = argv[++i];
+            cook.automatic_format = strcmp(name, "auto") == 0;
+            if (!cook.automatic_format && !parse_cooked_texture_format(name, &cook.format))
+            {
+                fprintf(stderr, "Unknown format '%s' (auto, rgba8, bc1, bc3, bc5)\n", name);
+                return 2;
+            }
+        }
+        else if (strcmp(argv[i], "--linear") == 0)
+        {
+            cook.srgb = false;
+        }
+        else if (strcmp(argv[i], "--no-mips") == 0)
+        {
+            cook.mips = false;
+        }
+        else if (strcmp(argv[i], "--no-flip") == 0)
+        {
+            cook.flip = false;
+        }
+        else if (strcmp(argv[i], "--isa") == 0 && i + 1 < argc)
+        {
+            const char *name = argv[++i];
+            if (!parse_cpu_isa(name, &isa) || !cpu_isa_supported(isa))
+            {
+                fprintf(stderr, "Unknown or unsupported instruction set '%s' (scalar, sse2, avx2, avx512)\n", name);
+                return 2;
+            }
+        }
+        else if (path_count < 2)
+        {
+            paths[path_count++] = argv[i];
+        }
+    }
+    if (path_count != 2)
+    {
+        fprintf(stderr, "Usage: cook_texture input.png output.ctex [--format auto|rgba8|bc1|bc3|bc5] "
+                        "[--linear] [--no-mips] [--no-flip] [--isa scalar|sse2|avx2|avx512]\n");
+        return 2;
+    }
+    select_image_filter_kernels(isa);
+
+    for (u32 i = 0; i < 256; ++i)
+    {
+        f32 value = i / 255.0f;
+        srgb_to_linear_table[i] = value <= 0.04045f ? value / 12.92f : powf((value + 0.055f) / 1.055f, 2.4f);
+    }
+
+    return cook_texture(paths[0], paths[1], &cook) ? 0 : 1;
+}
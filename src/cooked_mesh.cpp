@@ -0,0 +1,236 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "cooked_mesh.hpp"
+#include "vertex_format.hpp"
+
+
+static_assert(MESH_MAX_LODS <= COOKED_MESH_MAX_LODS, "every Mesh LOD has to fit in a CookedSubmesh");
+
+
+internal u64 align_offset(u64 offset, u64 alignment)
+{
+    return (offset + alignment - 1) & ~(alignment - 1);
+}
+
+
+u32 cooked_attribute_size(CookedAttributeFormat format, u32 components)
+{
+    switch (format)
+    {
+        case COOKED_ATTRIBUTE_F32:               return components * 4;
+        case COOKED_ATTRIBUTE_F16:               return components * 2;
+        case COOKED_ATTRIBUTE_UNORM16:           return components * 2;
+        case COOKED_ATTRIBUTE_SNORM_10_10_10_2:  return components == 4 ? 4 : 0;
+        default:                                 return 0;
+    }
+}
+
+
+bool validate_cooked_mesh(const u8 *data, memory_index size)
+{
+    if (size < sizeof(CookedMeshHeader))
+    {
+        return false;
+    }
+
+    const CookedMeshHeader *header = (const CookedMeshHeader *)data;
+    if (header->magic != COOKED_MESH_MAGIC
+        || header->version != COOKED_MESH_VERSION
+        || header->attribute_count == 0
+        || header->attribute_count > COOKED_MESH_MAX_ATTRIBUTES
+        || header->vertex_stride == 0
+        || header->vertex_format >= VERTEX_FORMAT_COUNT
+        || (header->index_size != 2 && header->index_size != 4))
+    {
+        return false;
+    }
+
+    for (u32 i = 0; i < header->attribute_count; ++i)
+    {
+        const CookedMeshAttribute *attribute = &header->attributes[i];
+        u32 attribute_size = attribute->format < COOKED_ATTRIBUTE_FORMAT_COUNT
+                           ? cooked_attribute_size((CookedAttributeFormat)attribute->format, attribute->components)
+                           : 0;
+        if (attribute_size == 0
+            || attribute->components == 0 || attribute->components > 4
+            || attribute->offset + attribute_size > header->vertex_stride)
+        {
+            return false;
+        }
+    }
+
+    u64 submesh_bytes = (u64)header->submesh_count * sizeof(CookedSubmesh);
+    if (header->vertex_bytes != (u64)header->vertex_count * header->vertex_stride
+        || header->index_bytes != (u64)header->index_count * header->index_size
+        || header->vertex_offset % COOKED_MESH_ALIGNMENT != 0
+        || header->index_offset % COOKED_MESH_ALIGNMENT != 0
+        || header->submesh_offset % alignof(CookedSubmesh) != 0
+        || header->submesh_offset > size || submesh_bytes > size - header->submesh_offset
+        || header->vertex_offset > size || header->vertex_bytes > size - header->vertex_offset
+        || header->index_offset > size || header->index_bytes > size - header->index_offset)
+    {
+        return false;
+    }
+
+    const CookedSubmesh *submeshes = (const CookedSubmesh *)(data + header->submesh_offset);
+    for (u32 i = 0; i < header->submesh_count; ++i)
+    {
+        const CookedSubmesh *submesh = &submeshes[i];
+        if (submesh->lod_count == 0 || submesh->lod_count > COOKED_MESH_MAX_LODS
+            || submesh->first_vertex > header->vertex_count
+            || submesh->vertex_count > header->vertex_count - submesh->first_vertex)
+        {
+            return false;
+        }
+        for (u32 j = 0; j < submesh->lod_count; ++j)
+        {
+            const CookedMeshLod *lod = &submesh->lods[j];
+            if (lod->first_index > header->index_count
+                || lod->index_count > header->index_count - lod->first_index
+                || lod->index_count % 3 != 0)
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+
+bool write_cooked_mesh(const char *path, const Mesh *mesh, VertexFormat format)
+{
+    CookedMeshHeader header = {};
+    header.magic = COOKED_MESH_MAGIC;
+    header.version = COOKED_MESH_VERSION;
+    header.vertex_count = mesh->vertex_count;
+    header.vertex_stride = vertex_format_stride(format);
+    header.index_count = mesh->index_count;
+    header.index_size = mesh->vertex_count <= 0x10000 ? 2 : 4;
+    header.attribute_count = describe_vertex_format(format, header.attributes);
+    header.submesh_count = 1;
+    header.vertex_format = format;
+
+    VertexDequantization dequantization = vertex_dequantization(mesh->vertices, mesh->vertex_count, format);
+    memcpy(header.position_offset, dequantization.position_offset.e, sizeof(header.position_offset));
+    memcpy(header.position_scale, dequantization.position_scale.e, sizeof(header.position_scale));
+    memcpy(header.uv_offset, dequantization.uv_offset.e, sizeof(header.uv_offset));
+    memcpy(header.uv_scale, dequantization.uv_scale.e, sizeof(header.uv_scale));
+
+    for (u32 c = 0; c < 3; ++c)
+    {
+        header.bounds_min[c] = mesh->vertex_count ? mesh->vertices[0].position.e[c] : 0.0f;
+        header.bounds_max[c] = header.bounds_min[c];
+    }
+    for (u32 i = 0; i < mesh->vertex_count; ++i)
+    {
+        for (u32 c = 0; c < 3; ++c)
+        {
+            f32 value = mesh->vertices[i].position.e[c];
+            header.bounds_min[c] = value < header.bounds_min[c] ? value : header.bounds_min[c];
+            header.bounds_max[c] = value > header.bounds_max[c] ? value : header.bounds_max[c];
+        }
+    }
+
+    CookedSubmesh submesh = {};
+    memcpy(submesh.bounds_min, header.bounds_min, sizeof(submesh.bounds_min));
+    memcpy(submesh.bounds_max, header.bounds_max, sizeof(submesh.bounds_max));
+    submesh.vertex_count = mesh->vertex_count;
+    submesh.lod_count = mesh->lod_count ? mesh->lod_count : 1;
+    submesh.lods[0].index_count = mesh->index_count;
+    for (u32 i = 0; i < mesh->lod_count; ++i)
+    {
+        submesh.lods[i].first_index = mesh->lods[i].first_index;
+        submesh.lods[i].index_count = mesh->lods[i].index_count;
+        submesh.lods[i].error = mesh->lods[i].error;
+    }
+
+    header.submesh_offset = align_offset(sizeof(header), alignof(CookedSubmesh));
+    header.vertex_offset = align_offset(header.submesh_offset + sizeof(submesh), COOKED_MESH_ALIGNMENT);
+    header.vertex_bytes = (u64)mesh->vertex_count * header.vertex_stride;
+    header.index_offset = align_offset(header.vertex_offset + header.vertex_bytes, COOKED_MESH_ALIGNMENT);
+    header.index_bytes = (u64)mesh->index_count * header.index_size;
+
+    const void *indices = mesh->indices;
+    u16 *short_indices = NULL;
+    if (header.index_size == 2)
+    {
+        short_indices = (u16 *)malloc(header.index_bytes + 1);
+        for (u32 i = 0; i < mesh->index_count; ++i)
+        {
+            short_indices[i] = (u16)mesh->indices[i];
+        }
+        indices = short_indices;
+    }
+
+    const void *vertices = mesh->vertices;
+    void *quantized = NULL;
+    if (format != VERTEX_FORMAT_FLOAT)
+    {
+        quantized = malloc(header.vertex_bytes + 1);
+        quantize_vertices(quantized, mesh->vertices, mesh->vertex_count, format, &dequantization);
+        vertices = quantized;
+    }
+
+    bool ok = false;
+    FILE *output = fopen(path, "wb");
+    if (output)
+    {
+        ok = fwrite(&header, sizeof(header), 1, output) == 1
+          && fseek(output, (long)header.submesh_offset, SEEK_SET) == 0
+          && fwrite(&submesh, sizeof(submesh), 1, output) == 1
+          && fseek(output, (long)header.vertex_offset, SEEK_SET) == 0
+          && fwrite(vertices, 1, header.vertex_bytes, output) == header.vertex_bytes
+          && fseek(output, (long)header.index_offset, SEEK_SET) == 0
+          && fwrite(indices, 1, header.index_bytes, output) == header.index_bytes;
+        ok = fclose(output) == 0 && ok;
+    }
+
+    free(quantized);
+    free(short_indices);
+    return ok;
+}
+
+
+bool view_cooked_mesh(const u8 *data, memory_index size, CookedMesh *mesh)
+{
+    *mesh = {};
+    if (!validate_cooked_mesh(data, size))
+    {
+        return false;
+    }
+
+    mesh->data = data;
+    mesh->size = size;
+    mesh->header = (const CookedMeshHeader *)data;
+    mesh->submeshes = (const CookedSubmesh *)(data + mesh->header->submesh_offset);
+    mesh->vertices = data + mesh->header->vertex_offset;
+    mesh->indices = data + mesh->header->index_offset;
+    return true;
+}
+
+
+bool map_cooked_mesh(const char *path, CookedMesh *mesh)
+{
+    memory_index size;
+    const u8 *data = platform_map_file(path, &size);
+    if (data == NULL)
+    {
+        *mesh = {};
+        return false;
+    }
+    if (!view_cooked_mesh(data, size, mesh))
+    {
+        platform_unmap_file(data, size);
+        return false;
+    }
+    return true;
+}
+
+
+void unmap_cooked_mesh(CookedMesh *mesh)
+{
+    platform_unmap_file(mesh->data, mesh->size);
+    *mesh = {};
+}
@@ -0,0 +1,124 @@
+#pragma once
+
+#include "platform.hpp"
+#include "mesh.hpp"
+
+
+// Cooked mesh container (.cmesh), written by cook_mesh and mapped as is by
+// map_cooked_mesh().
+//
+// A CookedMeshHeader and the submesh table, then the vertex blob and the
+// index blob, each at a page aligned offset: a mapping of the file hands
+// glBufferData() pointers straight into the page cache, with no parse and
+// no copy in between. The header describes the vertex layout, so the
+// attribute pointers come from the file too, and how to dequantize
+// positions and UVs when the layout packs them (see vertex_format.hpp).
+// Little endian throughout.
+//
+// Every submesh is a range of vertices and one index range per LOD, most
+// detailed first, with the object space error of each LOD for selection.
+// Index values are not checked at load time, the cooker wrote them.
+
+
+#define COOKED_MESH_MAGIC          0x48534D43   // "CMSH"
+#define COOKED_MESH_VERSION        2
+#define COOKED_MESH_ALIGNMENT      4096         // of the vertex and index blobs
+#define COOKED_MESH_MAX_ATTRIBUTES 8
+#define COOKED_MESH_MAX_LODS       8
+
+
+enum CookedAttributeFormat
+{
+    COOKED_ATTRIBUTE_F32,
+    COOKED_ATTRIBUTE_F16,
+    COOKED_ATTRIBUTE_UNORM16,               // 0 to 65535 read as 0 to 1
+    COOKED_ATTRIBUTE_SNORM_10_10_10_2,      // GL_INT_2_10_10_10_REV, four components in 32 bits
+    COOKED_ATTRIBUTE_FORMAT_COUNT
+};
+
+
+struct CookedMeshAttribute
+{
+    u32 location;               // shader attribute
+    u32 format;                 // CookedAttributeFormat
+    u32 components;             // 1 to 4
+    u32 offset;                 // in the vertex
+};
+
+
+struct CookedMeshLod
+{
+    u32 first_index;
+    u32 index_count;
+    f32 error;                  // object space, 0 for the full mesh
+    u32 reserved;
+};
+
+
+struct CookedSubmesh
+{
+    f32           bounds_min[3];
+    f32           bounds_max[3];
+    u32           first_vertex;
+    u32           vertex_count;
+    u32           lod_count;
+    u32           reserved;
+    CookedMeshLod lods[COOKED_MESH_MAX_LODS];
+};
+
+
+struct CookedMeshHeader
+{
+    u32                 magic;
+    u32                 version;
+    u32                 vertex_count;
+    u32                 vertex_stride;
+    u32                 index_count;    // over all submeshes and LODs
+    u32                 index_size;     // 2 or 4 bytes
+    u32                 attribute_count;
+    u32                 submesh_count;
+    u32                 vertex_format;  // VertexFormat
+    u32                 reserved;
+    CookedMeshAttribute attributes[COOKED_MESH_MAX_ATTRIBUTES];
+    f32                 bounds_min[3];
+    f32                 bounds_max[3];
+    f32                 position_offset[3];
+    f32                 position_scale[3];
+    f32                 uv_offset[2];
+    f32                 uv_scale[2];
+    u64                 submesh_offset; // from the start of the file
+    u64                 vertex_offset;
+    u64                 vertex_bytes;
+    u64                 index_offset;
+    u64                 index_bytes;
+};
+
+
+// A mapped .cmesh, the pointers point into the mapping
+struct CookedMesh
+{
+    const u8               *data;
+    memory_index            size;
+    const CookedMeshHeader *header;
+    const CookedSubmesh    *submeshes;
+    const void             *vertices;
+    const void             *indices;
+};
+
+
+u32 cooked_attribute_size(CookedAttributeFormat format, u32 components);
+
+// Magic, version, that the layout fits the stride and that the tables and
+// blobs lie inside the file with the sizes their counts need.
+bool validate_cooked_mesh(const u8 *data, memory_index size);
+
+// Writes `mesh` as one submesh with its LODs, its vertices in `format`.
+// Indices are 16 bit when the vertex count allows.
+bool write_cooked_mesh(const char *path, const Mesh *mesh, VertexFormat format = VERTEX_FORMAT_FLOAT);
+
+// A validated view of a .cmesh already in memory, the pointers point into
+// `data`.
+bool view_cooked_mesh(const u8 *data, memory_index size, CookedMesh *mesh);
+
+bool map_cooked_mesh(const char *path, CookedMesh *mesh);
+void unmap_cooked_mesh(CookedMesh *mesh);
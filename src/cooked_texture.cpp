@@ -0,0 +1,81 @@
+#include <string.h>
+
+#include "cooked_texture.hpp"
+#include "block_compression.hpp"
+
+
+global_variable const char *cooked_texture_format_names[COOKED_TEXTURE_FORMAT_COUNT] =
+{
+    "rgba8",
+    "bc1",
+    "bc3",
+    "bc5",
+};
+
+
+const char *cooked_texture_format_name(CookedTextureFormat format)
+{
+    return format < COOKED_TEXTURE_FORMAT_COUNT ? cooked_texture_format_names[format] : "unknown";
+}
+
+
+bool parse_cooked_texture_format(const char *name, CookedTextureFormat *format)
+{
+    for (u32 i = 0; i < COOKED_TEXTURE_FORMAT_COUNT; ++i)
+    {
+        if (strcmp(name, cooked_texture_format_names[i]) == 0)
+        {
+            *format = (CookedTextureFormat)i;
+            return true;
+        }
+    }
+    return false;
+}
+
+
+u64 cooked_texture_level_size(CookedTextureFormat format, u32 width, u32 height)
+{
+    switch (format)
+    {
+        case COOKED_TEXTURE_RGBA8: return (u64)width * height * 4;
+        case COOKED_TEXTURE_BC1:   return bc_image_bytes(BLOCK_BC1, width, height);
+        case COOKED_TEXTURE_BC3:   return bc_image_bytes(BLOCK_BC3, width, height);
+        case COOKED_TEXTURE_BC5:   return bc_image_bytes(BLOCK_BC5, width, height);
+        default:                   return 0;
+    }
+}
+
+
+bool validate_cooked_texture(const u8 *data, memory_index size)
+{
+    if (size < sizeof(CookedTextureHeader))
+    {
+        return false;
+    }
+
+    const CookedTextureHeader *header = (const CookedTextureHeader *)data;
+    if (header->magic != COOKED_TEXTURE_MAGIC
+        || header->version != COOKED_TEXTURE_VERSION
+        || header->format >= COOKED_TEXTURE_FORMAT_COUNT
+        || header->level_count == 0
+        || header->level_count > COOKED_TEXTURE_MAX_LEVELS)
+    {
+        return false;
+    }
+
+    for (u32 i = 0; i < header->level_count; ++i)
+    {
+        const CookedTextureLevel *level = &header->levels[i];
+        u32 width = header->width >> i;
+        u32 height = header->height >> i;
+        if (level->width != (width ? width : 1)
+            || level->height != (height ? height : 1)
+            || level->size != cooked_texture_level_size((CookedTextureFormat)header->format, level->width, level->height)
+            || level->offset > size
+            || level->size > size - level->offset)
+        {
+            return false;
+        }
+    }
+    return true;
+}
@@ -0,0 +1,65 @@
+#pragma once
+
+#include "platform.hpp"
+
+
+// Cooked texture container (.ctex), written by cook_texture and uploaded
+// as is by the texture loader.
+//
+// A CookedTextureHeader followed by the mip levels, largest first, each at
+// a 16 byte aligned offset. Rows are in GL order (bottom row first), so
+// nothing is flipped or converted at load time. Little endian throughout.
+
+
+#define COOKED_TEXTURE_MAGIC      0x58455443    // "CTEX"
+#define COOKED_TEXTURE_VERSION    1
+#define COOKED_TEXTURE_MAX_LEVELS 16            // up to 32768x32768
+
+
+enum CookedTextureFormat
+{
+    COOKED_TEXTURE_RGBA8,       // uncompressed
+    COOKED_TEXTURE_BC1,
+    COOKED_TEXTURE_BC3,
+    COOKED_TEXTURE_BC5,
+    COOKED_TEXTURE_FORMAT_COUNT
+};
+
+
+enum CookedTextureFlags
+{
+    COOKED_TEXTURE_SRGB = 1 << 0,
+};
+
+
+struct CookedTextureLevel
+{
+    u32 width;
+    u32 height;
+    u64 offset;                 // from the start of the file
+    u64 size;
+};
+
+
+struct CookedTextureHeader
+{
+    u32                magic;
+    u32                version;
+    u32                format;
+    u32                flags;
+    u32                width;
+    u32                height;
+    u32                level_count;
+    u32                reserved;
+    CookedTextureLevel levels[COOKED_TEXTURE_MAX_LEVELS];
+};
+
+
+const char *cooked_texture_format_name(CookedTextureFormat format);
+bool parse_cooked_texture_format(const char *name, CookedTextureFormat *format);
+
+u64 cooked_texture_level_size(CookedTextureFormat format, u32 width, u32 height);
+
+// Magic, version, format and that every level lies inside the file with the
+// size its dimensions need. The header is at the start of `data`.
+bool validate_cooked_texture(const u8 *data, memory_index size);
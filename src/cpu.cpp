@@ -0,0 +1,54 @@
+#include <string.h>
+
+#include "cpu.hpp"
+
+
+CpuIsa cpu_best_isa()
+{
+    // Also checks that the OS saves the wider registers (xgetbv)
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f")
+        && __builtin_cpu_supports("avx2")
+        && __builtin_cpu_supports("fma"))
+    {
+        return CPU_ISA_AVX512;
+    }
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"))
+    {
+        return CPU_ISA_AVX2;
+    }
+    return CPU_ISA_SSE2;
+}
+
+
+bool cpu_isa_supported(CpuIsa isa)
+{
+    return isa < CPU_ISA_COUNT && isa <= cpu_best_isa();
+}
+
+
+const char *cpu_isa_name(CpuIsa isa)
+{
+    switch (isa)
+    {
+        case CPU_ISA_SCALAR: return "scalar";
+        case CPU_ISA_SSE2:   return "sse2";
+        case CPU_ISA_AVX2:   return "avx2";
+        case CPU_ISA_AVX512: return "avx512";
+        default:             return "?";
+    }
+}
+
+
+bool parse_cpu_isa(const char *name, CpuIsa *isa)
+{
+    for (u32 i = 0; i < CPU_ISA_COUNT; ++i)
+    {
+        if (strcmp(name, cpu_isa_name((CpuIsa)i)) == 0)
+        {
+            *isa = (CpuIsa)i;
+            return true;
+        }
+    }
+    return false;
+}
@@ -0,0 +1,34 @@
+#pragma once
+
+#include "platform.hpp"
+
+
+// Instruction sets the SIMD kernels are built for. Every variant is compiled
+// into the binary with a target attribute and the module picks one at
+// startup (see select_math_kernels()), so the build itself needs no -m
+// flags and still runs on any x86-64 machine.
+enum CpuIsa
+{
+    CPU_ISA_SCALAR,
+    CPU_ISA_SSE2,       // x86-64 baseline
+    CPU_ISA_AVX2,       // with FMA
+    CPU_ISA_AVX512,     // AVX-512F
+    CPU_ISA_COUNT
+};
+
+
+// For kernel variants and any inline helpers they use. Helpers without the
+// attribute can still be called, but are compiled for the baseline.
+#define TARGET_AVX2   __attribute__((target("avx2,fma")))
+#define TARGET_AVX512 __attribute__((target("avx512f,avx2,fma")))
+
+
+// Best instruction set this CPU (and OS) supports, from cpuid.
+CpuIsa cpu_best_isa();
+
+bool cpu_isa_supported(CpuIsa isa);
+
+const char *cpu_isa_name(CpuIsa isa);
+
+// Accepts the names from cpu_isa_name(), for --isa overrides.
+bool parse_cpu_isa(const char *name, CpuIsa *isa);
@@ -0,0 +1,467 @@
+#include <string.h>
+
+#include "cull.hpp"
+#include "jobs.hpp"
+
+
+// Each kernel loads a group of centers (and extents or radii), computes the
+// signed distance to every plane and ANDs the per-plane results into one
+// lane mask. The visible lanes' indices are then packed to the front of the
+// output: a bit loop for SSE2, a lookup table of lane permutations for AVX2
+// and a compress store for AVX-512, so only the count depends on the mask.
+
+
+Frustum frustum_from_matrix(const Mat4 &view_projection)
+{
+    const f32 (*m)[4] = view_projection.e;
+    Vec4 rows[4];
+    for (u32 row = 0; row < 4; ++row)
+    {
+        rows[row] = vec4(m[0][row], m[1][row], m[2][row], m[3][row]);
+    }
+
+    Frustum frustum;
+    frustum.planes[0] = rows[3] + rows[0];
+    frustum.planes[1] = rows[3] - rows[0];
+    frustum.planes[2] = rows[3] + rows[1];
+    frustum.planes[3] = rows[3] - rows[1];
+    frustum.planes[4] = rows[3] + rows[2];
+    frustum.planes[5] = rows[3] - rows[2];
+    for (u32 i = 0; i < 6; ++i)
+    {
+        frustum.planes[i] = frustum.planes[i] / length(frustum.planes[i].xyz);
+    }
+    return frustum;
+}
+
+
+bool push_cull_bounds(CullBounds *bounds, MemoryArena *arena, u32 capacity)
+{
+    // Padded so every array starts on a cache line
+    u32 padded = (capacity + 15) & ~15u;
+    f32 *arrays[7];
+    for (u32 i = 0; i < 7; ++i)
+    {
+        arrays[i] = (f32 *)push_size(arena, padded * sizeof(f32), 64);
+        if (arrays[i] == NULL)
+        {
+            return false;
+        }
+    }
+
+    bounds->center.x = arrays[0];
+    bounds->center.y = arrays[1];
+    bounds->center.z = arrays[2];
+    bounds->extent.x = arrays[3];
+    bounds->extent.y = arrays[4];
+    bounds->extent.z = arrays[5];
+    bounds->radius = arrays[6];
+    bounds->count = 0;
+    bounds->capacity = capacity;
+    return true;
+}
+
+
+void set_cull_bounds(CullBounds *bounds, u32 index, Vec3 min, Vec3 max)
+{
+    assert(index < bounds->capacity);
+    Vec3 center = (min + max) * 0.5f;
+    Vec3 extent = (max - min) * 0.5f;
+    bounds->center.x[index] = center.x;
+    bounds->center.y[index] = center.y;
+    bounds->center.z[index] = center.z;
+    bounds->extent.x[index] = extent.x;
+    bounds->extent.y[index] = extent.y;
+    bounds->extent.z[index] = extent.z;
+    bounds->radius[index] = length(extent);
+}
+
+
+// Plane components split out for broadcasting
+struct CullPlanes
+{
+    f32 x[6];
+    f32 y[6];
+    f32 z[6];
+    f32 w[6];
+    f32 abs_x[6];
+    f32 abs_y[6];
+    f32 abs_z[6];
+};
+
+
+internal CullPlanes split_planes(const Frustum *frustum)
+{
+    CullPlanes planes;
+    for (u32 p = 0; p < 6; ++p)
+    {
+        planes.x[p] = frustum->planes[p].x;
+        planes.y[p] = frustum->planes[p].y;
+        planes.z[p] = frustum->planes[p].z;
+        planes.w[p] = frustum->planes[p].w;
+        planes.abs_x[p] = fabsf(planes.x[p]);
+        planes.abs_y[p] = fabsf(planes.y[p]);
+        planes.abs_z[p] = fabsf(planes.z[p]);
+    }
+    return planes;
+}
+
+
+// Scalar ######################################################################
+
+
+// Outside a plane when the center is further behind it than the box (or
+// sphere) reaches
+u32 cull_range_scalar(const Frustum *frustum, const CullBounds *bounds, CullShape shape,
+                      u32 first, u32 count, u32 *visible)
+{
+    CullPlanes planes = split_planes(frustum);
+    u32 visible_count = 0;
+    for (u32 i = first; i < first + count; ++i)
+    {
+        f32 x = bounds->center.x[i];
+        f32 y = bounds->center.y[i];
+        f32 z = bounds->center.z[i];
+
+        bool inside = true;
+        for (u32 p = 0; p < 6 && inside; ++p)
+        {
+            f32 distance = planes.x[p] * x + planes.y[p] * y + planes.z[p] * z + planes.w[p];
+            f32 reach = shape == CULL_SPHERE
+                ? bounds->radius[i]
+                : planes.abs_x[p] * bounds->extent.x[i]
+                  + planes.abs_y[p] * bounds->extent.y[i]
+                  + planes.abs_z[p] * bounds->extent.z[i];
+            inside = distance >= -reach;
+        }
+
+        visible[visible_count] = i;
+        visible_count += inside;
+    }
+    return visible_count;
+}
+
+
+// SSE2 ########################################################################
+
+
+internal u32 cull_range_sse2(const Frustum *frustum, const CullBounds *bounds, CullShape shape,
+                             u32 first, u32 count, u32 *visible)
+{
+    CullPlanes planes = split_planes(frustum);
+    __m128 sign = _mm_set1_ps(-0.0f);
+    u32 end = first + count;
+    u32 visible_count = 0;
+
+    u32 i = first;
+    for (; i + 4 <= end; i += 4)
+    {
+        __m128 x = _mm_loadu_ps(bounds->center.x + i);
+        __m128 y = _mm_loadu_ps(bounds->center.y + i);
+        __m128 z = _mm_loadu_ps(bounds->center.z + i);
+        __m128 extent_x = _mm_setzero_ps();
+        __m128 extent_y = _mm_setzero_ps();
+        __m128 extent_z = _mm_setzero_ps();
+        __m128 radius = _mm_setzero_ps();
+        if (shape == CULL_SPHERE)
+        {
+            radius = _mm_loadu_ps(bounds->radius + i);
+        }
+        else
+        {
+            extent_x = _mm_loadu_ps(bounds->extent.x + i);
+            extent_y = _mm_loadu_ps(bounds->extent.y + i);
+            extent_z = _mm_loadu_ps(bounds->extent.z + i);
+        }
+
+        __m128 inside = _mm_castsi128_ps(_mm_set1_epi32(-1));
+        for (u32 p = 0; p < 6; ++p)
+        {
+            __m128 distance = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(planes.x[p]), x),
+                                                    _mm_mul_ps(_mm_set1_ps(planes.y[p]), y)),
+                                         _mm_add_ps(_mm_mul_ps(_mm_set1_ps(planes.z[p]), z),
+                                                    _mm_set1_ps(planes.w[p])));
+            __m128 reach = radius;
+            if (shape == CULL_AABB)
+            {
+                reach = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(planes.abs_x[p]), extent_x),
+                                              _mm_mul_ps(_mm_set1_ps(planes.abs_y[p]), extent_y)),
+                                   _mm_mul_ps(_mm_set1_ps(planes.abs_z[p]), extent_z));
+            }
+            inside = _mm_and_ps(inside, _mm_cmpge_ps(distance, _mm_xor_ps(reach, sign)));
+        }
+
+        u32 mask = (u32)_mm_movemask_ps(inside);
+        while (mask)
+        {
+            visible[visible_count++] = i + (u32)__builtin_ctz(mask);
+            mask &= mask - 1;
+        }
+    }
+
+    return visible_count + cull_range_scalar(frustum, bounds, shape, i, end - i, visible + visible_count);
+}
+
+
+// AVX2 ########################################################################
+
+
+// For every 8 bit lane mask, the indices of its set lanes packed into the
+// low bytes
+struct CullCompactTable
+{
+    u64 lanes[256];
+};
+
+
+constexpr CullCompactTable make_cull_compact_table()
+{
+    CullCompactTable table = {};
+    for (u32 mask = 0; mask < 256; ++mask)
+    {
+        u32 packed = 0;
+        for (u32 lane = 0; lane < 8; ++lane)
+        {
+            if (mask & (1u << lane))
+            {
+                table.lanes[mask] |= (u64)lane << (8 * packed++);
+            }
+        }
+    }
+    return table;
+}
+
+
+global_variable constexpr CullCompactTable cull_compact_table = make_cull_compact_table();
+
+
+TARGET_AVX2
+internal u32 cull_range_avx2(const Frustum *frustum, const CullBounds *bounds, CullShape shape,
+                             u32 first, u32 count, u32 *visible)
+{
+    CullPlanes planes = split_planes(frustum);
+    __m256 sign = _mm256_set1_ps(-0.0f);
+    u32 end = first + count;
+    u32 visible_count = 0;
+
+    u32 i = first;
+    for (; i + 8 <= end; i += 8)
+    {
+        __m256 x = _mm256_loadu_ps(bounds->center.x + i);
+        __m256 y = _mm256_loadu_ps(bounds->center.y + i);
+        __m256 z = _mm256_loadu_ps(bounds->center.z + i);
+        __m256 extent_x = _mm256_setzero_ps();
+        __m256 extent_y = _mm256_setzero_ps();
+        __m256 extent_z = _mm256_setzero_ps();
+        __m256 radius = _mm256_setzero_ps();
+        if (shape == CULL_SPHERE)
+        {
+            radius = _mm256_loadu_ps(bounds->radius + i);
+        }
+        else
+        {
+            extent_x = _mm256_loadu_ps(bounds->extent.x + i);
+            extent_y = _mm256_loadu_ps(bounds->extent.y + i);
+            extent_z = _mm256_loadu_ps(bounds->extent.z + i);
+        }
+
+        __m256 inside = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+        for (u32 p = 0; p < 6; ++p)
+        {
+            __m256 distance = _mm256_fmadd_ps(_mm256_set1_ps(planes.x[p]), x, _mm256_set1_ps(planes.w[p]));
+            distance = _mm256_fmadd_ps(_mm256_set1_ps(planes.y[p]), y, distance);
+            distance = _mm256_fmadd_ps(_mm256_set1_ps(planes.z[p]), z, distance);
+            __m256 reach = radius;
+            if (shape == CULL_AABB)
+            {
+                reach = _mm256_mul_ps(_mm256_set1_ps(planes.abs_x[p]), extent_x);
+                reach = _mm256_fmadd_ps(_mm256_set1_ps(planes.abs_y[p]), extent_y, reach);
+                reach = _mm256_fmadd_ps(_mm256_set1_ps(planes.abs_z[p]), extent_z, reach);
+            }
+            inside = _mm256_and_ps(inside, _mm256_cmp_ps(distance, _mm256_xor_ps(reach, sign), _CMP_GE_OQ));
+        }
+
+        // Always stores 8 indices, the ones past the visible count are
+        // overwritten by the next group. Stays inside `visible` because
+        // visible_count <= i - first.
+        u32 mask = (u32)_mm256_movemask_ps(inside);
+        __m256i lanes = _mm256_cvtepu8_epi32(_mm_cvtsi64_si128((i64)cull_compact_table.lanes[mask]));
+        _mm256_storeu_si256((__m256i *)(visible + visible_count),
+                            _mm256_add_epi32(lanes, _mm256_set1_epi32((i32)i)));
+        visible_count += (u32)__builtin_popcount(mask);
+    }
+
+    return visible_count + cull_range_scalar(frustum, bounds, shape, i, end - i, visible + visible_count);
+}
+
+
+// AVX-512 #####################################################################
+
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+
+
+TARGET_AVX512
+internal u32 cull_range_avx512(const Frustum *frustum, const CullBounds *bounds, CullShape shape,
+                               u32 first, u32 count, u32 *visible)
+{
+    CullPlanes planes = split_planes(frustum);
+    __m512 sign = _mm512_set1_ps(-0.0f);
+    __m512i lane_index = _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+    u32 end = first + count;
+    u32 visible_count = 0;
+
+    u32 i = first;
+    for (; i + 16 <= end; i += 16)
+    {
+        __m512 x = _mm512_loadu_ps(bounds->center.x + i);
+        __m512 y = _mm512_loadu_ps(bounds->center.y + i);
+        __m512 z = _mm512_loadu_ps(bounds->center.z + i);
+        __m512 extent_x = _mm512_setzero_ps();
+        __m512 extent_y = _mm512_setzero_ps();
+        __m512 extent_z = _mm512_setzero_ps();
+        __m512 radius = _mm512_setzero_ps();
+        if (shape == CULL_SPHERE)
+        {
+            radius = _mm512_loadu_ps(bounds->radius + i);
+        }
+        else
+        {
+            extent_x = _mm512_loadu_ps(bounds->extent.x + i);
+            extent_y = _mm512_loadu_ps(bounds->extent.y + i);
+            extent_z = _mm512_loadu_ps(bounds->extent.z + i);
+        }
+
+        __mmask16 inside = 0xFFFF;
+        for (u32 p = 0; p < 6; ++p)
+        {
+            __m512 distance = _mm512_fmadd_ps(_mm512_set1_ps(planes.x[p]), x, _mm512_set1_ps(planes.w[p]));
+            distance = _mm512_fmadd_ps(_mm512_set1_ps(planes.y[p]), y, distance);
+            distance = _mm512_fmadd_ps(_mm512_set1_ps(planes.z[p]), z, distance);
+            __m512 reach = radius;
+            if (shape == CULL_AABB)
+            {
+                reach = _mm512_mul_ps(_mm512_set1_ps(planes.abs_x[p]), extent_x);
+                reach = _mm512_fmadd_ps(_mm512_set1_ps(planes.abs_y[p]), extent_y, reach);
+                reach = _mm512_fmadd_ps(_mm512_set1_ps(planes.abs_z[p]), extent_z, reach);
+            }
+            __m512 neg_reach = _mm512_castsi512_ps(_mm512_xor_si512(_mm512_castps_si512(reach),
+                                                                    _mm512_castps_si512(sign)));
+            inside = _mm512_mask_cmp_ps_mask(inside, distance, neg_reach, _CMP_GE_OQ);
+        }
+
+        _mm512_mask_compressstoreu_epi32(visible + visible_count, inside,
+                                         _mm512_add_epi32(lane_index, _mm512_set1_epi32((i32)i)));
+        visible_count += (u32)__builtin_popcount(inside);
+    }
+
+    return visible_count + cull_range_scalar(frustum, bounds, shape, i, end - i, visible + visible_count);
+}
+
+
+#pragma GCC diagnostic pop
+
+
+// Dispatch ####################################################################
+
+
+struct CullKernels
+{
+    CpuIsa isa;
+    u32 (*cull_range)(const Frustum *, const CullBounds *, CullShape, u32, u32, u32 *);
+};
+
+
+global_variable const CullKernels cull_kernel_table[CPU_ISA_COUNT] =
+{
+    {CPU_ISA_SCALAR, cull_range_scalar},
+    {CPU_ISA_SSE2, cull_range_sse2},
+    {CPU_ISA_AVX2, cull_range_avx2},
+    {CPU_ISA_AVX512, cull_range_avx512},
+};
+
+
+global_variable CullKernels cull_kernels = cull_kernel_table[CPU_ISA_SSE2];
+
+
+bool select_cull_kernels(CpuIsa isa)
+{
+    if (!cpu_isa_supported(isa))
+    {
+        return false;
+    }
+    cull_kernels = cull_kernel_table[isa];
+    return true;
+}
+
+
+CpuIsa cull_kernels_isa()
+{
+    return cull_kernels.isa;
+}
+
+
+u32 cull_range(const Frustum *frustum, const CullBounds *bounds, CullShape shape,
+               u32 first, u32 count, u32 *visible)
+{
+    return cull_kernels.cull_range(frustum, bounds, shape, first, count, visible);
+}
+
+
+// Parallel ####################################################################
+
+
+struct CullJob
+{
+    const Frustum    *frustum;
+    const CullBounds *bounds;
+    CullShape         shape;
+    u32              *visible;
+    u32               batch_size;
+    u32               batch_counts[CULL_MAX_BATCHES];
+};
+
+
+internal void cull_batch(void *data, u32 first, u32 count)
+{
+    CullJob *job = (CullJob *)data;
+    job->batch_counts[first / job->batch_size] =
+        cull_range(job->frustum, job->bounds, job->shape, first, count, job->visible + first);
+}
+
+
+u32 cull(const Frustum *frustum, const CullBounds *bounds, CullShape shape, u32 *visible)
+{
+    u32 count = bounds->count;
+    if (count < CULL_PARALLEL_MIN || jobs_thread_count() == 1)
+    {
+        return cull_range(frustum, bounds, shape, 0, count, visible);
+    }
+
+    u32 batch_size = CULL_BATCH_SIZE;
+    u32 min_batch_size = count / CULL_MAX_BATCHES + 1;
+    if (min_batch_size > batch_size)
+    {
+        batch_size = (min_batch_size + 15) & ~15u;
+    }
+
+    CullJob job;
+    job.frustum = frustum;
+    job.bounds = bounds;
+    job.shape = shape;
+    job.visible = visible;
+    job.batch_size = batch_size;
+    jobs_parallel_for(count, batch_size, cull_batch, &job);
+
+    // Each batch wrote to its own slice of `visible`, close the gaps
+    u32 visible_count = 0;
+    for (u32 batch = 0; batch * batch_size < count; ++batch)
+    {
+        u32 batch_count = job.batch_counts[batch];
+        memmove(visible + visible_count, visible + batch * batch_size, batch_count * sizeof(u32));
+        visible_count += batch_count;
+    }
+    return visible_count;
+}
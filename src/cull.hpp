@@ -0,0 +1,76 @@
+#pragma once
+
+#include "platform.hpp"
+#include "cpu.hpp"
+#include "math.hpp"
+
+
+// View frustum culling over bounding volumes kept as structure of arrays.
+//
+// Every object has a center, AABB half extents and a bounding sphere radius
+// around the same center. The kernels test 4 (SSE2), 8 (AVX2) or 16
+// (AVX-512) objects at once against all six planes and write the indices of
+// the visible ones, in order, to a compacted list. cull() splits big sets
+// over the job system. The tests are conservative: a box that misses the
+// frustum only near a corner still counts as visible.
+
+
+// Large sets are split into batches of at least this many objects
+#define CULL_PARALLEL_MIN 32768
+#define CULL_BATCH_SIZE   16384
+#define CULL_MAX_BATCHES  1024
+
+
+enum CullShape
+{
+    CULL_AABB,
+    CULL_SPHERE,
+};
+
+
+// Planes point inward and are normalized, a point p is inside a plane when
+// dot(plane.xyz, p) + plane.w >= 0. Order: left, right, bottom, top, near,
+// far.
+struct Frustum
+{
+    Vec4 planes[6];
+};
+
+
+struct CullBounds
+{
+    Vec3SoA  center;
+    Vec3SoA  extent;        // half size of the box
+    f32     *radius;
+    u32      count;
+    u32      capacity;
+};
+
+
+// For a GL style clip space (-w <= z <= w), so it works for any
+// perspective() or orthographic() times a view matrix.
+Frustum frustum_from_matrix(const Mat4 &view_projection);
+
+// Arrays for `capacity` objects, count starts at 0.
+bool push_cull_bounds(CullBounds *bounds, MemoryArena *arena, u32 capacity);
+
+// Sets object `index` from its box, the sphere encloses the box.
+void set_cull_bounds(CullBounds *bounds, u32 index, Vec3 min, Vec3 max);
+
+// Like select_math_kernels(), SSE2 until called.
+bool select_cull_kernels(CpuIsa isa);
+CpuIsa cull_kernels_isa();
+
+// Writes the indices of the objects in [first, first + count) that touch the
+// frustum to `visible`, which needs room for `count`, and returns how many.
+// Runs on the calling thread only.
+u32 cull_range(const Frustum *frustum, const CullBounds *bounds, CullShape shape,
+               u32 first, u32 count, u32 *visible);
+
+// cull_range() over every object, in parallel on the job system from
+// CULL_PARALLEL_MIN objects up. `visible` needs room for bounds->count.
+u32 cull(const Frustum *frustum, const CullBounds *bounds, CullShape shape, u32 *visible);
+
+// Reference for the SIMD kernels and bench_cull.
+u32 cull_range_scalar(const Frustum *frustum, const CullBounds *bounds, CullShape shape,
+                      u32 first, u32 count, u32 *visible);
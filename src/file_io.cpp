@@ -0,0 +1,629 @@
+#include <errno.h>
+#include <string.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <linux/io_uring.h>
+#include <atomic>
+#include <thread>
+
+#include "file_io.hpp"
+#include "jobs.hpp"
+
+
+#define IO_MAX_PATH     256
+#define IO_RING_ENTRIES (IO_MAX_REQUESTS * 4)   // three per read, one per stat
+#define IO_MAX_READ     0x7FFFF000              // what read() does at most
+
+
+enum IoOperation
+{
+    IO_STAT,
+    IO_READ_FILE,
+};
+
+
+enum IoRequestState
+{
+    IO_FREE,
+    IO_QUEUED,
+    IO_RUNNING,
+    IO_DONE,
+};
+
+
+// The low bits of a submission's user_data, the request's slot above them
+enum IoStep
+{
+    IO_STEP_OPEN,
+    IO_STEP_READ,
+    IO_STEP_CLOSE,
+    IO_STEP_STAT,
+};
+
+
+struct IoRequest
+{
+    std::atomic<u32> state;
+    u32              operation;
+    char             path[IO_MAX_PATH];
+    u8              *buffer;
+    u64              capacity;
+    IoCallback      *callback;
+    void            *user;
+    i64              result;
+    u32              steps_left;    // completions still due from the ring
+    struct statx     stat;
+};
+
+
+struct IoRing
+{
+    int           fd;
+    u8           *sq_memory;
+    memory_index  sq_size;
+    u8           *cq_memory;
+    memory_index  cq_size;
+    io_uring_sqe *sqes;
+    memory_index  sqes_size;
+    u32           sq_entries;
+
+    // Shared with the kernel
+    u32          *sq_head;
+    u32          *sq_tail;
+    u32          *sq_array;
+    u32           sq_mask;
+    u32          *cq_head;
+    u32          *cq_tail;
+    io_uring_cqe *cqes;
+    u32           cq_mask;
+
+    u32           tail;         // ours, published by io_submit()
+    u32           unsubmitted;
+};
+
+
+struct FileIo
+{
+    bool         initialized;
+    IoBackend    backend;
+    IoRing       ring;
+    u8          *registered;
+    memory_index registered_size;
+
+    IoRequest    requests[IO_MAX_REQUESTS];
+    u32          active[IO_MAX_REQUESTS];   // slots in use, oldest first
+    u32          active_count;
+    JobCounter   jobs;
+};
+
+
+global_variable FileIo file_io;
+
+
+// IO_URING ###################################################################
+
+
+internal int uring_setup(u32 entries, io_uring_params *params)
+{
+    return (int)syscall(__NR_io_uring_setup, entries, params);
+}
+
+
+internal int uring_enter(int fd, u32 submit, u32 min_complete, u32 flags)
+{
+    return (int)syscall(__NR_io_uring_enter, fd, submit, min_complete, flags, NULL, 0);
+}
+
+
+internal int uring_register(int fd, u32 opcode, const void *arg, u32 count)
+{
+    return (int)syscall(__NR_io_uring_register, fd, opcode, arg, count);
+}
+
+
+internal void close_uring(IoRing *ring)
+{
+    if (ring->sqes)
+    {
+        munmap(ring->sqes, ring->sqes_size);
+    }
+    if (ring->cq_memory && ring->cq_memory != ring->sq_memory)
+    {
+        munmap(ring->cq_memory, ring->cq_size);
+    }
+    if (ring->sq_memory)
+    {
+        munmap(ring->sq_memory, ring->sq_size);
+    }
+    close(ring->fd);
+    *ring = {};
+}
+
+
+internal void *map_uring(int fd, memory_index size, u64 offset)
+{
+    void *memory = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, (off_t)offset);
+    return memory == MAP_FAILED ? NULL : memory;
+}
+
+
+internal bool init_uring(IoRing *ring)
+{
+    *ring = {};
+    io_uring_params params = {};
+    ring->fd = uring_setup(IO_RING_ENTRIES, &params);
+    if (ring->fd < 0)
+    {
+        return false;
+    }
+
+    // Opens straight into the file table came in 5.15, before the first
+    // kernel with CQE_SKIP. Older ones would fail every read.
+    if (!(params.features & IORING_FEAT_CQE_SKIP))
+    {
+        close(ring->fd);
+        return false;
+    }
+
+    ring->sq_entries = params.sq_entries;
+    ring->sq_size = params.sq_off.array + params.sq_entries * sizeof(u32);
+    ring->cq_size = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+    bool single_mmap = params.features & IORING_FEAT_SINGLE_MMAP;
+    if (single_mmap)
+    {
+        ring->sq_size = ring->sq_size > ring->cq_size ? ring->sq_size : ring->cq_size;
+        ring->cq_size = ring->sq_size;
+    }
+
+    ring->sq_memory = (u8 *)map_uring(ring->fd, ring->sq_size, IORING_OFF_SQ_RING);
+    ring->cq_memory = single_mmap ? ring->sq_memory : (u8 *)map_uring(ring->fd, ring->cq_size, IORING_OFF_CQ_RING);
+    ring->sqes_size = params.sq_entries * sizeof(io_uring_sqe);
+    ring->sqes = (io_uring_sqe *)map_uring(ring->fd, ring->sqes_size, IORING_OFF_SQES);
+    if (!ring->sq_memory || !ring->cq_memory || !ring->sqes)
+    {
+        close_uring(ring);
+        return false;
+    }
+
+    ring->sq_head = (u32 *)(ring->sq_memory + params.sq_off.head);
+    ring->sq_tail = (u32 *)(ring->sq_memory + params.sq_off.tail);
+    ring->sq_array = (u32 *)(ring->sq_memory + params.sq_off.array);
+    ring->sq_mask = *(u32 *)(ring->sq_memory + params.sq_off.ring_mask);
+    ring->cq_head = (u32 *)(ring->cq_memory + params.cq_off.head);
+    ring->cq_tail = (u32 *)(ring->cq_memory + params.cq_off.tail);
+    ring->cqes = (io_uring_cqe *)(ring->cq_memory + params.cq_off.cqes);
+    ring->cq_mask = *(u32 *)(ring->cq_memory + params.cq_off.ring_mask);
+    ring->tail = *ring->sq_tail;
+
+    // One empty file slot per request, the opens fill them
+    int files[IO_MAX_REQUESTS];
+    memset(files, 0xFF, sizeof(files));
+    if (uring_register(ring->fd, IORING_REGISTER_FILES, files, IO_MAX_REQUESTS) < 0)
+    {
+        close_uring(ring);
+        return false;
+    }
+    return true;
+}
+
+
+// NULL when the ring is full
+internal io_uring_sqe *next_sqe(IoRing *ring, u32 slot, IoStep step)
+{
+    u32 head = __atomic_load_n(ring->sq_head, __ATOMIC_ACQUIRE);
+    if (ring->tail - head >= ring->sq_entries)
+    {
+        return NULL;
+    }
+
+    u32 index = ring->tail & ring->sq_mask;
+    io_uring_sqe *sqe = &ring->sqes[index];
+    memset(sqe, 0, sizeof(*sqe));
+    sqe->user_data = ((u64)slot << 2) | step;
+    ring->sq_array[index] = index;
+    ++ring->tail;
+    ++ring->unsubmitted;
+    return sqe;
+}
+
+
+internal u32 sq_space(IoRing *ring)
+{
+    return ring->sq_entries - (ring->tail - __atomic_load_n(ring->sq_head, __ATOMIC_ACQUIRE));
+}
+
+
+// Open into the slot's file, read, close, each after the other. The read
+// is hard linked to the close so a short read (any file smaller than the
+// buffer) still closes; a failed open cancels both.
+internal bool queue_uring_request(FileIo *io, u32 slot)
+{
+    IoRing *ring = &io->ring;
+    IoRequest *request = &io->requests[slot];
+    if (request->operation == IO_STAT)
+    {
+        if (sq_space(ring) < 1)
+        {
+            return false;
+        }
+        io_uring_sqe *stat_sqe = next_sqe(ring, slot, IO_STEP_STAT);
+        stat_sqe->opcode = IORING_OP_STATX;
+        stat_sqe->fd = AT_FDCWD;
+        stat_sqe->addr = (u64)(umm)request->path;
+        stat_sqe->len = STATX_SIZE;
+        stat_sqe->off = (u64)(umm)&request->stat;
+        request->steps_left = 1;
+        return true;
+    }
+
+    if (sq_space(ring) < 3)
+    {
+        return false;
+    }
+
+    io_uring_sqe *open_sqe = next_sqe(ring, slot, IO_STEP_OPEN);
+    open_sqe->opcode = IORING_OP_OPENAT;
+    open_sqe->fd = AT_FDCWD;
+    open_sqe->addr = (u64)(umm)request->path;
+    open_sqe->open_flags = O_RDONLY;       // O_CLOEXEC is EINVAL into the table
+    open_sqe->file_index = slot + 1;
+    open_sqe->flags = IOSQE_IO_LINK;
+
+    u32 length = request->capacity < IO_MAX_READ ? (u32)request->capacity : IO_MAX_READ;
+    bool registered = io->registered && request->buffer >= io->registered
+                   && request->buffer + length <= io->registered + io->registered_size;
+    io_uring_sqe *read_sqe = next_sqe(ring, slot, IO_STEP_READ);
+    read_sqe->opcode = registered ? IORING_OP_READ_FIXED : IORING_OP_READ;
+    read_sqe->fd = (i32)slot;
+    read_sqe->flags = IOSQE_FIXED_FILE | IOSQE_IO_HARDLINK;
+    read_sqe->addr = (u64)(umm)request->buffer;
+    read_sqe->len = length;
+    read_sqe->off = 0;
+    read_sqe->buf_index = 0;
+
+    io_uring_sqe *close_sqe = next_sqe(ring, slot, IO_STEP_CLOSE);
+    close_sqe->opcode = IORING_OP_CLOSE;
+    close_sqe->file_index = slot + 1;
+
+    request->steps_left = 3;
+    return true;
+}
+
+
+internal void reap_uring(FileIo *io)
+{
+    IoRing *ring = &io->ring;
+    u32 head = *ring->cq_head;
+    u32 tail = __atomic_load_n(ring->cq_tail, __ATOMIC_ACQUIRE);
+    for (; head != tail; ++head)
+    {
+        io_uring_cqe *cqe = &ring->cqes[head & ring->cq_mask];
+        IoRequest *request = &io->requests[cqe->user_data >> 2];
+        switch (cqe->user_data & 3)
+        {
+            case IO_STEP_OPEN:
+                request->result = cqe->res;
+                break;
+            case IO_STEP_READ:
+                // Cancelled when the open failed, keep its error
+                request->result = request->result < 0 ? request->result : cqe->res;
+                break;
+            case IO_STEP_CLOSE:
+                break;
+            case IO_STEP_STAT:
+                request->result = cqe->res < 0 ? cqe->res : (i64)request->stat.stx_size;
+                break;
+        }
+        if (--request->steps_left == 0)
+        {
+            request->state.store(IO_DONE, std::memory_order_relaxed);
+        }
+    }
+    __atomic_store_n(ring->cq_head, head, __ATOMIC_RELEASE);
+}
+
+
+// THREADS ####################################################################
+
+
+internal void run_io_request(void *data)
+{
+    IoRequest *request = (IoRequest *)data;
+    if (request->operation == IO_STAT)
+    {
+        struct stat info;
+        request->result = stat(request->path, &info) == 0 ? (i64)info.st_size : -errno;
+        request->state.store(IO_DONE, std::memory_order_release);
+        return;
+    }
+
+    int file = open(request->path, O_RDONLY | O_CLOEXEC);
+    if (file < 0)
+    {
+        request->result = -errno;
+        request->state.store(IO_DONE, std::memory_order_release);
+        return;
+    }
+
+    i64 done = 0;
+    while ((u64)done < request->capacity)
+    {
+        u64 left = request->capacity - (u64)done;
+        ssize_t bytes = pread(file, request->buffer + done, left < IO_MAX_READ ? left : IO_MAX_READ, (off_t)done);
+        if (bytes < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        if (bytes <= 0)
+        {
+            done = bytes < 0 ? -errno : done;
+            break;
+        }
+        done += bytes;
+    }
+    close(file);
+    request->result = done;
+    request->state.store(IO_DONE, std::memory_order_release);
+}
+
+
+// API ########################################################################
+
+
+bool init_io(bool use_uring)
+{
+    FileIo *io = &file_io;
+    if (io->initialized)
+    {
+        return true;
+    }
+
+    io->backend = use_uring && init_uring(&io->ring) ? IO_BACKEND_URING : IO_BACKEND_THREADS;
+    io->jobs.pending.store(0, std::memory_order_relaxed);
+    io->initialized = true;
+    return true;
+}
+
+
+void shutdown_io()
+{
+    FileIo *io = &file_io;
+    if (!io->initialized)
+    {
+        return;
+    }
+
+    io_submit();
+    while (io->active_count > 0)
+    {
+        io_complete(true);
+    }
+    jobs_wait(&io->jobs);
+
+    if (io->backend == IO_BACKEND_URING)
+    {
+        close_uring(&io->ring);
+    }
+    io->registered = NULL;
+    io->registered_size = 0;
+    io->initialized = false;
+}
+
+
+IoBackend io_backend()
+{
+    return file_io.backend;
+}
+
+
+const char *io_backend_name(IoBackend backend)
+{
+    return backend == IO_BACKEND_URING ? "io_uring" : "threads";
+}
+
+
+void io_unregister_buffer()
+{
+    FileIo *io = &file_io;
+    if (io->registered && io->backend == IO_BACKEND_URING)
+    {
+        uring_register(io->ring.fd, IORING_UNREGISTER_BUFFERS, NULL, 0);
+    }
+    io->registered = NULL;
+    io->registered_size = 0;
+}
+
+
+bool io_register_buffer(void *memory, memory_index size)
+{
+    FileIo *io = &file_io;
+    if (!io->initialized)
+    {
+        return false;
+    }
+
+    io_unregister_buffer();
+    if (io->backend == IO_BACKEND_URING)
+    {
+        struct iovec region = {memory, size};
+        if (uring_register(io->ring.fd, IORING_REGISTER_BUFFERS, &region, 1) < 0)
+        {
+            return false;
+        }
+    }
+
+    io->registered = (u8 *)memory;
+    io->registered_size = size;
+    return true;
+}
+
+
+internal IoRequest *queue_request(IoOperation operation, const char *path, IoCallback *callback, void *user)
+{
+    FileIo *io = &file_io;
+    if (io->active_count == IO_MAX_REQUESTS || strlen(path) >= IO_MAX_PATH)
+    {
+        return NULL;
+    }
+
+    u32 slot = 0;
+    while (io->requests[slot].state.load(std::memory_order_relaxed) != IO_FREE)
+    {
+        ++slot;
+    }
+
+    IoRequest *request = &io->requests[slot];
+    request->operation = operation;
+    strcpy(request->path, path);
+    request->buffer = NULL;
+    request->capacity = 0;
+    request->callback = callback;
+    request->user = user;
+    request->result = 0;
+    request->state.store(IO_QUEUED, std::memory_order_relaxed);
+    io->active[io->active_count++] = slot;
+    return request;
+}
+
+
+// The ring takes the submissions straight away, io_submit() only tells the
+// kernel. Without room they wait in the queue for the next io_submit().
+internal bool queue_ring(FileIo *io, IoRequest *request)
+{
+    if (io->backend == IO_BACKEND_URING && queue_uring_request(io, (u32)(request - io->requests)))
+    {
+        request->state.store(IO_RUNNING, std::memory_order_relaxed);
+        return true;
+    }
+    return false;
+}
+
+
+bool io_stat(const char *path, IoCallback *callback, void *user)
+{
+    IoRequest *request = queue_request(IO_STAT, path, callback, user);
+    if (request)
+    {
+        queue_ring(&file_io, request);
+    }
+    return request != NULL;
+}
+
+
+bool io_read_file(const char *path, u8 *buffer, u64 capacity, IoCallback *callback, void *user)
+{
+    IoRequest *request = queue_request(IO_READ_FILE, path, callback, user);
+    if (request)
+    {
+        request->buffer = buffer;
+        request->capacity = capacity;
+        queue_ring(&file_io, request);
+    }
+    return request != NULL;
+}
+
+
+void io_submit()
+{
+    FileIo *io = &file_io;
+    if (io->backend == IO_BACKEND_THREADS)
+    {
+        for (u32 i = 0; i < io->active_count; ++i)
+        {
+            IoRequest *request = &io->requests[io->active[i]];
+            if (request->state.load(std::memory_order_relaxed) == IO_QUEUED)
+            {
+                request->state.store(IO_RUNNING, std::memory_order_relaxed);
+                jobs_submit_background(run_io_request, request, &io->jobs);
+            }
+        }
+        return;
+    }
+
+    // Requests that found the ring full go in behind the others
+    for (u32 i = 0; i < io->active_count; ++i)
+    {
+        IoRequest *request = &io->requests[io->active[i]];
+        if (request->state.load(std::memory_order_relaxed) == IO_QUEUED && !queue_ring(io, request))
+        {
+            break;
+        }
+    }
+
+    IoRing *ring = &io->ring;
+    if (ring->unsubmitted > 0)
+    {
+        __atomic_store_n(ring->sq_tail, ring->tail, __ATOMIC_RELEASE);
+        int submitted = uring_enter(ring->fd, ring->unsubmitted, 0, 0);
+        ring->unsubmitted -= submitted > 0 ? (u32)submitted : 0;
+    }
+}
+
+
+u32 io_complete(bool wait)
+{
+    FileIo *io = &file_io;
+    if (io->active_count == 0)
+    {
+        return 0;
+    }
+
+    u32 done[IO_MAX_REQUESTS];
+    u32 done_count = 0;
+    for (;;)
+    {
+        if (io->backend == IO_BACKEND_URING)
+        {
+            reap_uring(io);
+        }
+
+        u32 kept = 0;
+        for (u32 i = 0; i < io->active_count; ++i)
+        {
+            u32 slot = io->active[i];
+            if (io->requests[slot].state.load(std::memory_order_acquire) == IO_DONE)
+            {
+                done[done_count++] = slot;
+            }
+            else
+            {
+                io->active[kept++] = slot;
+            }
+        }
+        io->active_count = kept;
+
+        if (done_count > 0 || !wait || io->active_count == 0)
+        {
+            break;
+        }
+        // Nothing queued is left waiting on a submit that is not coming
+        io_submit();
+        if (io->backend == IO_BACKEND_URING)
+        {
+            uring_enter(io->ring.fd, 0, 1, IORING_ENTER_GETEVENTS);
+        }
+        else
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    // The slots are free before the callbacks, which may queue more
+    for (u32 i = 0; i < done_count; ++i)
+    {
+        IoRequest *request = &io->requests[done[i]];
+        IoCallback *callback = request->callback;
+        void *user = request->user;
+        u8 *buffer = request->buffer;
+        i64 result = request->result;
+        request->state.store(IO_FREE, std::memory_order_relaxed);
+        callback(user, buffer, result);
+    }
+    return done_count;
+}
+
+
+u32 io_pending()
+{
+    return file_io.active_count;
+}
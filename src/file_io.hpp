@@ -0,0 +1,77 @@
+#pragma once
+
+#include "platform.hpp"
+
+
+// Batched asynchronous file reads for the asset pipeline.
+//
+// io_stat() and io_read_file() queue a request; io_submit() hands every
+// queued one over at once; io_complete() calls the callbacks of the
+// finished ones on the calling thread, usually the GL thread once a frame.
+//
+// With io_uring a whole-file read is an open, a read and a close linked in
+// the submission ring, so one io_uring_enter() starts a batch of any size
+// and no file descriptor ever reaches user space (the opens go into a
+// table of registered files). Reads into the buffer given to
+// io_register_buffer(), typically an arena, use the pre-pinned pages
+// instead of mapping the destination for every read.
+//
+// Where io_uring is missing or forbidden (old kernels, seccomp, the
+// io_uring_disabled sysctl) the requests run as background jobs (see
+// jobs.hpp) with open, pread and close, the threads providing what
+// parallelism there is.
+
+
+#define IO_MAX_REQUESTS 256         // queued or in flight at once
+
+
+enum IoBackend
+{
+    IO_BACKEND_URING,
+    IO_BACKEND_THREADS,
+};
+
+
+// `result` is the file size for io_stat(), the bytes read for
+// io_read_file(), or a negative errno. `buffer` is the one given to
+// io_read_file(), NULL for io_stat().
+typedef void IoCallback(void *user, u8 *buffer, i64 result);
+
+
+// Falls back to the threads when io_uring does not work or when asked to.
+bool init_io(bool use_uring = true);
+
+// Waits for and completes everything in flight first.
+void shutdown_io();
+
+IoBackend io_backend();
+const char *io_backend_name(IoBackend backend);
+
+// One region, usually an arena's memory, that reads landing in it can use
+// without pinning pages every time. Only worth it for memory that stays
+// around; fails past RLIMIT_MEMLOCK or before init_io(), reads then work
+// as usual. Replaces the region registered before.
+bool io_register_buffer(void *memory, memory_index size);
+
+// Before releasing the registered memory, with no reads into it in flight.
+void io_unregister_buffer();
+
+// False when IO_MAX_REQUESTS are queued or in flight, or the path is too
+// long. `path` is copied.
+bool io_stat(const char *path, IoCallback *callback, void *user);
+
+// Reads the file from the start into `buffer`, at most `capacity` bytes.
+// A file larger than that comes back cut short, io_stat() first when the
+// size is not known.
+bool io_read_file(const char *path, u8 *buffer, u64 capacity, IoCallback *callback, void *user);
+
+// Starts what was queued since the last call. One syscall with io_uring.
+void io_submit();
+
+// Calls the callbacks of the finished requests and returns how many. With
+// `wait` it blocks until at least one finishes, if any are in flight.
+// Callbacks may queue new requests.
+u32 io_complete(bool wait = false);
+
+// Queued, in flight or finished but not completed yet.
+u32 io_pending();
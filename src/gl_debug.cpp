@@ -0,0 +1,290 @@
+#include <string.h>
+
+#include <glad/glad.h>
+
+#include "gl_debug.hpp"
+#include "log.hpp"
+
+
+// Distinct messages are logged once, repeats are only counted
+#define GL_DEBUG_SEEN_SLOTS 1024
+
+
+struct GLDebugState
+{
+    GLDebugStats stats;
+    GLDebugStats frame;
+    u64          seen[GL_DEBUG_SEEN_SLOTS];
+    u32          seen_count;
+};
+
+
+GLDebugState gl_debug = {};
+
+
+const char *gl_perf_issue_name(GLPerfIssue issue)
+{
+    switch (issue)
+    {
+        case GL_PERF_IMPLICIT_SYNC: return "implicit sync";
+        case GL_PERF_RECOMPILE:     return "recompile";
+        case GL_PERF_FALLBACK:      return "fallback path";
+        default:                    return "other";
+    }
+}
+
+
+internal const char *gl_debug_source_name(GLenum source)
+{
+    switch (source)
+    {
+        case GL_DEBUG_SOURCE_API:             return "api";
+        case GL_DEBUG_SOURCE_WINDOW_SYSTEM:   return "window system";
+        case GL_DEBUG_SOURCE_SHADER_COMPILER: return "shader compiler";
+        case GL_DEBUG_SOURCE_THIRD_PARTY:     return "third party";
+        case GL_DEBUG_SOURCE_APPLICATION:     return "application";
+        default:                              return "other";
+    }
+}
+
+
+internal const char *gl_debug_type_name(GLenum type)
+{
+    switch (type)
+    {
+        case GL_DEBUG_TYPE_ERROR:               return "error";
+        case GL_DEBUG_TYPE_DEPRECATED_BEHAVIOR: return "deprecated";
+        case GL_DEBUG_TYPE_UNDEFINED_BEHAVIOR:  return "undefined behavior";
+        case GL_DEBUG_TYPE_PORTABILITY:         return "portability";
+        case GL_DEBUG_TYPE_PERFORMANCE:         return "performance";
+        case GL_DEBUG_TYPE_MARKER:              return "marker";
+        default:                                return "other";
+    }
+}
+
+
+// Case insensitive, `needle` has to start a word: "sync" is not in
+// "asynchronous"
+internal bool contains(const char *haystack, const char *needle)
+{
+    size_t needle_len = strlen(needle);
+    for (const char *at = haystack; *at; ++at)
+    {
+        if (at > haystack && ((at[-1] | 0x20) >= 'a' && (at[-1] | 0x20) <= 'z'))
+        {
+            continue;
+        }
+        size_t i = 0;
+        while (i < needle_len
+               && at[i]
+               && (at[i] | 0x20) == (needle[i] | 0x20))
+        {
+            ++i;
+        }
+        if (i == needle_len)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+
+// Drivers do not categorize performance messages beyond the type, so the
+// text is matched against the phrasing Mesa, NVIDIA and AMD use.
+internal GLPerfIssue classify_perf_message(const char *message)
+{
+    if (contains(message, "stall")
+        || contains(message, "synchroniz")
+        || contains(message, "implicit sync")
+        || contains(message, "wait")
+        || contains(message, "busy"))
+    {
+        return GL_PERF_IMPLICIT_SYNC;
+    }
+    if (contains(message, "recompil")
+        || contains(message, "shader state")
+        || contains(message, "variant"))
+    {
+        return GL_PERF_RECOMPILE;
+    }
+    if (contains(message, "fallback")
+        || contains(message, "software")
+        || contains(message, "slow path")
+        || contains(message, "emulat")
+        || contains(message, "video memory to system"))
+    {
+        return GL_PERF_FALLBACK;
+    }
+    return GL_PERF_OTHER;
+}
+
+
+internal u64 hash_message(GLenum source, GLenum type, GLuint id, const char *message)
+{
+    u64 hash = 14695981039346656037ull;
+    u32 fields[3] = {source, type, id};
+    const u8 *bytes = (const u8 *)fields;
+    for (memory_index i = 0; i < sizeof(fields); ++i)
+    {
+        hash = (hash ^ bytes[i]) * 1099511628211ull;
+    }
+    for (const char *c = message; *c; ++c)
+    {
+        hash = (hash ^ (u8)*c) * 1099511628211ull;
+    }
+    return hash ? hash : 1;
+}
+
+
+// Returns true the first time a message is seen
+internal bool remember_message(u64 hash)
+{
+    u32 slot = (u32)hash & (GL_DEBUG_SEEN_SLOTS - 1);
+    for (u32 probe = 0; probe < GL_DEBUG_SEEN_SLOTS; ++probe)
+    {
+        u64 *entry = &gl_debug.seen[(slot + probe) & (GL_DEBUG_SEEN_SLOTS - 1)];
+        if (*entry == hash)
+        {
+            return false;
+        }
+        if (*entry == 0)
+        {
+            if (gl_debug.seen_count >= GL_DEBUG_SEEN_SLOTS / 2)
+            {
+                return true;
+            }
+            *entry = hash;
+            ++gl_debug.seen_count;
+            return true;
+        }
+    }
+    return true;
+}
+
+
+// Output is synchronous, so this runs on the GL thread inside the offending
+// call and needs no locking.
+internal void APIENTRY gl_debug_callback(GLenum source,
+                                         GLenum type,
+                                         GLuint id,
+                                         GLenum severity,
+                                         GLsizei length,
+                                         const GLchar *message,
+                                         const void *user)
+{
+    (void)length;
+    (void)user;
+
+    if (severity == GL_DEBUG_SEVERITY_NOTIFICATION
+        || type == GL_DEBUG_TYPE_PUSH_GROUP
+        || type == GL_DEBUG_TYPE_POP_GROUP)
+    {
+        return;
+    }
+
+    ++gl_debug.frame.frame_messages;
+    if (type == GL_DEBUG_TYPE_ERROR)
+    {
+        ++gl_debug.frame.frame_errors;
+    }
+
+    GLPerfIssue issue = GL_PERF_OTHER;
+    if (type == GL_DEBUG_TYPE_PERFORMANCE)
+    {
+        issue = classify_perf_message(message);
+        ++gl_debug.frame.frame_performance;
+        ++gl_debug.frame.frame_perf_issues[issue];
+    }
+
+    if (!remember_message(hash_message(source, type, id, message)))
+    {
+        ++gl_debug.stats.duplicates;
+        return;
+    }
+
+    bool is_error = type == GL_DEBUG_TYPE_ERROR || severity == GL_DEBUG_SEVERITY_HIGH;
+    if (type == GL_DEBUG_TYPE_PERFORMANCE)
+    {
+        log_warn("GL performance (%s, %s) [%u]: %s\n",
+                 gl_perf_issue_name(issue),
+                 gl_debug_source_name(source),
+                 id,
+                 message);
+    }
+    else if (is_error)
+    {
+        log_error("GL %s (%s) [%u]: %s\n",
+                  gl_debug_type_name(type),
+                  gl_debug_source_name(source),
+                  id,
+                  message);
+    }
+    else
+    {
+        log_warn("GL %s (%s) [%u]: %s\n",
+                 gl_debug_type_name(type),
+                 gl_debug_source_name(source),
+                 id,
+                 message);
+    }
+}
+
+
+bool init_gl_debug()
+{
+    GLint flags = 0;
+    glGetIntegerv(GL_CONTEXT_FLAGS, &flags);
+    if (!(flags & GL_CONTEXT_FLAG_DEBUG_BIT))
+    {
+        return false;
+    }
+
+    if (GLAD_GL_KHR_debug && glDebugMessageCallback)
+    {
+        glEnable(GL_DEBUG_OUTPUT);
+        glEnable(GL_DEBUG_OUTPUT_SYNCHRONOUS);
+        glDebugMessageCallback(gl_debug_callback, NULL);
+        glDebugMessageControl(GL_DONT_CARE, GL_DONT_CARE, GL_DONT_CARE,
+                              0, NULL, GL_TRUE);
+        return true;
+    }
+
+    if (GLAD_GL_ARB_debug_output && glDebugMessageCallbackARB)
+    {
+        glEnable(GL_DEBUG_OUTPUT_SYNCHRONOUS_ARB);
+        glDebugMessageCallbackARB(gl_debug_callback, NULL);
+        glDebugMessageControlARB(GL_DONT_CARE, GL_DONT_CARE, GL_DONT_CARE,
+                                 0, NULL, GL_TRUE);
+        return true;
+    }
+
+    return false;
+}
+
+
+void gl_debug_end_frame()
+{
+    GLDebugStats *stats = &gl_debug.stats;
+    GLDebugStats *frame = &gl_debug.frame;
+
+    stats->frame_messages = frame->frame_messages;
+    stats->frame_errors = frame->frame_errors;
+    stats->frame_performance = frame->frame_performance;
+    stats->total_messages += frame->frame_messages;
+    stats->total_errors += frame->frame_errors;
+    stats->total_performance += frame->frame_performance;
+    for (u32 i = 0; i < GL_PERF_ISSUE_COUNT; ++i)
+    {
+        stats->frame_perf_issues[i] = frame->frame_perf_issues[i];
+        stats->total_perf_issues[i] += frame->frame_perf_issues[i];
+    }
+
+    *frame = {};
+}
+
+
+const GLDebugStats *gl_debug_stats()
+{
+    return &gl_debug.stats;
+}
@@ -0,0 +1,42 @@
+#pragma once
+
+#include "platform.hpp"
+
+
+enum GLPerfIssue
+{
+    GL_PERF_IMPLICIT_SYNC,
+    GL_PERF_RECOMPILE,
+    GL_PERF_FALLBACK,
+    GL_PERF_OTHER,
+    GL_PERF_ISSUE_COUNT
+};
+
+
+struct GLDebugStats
+{
+    // Counts for the last completed frame
+    u32 frame_messages;
+    u32 frame_errors;
+    u32 frame_performance;
+    u32 frame_perf_issues[GL_PERF_ISSUE_COUNT];
+
+    u64 total_messages;
+    u64 total_errors;
+    u64 total_performance;
+    u64 total_perf_issues[GL_PERF_ISSUE_COUNT];
+    u64 duplicates;
+};
+
+
+// Installs the debug message callback if the context has debug output.
+// Returns false when no debug output is available, which is expected for
+// release (no-error) contexts.
+bool init_gl_debug();
+
+// Closes the per-frame message counts, call once after swapping.
+void gl_debug_end_frame();
+
+const GLDebugStats *gl_debug_stats();
+
+const char *gl_perf_issue_name(GLPerfIssue issue);
@@ -0,0 +1,143 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include <glad/glad.h>
+
+#include "gl_extensions.hpp"
+
+
+struct GLExtensionSlot
+{
+    u32 hash;
+    u32 offset;                 // + 1 into names, 0 marks an empty slot
+};
+
+
+struct GLExtensions
+{
+    void            *block;
+    GLExtensionSlot *slots;
+    char            *names;
+    u32              mask;
+    u32              names_used;
+    u32              count;
+};
+
+
+global_variable GLExtensions gl_extensions = {};
+
+
+internal u32 hash_extension(const char *name, memory_index length)
+{
+    u32 hash = 2166136261u;
+    for (memory_index i = 0; i < length; ++i)
+    {
+        hash ^= (u8)name[i];
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+
+internal void add_extension(const char *name, memory_index length)
+{
+    u32 hash = hash_extension(name, length);
+    u32 index = hash & gl_extensions.mask;
+    while (gl_extensions.slots[index].offset != 0)
+    {
+        const char *existing = gl_extensions.names + gl_extensions.slots[index].offset - 1;
+        if (gl_extensions.slots[index].hash == hash && strncmp(existing, name, length) == 0
+            && existing[length] == '\0')
+        {
+            return;
+        }
+        index = (index + 1) & gl_extensions.mask;
+    }
+
+    memcpy(gl_extensions.names + gl_extensions.names_used, name, length);
+    gl_extensions.names[gl_extensions.names_used + length] = '\0';
+    gl_extensions.slots[index].hash = hash;
+    gl_extensions.slots[index].offset = gl_extensions.names_used + 1;
+    gl_extensions.names_used += (u32)length + 1;
+    ++gl_extensions.count;
+}
+
+
+bool init_gl_extensions()
+{
+    shutdown_gl_extensions();
+
+    GLint count = 0;
+    glGetIntegerv(GL_NUM_EXTENSIONS, &count);
+    count = count > 0 ? count : 0;
+
+    memory_index names_size = 0;
+    for (GLint i = 0; i < count; ++i)
+    {
+        const char *name = (const char *)glGetStringi(GL_EXTENSIONS, (GLuint)i);
+        names_size += name ? strlen(name) + 1 : 0;
+    }
+
+    // At most half full
+    u32 slot_count = 16;
+    while (slot_count < (u32)count * 2)
+    {
+        slot_count <<= 1;
+    }
+
+    gl_extensions.block = malloc(slot_count * sizeof(GLExtensionSlot) + names_size);
+    if (gl_extensions.block == NULL)
+    {
+        return false;
+    }
+    gl_extensions.slots = (GLExtensionSlot *)gl_extensions.block;
+    gl_extensions.names = (char *)(gl_extensions.slots + slot_count);
+    gl_extensions.mask = slot_count - 1;
+    memset(gl_extensions.slots, 0, slot_count * sizeof(GLExtensionSlot));
+
+    for (GLint i = 0; i < count; ++i)
+    {
+        const char *name = (const char *)glGetStringi(GL_EXTENSIONS, (GLuint)i);
+        if (name)
+        {
+            add_extension(name, strlen(name));
+        }
+    }
+    return true;
+}
+
+
+void shutdown_gl_extensions()
+{
+    free(gl_extensions.block);
+    gl_extensions = {};
+}
+
+
+bool gl_has_extension(const char *name)
+{
+    if (gl_extensions.slots == NULL || name == NULL)
+    {
+        return false;
+    }
+
+    memory_index length = strlen(name);
+    u32 hash = hash_extension(name, length);
+    u32 index = hash & gl_extensions.mask;
+    while (gl_extensions.slots[index].offset != 0)
+    {
+        if (gl_extensions.slots[index].hash == hash
+            && strcmp(gl_extensions.names + gl_extensions.slots[index].offset - 1, name) == 0)
+        {
+            return true;
+        }
+        index = (index + 1) & gl_extensions.mask;
+    }
+    return false;
+}
+
+
+u32 gl_extension_count()
+{
+    return gl_extensions.count;
+}
@@ -0,0 +1,18 @@
+#pragma once
+
+#include "platform.hpp"
+
+
+// Every extension the context reports, interned into one allocation: an
+// open addressed table of FNV-1a hashes and offsets, then the names. glad
+// only keeps GLAD_GL_* flags for the extensions it was generated with (see
+// the command line in glad.h), this answers for any name, in O(1).
+
+
+// Call after gladLoadGL(), on the GL thread. Returns false when the list
+// cannot be read or allocated.
+bool init_gl_extensions();
+void shutdown_gl_extensions();
+
+bool gl_has_extension(const char *name);
+u32 gl_extension_count();
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <glad/glad.h>
+
+#include "platform.hpp"
+#include "cooked_mesh.hpp"
+#include "vertex_format.hpp"
+
+
+// Vertex attribute pointers from a CookedMeshAttribute table, the layouts
+// in vertex_format.hpp or a .cmesh header. They need the VAO and the vertex
+// buffer bound.
+//
+// A table rather than templates over the vertex struct: a streamed mesh's
+// layout is only known once its header is read, so that path needs the
+// table anyway. OBJs go through the same one, so what the cooker writes
+// and what the loader binds cannot drift apart.
+
+
+// Skips attributes with a format cooked_attribute_size() does not know,
+// validate_cooked_mesh() rejects those anyway
+inline void bind_vertex_attributes(const CookedMeshAttribute *attributes, u32 attribute_count, u32 stride)
+{
+    // By CookedAttributeFormat, the integer formats read normalized
+    local_persist const GLenum types[COOKED_ATTRIBUTE_FORMAT_COUNT] =
+    {
+        GL_FLOAT, GL_HALF_FLOAT, GL_UNSIGNED_SHORT, GL_INT_2_10_10_10_REV,
+    };
+
+    for (u32 i = 0; i < attribute_count; ++i)
+    {
+        const CookedMeshAttribute *attribute = &attributes[i];
+        if (attribute->format >= COOKED_ATTRIBUTE_FORMAT_COUNT
+            || cooked_attribute_size((CookedAttributeFormat)attribute->format, attribute->components) == 0)
+        {
+            continue;
+        }
+
+        GLenum type = types[attribute->format];
+        GLboolean normalized = type == GL_FLOAT || type == GL_HALF_FLOAT ? GL_FALSE : GL_TRUE;
+        glVertexAttribPointer(attribute->location, attribute->components, type, normalized,
+                              stride, (void *)(umm)attribute->offset);
+        glEnableVertexAttribArray(attribute->location);
+    }
+}
+
+
+inline void bind_vertex_format(VertexFormat format)
+{
+    u32 count;
+    const CookedMeshAttribute *attributes = vertex_format_attributes(format, &count);
+    bind_vertex_attributes(attributes, count, vertex_format_stride(format));
+}
+
+
+inline void bind_cooked_attributes(const CookedMeshHeader *header)
+{
+    bind_vertex_attributes(header->attributes, header->attribute_count, header->vertex_stride);
+}
@@ -0,0 +1,224 @@
+#include <errno.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "memory_tracking.hpp"
+
+
+// Replaces the glibc malloc family (see "Replacing malloc" in the glibc
+// manual) so every heap allocation in the process, including operator new
+// and library code, is charged to the calling thread's memory tag. Each
+// block carries a 16 byte header in front of the user pointer with the
+// size, tag and offset back to the underlying glibc block.
+
+
+extern "C"
+{
+void *__libc_malloc(size_t size);
+void *__libc_calloc(size_t count, size_t size);
+void *__libc_realloc(void *memory, size_t size);
+void *__libc_memalign(size_t alignment, size_t size);
+void __libc_free(void *memory);
+}
+
+
+extern const bool memory_heap_hooks_linked = true;
+
+
+#define HEAP_HEADER_SIZE 16
+#define HEAP_MAGIC       0x4850
+
+
+struct HeapHeader
+{
+    u64 size;
+    u32 offset;     // from the glibc block to the user pointer
+    u8  tag;
+    u8  pad;
+    u16 magic;
+};
+
+
+static_assert(sizeof(HeapHeader) == HEAP_HEADER_SIZE, "heap header size");
+
+
+inline HeapHeader *get_heap_header(void *memory)
+{
+    HeapHeader *header = (HeapHeader *)((u8 *)memory - HEAP_HEADER_SIZE);
+    assert(header->magic == HEAP_MAGIC);
+    return header;
+}
+
+
+inline void *track_block(void *block, size_t offset, size_t size)
+{
+    if (block == NULL)
+    {
+        return NULL;
+    }
+
+    u8 *memory = (u8 *)block + offset;
+    HeapHeader *header = (HeapHeader *)(memory - HEAP_HEADER_SIZE);
+    header->size = size;
+    header->offset = (u32)offset;
+    header->pad = 0;
+    header->magic = HEAP_MAGIC;
+    header->tag = memory_current_tag;
+    memory_record_heap_alloc(header->tag, size);
+    return memory;
+}
+
+
+inline bool size_overflows(size_t size, size_t extra)
+{
+    return size > (size_t)-1 - extra;
+}
+
+
+extern "C" void *malloc(size_t size)
+{
+    if (size_overflows(size, HEAP_HEADER_SIZE))
+    {
+        errno = ENOMEM;
+        return NULL;
+    }
+    return track_block(__libc_malloc(size + HEAP_HEADER_SIZE), HEAP_HEADER_SIZE, size);
+}
+
+
+extern "C" void free(void *memory)
+{
+    if (memory == NULL)
+    {
+        return;
+    }
+
+    HeapHeader *header = get_heap_header(memory);
+    memory_record_heap_free(header->tag, header->size);
+    __libc_free((u8 *)memory - header->offset);
+}
+
+
+extern "C" void *calloc(size_t count, size_t size)
+{
+    if (size && count > (size_t)-1 / size)
+    {
+        errno = ENOMEM;
+        return NULL;
+    }
+
+    size_t total = count * size;
+    if (size_overflows(total, HEAP_HEADER_SIZE))
+    {
+        errno = ENOMEM;
+        return NULL;
+    }
+    return track_block(__libc_calloc(1, total + HEAP_HEADER_SIZE), HEAP_HEADER_SIZE, total);
+}
+
+
+extern "C" void *memalign(size_t alignment, size_t size)
+{
+    if (alignment <= HEAP_HEADER_SIZE)
+    {
+        return malloc(size);
+    }
+    if (alignment & (alignment - 1))
+    {
+        errno = EINVAL;
+        return NULL;
+    }
+    if (size_overflows(size, alignment))
+    {
+        errno = ENOMEM;
+        return NULL;
+    }
+
+    // The header fits in the padding in front of the aligned pointer
+    return track_block(__libc_memalign(alignment, size + alignment), alignment, size);
+}
+
+
+extern "C" void *realloc(void *memory, size_t size)
+{
+    if (memory == NULL)
+    {
+        return malloc(size);
+    }
+    if (size == 0)
+    {
+        free(memory);
+        return NULL;
+    }
+
+    HeapHeader *header = get_heap_header(memory);
+    if (header->offset != HEAP_HEADER_SIZE)
+    {
+        // Over-aligned block, realloc would lose the alignment
+        void *result = memalign(header->offset, size);
+        if (result)
+        {
+            memcpy(result, memory, header->size < size ? header->size : size);
+            free(memory);
+        }
+        return result;
+    }
+    if (size_overflows(size, HEAP_HEADER_SIZE))
+    {
+        errno = ENOMEM;
+        return NULL;
+    }
+
+    u8 tag = header->tag;
+    u64 old_size = header->size;
+    void *block = __libc_realloc((u8 *)memory - HEAP_HEADER_SIZE, size + HEAP_HEADER_SIZE);
+    if (block == NULL)
+    {
+        return NULL;
+    }
+
+    memory_record_heap_free(tag, old_size);
+    return track_block(block, HEAP_HEADER_SIZE, size);
+}
+
+
+extern "C" int posix_memalign(void **result, size_t alignment, size_t size)
+{
+    if (alignment < sizeof(void *) || (alignment & (alignment - 1)))
+    {
+        return EINVAL;
+    }
+
+    void *memory = memalign(alignment, size);
+    if (memory == NULL)
+    {
+        return ENOMEM;
+    }
+    *result = memory;
+    return 0;
+}
+
+
+extern "C" void *aligned_alloc(size_t alignment, size_t size)
+{
+    return memalign(alignment, size);
+}
+
+
+extern "C" void *valloc(size_t size)
+{
+    return memalign((size_t)sysconf(_SC_PAGESIZE), size);
+}
+
+
+extern "C" void *pvalloc(size_t size)
+{
+    size_t page = (size_t)sysconf(_SC_PAGESIZE);
+    return memalign(page, (size + page - 1) & ~(page - 1));
+}
+
+
+extern "C" size_t malloc_usable_size(void *memory)
+{
+    return memory ? get_heap_header(memory)->size : 0;
+}
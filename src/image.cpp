@@ -0,0 +1,255 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <setjmp.h>
+
+#include <png.h>
+#include <jpeglib.h>
+
+#include "image.hpp"
+
+
+bool read_entire_file(const char *path, u8 **data, memory_index *size)
+{
+    FILE *file = fopen(path, "rb");
+    if (file == NULL)
+    {
+        return false;
+    }
+
+    bool ok = false;
+    long length = 0;
+    if (fseek(file, 0, SEEK_END) == 0 && (length = ftell(file)) >= 0 && fseek(file, 0, SEEK_SET) == 0)
+    {
+        *data = (u8 *)malloc(length > 0 ? (size_t)length : 1);
+        if (*data && fread(*data, 1, (size_t)length, file) == (size_t)length)
+        {
+            *size = (memory_index)length;
+            ok = true;
+        }
+        else
+        {
+            free(*data);
+            *data = NULL;
+        }
+    }
+
+    fclose(file);
+    return ok;
+}
+
+
+// PNG ########################################################################
+
+
+internal bool decode_png(const u8 *data, memory_index size, Image *result)
+{
+    png_image png = {};
+    png.version = PNG_IMAGE_VERSION;
+    if (!png_image_begin_read_from_memory(&png, data, size))
+    {
+        return false;
+    }
+
+    png.format = PNG_FORMAT_RGBA;
+    u8 *pixels = (u8 *)malloc(PNG_IMAGE_SIZE(png));
+    if (pixels == NULL)
+    {
+        png_image_free(&png);
+        return false;
+    }
+
+    if (!png_image_finish_read(&png, NULL, pixels, 0, NULL))
+    {
+        free(pixels);
+        return false;
+    }
+
+    result->width = png.width;
+    result->height = png.height;
+    result->pixels = pixels;
+    return true;
+}
+
+
+bool encode_png(const Image *image, u8 **data, memory_index *size)
+{
+    png_image png = {};
+    png.version = PNG_IMAGE_VERSION;
+    png.width = image->width;
+    png.height = image->height;
+    png.format = PNG_FORMAT_RGBA;
+
+    png_alloc_size_t bytes = 0;
+    if (!png_image_write_to_memory(&png, NULL, &bytes, 0, image->pixels, 0, NULL))
+    {
+        return false;
+    }
+
+    *data = (u8 *)malloc(bytes);
+    if (*data == NULL || !png_image_write_to_memory(&png, *data, &bytes, 0, image->pixels, 0, NULL))
+    {
+        free(*data);
+        *data = NULL;
+        return false;
+    }
+
+    *size = bytes;
+    return true;
+}
+
+
+// JPEG #######################################################################
+
+
+// libjpeg's default error handler calls exit()
+struct JpegError
+{
+    jpeg_error_mgr manager;
+    jmp_buf        jump;
+};
+
+
+internal void jpeg_error_exit(j_common_ptr info)
+{
+    longjmp(((JpegError *)info->err)->jump, 1);
+}
+
+
+internal void jpeg_silence(j_common_ptr, int)
+{
+}
+
+
+internal bool decode_jpeg(const u8 *data, memory_index size, Image *result)
+{
+    jpeg_decompress_struct info;
+    JpegError error;
+    info.err = jpeg_std_error(&error.manager);
+    error.manager.error_exit = jpeg_error_exit;
+    error.manager.emit_message = jpeg_silence;
+
+    // volatile, it is read after a longjmp
+    u8 *volatile pixels = NULL;
+    if (setjmp(error.jump))
+    {
+        jpeg_destroy_decompress(&info);
+        free(pixels);
+        return false;
+    }
+
+    jpeg_create_decompress(&info);
+    jpeg_mem_src(&info, data, (unsigned long)size);
+    jpeg_read_header(&info, TRUE);
+    info.out_color_space = JCS_EXT_RGBA;
+    jpeg_start_decompress(&info);
+
+    memory_index stride = (memory_index)info.output_width * 4;
+    pixels = (u8 *)malloc(stride * info.output_height);
+    if (pixels == NULL)
+    {
+        jpeg_destroy_decompress(&info);
+        return false;
+    }
+
+    while (info.output_scanline < info.output_height)
+    {
+        JSAMPROW rows[4];
+        for (u32 i = 0; i < 4; ++i)
+        {
+            rows[i] = pixels + (info.output_scanline + i) * stride;
+        }
+        u32 remaining = info.output_height - info.output_scanline;
+        jpeg_read_scanlines(&info, rows, remaining < 4 ? remaining : 4);
+    }
+
+    jpeg_finish_decompress(&info);
+    result->width = info.output_width;
+    result->height = info.output_height;
+    result->pixels = pixels;
+    jpeg_destroy_decompress(&info);
+    return true;
+}
+
+
+bool encode_jpeg(const Image *image, int quality, u8 **data, memory_index *size)
+{
+    jpeg_compress_struct info;
+    JpegError error;
+    info.err = jpeg_std_error(&error.manager);
+    error.manager.error_exit = jpeg_error_exit;
+    error.manager.emit_message = jpeg_silence;
+
+    unsigned char *output = NULL;
+    unsigned long output_size = 0;
+    if (setjmp(error.jump))
+    {
+        jpeg_destroy_compress(&info);
+        free(output);
+        return false;
+    }
+
+    jpeg_create_compress(&info);
+    jpeg_mem_dest(&info, &output, &output_size);
+    info.image_width = image->width;
+    info.image_height = image->height;
+    info.input_components = 4;
+    info.in_color_space = JCS_EXT_RGBA;
+    jpeg_set_defaults(&info);
+    jpeg_set_quality(&info, quality, TRUE);
+    jpeg_start_compress(&info, TRUE);
+
+    memory_index stride = (memory_index)image->width * 4;
+    while (info.next_scanline < info.image_height)
+    {
+        JSAMPROW row = image->pixels + info.next_scanline * stride;
+        jpeg_write_scanlines(&info, &row, 1);
+    }
+
+    jpeg_finish_compress(&info);
+    jpeg_destroy_compress(&info);
+
+    *data = output;
+    *size = output_size;
+    return true;
+}
+
+
+// ############################################################################
+
+
+bool decode_image(const u8 *data, memory_index size, Image *image)
+{
+    local_persist const u8 png_signature[] = {0x89, 'P', 'N', 'G'};
+    if (size >= 4 && memcmp(data, png_signature, 4) == 0)
+    {
+        return decode_png(data, size, image);
+    }
+    if (size >= 2 && data[0] == 0xFF && data[1] == 0xD8)
+    {
+        return decode_jpeg(data, size, image);
+    }
+    return false;
+}
+
+
+bool load_image(const char *path, Image *image)
+{
+    u8 *data;
+    memory_index size;
+    if (!read_entire_file(path, &data, &size))
+    {
+        return false;
+    }
+
+    bool ok = decode_image(data, size, image);
+    free(data);
+    return ok;
+}
+
+
+void free_image(Image *image)
+{
+    free(image->pixels);
+    image->pixels = NULL;
+}
@@ -0,0 +1,31 @@
+#pragma once
+
+#include "platform.hpp"
+
+
+// PNG and JPEG decoding to 8 bit RGBA, top row first, through libpng and
+// libjpeg(-turbo). Safe to call from any thread. Pixels are malloc'd, free
+// them with free_image().
+
+
+struct Image
+{
+    u32  width;
+    u32  height;
+    u8  *pixels;    // width * height * 4 bytes
+};
+
+
+// Reads a whole file into a malloc'd buffer.
+bool read_entire_file(const char *path, u8 **data, memory_index *size);
+
+// Picks the format from the signature bytes.
+bool decode_image(const u8 *data, memory_index size, Image *image);
+
+bool load_image(const char *path, Image *image);
+
+void free_image(Image *image);
+
+// For test data and tools. The output is malloc'd.
+bool encode_png(const Image *image, u8 **data, memory_index *size);
+bool encode_jpeg(const Image *image, int quality, u8 **data, memory_index *size);
@@ -0,0 +1,151 @@
+#include <immintrin.h>
+
+#include "image_filter.hpp"
+
+
+// The row kernels average the pixel pairs of a source row pair into one
+// destination row. A pair's sum is (top left + bottom left) + (top right +
+// bottom right) everywhere, the SIMD variants add the rows first and then
+// the columns, so the scalar one does too.
+
+
+// Scalar ######################################################################
+
+
+// From destination pixel `first` on, clamping columns for 1 pixel wide rows
+internal void downsample_row_from(const f32 *top, const f32 *bottom, u32 width,
+                                  f32 *destination, u32 next_width, u32 first)
+{
+    for (u32 x = first; x < next_width; ++x)
+    {
+        u32 x0 = x * 2 < width ? x * 2 : width - 1;
+        u32 x1 = x * 2 + 1 < width ? x * 2 + 1 : width - 1;
+        for (u32 c = 0; c < 4; ++c)
+        {
+            f32 left = top[x0 * 4 + c] + bottom[x0 * 4 + c];
+            f32 right = top[x1 * 4 + c] + bottom[x1 * 4 + c];
+            destination[x * 4 + c] = (left + right) * 0.25f;
+        }
+    }
+}
+
+
+internal void downsample_row_scalar(const f32 *top, const f32 *bottom, u32 width,
+                                    f32 *destination, u32 next_width)
+{
+    downsample_row_from(top, bottom, width, destination, next_width, 0);
+}
+
+
+// SSE2 ########################################################################
+
+
+internal void downsample_row_sse2(const f32 *top, const f32 *bottom, u32 width,
+                                  f32 *destination, u32 next_width)
+{
+    __m128 quarter = _mm_set1_ps(0.25f);
+    u32 x = 0;
+    for (; width > 1 && x < next_width; ++x)
+    {
+        __m128 left = _mm_add_ps(_mm_loadu_ps(top + x * 8), _mm_loadu_ps(bottom + x * 8));
+        __m128 right = _mm_add_ps(_mm_loadu_ps(top + x * 8 + 4), _mm_loadu_ps(bottom + x * 8 + 4));
+        _mm_storeu_ps(destination + x * 4, _mm_mul_ps(_mm_add_ps(left, right), quarter));
+    }
+    downsample_row_from(top, bottom, width, destination, next_width, x);
+}
+
+
+// AVX2 ########################################################################
+
+
+TARGET_AVX2
+internal void downsample_row_avx2(const f32 *top, const f32 *bottom, u32 width,
+                                  f32 *destination, u32 next_width)
+{
+    __m256 quarter = _mm256_set1_ps(0.25f);
+    u32 x = 0;
+    for (; width > 1 && x + 2 <= next_width; x += 2)
+    {
+        // Source pixels 0 1 and 2 3 of the four, rows added
+        __m256 low = _mm256_add_ps(_mm256_loadu_ps(top + x * 8), _mm256_loadu_ps(bottom + x * 8));
+        __m256 high = _mm256_add_ps(_mm256_loadu_ps(top + x * 8 + 8), _mm256_loadu_ps(bottom + x * 8 + 8));
+        __m256 left = _mm256_permute2f128_ps(low, high, 0x20);
+        __m256 right = _mm256_permute2f128_ps(low, high, 0x31);
+        _mm256_storeu_ps(destination + x * 4, _mm256_mul_ps(_mm256_add_ps(left, right), quarter));
+    }
+    downsample_row_from(top, bottom, width, destination, next_width, x);
+}
+
+
+// AVX-512 #####################################################################
+
+
+TARGET_AVX512
+internal void downsample_row_avx512(const f32 *top, const f32 *bottom, u32 width,
+                                    f32 *destination, u32 next_width)
+{
+    __m512 quarter = _mm512_set1_ps(0.25f);
+    u32 x = 0;
+    for (; width > 1 && x + 4 <= next_width; x += 4)
+    {
+        // Source pixels 0-3 and 4-7 of the eight, rows added
+        __m512 low = _mm512_add_ps(_mm512_loadu_ps(top + x * 8), _mm512_loadu_ps(bottom + x * 8));
+        __m512 high = _mm512_add_ps(_mm512_loadu_ps(top + x * 8 + 16), _mm512_loadu_ps(bottom + x * 8 + 16));
+        __m512 left = _mm512_shuffle_f32x4(low, high, _MM_SHUFFLE(2, 0, 2, 0));
+        __m512 right = _mm512_shuffle_f32x4(low, high, _MM_SHUFFLE(3, 1, 3, 1));
+        _mm512_storeu_ps(destination + x * 4, _mm512_mul_ps(_mm512_add_ps(left, right), quarter));
+    }
+    downsample_row_from(top, bottom, width, destination, next_width, x);
+}
+
+
+// Dispatch ####################################################################
+
+
+struct ImageFilterKernels
+{
+    CpuIsa isa;
+    void (*downsample_row)(const f32 *, const f32 *, u32, f32 *, u32);
+};
+
+
+global_variable const ImageFilterKernels image_filter_kernel_table[CPU_ISA_COUNT] =
+{
+    {CPU_ISA_SCALAR, downsample_row_scalar},
+    {CPU_ISA_SSE2, downsample_row_sse2},
+    {CPU_ISA_AVX2, downsample_row_avx2},
+    {CPU_ISA_AVX512, downsample_row_avx512},
+};
+
+
+global_variable ImageFilterKernels image_filter_kernels = image_filter_kernel_table[CPU_ISA_SSE2];
+
+
+bool select_image_filter_kernels(CpuIsa isa)
+{
+    if (!cpu_isa_supported(isa))
+    {
+        return false;
+    }
+    image_filter_kernels = image_filter_kernel_table[isa];
+    return true;
+}
+
+
+CpuIsa image_filter_kernels_isa()
+{
+    return image_filter_kernels.isa;
+}
+
+
+void downsample_rgba(const f32 *source, u32 width, u32 height,
+                     f32 *destination, u32 next_width, u32 next_height)
+{
+    for (u32 y = 0; y < next_height; ++y)
+    {
+        u32 y0 = y * 2 < height ? y * 2 : height - 1;
+        u32 y1 = y * 2 + 1 < height ? y * 2 + 1 : height - 1;
+        image_filter_kernels.downsample_row(source + (u64)y0 * width * 4, source + (u64)y1 * width * 4, width,
+                                            destination + (u64)y * next_width * 4, next_width);
+    }
+}
@@ -0,0 +1,20 @@
+#pragma once
+
+#include "platform.hpp"
+#include "cpu.hpp"
+
+
+// Filters over float RGBA images, 16 bytes a pixel, rows top to bottom with
+// no padding. The kernels do 1 (SSE2), 2 (AVX2) or 4 (AVX-512) output
+// pixels at once and add in the same order, so every variant gives the same
+// bits and a cooked texture does not depend on the machine that cooked it.
+
+
+// Like select_math_kernels(), SSE2 until called.
+bool select_image_filter_kernels(CpuIsa isa);
+CpuIsa image_filter_kernels_isa();
+
+// 2x2 box filter into next_width x next_height, half the size rounded down
+// and at least 1. A side of 1 repeats its only row or column.
+void downsample_rgba(const f32 *source, u32 width, u32 height,
+                     f32 *destination, u32 next_width, u32 next_height);
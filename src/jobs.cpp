@@ -0,0 +1,295 @@
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+#include "jobs.hpp"
+
+
+struct Job
+{
+    JobFunction *function;
+    void        *data;
+    JobCounter  *counter;
+    Job         *next;
+};
+
+
+// Oldest first, under the lock
+struct JobQueue
+{
+    std::condition_variable wake;
+    Job                    *first;
+    Job                    *last;
+};
+
+
+struct Jobs
+{
+    std::mutex              lock;
+    MemoryPool              pool;       // under the lock
+    JobQueue                queue;
+    JobQueue                background;
+    bool                    running;
+    std::thread             workers[JOBS_MAX_WORKERS];
+    u32                     worker_count;
+    std::thread             background_workers[JOBS_BACKGROUND_WORKERS];
+};
+
+
+global_variable Jobs jobs_state;
+
+
+internal void run_job(Job job)
+{
+    job.function(job.data);
+    job.counter->pending.fetch_sub(1, std::memory_order_release);
+}
+
+
+// Copies the oldest job out and frees it, needs the lock
+internal void pop_job(JobQueue *queue, Job *job)
+{
+    Job *first = queue->first;
+    *job = *first;
+    queue->first = first->next;
+    if (queue->first == NULL)
+    {
+        queue->last = NULL;
+    }
+    pool_free(&jobs_state.pool, first);
+}
+
+
+internal bool try_pop_job(Job *job)
+{
+    JobQueue *queue = &jobs_state.queue;
+    std::lock_guard<std::mutex> guard(jobs_state.lock);
+    if (queue->first == NULL)
+    {
+        return false;
+    }
+    pop_job(queue, job);
+    return true;
+}
+
+
+// Drains the queue before exiting, so nothing submitted gets lost
+internal void job_worker(JobQueue *queue)
+{
+    for (;;)
+    {
+        Job job;
+        {
+            std::unique_lock<std::mutex> guard(jobs_state.lock);
+            queue->wake.wait(guard, [queue]
+            {
+                return !jobs_state.running || queue->first != NULL;
+            });
+            if (queue->first == NULL)
+            {
+                return;
+            }
+            pop_job(queue, &job);
+        }
+        run_job(job);
+    }
+}
+
+
+// False when there is nobody to run it or no memory, the caller runs it
+internal bool push_job(JobQueue *queue, Job job)
+{
+    std::unique_lock<std::mutex> guard(jobs_state.lock);
+    Job *queued = jobs_state.running ? pool_alloc_struct(&jobs_state.pool, Job) : NULL;
+    if (queued == NULL)
+    {
+        return false;
+    }
+    *queued = job;
+    if (queue->last)
+    {
+        queue->last->next = queued;
+    }
+    else
+    {
+        queue->first = queued;
+    }
+    queue->last = queued;
+    guard.unlock();
+    queue->wake.notify_one();
+    return true;
+}
+
+
+bool init_jobs(u32 worker_count)
+{
+    if (jobs_state.running)
+    {
+        return true;
+    }
+
+    if (worker_count == 0)
+    {
+        u32 cores = std::thread::hardware_concurrency();
+        worker_count = cores > 1 ? cores - 1 : 0;
+    }
+    worker_count = worker_count > JOBS_MAX_WORKERS ? JOBS_MAX_WORKERS : worker_count;
+
+    init_pool_for(&jobs_state.pool, Job, JOBS_POOL_BLOCK);
+    jobs_state.queue.first = NULL;
+    jobs_state.queue.last = NULL;
+    jobs_state.background.first = NULL;
+    jobs_state.background.last = NULL;
+    jobs_state.running = true;
+    jobs_state.worker_count = worker_count;
+    for (u32 i = 0; i < worker_count; ++i)
+    {
+        jobs_state.workers[i] = std::thread(job_worker, &jobs_state.queue);
+    }
+    for (u32 i = 0; i < JOBS_BACKGROUND_WORKERS; ++i)
+    {
+        jobs_state.background_workers[i] = std::thread(job_worker, &jobs_state.background);
+    }
+    return true;
+}
+
+
+void shutdown_jobs()
+{
+    if (!jobs_state.running)
+    {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> guard(jobs_state.lock);
+        jobs_state.running = false;
+    }
+    jobs_state.queue.wake.notify_all();
+    jobs_state.background.wake.notify_all();
+
+    for (u32 i = 0; i < jobs_state.worker_count; ++i)
+    {
+        jobs_state.workers[i].join();
+    }
+    for (u32 i = 0; i < JOBS_BACKGROUND_WORKERS; ++i)
+    {
+        jobs_state.background_workers[i].join();
+    }
+    jobs_state.worker_count = 0;
+    release_pool(&jobs_state.pool);
+}
+
+
+u32 jobs_thread_count()
+{
+    return jobs_state.worker_count + 1;
+}
+
+
+MemoryPool *jobs_pool()
+{
+    return &jobs_state.pool;
+}
+
+
+void jobs_submit(JobFunction *function, void *data, JobCounter *counter)
+{
+    Job job = {function, data, counter, NULL};
+    counter->pending.fetch_add(1, std::memory_order_relaxed);
+
+    // No workers, or no memory
+    if (jobs_state.worker_count == 0 || !push_job(&jobs_state.queue, job))
+    {
+        run_job(job);
+    }
+}
+
+
+void jobs_submit_background(JobFunction *function, void *data, JobCounter *counter)
+{
+    Job job = {function, data, counter, NULL};
+    counter->pending.fetch_add(1, std::memory_order_relaxed);
+    if (!push_job(&jobs_state.background, job))
+    {
+        run_job(job);
+    }
+}
+
+
+void jobs_wait(JobCounter *counter)
+{
+    while (counter->pending.load(std::memory_order_acquire) > 0)
+    {
+        Job job;
+        if (try_pop_job(&job))
+        {
+            run_job(job);
+        }
+        else
+        {
+            std::this_thread::yield();
+        }
+    }
+}
+
+
+struct JobRange
+{
+    JobRangeFunction *function;
+    void             *data;
+    u32               count;
+    u32               batch_size;
+    std::atomic<u64>  next;
+};
+
+
+// Every thread taking part pulls batches until none are left, so a slow
+// batch does not hold up the others.
+internal void run_job_range(void *data)
+{
+    JobRange *range = (JobRange *)data;
+    for (;;)
+    {
+        u64 first = range->next.fetch_add(range->batch_size, std::memory_order_relaxed);
+        if (first >= range->count)
+        {
+            return;
+        }
+        u32 count = range->count - (u32)first;
+        range->function(range->data, (u32)first, count < range->batch_size ? count : range->batch_size);
+    }
+}
+
+
+void jobs_parallel_for(u32 count, u32 batch_size, JobRangeFunction *function, void *data)
+{
+    batch_size = batch_size ? batch_size : 1;
+    u32 batch_count = count / batch_size + (count % batch_size ? 1 : 0);
+    if (batch_count <= 1 || jobs_state.worker_count == 0)
+    {
+        for (u32 first = 0; first < count; first += batch_size)
+        {
+            function(data, first, count - first < batch_size ? count - first : batch_size);
+        }
+        return;
+    }
+
+    JobRange range;
+    range.function = function;
+    range.data = data;
+    range.count = count;
+    range.batch_size = batch_size;
+    range.next.store(0, std::memory_order_relaxed);
+
+    JobCounter counter;
+    counter.pending.store(0, std::memory_order_relaxed);
+
+    u32 helpers = batch_count - 1 < jobs_state.worker_count ? batch_count - 1 : jobs_state.worker_count;
+    for (u32 i = 0; i < helpers; ++i)
+    {
+        jobs_submit(run_job_range, &range, &counter);
+    }
+    run_job_range(&range);
+    jobs_wait(&counter);
+}
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <atomic>
+
+#include "platform.hpp"
+#include "pool.hpp"
+
+
+// Worker thread pool for data-parallel frame work.
+//
+// Jobs go into one queue under a lock, so they should be coarse (thousands
+// of objects each). jobs_wait() runs queued jobs on the waiting thread
+// instead of sleeping, and with no workers (one core, or before
+// init_jobs()) everything runs inline on the caller. Queued jobs live in a
+// MemoryPool that reserves JOBS_POOL_BLOCK of them at a time, freed jobs
+// are reused, so a busy frame never runs jobs inline for lack of room and
+// nothing goes to malloc.
+//
+// Background jobs (file reads, image decodes) have their own queue and
+// threads, they never hold up frame work and never run on the caller, not
+// even on one core.
+
+
+#define JOBS_MAX_WORKERS        63
+#define JOBS_BACKGROUND_WORKERS 4       // mostly blocked on reads
+#define JOBS_POOL_BLOCK         1024
+
+
+typedef void JobFunction(void *data);
+
+// Runs items [first, first + count) of a jobs_parallel_for().
+typedef void JobRangeFunction(void *data, u32 first, u32 count);
+
+
+// Counts jobs not finished yet, zero it before submitting.
+struct JobCounter
+{
+    std::atomic<u32> pending;
+};
+
+
+// 0 workers picks one per core besides the calling thread.
+bool init_jobs(u32 worker_count = 0);
+
+void shutdown_jobs();
+
+// Workers plus the calling thread.
+u32 jobs_thread_count();
+
+// Where queued jobs live, for memory tracking
+MemoryPool *jobs_pool();
+
+void jobs_submit(JobFunction *function, void *data, JobCounter *counter);
+
+// Runs on a background thread. Inline only before init_jobs() or when the
+// pool cannot reserve more jobs.
+void jobs_submit_background(JobFunction *function, void *data, JobCounter *counter);
+
+// Helps run queued frame jobs until counter's jobs are done.
+void jobs_wait(JobCounter *counter);
+
+// Splits [0, count) into batches of batch_size and runs them on every
+// thread, returns once all are done. Batches are taken in order but may
+// finish in any order.
+void jobs_parallel_for(u32 count, u32 batch_size, JobRangeFunction *function, void *data);
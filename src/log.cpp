@@ -0,0 +1,878 @@
+#include <signal.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#include "platform.hpp"
+#include "log.hpp"
+#include "memory_tracking.hpp"
+
+
+// Per-thread ring of binary records. Each record is a header followed by
+// the arguments in 8-byte slots, strings are copied inline. Formatting
+// happens on the writer thread. A thread's ring goes to the next thread
+// that logs once it exits, so there are as many as threads ever logged at
+// once.
+#define LOG_RING_SIZE   (64 * 1024)
+#define LOG_MAX_THREADS 64
+#define LOG_MAX_RECORD  2048
+#define LOG_MAX_LINE    4096
+
+
+enum LogLength
+{
+    LOG_LENGTH_NONE,
+    LOG_LENGTH_HH,
+    LOG_LENGTH_H,
+    LOG_LENGTH_L,
+    LOG_LENGTH_LL,
+    LOG_LENGTH_J,
+    LOG_LENGTH_Z,
+    LOG_LENGTH_T,
+    LOG_LENGTH_LONG_DOUBLE,
+};
+
+
+struct LogSpec
+{
+    const char *start;          // the '%'
+    const char *length_at;      // first length modifier, or the conversion
+    const char *end;            // one past the conversion
+    bool        width_star;
+    bool        precision_star;
+    LogLength   length;
+    char        conversion;
+};
+
+
+struct LogRecord
+{
+    u32         size;           // 0 marks padding up to the end of the ring
+    u32         level;
+    u64         sequence;
+    const char *fmt;
+};
+
+
+struct LogRing
+{
+    alignas(64) std::atomic<u64> head;      // owned by the logging thread
+    alignas(64) std::atomic<u64> tail;      // owned by the writer thread
+    std::atomic<u64>             dropped;
+    std::atomic<bool>            in_use;            // a thread owns it
+    u64                          reported_dropped;
+    alignas(64) u8               data[LOG_RING_SIZE];
+};
+
+
+struct Log
+{
+    std::atomic<LogRing *> rings[LOG_MAX_THREADS];
+    std::atomic<u32>       ring_count;
+    std::atomic<u64>       sequence;
+    std::atomic<u64>       dropped_no_ring;
+    std::atomic<bool>      running;
+    std::thread            writer;
+};
+
+
+// Hands the ring back when its thread exits
+struct LogRingOwner
+{
+    LogRing *ring;
+
+    ~LogRingOwner()
+    {
+        if (ring)
+        {
+            ring->in_use.store(false, std::memory_order_release);
+        }
+    }
+};
+
+
+global_variable Log log_state;
+global_variable thread_local LogRingOwner thread_log_ring;
+
+
+internal memory_index align8(memory_index size)
+{
+    return (size + 7) & ~(memory_index)7;
+}
+
+
+// Parses the conversion spec starting at `c` (just after the '%').
+internal const char *parse_spec(const char *c, LogSpec *spec)
+{
+    *spec = {};
+    spec->start = c - 1;
+
+    while (*c == '-' || *c == '+' || *c == ' ' || *c == '#' || *c == '0' || *c == '\'')
+    {
+        ++c;
+    }
+
+    if (*c == '*')
+    {
+        spec->width_star = true;
+        ++c;
+    }
+    while (*c >= '0' && *c <= '9')
+    {
+        ++c;
+    }
+
+    if (*c == '.')
+    {
+        ++c;
+        if (*c == '*')
+        {
+            spec->precision_star = true;
+            ++c;
+        }
+        while (*c >= '0' && *c <= '9')
+        {
+            ++c;
+        }
+    }
+
+    spec->length_at = c;
+    switch (*c)
+    {
+        case 'h':
+            spec->length = c[1] == 'h' ? LOG_LENGTH_HH : LOG_LENGTH_H;
+            c += c[1] == 'h' ? 2 : 1;
+            break;
+        case 'l':
+            spec->length = c[1] == 'l' ? LOG_LENGTH_LL : LOG_LENGTH_L;
+            c += c[1] == 'l' ? 2 : 1;
+            break;
+        case 'j': spec->length = LOG_LENGTH_J; ++c; break;
+        case 'z': spec->length = LOG_LENGTH_Z; ++c; break;
+        case 't': spec->length = LOG_LENGTH_T; ++c; break;
+        case 'L': spec->length = LOG_LENGTH_LONG_DOUBLE; ++c; break;
+        default: break;
+    }
+
+    spec->conversion = *c;
+    if (*c)
+    {
+        ++c;
+    }
+    spec->end = c;
+    return c;
+}
+
+
+internal bool is_signed_conversion(char conversion)
+{
+    return conversion == 'd' || conversion == 'i';
+}
+
+
+internal bool is_unsigned_conversion(char conversion)
+{
+    return conversion == 'u' || conversion == 'o' || conversion == 'x' || conversion == 'X';
+}
+
+
+internal bool is_float_conversion(char conversion)
+{
+    return conversion == 'f' || conversion == 'F'
+        || conversion == 'e' || conversion == 'E'
+        || conversion == 'g' || conversion == 'G'
+        || conversion == 'a' || conversion == 'A';
+}
+
+
+// Reads one integer argument, narrowed the way printf would narrow it.
+internal u64 read_integer(va_list *args, LogSpec *spec)
+{
+    bool is_signed = is_signed_conversion(spec->conversion);
+    switch (spec->length)
+    {
+        case LOG_LENGTH_HH:
+        {
+            int value = va_arg(*args, int);
+            return is_signed ? (u64)(i64)(signed char)value : (u64)(unsigned char)value;
+        }
+        case LOG_LENGTH_H:
+        {
+            int value = va_arg(*args, int);
+            return is_signed ? (u64)(i64)(short)value : (u64)(unsigned short)value;
+        }
+        case LOG_LENGTH_L:
+            return is_signed ? (u64)(i64)va_arg(*args, long) : (u64)va_arg(*args, unsigned long);
+        case LOG_LENGTH_LL:
+            return is_signed ? (u64)va_arg(*args, long long) : (u64)va_arg(*args, unsigned long long);
+        case LOG_LENGTH_J:
+            return (u64)va_arg(*args, intmax_t);
+        case LOG_LENGTH_Z:
+            return (u64)va_arg(*args, size_t);
+        case LOG_LENGTH_T:
+            return (u64)va_arg(*args, ptrdiff_t);
+        default:
+            return is_signed ? (u64)(i64)va_arg(*args, int) : (u64)va_arg(*args, unsigned int);
+    }
+}
+
+
+// Packs the arguments into `record`, returns the record size.
+internal u32 pack_record(u8 *record, int level, const char *fmt, va_list args)
+{
+    va_list copy;
+    va_copy(copy, args);
+
+    u8 *at = record + sizeof(LogRecord);
+    u8 *end = record + LOG_MAX_RECORD;
+    for (const char *c = fmt; *c;)
+    {
+        if (*c++ != '%')
+        {
+            continue;
+        }
+        if (*c == '%')
+        {
+            ++c;
+            continue;
+        }
+
+        LogSpec spec;
+        c = parse_spec(c, &spec);
+
+        // Worst case below is a star width, a star precision and a 16 byte value
+        if (end - at < 32 + 8)
+        {
+            break;
+        }
+
+        if (spec.width_star)
+        {
+            i64 width = va_arg(copy, int);
+            memcpy(at, &width, 8);
+            at += 8;
+        }
+        if (spec.precision_star)
+        {
+            i64 precision = va_arg(copy, int);
+            memcpy(at, &precision, 8);
+            at += 8;
+        }
+
+        char conversion = spec.conversion;
+        if (is_signed_conversion(conversion) || is_unsigned_conversion(conversion))
+        {
+            u64 value = read_integer(&copy, &spec);
+            memcpy(at, &value, 8);
+            at += 8;
+        }
+        else if (is_float_conversion(conversion))
+        {
+            if (spec.length == LOG_LENGTH_LONG_DOUBLE)
+            {
+                long double value = va_arg(copy, long double);
+                memset(at, 0, 16);
+                memcpy(at, &value, sizeof(value) < 16 ? sizeof(value) : 16);
+                at += 16;
+            }
+            else
+            {
+                f64 value = va_arg(copy, double);
+                memcpy(at, &value, 8);
+                at += 8;
+            }
+        }
+        else if (conversion == 'c')
+        {
+            i64 value = va_arg(copy, int);
+            memcpy(at, &value, 8);
+            at += 8;
+        }
+        else if (conversion == 'p' || conversion == 'n')
+        {
+            void *value = va_arg(copy, void *);
+            memcpy(at, &value, sizeof(value));
+            at += 8;
+        }
+        else if (conversion == 's')
+        {
+            const char *value = va_arg(copy, const char *);
+            if (value == NULL)
+            {
+                value = "(null)";
+            }
+            memory_index room = (memory_index)(end - at) - 8 - 1;
+            memory_index length = strlen(value);
+            if (length > room)
+            {
+                length = room;
+            }
+            u32 stored = (u32)length;
+            memcpy(at, &stored, 4);
+            memcpy(at + 8, value, length);
+            at[8 + length] = 0;
+            at += 8 + align8(length + 1);
+        }
+    }
+    va_end(copy);
+
+    LogRecord header = {};
+    header.size = (u32)(at - record);
+    header.level = (u32)level;
+    header.fmt = fmt;
+    memcpy(record, &header, sizeof(header));
+    return header.size;
+}
+
+
+internal int format_spec(char *out, memory_index out_size, LogSpec *spec, const u8 **arg)
+{
+    // Rebuild the spec with the length modifier matching how it was stored
+    char spec_text[32];
+    memory_index prefix = (memory_index)(spec->length_at - spec->start);
+    bool too_long = prefix > sizeof(spec_text) - 4;
+    if (too_long)
+    {
+        // Drop the flags and width rather than lose track of the arguments
+        prefix = 1;
+    }
+    memcpy(spec_text, spec->start, prefix);
+    char *at = spec_text + prefix;
+
+    int stars[2];
+    int star_count = 0;
+    if (spec->width_star)
+    {
+        i64 value;
+        memcpy(&value, *arg, 8);
+        stars[star_count++] = (int)value;
+        *arg += 8;
+    }
+    if (spec->precision_star)
+    {
+        i64 value;
+        memcpy(&value, *arg, 8);
+        stars[star_count++] = (int)value;
+        *arg += 8;
+    }
+
+    if (too_long)
+    {
+        star_count = 0;
+    }
+
+    char conversion = spec->conversion;
+
+#define LOG_FORMAT_VALUE(value)                                                        \
+    (star_count == 0 ? snprintf(out, out_size, spec_text, value)                      \
+     : star_count == 1 ? snprintf(out, out_size, spec_text, stars[0], value)          \
+     : snprintf(out, out_size, spec_text, stars[0], stars[1], value))
+
+    if (is_signed_conversion(conversion) || is_unsigned_conversion(conversion))
+    {
+        *at++ = 'l';
+        *at++ = 'l';
+        *at++ = conversion;
+        *at = 0;
+        u64 value;
+        memcpy(&value, *arg, 8);
+        *arg += 8;
+        if (is_signed_conversion(conversion))
+        {
+            return LOG_FORMAT_VALUE((long long)value);
+        }
+        return LOG_FORMAT_VALUE((unsigned long long)value);
+    }
+    if (is_float_conversion(conversion))
+    {
+        if (spec->length == LOG_LENGTH_LONG_DOUBLE)
+        {
+            *at++ = 'L';
+            *at++ = conversion;
+            *at = 0;
+            long double value = 0;
+            memcpy(&value, *arg, sizeof(value) < 16 ? sizeof(value) : 16);
+            *arg += 16;
+            return LOG_FORMAT_VALUE(value);
+        }
+        *at++ = conversion;
+        *at = 0;
+        f64 value;
+        memcpy(&value, *arg, 8);
+        *arg += 8;
+        return LOG_FORMAT_VALUE(value);
+    }
+    if (conversion == 'c')
+    {
+        *at++ = 'c';
+        *at = 0;
+        i64 value;
+        memcpy(&value, *arg, 8);
+        *arg += 8;
+        return LOG_FORMAT_VALUE((int)value);
+    }
+    if (conversion == 'p')
+    {
+        *at++ = 'p';
+        *at = 0;
+        void *value;
+        memcpy(&value, *arg, sizeof(value));
+        *arg += 8;
+        return LOG_FORMAT_VALUE(value);
+    }
+    if (conversion == 'n')
+    {
+        *arg += 8;
+        return 0;
+    }
+    if (conversion == 's')
+    {
+        *at++ = 's';
+        *at = 0;
+        u32 length;
+        memcpy(&length, *arg, 4);
+        const char *value = (const char *)*arg + 8;
+        *arg += 8 + align8(length + 1);
+        return LOG_FORMAT_VALUE(value);
+    }
+
+#undef LOG_FORMAT_VALUE
+
+    return 0;
+}
+
+
+// Formats a packed record into `out`, returns the length written.
+internal memory_index format_record(char *out, memory_index out_size, const u8 *record)
+{
+    LogRecord header;
+    memcpy(&header, record, sizeof(header));
+    const u8 *arg = record + sizeof(LogRecord);
+    const u8 *arg_end = record + header.size;
+
+    memory_index length = 0;
+    for (const char *c = header.fmt; *c && length + 1 < out_size;)
+    {
+        if (*c != '%')
+        {
+            out[length++] = *c++;
+            continue;
+        }
+        ++c;
+        if (*c == '%')
+        {
+            out[length++] = '%';
+            ++c;
+            continue;
+        }
+
+        LogSpec spec;
+        c = parse_spec(c, &spec);
+        if (arg >= arg_end)
+        {
+            // Arguments that did not fit in the record are left out
+            continue;
+        }
+
+        int written = format_spec(out + length, out_size - length, &spec, &arg);
+        if (written > 0)
+        {
+            length += (memory_index)written;
+        }
+        if (length >= out_size)
+        {
+            length = out_size - 1;
+        }
+    }
+    out[length] = 0;
+    return length;
+}
+
+
+internal void write_line(int level, const char *line, memory_index length)
+{
+    FILE *stream = level >= LOG_LEVEL_WARN ? stderr : stdout;
+    fwrite(line, 1, length, stream);
+}
+
+
+internal LogRing *get_thread_log_ring()
+{
+    if (thread_log_ring.ring)
+    {
+        return thread_log_ring.ring;
+    }
+
+    // A ring left by a thread that exited
+    u32 count = log_state.ring_count.load(std::memory_order_acquire);
+    for (u32 i = 0; i < count && i < LOG_MAX_THREADS; ++i)
+    {
+        LogRing *ring = log_state.rings[i].load(std::memory_order_acquire);
+        bool in_use = false;
+        if (ring && ring->in_use.compare_exchange_strong(in_use, true, std::memory_order_acquire))
+        {
+            thread_log_ring.ring = ring;
+            return ring;
+        }
+    }
+
+    u32 index = log_state.ring_count.load(std::memory_order_relaxed);
+    do
+    {
+        if (index >= LOG_MAX_THREADS)
+        {
+            assert(!"More than LOG_MAX_THREADS threads logging at once");
+            return NULL;
+        }
+    } while (!log_state.ring_count.compare_exchange_weak(index, index + 1));
+
+    MEMORY_TAG_SCOPE(MEMORY_TAG_LOG);
+    LogRing *ring = new LogRing();
+    ring->in_use.store(true, std::memory_order_relaxed);
+    log_state.rings[index].store(ring, std::memory_order_release);
+    thread_log_ring.ring = ring;
+    return ring;
+}
+
+
+internal bool push_record(LogRing *ring, const u8 *record, u32 size)
+{
+    u64 head = ring->head.load(std::memory_order_relaxed);
+    u64 tail = ring->tail.load(std::memory_order_acquire);
+    u64 offset = head & (LOG_RING_SIZE - 1);
+    u64 to_end = LOG_RING_SIZE - offset;
+
+    // Records never wrap, the rest of the ring is skipped instead
+    u64 needed = size <= to_end ? size : to_end + size;
+    if (LOG_RING_SIZE - (head - tail) < needed)
+    {
+        return false;
+    }
+
+    if (size > to_end)
+    {
+        u32 padding = 0;
+        memcpy(ring->data + offset, &padding, sizeof(padding));
+        head += to_end;
+        offset = 0;
+    }
+
+    memcpy(ring->data + offset, record, size);
+    ring->head.store(head + size, std::memory_order_release);
+    return true;
+}
+
+
+void log_write(int level, const char *fmt, ...)
+{
+    alignas(16) u8 record[LOG_MAX_RECORD];
+
+    va_list args;
+    va_start(args, fmt);
+    u32 size = pack_record(record, level, fmt, args);
+    va_end(args);
+
+    u64 sequence = log_state.sequence.fetch_add(1, std::memory_order_relaxed);
+    memcpy(record + offsetof(LogRecord, sequence), &sequence, sizeof(sequence));
+
+    if (!log_state.running.load(std::memory_order_acquire))
+    {
+        char line[LOG_MAX_LINE];
+        memory_index length = format_record(line, sizeof(line), record);
+        write_line(level, line, length);
+        return;
+    }
+
+    LogRing *ring = get_thread_log_ring();
+    if (ring == NULL)
+    {
+        log_state.dropped_no_ring.fetch_add(1, std::memory_order_relaxed);
+    }
+    else if (!push_record(ring, record, size))
+    {
+        ring->dropped.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+
+// Returns the oldest record's ring, so lines from several threads come out
+// in the order they were logged.
+internal LogRing *oldest_ring(const u8 **record_out)
+{
+    LogRing *oldest = NULL;
+    u64 oldest_sequence = 0;
+    u32 count = log_state.ring_count.load(std::memory_order_acquire);
+    if (count > LOG_MAX_THREADS)
+    {
+        count = LOG_MAX_THREADS;
+    }
+
+    for (u32 i = 0; i < count; ++i)
+    {
+        LogRing *ring = log_state.rings[i].load(std::memory_order_acquire);
+        if (ring == NULL)
+        {
+            continue;
+        }
+
+        u64 tail = ring->tail.load(std::memory_order_relaxed);
+        u64 head = ring->head.load(std::memory_order_acquire);
+        if (tail == head)
+        {
+            continue;
+        }
+
+        u64 offset = tail & (LOG_RING_SIZE - 1);
+        u32 size;
+        memcpy(&size, ring->data + offset, sizeof(size));
+        if (size == 0)
+        {
+            tail += LOG_RING_SIZE - offset;
+            ring->tail.store(tail, std::memory_order_release);
+            if (tail == head)
+            {
+                continue;
+            }
+            offset = 0;
+        }
+
+        const u8 *record = ring->data + offset;
+        u64 sequence;
+        memcpy(&sequence, record + offsetof(LogRecord, sequence), sizeof(sequence));
+        if (oldest == NULL || sequence < oldest_sequence)
+        {
+            oldest = ring;
+            oldest_sequence = sequence;
+            *record_out = record;
+        }
+    }
+
+    return oldest;
+}
+
+
+internal void report_dropped()
+{
+    char line[128];
+    u32 count = log_state.ring_count.load(std::memory_order_acquire);
+    for (u32 i = 0; i < count && i < LOG_MAX_THREADS; ++i)
+    {
+        LogRing *ring = log_state.rings[i].load(std::memory_order_acquire);
+        if (ring == NULL)
+        {
+            continue;
+        }
+        u64 dropped = ring->dropped.load(std::memory_order_relaxed);
+        if (dropped != ring->reported_dropped)
+        {
+            int length = snprintf(line, sizeof(line), "log: dropped %llu messages\n",
+                                  (unsigned long long)(dropped - ring->reported_dropped));
+            write_line(LOG_LEVEL_WARN, line, (memory_index)length);
+            ring->reported_dropped = dropped;
+        }
+    }
+}
+
+
+internal bool drain_log()
+{
+    char line[LOG_MAX_LINE];
+    bool wrote = false;
+
+    const u8 *record;
+    while (LogRing *ring = oldest_ring(&record))
+    {
+        LogRecord header;
+        memcpy(&header, record, sizeof(header));
+        memory_index length = format_record(line, sizeof(line), record);
+        write_line((int)header.level, line, length);
+        ring->tail.fetch_add(header.size, std::memory_order_release);
+        wrote = true;
+    }
+
+    if (wrote)
+    {
+        report_dropped();
+        fflush(stdout);
+        fflush(stderr);
+    }
+    return wrote;
+}
+
+
+internal void log_writer()
+{
+    memory_current_tag = MEMORY_TAG_LOG;
+    while (log_state.running.load(std::memory_order_acquire))
+    {
+        if (!drain_log())
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+    drain_log();
+}
+
+
+// assert() and abort() end up here, the messages leading up to them are
+// still queued. A signal handler cannot wait for the writer, which may be
+// the thread aborting, so the queued records are walked from copies of the
+// tails, oldest first, and written with write(2). Nothing is locked, waited
+// on or allocated; format_record only snprintf's into a stack buffer. A
+// line the writer was in the middle of can come out twice.
+internal void log_abort(int signal_number)
+{
+    LogRing *rings[LOG_MAX_THREADS];
+    u64 tails[LOG_MAX_THREADS];
+    u64 heads[LOG_MAX_THREADS];
+    u32 count = log_state.ring_count.load(std::memory_order_acquire);
+    if (count > LOG_MAX_THREADS)
+    {
+        count = LOG_MAX_THREADS;
+    }
+    for (u32 i = 0; i < count; ++i)
+    {
+        rings[i] = log_state.rings[i].load(std::memory_order_acquire);
+        tails[i] = rings[i] ? rings[i]->tail.load(std::memory_order_acquire) : 0;
+        heads[i] = rings[i] ? rings[i]->head.load(std::memory_order_acquire) : 0;
+    }
+
+    char line[LOG_MAX_LINE];
+    for (;;)
+    {
+        u32 oldest = count;
+        u64 oldest_sequence = 0;
+        for (u32 i = 0; i < count; ++i)
+        {
+            if (tails[i] == heads[i])
+            {
+                continue;
+            }
+            u64 offset = tails[i] & (LOG_RING_SIZE - 1);
+            u32 size;
+            memcpy(&size, rings[i]->data + offset, sizeof(size));
+            if (size == 0)
+            {
+                tails[i] += LOG_RING_SIZE - offset;
+                if (tails[i] == heads[i])
+                {
+                    continue;
+                }
+                offset = 0;
+            }
+            u64 sequence;
+            memcpy(&sequence, rings[i]->data + offset + offsetof(LogRecord, sequence), sizeof(sequence));
+            if (oldest == count || sequence < oldest_sequence)
+            {
+                oldest = i;
+                oldest_sequence = sequence;
+            }
+        }
+        if (oldest == count)
+        {
+            break;
+        }
+
+        const u8 *record = rings[oldest]->data + (tails[oldest] & (LOG_RING_SIZE - 1));
+        LogRecord header;
+        memcpy(&header, record, sizeof(header));
+        memory_index length = format_record(line, sizeof(line), record);
+        ssize_t written = write(header.level >= LOG_LEVEL_WARN ? 2 : 1, line, length);
+        (void)written;
+        tails[oldest] += header.size;
+    }
+
+    signal(signal_number, SIG_DFL);
+    raise(signal_number);
+}
+
+
+bool init_log()
+{
+    if (log_state.running.load())
+    {
+        return true;
+    }
+
+    log_state.running.store(true, std::memory_order_release);
+    log_state.writer = std::thread(log_writer);
+    signal(SIGABRT, log_abort);
+    return true;
+}
+
+
+void log_flush()
+{
+    // The writer cannot wait for itself
+    if (!log_state.running.load(std::memory_order_acquire)
+        || std::this_thread::get_id() == log_state.writer.get_id())
+    {
+        return;
+    }
+
+    u64 heads[LOG_MAX_THREADS] = {};
+    u32 count = log_state.ring_count.load(std::memory_order_acquire);
+    for (u32 i = 0; i < count && i < LOG_MAX_THREADS; ++i)
+    {
+        LogRing *ring = log_state.rings[i].load(std::memory_order_acquire);
+        heads[i] = ring ? ring->head.load(std::memory_order_acquire) : 0;
+    }
+
+    for (u32 i = 0; i < count && i < LOG_MAX_THREADS; ++i)
+    {
+        LogRing *ring = log_state.rings[i].load(std::memory_order_acquire);
+        while (ring && ring->tail.load(std::memory_order_acquire) < heads[i])
+        {
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+        }
+    }
+}
+
+
+void shutdown_log()
+{
+    if (!log_state.running.load())
+    {
+        return;
+    }
+
+    signal(SIGABRT, SIG_DFL);
+    log_flush();
+    log_state.running.store(false, std::memory_order_release);
+    log_state.writer.join();
+
+    // Rings of threads that outlive the log stay with them
+    u32 count = log_state.ring_count.load(std::memory_order_acquire);
+    u32 kept = 0;
+    for (u32 i = 0; i < count && i < LOG_MAX_THREADS; ++i)
+    {
+        LogRing *ring = log_state.rings[i].exchange(NULL, std::memory_order_acq_rel);
+        if (ring == thread_log_ring.ring)
+        {
+            thread_log_ring.ring = NULL;
+            delete ring;
+        }
+        else if (ring && !ring->in_use.load(std::memory_order_acquire))
+        {
+            delete ring;
+        }
+        else if (ring)
+        {
+            log_state.rings[kept++].store(ring, std::memory_order_release);
+        }
+    }
+    log_state.ring_count.store(kept, std::memory_order_release);
+
+    u64 dropped = log_state.dropped_no_ring.exchange(0);
+    if (dropped)
+    {
+        fprintf(stderr, "log: dropped %llu messages from unregistered threads\n",
+                (unsigned long long)dropped);
+    }
+}
@@ -0,0 +1,58 @@
+#pragma once
+
+
+#define LOG_LEVEL_DEBUG 0
+#define LOG_LEVEL_INFO  1
+#define LOG_LEVEL_WARN  2
+#define LOG_LEVEL_ERROR 3
+
+// Calls below this level compile to nothing, override with -DLOG_MIN_LEVEL=N
+#ifndef LOG_MIN_LEVEL
+#ifdef NDEBUG
+#define LOG_MIN_LEVEL LOG_LEVEL_INFO
+#else
+#define LOG_MIN_LEVEL LOG_LEVEL_DEBUG
+#endif
+#endif
+
+#if defined(__GNUC__)
+#define LOG_FORMAT(fmt_index) __attribute__((format(printf, fmt_index, fmt_index + 1)))
+#else
+#define LOG_FORMAT(fmt_index)
+#endif
+
+
+// Starts the writer thread. Until then, and after shutdown_log(), messages
+// are written synchronously.
+bool init_log();
+
+// Writes out everything still queued, stops the writer thread and frees
+// the rings of threads that have exited.
+void shutdown_log();
+
+// Waits until every message queued so far has been written. On SIGABRT,
+// from init_log() on, the queued messages are written out by the signal
+// handler instead, so a failed assert does not lose the messages before it.
+void log_flush();
+
+// Queues a message without blocking. Only the format string pointer is
+// stored, so it must be a literal; arguments (including %s strings) are
+// copied. Messages are dropped, and counted, if the thread's ring is full.
+void log_write(int level, const char *fmt, ...) LOG_FORMAT(2);
+
+
+// The call stays visible to the compiler so stripped levels are still
+// format checked.
+#define LOG_AT(level, ...)                       \
+    do                                           \
+    {                                            \
+        if ((level) >= LOG_MIN_LEVEL)            \
+        {                                        \
+            log_write((level), __VA_ARGS__);     \
+        }                                        \
+    } while (0)
+
+#define log_debug(...) LOG_AT(LOG_LEVEL_DEBUG, __VA_ARGS__)
+#define log_info(...)  LOG_AT(LOG_LEVEL_INFO, __VA_ARGS__)
+#define log_warn(...)  LOG_AT(LOG_LEVEL_WARN, __VA_ARGS__)
+#define log_error(...) LOG_AT(LOG_LEVEL_ERROR, __VA_ARGS__)
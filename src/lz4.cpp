@@ -0,0 +1,285 @@
+#include <string.h>
+
+#include "lz4.hpp"
+
+
+#define LZ4_MIN_MATCH     4
+#define LZ4_LAST_LITERALS 5     // the block always ends in literals
+#define LZ4_MATCH_LIMIT   12    // no match starts in the last 12 bytes
+#define LZ4_MAX_OFFSET    65535
+#define LZ4_HASH_BITS     12
+#define LZ4_SKIP_SHIFT    6     // misses before the step grows
+
+
+internal u32 read_u32(const u8 *at)
+{
+    u32 value;
+    memcpy(&value, at, sizeof(value));
+    return value;
+}
+
+
+internal u32 hash_sequence(u32 sequence)
+{
+    return (sequence * 2654435761u) >> (32 - LZ4_HASH_BITS);
+}
+
+
+internal u8 *write_length(u8 *out, u64 length)
+{
+    for (; length >= 255; length -= 255)
+    {
+        *out++ = 255;
+    }
+    *out++ = (u8)length;
+    return out;
+}
+
+
+// A token, the literals and, unless this is the last one, the match
+internal u8 *write_sequence(u8 *out, u8 *out_end, const u8 *literals, u64 literal_count, u32 offset, u64 match_length)
+{
+    u64 worst = 1 + literal_count / 255 + 1 + literal_count + 2 + match_length / 255 + 1;
+    if (worst > (u64)(out_end - out))
+    {
+        return NULL;
+    }
+
+    u8 *token = out++;
+    *token = (u8)((literal_count < 15 ? literal_count : 15) << 4);
+    if (literal_count >= 15)
+    {
+        out = write_length(out, literal_count - 15);
+    }
+    memcpy(out, literals, literal_count);
+    out += literal_count;
+
+    if (offset)
+    {
+        u64 length = match_length - LZ4_MIN_MATCH;
+        *token |= (u8)(length < 15 ? length : 15);
+        *out++ = (u8)offset;
+        *out++ = (u8)(offset >> 8);
+        if (length >= 15)
+        {
+            out = write_length(out, length - 15);
+        }
+    }
+    return out;
+}
+
+
+u64 lz4_compress(const u8 *source, u64 size, u8 *destination, u64 capacity)
+{
+    u8 *out = destination;
+    u8 *out_end = destination + capacity;
+    u64 anchor = 0;
+
+    if (size > LZ4_MATCH_LIMIT)
+    {
+        u32 table[1 << LZ4_HASH_BITS] = {};
+        u64 match_start_limit = size - LZ4_MATCH_LIMIT;
+        u64 match_end_limit = size - LZ4_LAST_LITERALS;
+        u64 position = 1;
+        u32 misses = 0;
+        while (position <= match_start_limit)
+        {
+            u32 sequence = read_u32(source + position);
+            u32 hash = hash_sequence(sequence);
+            u64 candidate = table[hash];
+            table[hash] = (u32)position;
+
+            if (candidate >= position || position - candidate > LZ4_MAX_OFFSET
+                || read_u32(source + candidate) != sequence)
+            {
+                position += 1 + (misses++ >> LZ4_SKIP_SHIFT);
+                continue;
+            }
+            misses = 0;
+
+            while (position > anchor && candidate > 0 && source[position - 1] == source[candidate - 1])
+            {
+                --position;
+                --candidate;
+            }
+            u64 length = LZ4_MIN_MATCH;
+            while (position + length < match_end_limit && source[candidate + length] == source[position + length])
+            {
+                ++length;
+            }
+
+            out = write_sequence(out, out_end, source + anchor, position - anchor, (u32)(position - candidate), length);
+            if (out == NULL)
+            {
+                return 0;
+            }
+            position += length;
+            anchor = position;
+
+            // The match's tail is likely to match again
+            if (position - 2 <= match_start_limit)
+            {
+                table[hash_sequence(read_u32(source + position - 2))] = (u32)(position - 2);
+            }
+        }
+    }
+
+    out = write_sequence(out, out_end, source + anchor, size - anchor, 0, 0);
+    return out ? (u64)(out - destination) : 0;
+}
+
+
+internal bool read_length(const u8 **in, const u8 *in_end, u64 *length)
+{
+    u8 byte;
+    do
+    {
+        if (*in == in_end)
+        {
+            return false;
+        }
+        byte = *(*in)++;
+        *length += byte;
+    } while (byte == 255);
+    return true;
+}
+
+
+// Copies `length` bytes from `offset` back, writing up to 32 bytes past
+// the end; the caller checked there is room. Below 8 the first 8 bytes
+// spread the pattern until it repeats at a distance of 8 or more, as the
+// reference decoder does, so everything after goes 8 bytes at a time.
+internal void copy_match_wide(u8 *out, u32 offset, u64 length)
+{
+    local_persist const u32 increments[8] = {0, 1, 2, 1, 0, 4, 4, 4};
+    local_persist const i32 decrements[8] = {0, 0, 0, -1, -4, 1, 2, 3};
+
+    u8 *end = out + length;
+    const u8 *match = out - offset;
+    if (offset >= 16)
+    {
+        for (; out < end; out += 16, match += 16)
+        {
+            memcpy(out, match, 16);
+        }
+        return;
+    }
+
+    if (offset < 8)
+    {
+        out[0] = match[0];
+        out[1] = match[1];
+        out[2] = match[2];
+        out[3] = match[3];
+        match += increments[offset];
+        memcpy(out + 4, match, 4);
+        match -= decrements[offset];
+    }
+    else
+    {
+        memcpy(out, match, 8);
+        match += 8;
+    }
+    for (out += 8; out < end; out += 8, match += 8)
+    {
+        memcpy(out, match, 8);
+    }
+}
+
+
+bool lz4_decompress(const u8 *source, u64 source_size, u8 *destination, u64 size)
+{
+    const u8 *in = source;
+    const u8 *in_end = source + source_size;
+    u8 *out = destination;
+    u8 *out_end = destination + size;
+
+    for (;;)
+    {
+        if (in == in_end)
+        {
+            return false;
+        }
+        u8 token = *in++;
+
+        // Short literals far from both ends, the usual case: one fixed
+        // copy, and they cannot be the block's last
+        u64 literal_count = token >> 4;
+        if (literal_count < 15 && in_end - in >= 32 && out_end - out >= 32)
+        {
+            memcpy(out, in, 16);
+            in += literal_count;
+            out += literal_count;
+        }
+        else
+        {
+            if (literal_count == 15 && !read_length(&in, in_end, &literal_count))
+            {
+                return false;
+            }
+            if (literal_count > (u64)(in_end - in) || literal_count > (u64)(out_end - out))
+            {
+                return false;
+            }
+            if (literal_count <= 16 && in_end - in >= 16 && out_end - out >= 16)
+            {
+                memcpy(out, in, 16);
+            }
+            else
+            {
+                memcpy(out, in, literal_count);
+            }
+            in += literal_count;
+            out += literal_count;
+
+            if (in == in_end)
+            {
+                return out == out_end;
+            }
+            if (in_end - in < 2)
+            {
+                return false;
+            }
+        }
+
+        u32 offset = (u32)in[0] | ((u32)in[1] << 8);
+        in += 2;
+        if (offset == 0 || offset > (u64)(out - destination))
+        {
+            return false;
+        }
+
+        u64 length = token & 15;
+        if (length == 15 && !read_length(&in, in_end, &length))
+        {
+            return false;
+        }
+        length += LZ4_MIN_MATCH;
+        if (length > (u64)(out_end - out))
+        {
+            return false;
+        }
+
+        if (length + 32 <= (u64)(out_end - out))
+        {
+            copy_match_wide(out, offset, length);
+        }
+        else
+        {
+            // Near the end, exact copies
+            const u8 *match = out - offset;
+            if (offset >= length)
+            {
+                memcpy(out, match, length);
+            }
+            else
+            {
+                for (u64 i = 0; i < length; ++i)
+                {
+                    out[i] = match[i];
+                }
+            }
+        }
+        out += length;
+    }
+}
@@ -0,0 +1,28 @@
+#pragma once
+
+#include "platform.hpp"
+
+
+// LZ4 block format, compatible with LZ4_compress_default() and
+// LZ4_decompress_safe() of the reference library.
+//
+// Greedy compression with a 4096 entry hash table on the stack, skipping
+// ahead faster through data that does not match. Decompression checks
+// every length against both buffers, so corrupt input fails instead of
+// writing out of bounds. Away from the ends of the buffers literals go in
+// one sixteen byte copy and matches eight or sixteen bytes at a time, also
+// when they overlap, with no loop per byte.
+
+
+// Worst case compressed size, incompressible data grows a little
+inline u64 lz4_compress_bound(u64 size)
+{
+    return size + size / 255 + 16;
+}
+
+
+// The compressed size, 0 if it does not fit in `capacity`.
+u64 lz4_compress(const u8 *source, u64 size, u8 *destination, u64 capacity);
+
+// False unless the block decodes to exactly `size` bytes.
+bool lz4_decompress(const u8 *source, u64 source_size, u8 *destination, u64 size);
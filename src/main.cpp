@@ -1,9 +1,59 @@
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 
 #include <SDL2/SDL.h>
 #include <glad/glad.h>
+#include <glad/glad_profile.h>
+#include <glad/glad_trace.h>
 
 #include "platform.hpp"
+#include "log.hpp"
+#include "gl_debug.hpp"
+#include "gl_extensions.hpp"
+#include "profile.hpp"
+#include "memory_tracking.hpp"
+#include "cpu.hpp"
+#include "math.hpp"
+#include "jobs.hpp"
+#include "file_io.hpp"
+#include "cull.hpp"
+#include "texture.hpp"
+#include "stream.hpp"
+#include "mesh.hpp"
+#include "obj.hpp"
+#include "mesh_optimize.hpp"
+#include "mesh_simplify.hpp"
+#include "mesh_lod.hpp"
+#include "vertex_format.hpp"
+#include "gl_vertex.hpp"
+
+
+// Set by the Makefile, see BUILD there
+#ifndef BUILD_PROFILE
+#define BUILD_PROFILE "custom"
+#endif
+
+
+#define APP_MEMORY_SIZE   Gigabytes(1)
+#define FRAME_MEMORY_SIZE Megabytes(64)
+#define SCENE_SIZE        1000.0f
+#define CAMERA_FOV_Y      60.0f           // degrees, the scene's and the orbiting mesh's
+#define DRAW_QUERY_FRAMES 4             // GPU timings are read this many frames late
+
+
+// A permutation of the mesh shader and its uniforms
+struct MeshShader
+{
+    GLuint program;
+    GLuint vertex;
+    GLint  mvp;
+    GLint  textured;
+    GLint  position_offset;     // the QUANTIZED permutation's
+    GLint  position_scale;
+    GLint  uv_offset;
+    GLint  uv_scale;
+};
 
 
 struct App
@@ -14,21 +64,136 @@ struct App
                    vbo,
                    ebo,
                    tex;
-    GLuint         vert_shader;
     GLuint         frag_shader;
-    GLuint         shader_prog;
+    MeshShader     mesh_shaders[2];  // float, quantized vertices
+    bool           gl_profile;
+    const char    *gl_trace_path;
+    u32            gl_trace_frames;
+    const char    *profile_path;
+    const char    *isa_name;         // --isa override for the SIMD kernels
+    CpuIsa         isa;
+    u64            frame_number;
+
+    // Random boxes the camera turns around in, culled every frame
+    u32            object_count;     // --objects
+    CullBounds     object_bounds;
+    u32           *visible_objects;  // this frame's, in the frame arena
+    u32            visible_count;
+    Mat4           view_projection;  // this frame's camera
+    StreamView     camera_view;      // the same camera, for LODs and streaming
+    f32            aspect;           // of the drawable, this frame's
+
+    // Streamed, so the names change once they are up
+    const char    *texture_path;     // --texture, this frame's name in tex
+    StreamHandle   texture_asset;
+    f64            upload_budget_mb; // --upload-budget
+    f64            upload_ms;        // --upload-ms
+
+    // OBJs are parsed, optimized, simplified and quantized here and go in
+    // vao/vbo/ebo, .cmesh files are streamed
+    const char    *mesh_path;        // --mesh
+    StreamHandle   mesh_asset;
+    StreamMesh     obj_mesh;         // drawn like a streamed one, the placeholder without --mesh
+    const char    *format_name;      // --vertex-format, of the OBJ
+    VertexFormat   vertex_format;
+
+    // Besides the orbiting one, the mesh stands in for the first
+    // --mesh-instances objects, each at the LOD its size on screen needs
+    u32            mesh_instances;
+    f32            lod_pixel_error;  // --lod-error, 0 draws every LOD 0
+    u32            mesh_lod;         // the orbiting one's, last frame
+    u8            *object_lods;      // by object, last frame's
+
+    // The mesh is drawn once a frame with a GPU timer around it
+    GLuint         draw_queries[DRAW_QUERY_FRAMES];
+    bool           draw_query_pending[DRAW_QUERY_FRAMES];
+
+    // Benchmark mode, runs warmup + bench frames hidden and without vsync
+    u32            bench_frames;
+    u32            bench_warmup;
+    bool           fail_on_frame_alloc;
+    u32            frame_index;
+    u32            timed_frames;
+    f64            frame_ms_total;
+    f64            frame_ms_min;
+    f64            frame_ms_max;
+    u64            steady_heap_allocs;
+    u64            visible_total;
+    f64            draw_gpu_ms_total;
+    u32            draw_gpu_samples;
+    u32            draw_triangles;   // this frame's
+    u32            draw_instances;
+    u64            triangles_total;
+    u64            instances_total;
+
+    void          *memory;
+    MemoryArena    permanent_arena;
+    MemoryArena    frame_arena;      // reset at the top of every update()
 };
 
 
-void log(const char *msg)
+// QUANTIZED vertices come normalized from the fetch, 0 to 1 or -1 to 1, and
+// are mapped onto the mesh's ranges here (see vertex_format.hpp)
+global_variable const char *mesh_vertex_source = R"(
+layout(location = 0) in vec3 position;
+layout(location = 1) in vec3 normal;
+layout(location = 2) in vec2 uv;
+uniform mat4 mvp;
+#ifdef QUANTIZED
+uniform vec3 position_offset;
+uniform vec3 position_scale;
+uniform vec2 uv_offset;
+uniform vec2 uv_scale;
+#endif
+out vec3 frag_normal;
+out vec2 frag_uv;
+void main()
+{
+#ifdef QUANTIZED
+    gl_Position = mvp * vec4(position_offset + position_scale * position, 1.0);
+    frag_normal = normalize(normal);
+    frag_uv = uv_offset + uv_scale * uv;
+#else
+    gl_Position = mvp * vec4(position, 1.0);
+    frag_normal = normal;
+    frag_uv = uv;
+#endif
+}
+)";
+
+
+// Normals are object space, the model matrix only scales uniformly
+global_variable const char *mesh_fragment_source = R"(
+in vec3 frag_normal;
+in vec2 frag_uv;
+uniform sampler2D diffuse;
+uniform float textured;
+out vec4 color;
+void main()
 {
-    printf(msg);
+    float light = 0.3 + 0.7 * max(dot(frag_normal, normalize(vec3(0.4, 0.8, 0.6))), 0.0);
+    vec3 albedo = mix(vec3(1.0), texture(diffuse, frag_uv).rgb, textured);
+    color = vec4(albedo * light, 1.0);
 }
+)";
 
 
-void log_err(const char *msg)
+bool init_memory(App *app)
 {
-    fprintf(stderr, msg);
+    app->memory = platform_reserve_memory(APP_MEMORY_SIZE);
+    if (app->memory == NULL)
+    {
+        log_error("Failed to reserve %lld bytes\n", (long long)APP_MEMORY_SIZE);
+        return false;
+    }
+
+    initialize_arena(&app->permanent_arena, APP_MEMORY_SIZE, app->memory);
+    sub_arena(&app->frame_arena, &app->permanent_arena, FRAME_MEMORY_SIZE);
+
+    track_arena(&app->permanent_arena, MEMORY_TAG_PLATFORM, "permanent");
+    track_arena(&app->frame_arena, MEMORY_TAG_FRAME, "frame");
+
+    return true;
 }
 
 
@@ -42,17 +207,32 @@ bool init_rendering_context(App *app)
     );
 
     SDL_GL_SetAttribute(SDL_GL_DOUBLEBUFFER, 1);
+    SDL_GL_SetAttribute(SDL_GL_DEPTH_SIZE, 24);
+
+    // Debug builds get driver diagnostics, release builds skip validation.
+#ifdef NDEBUG
+    SDL_GL_SetAttribute(SDL_GL_CONTEXT_NO_ERROR, 1);
+#else
+    SDL_GL_SetAttribute(SDL_GL_CONTEXT_FLAGS, SDL_GL_CONTEXT_DEBUG_FLAG);
+#endif
 
     app->context = SDL_GL_CreateContext(app->window);
     if (app->context == NULL)
     {
-        log_err("Failed to create GL context\n");
+        // Not every driver accepts these, fall back to a plain context.
+        SDL_GL_SetAttribute(SDL_GL_CONTEXT_NO_ERROR, 0);
+        SDL_GL_SetAttribute(SDL_GL_CONTEXT_FLAGS, 0);
+        app->context = SDL_GL_CreateContext(app->window);
+    }
+    if (app->context == NULL)
+    {
+        log_error("Failed to create GL context\n");
         SDL_DestroyWindow(app->window);
         SDL_Quit();
         return false;
     }
 
-    SDL_GL_SetSwapInterval(1); // Use VSYNC
+    SDL_GL_SetSwapInterval(app->bench_frames ? 0 : 1); // Use VSYNC
 
     return true;
 }
@@ -62,7 +242,7 @@ bool init_sdl(App *app)
 {
     if (SDL_Init(SDL_INIT_VIDEO) < 0)
     {
-        log_err("Failed to initialize SDL video\n");
+        log_error("Failed to initialize SDL video\n");
         return false;
     }
 
@@ -71,10 +251,10 @@ bool init_sdl(App *app)
         SDL_WINDOWPOS_CENTERED,
         SDL_WINDOWPOS_CENTERED,
         640, 480,
-        SDL_WINDOW_OPENGL);
+        SDL_WINDOW_OPENGL | (app->bench_frames ? SDL_WINDOW_HIDDEN : 0));
     if (app->window == NULL)
     {
-        log_err("Failed to create main window\n");
+        log_error("Failed to create main window\n");
         SDL_Quit();
         return false;
     }
@@ -88,89 +268,895 @@ bool init_gl(App *app)
     int gladInitRes = gladLoadGL();
     if (!gladInitRes)
     {
-        log_err("Unable to initialize glad\n");
+        log_error("Unable to initialize glad\n");
         SDL_DestroyWindow(app->window);
         SDL_Quit();
         return false;
     }
 
+    if (init_gl_extensions())
+    {
+        log_info("GL extensions: %u, buffer storage %s, KHR_debug %s, S3TC %s\n", gl_extension_count(),
+                 gl_has_extension("GL_ARB_buffer_storage") ? "yes" : "no",
+                 gl_has_extension("GL_KHR_debug") ? "yes" : "no",
+                 gl_has_extension("GL_EXT_texture_compression_s3tc") ? "yes" : "no");
+    }
+
+#ifndef NDEBUG
+    if (!init_gl_debug())
+    {
+        log_info("GL debug output not available\n");
+    }
+#endif
+
+    if (app->gl_profile && !gladProfileEnable())
+    {
+        log_error("GL profiling not compiled in, rebuild with GLAD_PROFILE=1\n");
+    }
+
+    if (app->gl_trace_path && !gladTraceBegin(app->gl_trace_path, app->gl_trace_frames))
+    {
+        log_error("Failed to start GL trace\n");
+    }
+
+    return true;
+}
+
+
+// `defines` go between the version and `source`
+GLuint compile_shader(GLenum type, const char *source, const char *defines = "")
+{
+    const char *sources[3] = {"#version 330 core\n", defines, source};
+    GLuint shader = glCreateShader(type);
+    glShaderSource(shader, 3, sources, NULL);
+    glCompileShader(shader);
+
+    GLint compiled = GL_FALSE;
+    glGetShaderiv(shader, GL_COMPILE_STATUS, &compiled);
+    if (!compiled)
+    {
+        char message[1024];
+        glGetShaderInfoLog(shader, sizeof(message), NULL, message);
+        log_error("Failed to compile %s shader: %s\n",
+                  type == GL_VERTEX_SHADER ? "vertex" : "fragment", message);
+        glDeleteShader(shader);
+        return 0;
+    }
+    return shader;
+}
+
+
+bool link_mesh_shader(App *app, MeshShader *shader, const char *defines)
+{
+    shader->vertex = compile_shader(GL_VERTEX_SHADER, mesh_vertex_source, defines);
+    if (!shader->vertex)
+    {
+        return false;
+    }
+
+    shader->program = glCreateProgram();
+    glAttachShader(shader->program, shader->vertex);
+    glAttachShader(shader->program, app->frag_shader);
+    glLinkProgram(shader->program);
+
+    GLint linked = GL_FALSE;
+    glGetProgramiv(shader->program, GL_LINK_STATUS, &linked);
+    if (!linked)
+    {
+        char message[1024];
+        glGetProgramInfoLog(shader->program, sizeof(message), NULL, message);
+        log_error("Failed to link the mesh shader: %s\n", message);
+        return false;
+    }
+
+    shader->mvp = glGetUniformLocation(shader->program, "mvp");
+    shader->textured = glGetUniformLocation(shader->program, "textured");
+    shader->position_offset = glGetUniformLocation(shader->program, "position_offset");
+    shader->position_scale = glGetUniformLocation(shader->program, "position_scale");
+    shader->uv_offset = glGetUniformLocation(shader->program, "uv_offset");
+    shader->uv_scale = glGetUniformLocation(shader->program, "uv_scale");
+    glUseProgram(shader->program);
+    glUniform1i(glGetUniformLocation(shader->program, "diffuse"), 0);
+    return true;
+}
+
+
+bool init_shaders(App *app)
+{
+    app->frag_shader = compile_shader(GL_FRAGMENT_SHADER, mesh_fragment_source);
+    if (!app->frag_shader
+        || !link_mesh_shader(app, &app->mesh_shaders[0], "")
+        || !link_mesh_shader(app, &app->mesh_shaders[1], "#define QUANTIZED\n"))
+    {
+        return false;
+    }
+
+    glGenQueries(DRAW_QUERY_FRAMES, app->draw_queries);
+    return true;
+}
+
+
+bool init_cpu_dispatch(App *app)
+{
+    app->isa = cpu_best_isa();
+    if (app->isa_name)
+    {
+        CpuIsa isa;
+        if (!parse_cpu_isa(app->isa_name, &isa))
+        {
+            log_error("Unknown instruction set '%s' (scalar, sse2, avx2, avx512)\n", app->isa_name);
+            return false;
+        }
+        if (!cpu_isa_supported(isa))
+        {
+            log_error("This CPU does not support %s, best is %s\n",
+                      app->isa_name, cpu_isa_name(app->isa));
+            return false;
+        }
+        app->isa = isa;
+    }
+
+    select_math_kernels(app->isa);
+    select_cull_kernels(app->isa);
+    log_info("SIMD kernels: %s%s\n", cpu_isa_name(app->isa), app->isa_name ? " (forced)" : "");
+    return true;
+}
+
+
+bool init_scene(App *app)
+{
+    if (!push_cull_bounds(&app->object_bounds, &app->permanent_arena, app->object_count))
+    {
+        log_error("Not enough memory for %u objects\n", app->object_count);
+        return false;
+    }
+
+    srand(1);
+    for (u32 i = 0; i < app->object_count; ++i)
+    {
+        Vec3 center = vec3((f32)rand() / RAND_MAX - 0.5f,
+                           (f32)rand() / RAND_MAX - 0.5f,
+                           (f32)rand() / RAND_MAX - 0.5f) * SCENE_SIZE;
+        Vec3 extent = vec3(1.0f, 1.0f, 1.0f) * (0.5f + 4.0f * (f32)rand() / RAND_MAX);
+        set_cull_bounds(&app->object_bounds, i, center - extent, center + extent);
+    }
+    app->object_bounds.count = app->object_count;
+
+    log_info("Scene: %u objects, %u job threads\n", app->object_count, jobs_thread_count());
+    return true;
+}
+
+
+void create_mesh_buffers(App *app, const void *vertices, u64 vertex_bytes, const void *indices, u64 index_bytes)
+{
+    MEMORY_TAG_SCOPE(MEMORY_TAG_DRIVER);
+    glGenVertexArrays(1, &app->vao);
+    glGenBuffers(1, &app->vbo);
+    glGenBuffers(1, &app->ebo);
+    glBindVertexArray(app->vao);
+    glBindBuffer(GL_ARRAY_BUFFER, app->vbo);
+    glBufferData(GL_ARRAY_BUFFER, vertex_bytes, vertices, GL_STATIC_DRAW);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, app->ebo);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, index_bytes, indices, GL_STATIC_DRAW);
+}
+
+
+bool load_obj_mesh(App *app)
+{
+    Mesh mesh;
+    ObjStats stats;
+    bool ok = load_obj(app->mesh_path, &app->permanent_arena, &mesh, &stats);
+    release_obj_scratch();
+    if (!ok)
+    {
+        return false;
+    }
+    log_info("Mesh %s: %u vertices, %u triangles (%u positions, %u normals, %u uvs), %u chunks\n",
+             app->mesh_path, mesh.vertex_count, stats.triangles, stats.positions, stats.normals,
+             stats.uvs, stats.chunks);
+
+    MeshOptimizeStats optimized;
+    if (optimize_mesh(&mesh, &app->permanent_arena, &optimized))
+    {
+        log_info("Mesh vertex cache: ACMR %.3f -> %.3f, ATVR %.3f -> %.3f\n",
+                 optimized.before.acmr, optimized.after.acmr, optimized.before.atvr, optimized.after.atvr);
+    }
+
+    u32 lod_capacity = mesh.index_count * 2;
+    u32 *lod_indices = push_array(&app->permanent_arena, lod_capacity, u32);
+    if (lod_indices && generate_mesh_lods(&mesh, lod_indices, lod_capacity, &app->permanent_arena))
+    {
+        log_info("Mesh LODs: %u, %u triangles and %.4f error at the coarsest\n", mesh.lod_count,
+                 mesh.lods[mesh.lod_count - 1].index_count / 3, mesh.lods[mesh.lod_count - 1].error);
+    }
+    else
+    {
+        mesh.lods[0] = {0, mesh.index_count, 0.0f};
+        mesh.lod_count = 1;
+    }
+
+    StreamMesh *loaded = &app->obj_mesh;
+    loaded->dequantization = vertex_dequantization(mesh.vertices, mesh.vertex_count, app->vertex_format);
+    u64 vertex_bytes = (u64)mesh.vertex_count * vertex_format_stride(app->vertex_format);
+    void *vertices = push_size(&app->permanent_arena, vertex_bytes);
+    if (vertices == NULL)
+    {
+        return false;
+    }
+    quantize_vertices(vertices, mesh.vertices, mesh.vertex_count, app->vertex_format, &loaded->dequantization);
+    log_info("Mesh vertices: %s, %.1f KB (%.1f KB as float)\n", vertex_format_name(app->vertex_format),
+             (f64)vertex_bytes / Kilobytes(1), (f64)mesh.vertex_count * sizeof(Vertex) / Kilobytes(1));
+
+    create_mesh_buffers(app, vertices, vertex_bytes, mesh.indices, (u64)mesh.index_count * sizeof(u32));
+    bind_vertex_format(app->vertex_format);
+    glBindVertexArray(0);
+
+    loaded->vao = app->vao;
+    loaded->index_type = GL_UNSIGNED_INT;
+    memcpy(loaded->lods, mesh.lods, sizeof(loaded->lods));
+    loaded->lod_count = mesh.lod_count;
+    loaded->bounds_min = vec3(0.0f, 0.0f, 0.0f);
+    loaded->bounds_max = vec3(0.0f, 0.0f, 0.0f);
+    for (u32 i = 0; i < mesh.vertex_count; ++i)
+    {
+        Vec3 position = mesh.vertices[i].position;
+        loaded->bounds_min = i ? min(loaded->bounds_min, position) : position;
+        loaded->bounds_max = i ? max(loaded->bounds_max, position) : position;
+    }
+    loaded->vertex_format = app->vertex_format;
+    loaded->placeholder = false;
+    return true;
+}
+
+
+bool init_mesh(App *app)
+{
+    PROFILE_SCOPE("init_mesh");
+
+    app->mesh_instances = app->mesh_instances < app->object_count ? app->mesh_instances : app->object_count;
+    app->object_lods = push_array(&app->permanent_arena, app->mesh_instances, u8);
+    if (app->object_lods == NULL)
+    {
+        log_error("Not enough memory for %u mesh instances\n", app->mesh_instances);
+        return false;
+    }
+    memset(app->object_lods, 0, app->mesh_instances);
+
+    if (!parse_vertex_format(app->format_name, &app->vertex_format))
+    {
+        log_error("Unknown vertex format '%s' (float, unorm16, half)\n", app->format_name);
+        return false;
+    }
+
+    memory_index length = strlen(app->mesh_path);
+    if (length > 6 && strcmp(app->mesh_path + length - 6, ".cmesh") == 0)
+    {
+        app->mesh_asset = stream_mesh(app->mesh_path, vec3(0.0f, 0.0f, 0.0f), 1.0f);
+        return app->mesh_asset != 0;
+    }
+
+    u64 start = SDL_GetPerformanceCounter();
+    if (!load_obj_mesh(app))
+    {
+        log_error("Failed to load mesh %s\n", app->mesh_path);
+        return false;
+    }
+
+    f64 load_ms = (f64)(SDL_GetPerformanceCounter() - start) * 1000.0 / (f64)SDL_GetPerformanceFrequency();
+    log_info("Mesh loaded and uploaded in %.1f ms\n", load_ms);
     return true;
 }
 
 
 bool init(App *app)
 {
+    PROFILE_SCOPE("init");
+
+    if (!init_memory(app))
+    {
+        return false;
+    }
+
+    if (!init_cpu_dispatch(app))
+    {
+        return false;
+    }
+
+    init_jobs();
+    track_pool(jobs_pool(), MEMORY_TAG_PLATFORM, "jobs");
+
+    // Every job thread, main and the GPU timeline
+    if (app->profile_path
+        && !init_profile(&app->permanent_arena, jobs_thread_count() + JOBS_BACKGROUND_WORKERS + 1))
+    {
+        log_warn("Not enough memory for the profiler\n");
+    }
+    profile_set_thread_name("main");
+
+    init_io();
+    log_info("File reads: %s\n", io_backend_name(io_backend()));
+
+    if (!init_scene(app))
+    {
+        return false;
+    }
+
     if (!init_sdl(app))
     {
         return false;
     }
 
-    if (!init_gl(app))
+    if (!init_gl(app) || !init_shaders(app))
+    {
+        return false;
+    }
+
+    u64 upload_budget = (u64)(app->upload_budget_mb * Megabytes(1));
+    if (!init_texture_loader(upload_budget) || !init_streaming(upload_budget, app->upload_ms))
+    {
+        return false;
+    }
+
+    if (app->texture_path)
+    {
+        app->texture_asset = stream_texture(app->texture_path, vec3(0.0f, 0.0f, 0.0f), 1.0f);
+    }
+
+    if (app->mesh_path && !init_mesh(app))
     {
         return false;
     }
 
+    // A texture without a mesh goes on the placeholder cube, orbiting alone
+    if (!app->mesh_path)
+    {
+        app->obj_mesh = streamed_placeholder_mesh();
+        app->mesh_instances = 0;
+    }
+
+    // Everything traced so far is setup, frames are recorded from here on.
+    gladTraceFrame();
+
     return true;
 }
 
 
+int compare_gl_profile_stats(const void *a, const void *b)
+{
+    const gladProfileStat *stat_a = *(const gladProfileStat **)a;
+    const gladProfileStat *stat_b = *(const gladProfileStat **)b;
+    if (stat_a->nanoseconds == stat_b->nanoseconds)
+    {
+        return 0;
+    }
+    return stat_a->nanoseconds < stat_b->nanoseconds ? 1 : -1;
+}
+
+
+void report_gl_profile(MemoryArena *scratch)
+{
+    const gladProfileStat *stats;
+    unsigned int count = gladProfileStats(&stats);
+
+    TemporaryMemory temp = begin_temporary_memory(scratch);
+    const gladProfileStat **called = push_array(scratch, count, const gladProfileStat *);
+    unsigned int called_count = 0;
+    for (unsigned int i = 0; i < count; ++i)
+    {
+        if (stats[i].calls > 0)
+        {
+            called[called_count++] = &stats[i];
+        }
+    }
+    qsort(called, called_count, sizeof(*called), compare_gl_profile_stats);
+
+    log_info("GL calls by CPU time:\n");
+    for (unsigned int i = 0; i < called_count; ++i)
+    {
+        log_info("  %-40s %10llu calls %12.3f ms\n",
+                 called[i]->name,
+                 called[i]->calls,
+                 called[i]->nanoseconds / 1000000.0);
+    }
+
+    end_temporary_memory(temp);
+
+    const gladProfileScopeStat *scope_stats = gladProfileScopeStats();
+    log_info("GL calls by scope:\n");
+    for (u32 i = 0; i < GLAD_PROFILE_MAX_SCOPES; ++i)
+    {
+        const char *name = profile_gl_scope_name(i);
+        if (scope_stats[i].calls == 0)
+        {
+            continue;
+        }
+        log_info("  %-40s %10llu calls %12.3f ms\n",
+                 name ? name : "(no scope)",
+                 scope_stats[i].calls,
+                 scope_stats[i].nanoseconds / 1000000.0);
+    }
+}
+
+
 void cleanup(App *app)
 {
+    gladTraceEnd();
+
+    if (gladProfileEnabled())
+    {
+        report_gl_profile(&app->frame_arena);
+        gladProfileDisable();
+    }
+
+    const GLDebugStats *debug_stats = gl_debug_stats();
+    if (debug_stats->total_messages > 0)
+    {
+        log_info("GL debug: %llu messages, %llu errors, %llu performance "
+                 "(%llu sync, %llu recompile, %llu fallback), %llu repeats\n",
+                 (unsigned long long)debug_stats->total_messages,
+                 (unsigned long long)debug_stats->total_errors,
+                 (unsigned long long)debug_stats->total_performance,
+                 (unsigned long long)debug_stats->total_perf_issues[GL_PERF_IMPLICIT_SYNC],
+                 (unsigned long long)debug_stats->total_perf_issues[GL_PERF_RECOMPILE],
+                 (unsigned long long)debug_stats->total_perf_issues[GL_PERF_FALLBACK],
+                 (unsigned long long)debug_stats->duplicates);
+    }
+
+    if (app->profile_path && !profile_dump(app->profile_path))
+    {
+        log_error("Failed to write profile to %s\n", app->profile_path);
+    }
+    shutdown_profile();
+    shutdown_streaming();
+    shutdown_io();
+    shutdown_texture_loader();
+    untrack_pool(jobs_pool());
+    shutdown_jobs();
+
     glUseProgram(0);
     glDisableVertexAttribArray(0);
-    glDetachShader(app->shader_prog, app->vert_shader);
-    glDetachShader(app->shader_prog, app->frag_shader);
-    glDeleteProgram(app->shader_prog);
-    glDeleteShader(app->vert_shader);
+    for (u32 i = 0; i < sizeof(app->mesh_shaders) / sizeof(app->mesh_shaders[0]); ++i)
+    {
+        MeshShader *shader = &app->mesh_shaders[i];
+        glDetachShader(shader->program, shader->vertex);
+        glDetachShader(shader->program, app->frag_shader);
+        glDeleteProgram(shader->program);
+        glDeleteShader(shader->vertex);
+    }
     glDeleteShader(app->frag_shader);
-    glDeleteTextures(1, &app->tex);
     glDeleteBuffers(1, &app->ebo);
     glDeleteBuffers(1, &app->vbo);
     glDeleteVertexArrays(1, &app->vao);
+    glDeleteQueries(DRAW_QUERY_FRAMES, app->draw_queries);
+    shutdown_gl_extensions();
     SDL_GL_DeleteContext(app->context);
     SDL_DestroyWindow(app->window);
     SDL_Quit();
+    platform_release_memory(app->memory, APP_MEMORY_SIZE);
+}
+
+
+void cull_scene(App *app)
+{
+    f32 angle = (f32)app->frame_number * 0.005f;
+    Vec3 direction = vec3(sinf(angle), 0.2f, -cosf(angle));
+    Vec3 eye = vec3(0.0f, 0.0f, 0.0f);
+    int width, height;
+    SDL_GL_GetDrawableSize(app->window, &width, &height);
+    height = height > 0 ? height : 1;
+    app->aspect = (f32)width / (f32)height;
+
+    Mat4 view = look_at(eye, eye + direction, vec3(0.0f, 1.0f, 0.0f));
+    Mat4 projection = perspective(radians(CAMERA_FOV_Y), app->aspect, 0.1f, SCENE_SIZE);
+    app->view_projection = projection * view;
+    app->camera_view = stream_view(eye, radians(CAMERA_FOV_Y), (f32)height);
+    Frustum frustum = frustum_from_matrix(app->view_projection);
+
+    app->visible_objects = push_array(&app->frame_arena, app->object_count, u32);
+    app->visible_count = cull(&frustum, &app->object_bounds, CULL_AABB, app->visible_objects);
+}
+
+
+// Reads the timing of the draw DRAW_QUERY_FRAMES ago, if the GPU is done
+// with it, and counts it in the benchmark after the warmup
+void read_draw_time(App *app, u32 slot)
+{
+    if (!app->draw_query_pending[slot])
+    {
+        return;
+    }
+
+    GLint available = GL_FALSE;
+    glGetQueryObjectiv(app->draw_queries[slot], GL_QUERY_RESULT_AVAILABLE, &available);
+    if (!available)
+    {
+        return;
+    }
+    GLuint64 nanoseconds = 0;
+    glGetQueryObjectui64v(app->draw_queries[slot], GL_QUERY_RESULT, &nanoseconds);
+    app->draw_query_pending[slot] = false;
+    if (app->bench_frames && app->frame_index >= app->bench_warmup)
+    {
+        app->draw_gpu_ms_total += (f64)nanoseconds / 1e6;
+        ++app->draw_gpu_samples;
+    }
+}
+
+
+// Draws one LOD's index range, returns its triangles
+u32 draw_lod(const StreamMesh *mesh, u32 lod)
+{
+    const MeshLod *range = &mesh->lods[lod];
+    umm index_size = mesh->index_type == GL_UNSIGNED_SHORT ? sizeof(u16) : sizeof(u32);
+    glDrawElements(GL_TRIANGLES, range->index_count, mesh->index_type, (void *)(range->first_index * index_size));
+    return range->index_count / 3;
+}
+
+
+// Orbits the mesh, scaled to fit the view, depth tested and back faces
+// culled, so the index order shows in both the vertex and fragment work.
+// Then draws it again in place of each visible instance object, scaled to
+// its box, at the LOD its size on screen calls for. A streamed mesh is its
+// placeholder cube until it is resident, drawn the same way, so the upload
+// budget is spent against real frames.
+void draw_mesh(App *app)
+{
+    PROFILE_GPU_SCOPE("draw_mesh");
+    MEMORY_TAG_SCOPE(MEMORY_TAG_DRIVER);
+
+    StreamMesh mesh = app->mesh_asset ? streamed_mesh(app->mesh_asset) : app->obj_mesh;
+
+    Vec3 center = 0.5f * (mesh.bounds_min + mesh.bounds_max);
+    f32 radius = 0.5f * length(mesh.bounds_max - mesh.bounds_min);
+    radius = radius > 0.0f ? radius : 1.0f;
+    Mat4 model = scaling(vec3(1.0f, 1.0f, 1.0f) / radius) * translation(-center);
+    f32 angle = (f32)app->frame_number * 0.01f;
+    Vec3 eye = vec3(2.5f * sinf(angle), 0.8f, 2.5f * cosf(angle));
+    Mat4 view = look_at(eye, vec3(0.0f, 0.0f, 0.0f), vec3(0.0f, 1.0f, 0.0f));
+    Mat4 projection = perspective(radians(CAMERA_FOV_Y), app->aspect, 0.1f, 100.0f);
+    Mat4 mvp = projection * view * model;
+    f32 projection_scale = app->camera_view.projection_scale;
+
+    glEnable(GL_DEPTH_TEST);
+    glEnable(GL_CULL_FACE);
+    const MeshShader *shader = &app->mesh_shaders[mesh.vertex_format != VERTEX_FORMAT_FLOAT];
+    const VertexDequantization *dequantization = &mesh.dequantization;
+    glUseProgram(shader->program);
+    glUniformMatrix4fv(shader->mvp, 1, GL_FALSE, &mvp.e[0][0]);
+    glUniform1f(shader->textured, app->tex ? 1.0f : 0.0f);
+    glUniform3fv(shader->position_offset, 1, dequantization->position_offset.e);
+    glUniform3fv(shader->position_scale, 1, dequantization->position_scale.e);
+    glUniform2fv(shader->uv_offset, 1, dequantization->uv_offset.e);
+    glUniform2fv(shader->uv_scale, 1, dequantization->uv_scale.e);
+    glActiveTexture(GL_TEXTURE0);
+    glBindTexture(GL_TEXTURE_2D, app->tex);
+    glBindVertexArray(mesh.vao);
+
+    // Untimed when the GPU is more than DRAW_QUERY_FRAMES behind
+    u32 slot = (u32)(app->frame_number % DRAW_QUERY_FRAMES);
+    read_draw_time(app, slot);
+    bool timed = !app->draw_query_pending[slot];
+    if (timed)
+    {
+        glBeginQuery(GL_TIME_ELAPSED, app->draw_queries[slot]);
+    }
+
+    app->mesh_lod = select_lod(mesh.lods, mesh.lod_count, 1.0f / radius, length(eye), projection_scale,
+                               app->mesh_lod, app->lod_pixel_error);
+    app->draw_triangles = draw_lod(&mesh, app->mesh_lod);
+    app->draw_instances = 0;
+
+    // The objects are cubes, the mesh's bounding sphere goes around them
+    for (u32 i = 0; i < app->visible_count; ++i)
+    {
+        u32 object = app->visible_objects[i];
+        if (object >= app->mesh_instances)
+        {
+            continue;
+        }
+
+        Vec3 object_center = vec3(app->object_bounds.center.x[object], app->object_bounds.center.y[object],
+                                  app->object_bounds.center.z[object]);
+        f32 scale = app->object_bounds.radius[object] / radius;
+        f32 distance = length(object_center - app->camera_view.eye);
+        app->object_lods[object] = (u8)select_lod(mesh.lods, mesh.lod_count, scale, distance, projection_scale,
+                                                  app->object_lods[object], app->lod_pixel_error);
+
+        mvp = app->view_projection * translation(object_center) * scaling(vec3(scale, scale, scale))
+            * translation(-center);
+        glUniformMatrix4fv(shader->mvp, 1, GL_FALSE, &mvp.e[0][0]);
+        app->draw_triangles += draw_lod(&mesh, app->object_lods[object]);
+        ++app->draw_instances;
+    }
+
+    if (timed)
+    {
+        glEndQuery(GL_TIME_ELAPSED);
+        app->draw_query_pending[slot] = true;
+    }
+
+    glBindVertexArray(0);
 }
 
 
 void update(App *app)
 {
-    glClearColor(0.3f, 0.3f, 0.3f, 1.0f);
-    glClear(GL_COLOR_BUFFER_BIT);
-    SDL_GL_SwapWindow(app->window);
+    PROFILE_SCOPE("update");
+
+    reset_arena(&app->frame_arena);
+    ++app->frame_number;
+
+    {
+        PROFILE_SCOPE("cull");
+        cull_scene(app);
+    }
+
+    {
+        PROFILE_SCOPE("streaming");
+        update_streaming(&app->camera_view);
+        if (app->texture_asset)
+        {
+            app->tex = streamed_texture(app->texture_asset);
+        }
+    }
+
+    {
+        PROFILE_GPU_SCOPE("clear");
+        MEMORY_TAG_SCOPE(MEMORY_TAG_DRIVER);
+        glClearColor(0.3f, 0.3f, 0.3f, 1.0f);
+        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+    }
+
+    if (app->mesh_path || app->texture_path)
+    {
+        draw_mesh(app);
+    }
+
+    {
+        PROFILE_SCOPE("swap");
+        MEMORY_TAG_SCOPE(MEMORY_TAG_DRIVER);
+        SDL_GL_SwapWindow(app->window);
+    }
+
+    gladTraceFrame();
+    gl_debug_end_frame();
+    profile_end_frame();
+    memory_end_frame();
+}
+
+
+// Returns false once the benchmark has run all its frames
+bool record_bench_frame(App *app, u64 frame_start)
+{
+    if (app->frame_index++ < app->bench_warmup)
+    {
+        return true;
+    }
+
+    f64 frame_ms = (f64)(SDL_GetPerformanceCounter() - frame_start) * 1000.0
+                 / (f64)SDL_GetPerformanceFrequency();
+    if (app->timed_frames == 0 || frame_ms < app->frame_ms_min)
+    {
+        app->frame_ms_min = frame_ms;
+    }
+    if (frame_ms > app->frame_ms_max)
+    {
+        app->frame_ms_max = frame_ms;
+    }
+    app->frame_ms_total += frame_ms;
+    ++app->timed_frames;
+
+    app->steady_heap_allocs += memory_frame_heap_allocs();
+    app->visible_total += app->visible_count;
+    app->triangles_total += app->draw_triangles;
+    app->instances_total += app->draw_instances;
+
+    return app->timed_frames < app->bench_frames;
+}
+
+
+// Returns false when --fail-on-frame-alloc is set and the steady state
+// frames touched the heap
+bool report_bench(App *app)
+{
+    log_info("Benchmark: %u frames after %u warmup, %s build, %s kernels\n",
+             app->timed_frames, app->bench_warmup, BUILD_PROFILE, cpu_isa_name(app->isa));
+    if (app->timed_frames > 0)
+    {
+        log_info("  frame: %.3f ms mean, %.3f ms min, %.3f ms max\n",
+                 app->frame_ms_total / app->timed_frames,
+                 app->frame_ms_min,
+                 app->frame_ms_max);
+        log_info("  culling: %u objects, %.0f visible on average\n",
+                 app->object_count, (f64)app->visible_total / app->timed_frames);
+    }
+    if (app->draw_gpu_samples > 0)
+    {
+        log_info("  mesh draw: %.3f ms GPU mean over %u frames, %.0f triangles and %.0f instances a frame\n",
+                 app->draw_gpu_ms_total / app->draw_gpu_samples, app->draw_gpu_samples,
+                 (f64)app->triangles_total / app->timed_frames, (f64)app->instances_total / app->timed_frames);
+    }
+
+    const StreamStats *streamed = stream_stats();
+    if (streamed->total_bytes > 0 || streamed->failed > 0)
+    {
+        log_info("  streaming: %u resident, %u failed, %u waiting, %.1f MB uploaded, "
+                 "%.1f MB and %.2f ms peak frame, %u frames over %.2f ms\n",
+                 streamed->resident, streamed->failed, streamed->queued + streamed->loading,
+                 (f64)streamed->total_bytes / Megabytes(1),
+                 (f64)streamed->peak_frame_bytes / Megabytes(1), streamed->peak_frame_ms,
+                 streamed->over_budget_frames, app->upload_ms);
+    }
+
+    const TextureUploadStats *uploads = texture_upload_stats();
+    if (uploads->loaded + uploads->failed > 0)
+    {
+        log_info("  textures: %u loaded, %u failed, %.1f MB uploaded, %.1f MB peak frame, "
+                 "%u frames short of ring space\n",
+                 uploads->loaded, uploads->failed,
+                 (f64)uploads->total_bytes / Megabytes(1),
+                 (f64)uploads->peak_frame_bytes / Megabytes(1),
+                 uploads->ring_full_frames);
+    }
+    log_memory_report();
+
+    if (!memory_heap_tracked())
+    {
+        log_info("  heap: not tracked, build with HEAP_HOOKS=1\n");
+    }
+    log_info("  heap allocations in steady state frames (excluding driver): %llu\n",
+             (unsigned long long)app->steady_heap_allocs);
+
+    if (app->fail_on_frame_alloc && app->steady_heap_allocs > 0)
+    {
+        log_error("FAIL: heap allocations inside the frame loop\n");
+        return false;
+    }
+    return true;
 }
 
 
 int main(int argc, char *argv[])
 {
     App app = {};
+    app.gl_trace_frames = 60;
+    app.bench_warmup = 60;
+    app.object_count = 100000;
+    app.upload_budget_mb = (f64)STREAM_UPLOAD_BUDGET / Megabytes(1);
+    app.upload_ms = STREAM_UPLOAD_MS;
+    app.mesh_instances = 1000;
+    app.lod_pixel_error = LOD_PIXEL_ERROR;
+    app.format_name = "unorm16";
 
-    log("Initializing...\n");
+    for (int i = 1; i < argc; ++i)
+    {
+        if (strcmp(argv[i], "--gl-profile") == 0)
+        {
+            app.gl_profile = true;
+        }
+        else if (strcmp(argv[i], "--gl-trace") == 0 && i + 1 < argc)
+        {
+            app.gl_trace_path = argv[++i];
+        }
+        else if (strcmp(argv[i], "--gl-trace-frames") == 0 && i + 1 < argc)
+        {
+            app.gl_trace_frames = (u32)atoi(argv[++i]);
+        }
+        else if (strcmp(argv[i], "--profile") == 0 && i + 1 < argc)
+        {
+            app.profile_path = argv[++i];
+        }
+        else if (strcmp(argv[i], "--bench-frames") == 0 && i + 1 < argc)
+        {
+            app.bench_frames = (u32)atoi(argv[++i]);
+        }
+        else if (strcmp(argv[i], "--bench-warmup") == 0 && i + 1 < argc)
+        {
+            app.bench_warmup = (u32)atoi(argv[++i]);
+        }
+        else if (strcmp(argv[i], "--fail-on-frame-alloc") == 0)
+        {
+            app.fail_on_frame_alloc = true;
+        }
+        else if (strcmp(argv[i], "--isa") == 0 && i + 1 < argc)
+        {
+            app.isa_name = argv[++i];
+        }
+        else if (strcmp(argv[i], "--objects") == 0 && i + 1 < argc)
+        {
+            app.object_count = (u32)atoi(argv[++i]);
+        }
+        else if (strcmp(argv[i], "--texture") == 0 && i + 1 < argc)
+        {
+            app.texture_path = argv[++i];
+        }
+        else if (strcmp(argv[i], "--upload-budget") == 0 && i + 1 < argc)
+        {
+            app.upload_budget_mb = atof(argv[++i]);
+        }
+        else if (strcmp(argv[i], "--upload-ms") == 0 && i + 1 < argc)
+        {
+            app.upload_ms = atof(argv[++i]);
+        }
+        else if (strcmp(argv[i], "--mesh") == 0 && i + 1 < argc)
+        {
+            app.mesh_path = argv[++i];
+        }
+        else if (strcmp(argv[i], "--mesh-instances") == 0 && i + 1 < argc)
+        {
+            app.mesh_instances = (u32)atoi(argv[++i]);
+        }
+        else if (strcmp(argv[i], "--lod-error") == 0 && i + 1 < argc)
+        {
+            app.lod_pixel_error = (f32)atof(argv[++i]);
+        }
+        else if (strcmp(argv[i], "--vertex-format") == 0 && i + 1 < argc)
+        {
+            app.format_name = argv[++i];
+        }
+    }
+
+    init_log();
+
+    if (app.profile_path)
+    {
+        profile_begin_capture();
+    }
+
+    log_info("Initializing...\n");
     if (!init(&app))
     {
+        shutdown_log();
         return 1;
     }
 
-    log("Starting...\n");
+    log_info("Starting...\n");
 
     bool should_run = true;
     while (should_run)
     {
-        SDL_Event event;
-        while (SDL_PollEvent(&event)) {
-            if (event.type == SDL_WINDOWEVENT
-                && event.window.event == SDL_WINDOWEVENT_CLOSE)
-            {
-                should_run = 0;
-                break;
+        PROFILE_SCOPE("frame");
+        u64 frame_start = SDL_GetPerformanceCounter();
+
+        {
+            PROFILE_SCOPE("events");
+            MEMORY_TAG_SCOPE(MEMORY_TAG_DRIVER);
+            SDL_Event event;
+            while (SDL_PollEvent(&event)) {
+                if (event.type == SDL_WINDOWEVENT
+                    && event.window.event == SDL_WINDOWEVENT_CLOSE)
+                {
+                    should_run = 0;
+                    break;
+                }
+                // F9 writes the capture so far without stopping it
+                if (event.type == SDL_KEYDOWN
+                    && event.key.keysym.sym == SDLK_F9
+                    && app.profile_path)
+                {
+                    profile_dump(app.profile_path);
+                    log_info("Profile written to %s\n", app.profile_path);
+                }
             }
         }
 
         update(&app);
+
+        if (app.bench_frames && !record_bench_frame(&app, frame_start))
+        {
+            should_run = false;
+        }
+    }
+
+    int result = 0;
+    if (app.bench_frames && !report_bench(&app))
+    {
+        result = 2;
     }
 
-    log("Exiting...\n");
+    log_info("Exiting...\n");
     cleanup(&app);
+    shutdown_log();
 
-    return 0;
+    return result;
 }
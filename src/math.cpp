@@ -0,0 +1,395 @@
+#include "math.hpp"
+
+
+// The batch kernels come in one variant per CpuIsa, picked at runtime by
+// select_math_kernels(). Points are done 4/8/16 per register; matrices one
+// column per SSE register, two per AVX2 and all four per AVX-512 register.
+
+
+Mat4 inverse(const Mat4 &m)
+{
+    const f32 *a = &m.e[0][0];
+    f32 c[16];
+
+    c[0] = a[5] * a[10] * a[15] - a[5] * a[11] * a[14] - a[9] * a[6] * a[15]
+         + a[9] * a[7] * a[14] + a[13] * a[6] * a[11] - a[13] * a[7] * a[10];
+    c[4] = -a[4] * a[10] * a[15] + a[4] * a[11] * a[14] + a[8] * a[6] * a[15]
+         - a[8] * a[7] * a[14] - a[12] * a[6] * a[11] + a[12] * a[7] * a[10];
+    c[8] = a[4] * a[9] * a[15] - a[4] * a[11] * a[13] - a[8] * a[5] * a[15]
+         + a[8] * a[7] * a[13] + a[12] * a[5] * a[11] - a[12] * a[7] * a[9];
+    c[12] = -a[4] * a[9] * a[14] + a[4] * a[10] * a[13] + a[8] * a[5] * a[14]
+          - a[8] * a[6] * a[13] - a[12] * a[5] * a[10] + a[12] * a[6] * a[9];
+    c[1] = -a[1] * a[10] * a[15] + a[1] * a[11] * a[14] + a[9] * a[2] * a[15]
+         - a[9] * a[3] * a[14] - a[13] * a[2] * a[11] + a[13] * a[3] * a[10];
+    c[5] = a[0] * a[10] * a[15] - a[0] * a[11] * a[14] - a[8] * a[2] * a[15]
+         + a[8] * a[3] * a[14] + a[12] * a[2] * a[11] - a[12] * a[3] * a[10];
+    c[9] = -a[0] * a[9] * a[15] + a[0] * a[11] * a[13] + a[8] * a[1] * a[15]
+         - a[8] * a[3] * a[13] - a[12] * a[1] * a[11] + a[12] * a[3] * a[9];
+    c[13] = a[0] * a[9] * a[14] - a[0] * a[10] * a[13] - a[8] * a[1] * a[14]
+          + a[8] * a[2] * a[13] + a[12] * a[1] * a[10] - a[12] * a[2] * a[9];
+    c[2] = a[1] * a[6] * a[15] - a[1] * a[7] * a[14] - a[5] * a[2] * a[15]
+         + a[5] * a[3] * a[14] + a[13] * a[2] * a[7] - a[13] * a[3] * a[6];
+    c[6] = -a[0] * a[6] * a[15] + a[0] * a[7] * a[14] + a[4] * a[2] * a[15]
+         - a[4] * a[3] * a[14] - a[12] * a[2] * a[7] + a[12] * a[3] * a[6];
+    c[10] = a[0] * a[5] * a[15] - a[0] * a[7] * a[13] - a[4] * a[1] * a[15]
+          + a[4] * a[3] * a[13] + a[12] * a[1] * a[7] - a[12] * a[3] * a[5];
+    c[14] = -a[0] * a[5] * a[14] + a[0] * a[6] * a[13] + a[4] * a[1] * a[14]
+          - a[4] * a[2] * a[13] - a[12] * a[1] * a[6] + a[12] * a[2] * a[5];
+    c[3] = -a[1] * a[6] * a[11] + a[1] * a[7] * a[10] + a[5] * a[2] * a[11]
+         - a[5] * a[3] * a[10] - a[9] * a[2] * a[7] + a[9] * a[3] * a[6];
+    c[7] = a[0] * a[6] * a[11] - a[0] * a[7] * a[10] - a[4] * a[2] * a[11]
+         + a[4] * a[3] * a[10] + a[8] * a[2] * a[7] - a[8] * a[3] * a[6];
+    c[11] = -a[0] * a[5] * a[11] + a[0] * a[7] * a[9] + a[4] * a[1] * a[11]
+          - a[4] * a[3] * a[9] - a[8] * a[1] * a[7] + a[8] * a[3] * a[5];
+    c[15] = a[0] * a[5] * a[10] - a[0] * a[6] * a[9] - a[4] * a[1] * a[10]
+          + a[4] * a[2] * a[9] + a[8] * a[1] * a[6] - a[8] * a[2] * a[5];
+
+    f32 inverse_determinant = 1.0f / (a[0] * c[0] + a[1] * c[4] + a[2] * c[8] + a[3] * c[12]);
+
+    Mat4 result;
+    f32 *r = &result.e[0][0];
+    for (u32 i = 0; i < 16; ++i)
+    {
+        r[i] = c[i] * inverse_determinant;
+    }
+    return result;
+}
+
+
+// Scalar ######################################################################
+
+
+void transform_points_soa_scalar(const Mat4 *matrix, Vec3SoA points, Vec3SoA result, u32 count)
+{
+    const f32 (*m)[4] = matrix->e;
+    for (u32 i = 0; i < count; ++i)
+    {
+        f32 x = points.x[i];
+        f32 y = points.y[i];
+        f32 z = points.z[i];
+        result.x[i] = m[0][0] * x + m[1][0] * y + m[2][0] * z + m[3][0];
+        result.y[i] = m[0][1] * x + m[1][1] * y + m[2][1] * z + m[3][1];
+        result.z[i] = m[0][2] * x + m[1][2] * y + m[2][2] * z + m[3][2];
+    }
+}
+
+
+inline void multiply_mat4_scalar(Mat4 *result, const Mat4 *a, const Mat4 *b)
+{
+    Mat4 product;
+    for (u32 column = 0; column < 4; ++column)
+    {
+        for (u32 row = 0; row < 4; ++row)
+        {
+            product.e[column][row] = a->e[0][row] * b->e[column][0]
+                                   + a->e[1][row] * b->e[column][1]
+                                   + a->e[2][row] * b->e[column][2]
+                                   + a->e[3][row] * b->e[column][3];
+        }
+    }
+    *result = product;
+}
+
+
+void multiply_mat4_batch_scalar(Mat4 *result, const Mat4 *a, const Mat4 *b, u32 count)
+{
+    for (u32 i = 0; i < count; ++i)
+    {
+        multiply_mat4_scalar(&result[i], &a[i], &b[i]);
+    }
+}
+
+
+void compute_mvp_batch_scalar(Mat4 *result, const Mat4 *view_projection, const Mat4 *models, u32 count)
+{
+    for (u32 i = 0; i < count; ++i)
+    {
+        multiply_mat4_scalar(&result[i], view_projection, &models[i]);
+    }
+}
+
+
+// SSE2 ########################################################################
+
+
+internal void transform_points_soa_sse2(const Mat4 *matrix, Vec3SoA points, Vec3SoA result, u32 count)
+{
+    const f32 (*m)[4] = matrix->e;
+    __m128 m00 = _mm_set1_ps(m[0][0]), m10 = _mm_set1_ps(m[1][0]);
+    __m128 m20 = _mm_set1_ps(m[2][0]), m30 = _mm_set1_ps(m[3][0]);
+    __m128 m01 = _mm_set1_ps(m[0][1]), m11 = _mm_set1_ps(m[1][1]);
+    __m128 m21 = _mm_set1_ps(m[2][1]), m31 = _mm_set1_ps(m[3][1]);
+    __m128 m02 = _mm_set1_ps(m[0][2]), m12 = _mm_set1_ps(m[1][2]);
+    __m128 m22 = _mm_set1_ps(m[2][2]), m32 = _mm_set1_ps(m[3][2]);
+
+    u32 i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128 x = _mm_loadu_ps(points.x + i);
+        __m128 y = _mm_loadu_ps(points.y + i);
+        __m128 z = _mm_loadu_ps(points.z + i);
+
+        __m128 rx = _mm_add_ps(_mm_add_ps(_mm_mul_ps(m00, x), _mm_mul_ps(m10, y)),
+                               _mm_add_ps(_mm_mul_ps(m20, z), m30));
+        __m128 ry = _mm_add_ps(_mm_add_ps(_mm_mul_ps(m01, x), _mm_mul_ps(m11, y)),
+                               _mm_add_ps(_mm_mul_ps(m21, z), m31));
+        __m128 rz = _mm_add_ps(_mm_add_ps(_mm_mul_ps(m02, x), _mm_mul_ps(m12, y)),
+                               _mm_add_ps(_mm_mul_ps(m22, z), m32));
+
+        _mm_storeu_ps(result.x + i, rx);
+        _mm_storeu_ps(result.y + i, ry);
+        _mm_storeu_ps(result.z + i, rz);
+    }
+
+    transform_points_soa_scalar(matrix, offset_soa(points, i), offset_soa(result, i), count - i);
+}
+
+
+internal void multiply_mat4_batch_sse2(Mat4 *result, const Mat4 *a, const Mat4 *b, u32 count)
+{
+    for (u32 i = 0; i < count; ++i)
+    {
+        result[i] = a[i] * b[i];
+    }
+}
+
+
+internal void compute_mvp_batch_sse2(Mat4 *result, const Mat4 *view_projection, const Mat4 *models, u32 count)
+{
+    Mat4 vp = *view_projection;
+    for (u32 i = 0; i < count; ++i)
+    {
+        result[i] = vp * models[i];
+    }
+}
+
+
+// AVX2 ########################################################################
+
+
+// Multiplies a (each column broadcast to both halves) with two columns of b
+TARGET_AVX2
+inline __m256 mat4_mul_column_pair(__m256 a0, __m256 a1, __m256 a2, __m256 a3, __m256 columns)
+{
+    __m256 result = _mm256_mul_ps(a0, _mm256_shuffle_ps(columns, columns, _MM_SHUFFLE(0, 0, 0, 0)));
+    result = _mm256_fmadd_ps(a1, _mm256_shuffle_ps(columns, columns, _MM_SHUFFLE(1, 1, 1, 1)), result);
+    result = _mm256_fmadd_ps(a2, _mm256_shuffle_ps(columns, columns, _MM_SHUFFLE(2, 2, 2, 2)), result);
+    result = _mm256_fmadd_ps(a3, _mm256_shuffle_ps(columns, columns, _MM_SHUFFLE(3, 3, 3, 3)), result);
+    return result;
+}
+
+
+TARGET_AVX2
+internal void transform_points_soa_avx2(const Mat4 *matrix, Vec3SoA points, Vec3SoA result, u32 count)
+{
+    const f32 (*m)[4] = matrix->e;
+    __m256 m00 = _mm256_set1_ps(m[0][0]), m10 = _mm256_set1_ps(m[1][0]);
+    __m256 m20 = _mm256_set1_ps(m[2][0]), m30 = _mm256_set1_ps(m[3][0]);
+    __m256 m01 = _mm256_set1_ps(m[0][1]), m11 = _mm256_set1_ps(m[1][1]);
+    __m256 m21 = _mm256_set1_ps(m[2][1]), m31 = _mm256_set1_ps(m[3][1]);
+    __m256 m02 = _mm256_set1_ps(m[0][2]), m12 = _mm256_set1_ps(m[1][2]);
+    __m256 m22 = _mm256_set1_ps(m[2][2]), m32 = _mm256_set1_ps(m[3][2]);
+
+    u32 i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        __m256 x = _mm256_loadu_ps(points.x + i);
+        __m256 y = _mm256_loadu_ps(points.y + i);
+        __m256 z = _mm256_loadu_ps(points.z + i);
+
+        __m256 rx = _mm256_fmadd_ps(m00, x, _mm256_fmadd_ps(m10, y, _mm256_fmadd_ps(m20, z, m30)));
+        __m256 ry = _mm256_fmadd_ps(m01, x, _mm256_fmadd_ps(m11, y, _mm256_fmadd_ps(m21, z, m31)));
+        __m256 rz = _mm256_fmadd_ps(m02, x, _mm256_fmadd_ps(m12, y, _mm256_fmadd_ps(m22, z, m32)));
+
+        _mm256_storeu_ps(result.x + i, rx);
+        _mm256_storeu_ps(result.y + i, ry);
+        _mm256_storeu_ps(result.z + i, rz);
+    }
+
+    transform_points_soa_sse2(matrix, offset_soa(points, i), offset_soa(result, i), count - i);
+}
+
+
+TARGET_AVX2
+internal void multiply_mat4_batch_avx2(Mat4 *result, const Mat4 *a, const Mat4 *b, u32 count)
+{
+    for (u32 i = 0; i < count; ++i)
+    {
+        __m256 a0 = _mm256_broadcast_ps(&a[i].columns[0].m);
+        __m256 a1 = _mm256_broadcast_ps(&a[i].columns[1].m);
+        __m256 a2 = _mm256_broadcast_ps(&a[i].columns[2].m);
+        __m256 a3 = _mm256_broadcast_ps(&a[i].columns[3].m);
+        __m256 b01 = _mm256_loadu_ps(&b[i].e[0][0]);
+        __m256 b23 = _mm256_loadu_ps(&b[i].e[2][0]);
+
+        _mm256_storeu_ps(&result[i].e[0][0], mat4_mul_column_pair(a0, a1, a2, a3, b01));
+        _mm256_storeu_ps(&result[i].e[2][0], mat4_mul_column_pair(a0, a1, a2, a3, b23));
+    }
+}
+
+
+TARGET_AVX2
+internal void compute_mvp_batch_avx2(Mat4 *result, const Mat4 *view_projection, const Mat4 *models, u32 count)
+{
+    __m256 vp0 = _mm256_broadcast_ps(&view_projection->columns[0].m);
+    __m256 vp1 = _mm256_broadcast_ps(&view_projection->columns[1].m);
+    __m256 vp2 = _mm256_broadcast_ps(&view_projection->columns[2].m);
+    __m256 vp3 = _mm256_broadcast_ps(&view_projection->columns[3].m);
+
+    for (u32 i = 0; i < count; ++i)
+    {
+        __m256 m01 = _mm256_loadu_ps(&models[i].e[0][0]);
+        __m256 m23 = _mm256_loadu_ps(&models[i].e[2][0]);
+
+        _mm256_storeu_ps(&result[i].e[0][0], mat4_mul_column_pair(vp0, vp1, vp2, vp3, m01));
+        _mm256_storeu_ps(&result[i].e[2][0], mat4_mul_column_pair(vp0, vp1, vp2, vp3, m23));
+    }
+}
+
+
+// AVX-512 #####################################################################
+
+
+// GCC 12's AVX-512 intrinsics trip -Wmaybe-uninitialized on their own
+// _mm512_undefined_ps() (GCC bug 105593)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+
+
+// Multiplies a (each column broadcast to all four lanes) with all of b
+TARGET_AVX512
+inline __m512 mat4_mul_columns(__m512 a0, __m512 a1, __m512 a2, __m512 a3, __m512 columns)
+{
+    __m512 result = _mm512_mul_ps(a0, _mm512_permute_ps(columns, _MM_SHUFFLE(0, 0, 0, 0)));
+    result = _mm512_fmadd_ps(a1, _mm512_permute_ps(columns, _MM_SHUFFLE(1, 1, 1, 1)), result);
+    result = _mm512_fmadd_ps(a2, _mm512_permute_ps(columns, _MM_SHUFFLE(2, 2, 2, 2)), result);
+    result = _mm512_fmadd_ps(a3, _mm512_permute_ps(columns, _MM_SHUFFLE(3, 3, 3, 3)), result);
+    return result;
+}
+
+
+TARGET_AVX512
+internal void transform_points_soa_avx512(const Mat4 *matrix, Vec3SoA points, Vec3SoA result, u32 count)
+{
+    const f32 (*m)[4] = matrix->e;
+    __m512 m00 = _mm512_set1_ps(m[0][0]), m10 = _mm512_set1_ps(m[1][0]);
+    __m512 m20 = _mm512_set1_ps(m[2][0]), m30 = _mm512_set1_ps(m[3][0]);
+    __m512 m01 = _mm512_set1_ps(m[0][1]), m11 = _mm512_set1_ps(m[1][1]);
+    __m512 m21 = _mm512_set1_ps(m[2][1]), m31 = _mm512_set1_ps(m[3][1]);
+    __m512 m02 = _mm512_set1_ps(m[0][2]), m12 = _mm512_set1_ps(m[1][2]);
+    __m512 m22 = _mm512_set1_ps(m[2][2]), m32 = _mm512_set1_ps(m[3][2]);
+
+    u32 i = 0;
+    for (; i + 16 <= count; i += 16)
+    {
+        __m512 x = _mm512_loadu_ps(points.x + i);
+        __m512 y = _mm512_loadu_ps(points.y + i);
+        __m512 z = _mm512_loadu_ps(points.z + i);
+
+        __m512 rx = _mm512_fmadd_ps(m00, x, _mm512_fmadd_ps(m10, y, _mm512_fmadd_ps(m20, z, m30)));
+        __m512 ry = _mm512_fmadd_ps(m01, x, _mm512_fmadd_ps(m11, y, _mm512_fmadd_ps(m21, z, m31)));
+        __m512 rz = _mm512_fmadd_ps(m02, x, _mm512_fmadd_ps(m12, y, _mm512_fmadd_ps(m22, z, m32)));
+
+        _mm512_storeu_ps(result.x + i, rx);
+        _mm512_storeu_ps(result.y + i, ry);
+        _mm512_storeu_ps(result.z + i, rz);
+    }
+
+    transform_points_soa_avx2(matrix, offset_soa(points, i), offset_soa(result, i), count - i);
+}
+
+
+TARGET_AVX512
+internal void multiply_mat4_batch_avx512(Mat4 *result, const Mat4 *a, const Mat4 *b, u32 count)
+{
+    for (u32 i = 0; i < count; ++i)
+    {
+        __m512 a0 = _mm512_broadcast_f32x4(a[i].columns[0].m);
+        __m512 a1 = _mm512_broadcast_f32x4(a[i].columns[1].m);
+        __m512 a2 = _mm512_broadcast_f32x4(a[i].columns[2].m);
+        __m512 a3 = _mm512_broadcast_f32x4(a[i].columns[3].m);
+        __m512 columns = _mm512_loadu_ps(&b[i].e[0][0]);
+
+        _mm512_storeu_ps(&result[i].e[0][0], mat4_mul_columns(a0, a1, a2, a3, columns));
+    }
+}
+
+
+TARGET_AVX512
+internal void compute_mvp_batch_avx512(Mat4 *result, const Mat4 *view_projection, const Mat4 *models, u32 count)
+{
+    __m512 vp0 = _mm512_broadcast_f32x4(view_projection->columns[0].m);
+    __m512 vp1 = _mm512_broadcast_f32x4(view_projection->columns[1].m);
+    __m512 vp2 = _mm512_broadcast_f32x4(view_projection->columns[2].m);
+    __m512 vp3 = _mm512_broadcast_f32x4(view_projection->columns[3].m);
+
+    for (u32 i = 0; i < count; ++i)
+    {
+        __m512 columns = _mm512_loadu_ps(&models[i].e[0][0]);
+        _mm512_storeu_ps(&result[i].e[0][0], mat4_mul_columns(vp0, vp1, vp2, vp3, columns));
+    }
+}
+
+
+#pragma GCC diagnostic pop
+
+
+// Dispatch ####################################################################
+
+
+struct MathKernels
+{
+    CpuIsa isa;
+    void (*transform_points_soa)(const Mat4 *, Vec3SoA, Vec3SoA, u32);
+    void (*multiply_mat4_batch)(Mat4 *, const Mat4 *, const Mat4 *, u32);
+    void (*compute_mvp_batch)(Mat4 *, const Mat4 *, const Mat4 *, u32);
+};
+
+
+global_variable const MathKernels math_kernel_table[CPU_ISA_COUNT] =
+{
+    {CPU_ISA_SCALAR, transform_points_soa_scalar, multiply_mat4_batch_scalar, compute_mvp_batch_scalar},
+    {CPU_ISA_SSE2, transform_points_soa_sse2, multiply_mat4_batch_sse2, compute_mvp_batch_sse2},
+    {CPU_ISA_AVX2, transform_points_soa_avx2, multiply_mat4_batch_avx2, compute_mvp_batch_avx2},
+    {CPU_ISA_AVX512, transform_points_soa_avx512, multiply_mat4_batch_avx512, compute_mvp_batch_avx512},
+};
+
+
+// Baseline until select_math_kernels() runs
+global_variable MathKernels math_kernels = math_kernel_table[CPU_ISA_SSE2];
+
+
+bool select_math_kernels(CpuIsa isa)
+{
+    if (!cpu_isa_supported(isa))
+    {
+        return false;
+    }
+    math_kernels = math_kernel_table[isa];
+    return true;
+}
+
+
+CpuIsa math_kernels_isa()
+{
+    return math_kernels.isa;
+}
+
+
+void transform_points_soa(const Mat4 *matrix, Vec3SoA points, Vec3SoA result, u32 count)
+{
+    math_kernels.transform_points_soa(matrix, points, result, count);
+}
+
+
+void multiply_mat4_batch(Mat4 *result, const Mat4 *a, const Mat4 *b, u32 count)
+{
+    math_kernels.multiply_mat4_batch(result, a, b, count);
+}
+
+
+void compute_mvp_batch(Mat4 *result, const Mat4 *view_projection, const Mat4 *models, u32 count)
+{
+    math_kernels.compute_mvp_batch(result, view_projection, models, count);
+}
@@ -0,0 +1,696 @@
+#pragma once
+
+#include <math.h>
+#include <immintrin.h>
+
+#include "platform.hpp"
+#include "cpu.hpp"
+
+
+// Vector, matrix and quaternion math.
+//
+// Matrices are column-major and act on column vectors, like GL and glm:
+// e[column][row], and columns[i] is the i-th column. Clip space is GL's
+// (right-handed view space, z in [-1, 1]). Angles are in radians.
+//
+// Vec4, Mat4 and Quat are 16 byte aligned and use SSE (the x86-64 baseline).
+// The batch kernels at the bottom work on many objects per call and are
+// dispatched at runtime to the widest instruction set available.
+
+
+#define PI32 3.14159265359f
+
+
+inline f32 radians(f32 degrees)
+{
+    return degrees * (PI32 / 180.0f);
+}
+
+
+inline f32 lerp(f32 a, f32 t, f32 b)
+{
+    return a + t * (b - a);
+}
+
+
+inline f32 clamp(f32 min, f32 value, f32 max)
+{
+    return value < min ? min : (value > max ? max : value);
+}
+
+
+// Types #######################################################################
+
+
+union Vec2
+{
+    struct
+    {
+        f32 x, y;
+    };
+    f32 e[2];
+};
+
+
+union Vec3
+{
+    struct
+    {
+        f32 x, y, z;
+    };
+    struct
+    {
+        f32 r, g, b;
+    };
+    struct
+    {
+        Vec2 xy;
+        f32 ignored0_;
+    };
+    f32 e[3];
+};
+
+
+union Vec4
+{
+    struct
+    {
+        f32 x, y, z, w;
+    };
+    struct
+    {
+        f32 r, g, b, a;
+    };
+    struct
+    {
+        Vec3 xyz;
+        f32 ignored0_;
+    };
+    f32 e[4];
+    __m128 m;
+};
+
+
+union Quat
+{
+    struct
+    {
+        f32 x, y, z, w;
+    };
+    struct
+    {
+        Vec3 xyz;
+        f32 ignored0_;
+    };
+    f32 e[4];
+    __m128 m;
+};
+
+
+union Mat3
+{
+    Vec3 columns[3];
+    f32 e[3][3];
+};
+
+
+union Mat4
+{
+    Vec4 columns[4];
+    f32 e[4][4];
+};
+
+
+inline Vec2 vec2(f32 x, f32 y)
+{
+    Vec2 result;
+    result.x = x;
+    result.y = y;
+    return result;
+}
+
+
+inline Vec3 vec3(f32 x, f32 y, f32 z)
+{
+    Vec3 result;
+    result.x = x;
+    result.y = y;
+    result.z = z;
+    return result;
+}
+
+
+inline Vec3 vec3(Vec2 xy, f32 z)
+{
+    return vec3(xy.x, xy.y, z);
+}
+
+
+inline Vec4 vec4(f32 x, f32 y, f32 z, f32 w)
+{
+    Vec4 result;
+    result.m = _mm_setr_ps(x, y, z, w);
+    return result;
+}
+
+
+inline Vec4 vec4(Vec3 xyz, f32 w)
+{
+    return vec4(xyz.x, xyz.y, xyz.z, w);
+}
+
+
+inline Vec4 vec4(__m128 m)
+{
+    Vec4 result;
+    result.m = m;
+    return result;
+}
+
+
+inline Quat quat(f32 x, f32 y, f32 z, f32 w)
+{
+    Quat result;
+    result.m = _mm_setr_ps(x, y, z, w);
+    return result;
+}
+
+
+// Vec2 ########################################################################
+
+
+inline Vec2 operator+(Vec2 a, Vec2 b) { return vec2(a.x + b.x, a.y + b.y); }
+inline Vec2 operator-(Vec2 a, Vec2 b) { return vec2(a.x - b.x, a.y - b.y); }
+inline Vec2 operator-(Vec2 a) { return vec2(-a.x, -a.y); }
+inline Vec2 operator*(Vec2 a, f32 s) { return vec2(a.x * s, a.y * s); }
+inline Vec2 operator*(f32 s, Vec2 a) { return a * s; }
+inline Vec2 operator/(Vec2 a, f32 s) { return a * (1.0f / s); }
+inline Vec2 &operator+=(Vec2 &a, Vec2 b) { return a = a + b; }
+inline Vec2 &operator-=(Vec2 &a, Vec2 b) { return a = a - b; }
+inline Vec2 &operator*=(Vec2 &a, f32 s) { return a = a * s; }
+
+
+inline Vec2 hadamard(Vec2 a, Vec2 b) { return vec2(a.x * b.x, a.y * b.y); }
+inline f32 dot(Vec2 a, Vec2 b) { return a.x * b.x + a.y * b.y; }
+inline f32 length_squared(Vec2 a) { return dot(a, a); }
+inline f32 length(Vec2 a) { return sqrtf(dot(a, a)); }
+inline Vec2 normalize(Vec2 a) { return a * (1.0f / length(a)); }
+inline Vec2 lerp(Vec2 a, f32 t, Vec2 b) { return a + t * (b - a); }
+
+
+// Vec3 ########################################################################
+
+
+inline Vec3 operator+(Vec3 a, Vec3 b) { return vec3(a.x + b.x, a.y + b.y, a.z + b.z); }
+inline Vec3 operator-(Vec3 a, Vec3 b) { return vec3(a.x - b.x, a.y - b.y, a.z - b.z); }
+inline Vec3 operator-(Vec3 a) { return vec3(-a.x, -a.y, -a.z); }
+inline Vec3 operator*(Vec3 a, f32 s) { return vec3(a.x * s, a.y * s, a.z * s); }
+inline Vec3 operator*(f32 s, Vec3 a) { return a * s; }
+inline Vec3 operator/(Vec3 a, f32 s) { return a * (1.0f / s); }
+inline Vec3 &operator+=(Vec3 &a, Vec3 b) { return a = a + b; }
+inline Vec3 &operator-=(Vec3 &a, Vec3 b) { return a = a - b; }
+inline Vec3 &operator*=(Vec3 &a, f32 s) { return a = a * s; }
+
+
+inline Vec3 hadamard(Vec3 a, Vec3 b) { return vec3(a.x * b.x, a.y * b.y, a.z * b.z); }
+inline f32 dot(Vec3 a, Vec3 b) { return a.x * b.x + a.y * b.y + a.z * b.z; }
+inline f32 length_squared(Vec3 a) { return dot(a, a); }
+inline f32 length(Vec3 a) { return sqrtf(dot(a, a)); }
+inline Vec3 normalize(Vec3 a) { return a * (1.0f / length(a)); }
+inline Vec3 lerp(Vec3 a, f32 t, Vec3 b) { return a + t * (b - a); }
+
+
+inline Vec3 cross(Vec3 a, Vec3 b)
+{
+    return vec3(a.y * b.z - a.z * b.y,
+                a.z * b.x - a.x * b.z,
+                a.x * b.y - a.y * b.x);
+}
+
+
+inline Vec3 min(Vec3 a, Vec3 b)
+{
+    return vec3(fminf(a.x, b.x), fminf(a.y, b.y), fminf(a.z, b.z));
+}
+
+
+inline Vec3 max(Vec3 a, Vec3 b)
+{
+    return vec3(fmaxf(a.x, b.x), fmaxf(a.y, b.y), fmaxf(a.z, b.z));
+}
+
+
+// Vec4 ########################################################################
+
+
+inline Vec4 operator+(Vec4 a, Vec4 b) { return vec4(_mm_add_ps(a.m, b.m)); }
+inline Vec4 operator-(Vec4 a, Vec4 b) { return vec4(_mm_sub_ps(a.m, b.m)); }
+inline Vec4 operator-(Vec4 a) { return vec4(_mm_sub_ps(_mm_setzero_ps(), a.m)); }
+inline Vec4 operator*(Vec4 a, f32 s) { return vec4(_mm_mul_ps(a.m, _mm_set1_ps(s))); }
+inline Vec4 operator*(f32 s, Vec4 a) { return a * s; }
+inline Vec4 operator/(Vec4 a, f32 s) { return a * (1.0f / s); }
+inline Vec4 &operator+=(Vec4 &a, Vec4 b) { return a = a + b; }
+inline Vec4 &operator-=(Vec4 &a, Vec4 b) { return a = a - b; }
+inline Vec4 &operator*=(Vec4 &a, f32 s) { return a = a * s; }
+
+
+inline Vec4 hadamard(Vec4 a, Vec4 b) { return vec4(_mm_mul_ps(a.m, b.m)); }
+
+
+inline f32 dot(Vec4 a, Vec4 b)
+{
+    __m128 product = _mm_mul_ps(a.m, b.m);
+    __m128 pairs = _mm_add_ps(product, _mm_shuffle_ps(product, product, _MM_SHUFFLE(2, 3, 0, 1)));
+    __m128 sum = _mm_add_ss(pairs, _mm_movehl_ps(pairs, pairs));
+    return _mm_cvtss_f32(sum);
+}
+
+
+inline f32 length_squared(Vec4 a) { return dot(a, a); }
+inline f32 length(Vec4 a) { return sqrtf(dot(a, a)); }
+inline Vec4 normalize(Vec4 a) { return a * (1.0f / length(a)); }
+inline Vec4 lerp(Vec4 a, f32 t, Vec4 b) { return a + t * (b - a); }
+
+
+// Quat ########################################################################
+
+
+inline Quat identity_quat()
+{
+    return quat(0.0f, 0.0f, 0.0f, 1.0f);
+}
+
+
+// `axis` must be normalized.
+inline Quat quat_from_axis_angle(Vec3 axis, f32 angle)
+{
+    f32 s = sinf(0.5f * angle);
+    return quat(axis.x * s, axis.y * s, axis.z * s, cosf(0.5f * angle));
+}
+
+
+// Hamilton product, applies b first and then a.
+inline Quat operator*(Quat a, Quat b)
+{
+    __m128 ax = _mm_shuffle_ps(a.m, a.m, _MM_SHUFFLE(0, 0, 0, 0));
+    __m128 ay = _mm_shuffle_ps(a.m, a.m, _MM_SHUFFLE(1, 1, 1, 1));
+    __m128 az = _mm_shuffle_ps(a.m, a.m, _MM_SHUFFLE(2, 2, 2, 2));
+    __m128 aw = _mm_shuffle_ps(a.m, a.m, _MM_SHUFFLE(3, 3, 3, 3));
+
+    // (b.w, -b.z, b.y, -b.x), (b.z, b.w, -b.x, -b.y), (-b.y, b.x, b.w, -b.z)
+    __m128 bx = _mm_xor_ps(_mm_shuffle_ps(b.m, b.m, _MM_SHUFFLE(0, 1, 2, 3)),
+                           _mm_setr_ps(0.0f, -0.0f, 0.0f, -0.0f));
+    __m128 by = _mm_xor_ps(_mm_shuffle_ps(b.m, b.m, _MM_SHUFFLE(1, 0, 3, 2)),
+                           _mm_setr_ps(0.0f, 0.0f, -0.0f, -0.0f));
+    __m128 bz = _mm_xor_ps(_mm_shuffle_ps(b.m, b.m, _MM_SHUFFLE(2, 3, 0, 1)),
+                           _mm_setr_ps(-0.0f, 0.0f, 0.0f, -0.0f));
+
+    Quat result;
+    result.m = _mm_add_ps(_mm_add_ps(_mm_mul_ps(aw, b.m), _mm_mul_ps(ax, bx)),
+                          _mm_add_ps(_mm_mul_ps(ay, by), _mm_mul_ps(az, bz)));
+    return result;
+}
+
+
+inline Quat conjugate(Quat q)
+{
+    Quat result;
+    result.m = _mm_xor_ps(q.m, _mm_setr_ps(-0.0f, -0.0f, -0.0f, 0.0f));
+    return result;
+}
+
+
+inline f32 dot(Quat a, Quat b)
+{
+    Vec4 va, vb;
+    va.m = a.m;
+    vb.m = b.m;
+    return dot(va, vb);
+}
+
+
+inline Quat normalize(Quat q)
+{
+    Quat result;
+    result.m = _mm_mul_ps(q.m, _mm_set1_ps(1.0f / sqrtf(dot(q, q))));
+    return result;
+}
+
+
+// Rotates v by the unit quaternion q.
+inline Vec3 rotate(Quat q, Vec3 v)
+{
+    Vec3 t = 2.0f * cross(q.xyz, v);
+    return v + q.w * t + cross(q.xyz, t);
+}
+
+
+// Normalized lerp along the shorter arc. Cheaper than slerp and close
+// enough for small angles, e.g. between animation keys.
+inline Quat nlerp(Quat a, f32 t, Quat b)
+{
+    f32 sign = dot(a, b) < 0.0f ? -1.0f : 1.0f;
+    __m128 start = _mm_mul_ps(a.m, _mm_set1_ps(1.0f - t));
+    __m128 end = _mm_mul_ps(b.m, _mm_set1_ps(t * sign));
+    Quat result;
+    result.m = _mm_add_ps(start, end);
+    return normalize(result);
+}
+
+
+inline Quat slerp(Quat a, f32 t, Quat b)
+{
+    f32 cos_theta = dot(a, b);
+    f32 sign = 1.0f;
+    if (cos_theta < 0.0f)
+    {
+        cos_theta = -cos_theta;
+        sign = -1.0f;
+    }
+    if (cos_theta > 0.9995f)
+    {
+        return nlerp(a, t, b);
+    }
+
+    f32 theta = acosf(cos_theta);
+    f32 inverse_sin = 1.0f / sinf(theta);
+    __m128 start = _mm_mul_ps(a.m, _mm_set1_ps(sinf((1.0f - t) * theta) * inverse_sin));
+    __m128 end = _mm_mul_ps(b.m, _mm_set1_ps(sinf(t * theta) * inverse_sin * sign));
+    Quat result;
+    result.m = _mm_add_ps(start, end);
+    return result;
+}
+
+
+// Mat3 ########################################################################
+
+
+inline Mat3 identity_mat3()
+{
+    Mat3 result = {};
+    result.e[0][0] = 1.0f;
+    result.e[1][1] = 1.0f;
+    result.e[2][2] = 1.0f;
+    return result;
+}
+
+
+// Upper left 3x3 of m
+inline Mat3 mat3(const Mat4 &m)
+{
+    Mat3 result;
+    result.columns[0] = m.columns[0].xyz;
+    result.columns[1] = m.columns[1].xyz;
+    result.columns[2] = m.columns[2].xyz;
+    return result;
+}
+
+
+inline Vec3 operator*(const Mat3 &m, Vec3 v)
+{
+    return m.columns[0] * v.x + m.columns[1] * v.y + m.columns[2] * v.z;
+}
+
+
+inline Mat3 operator*(const Mat3 &a, const Mat3 &b)
+{
+    Mat3 result;
+    result.columns[0] = a * b.columns[0];
+    result.columns[1] = a * b.columns[1];
+    result.columns[2] = a * b.columns[2];
+    return result;
+}
+
+
+inline Mat3 transpose(const Mat3 &m)
+{
+    Mat3 result;
+    for (u32 column = 0; column < 3; ++column)
+    {
+        for (u32 row = 0; row < 3; ++row)
+        {
+            result.e[column][row] = m.e[row][column];
+        }
+    }
+    return result;
+}
+
+
+inline f32 determinant(const Mat3 &m)
+{
+    return dot(m.columns[0], cross(m.columns[1], m.columns[2]));
+}
+
+
+inline Mat3 inverse(const Mat3 &m)
+{
+    Vec3 x = cross(m.columns[1], m.columns[2]);
+    Vec3 y = cross(m.columns[2], m.columns[0]);
+    Vec3 z = cross(m.columns[0], m.columns[1]);
+    f32 inverse_determinant = 1.0f / dot(m.columns[0], x);
+
+    // The cross products are the rows of the inverse
+    Mat3 rows;
+    rows.columns[0] = x * inverse_determinant;
+    rows.columns[1] = y * inverse_determinant;
+    rows.columns[2] = z * inverse_determinant;
+    return transpose(rows);
+}
+
+
+// Mat4 ########################################################################
+
+
+inline Mat4 identity_mat4()
+{
+    Mat4 result;
+    result.columns[0] = vec4(1.0f, 0.0f, 0.0f, 0.0f);
+    result.columns[1] = vec4(0.0f, 1.0f, 0.0f, 0.0f);
+    result.columns[2] = vec4(0.0f, 0.0f, 1.0f, 0.0f);
+    result.columns[3] = vec4(0.0f, 0.0f, 0.0f, 1.0f);
+    return result;
+}
+
+
+inline Mat4 mat4(const Mat3 &m)
+{
+    Mat4 result;
+    result.columns[0] = vec4(m.columns[0], 0.0f);
+    result.columns[1] = vec4(m.columns[1], 0.0f);
+    result.columns[2] = vec4(m.columns[2], 0.0f);
+    result.columns[3] = vec4(0.0f, 0.0f, 0.0f, 1.0f);
+    return result;
+}
+
+
+inline __m128 mat4_mul_column(const Mat4 &m, __m128 column)
+{
+    __m128 x = _mm_shuffle_ps(column, column, _MM_SHUFFLE(0, 0, 0, 0));
+    __m128 y = _mm_shuffle_ps(column, column, _MM_SHUFFLE(1, 1, 1, 1));
+    __m128 z = _mm_shuffle_ps(column, column, _MM_SHUFFLE(2, 2, 2, 2));
+    __m128 w = _mm_shuffle_ps(column, column, _MM_SHUFFLE(3, 3, 3, 3));
+    return _mm_add_ps(_mm_add_ps(_mm_mul_ps(m.columns[0].m, x), _mm_mul_ps(m.columns[1].m, y)),
+                      _mm_add_ps(_mm_mul_ps(m.columns[2].m, z), _mm_mul_ps(m.columns[3].m, w)));
+}
+
+
+inline Vec4 operator*(const Mat4 &m, Vec4 v)
+{
+    return vec4(mat4_mul_column(m, v.m));
+}
+
+
+inline Mat4 operator*(const Mat4 &a, const Mat4 &b)
+{
+    Mat4 result;
+    result.columns[0].m = mat4_mul_column(a, b.columns[0].m);
+    result.columns[1].m = mat4_mul_column(a, b.columns[1].m);
+    result.columns[2].m = mat4_mul_column(a, b.columns[2].m);
+    result.columns[3].m = mat4_mul_column(a, b.columns[3].m);
+    return result;
+}
+
+
+// w = 1, without the divide
+inline Vec3 transform_point(const Mat4 &m, Vec3 p)
+{
+    return (m * vec4(p, 1.0f)).xyz;
+}
+
+
+// w = 0, ignores the translation
+inline Vec3 transform_vector(const Mat4 &m, Vec3 v)
+{
+    return (m * vec4(v, 0.0f)).xyz;
+}
+
+
+inline Mat4 transpose(const Mat4 &m)
+{
+    Mat4 result = m;
+    _MM_TRANSPOSE4_PS(result.columns[0].m, result.columns[1].m,
+                      result.columns[2].m, result.columns[3].m);
+    return result;
+}
+
+
+inline Mat4 translation(Vec3 offset)
+{
+    Mat4 result = identity_mat4();
+    result.columns[3] = vec4(offset, 1.0f);
+    return result;
+}
+
+
+inline Mat4 scaling(Vec3 scale)
+{
+    Mat4 result = identity_mat4();
+    result.e[0][0] = scale.x;
+    result.e[1][1] = scale.y;
+    result.e[2][2] = scale.z;
+    return result;
+}
+
+
+// `q` must be normalized.
+inline Mat4 rotation(Quat q)
+{
+    f32 xx = q.x * q.x, yy = q.y * q.y, zz = q.z * q.z;
+    f32 xy = q.x * q.y, xz = q.x * q.z, yz = q.y * q.z;
+    f32 wx = q.w * q.x, wy = q.w * q.y, wz = q.w * q.z;
+
+    Mat4 result;
+    result.columns[0] = vec4(1.0f - 2.0f * (yy + zz), 2.0f * (xy + wz), 2.0f * (xz - wy), 0.0f);
+    result.columns[1] = vec4(2.0f * (xy - wz), 1.0f - 2.0f * (xx + zz), 2.0f * (yz + wx), 0.0f);
+    result.columns[2] = vec4(2.0f * (xz + wy), 2.0f * (yz - wx), 1.0f - 2.0f * (xx + yy), 0.0f);
+    result.columns[3] = vec4(0.0f, 0.0f, 0.0f, 1.0f);
+    return result;
+}
+
+
+inline Mat4 rotation(Vec3 axis, f32 angle)
+{
+    return rotation(quat_from_axis_angle(normalize(axis), angle));
+}
+
+
+// translation * rotation * scale, built directly
+inline Mat4 compose_transform(Vec3 position, Quat orientation, Vec3 scale)
+{
+    Mat4 result = rotation(orientation);
+    result.columns[0] *= scale.x;
+    result.columns[1] *= scale.y;
+    result.columns[2] *= scale.z;
+    result.columns[3] = vec4(position, 1.0f);
+    return result;
+}
+
+
+inline Mat4 perspective(f32 fovy, f32 aspect, f32 near, f32 far)
+{
+    f32 f = 1.0f / tanf(0.5f * fovy);
+
+    Mat4 result = {};
+    result.e[0][0] = f / aspect;
+    result.e[1][1] = f;
+    result.e[2][2] = (far + near) / (near - far);
+    result.e[2][3] = -1.0f;
+    result.e[3][2] = (2.0f * far * near) / (near - far);
+    return result;
+}
+
+
+inline Mat4 orthographic(f32 left, f32 right, f32 bottom, f32 top, f32 near, f32 far)
+{
+    Mat4 result = identity_mat4();
+    result.e[0][0] = 2.0f / (right - left);
+    result.e[1][1] = 2.0f / (top - bottom);
+    result.e[2][2] = -2.0f / (far - near);
+    result.e[3][0] = -(right + left) / (right - left);
+    result.e[3][1] = -(top + bottom) / (top - bottom);
+    result.e[3][2] = -(far + near) / (far - near);
+    return result;
+}
+
+
+inline Mat4 look_at(Vec3 eye, Vec3 target, Vec3 up)
+{
+    Vec3 f = normalize(target - eye);
+    Vec3 s = normalize(cross(f, up));
+    Vec3 u = cross(s, f);
+
+    Mat4 result;
+    result.columns[0] = vec4(s.x, u.x, -f.x, 0.0f);
+    result.columns[1] = vec4(s.y, u.y, -f.y, 0.0f);
+    result.columns[2] = vec4(s.z, u.z, -f.z, 0.0f);
+    result.columns[3] = vec4(-dot(s, eye), -dot(u, eye), dot(f, eye), 1.0f);
+    return result;
+}
+
+
+// Inverse of a matrix whose last row is (0, 0, 0, 1), i.e. any combination
+// of translation, rotation and scale. Much cheaper than inverse().
+inline Mat4 inverse_affine(const Mat4 &m)
+{
+    Mat3 linear = inverse(mat3(m));
+    Vec3 offset = -(linear * m.columns[3].xyz);
+
+    Mat4 result = mat4(linear);
+    result.columns[3] = vec4(offset, 1.0f);
+    return result;
+}
+
+
+// For lighting, transforms normals by the inverse transpose of the model
+// matrix's linear part.
+inline Mat3 normal_matrix(const Mat4 &model)
+{
+    return transpose(inverse(mat3(model)));
+}
+
+
+Mat4 inverse(const Mat4 &m);
+
+
+// Batch kernels ###############################################################
+
+
+// Structure of arrays: x, y and z each point at `count` floats. The SIMD
+// paths load lanes straight out of these arrays with no shuffling.
+struct Vec3SoA
+{
+    f32 *x;
+    f32 *y;
+    f32 *z;
+};
+
+
+inline Vec3SoA offset_soa(Vec3SoA points, u32 offset)
+{
+    Vec3SoA result;
+    result.x = points.x + offset;
+    result.y = points.y + offset;
+    result.z = points.z + offset;
+    return result;
+}
+
+
+// Switches the batch kernels to the variants for `isa`. Until this is
+// called they run the SSE2 variants. Returns false if the CPU lacks `isa`.
+bool select_math_kernels(CpuIsa isa);
+CpuIsa math_kernels_isa();
+
+// result[i] = transform_point(*matrix, points[i]). result may be points.
+void transform_points_soa(const Mat4 *matrix, Vec3SoA points, Vec3SoA result, u32 count);
+
+// result[i] = a[i] * b[i]. result may alias a or b.
+void multiply_mat4_batch(Mat4 *result, const Mat4 *a, const Mat4 *b, u32 count);
+
+// result[i] = (*view_projection) * models[i]. result may be models.
+void compute_mvp_batch(Mat4 *result, const Mat4 *view_projection, const Mat4 *models, u32 count);
+
+// Plain scalar loops, used for the tails of the SIMD kernels and as the
+// reference in bench_math.
+void transform_points_soa_scalar(const Mat4 *matrix, Vec3SoA points, Vec3SoA result, u32 count);
+void multiply_mat4_batch_scalar(Mat4 *result, const Mat4 *a, const Mat4 *b, u32 count);
+void compute_mvp_batch_scalar(Mat4 *result, const Mat4 *view_projection, const Mat4 *models, u32 count);
@@ -0,0 +1,314 @@
+#include "memory_tracking.hpp"
+#include "log.hpp"
+
+
+#define MEMORY_MAX_TRACKED 64
+
+
+struct TrackedArena
+{
+    MemoryArena *arena;
+    MemoryArena *parent;            // tracked arena it was carved out of
+    const char  *name;
+    MemoryTag    tag;
+    u64          last_push_count;
+    u64          last_pushed_bytes;
+};
+
+
+struct TrackedPool
+{
+    MemoryPool  *pool;
+    const char  *name;
+    MemoryTag    tag;
+    u64          last_allocs;
+};
+
+
+// Heap counters are updated from any thread by the malloc hooks
+struct HeapCounters
+{
+    u64 allocs;
+    u64 bytes;
+    u64 live_bytes;
+    u64 peak_bytes;
+};
+
+
+struct MemoryTracking
+{
+    TrackedArena   arenas[MEMORY_MAX_TRACKED];
+    u32            arena_count;
+    TrackedPool    pools[MEMORY_MAX_TRACKED];
+    u32            pool_count;
+
+    HeapCounters   heap[MEMORY_TAG_COUNT];
+    u64            last_heap_allocs[MEMORY_TAG_COUNT];
+    u64            last_heap_bytes[MEMORY_TAG_COUNT];
+
+    MemoryTagStats stats[MEMORY_TAG_COUNT];
+};
+
+
+// Zero initialized, so the hooks can run before static constructors
+MemoryTracking memory_tracking;
+__thread u8 memory_current_tag = MEMORY_TAG_UNTAGGED;
+
+// Defined by heap_hooks.cpp when it is linked in
+extern const bool memory_heap_hooks_linked __attribute__((weak));
+
+
+const char *memory_tag_name(MemoryTag tag)
+{
+    switch (tag)
+    {
+        case MEMORY_TAG_UNTAGGED: return "untagged";
+        case MEMORY_TAG_PLATFORM: return "platform";
+        case MEMORY_TAG_FRAME:    return "frame";
+        case MEMORY_TAG_RENDER:   return "render";
+        case MEMORY_TAG_ASSETS:   return "assets";
+        case MEMORY_TAG_LOG:      return "log";
+        case MEMORY_TAG_PROFILE:  return "profile";
+        case MEMORY_TAG_DRIVER:   return "driver";
+        default:                  return "?";
+    }
+}
+
+
+void track_arena(MemoryArena *arena, MemoryTag tag, const char *name)
+{
+    if (memory_tracking.arena_count >= MEMORY_MAX_TRACKED)
+    {
+        return;
+    }
+
+    // A sub_arena() counts under its own tag, not as part of its parent's
+    MemoryArena *parent = NULL;
+    for (u32 i = 0; i < memory_tracking.arena_count; ++i)
+    {
+        MemoryArena *other = memory_tracking.arenas[i].arena;
+        if (arena->base >= other->base && arena->base < other->base + other->size)
+        {
+            parent = other;
+        }
+    }
+
+    TrackedArena *tracked = &memory_tracking.arenas[memory_tracking.arena_count++];
+    tracked->arena = arena;
+    tracked->parent = parent;
+    tracked->name = name;
+    tracked->tag = tag;
+    tracked->last_push_count = arena->push_count;
+    tracked->last_pushed_bytes = arena->pushed_bytes;
+}
+
+
+void track_pool(MemoryPool *pool, MemoryTag tag, const char *name)
+{
+    if (memory_tracking.pool_count >= MEMORY_MAX_TRACKED)
+    {
+        return;
+    }
+
+    TrackedPool *tracked = &memory_tracking.pools[memory_tracking.pool_count++];
+    tracked->pool = pool;
+    tracked->name = name;
+    tracked->tag = tag;
+    tracked->last_allocs = pool->stats.allocs;
+}
+
+
+void untrack_pool(MemoryPool *pool)
+{
+    for (u32 i = 0; i < memory_tracking.pool_count; ++i)
+    {
+        if (memory_tracking.pools[i].pool == pool)
+        {
+            memory_tracking.pools[i] = memory_tracking.pools[--memory_tracking.pool_count];
+            return;
+        }
+    }
+}
+
+
+void memory_record_heap_alloc(u8 tag, u64 size)
+{
+    HeapCounters *counters = &memory_tracking.heap[tag < MEMORY_TAG_COUNT ? tag : 0];
+    __atomic_add_fetch(&counters->allocs, 1, __ATOMIC_RELAXED);
+    __atomic_add_fetch(&counters->bytes, size, __ATOMIC_RELAXED);
+    u64 live = __atomic_add_fetch(&counters->live_bytes, size, __ATOMIC_RELAXED);
+
+    u64 peak = __atomic_load_n(&counters->peak_bytes, __ATOMIC_RELAXED);
+    while (live > peak
+           && !__atomic_compare_exchange_n(&counters->peak_bytes, &peak, live, true,
+                                           __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+    {
+    }
+}
+
+
+void memory_record_heap_free(u8 tag, u64 size)
+{
+    HeapCounters *counters = &memory_tracking.heap[tag < MEMORY_TAG_COUNT ? tag : 0];
+    __atomic_sub_fetch(&counters->live_bytes, size, __ATOMIC_RELAXED);
+}
+
+
+// What the tracked arenas carved out of this one hold
+internal memory_index sub_arena_bytes(TrackedArena *parent)
+{
+    memory_index bytes = 0;
+    for (u32 i = 0; i < memory_tracking.arena_count; ++i)
+    {
+        if (memory_tracking.arenas[i].parent == parent->arena)
+        {
+            bytes += memory_tracking.arenas[i].arena->size;
+        }
+    }
+    return bytes;
+}
+
+
+void memory_end_frame()
+{
+    MemoryTagStats *stats = memory_tracking.stats;
+
+    for (u32 tag = 0; tag < MEMORY_TAG_COUNT; ++tag)
+    {
+        MemoryTagStats *tag_stats = &stats[tag];
+        tag_stats->live_bytes = 0;
+        tag_stats->frame_allocs = 0;
+        tag_stats->frame_bytes = 0;
+
+        HeapCounters *heap = &memory_tracking.heap[tag];
+        u64 allocs = __atomic_load_n(&heap->allocs, __ATOMIC_RELAXED);
+        u64 bytes = __atomic_load_n(&heap->bytes, __ATOMIC_RELAXED);
+        tag_stats->heap_live_bytes = __atomic_load_n(&heap->live_bytes, __ATOMIC_RELAXED);
+        tag_stats->heap_peak_bytes = __atomic_load_n(&heap->peak_bytes, __ATOMIC_RELAXED);
+        tag_stats->heap_total_allocs = allocs;
+        tag_stats->heap_frame_allocs = allocs - memory_tracking.last_heap_allocs[tag];
+        tag_stats->heap_frame_bytes = bytes - memory_tracking.last_heap_bytes[tag];
+        memory_tracking.last_heap_allocs[tag] = allocs;
+        memory_tracking.last_heap_bytes[tag] = bytes;
+    }
+
+    for (u32 i = 0; i < memory_tracking.arena_count; ++i)
+    {
+        TrackedArena *tracked = &memory_tracking.arenas[i];
+        MemoryArena *arena = tracked->arena;
+        MemoryTagStats *tag_stats = &stats[tracked->tag];
+
+        tag_stats->live_bytes += arena->used - sub_arena_bytes(tracked);
+        tag_stats->frame_allocs += arena->push_count - tracked->last_push_count;
+        tag_stats->frame_bytes += arena->pushed_bytes - tracked->last_pushed_bytes;
+        tag_stats->total_allocs += arena->push_count - tracked->last_push_count;
+        tracked->last_push_count = arena->push_count;
+        tracked->last_pushed_bytes = arena->pushed_bytes;
+    }
+
+    for (u32 i = 0; i < memory_tracking.pool_count; ++i)
+    {
+        TrackedPool *tracked = &memory_tracking.pools[i];
+        MemoryPool *pool = tracked->pool;
+        MemoryTagStats *tag_stats = &stats[tracked->tag];
+
+        u64 allocs = pool->stats.allocs - tracked->last_allocs;
+        tag_stats->live_bytes += pool->stats.live * pool->slot_size;
+        tag_stats->frame_allocs += allocs;
+        tag_stats->frame_bytes += allocs * pool->slot_size;
+        tag_stats->total_allocs += allocs;
+        tracked->last_allocs = pool->stats.allocs;
+    }
+
+    for (u32 tag = 0; tag < MEMORY_TAG_COUNT; ++tag)
+    {
+        if (stats[tag].live_bytes > stats[tag].peak_bytes)
+        {
+            stats[tag].peak_bytes = stats[tag].live_bytes;
+        }
+    }
+
+    // Arenas that reset every frame peak inside the frame, not at its end
+    for (u32 i = 0; i < memory_tracking.arena_count; ++i)
+    {
+        TrackedArena *tracked = &memory_tracking.arenas[i];
+        MemoryTagStats *tag_stats = &stats[tracked->tag];
+        memory_index peak = tracked->arena->peak - sub_arena_bytes(tracked);
+        if (peak > tag_stats->peak_bytes)
+        {
+            tag_stats->peak_bytes = peak;
+        }
+    }
+}
+
+
+const MemoryTagStats *memory_tag_stats()
+{
+    return memory_tracking.stats;
+}
+
+
+bool memory_heap_tracked()
+{
+    return &memory_heap_hooks_linked != NULL;
+}
+
+
+u64 memory_frame_heap_allocs()
+{
+    u64 allocs = 0;
+    for (u32 tag = 0; tag < MEMORY_TAG_COUNT; ++tag)
+    {
+        if (tag != MEMORY_TAG_DRIVER)
+        {
+            allocs += memory_tracking.stats[tag].heap_frame_allocs;
+        }
+    }
+    return allocs;
+}
+
+
+void log_memory_report()
+{
+    log_info("Memory by tag:             live KB      peak KB  allocs/frame     heap KB "
+             "heap peak KB heap allocs/frame\n");
+    for (u32 tag = 0; tag < MEMORY_TAG_COUNT; ++tag)
+    {
+        const MemoryTagStats *stats = &memory_tracking.stats[tag];
+        if (stats->peak_bytes == 0 && stats->heap_peak_bytes == 0)
+        {
+            continue;
+        }
+        log_info("  %-16s %12.1f %12.1f %13llu %11.1f %12.1f %17llu\n",
+                 memory_tag_name((MemoryTag)tag),
+                 stats->live_bytes / 1024.0,
+                 stats->peak_bytes / 1024.0,
+                 (unsigned long long)stats->frame_allocs,
+                 stats->heap_live_bytes / 1024.0,
+                 stats->heap_peak_bytes / 1024.0,
+                 (unsigned long long)stats->heap_frame_allocs);
+    }
+
+    for (u32 i = 0; i < memory_tracking.arena_count; ++i)
+    {
+        TrackedArena *tracked = &memory_tracking.arenas[i];
+        log_info("  arena %-16s %s, %.1f of %.1f KB used, %.1f KB peak\n",
+                 tracked->name,
+                 memory_tag_name(tracked->tag),
+                 tracked->arena->used / 1024.0,
+                 tracked->arena->size / 1024.0,
+                 tracked->arena->peak / 1024.0);
+    }
+
+    for (u32 i = 0; i < memory_tracking.pool_count; ++i)
+    {
+        TrackedPool *tracked = &memory_tracking.pools[i];
+        PoolStats *stats = &tracked->pool->stats;
+        log_info("  pool %-17s %s, %zu of %zu slots live, %zu peak\n",
+                 tracked->name,
+                 memory_tag_name(tracked->tag),
+                 stats->live,
+                 stats->capacity,
+                 stats->peak);
+    }
+}
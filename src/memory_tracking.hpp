@@ -0,0 +1,96 @@
+#pragma once
+
+#include "platform.hpp"
+#include "pool.hpp"
+
+
+// Per-subsystem memory accounting.
+//
+// Arenas and pools are registered with a tag and sampled once a frame, so
+// their push/alloc paths pay nothing extra. Heap allocations (malloc, new
+// and everything built on them, including library and driver code) are
+// counted by the malloc replacement in heap_hooks.cpp and charged to the
+// calling thread's current tag, see MEMORY_TAG_SCOPE.
+
+
+enum MemoryTag
+{
+    MEMORY_TAG_UNTAGGED,
+    MEMORY_TAG_PLATFORM,
+    MEMORY_TAG_FRAME,
+    MEMORY_TAG_RENDER,
+    MEMORY_TAG_ASSETS,
+    MEMORY_TAG_LOG,
+    MEMORY_TAG_PROFILE,
+    MEMORY_TAG_DRIVER,      // SDL and GL calls, outside our control
+    MEMORY_TAG_COUNT
+};
+
+
+struct MemoryTagStats
+{
+    u64 live_bytes;
+    u64 peak_bytes;
+    u64 total_allocs;
+    u64 frame_allocs;       // during the last completed frame
+    u64 frame_bytes;
+
+    u64 heap_live_bytes;
+    u64 heap_peak_bytes;
+    u64 heap_total_allocs;
+    u64 heap_frame_allocs;
+    u64 heap_frame_bytes;
+};
+
+
+extern __thread u8 memory_current_tag;
+
+
+struct MemoryTagScope
+{
+    u8 previous;
+
+    MemoryTagScope(MemoryTag tag)
+    {
+        previous = memory_current_tag;
+        memory_current_tag = (u8)tag;
+    }
+
+    ~MemoryTagScope()
+    {
+        memory_current_tag = previous;
+    }
+};
+
+
+#define MEMORY_TAG_CONCAT_(a, b) a##b
+#define MEMORY_TAG_CONCAT(a, b) MEMORY_TAG_CONCAT_(a, b)
+#define MEMORY_TAG_SCOPE(tag) \
+    MemoryTagScope MEMORY_TAG_CONCAT(memory_tag_scope_, __LINE__)(tag)
+
+
+const char *memory_tag_name(MemoryTag tag);
+
+// Track a parent before its sub_arena()s, their space then only counts
+// under their own tag.
+void track_arena(MemoryArena *arena, MemoryTag tag, const char *name);
+void track_pool(MemoryPool *pool, MemoryTag tag, const char *name);
+void untrack_pool(MemoryPool *pool);
+
+// Called by the heap hooks.
+void memory_record_heap_alloc(u8 tag, u64 size);
+void memory_record_heap_free(u8 tag, u64 size);
+
+// Samples the tracked arenas and pools and closes the per-frame counts.
+// Call once per frame, on the main thread.
+void memory_end_frame();
+
+const MemoryTagStats *memory_tag_stats();
+
+// False when the binary was linked without heap_hooks.cpp
+bool memory_heap_tracked();
+
+// Heap allocations in the last frame from every tag but MEMORY_TAG_DRIVER.
+u64 memory_frame_heap_allocs();
+
+void log_memory_report();
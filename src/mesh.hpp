@@ -0,0 +1,52 @@
+#pragma once
+
+#include "platform.hpp"
+#include "math.hpp"
+
+
+// Indexed triangle meshes in the vertex layout the shaders read: attribute
+// 0 position, 1 normal, 2 texture coordinates, interleaved.
+
+
+#define MESH_MAX_LODS 8
+
+
+struct Vertex
+{
+    Vec3 position;
+    Vec3 normal;
+    Vec2 uv;
+};
+
+
+// How vertices are stored once cooked or uploaded, see vertex_format.hpp
+enum VertexFormat
+{
+    VERTEX_FORMAT_FLOAT,        // Vertex as is
+    VERTEX_FORMAT_UNORM16,
+    VERTEX_FORMAT_HALF,
+    VERTEX_FORMAT_COUNT
+};
+
+
+// A range of Mesh::indices. `error` is how far, in object space, the
+// simplified surface may be from the full one.
+struct MeshLod
+{
+    u32 first_index;
+    u32 index_count;
+    f32 error;
+};
+
+
+// The levels of detail share the vertices, each is an index range, most
+// detailed first. Without any the whole index buffer is the only one.
+struct Mesh
+{
+    Vertex  *vertices;
+    u32     *indices;           // three per triangle
+    u32      vertex_count;
+    u32      index_count;
+    MeshLod  lods[MESH_MAX_LODS];
+    u32      lod_count;
+};
@@ -0,0 +1,44 @@
+#pragma once
+
+#include "platform.hpp"
+#include "mesh.hpp"
+
+
+// Picks a mesh's level of detail by how many pixels its error covers on
+// screen, so what gets drawn follows how large the object looks, not how
+// many of them there are.
+//
+// A LOD is good enough while error * pixels_per_unit stays under
+// `pixel_error`. Switching to a coarser one needs it to be a `hysteresis`
+// fraction under that, going back finer a fraction over, so an object
+// sitting at the threshold does not flip between two LODs every frame.
+// Keep the LOD an object was drawn with last frame and pass it as
+// `current`.
+
+
+#define LOD_PIXEL_ERROR 1.0f            // pixels a LOD's error may cover
+#define LOD_HYSTERESIS  0.25f
+
+
+// `scale` takes the mesh to world space, `distance` is from the eye and
+// `projection_scale` pixels per unit at distance 1 (see stream_view()).
+inline u32 select_lod(const MeshLod *lods, u32 lod_count, f32 scale, f32 distance, f32 projection_scale,
+                      u32 current, f32 pixel_error = LOD_PIXEL_ERROR, f32 hysteresis = LOD_HYSTERESIS)
+{
+    if (lod_count <= 1)
+    {
+        return 0;
+    }
+
+    f32 pixels_per_unit = scale * projection_scale / (distance > 1e-3f ? distance : 1e-3f);
+    u32 lod = current < lod_count ? current : lod_count - 1;
+    while (lod > 0 && lods[lod].error * pixels_per_unit > pixel_error * (1.0f + hysteresis))
+    {
+        --lod;
+    }
+    while (lod + 1 < lod_count && lods[lod + 1].error * pixels_per_unit <= pixel_error * (1.0f - hysteresis))
+    {
+        ++lod;
+    }
+    return lod;
+}
@@ -0,0 +1,603 @@
+#include <float.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "mesh_optimize.hpp"
+
+
+#define NO_VERTEX 0xFFFFFFFFu
+
+
+// The FIFO cache as timestamps: a vertex is cached while fewer than
+// MESH_CACHE_SIZE misses happened since its own. Time starts past the
+// cache size so that every vertex starts out of it.
+struct CacheSimulation
+{
+    u32 *timestamps;            // per vertex
+    u32  time;
+    u32  size;
+};
+
+
+internal bool begin_cache_simulation(CacheSimulation *cache, u32 vertex_count, u32 cache_size, MemoryArena *scratch)
+{
+    cache->timestamps = push_array(scratch, vertex_count, u32);
+    cache->time = cache_size + 1;
+    cache->size = cache_size;
+    if (cache->timestamps)
+    {
+        memset(cache->timestamps, 0, (memory_index)vertex_count * sizeof(u32));
+    }
+    return cache->timestamps != NULL;
+}
+
+
+internal void flush_cache(CacheSimulation *cache)
+{
+    cache->time += cache->size + 1;
+}
+
+
+internal u32 cache_misses(CacheSimulation *cache, const u32 *triangle)
+{
+    u32 misses = 0;
+    for (u32 i = 0; i < 3; ++i)
+    {
+        u32 vertex = triangle[i];
+        if (cache->time - cache->timestamps[vertex] > cache->size)
+        {
+            cache->timestamps[vertex] = cache->time++;
+            ++misses;
+        }
+    }
+    return misses;
+}
+
+
+VertexCacheStats analyze_vertex_cache(const u32 *indices, u32 index_count, u32 vertex_count,
+                                      u32 cache_size, MemoryArena *scratch)
+{
+    VertexCacheStats stats = {};
+    TemporaryMemory temp = begin_temporary_memory(scratch);
+    CacheSimulation cache;
+    if (!begin_cache_simulation(&cache, vertex_count, cache_size, scratch))
+    {
+        end_temporary_memory(temp);
+        return stats;
+    }
+
+    for (u32 i = 0; i + 2 < index_count; i += 3)
+    {
+        stats.transformed += cache_misses(&cache, indices + i);
+    }
+
+    u32 used = 0;
+    for (u32 i = 0; i < vertex_count; ++i)
+    {
+        used += cache.timestamps[i] != 0;
+    }
+    stats.acmr = index_count >= 3 ? (f32)stats.transformed / (f32)(index_count / 3) : 0.0f;
+    stats.atvr = used ? (f32)stats.transformed / (f32)used : 0.0f;
+
+    end_temporary_memory(temp);
+    return stats;
+}
+
+
+// VERTEX CACHE ###############################################################
+
+
+bool build_vertex_triangles(VertexTriangles *adjacency, const u32 *indices, u32 index_count,
+                            u32 vertex_count, MemoryArena *scratch)
+{
+    adjacency->offsets = push_array(scratch, vertex_count + 1, u32);
+    adjacency->triangles = push_array(scratch, index_count, u32);
+    if (!adjacency->offsets || !adjacency->triangles)
+    {
+        return false;
+    }
+
+    memset(adjacency->offsets, 0, ((memory_index)vertex_count + 1) * sizeof(u32));
+    for (u32 i = 0; i < index_count; ++i)
+    {
+        ++adjacency->offsets[indices[i] + 1];
+    }
+    adjacency->max_count = 0;
+    for (u32 i = 0; i < vertex_count; ++i)
+    {
+        u32 count = adjacency->offsets[i + 1];
+        adjacency->max_count = count > adjacency->max_count ? count : adjacency->max_count;
+        adjacency->offsets[i + 1] += adjacency->offsets[i];
+    }
+
+    // Fill from the front of each range, which moves the offsets one range
+    // up; shift them back after
+    for (u32 i = 0; i < index_count; ++i)
+    {
+        adjacency->triangles[adjacency->offsets[indices[i]]++] = i / 3;
+    }
+    for (u32 i = vertex_count; i > 0; --i)
+    {
+        adjacency->offsets[i] = adjacency->offsets[i - 1];
+    }
+    adjacency->offsets[0] = 0;
+    return true;
+}
+
+
+struct Tipsify
+{
+    VertexTriangles adjacency;
+    u32            *live;           // triangles left per vertex
+    u32            *dead_ends;      // recently emitted vertices, a stack
+    u32             dead_end_count;
+    u32             cursor;         // vertices below have no triangles left
+    u32             vertex_count;
+};
+
+
+// Back to the most recent vertex that still has triangles, or failing that
+// the next one in input order
+internal u32 skip_dead_end(Tipsify *tipsify)
+{
+    while (tipsify->dead_end_count > 0)
+    {
+        u32 vertex = tipsify->dead_ends[--tipsify->dead_end_count];
+        if (tipsify->live[vertex] > 0)
+        {
+            return vertex;
+        }
+    }
+    for (; tipsify->cursor < tipsify->vertex_count; ++tipsify->cursor)
+    {
+        if (tipsify->live[tipsify->cursor] > 0)
+        {
+            return tipsify->cursor;
+        }
+    }
+    return NO_VERTEX;
+}
+
+
+// Of the vertices just emitted, the one that entered the cache earliest
+// among those whose remaining fan still fits in it before they fall out
+internal u32 next_fanning_vertex(Tipsify *tipsify, CacheSimulation *cache, const u32 *candidates, u32 count)
+{
+    u32 best = NO_VERTEX;
+    i64 best_priority = -1;
+    for (u32 i = 0; i < count; ++i)
+    {
+        u32 vertex = candidates[i];
+        if (tipsify->live[vertex] == 0)
+        {
+            continue;
+        }
+
+        u32 age = cache->time - cache->timestamps[vertex];
+        i64 priority = age + 2 * tipsify->live[vertex] <= cache->size ? age : 0;
+        if (priority > best_priority)
+        {
+            best = vertex;
+            best_priority = priority;
+        }
+    }
+    return best != NO_VERTEX ? best : skip_dead_end(tipsify);
+}
+
+
+bool optimize_vertex_cache(u32 *indices, u32 index_count, u32 vertex_count, MemoryArena *scratch)
+{
+    index_count -= index_count % 3;
+    u32 triangle_count = index_count / 3;
+    if (triangle_count == 0)
+    {
+        return true;
+    }
+
+    TemporaryMemory temp = begin_temporary_memory(scratch);
+    Tipsify tipsify = {};
+    CacheSimulation cache;
+    bool ok = build_vertex_triangles(&tipsify.adjacency, indices, index_count, vertex_count, scratch)
+           && begin_cache_simulation(&cache, vertex_count, MESH_CACHE_SIZE, scratch);
+    tipsify.live = ok ? push_array(scratch, vertex_count, u32) : NULL;
+    tipsify.dead_ends = ok ? push_array(scratch, index_count, u32) : NULL;
+    u32 *candidates = ok ? push_array(scratch, (memory_index)tipsify.adjacency.max_count * 3, u32) : NULL;
+    u8 *emitted = ok ? push_array(scratch, triangle_count, u8) : NULL;
+    u32 *result = ok ? push_array(scratch, index_count, u32) : NULL;
+    if (!ok || !tipsify.live || !tipsify.dead_ends || !candidates || !emitted || !result)
+    {
+        end_temporary_memory(temp);
+        return false;
+    }
+
+    VertexTriangles *adjacency = &tipsify.adjacency;
+    for (u32 i = 0; i < vertex_count; ++i)
+    {
+        tipsify.live[i] = adjacency->offsets[i + 1] - adjacency->offsets[i];
+    }
+    memset(emitted, 0, triangle_count);
+    tipsify.vertex_count = vertex_count;
+
+    u32 emitted_count = 0;
+    u32 fanning = skip_dead_end(&tipsify);
+    while (fanning != NO_VERTEX)
+    {
+        u32 candidate_count = 0;
+        for (u32 i = adjacency->offsets[fanning]; i < adjacency->offsets[fanning + 1]; ++i)
+        {
+            u32 triangle = adjacency->triangles[i];
+            if (emitted[triangle])
+            {
+                continue;
+            }
+            emitted[triangle] = 1;
+
+            const u32 *corners = indices + triangle * 3;
+            for (u32 j = 0; j < 3; ++j)
+            {
+                u32 vertex = corners[j];
+                result[emitted_count++] = vertex;
+                tipsify.dead_ends[tipsify.dead_end_count++] = vertex;
+                candidates[candidate_count++] = vertex;
+                --tipsify.live[vertex];
+                if (cache.time - cache.timestamps[vertex] > cache.size)
+                {
+                    cache.timestamps[vertex] = cache.time++;
+                }
+            }
+        }
+        fanning = next_fanning_vertex(&tipsify, &cache, candidates, candidate_count);
+    }
+
+    memcpy(indices, result, (memory_index)index_count * sizeof(u32));
+    end_temporary_memory(temp);
+    return true;
+}
+
+
+// OVERDRAW ###################################################################
+
+
+struct ClusterKey
+{
+    f32 key;
+    u32 cluster;
+};
+
+
+internal int compare_cluster_keys(const void *a, const void *b)
+{
+    const ClusterKey *key_a = (const ClusterKey *)a;
+    const ClusterKey *key_b = (const ClusterKey *)b;
+    if (key_a->key != key_b->key)
+    {
+        return key_a->key > key_b->key ? -1 : 1;
+    }
+    return key_a->cluster < key_b->cluster ? -1 : (key_a->cluster > key_b->cluster);
+}
+
+
+// Where the cache starts over by itself: all three corners missed
+internal u32 find_hard_boundaries(const u32 *indices, u32 triangle_count, CacheSimulation *cache, u32 *boundaries)
+{
+    u32 count = 0;
+    for (u32 i = 0; i < triangle_count; ++i)
+    {
+        if (cache_misses(cache, indices + i * 3) == 3 || i == 0)
+        {
+            boundaries[count++] = i;
+        }
+    }
+    return count;
+}
+
+
+// Cuts [first, end) wherever the ACMR since the last cut is already within
+// `threshold` of the whole range's, flushing the cache there as a draw
+// order change would. Returns the new cluster count.
+internal u32 add_soft_boundaries(const u32 *indices, u32 first, u32 end, f32 threshold,
+                                 CacheSimulation *cache, u32 *clusters, u32 count)
+{
+    flush_cache(cache);
+    u32 misses = 0;
+    for (u32 i = first; i < end; ++i)
+    {
+        misses += cache_misses(cache, indices + i * 3);
+    }
+    f32 target = threshold * (f32)misses / (f32)(end - first);
+
+    flush_cache(cache);
+    u32 cluster_first = count;
+    clusters[count++] = first;
+    u32 running_misses = 0;
+    u32 running_triangles = 0;
+    for (u32 i = first; i < end; ++i)
+    {
+        running_misses += cache_misses(cache, indices + i * 3);
+        ++running_triangles;
+        if (i + 1 < end && (f32)running_misses <= target * (f32)running_triangles)
+        {
+            clusters[count++] = i + 1;
+            flush_cache(cache);
+            running_misses = 0;
+            running_triangles = 0;
+        }
+    }
+
+    // A tail that never got down to the target costs less as part of the
+    // cluster before it
+    if (count - 1 > cluster_first && (f32)running_misses > target * (f32)running_triangles)
+    {
+        --count;
+    }
+    return count;
+}
+
+
+bool optimize_overdraw(u32 *indices, u32 index_count, const Vertex *vertices, u32 vertex_count,
+                       f32 threshold, MemoryArena *scratch)
+{
+    u32 triangle_count = index_count / 3;
+    if (triangle_count == 0 || vertex_count == 0)
+    {
+        return true;
+    }
+
+    TemporaryMemory temp = begin_temporary_memory(scratch);
+    CacheSimulation cache;
+    bool ok = begin_cache_simulation(&cache, vertex_count, MESH_CACHE_SIZE, scratch);
+    u32 *hard = ok ? push_array(scratch, triangle_count + 1, u32) : NULL;
+    u32 *clusters = ok ? push_array(scratch, triangle_count + 1, u32) : NULL;
+    ClusterKey *keys = ok ? push_array(scratch, triangle_count, ClusterKey) : NULL;
+    u32 *result = ok ? push_array(scratch, (memory_index)triangle_count * 3, u32) : NULL;
+    if (!ok || !hard || !clusters || !keys || !result)
+    {
+        end_temporary_memory(temp);
+        return false;
+    }
+
+    u32 hard_count = find_hard_boundaries(indices, triangle_count, &cache, hard);
+    hard[hard_count] = triangle_count;
+    u32 cluster_count = 0;
+    for (u32 i = 0; i < hard_count; ++i)
+    {
+        cluster_count = add_soft_boundaries(indices, hard[i], hard[i + 1], threshold, &cache,
+                                            clusters, cluster_count);
+    }
+    clusters[cluster_count] = triangle_count;
+
+    Vec3 mesh_center = vec3(0.0f, 0.0f, 0.0f);
+    for (u32 i = 0; i < vertex_count; ++i)
+    {
+        mesh_center += vertices[i].position;
+    }
+    mesh_center = mesh_center / (f32)vertex_count;
+
+    // Area weighted, the cross product is twice the area along the normal
+    for (u32 i = 0; i < cluster_count; ++i)
+    {
+        Vec3 center = vec3(0.0f, 0.0f, 0.0f);
+        Vec3 normal = vec3(0.0f, 0.0f, 0.0f);
+        f32 area = 0.0f;
+        for (u32 triangle = clusters[i]; triangle < clusters[i + 1]; ++triangle)
+        {
+            Vec3 a = vertices[indices[triangle * 3 + 0]].position;
+            Vec3 b = vertices[indices[triangle * 3 + 1]].position;
+            Vec3 c = vertices[indices[triangle * 3 + 2]].position;
+            Vec3 face = cross(b - a, c - a);
+            f32 face_area = length(face);
+            center += (a + b + c) * (face_area / 3.0f);
+            normal += face;
+            area += face_area;
+        }
+
+        f32 normal_length = length(normal);
+        keys[i].cluster = i;
+        keys[i].key = area > 0.0f && normal_length > 0.0f
+                    ? dot(center / area - mesh_center, normal / normal_length)
+                    : 0.0f;
+    }
+    qsort(keys, cluster_count, sizeof(ClusterKey), compare_cluster_keys);
+
+    u32 *at = result;
+    for (u32 i = 0; i < cluster_count; ++i)
+    {
+        u32 cluster = keys[i].cluster;
+        memory_index count = (memory_index)(clusters[cluster + 1] - clusters[cluster]) * 3;
+        memcpy(at, indices + clusters[cluster] * 3, count * sizeof(u32));
+        at += count;
+    }
+    memcpy(indices, result, (memory_index)triangle_count * 3 * sizeof(u32));
+
+    end_temporary_memory(temp);
+    return true;
+}
+
+
+struct OverdrawCorner
+{
+    f32 x, y, depth;
+};
+
+
+// Edge a to b of a counterclockwise triangle, y up: inside is positive, on
+// the edge counts for top and left edges only, so shared edges shade once
+internal bool inside_edge(OverdrawCorner a, OverdrawCorner b, f32 x, f32 y, f32 *weight)
+{
+    *weight = (b.x - a.x) * (y - a.y) - (b.y - a.y) * (x - a.x);
+    bool top_left = b.y < a.y || (b.y == a.y && b.x < a.x);
+    return *weight > 0.0f || (*weight == 0.0f && top_left);
+}
+
+
+// Pixel centers inside, closer than the depth buffer
+internal void rasterize_overdraw(const OverdrawCorner *corners, f32 *depth, OverdrawStats *stats)
+{
+    OverdrawCorner a = corners[0], b = corners[1], c = corners[2];
+    f32 area = (b.x - a.x) * (c.y - a.y) - (b.y - a.y) * (c.x - a.x);
+    if (area <= 0.0f)
+    {
+        return;
+    }
+
+    i32 x0 = (i32)floorf(fminf(a.x, fminf(b.x, c.x)));
+    i32 y0 = (i32)floorf(fminf(a.y, fminf(b.y, c.y)));
+    i32 x1 = (i32)ceilf(fmaxf(a.x, fmaxf(b.x, c.x)));
+    i32 y1 = (i32)ceilf(fmaxf(a.y, fmaxf(b.y, c.y)));
+    x0 = x0 > 0 ? x0 : 0;
+    y0 = y0 > 0 ? y0 : 0;
+    x1 = x1 < MESH_OVERDRAW_VIEWPORT - 1 ? x1 : MESH_OVERDRAW_VIEWPORT - 1;
+    y1 = y1 < MESH_OVERDRAW_VIEWPORT - 1 ? y1 : MESH_OVERDRAW_VIEWPORT - 1;
+
+    for (i32 y = y0; y <= y1; ++y)
+    {
+        for (i32 x = x0; x <= x1; ++x)
+        {
+            f32 px = (f32)x + 0.5f;
+            f32 py = (f32)y + 0.5f;
+            f32 wa, wb, wc;
+            if (!inside_edge(b, c, px, py, &wa) || !inside_edge(c, a, px, py, &wb)
+                || !inside_edge(a, b, px, py, &wc))
+            {
+                continue;
+            }
+
+            f32 z = (wa * a.depth + wb * b.depth + wc * c.depth) / area;
+            f32 *pixel = &depth[y * MESH_OVERDRAW_VIEWPORT + x];
+            if (z < *pixel)
+            {
+                *pixel = z;
+                ++stats->shaded;
+            }
+        }
+    }
+}
+
+
+OverdrawStats analyze_overdraw(const u32 *indices, u32 index_count, const Vertex *vertices, u32 vertex_count,
+                               MemoryArena *scratch)
+{
+    OverdrawStats stats = {};
+    if (index_count < 3 || vertex_count == 0)
+    {
+        return stats;
+    }
+
+    TemporaryMemory temp = begin_temporary_memory(scratch);
+    u32 pixel_count = MESH_OVERDRAW_VIEWPORT * MESH_OVERDRAW_VIEWPORT;
+    f32 *depth = push_array(scratch, pixel_count, f32);
+    if (depth == NULL)
+    {
+        end_temporary_memory(temp);
+        return stats;
+    }
+
+    Vec3 bounds_min = vertices[0].position;
+    Vec3 bounds_max = vertices[0].position;
+    for (u32 i = 1; i < vertex_count; ++i)
+    {
+        bounds_min = min(bounds_min, vertices[i].position);
+        bounds_max = max(bounds_max, vertices[i].position);
+    }
+    Vec3 extent = bounds_max - bounds_min;
+    f32 largest = fmaxf(extent.x, fmaxf(extent.y, extent.z));
+    f32 scale = largest > 0.0f ? (f32)MESH_OVERDRAW_VIEWPORT / largest : 1.0f;
+
+    // Looking down -axis, then +axis with y mirrored to keep the winding
+    for (u32 view = 0; view < 6; ++view)
+    {
+        u32 axis = view / 2;
+        u32 right = (axis + 1) % 3;
+        u32 up = (axis + 2) % 3;
+        bool toward = view & 1;
+        for (u32 i = 0; i < pixel_count; ++i)
+        {
+            depth[i] = FLT_MAX;
+        }
+
+        for (u32 i = 0; i + 2 < index_count; i += 3)
+        {
+            OverdrawCorner corners[3];
+            for (u32 c = 0; c < 3; ++c)
+            {
+                Vec3 position = vertices[indices[i + c]].position;
+                corners[c].x = (position.e[right] - bounds_min.e[right]) * scale;
+                corners[c].y = toward ? (bounds_max.e[up] - position.e[up]) * scale
+                                      : (position.e[up] - bounds_min.e[up]) * scale;
+                corners[c].depth = toward ? position.e[axis] : -position.e[axis];
+            }
+            rasterize_overdraw(corners, depth, &stats);
+        }
+
+        for (u32 i = 0; i < pixel_count; ++i)
+        {
+            stats.covered += depth[i] != FLT_MAX;
+        }
+    }
+    stats.overdraw = stats.covered ? (f32)stats.shaded / (f32)stats.covered : 0.0f;
+
+    end_temporary_memory(temp);
+    return stats;
+}
+
+
+// VERTEX FETCH ###############################################################
+
+
+bool optimize_vertex_fetch(Mesh *mesh, MemoryArena *scratch)
+{
+    if (mesh->index_count == 0)
+    {
+        return true;
+    }
+
+    TemporaryMemory temp = begin_temporary_memory(scratch);
+    u32 *remap = push_array(scratch, mesh->vertex_count, u32);
+    Vertex *vertices = push_array(scratch, mesh->vertex_count, Vertex);
+    if (!remap || !vertices)
+    {
+        end_temporary_memory(temp);
+        return false;
+    }
+
+    memset(remap, 0xFF, (memory_index)mesh->vertex_count * sizeof(u32));
+    u32 count = 0;
+    for (u32 i = 0; i < mesh->index_count; ++i)
+    {
+        u32 vertex = mesh->indices[i];
+        if (remap[vertex] == NO_VERTEX)
+        {
+            remap[vertex] = count;
+            vertices[count++] = mesh->vertices[vertex];
+        }
+        mesh->indices[i] = remap[vertex];
+    }
+    memcpy(mesh->vertices, vertices, (memory_index)count * sizeof(Vertex));
+    mesh->vertex_count = count;
+
+    end_temporary_memory(temp);
+    return true;
+}
+
+
+bool optimize_mesh(Mesh *mesh, MemoryArena *scratch, MeshOptimizeStats *stats)
+{
+    if (stats)
+    {
+        stats->before = analyze_vertex_cache(mesh->indices, mesh->index_count, mesh->vertex_count,
+                                             MESH_CACHE_SIZE, scratch);
+    }
+
+    bool ok = optimize_vertex_cache(mesh->indices, mesh->index_count, mesh->vertex_count, scratch)
+           && optimize_overdraw(mesh->indices, mesh->index_count, mesh->vertices, mesh->vertex_count,
+                                MESH_OVERDRAW_THRESHOLD, scratch)
+           && optimize_vertex_fetch(mesh, scratch);
+
+    if (stats)
+    {
+        stats->after = analyze_vertex_cache(mesh->indices, mesh->index_count, mesh->vertex_count,
+                                            MESH_CACHE_SIZE, scratch);
+    }
+    return ok;
+}
@@ -0,0 +1,89 @@
+#pragma once
+
+#include "platform.hpp"
+#include "mesh.hpp"
+
+
+// Index and vertex reordering at import, so the GPU transforms, shades and
+// fetches less for the same triangles.
+//
+//   1. optimize_vertex_cache(): Tipsify (Sander, Nehab and Barczak 2007).
+//      Fans around one vertex at a time and moves on to the most recently
+//      used neighbour that will still be cached, in linear time.
+//   2. optimize_overdraw(): cuts the result into clusters where the cache
+//      starts over anyway, or where cutting costs less than `threshold`
+//      times the cluster's ACMR, and draws clusters facing away from the
+//      mesh's center first. Those tend to occlude the rest.
+//   3. optimize_vertex_fetch(): renumbers the vertices in the order the
+//      indices first use them, unused ones are dropped.
+//
+// ACMR is vertices transformed per triangle (0.5 is ideal for a regular
+// grid, 3 the worst), ATVR vertices transformed per vertex (1 is ideal),
+// both on a FIFO post-transform cache of `cache_size` entries.
+//
+// Overdraw stands in for the fragment work: analyze_overdraw() rasterizes
+// the triangles in index order, back faces culled, with a depth test into
+// a MESH_OVERDRAW_VIEWPORT square from each side of the bounds, along the
+// axes. Fragments passing the depth test per pixel covered is what early Z
+// leaves to shade, 1 is ideal.
+
+
+#define MESH_CACHE_SIZE         16      // FIFO entries optimized for
+#define MESH_OVERDRAW_THRESHOLD 1.05f   // ACMR given up for overdraw
+#define MESH_OVERDRAW_VIEWPORT  256     // pixels a side of analyze_overdraw()
+
+
+struct VertexCacheStats
+{
+    u32 transformed;
+    f32 acmr;
+    f32 atvr;
+};
+
+
+// Summed over the six views
+struct OverdrawStats
+{
+    u64 covered;                // pixels
+    u64 shaded;                 // fragments passing the depth test
+    f32 overdraw;               // shaded per covered
+};
+
+
+struct MeshOptimizeStats
+{
+    VertexCacheStats before;
+    VertexCacheStats after;
+};
+
+
+// The triangles around each vertex, triangles[offsets[v]] up to
+// triangles[offsets[v + 1]]
+struct VertexTriangles
+{
+    u32 *offsets;
+    u32 *triangles;
+    u32  max_count;             // of any vertex
+};
+
+
+// The scratch needs a few words per index and vertex, everything pushed
+// onto it is popped again. The optimizers return false only when it runs
+// out, before they change anything.
+VertexCacheStats analyze_vertex_cache(const u32 *indices, u32 index_count, u32 vertex_count,
+                                      u32 cache_size, MemoryArena *scratch);
+OverdrawStats analyze_overdraw(const u32 *indices, u32 index_count, const Vertex *vertices, u32 vertex_count,
+                               MemoryArena *scratch);
+
+bool optimize_vertex_cache(u32 *indices, u32 index_count, u32 vertex_count, MemoryArena *scratch);
+bool optimize_overdraw(u32 *indices, u32 index_count, const Vertex *vertices, u32 vertex_count,
+                       f32 threshold, MemoryArena *scratch);
+bool optimize_vertex_fetch(Mesh *mesh, MemoryArena *scratch);
+
+// Pushes the arrays onto `scratch`, the simplifier uses it too.
+bool build_vertex_triangles(VertexTriangles *adjacency, const u32 *indices, u32 index_count,
+                            u32 vertex_count, MemoryArena *scratch);
+
+// All three in order, with the cache stats before and after. The mesh is
+// valid whatever step runs out of scratch.
+bool optimize_mesh(Mesh *mesh, MemoryArena *scratch, MeshOptimizeStats *stats = NULL);
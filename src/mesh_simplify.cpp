@@ -0,0 +1,667 @@
+#include <math.h>
+#include <string.h>
+
+#include "mesh_simplify.hpp"
+#include "mesh_optimize.hpp"
+
+
+#define SIMPLIFY_MAX_PASSES    64
+#define SIMPLIFY_BORDER_WEIGHT 10.0f    // of the planes across border edges
+#define SIMPLIFY_MAX_TURN      0.25f    // cosine, a collapse may turn a triangle less than ~75 degrees
+#define SIMPLIFY_SORT_BUCKETS  65536    // the top 16 bits of a cost
+
+#define NO_VERTEX 0xFFFFFFFFu
+#define NO_EDGE   0xFFFFFFFFFFFFFFFFull
+
+
+enum VertexKind
+{
+    VERTEX_MANIFOLD,            // moves anywhere
+    VERTEX_BORDER,              // moves along its border
+    VERTEX_LOCKED,              // seams, corners, non-manifold
+};
+
+
+// Symmetric, the plane terms times their weight, plus the area they stand
+// for to turn sums back into distances
+struct Quadric
+{
+    f32 xx, xy, xz, yy, yz, zz;
+    f32 x, y, z;
+    f32 w;
+    f32 area;
+};
+
+
+struct Collapse
+{
+    u32 from;
+    u32 to;
+    f32 cost;
+};
+
+
+// Directed edges between positions and how often they occur
+struct EdgeTable
+{
+    u64 *keys;
+    u32 *counts;
+    u32  mask;
+};
+
+
+struct Simplifier
+{
+    const u32 *remap;           // vertex to the first vertex at its position
+    Vec3      *positions;       // in the unit cube around the mesh
+    u8        *kinds;           // VertexKind, by position
+    Quadric   *quadrics;        // by position
+    u8        *touched;         // by vertex, this pass
+    EdgeTable  edges;
+    Collapse  *candidates;
+    Collapse  *collapses;       // the candidates by cost
+    u32       *buckets;
+};
+
+
+internal u32 hash_u32(u32 value)
+{
+    value ^= value >> 16;
+    value *= 0x85EBCA6B;
+    value ^= value >> 13;
+    value *= 0xC2B2AE35;
+    value ^= value >> 16;
+    return value;
+}
+
+
+internal u32 table_size(u32 count)
+{
+    u32 size = 1;
+    while (size < count * 2)
+    {
+        size *= 2;
+    }
+    return size;
+}
+
+
+// QUADRICS ###################################################################
+
+
+internal Quadric plane_quadric(Vec3 normal, f32 distance, f32 weight, f32 area)
+{
+    Quadric q;
+    q.xx = weight * normal.x * normal.x;
+    q.xy = weight * normal.x * normal.y;
+    q.xz = weight * normal.x * normal.z;
+    q.yy = weight * normal.y * normal.y;
+    q.yz = weight * normal.y * normal.z;
+    q.zz = weight * normal.z * normal.z;
+    q.x = weight * normal.x * distance;
+    q.y = weight * normal.y * distance;
+    q.z = weight * normal.z * distance;
+    q.w = weight * distance * distance;
+    q.area = area;
+    return q;
+}
+
+
+internal void add_quadric(Quadric *q, const Quadric *other)
+{
+    q->xx += other->xx;
+    q->xy += other->xy;
+    q->xz += other->xz;
+    q->yy += other->yy;
+    q->yz += other->yz;
+    q->zz += other->zz;
+    q->x += other->x;
+    q->y += other->y;
+    q->z += other->z;
+    q->w += other->w;
+    q->area += other->area;
+}
+
+
+// Weighted squared distance of `p` to the planes
+internal f32 quadric_error(const Quadric *q, Vec3 p)
+{
+    f32 rx = q->xx * p.x + q->xy * p.y + q->xz * p.z;
+    f32 ry = q->xy * p.x + q->yy * p.y + q->yz * p.z;
+    f32 rz = q->xz * p.x + q->yz * p.y + q->zz * p.z;
+    f32 error = rx * p.x + ry * p.y + rz * p.z + 2.0f * (q->x * p.x + q->y * p.y + q->z * p.z) + q->w;
+    return fabsf(error);
+}
+
+
+// POSITIONS AND EDGES ########################################################
+
+
+// Vertices that differ only in normal or UV map to the first of them
+internal bool build_position_remap(u32 *remap, const Vertex *vertices, u32 vertex_count, MemoryArena *scratch)
+{
+    TemporaryMemory temp = begin_temporary_memory(scratch);
+    u32 size = table_size(vertex_count);
+    u32 *table = push_array(scratch, size, u32);
+    if (table == NULL)
+    {
+        end_temporary_memory(temp);
+        return false;
+    }
+    memset(table, 0xFF, (memory_index)size * sizeof(u32));
+
+    for (u32 i = 0; i < vertex_count; ++i)
+    {
+        const Vec3 *position = &vertices[i].position;
+        u32 bits[3];
+        memcpy(bits, position, sizeof(bits));
+        u32 slot = hash_u32(bits[0] ^ hash_u32(bits[1] ^ hash_u32(bits[2]))) & (size - 1);
+        while (table[slot] != NO_VERTEX && memcmp(&vertices[table[slot]].position, position, sizeof(Vec3)) != 0)
+        {
+            slot = (slot + 1) & (size - 1);
+        }
+        if (table[slot] == NO_VERTEX)
+        {
+            table[slot] = i;
+        }
+        remap[i] = table[slot];
+    }
+
+    end_temporary_memory(temp);
+    return true;
+}
+
+
+internal u32 *edge_count(EdgeTable *edges, u32 a, u32 b, bool insert)
+{
+    u64 key = ((u64)a << 32) | b;
+    u32 slot = hash_u32(a ^ hash_u32(b)) & edges->mask;
+    while (edges->keys[slot] != key)
+    {
+        if (edges->keys[slot] == NO_EDGE)
+        {
+            if (!insert)
+            {
+                return NULL;
+            }
+            edges->keys[slot] = key;
+            edges->counts[slot] = 0;
+            break;
+        }
+        slot = (slot + 1) & edges->mask;
+    }
+    return &edges->counts[slot];
+}
+
+
+internal void build_edges(Simplifier *simplifier, const u32 *indices, u32 index_count)
+{
+    EdgeTable *edges = &simplifier->edges;
+    memset(edges->keys, 0xFF, ((memory_index)edges->mask + 1) * sizeof(u64));
+    for (u32 i = 0; i < index_count; i += 3)
+    {
+        for (u32 j = 0; j < 3; ++j)
+        {
+            u32 a = simplifier->remap[indices[i + j]];
+            u32 b = simplifier->remap[indices[i + (j + 1) % 3]];
+            if (a != b)
+            {
+                ++*edge_count(edges, a, b, true);
+            }
+        }
+    }
+}
+
+
+// Between positions, used by only one triangle
+internal bool border_edge(Simplifier *simplifier, u32 a, u32 b)
+{
+    u32 *forward = edge_count(&simplifier->edges, a, b, false);
+    u32 *backward = edge_count(&simplifier->edges, b, a, false);
+    return (forward ? *forward : 0) + (backward ? *backward : 0) == 1;
+}
+
+
+internal void classify_vertices(Simplifier *simplifier, const u32 *indices, u32 index_count, u32 vertex_count,
+                                u32 *border_counts)
+{
+    u8 *kinds = simplifier->kinds;
+    memset(kinds, VERTEX_MANIFOLD, vertex_count);
+    memset(border_counts, 0, (memory_index)vertex_count * sizeof(u32));
+
+    // A second vertex at a position makes it a seam
+    for (u32 i = 0; i < vertex_count; ++i)
+    {
+        if (simplifier->remap[i] != i)
+        {
+            kinds[simplifier->remap[i]] = VERTEX_LOCKED;
+        }
+    }
+
+    for (u32 i = 0; i < index_count; i += 3)
+    {
+        for (u32 j = 0; j < 3; ++j)
+        {
+            u32 a = simplifier->remap[indices[i + j]];
+            u32 b = simplifier->remap[indices[i + (j + 1) % 3]];
+            if (a == b)
+            {
+                continue;
+            }
+            if (*edge_count(&simplifier->edges, a, b, false) > 1)
+            {
+                kinds[a] = kinds[b] = VERTEX_LOCKED;
+            }
+            else if (edge_count(&simplifier->edges, b, a, false) == NULL)
+            {
+                ++border_counts[a];
+                ++border_counts[b];
+            }
+        }
+    }
+
+    // Exactly one border through a vertex, anything else is a corner
+    for (u32 i = 0; i < vertex_count; ++i)
+    {
+        if (border_counts[i] > 0 && kinds[i] == VERTEX_MANIFOLD)
+        {
+            kinds[i] = border_counts[i] == 2 ? VERTEX_BORDER : VERTEX_LOCKED;
+        }
+    }
+}
+
+
+internal void build_quadrics(Simplifier *simplifier, const u32 *indices, u32 index_count, u32 vertex_count)
+{
+    memset(simplifier->quadrics, 0, (memory_index)vertex_count * sizeof(Quadric));
+    for (u32 i = 0; i < index_count; i += 3)
+    {
+        u32 corners[3];
+        Vec3 points[3];
+        for (u32 j = 0; j < 3; ++j)
+        {
+            corners[j] = simplifier->remap[indices[i + j]];
+            points[j] = simplifier->positions[corners[j]];
+        }
+
+        Vec3 normal = cross(points[1] - points[0], points[2] - points[0]);
+        f32 double_area = length(normal);
+        if (double_area == 0.0f)
+        {
+            continue;
+        }
+        normal = normal / double_area;
+
+        Quadric face = plane_quadric(normal, -dot(normal, points[0]), 0.5f * double_area, 0.5f * double_area);
+        for (u32 j = 0; j < 3; ++j)
+        {
+            add_quadric(&simplifier->quadrics[corners[j]], &face);
+        }
+
+        for (u32 j = 0; j < 3; ++j)
+        {
+            u32 a = corners[j];
+            u32 b = corners[(j + 1) % 3];
+            if (a == b || edge_count(&simplifier->edges, b, a, false) != NULL)
+            {
+                continue;
+            }
+
+            Vec3 edge = points[(j + 1) % 3] - points[j];
+            f32 edge_length = length(edge);
+            if (edge_length == 0.0f)
+            {
+                continue;
+            }
+            Vec3 across = normalize(cross(edge, normal));
+            Quadric border = plane_quadric(across, -dot(across, points[j]),
+                                           SIMPLIFY_BORDER_WEIGHT * edge_length * edge_length, 0.0f);
+            add_quadric(&simplifier->quadrics[a], &border);
+            add_quadric(&simplifier->quadrics[b], &border);
+        }
+    }
+}
+
+
+// COLLAPSES ##################################################################
+
+
+internal bool collapse_allowed(Simplifier *simplifier, u32 from, u32 to)
+{
+    u32 from_position = simplifier->remap[from];
+    u32 to_position = simplifier->remap[to];
+    if (from_position == to_position)
+    {
+        return false;
+    }
+    switch (simplifier->kinds[from_position])
+    {
+        case VERTEX_MANIFOLD: return true;
+        case VERTEX_BORDER:   return border_edge(simplifier, from_position, to_position);
+        default:              return false;
+    }
+}
+
+
+// Squared, in the unit cube
+internal f32 collapse_cost(Simplifier *simplifier, u32 from, u32 to)
+{
+    const Quadric *from_quadric = &simplifier->quadrics[simplifier->remap[from]];
+    const Quadric *to_quadric = &simplifier->quadrics[simplifier->remap[to]];
+    Vec3 target = simplifier->positions[simplifier->remap[to]];
+    f32 area = from_quadric->area + to_quadric->area;
+    f32 error = quadric_error(from_quadric, target) + quadric_error(to_quadric, target);
+    return area > 0.0f ? error / area : error;
+}
+
+
+// Costs are positive, so their bits sort like they do. Sorting by the top
+// 16 (a mantissa of 7 bits) in one counting pass is close enough for the
+// greedy passes and much faster than an exact sort.
+internal void sort_collapses(Simplifier *simplifier, u32 count)
+{
+    u32 *buckets = simplifier->buckets;
+    memset(buckets, 0, SIMPLIFY_SORT_BUCKETS * sizeof(u32));
+    for (u32 i = 0; i < count; ++i)
+    {
+        u32 bits;
+        memcpy(&bits, &simplifier->candidates[i].cost, sizeof(bits));
+        ++buckets[bits >> 16];
+    }
+
+    u32 offset = 0;
+    for (u32 i = 0; i < SIMPLIFY_SORT_BUCKETS; ++i)
+    {
+        u32 bucket_count = buckets[i];
+        buckets[i] = offset;
+        offset += bucket_count;
+    }
+
+    for (u32 i = 0; i < count; ++i)
+    {
+        u32 bits;
+        memcpy(&bits, &simplifier->candidates[i].cost, sizeof(bits));
+        simplifier->collapses[buckets[bits >> 16]++] = simplifier->candidates[i];
+    }
+}
+
+
+// The cheaper way round of every edge, once, sorted by cost
+internal u32 gather_collapses(Simplifier *simplifier, const u32 *indices, u32 index_count)
+{
+    u32 count = 0;
+    for (u32 i = 0; i < index_count; i += 3)
+    {
+        for (u32 j = 0; j < 3; ++j)
+        {
+            u32 a = indices[i + j];
+            u32 b = indices[i + (j + 1) % 3];
+
+            // Inner edges come up again the other way round in the triangle
+            // next to this one
+            u32 a_position = simplifier->remap[a];
+            u32 b_position = simplifier->remap[b];
+            if (a_position > b_position && edge_count(&simplifier->edges, b_position, a_position, false))
+            {
+                continue;
+            }
+
+            f32 forward = collapse_allowed(simplifier, a, b) ? collapse_cost(simplifier, a, b) : INFINITY;
+            f32 backward = collapse_allowed(simplifier, b, a) ? collapse_cost(simplifier, b, a) : INFINITY;
+            if (forward != INFINITY || backward != INFINITY)
+            {
+                simplifier->candidates[count++] = forward <= backward ? Collapse{a, b, forward}
+                                                                     : Collapse{b, a, backward};
+            }
+        }
+    }
+    sort_collapses(simplifier, count);
+    return count;
+}
+
+
+// By position, another vertex at `vertex` collapses the triangle just as well
+internal bool triangle_uses(Simplifier *simplifier, const u32 *triangle, u32 vertex)
+{
+    u32 position = simplifier->remap[vertex];
+    return simplifier->remap[triangle[0]] == position || simplifier->remap[triangle[1]] == position
+        || simplifier->remap[triangle[2]] == position;
+}
+
+
+// True when moving `from` onto `to` turns any of its other triangles too far
+internal bool collapse_flips(Simplifier *simplifier, const VertexTriangles *adjacency, const u32 *indices,
+                             u32 from, u32 to)
+{
+    Vec3 target = simplifier->positions[simplifier->remap[to]];
+    for (u32 i = adjacency->offsets[from]; i < adjacency->offsets[from + 1]; ++i)
+    {
+        const u32 *triangle = indices + adjacency->triangles[i] * 3;
+        if (triangle_uses(simplifier, triangle, to))
+        {
+            continue;
+        }
+
+        Vec3 points[3];
+        Vec3 moved[3];
+        for (u32 j = 0; j < 3; ++j)
+        {
+            points[j] = simplifier->positions[simplifier->remap[triangle[j]]];
+            moved[j] = triangle[j] == from ? target : points[j];
+        }
+        Vec3 before = cross(points[1] - points[0], points[2] - points[0]);
+        Vec3 after = cross(moved[1] - moved[0], moved[2] - moved[0]);
+        if (dot(before, after) <= SIMPLIFY_MAX_TURN * length(before) * length(after))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+
+// Drops the triangles that lost an edge, returns the new index count
+internal u32 remove_degenerate_triangles(Simplifier *simplifier, u32 *indices, u32 index_count)
+{
+    u32 count = 0;
+    for (u32 i = 0; i < index_count; i += 3)
+    {
+        u32 a = simplifier->remap[indices[i + 0]];
+        u32 b = simplifier->remap[indices[i + 1]];
+        u32 c = simplifier->remap[indices[i + 2]];
+        if (a != b && b != c && c != a)
+        {
+            indices[count + 0] = indices[i + 0];
+            indices[count + 1] = indices[i + 1];
+            indices[count + 2] = indices[i + 2];
+            count += 3;
+        }
+    }
+    return count;
+}
+
+
+// One pass, returns how many collapses it made
+internal u32 collapse_edges(Simplifier *simplifier, u32 *indices, u32 *index_count, u32 vertex_count,
+                            u32 target_index_count, f32 max_cost, f32 *max_applied, MemoryArena *scratch)
+{
+    TemporaryMemory temp = begin_temporary_memory(scratch);
+    VertexTriangles adjacency;
+    if (!build_vertex_triangles(&adjacency, indices, *index_count, vertex_count, scratch))
+    {
+        end_temporary_memory(temp);
+        return 0;
+    }
+
+    build_edges(simplifier, indices, *index_count);
+    u32 candidate_count = gather_collapses(simplifier, indices, *index_count);
+    memset(simplifier->touched, 0, vertex_count);
+
+    u32 triangles = *index_count / 3;
+    u32 target_triangles = target_index_count / 3;
+    u32 collapsed = 0;
+    for (u32 i = 0; i < candidate_count && triangles > target_triangles; ++i)
+    {
+        Collapse *collapse = &simplifier->collapses[i];
+        if (collapse->cost > max_cost)
+        {
+            break;
+        }
+        if (simplifier->touched[collapse->from] || simplifier->touched[collapse->to]
+            || collapse_flips(simplifier, &adjacency, indices, collapse->from, collapse->to))
+        {
+            continue;
+        }
+
+        // The triangles around `from` are as they were at the start of the
+        // pass: any collapse changing one would have touched `from`
+        for (u32 j = adjacency.offsets[collapse->from]; j < adjacency.offsets[collapse->from + 1]; ++j)
+        {
+            u32 *triangle = indices + adjacency.triangles[j] * 3;
+            bool removed = triangle_uses(simplifier, triangle, collapse->to);
+            for (u32 k = 0; k < 3; ++k)
+            {
+                triangle[k] = triangle[k] == collapse->from ? collapse->to : triangle[k];
+                simplifier->touched[triangle[k]] = 1;
+            }
+            triangles -= removed;
+        }
+        simplifier->touched[collapse->from] = 1;
+
+        add_quadric(&simplifier->quadrics[simplifier->remap[collapse->to]],
+                    &simplifier->quadrics[simplifier->remap[collapse->from]]);
+        *max_applied = collapse->cost > *max_applied ? collapse->cost : *max_applied;
+        ++collapsed;
+    }
+
+    *index_count = remove_degenerate_triangles(simplifier, indices, *index_count);
+    end_temporary_memory(temp);
+    return collapsed;
+}
+
+
+bool simplify_mesh(u32 *result, u32 *result_count, f32 *error,
+                   const u32 *indices, u32 index_count, const Vertex *vertices, u32 vertex_count,
+                   u32 target_index_count, f32 max_error, MemoryArena *scratch)
+{
+    index_count -= index_count % 3;
+    *error = 0.0f;
+    if (index_count == 0 || vertex_count == 0)
+    {
+        *result_count = 0;
+        return true;
+    }
+
+    TemporaryMemory temp = begin_temporary_memory(scratch);
+    Simplifier simplifier = {};
+    u32 *remap = push_array(scratch, vertex_count, u32);
+    simplifier.remap = remap;
+    simplifier.positions = push_array(scratch, vertex_count, Vec3);
+    simplifier.kinds = push_array(scratch, vertex_count, u8);
+    simplifier.quadrics = push_array(scratch, vertex_count, Quadric);
+    simplifier.touched = push_array(scratch, vertex_count, u8);
+    u32 edge_slots = table_size(index_count);
+    simplifier.edges.keys = push_array(scratch, edge_slots, u64);
+    simplifier.edges.counts = push_array(scratch, edge_slots, u32);
+    simplifier.edges.mask = edge_slots - 1;
+    simplifier.candidates = push_array(scratch, index_count, Collapse);
+    simplifier.collapses = push_array(scratch, index_count, Collapse);
+    simplifier.buckets = push_array(scratch, SIMPLIFY_SORT_BUCKETS, u32);
+    u32 *border_counts = push_array(scratch, vertex_count, u32);
+    if (!remap || !simplifier.positions || !simplifier.kinds || !simplifier.quadrics || !simplifier.touched
+        || !simplifier.edges.keys || !simplifier.edges.counts || !simplifier.candidates || !simplifier.collapses
+        || !simplifier.buckets || !border_counts
+        || !build_position_remap(remap, vertices, vertex_count, scratch))
+    {
+        end_temporary_memory(temp);
+        return false;
+    }
+
+    // Errors are computed in the unit cube, f32 keeps its precision there
+    Vec3 bounds_min = vertices[0].position;
+    Vec3 bounds_max = vertices[0].position;
+    for (u32 i = 1; i < vertex_count; ++i)
+    {
+        bounds_min = min(bounds_min, vertices[i].position);
+        bounds_max = max(bounds_max, vertices[i].position);
+    }
+    Vec3 extent = bounds_max - bounds_min;
+    f32 size = fmaxf(extent.x, fmaxf(extent.y, extent.z));
+    f32 scale = size > 0.0f ? 1.0f / size : 1.0f;
+    for (u32 i = 0; i < vertex_count; ++i)
+    {
+        simplifier.positions[i] = (vertices[i].position - bounds_min) * scale;
+    }
+
+    memcpy(result, indices, (memory_index)index_count * sizeof(u32));
+    u32 count = remove_degenerate_triangles(&simplifier, result, index_count);
+    build_edges(&simplifier, result, count);
+    classify_vertices(&simplifier, result, count, vertex_count, border_counts);
+    build_quadrics(&simplifier, result, count, vertex_count);
+
+    f32 max_cost = max_error * scale * max_error * scale;
+    f32 max_applied = 0.0f;
+    for (u32 pass = 0; pass < SIMPLIFY_MAX_PASSES && count > target_index_count; ++pass)
+    {
+        if (collapse_edges(&simplifier, result, &count, vertex_count, target_index_count,
+                           max_cost, &max_applied, scratch) == 0)
+        {
+            break;
+        }
+    }
+
+    *result_count = count;
+    *error = sqrtf(max_applied) / scale;
+    end_temporary_memory(temp);
+    return true;
+}
+
+
+bool generate_mesh_lods(Mesh *mesh, u32 *indices, u32 index_capacity, MemoryArena *scratch)
+{
+    MeshLod *lods = mesh->lods;
+    u32 base_count = mesh->lod_count ? mesh->lods[0].index_count : mesh->index_count;
+    if (base_count > index_capacity)
+    {
+        return false;
+    }
+    if (base_count)
+    {
+        memmove(indices, mesh->indices + (mesh->lod_count ? mesh->lods[0].first_index : 0),
+                (memory_index)base_count * sizeof(u32));
+    }
+    lods[0] = {0, base_count, 0.0f};
+    u32 lod_count = 1;
+    u32 used = base_count;
+
+    while (lod_count < MESH_MAX_LODS)
+    {
+        const MeshLod *previous = &lods[lod_count - 1];
+        u32 target = (u32)((f32)(previous->index_count / 3) * MESH_LOD_REDUCTION) * 3;
+        if (target < MESH_LOD_MIN_TRIANGLES * 3 || index_capacity - used < previous->index_count)
+        {
+            break;
+        }
+
+        u32 count;
+        f32 error;
+        if (!simplify_mesh(indices + used, &count, &error, indices + previous->first_index, previous->index_count,
+                           mesh->vertices, mesh->vertex_count, target, INFINITY, scratch)
+            || !optimize_vertex_cache(indices + used, count, mesh->vertex_count, scratch))
+        {
+            return false;
+        }
+        if (count > previous->index_count - previous->index_count / 4)
+        {
+            break;
+        }
+
+        lods[lod_count++] = {used, count, previous->error + error};
+        used += count;
+    }
+
+    mesh->indices = indices;
+    mesh->index_count = used;
+    mesh->lod_count = lod_count;
+    return true;
+}
@@ -0,0 +1,42 @@
+#pragma once
+
+#include "platform.hpp"
+#include "mesh.hpp"
+
+
+// Mesh simplification for levels of detail, at import.
+//
+// Edge collapses ordered by the quadric error metric (Garland and Heckbert
+// 1997): each vertex sums the squared distances to the planes of its
+// triangles, weighted by their area, and a collapse costs how far the
+// moved vertex ends up from the planes of both ends. Vertices only move
+// onto a neighbour, so every LOD indexes the same vertex buffer.
+//
+// Collapses go in passes: every candidate edge sorted by cost, then the
+// cheapest ones whose neighbourhoods do not overlap, skipping any that
+// would flip a triangle. Open borders only collapse along themselves, with
+// a plane across every border edge holding them in place, and vertices on
+// attribute seams (several vertices at one position with different normals
+// or UVs) never move, so outlines and texture mapping hold. A mesh that is
+// all seams, a flat shaded one for instance, barely simplifies.
+
+
+#define MESH_LOD_REDUCTION     0.5f     // triangles of a LOD against the one before
+#define MESH_LOD_MIN_TRIANGLES 64       // none smaller than this
+
+
+// Simplifies the triangles of `indices` into `result`, which has room for
+// index_count, until target_index_count are left or every collapse would
+// move the surface more than `max_error` (object space). `error` is the
+// largest any collapse made did. False only when the scratch runs out.
+bool simplify_mesh(u32 *result, u32 *result_count, f32 *error,
+                   const u32 *indices, u32 index_count, const Vertex *vertices, u32 vertex_count,
+                   u32 target_index_count, f32 max_error, MemoryArena *scratch);
+
+// Fills mesh->lods: LOD 0 is the mesh as it is, each next one simplified
+// from the one before to MESH_LOD_REDUCTION of its triangles and ordered
+// for the vertex cache, with the errors summed up. Stops at MESH_MAX_LODS,
+// MESH_LOD_MIN_TRIANGLES, when a step saves less than a quarter or when
+// `indices` is full; twice mesh->index_count is room for most chains.
+// mesh->indices points to `indices` after.
+bool generate_mesh_lods(Mesh *mesh, u32 *indices, u32 index_capacity, MemoryArena *scratch);
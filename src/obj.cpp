@@ -0,0 +1,941 @@
+#include <string.h>
+
+#include "obj.hpp"
+#include "jobs.hpp"
+
+
+#define OBJ_NONE      -1
+#define OBJ_MIN_TABLE 256
+
+
+// Parsed, the indices are as in the file (1-based, 0 when absent) unless
+// their bit in `relative` is set: negative indices are stored as offsets
+// from the chunk's first attribute of that kind. Resolved, they are 0-based
+// into the whole file's arrays, OBJ_NONE when absent, and `hash` is the hash
+// of the vertex values.
+struct ObjCorner
+{
+    i32 position;
+    i32 uv;
+    i32 normal;
+    union
+    {
+        u32 relative;
+        u32 hash;
+    };
+};
+
+
+enum ObjRelative
+{
+    OBJ_RELATIVE_POSITION = 1 << 0,
+    OBJ_RELATIVE_UV       = 1 << 1,
+    OBJ_RELATIVE_NORMAL   = 1 << 2,
+};
+
+
+struct ObjChunk
+{
+    const char *begin;
+    const char *end;
+
+    // Parsed, in the chunk's own worst case sized arrays
+    Vec3       *positions;
+    Vec2       *uvs;
+    Vec3       *normals;
+    ObjCorner  *corners;
+    u32         position_count;
+    u32         uv_count;
+    u32         normal_count;
+    u32         corner_count;
+
+    // Where the chunk's items start in the whole file
+    u32         position_base;
+    u32         uv_base;
+    u32         normal_base;
+    u32         corner_base;
+
+    u32         partition_counts[OBJ_PARTITIONS];
+    u32         partition_offsets[OBJ_PARTITIONS];
+    u32         first_count;    // corners that are their vertex's first use
+    u32         first_base;
+    bool        failed;
+};
+
+
+// A corner with its id + 1, copied so the partition passes read and compare
+// without jumping around the whole file's corners
+struct ObjSlot
+{
+    ObjCorner corner;
+    u32       id;
+};
+
+
+struct ObjPartition
+{
+    ObjSlot *corners;           // the corners hashed here, file order
+    u32      count;
+    ObjSlot *unique;            // first uses, in order
+    u32      unique_count;
+    u32     *table;             // index into unique + 1, 0 for empty
+    u32      mask;
+};
+
+
+struct ObjLoad
+{
+    ObjChunk     *chunks;
+    u32           chunk_count;
+    ObjPartition  partitions[OBJ_PARTITIONS];
+
+    // Whole file
+    Vec3         *positions;
+    Vec2         *uvs;
+    Vec3         *normals;
+    ObjCorner    *corners;
+    u32          *position_hashes;
+    u32          *uv_hashes;
+    u32          *normal_hashes;
+    u32           zero_uv_hash;
+    u32           zero_normal_hash;
+    u32           position_count;
+    u32           uv_count;
+    u32           normal_count;
+    u32           corner_count;
+
+    u32          *first_use;    // per corner, the id of the corner that first had its vertex
+    u32          *vertex_id;    // per first use corner, its vertex
+
+    Mesh         *mesh;
+};
+
+
+// NUMBERS ####################################################################
+
+
+global_variable const f64 powers_of_ten[] =
+{
+    1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22,
+};
+
+
+internal const char *skip_spaces(const char *at, const char *end)
+{
+    while (at < end && (*at == ' ' || *at == '\t'))
+    {
+        ++at;
+    }
+    return at;
+}
+
+
+global_variable const u64 integer_powers_of_ten[] =
+{
+    1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000,
+};
+
+
+// The run of digits starting at the first of eight bytes: its length and,
+// combined in parallel across the bytes, its value
+internal u32 parse_eight_digits(const char *at, u64 *value)
+{
+    u64 bytes;
+    memcpy(&bytes, at, sizeof(bytes));
+    u64 offset = bytes - 0x3030303030303030ull;
+    u64 non_digits = (offset | (offset + 0x7676767676767676ull)) & 0x8080808080808080ull;
+    u32 count = non_digits ? (u32)__builtin_ctzll(non_digits) / 8 : 8;
+    if (count == 0)
+    {
+        return 0;
+    }
+
+    // Drops the bytes after the run, the digits move up behind zeros
+    bytes = (bytes & 0x0F0F0F0F0F0F0F0Full) << (8 - count) * 8;
+    bytes = (bytes * 2561) >> 8;
+    bytes = ((bytes & 0x00FF00FF00FF00FFull) * 6553601) >> 16;
+    *value = ((bytes & 0x0000FFFF0000FFFFull) * 42949672960001ull) >> 32;
+    return count;
+}
+
+
+// Adds a run of digits to the mantissa, keeping up to 19 significant ones.
+// Dropped integer digits scale the exponent up, kept fraction digits down.
+internal const char *parse_digits(const char *at, const char *end, bool fraction,
+                                  u64 *mantissa, u32 *digits, i32 *exponent, bool *any)
+{
+    while (end - at >= 8)
+    {
+        u64 value;
+        u32 count = parse_eight_digits(at, &value);
+        u32 significant = count;
+        if (*mantissa == 0)
+        {
+            for (significant = 0; significant < count && value >= integer_powers_of_ten[significant]; ++significant);
+        }
+        if (count == 0 || *digits + significant > 19)
+        {
+            break;
+        }
+
+        *any = true;
+        *mantissa = *mantissa * integer_powers_of_ten[count] + value;
+        *digits += significant;
+        *exponent -= fraction ? count : 0;
+        at += count;
+        if (count < 8)
+        {
+            return at;
+        }
+    }
+
+    for (; at < end && (u32)(*at - '0') < 10; ++at)
+    {
+        *any = true;
+        if (*digits < 19)
+        {
+            *mantissa = *mantissa * 10 + (u32)(*at - '0');
+            *digits += *mantissa != 0;
+            *exponent -= fraction;
+        }
+        else
+        {
+            *exponent += !fraction;
+        }
+    }
+    return at;
+}
+
+
+// Decimal with optional fraction and exponent. Up to 19 significant digits
+// are exact in the u64, scaling by an exact power of ten then rounds once.
+// NULL if there is no number at `at`.
+internal const char *parse_float(const char *at, const char *end, f32 *result)
+{
+    bool negative = false;
+    if (at < end && (*at == '-' || *at == '+'))
+    {
+        negative = *at == '-';
+        ++at;
+    }
+
+    u64 mantissa = 0;
+    i32 exponent = 0;
+    u32 digits = 0;
+    bool any = false;
+    at = parse_digits(at, end, false, &mantissa, &digits, &exponent, &any);
+    if (at < end && *at == '.')
+    {
+        at = parse_digits(at + 1, end, true, &mantissa, &digits, &exponent, &any);
+    }
+    if (!any)
+    {
+        return NULL;
+    }
+
+    if (at < end && (*at == 'e' || *at == 'E'))
+    {
+        const char *exponent_at = at + 1;
+        bool exponent_negative = false;
+        if (exponent_at < end && (*exponent_at == '-' || *exponent_at == '+'))
+        {
+            exponent_negative = *exponent_at == '-';
+            ++exponent_at;
+        }
+        if (exponent_at < end && (u32)(*exponent_at - '0') < 10)
+        {
+            i32 value = 0;
+            for (; exponent_at < end && (u32)(*exponent_at - '0') < 10; ++exponent_at)
+            {
+                value = value < 10000 ? value * 10 + (*exponent_at - '0') : value;
+            }
+            exponent += exponent_negative ? -value : value;
+            at = exponent_at;
+        }
+    }
+
+    f64 value = (f64)mantissa;
+    while (exponent > 22)
+    {
+        value *= 1e22;
+        exponent -= 22;
+    }
+    while (exponent < -22)
+    {
+        value /= 1e22;
+        exponent += 22;
+    }
+    value = exponent < 0 ? value / powers_of_ten[-exponent] : value * powers_of_ten[exponent];
+
+    *result = (f32)(negative ? -value : value);
+    return at;
+}
+
+
+internal const char *parse_index(const char *at, const char *end, i32 *result)
+{
+    bool negative = at < end && *at == '-';
+    at += negative;
+    if (at == end || (u32)(*at - '0') >= 10)
+    {
+        return NULL;
+    }
+
+    i64 value = 0;
+    for (; at < end && (u32)(*at - '0') < 10; ++at)
+    {
+        value = value < 0x7FFFFFFF ? value * 10 + (*at - '0') : value;
+    }
+    value = value > 0x7FFFFFFF ? 0x7FFFFFFF : value;
+    *result = (i32)(negative ? -value : value);
+    return at;
+}
+
+
+// PARSING ####################################################################
+
+
+// Worst case items per chunk byte, from the shortest line of each kind:
+// "v 0 0 0\n", "vt 0\n", "vn 0 0 0\n", and a face of n corners takes at
+// least 2n + 2 bytes for 3(n - 2) triangle corners.
+internal void chunk_capacities(memory_index bytes, u64 *positions, u64 *uvs, u64 *normals, u64 *corners)
+{
+    *positions = bytes / 8 + 1;
+    *uvs = bytes / 5 + 1;
+    *normals = bytes / 9 + 1;
+    *corners = bytes * 3 / 2 + 3;
+}
+
+
+internal u64 chunk_memory(memory_index bytes)
+{
+    u64 positions, uvs, normals, corners;
+    chunk_capacities(bytes, &positions, &uvs, &normals, &corners);
+    return positions * sizeof(Vec3) + uvs * sizeof(Vec2) + normals * sizeof(Vec3)
+         + corners * sizeof(ObjCorner) + 4 * ARENA_DEFAULT_ALIGNMENT;
+}
+
+
+// Parses one "i", "i/j", "i//k" or "i/j/k" corner
+internal const char *parse_corner(const char *at, const char *end, ObjChunk *chunk, ObjCorner *corner)
+{
+    *corner = {};
+    at = parse_index(at, end, &corner->position);
+    if (at == NULL)
+    {
+        return NULL;
+    }
+    if (at < end && *at == '/')
+    {
+        ++at;
+        if (at < end && *at != '/')
+        {
+            at = parse_index(at, end, &corner->uv);
+            if (at == NULL)
+            {
+                return NULL;
+            }
+        }
+        if (at < end && *at == '/')
+        {
+            at = parse_index(at + 1, end, &corner->normal);
+            if (at == NULL)
+            {
+                return NULL;
+            }
+        }
+    }
+
+    if (corner->position < 0)
+    {
+        corner->position += chunk->position_count;
+        corner->relative |= OBJ_RELATIVE_POSITION;
+    }
+    if (corner->uv < 0)
+    {
+        corner->uv += chunk->uv_count;
+        corner->relative |= OBJ_RELATIVE_UV;
+    }
+    if (corner->normal < 0)
+    {
+        corner->normal += chunk->normal_count;
+        corner->relative |= OBJ_RELATIVE_NORMAL;
+    }
+    return at;
+}
+
+
+internal const char *parse_floats(const char *at, const char *end, f32 *values, u32 count)
+{
+    for (u32 i = 0; i < count && at; ++i)
+    {
+        at = parse_float(skip_spaces(at, end), end, &values[i]);
+    }
+    return at;
+}
+
+
+internal bool parse_chunk(ObjChunk *chunk)
+{
+    const char *at = chunk->begin;
+    const char *end = chunk->end;
+    while (at < end)
+    {
+        const char *line_end = (const char *)memchr(at, '\n', end - at);
+        line_end = line_end ? line_end : end;
+        at = skip_spaces(at, line_end);
+
+        if (line_end - at >= 2 && at[0] == 'v' && (at[1] == ' ' || at[1] == '\t'))
+        {
+            f32 *position = chunk->positions[chunk->position_count++].e;
+            if (!parse_floats(at + 1, line_end, position, 3))
+            {
+                return false;
+            }
+        }
+        else if (line_end - at >= 3 && at[0] == 'v' && at[1] == 't' && (at[2] == ' ' || at[2] == '\t'))
+        {
+            Vec2 *uv = &chunk->uvs[chunk->uv_count++];
+            const char *next = parse_floats(at + 2, line_end, uv->e, 1);
+            if (!next)
+            {
+                return false;
+            }
+            uv->y = 0.0f;
+            parse_floats(next, line_end, &uv->y, 1);
+        }
+        else if (line_end - at >= 3 && at[0] == 'v' && at[1] == 'n' && (at[2] == ' ' || at[2] == '\t'))
+        {
+            f32 *normal = chunk->normals[chunk->normal_count++].e;
+            if (!parse_floats(at + 2, line_end, normal, 3))
+            {
+                return false;
+            }
+        }
+        else if (line_end - at >= 2 && at[0] == 'f' && (at[1] == ' ' || at[1] == '\t'))
+        {
+            // Fan around the first corner
+            ObjCorner first = {};
+            ObjCorner previous = {};
+            ObjCorner corner;
+            u32 count = 0;
+            for (at = skip_spaces(at + 1, line_end); at < line_end && *at != '\r' && *at != '#'; at = skip_spaces(at, line_end))
+            {
+                at = parse_corner(at, line_end, chunk, &corner);
+                if (at == NULL)
+                {
+                    return false;
+                }
+
+                if (count >= 2)
+                {
+                    ObjCorner *triangle = &chunk->corners[chunk->corner_count];
+                    triangle[0] = first;
+                    triangle[1] = previous;
+                    triangle[2] = corner;
+                    chunk->corner_count += 3;
+                }
+                first = count == 0 ? corner : first;
+                previous = corner;
+                ++count;
+            }
+        }
+
+        at = line_end + 1;
+    }
+    return true;
+}
+
+
+internal void parse_chunks_job(void *data, u32 first, u32 count)
+{
+    ObjLoad *load = (ObjLoad *)data;
+    for (u32 i = first; i < first + count; ++i)
+    {
+        ObjChunk *chunk = &load->chunks[i];
+        chunk->failed = !parse_chunk(chunk);
+    }
+}
+
+
+// RESOLVING ##################################################################
+
+
+internal u32 hash_floats(const f32 *values, u32 count)
+{
+    u32 hash = 0x9E3779B9u;
+    for (u32 i = 0; i < count; ++i)
+    {
+        u32 bits;
+        memcpy(&bits, &values[i], sizeof(bits));
+        hash = (hash ^ bits) * 0x85EBCA6Bu;
+        hash ^= hash >> 15;
+    }
+    return hash;
+}
+
+
+// The values are copied next to each other and hashed once here, corners
+// then only combine three hashes from arrays a third of the size
+internal void gather_chunks_job(void *data, u32 first, u32 count)
+{
+    ObjLoad *load = (ObjLoad *)data;
+    for (u32 i = first; i < first + count; ++i)
+    {
+        ObjChunk *chunk = &load->chunks[i];
+        memcpy(load->positions + chunk->position_base, chunk->positions, chunk->position_count * sizeof(Vec3));
+        memcpy(load->uvs + chunk->uv_base, chunk->uvs, chunk->uv_count * sizeof(Vec2));
+        memcpy(load->normals + chunk->normal_base, chunk->normals, chunk->normal_count * sizeof(Vec3));
+        for (u32 j = 0; j < chunk->position_count; ++j)
+        {
+            load->position_hashes[chunk->position_base + j] = hash_floats(chunk->positions[j].e, 3);
+        }
+        for (u32 j = 0; j < chunk->uv_count; ++j)
+        {
+            load->uv_hashes[chunk->uv_base + j] = hash_floats(chunk->uvs[j].e, 2);
+        }
+        for (u32 j = 0; j < chunk->normal_count; ++j)
+        {
+            load->normal_hashes[chunk->normal_base + j] = hash_floats(chunk->normals[j].e, 3);
+        }
+    }
+}
+
+
+internal bool resolve_index(i32 *index, bool relative, u32 base, u32 count)
+{
+    if (!relative && *index == 0)
+    {
+        *index = OBJ_NONE;
+        return true;
+    }
+    i64 resolved = relative ? (i64)base + *index : (i64)*index - 1;
+    *index = (i32)resolved;
+    return resolved >= 0 && resolved < (i64)count;
+}
+
+
+internal Vertex corner_vertex(ObjLoad *load, const ObjCorner *corner)
+{
+    Vertex vertex = {};
+    vertex.position = load->positions[corner->position];
+    if (corner->normal != OBJ_NONE)
+    {
+        vertex.normal = load->normals[corner->normal];
+    }
+    if (corner->uv != OBJ_NONE)
+    {
+        vertex.uv = load->uvs[corner->uv];
+    }
+    return vertex;
+}
+
+
+// Absent attributes are zero and hash like it, equal values always hash
+// the same
+internal u32 hash_corner(ObjLoad *load, const ObjCorner *corner)
+{
+    u32 position = load->position_hashes[corner->position];
+    u32 uv = corner->uv != OBJ_NONE ? load->uv_hashes[corner->uv] : load->zero_uv_hash;
+    u32 normal = corner->normal != OBJ_NONE ? load->normal_hashes[corner->normal] : load->zero_normal_hash;
+    u32 hash = position ^ (uv * 0xCC9E2D51u) ^ (normal * 0x1B873593u);
+    hash ^= hash >> 16;
+    hash *= 0x85EBCA6Bu;
+    hash ^= hash >> 13;
+    return hash;
+}
+
+
+internal void resolve_chunks_job(void *data, u32 first, u32 count)
+{
+    ObjLoad *load = (ObjLoad *)data;
+    for (u32 i = first; i < first + count; ++i)
+    {
+        ObjChunk *chunk = &load->chunks[i];
+        for (u32 j = 0; j < chunk->corner_count; ++j)
+        {
+            ObjCorner *corner = &load->corners[chunk->corner_base + j];
+            *corner = chunk->corners[j];
+            bool valid = resolve_index(&corner->position, corner->relative & OBJ_RELATIVE_POSITION,
+                                       chunk->position_base, load->position_count)
+                      && resolve_index(&corner->uv, corner->relative & OBJ_RELATIVE_UV,
+                                       chunk->uv_base, load->uv_count)
+                      && resolve_index(&corner->normal, corner->relative & OBJ_RELATIVE_NORMAL,
+                                       chunk->normal_base, load->normal_count)
+                      && corner->position != OBJ_NONE;
+            if (!valid)
+            {
+                chunk->failed = true;
+                return;
+            }
+
+            corner->hash = hash_corner(load, corner);
+            ++chunk->partition_counts[corner->hash & (OBJ_PARTITIONS - 1)];
+        }
+    }
+}
+
+
+// DEDUPLICATION ##############################################################
+
+
+internal void bucket_chunks_job(void *data, u32 first, u32 count)
+{
+    ObjLoad *load = (ObjLoad *)data;
+    for (u32 i = first; i < first + count; ++i)
+    {
+        ObjChunk *chunk = &load->chunks[i];
+        u32 offsets[OBJ_PARTITIONS];
+        memcpy(offsets, chunk->partition_offsets, sizeof(offsets));
+        for (u32 j = 0; j < chunk->corner_count; ++j)
+        {
+            u32 id = chunk->corner_base + j;
+            const ObjCorner *corner = &load->corners[id];
+            u32 partition = corner->hash & (OBJ_PARTITIONS - 1);
+            load->partitions[partition].corners[offsets[partition]++] = {*corner, id + 1};
+        }
+    }
+}
+
+
+internal bool same_vertex(ObjLoad *load, const ObjCorner *a, const ObjCorner *b)
+{
+    if (a->hash != b->hash)
+    {
+        return false;
+    }
+    if (a->position == b->position && a->uv == b->uv && a->normal == b->normal)
+    {
+        return true;
+    }
+    Vertex vertex_a = corner_vertex(load, a);
+    Vertex vertex_b = corner_vertex(load, b);
+    return memcmp(&vertex_a, &vertex_b, sizeof(Vertex)) == 0;
+}
+
+
+// Open addressing on indices into the partition's unique vertices, so the
+// table stays small. It starts at OBJ_MIN_TABLE slots and doubles at half
+// full; the room for all corners unique is reserved but rarely touched.
+internal void insert_unique(ObjPartition *partition, u32 unique, u32 slot)
+{
+    while (partition->table[slot] != 0)
+    {
+        slot = (slot + 1) & partition->mask;
+    }
+    partition->table[slot] = unique + 1;
+}
+
+
+internal void grow_table(ObjPartition *partition)
+{
+    u32 size = (partition->mask + 1) * 2;
+    partition->mask = size - 1;
+    memset(partition->table, 0, size * sizeof(u32));
+    for (u32 i = 0; i < partition->unique_count; ++i)
+    {
+        insert_unique(partition, i, (partition->unique[i].corner.hash / OBJ_PARTITIONS) & partition->mask);
+    }
+}
+
+
+internal void dedupe_partitions_job(void *data, u32 first, u32 count)
+{
+    ObjLoad *load = (ObjLoad *)data;
+    for (u32 p = first; p < first + count; ++p)
+    {
+        ObjPartition *partition = &load->partitions[p];
+        partition->mask = OBJ_MIN_TABLE - 1;
+        memset(partition->table, 0, OBJ_MIN_TABLE * sizeof(u32));
+
+        for (u32 i = 0; i < partition->count; ++i)
+        {
+            const ObjCorner *corner = &partition->corners[i].corner;
+            u32 id = partition->corners[i].id - 1;
+
+            // The low bits picked the partition
+            u32 slot = (corner->hash / OBJ_PARTITIONS) & partition->mask;
+            for (;;)
+            {
+                u32 unique = partition->table[slot];
+                if (unique == 0)
+                {
+                    if ((partition->unique_count + 1) * 2 > partition->mask + 1)
+                    {
+                        grow_table(partition);
+                        slot = (corner->hash / OBJ_PARTITIONS) & partition->mask;
+                        continue;
+                    }
+                    partition->table[slot] = partition->unique_count + 1;
+                    partition->unique[partition->unique_count++] = partition->corners[i];
+                    load->first_use[id] = id;
+                    break;
+                }
+
+                const ObjSlot *entry = &partition->unique[unique - 1];
+                if (same_vertex(load, &entry->corner, corner))
+                {
+                    load->first_use[id] = entry->id - 1;
+                    break;
+                }
+                slot = (slot + 1) & partition->mask;
+            }
+        }
+    }
+}
+
+
+internal void count_first_uses_job(void *data, u32 first, u32 count)
+{
+    ObjLoad *load = (ObjLoad *)data;
+    for (u32 i = first; i < first + count; ++i)
+    {
+        ObjChunk *chunk = &load->chunks[i];
+        for (u32 id = chunk->corner_base; id < chunk->corner_base + chunk->corner_count; ++id)
+        {
+            chunk->first_count += load->first_use[id] == id;
+        }
+    }
+}
+
+
+internal void write_vertices_job(void *data, u32 first, u32 count)
+{
+    ObjLoad *load = (ObjLoad *)data;
+    for (u32 i = first; i < first + count; ++i)
+    {
+        ObjChunk *chunk = &load->chunks[i];
+        u32 vertex = chunk->first_base;
+        for (u32 id = chunk->corner_base; id < chunk->corner_base + chunk->corner_count; ++id)
+        {
+            if (load->first_use[id] == id)
+            {
+                load->vertex_id[id] = vertex;
+                load->mesh->vertices[vertex++] = corner_vertex(load, &load->corners[id]);
+            }
+        }
+    }
+}
+
+
+internal void write_indices_job(void *data, u32 first, u32 count)
+{
+    ObjLoad *load = (ObjLoad *)data;
+    for (u32 i = first; i < first + count; ++i)
+    {
+        ObjChunk *chunk = &load->chunks[i];
+        for (u32 id = chunk->corner_base; id < chunk->corner_base + chunk->corner_count; ++id)
+        {
+            load->mesh->indices[id] = load->vertex_id[load->first_use[id]];
+        }
+    }
+}
+
+
+// ############################################################################
+
+
+internal bool any_chunk_failed(ObjLoad *load)
+{
+    for (u32 i = 0; i < load->chunk_count; ++i)
+    {
+        if (load->chunks[i].failed)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+
+// Chunks at line breaks, with their parse arrays carved out of `arena`
+internal bool split_chunks(ObjLoad *load, const char *text, memory_index size, MemoryArena *arena)
+{
+    u32 chunk_count = (u32)(size / OBJ_CHUNK_SIZE) + 1;
+    chunk_count = chunk_count < OBJ_MAX_CHUNKS ? chunk_count : OBJ_MAX_CHUNKS;
+    load->chunks = push_array(arena, chunk_count, ObjChunk);
+
+    const char *end = text + size;
+    const char *at = text;
+    load->chunk_count = 0;
+    for (u32 i = 0; i < chunk_count && at < end; ++i)
+    {
+        const char *chunk_end = text + (u64)size * (i + 1) / chunk_count;
+        chunk_end = chunk_end > at ? chunk_end : at;
+        const char *line_end = chunk_end < end ? (const char *)memchr(chunk_end, '\n', end - chunk_end) : NULL;
+        chunk_end = line_end ? line_end + 1 : end;
+
+        ObjChunk *chunk = &load->chunks[load->chunk_count++];
+        memset(chunk, 0, sizeof(*chunk));
+        chunk->begin = at;
+        chunk->end = chunk_end;
+
+        u64 positions, uvs, normals, corners;
+        chunk_capacities(chunk_end - at, &positions, &uvs, &normals, &corners);
+        chunk->positions = push_array(arena, positions, Vec3);
+        chunk->uvs = push_array(arena, uvs, Vec2);
+        chunk->normals = push_array(arena, normals, Vec3);
+        chunk->corners = push_array(arena, corners, ObjCorner);
+        at = chunk_end;
+    }
+    return true;
+}
+
+
+internal bool build_mesh(ObjLoad *load, MemoryArena *scratch, MemoryArena *arena)
+{
+    jobs_parallel_for(load->chunk_count, 1, parse_chunks_job, load);
+    if (any_chunk_failed(load))
+    {
+        return false;
+    }
+
+    for (u32 i = 0; i < load->chunk_count; ++i)
+    {
+        ObjChunk *chunk = &load->chunks[i];
+        chunk->position_base = load->position_count;
+        chunk->uv_base = load->uv_count;
+        chunk->normal_base = load->normal_count;
+        chunk->corner_base = load->corner_count;
+        load->position_count += chunk->position_count;
+        load->uv_count += chunk->uv_count;
+        load->normal_count += chunk->normal_count;
+        load->corner_count += chunk->corner_count;
+    }
+
+    load->positions = push_array(scratch, load->position_count, Vec3);
+    load->uvs = push_array(scratch, load->uv_count, Vec2);
+    load->normals = push_array(scratch, load->normal_count, Vec3);
+    load->corners = push_array(scratch, load->corner_count, ObjCorner);
+    load->position_hashes = push_array(scratch, load->position_count, u32);
+    load->uv_hashes = push_array(scratch, load->uv_count, u32);
+    load->normal_hashes = push_array(scratch, load->normal_count, u32);
+    load->first_use = push_array(scratch, load->corner_count, u32);
+    load->vertex_id = push_array(scratch, load->corner_count, u32);
+
+    Vec3 zero = {};
+    load->zero_uv_hash = hash_floats(zero.e, 2);
+    load->zero_normal_hash = hash_floats(zero.e, 3);
+    jobs_parallel_for(load->chunk_count, 1, gather_chunks_job, load);
+    jobs_parallel_for(load->chunk_count, 1, resolve_chunks_job, load);
+    if (any_chunk_failed(load))
+    {
+        return false;
+    }
+
+    for (u32 p = 0; p < OBJ_PARTITIONS; ++p)
+    {
+        ObjPartition *partition = &load->partitions[p];
+        for (u32 i = 0; i < load->chunk_count; ++i)
+        {
+            load->chunks[i].partition_offsets[p] = partition->count;
+            partition->count += load->chunks[i].partition_counts[p];
+        }
+
+        u32 table_size = OBJ_MIN_TABLE;
+        while (table_size < partition->count * 2)
+        {
+            table_size *= 2;
+        }
+        partition->corners = push_array(scratch, partition->count, ObjSlot);
+        partition->unique = push_array(scratch, partition->count, ObjSlot);
+        partition->table = push_array(scratch, table_size, u32);
+    }
+    jobs_parallel_for(load->chunk_count, 1, bucket_chunks_job, load);
+    jobs_parallel_for(OBJ_PARTITIONS, 1, dedupe_partitions_job, load);
+    jobs_parallel_for(load->chunk_count, 1, count_first_uses_job, load);
+
+    u32 vertex_count = 0;
+    for (u32 i = 0; i < load->chunk_count; ++i)
+    {
+        load->chunks[i].first_base = vertex_count;
+        vertex_count += load->chunks[i].first_count;
+    }
+
+    Mesh *mesh = load->mesh;
+    mesh->vertices = push_array(arena, vertex_count, Vertex);
+    mesh->indices = push_array(arena, load->corner_count, u32);
+    if (mesh->vertices == NULL || mesh->indices == NULL)
+    {
+        return false;
+    }
+    mesh->vertex_count = vertex_count;
+    mesh->index_count = load->corner_count;
+    mesh->lod_count = 0;
+    jobs_parallel_for(load->chunk_count, 1, write_vertices_job, load);
+    jobs_parallel_for(load->chunk_count, 1, write_indices_job, load);
+    return true;
+}
+
+
+// Kept between loads: a fresh reservation would fault in every page it
+// touches again, and faulting costs as much as the parsing
+global_variable void         *obj_scratch_memory;
+global_variable memory_index  obj_scratch_size;
+
+
+bool parse_obj(const char *text, memory_index size, MemoryArena *arena, Mesh *mesh, ObjStats *stats)
+{
+    // Worst case parse arrays for every chunk, then the exact sized copies,
+    // per corner tables and hash tables of the later passes, which take less
+    // than five times as much again. Only the pages touched get backed.
+    memory_index scratch_size = chunk_memory(size) * 8
+                              + OBJ_MAX_CHUNKS * (sizeof(ObjChunk) + chunk_memory(0))
+                              + OBJ_PARTITIONS * OBJ_MIN_TABLE * sizeof(u32) + Megabytes(1);
+    if (scratch_size > obj_scratch_size)
+    {
+        release_obj_scratch();
+        obj_scratch_memory = platform_reserve_memory(scratch_size);
+        if (obj_scratch_memory == NULL)
+        {
+            return false;
+        }
+        obj_scratch_size = scratch_size;
+    }
+
+    MemoryArena scratch;
+    initialize_arena(&scratch, obj_scratch_size, obj_scratch_memory);
+
+    ObjLoad load = {};
+    load.mesh = mesh;
+    *mesh = {};
+    bool ok = split_chunks(&load, text, size, &scratch) && build_mesh(&load, &scratch, arena);
+
+    if (stats)
+    {
+        stats->positions = load.position_count;
+        stats->normals = load.normal_count;
+        stats->uvs = load.uv_count;
+        stats->triangles = load.corner_count / 3;
+        stats->chunks = load.chunk_count;
+    }
+
+    return ok;
+}
+
+
+bool load_obj(const char *path, MemoryArena *arena, Mesh *mesh, ObjStats *stats)
+{
+    memory_index size;
+    const u8 *text = platform_map_file(path, &size);
+    if (text == NULL)
+    {
+        return false;
+    }
+
+    bool ok = parse_obj((const char *)text, size, arena, mesh, stats);
+    platform_unmap_file(text, size);
+    return ok;
+}
+
+
+void release_obj_scratch()
+{
+    if (obj_scratch_memory)
+    {
+        platform_release_memory(obj_scratch_memory, obj_scratch_size);
+    }
+    obj_scratch_memory = NULL;
+    obj_scratch_size = 0;
+}
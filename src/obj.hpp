@@ -0,0 +1,45 @@
+#pragma once
+
+#include "platform.hpp"
+#include "mesh.hpp"
+
+
+// Wavefront OBJ loading straight into an indexed Mesh.
+//
+// The file is memory mapped and cut into chunks at line breaks, which the
+// job system parses in parallel with a hand written number parser. Faces
+// are triangulated as fans. Corners are then deduplicated by hashing their
+// position, normal and UV values: hash partitions are merged in parallel,
+// and vertices keep the order of their first use, so the result is the same
+// for any thread count.
+//
+// Only geometry is read (v, vt, vn, f, negative indices included); groups,
+// materials and smoothing groups are skipped and everything becomes one
+// mesh. Missing normals and UVs are zero.
+
+
+#define OBJ_CHUNK_SIZE  Megabytes(1)
+#define OBJ_MAX_CHUNKS  1024
+#define OBJ_PARTITIONS  64              // dedup hash partitions, a power of two
+
+
+struct ObjStats
+{
+    u32 positions;
+    u32 normals;
+    u32 uvs;
+    u32 triangles;
+    u32 chunks;
+};
+
+
+// Vertices and indices are pushed onto `arena`. The scratch space comes
+// from a reservation of its own that is kept for the next load, so one load
+// at a time. False if the text is malformed (an index out of range) or
+// memory runs out.
+bool parse_obj(const char *text, memory_index size, MemoryArena *arena, Mesh *mesh, ObjStats *stats = NULL);
+
+bool load_obj(const char *path, MemoryArena *arena, Mesh *mesh, ObjStats *stats = NULL);
+
+// Gives the scratch space back, after the last load.
+void release_obj_scratch();
@@ -0,0 +1,263 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "pack.hpp"
+#include "lz4.hpp"
+
+
+// Compressed entries have to save at least an eighth to be worth decoding
+#define PACK_MIN_SAVING 8
+
+
+struct PackSortEntry
+{
+    PackEntry   entry;
+    const char *name;
+    u32         input;
+};
+
+
+internal u64 align_offset(u64 offset, u64 alignment)
+{
+    return (offset + alignment - 1) & ~(alignment - 1);
+}
+
+
+u64 pack_name_hash(const char *name, memory_index length)
+{
+    u64 hash = 0xCBF29CE484222325ull;
+    for (memory_index i = 0; i < length; ++i)
+    {
+        hash = (hash ^ (u8)name[i]) * 0x100000001B3ull;
+    }
+    return hash;
+}
+
+
+internal int compare_names(const char *a, u32 a_length, const char *b, u32 b_length)
+{
+    int result = memcmp(a, b, a_length < b_length ? a_length : b_length);
+    return result ? result : (a_length > b_length) - (a_length < b_length);
+}
+
+
+internal int compare_sort_entries(const void *a, const void *b)
+{
+    const PackSortEntry *entry_a = (const PackSortEntry *)a;
+    const PackSortEntry *entry_b = (const PackSortEntry *)b;
+    if (entry_a->entry.hash != entry_b->entry.hash)
+    {
+        return entry_a->entry.hash < entry_b->entry.hash ? -1 : 1;
+    }
+    return compare_names(entry_a->name, entry_a->entry.name_length, entry_b->name, entry_b->entry.name_length);
+}
+
+
+bool write_pack(const char *path, const PackInput *inputs, u32 count, PackStats *stats)
+{
+    PackHeader header = {};
+    header.magic = PACK_MAGIC;
+    header.version = PACK_VERSION;
+    header.entry_count = count;
+    header.entries_offset = align_offset(sizeof(header), alignof(PackEntry));
+    header.names_offset = header.entries_offset + (u64)count * sizeof(PackEntry);
+
+    PackStats totals = {};
+    PackSortEntry *sorted = (PackSortEntry *)calloc(count + 1, sizeof(PackSortEntry));
+    u8 **compressed = (u8 **)calloc(count + 1, sizeof(u8 *));
+    for (u32 i = 0; i < count; ++i)
+    {
+        const PackInput *input = &inputs[i];
+        PackEntry *entry = &sorted[i].entry;
+        sorted[i].name = input->name;
+        sorted[i].input = i;
+        entry->name_length = (u32)strlen(input->name);
+        entry->name_offset = (u32)header.names_size;
+        entry->hash = pack_name_hash(input->name, entry->name_length);
+        entry->size = input->size;
+        entry->stored_size = input->size;
+        entry->compression = PACK_STORED;
+        header.names_size += entry->name_length + 1;
+
+        if (input->compress && input->size > 0)
+        {
+            u64 capacity = input->size - input->size / PACK_MIN_SAVING;
+            compressed[i] = (u8 *)malloc(lz4_compress_bound(input->size));
+            u64 compressed_size = lz4_compress(input->data, input->size, compressed[i], capacity);
+            if (compressed_size != 0)
+            {
+                entry->stored_size = compressed_size;
+                entry->compression = PACK_LZ4;
+                ++totals.compressed_count;
+            }
+        }
+        totals.input_bytes += entry->size;
+        totals.stored_bytes += entry->stored_size;
+    }
+
+    // The data goes in input order
+    u64 offset = align_offset(header.names_offset + header.names_size, PACK_ALIGNMENT);
+    totals.file_size = header.names_offset + header.names_size;
+    for (u32 i = 0; i < count; ++i)
+    {
+        sorted[i].entry.offset = offset;
+        totals.file_size = offset + sorted[i].entry.stored_size;
+        offset = align_offset(totals.file_size, PACK_ALIGNMENT);
+    }
+
+    char *names = (char *)calloc(header.names_size + 1, 1);
+    for (u32 i = 0; i < count; ++i)
+    {
+        memcpy(names + sorted[i].entry.name_offset, inputs[i].name, sorted[i].entry.name_length);
+    }
+
+    // The table by hash
+    qsort(sorted, count, sizeof(PackSortEntry), compare_sort_entries);
+    bool ok = true;
+    PackEntry *entries = (PackEntry *)calloc(count + 1, sizeof(PackEntry));
+    for (u32 i = 0; i < count; ++i)
+    {
+        entries[i] = sorted[i].entry;
+        if (i > 0 && compare_sort_entries(&sorted[i - 1], &sorted[i]) == 0)
+        {
+            fprintf(stderr, "%s is in the pack twice\n", sorted[i].name);
+            ok = false;
+        }
+    }
+
+    FILE *output = ok ? fopen(path, "wb") : NULL;
+    ok = output != NULL;
+    if (output)
+    {
+        ok = fwrite(&header, sizeof(header), 1, output) == 1
+          && fseek(output, (long)header.entries_offset, SEEK_SET) == 0
+          && fwrite(entries, sizeof(PackEntry), count, output) == count
+          && fwrite(names, 1, header.names_size, output) == header.names_size;
+        for (u32 i = 0; i < count && ok; ++i)
+        {
+            const PackEntry *entry = &sorted[i].entry;
+            u32 input = sorted[i].input;
+            const u8 *data = entry->compression == PACK_LZ4 ? compressed[input] : inputs[input].data;
+            ok = fseek(output, (long)entry->offset, SEEK_SET) == 0
+              && fwrite(data, 1, entry->stored_size, output) == entry->stored_size;
+        }
+        ok = fclose(output) == 0 && ok;
+    }
+
+    for (u32 i = 0; i < count; ++i)
+    {
+        free(compressed[i]);
+    }
+    free(entries);
+    free(names);
+    free(compressed);
+    free(sorted);
+    if (stats)
+    {
+        *stats = totals;
+    }
+    return ok;
+}
+
+
+bool open_pack(const char *path, Pack *pack)
+{
+    *pack = {};
+    pack->data = platform_map_file(path, &pack->size, false);
+    if (pack->data == NULL)
+    {
+        return false;
+    }
+
+    const PackHeader *header = (const PackHeader *)pack->data;
+    u64 size = pack->size;
+    bool valid = size >= sizeof(PackHeader)
+              && header->magic == PACK_MAGIC
+              && header->version == PACK_VERSION
+              && header->entries_offset % alignof(PackEntry) == 0
+              && header->entries_offset <= size
+              && (u64)header->entry_count * sizeof(PackEntry) <= size - header->entries_offset
+              && header->names_offset <= size
+              && header->names_size <= size - header->names_offset;
+
+    const PackEntry *entries = (const PackEntry *)(pack->data + header->entries_offset);
+    const char *names = (const char *)(pack->data + header->names_offset);
+    for (u32 i = 0; i < header->entry_count && valid; ++i)
+    {
+        const PackEntry *entry = &entries[i];
+        valid = entry->compression < PACK_COMPRESSION_COUNT
+             && entry->offset <= size && entry->stored_size <= size - entry->offset
+             && (entry->compression != PACK_STORED || entry->stored_size == entry->size)
+             && entry->name_offset <= header->names_size
+             && entry->name_length <= header->names_size - entry->name_offset
+             && entry->hash == pack_name_hash(names + entry->name_offset, entry->name_length)
+             && (i == 0 || entries[i - 1].hash <= entry->hash);
+    }
+    if (!valid)
+    {
+        close_pack(pack);
+        return false;
+    }
+
+    pack->header = header;
+    pack->entries = entries;
+    pack->names = names;
+    return true;
+}
+
+
+void close_pack(Pack *pack)
+{
+    platform_unmap_file(pack->data, pack->size);
+    *pack = {};
+}
+
+
+const PackEntry *find_pack_entry(const Pack *pack, const char *name)
+{
+    u32 length = (u32)strlen(name);
+    u64 hash = pack_name_hash(name, length);
+
+    // First entry with the hash, then the ones sharing it
+    u32 first = 0;
+    u32 last = pack->header->entry_count;
+    while (first < last)
+    {
+        u32 middle = first + (last - first) / 2;
+        if (pack->entries[middle].hash < hash)
+        {
+            first = middle + 1;
+        }
+        else
+        {
+            last = middle;
+        }
+    }
+    for (u32 i = first; i < pack->header->entry_count && pack->entries[i].hash == hash; ++i)
+    {
+        const PackEntry *entry = &pack->entries[i];
+        if (compare_names(pack->names + entry->name_offset, entry->name_length, name, length) == 0)
+        {
+            return entry;
+        }
+    }
+    return NULL;
+}
+
+
+const u8 *read_pack_entry(const Pack *pack, const PackEntry *entry, MemoryArena *arena)
+{
+    const u8 *stored = pack->data + entry->offset;
+    if (entry->compression == PACK_STORED)
+    {
+        return stored;
+    }
+
+    u8 *result = (u8 *)push_size(arena, entry->size);
+    if (result == NULL || !lz4_decompress(stored, entry->stored_size, result, entry->size))
+    {
+        return NULL;
+    }
+    return result;
+}
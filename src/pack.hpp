@@ -0,0 +1,104 @@
+#pragma once
+
+#include "platform.hpp"
+
+
+// Asset pack archive (.pack), written by pack_assets, so startup maps one
+// file instead of opening and reading thousands.
+//
+// A PackHeader, the table of contents sorted by name hash, the names, then
+// the entries' data, each at a 4 KB aligned offset. Entries are stored as
+// they are unless flagged for compression and LZ4 (see lz4.hpp) saves an
+// eighth of them: from the page cache decoding costs more than reading
+// the bytes it saves (see bench_pack.cpp), so only data that is mostly
+// read cold is worth it. Stored entries are read in place: an aligned
+// .cmesh or .ctex in a pack maps the same as its own file. Little endian
+// throughout.
+
+
+#define PACK_MAGIC     0x4B434150   // "PACK"
+#define PACK_VERSION   1
+#define PACK_ALIGNMENT 4096
+
+
+enum PackCompression
+{
+    PACK_STORED,
+    PACK_LZ4,
+    PACK_COMPRESSION_COUNT
+};
+
+
+struct PackEntry
+{
+    u64 hash;                   // pack_name_hash() of the name
+    u64 offset;                 // from the start of the file
+    u64 stored_size;
+    u64 size;                   // decompressed
+    u32 name_offset;            // into the names
+    u32 name_length;
+    u32 compression;            // PackCompression
+    u32 reserved;
+};
+
+
+struct PackHeader
+{
+    u32 magic;
+    u32 version;
+    u32 entry_count;
+    u32 reserved;
+    u64 entries_offset;
+    u64 names_offset;
+    u64 names_size;
+};
+
+
+// An open pack, the pointers point into the mapping
+struct Pack
+{
+    const u8         *data;
+    memory_index      size;
+    const PackHeader *header;
+    const PackEntry  *entries;
+    const char       *names;
+};
+
+
+// What pack_assets puts in, `compress` tries LZ4 on it
+struct PackInput
+{
+    const char   *name;
+    const u8     *data;
+    memory_index  size;
+    bool          compress;
+};
+
+
+struct PackStats
+{
+    u64 input_bytes;
+    u64 stored_bytes;           // of the entries' data, without padding
+    u64 file_size;
+    u32 compressed_count;
+};
+
+
+// FNV-1a, 64 bit
+u64 pack_name_hash(const char *name, memory_index length);
+
+// Fails for duplicate names. Entries are laid out in input order, so what
+// is used together stays together on disk.
+bool write_pack(const char *path, const PackInput *inputs, u32 count, PackStats *stats = NULL);
+
+// Checks the header and that every entry and name lies inside the file.
+bool open_pack(const char *path, Pack *pack);
+void close_pack(Pack *pack);
+
+// Binary search on the hash, then the names. NULL if there is none.
+const PackEntry *find_pack_entry(const Pack *pack, const char *name);
+
+// Stored entries come back as a view into the mapping, compressed ones
+// decompressed into `arena`, usually the frame arena. NULL when the arena
+// is out of space or the data is corrupt. The size is entry->size.
+const u8 *read_pack_entry(const Pack *pack, const PackEntry *entry, MemoryArena *arena);
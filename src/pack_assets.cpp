@@ -0,0 +1,93 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "platform.hpp"
+#include "pack.hpp"
+
+
+// Packs asset files into one .pack (see pack.hpp).
+//
+//   pack_assets output.pack [--compress EXT]... file...
+//
+// Entries are named by the paths as given and stored as they are, to be
+// used in place. Files ending in a --compress extension (e.g. --compress
+// .txt) are LZ4 compressed when that saves enough.
+
+
+#define PACK_MAX_COMPRESS_EXTENSIONS 16
+
+
+internal bool has_extension(const char *path, const char *extension)
+{
+    memory_index length = strlen(path);
+    memory_index extension_length = strlen(extension);
+    return length >= extension_length && strcmp(path + length - extension_length, extension) == 0;
+}
+
+
+int main(int argc, char *argv[])
+{
+    const char *output_path = NULL;
+    const char *compress_extensions[PACK_MAX_COMPRESS_EXTENSIONS];
+    u32 compress_count = 0;
+    PackInput *inputs = (PackInput *)calloc(argc, sizeof(PackInput));
+    u32 input_count = 0;
+
+    bool ok = true;
+    for (int i = 1; i < argc; ++i)
+    {
+        if (strcmp(argv[i], "--compress") == 0 && i + 1 < argc && compress_count < PACK_MAX_COMPRESS_EXTENSIONS)
+        {
+            compress_extensions[compress_count++] = argv[++i];
+        }
+        else if (output_path == NULL)
+        {
+            output_path = argv[i];
+        }
+        else
+        {
+            PackInput *input = &inputs[input_count++];
+            input->name = argv[i];
+            input->data = platform_map_file(argv[i], &input->size);
+            if (input->data == NULL)
+            {
+                fprintf(stderr, "Failed to read %s\n", argv[i]);
+                ok = false;
+            }
+        }
+    }
+    if (output_path == NULL || input_count == 0)
+    {
+        fprintf(stderr, "Usage: pack_assets output.pack [--compress EXT]... file...\n");
+        return 2;
+    }
+
+    for (u32 i = 0; i < input_count; ++i)
+    {
+        for (u32 j = 0; j < compress_count; ++j)
+        {
+            inputs[i].compress |= has_extension(inputs[i].name, compress_extensions[j]);
+        }
+    }
+
+    PackStats stats = {};
+    if (ok && !write_pack(output_path, inputs, input_count, &stats))
+    {
+        fprintf(stderr, "Failed to write %s\n", output_path);
+        ok = false;
+    }
+    if (ok)
+    {
+        printf("%s: %u entries, %u compressed, %llu bytes of %llu stored, %llu byte file\n", output_path,
+               input_count, stats.compressed_count, (unsigned long long)stats.stored_bytes,
+               (unsigned long long)stats.input_bytes, (unsigned long long)stats.file_size);
+    }
+
+    for (u32 i = 0; i < input_count; ++i)
+    {
+        platform_unmap_file(inputs[i].data, inputs[i].size);
+    }
+    free(inputs);
+    return ok ? 0 : 1;
+}
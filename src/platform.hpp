@@ -1,11 +1,20 @@
 #pragma once
 
 
+#include <assert.h>
+#include <stddef.h>
 #include <stdint.h>
 #include <stdbool.h>
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 
 
-#define static internal
+#define internal static
+#define local_persist static
+#define global_variable static
 
 
 typedef int8_t i8;
@@ -25,3 +34,241 @@ typedef size_t memory_index;
 
 typedef float f32;
 typedef double f64;
+
+
+#define Kilobytes(value) ((value) * 1024LL)
+#define Megabytes(value) (Kilobytes(value) * 1024LL)
+#define Gigabytes(value) (Megabytes(value) * 1024LL)
+
+
+// Memory ######################################################################
+
+
+// Reserves address space only, pages are backed on first touch.
+inline void *platform_reserve_memory(memory_index size)
+{
+    void *memory = mmap(NULL, size,
+                        PROT_READ | PROT_WRITE,
+                        MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE,
+                        -1, 0);
+    return memory == MAP_FAILED ? NULL : memory;
+}
+
+
+inline void platform_release_memory(void *memory, memory_index size)
+{
+    if (memory)
+    {
+        munmap(memory, size);
+    }
+}
+
+
+// Linear allocator over a fixed block. Not thread safe, give each thread its
+// own arena (sub_arena() carves one out of a bigger one).
+struct MemoryArena
+{
+    u8           *base;
+    memory_index  size;
+    memory_index  used;
+    memory_index  peak;
+    u64           push_count;
+    u64           pushed_bytes;
+    u32           temp_count;
+};
+
+
+struct TemporaryMemory
+{
+    MemoryArena  *arena;
+    memory_index  used;
+};
+
+
+#define ARENA_DEFAULT_ALIGNMENT 16
+
+
+inline void initialize_arena(MemoryArena *arena, memory_index size, void *base)
+{
+    arena->base = (u8 *)base;
+    arena->size = size;
+    arena->used = 0;
+    arena->peak = 0;
+    arena->push_count = 0;
+    arena->pushed_bytes = 0;
+    arena->temp_count = 0;
+}
+
+
+inline memory_index get_alignment_offset(MemoryArena *arena, memory_index alignment)
+{
+    assert(alignment && (alignment & (alignment - 1)) == 0);
+    umm result = (umm)arena->base + arena->used;
+    umm mask = alignment - 1;
+    return (result & mask) ? alignment - (result & mask) : 0;
+}
+
+
+inline memory_index get_arena_size_remaining(MemoryArena *arena,
+                                             memory_index alignment = ARENA_DEFAULT_ALIGNMENT)
+{
+    return arena->size - (arena->used + get_alignment_offset(arena, alignment));
+}
+
+
+// Returns NULL when the arena is out of space (and asserts in debug builds).
+inline void *push_size_(MemoryArena *arena,
+                        memory_index size,
+                        memory_index alignment = ARENA_DEFAULT_ALIGNMENT)
+{
+    memory_index offset = get_alignment_offset(arena, alignment);
+    if (arena->used + offset + size > arena->size)
+    {
+        assert(!"Memory arena out of space");
+        return NULL;
+    }
+
+    void *result = arena->base + arena->used + offset;
+    arena->used += offset + size;
+    arena->peak = arena->used > arena->peak ? arena->used : arena->peak;
+    ++arena->push_count;
+    arena->pushed_bytes += size;
+    return result;
+}
+
+
+#define push_struct(arena, type) \
+    ((type *)push_size_(arena, sizeof(type), alignof(type)))
+#define push_array(arena, count, type) \
+    ((type *)push_size_(arena, (count) * sizeof(type), alignof(type)))
+#define push_size(arena, size, ...) push_size_(arena, size, ##__VA_ARGS__)
+
+
+inline void *push_copy(MemoryArena *arena, const void *source, memory_index size)
+{
+    u8 *result = (u8 *)push_size_(arena, size, 1);
+    if (result)
+    {
+        for (memory_index i = 0; i < size; ++i)
+        {
+            result[i] = ((const u8 *)source)[i];
+        }
+    }
+    return result;
+}
+
+
+inline char *push_string(MemoryArena *arena, const char *source)
+{
+    memory_index length = 0;
+    while (source[length])
+    {
+        ++length;
+    }
+    return (char *)push_copy(arena, source, length + 1);
+}
+
+
+// Frees the most recent `size` bytes pushed. Alignment padding in front of
+// them stays used, prefer temporary memory for anything but the last push.
+inline void pop_size(MemoryArena *arena, memory_index size)
+{
+    assert(size <= arena->used);
+    arena->used -= size;
+}
+
+
+inline void reset_arena(MemoryArena *arena)
+{
+    assert(arena->temp_count == 0);
+    arena->used = 0;
+}
+
+
+inline void sub_arena(MemoryArena *result,
+                      MemoryArena *arena,
+                      memory_index size,
+                      memory_index alignment = ARENA_DEFAULT_ALIGNMENT)
+{
+    initialize_arena(result, size, push_size_(arena, size, alignment));
+}
+
+
+inline TemporaryMemory begin_temporary_memory(MemoryArena *arena)
+{
+    TemporaryMemory result;
+    result.arena = arena;
+    result.used = arena->used;
+    ++arena->temp_count;
+    return result;
+}
+
+
+inline void end_temporary_memory(TemporaryMemory temp)
+{
+    MemoryArena *arena = temp.arena;
+    assert(arena->used >= temp.used);
+    assert(arena->temp_count > 0);
+    arena->used = temp.used;
+    --arena->temp_count;
+}
+
+
+inline void check_arena(MemoryArena *arena)
+{
+    assert(arena->temp_count == 0);
+    (void)arena;
+}
+
+
+// Files #######################################################################
+
+
+// Maps a whole file read-only, for parsing in place. NULL on failure or for
+// empty files. Without `read_all` the kernel is not asked to read ahead,
+// for archives only parts of which get used.
+inline const u8 *platform_map_file(const char *path, memory_index *size, bool read_all = true)
+{
+    int file = open(path, O_RDONLY);
+    if (file < 0)
+    {
+        return NULL;
+    }
+
+    struct stat info;
+    void *memory = MAP_FAILED;
+    if (fstat(file, &info) == 0 && info.st_size > 0)
+    {
+        memory = mmap(NULL, (memory_index)info.st_size, PROT_READ, MAP_PRIVATE, file, 0);
+        *size = (memory_index)info.st_size;
+    }
+    close(file);
+
+    if (memory == MAP_FAILED)
+    {
+        return NULL;
+    }
+    if (read_all)
+    {
+        madvise(memory, *size, MADV_WILLNEED);
+    }
+    return (const u8 *)memory;
+}
+
+
+inline void platform_unmap_file(const u8 *memory, memory_index size)
+{
+    if (memory)
+    {
+        munmap((void *)memory, size);
+    }
+}
+
+
+// Monotonic, for budgets within a frame
+inline u64 platform_nanoseconds()
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (u64)now.tv_sec * 1000000000ull + (u64)now.tv_nsec;
+}
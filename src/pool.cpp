@@ -0,0 +1,240 @@
+#include <string.h>
+
+#include "pool.hpp"
+
+
+void init_pool(MemoryPool *pool,
+               memory_index slot_size,
+               memory_index alignment,
+               memory_index slots_per_block,
+               MemoryArena *arena)
+{
+    *pool = {};
+
+    if (alignment < alignof(PoolSlot))
+    {
+        alignment = alignof(PoolSlot);
+    }
+    if (slot_size < sizeof(PoolSlot))
+    {
+        slot_size = sizeof(PoolSlot);
+    }
+    slot_size = (slot_size + alignment - 1) & ~(alignment - 1);
+
+    pool->slot_size = slot_size;
+    pool->alignment = alignment;
+    pool->slots_per_block = slots_per_block ? slots_per_block : 1;
+    pool->arena = arena;
+}
+
+
+void release_pool(MemoryPool *pool)
+{
+    PoolBlock *block = pool->blocks;
+    while (block)
+    {
+        PoolBlock *next = block->next;
+        platform_release_memory(block, block->size);
+        block = next;
+    }
+
+    MemoryArena *arena = pool->arena;
+    init_pool(pool, pool->slot_size, pool->alignment, pool->slots_per_block, arena);
+}
+
+
+void set_pool_hook(MemoryPool *pool, PoolHook *hook, void *user)
+{
+    pool->hook = hook;
+    pool->hook_user = user;
+}
+
+
+void *pool_grow(MemoryPool *pool)
+{
+    memory_index slots_size = pool->slot_size * pool->slots_per_block;
+    u8 *slots = NULL;
+    memory_index block_size = slots_size;
+
+    if (pool->arena)
+    {
+        slots = (u8 *)push_size_(pool->arena, slots_size, pool->alignment);
+    }
+    else
+    {
+        // The block header sits in front of the slots, padded to their alignment
+        memory_index header_size = (sizeof(PoolBlock) + pool->alignment - 1)
+                                 & ~(pool->alignment - 1);
+        block_size = header_size + slots_size;
+        PoolBlock *block = (PoolBlock *)platform_reserve_memory(block_size);
+        if (block)
+        {
+            block->next = pool->blocks;
+            block->size = block_size;
+            pool->blocks = block;
+            slots = (u8 *)block + header_size;
+        }
+    }
+
+    if (slots == NULL)
+    {
+        return NULL;
+    }
+
+#if POOL_DEBUG
+    memset(slots, POOL_FRESH_BYTE, slots_size);
+#endif
+
+    pool->fresh = slots + pool->slot_size;
+    pool->fresh_end = slots + slots_size;
+    pool->stats.capacity += pool->slots_per_block;
+    ++pool->stats.blocks;
+    if (pool->hook)
+    {
+        pool->hook(pool->hook_user, POOL_EVENT_GROW, block_size);
+    }
+
+    return slots;
+}
+
+
+internal void lock_pool(MemoryPool *pool)
+{
+    while (__atomic_exchange_n(&pool->lock, 1, __ATOMIC_ACQUIRE))
+    {
+        while (__atomic_load_n(&pool->lock, __ATOMIC_RELAXED))
+        {
+#if defined(__x86_64__) || defined(__i386__)
+            __builtin_ia32_pause();
+#endif
+        }
+    }
+}
+
+
+internal void unlock_pool(MemoryPool *pool)
+{
+    __atomic_store_n(&pool->lock, 0, __ATOMIC_RELEASE);
+}
+
+
+void *pool_alloc_shared(MemoryPool *pool)
+{
+    lock_pool(pool);
+    void *result = pool_alloc(pool);
+    unlock_pool(pool);
+    return result;
+}
+
+
+void pool_free_shared(MemoryPool *pool, void *slot)
+{
+    lock_pool(pool);
+    pool_free(pool, slot);
+    unlock_pool(pool);
+}
+
+
+// Takes half a cache worth of slots in one lock, returns one of them and
+// keeps the rest.
+void *pool_cache_refill(PoolCache *cache)
+{
+    MemoryPool *pool = cache->pool;
+    PoolSlot *taken[POOL_CACHE_SIZE / 2];
+    u32 count = 0;
+
+    lock_pool(pool);
+    while (count < POOL_CACHE_SIZE / 2)
+    {
+        void *slot = pool_take(pool);
+        if (slot == NULL)
+        {
+            break;
+        }
+        taken[count++] = (PoolSlot *)slot;
+    }
+    pool_count_alloc(pool, count);
+    unlock_pool(pool);
+
+    if (count == 0)
+    {
+        return NULL;
+    }
+
+    for (u32 i = 1; i < count; ++i)
+    {
+#if POOL_DEBUG
+        pool_debug_poison(pool, taken[i], POOL_FREED_BYTE);
+#endif
+        taken[i]->next = cache->slots;
+        cache->slots = taken[i];
+        ++cache->count;
+    }
+
+#if POOL_DEBUG
+    pool_debug_poison(pool, taken[0], POOL_FRESH_BYTE);
+#endif
+    return taken[0];
+}
+
+
+void pool_cache_trim(PoolCache *cache, u32 keep)
+{
+    if (cache->count <= keep)
+    {
+        return;
+    }
+
+    MemoryPool *pool = cache->pool;
+    u32 count = 0;
+
+    lock_pool(pool);
+    while (cache->count > keep)
+    {
+        PoolSlot *slot = cache->slots;
+        cache->slots = slot->next;
+        --cache->count;
+        pool_give(pool, slot);
+        ++count;
+    }
+    pool_count_free(pool, count);
+    unlock_pool(pool);
+}
+
+
+void pool_debug_poison(MemoryPool *pool, void *slot, u8 value)
+{
+    memset(slot, value, pool->slot_size);
+}
+
+
+// The first bytes of a freed slot hold the free list link, the rest must
+// still be poison.
+void pool_debug_check_freed(MemoryPool *pool, void *slot)
+{
+    u8 *bytes = (u8 *)slot;
+    for (memory_index i = sizeof(PoolSlot); i < pool->slot_size; ++i)
+    {
+        assert(bytes[i] == POOL_FREED_BYTE && "Pool slot written after free");
+    }
+    (void)bytes;
+}
+
+
+void pool_debug_check_double_free(MemoryPool *pool, void *slot)
+{
+    if (pool->slot_size <= sizeof(PoolSlot))
+    {
+        return;
+    }
+
+    u8 *bytes = (u8 *)slot;
+    for (memory_index i = sizeof(PoolSlot); i < pool->slot_size; ++i)
+    {
+        if (bytes[i] != POOL_FREED_BYTE)
+        {
+            return;
+        }
+    }
+    assert(!"Pool slot freed twice");
+}
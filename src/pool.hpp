@@ -0,0 +1,276 @@
+#pragma once
+
+#include "platform.hpp"
+
+
+// Fixed-size slot allocator with an intrusive free list. Freed slots hold
+// the next pointer in their first bytes, fresh slots are bumped out of the
+// newest block, and blocks come from an arena or, without one, from their
+// own reservation. Alloc and free are O(1) and never touch malloc.
+//
+// A MemoryPool is single threaded. For pools shared between threads, each
+// thread allocates through its own PoolCache, which moves slots to and from
+// the pool in batches under the pool's lock.
+//
+// With POOL_DEBUG (the default without NDEBUG) freed slots are filled with
+// POOL_FREED_BYTE and checked on reuse, which catches most writes after
+// free and double frees. Fresh slots are filled with POOL_FRESH_BYTE.
+
+
+#ifndef POOL_DEBUG
+#ifndef NDEBUG
+#define POOL_DEBUG 1
+#else
+#define POOL_DEBUG 0
+#endif
+#endif
+
+#define POOL_FRESH_BYTE 0xCD
+#define POOL_FREED_BYTE 0xDD
+#define POOL_CACHE_SIZE 64
+
+
+enum PoolEvent
+{
+    POOL_EVENT_ALLOC,
+    POOL_EVENT_FREE,
+    POOL_EVENT_GROW,
+};
+
+
+// Called for every alloc and free (bytes is the slot size) and for every
+// new block (bytes is the block size). Slots sitting in a PoolCache count
+// as allocated.
+typedef void PoolHook(void *user, PoolEvent event, memory_index bytes);
+
+
+struct PoolStats
+{
+    u64          allocs;
+    u64          frees;
+    memory_index live;
+    memory_index peak;
+    memory_index capacity;
+    memory_index blocks;
+};
+
+
+struct PoolSlot
+{
+    PoolSlot *next;
+};
+
+
+struct PoolBlock
+{
+    PoolBlock    *next;
+    memory_index  size;
+};
+
+
+struct MemoryPool
+{
+    PoolSlot     *free_list;
+    u8           *fresh;
+    u8           *fresh_end;
+
+    memory_index  slot_size;
+    memory_index  alignment;
+    memory_index  slots_per_block;
+    MemoryArena  *arena;
+    PoolBlock    *blocks;
+
+    PoolStats     stats;
+    PoolHook     *hook;
+    void         *hook_user;
+
+    u32           lock;
+};
+
+
+struct PoolCache
+{
+    MemoryPool *pool;
+    PoolSlot   *slots;
+    u32         count;
+};
+
+
+// Blocks are pushed onto `arena` when given, otherwise reserved separately
+// and released by release_pool().
+void init_pool(MemoryPool *pool,
+               memory_index slot_size,
+               memory_index alignment,
+               memory_index slots_per_block,
+               MemoryArena *arena = NULL);
+
+void release_pool(MemoryPool *pool);
+
+void set_pool_hook(MemoryPool *pool, PoolHook *hook, void *user);
+
+// Slow paths, called by the inline functions below.
+void *pool_grow(MemoryPool *pool);
+void *pool_cache_refill(PoolCache *cache);
+void pool_cache_trim(PoolCache *cache, u32 keep);
+void pool_debug_poison(MemoryPool *pool, void *slot, u8 value);
+void pool_debug_check_freed(MemoryPool *pool, void *slot);
+void pool_debug_check_double_free(MemoryPool *pool, void *slot);
+
+// Locked variants for occasional use from several threads.
+void *pool_alloc_shared(MemoryPool *pool);
+void pool_free_shared(MemoryPool *pool, void *slot);
+
+
+#define init_pool_for(pool, type, slots_per_block, ...) \
+    init_pool(pool, sizeof(type), alignof(type), slots_per_block, ##__VA_ARGS__)
+#define pool_alloc_struct(pool, type) ((type *)pool_alloc(pool))
+#define pool_cache_alloc_struct(cache, type) ((type *)pool_cache_alloc(cache))
+
+
+inline void pool_count_alloc(MemoryPool *pool, memory_index count)
+{
+    pool->stats.allocs += count;
+    pool->stats.live += count;
+    if (pool->stats.live > pool->stats.peak)
+    {
+        pool->stats.peak = pool->stats.live;
+    }
+    if (pool->hook)
+    {
+        for (memory_index i = 0; i < count; ++i)
+        {
+            pool->hook(pool->hook_user, POOL_EVENT_ALLOC, pool->slot_size);
+        }
+    }
+}
+
+
+inline void pool_count_free(MemoryPool *pool, memory_index count)
+{
+    pool->stats.frees += count;
+    pool->stats.live -= count;
+    if (pool->hook)
+    {
+        for (memory_index i = 0; i < count; ++i)
+        {
+            pool->hook(pool->hook_user, POOL_EVENT_FREE, pool->slot_size);
+        }
+    }
+}
+
+
+// Takes a slot without touching the stats.
+inline void *pool_take(MemoryPool *pool)
+{
+    PoolSlot *slot = pool->free_list;
+    if (slot)
+    {
+        pool->free_list = slot->next;
+#if POOL_DEBUG
+        pool_debug_check_freed(pool, slot);
+#endif
+        return slot;
+    }
+
+    if (pool->fresh < pool->fresh_end)
+    {
+        void *result = pool->fresh;
+        pool->fresh += pool->slot_size;
+        return result;
+    }
+
+    return pool_grow(pool);
+}
+
+
+// Returns a slot without touching the stats.
+inline void pool_give(MemoryPool *pool, void *memory)
+{
+#if POOL_DEBUG
+    pool_debug_poison(pool, memory, POOL_FREED_BYTE);
+#endif
+    PoolSlot *slot = (PoolSlot *)memory;
+    slot->next = pool->free_list;
+    pool->free_list = slot;
+}
+
+
+// Returns NULL when the backing arena is out of space.
+inline void *pool_alloc(MemoryPool *pool)
+{
+    void *result = pool_take(pool);
+    if (result)
+    {
+#if POOL_DEBUG
+        pool_debug_poison(pool, result, POOL_FRESH_BYTE);
+#endif
+        pool_count_alloc(pool, 1);
+    }
+    return result;
+}
+
+
+inline void pool_free(MemoryPool *pool, void *memory)
+{
+    if (memory)
+    {
+#if POOL_DEBUG
+        pool_debug_check_double_free(pool, memory);
+#endif
+        pool_give(pool, memory);
+        pool_count_free(pool, 1);
+    }
+}
+
+
+inline void init_pool_cache(PoolCache *cache, MemoryPool *pool)
+{
+    cache->pool = pool;
+    cache->slots = NULL;
+    cache->count = 0;
+}
+
+
+inline void *pool_cache_alloc(PoolCache *cache)
+{
+    PoolSlot *slot = cache->slots;
+    if (slot)
+    {
+        cache->slots = slot->next;
+        --cache->count;
+#if POOL_DEBUG
+        pool_debug_check_freed(cache->pool, slot);
+        pool_debug_poison(cache->pool, slot, POOL_FRESH_BYTE);
+#endif
+        return slot;
+    }
+    return pool_cache_refill(cache);
+}
+
+
+inline void pool_cache_free(PoolCache *cache, void *memory)
+{
+    if (memory == NULL)
+    {
+        return;
+    }
+
+#if POOL_DEBUG
+    pool_debug_check_double_free(cache->pool, memory);
+    pool_debug_poison(cache->pool, memory, POOL_FREED_BYTE);
+#endif
+    PoolSlot *slot = (PoolSlot *)memory;
+    slot->next = cache->slots;
+    cache->slots = slot;
+    if (++cache->count > POOL_CACHE_SIZE)
+    {
+        pool_cache_trim(cache, POOL_CACHE_SIZE / 2);
+    }
+}
+
+
+// Hands every cached slot back, call before the owning thread exits.
+inline void pool_cache_flush(PoolCache *cache)
+{
+    pool_cache_trim(cache, 0);
+}
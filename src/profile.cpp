@@ -0,0 +1,437 @@
+#ifdef PROFILER
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+
+#include <atomic>
+
+#include <glad/glad.h>
+#include <glad/glad_profile.h>
+
+#include "profile.hpp"
+#include "memory_tracking.hpp"
+
+
+#define PROFILE_MAX_THREADS 64
+#define PROFILE_MAX_EVENTS  (64 * 1024)
+#define PROFILE_GPU_QUERIES 256
+#define PROFILE_NO_QUERY    0xFFFFFFFF
+
+
+struct ProfileEvent
+{
+    const char *name;
+    u64         start;
+    u64         end;
+    u32         frame;
+};
+
+
+// Written only by its thread, the count is published after each event so
+// a dump from another thread sees complete events. init_profile() pushes
+// them all, a thread takes the next one the first time it records and
+// keeps it for the whole run.
+struct ProfileThread
+{
+    std::atomic<u32>  count;
+    std::atomic<u64>  dropped;
+    u32               tid;
+    const char       *name;
+    ProfileEvent      events[PROFILE_MAX_EVENTS];
+};
+
+
+struct ProfileGPUQuery
+{
+    const char *name;
+    u32         frame;
+};
+
+
+struct Profile
+{
+    std::atomic<ProfileThread *> threads[PROFILE_MAX_THREADS];
+    std::atomic<u32>             thread_count;
+    ProfileThread               *reserved;
+    u32                          reserved_count;
+    std::atomic<u32>             frame;
+    u64                          origin;
+
+    // GL thread only
+    ProfileThread   *gpu;
+    bool             gpu_checked;
+    bool             gpu_available;
+    i64              gpu_offset;
+    GLuint           gpu_queries[PROFILE_GPU_QUERIES * 2];
+    ProfileGPUQuery  gpu_pending[PROFILE_GPU_QUERIES];
+    u32              gpu_head;
+    u32              gpu_tail;
+
+    const char      *gl_scope_names[GLAD_PROFILE_MAX_SCOPES];
+    u32              gl_scope_count;
+};
+
+
+bool profile_recording = false;
+global_variable Profile profile_state = {};
+global_variable thread_local ProfileThread *thread_profile = NULL;
+
+
+internal u64 profile_now()
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (u64)now.tv_sec * 1000000000ull + (u64)now.tv_nsec;
+}
+
+
+internal ProfileThread *register_profile_thread(u32 tid)
+{
+    u32 index = profile_state.thread_count.load(std::memory_order_relaxed);
+    do
+    {
+        if (index >= profile_state.reserved_count)
+        {
+            return NULL;
+        }
+    } while (!profile_state.thread_count.compare_exchange_weak(index, index + 1));
+
+    ProfileThread *thread = &profile_state.reserved[index];
+    thread->count.store(0, std::memory_order_relaxed);
+    thread->dropped.store(0, std::memory_order_relaxed);
+    thread->tid = tid;
+    thread->name = NULL;
+    profile_state.threads[index].store(thread, std::memory_order_release);
+    return thread;
+}
+
+
+internal ProfileThread *get_profile_thread()
+{
+    if (thread_profile == NULL)
+    {
+        thread_profile = register_profile_thread((u32)syscall(SYS_gettid));
+    }
+    return thread_profile;
+}
+
+
+internal void push_event(ProfileThread *thread, const char *name, u64 start, u64 end, u32 frame)
+{
+    u32 count = thread->count.load(std::memory_order_relaxed);
+    if (count >= PROFILE_MAX_EVENTS)
+    {
+        thread->dropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    ProfileEvent *event = &thread->events[count];
+    event->name = name;
+    event->start = start;
+    event->end = end;
+    event->frame = frame;
+    thread->count.store(count + 1, std::memory_order_release);
+}
+
+
+void profile_begin(ProfileScope *scope)
+{
+    scope->frame = profile_state.frame.load(std::memory_order_relaxed);
+    scope->start = profile_now();
+}
+
+
+void profile_end(ProfileScope *scope)
+{
+    u64 end = profile_now();
+    ProfileThread *thread = get_profile_thread();
+    if (thread && __atomic_load_n(&profile_recording, __ATOMIC_RELAXED))
+    {
+        push_event(thread, scope->name, scope->start, end, scope->frame);
+    }
+}
+
+
+internal u32 intern_gl_scope(const char *name)
+{
+    for (u32 i = 1; i < profile_state.gl_scope_count; ++i)
+    {
+        if (profile_state.gl_scope_names[i] == name
+            || strcmp(profile_state.gl_scope_names[i], name) == 0)
+        {
+            return i;
+        }
+    }
+
+    if (profile_state.gl_scope_count == 0)
+    {
+        profile_state.gl_scope_names[0] = "(no scope)";
+        profile_state.gl_scope_count = 1;
+    }
+    if (profile_state.gl_scope_count >= GLAD_PROFILE_MAX_SCOPES)
+    {
+        return 0;
+    }
+
+    profile_state.gl_scope_names[profile_state.gl_scope_count] = name;
+    return profile_state.gl_scope_count++;
+}
+
+
+internal bool check_gpu_timer()
+{
+    if (profile_state.gpu_checked)
+    {
+        return profile_state.gpu_available;
+    }
+    profile_state.gpu_checked = true;
+
+    if (!GLAD_GL_VERSION_3_3 || glQueryCounter == NULL)
+    {
+        return false;
+    }
+
+    glGenQueries(PROFILE_GPU_QUERIES * 2, profile_state.gpu_queries);
+
+    // GPU timestamps are moved onto the CPU clock with a single offset,
+    // good enough to line up scopes within a capture.
+    GLint64 gpu_now = 0;
+    glGetInteger64v(GL_TIMESTAMP, &gpu_now);
+    profile_state.gpu_offset = (i64)gpu_now - (i64)profile_now();
+
+    profile_state.gpu = register_profile_thread(0);
+    if (profile_state.gpu)
+    {
+        profile_state.gpu->name = "GPU";
+    }
+    profile_state.gpu_available = profile_state.gpu != NULL;
+    return profile_state.gpu_available;
+}
+
+
+void profile_gpu_begin(ProfileGPUScope *scope)
+{
+    bool recording = scope->cpu.start != 0;
+    if (!recording && !gladProfileEnabled())
+    {
+        return;
+    }
+
+    scope->active = true;
+    scope->previous_gl_scope = gladProfileScope;
+    gladProfileScope = intern_gl_scope(scope->cpu.name);
+
+    scope->query = PROFILE_NO_QUERY;
+    if (recording
+        && check_gpu_timer()
+        && profile_state.gpu_head - profile_state.gpu_tail < PROFILE_GPU_QUERIES)
+    {
+        u32 query = profile_state.gpu_head++ % PROFILE_GPU_QUERIES;
+        profile_state.gpu_pending[query].name = scope->cpu.name;
+        profile_state.gpu_pending[query].frame = scope->cpu.frame;
+        glQueryCounter(profile_state.gpu_queries[query * 2], GL_TIMESTAMP);
+        scope->query = query;
+    }
+}
+
+
+void profile_gpu_end(ProfileGPUScope *scope)
+{
+    if (scope->query != PROFILE_NO_QUERY)
+    {
+        glQueryCounter(profile_state.gpu_queries[scope->query * 2 + 1], GL_TIMESTAMP);
+    }
+    gladProfileScope = scope->previous_gl_scope;
+}
+
+
+// Reads back finished timestamp pairs in submission order. With `wait` set
+// the remaining queries are waited on, otherwise this never stalls.
+void resolve_gpu_queries(bool wait)
+{
+    while (profile_state.gpu_tail != profile_state.gpu_head)
+    {
+        u32 query = profile_state.gpu_tail % PROFILE_GPU_QUERIES;
+        GLuint begin_query = profile_state.gpu_queries[query * 2];
+        GLuint end_query = profile_state.gpu_queries[query * 2 + 1];
+
+        if (!wait)
+        {
+            GLuint available = 0;
+            glGetQueryObjectuiv(end_query, GL_QUERY_RESULT_AVAILABLE, &available);
+            if (!available)
+            {
+                break;
+            }
+        }
+
+        GLuint64 begin = 0;
+        GLuint64 end = 0;
+        glGetQueryObjectui64v(begin_query, GL_QUERY_RESULT, &begin);
+        glGetQueryObjectui64v(end_query, GL_QUERY_RESULT, &end);
+
+        ProfileGPUQuery *pending = &profile_state.gpu_pending[query];
+        push_event(profile_state.gpu,
+                   pending->name,
+                   (u64)((i64)begin - profile_state.gpu_offset),
+                   (u64)((i64)end - profile_state.gpu_offset),
+                   pending->frame);
+        ++profile_state.gpu_tail;
+    }
+}
+
+
+bool init_profile(MemoryArena *arena, u32 thread_count)
+{
+    thread_count = thread_count < PROFILE_MAX_THREADS ? thread_count : PROFILE_MAX_THREADS;
+    profile_state.reserved = push_array(arena, thread_count, ProfileThread);
+    profile_state.reserved_count = profile_state.reserved ? thread_count : 0;
+    return profile_state.reserved != NULL;
+}
+
+
+void profile_begin_capture()
+{
+    if (profile_state.origin == 0)
+    {
+        profile_state.origin = profile_now();
+    }
+    __atomic_store_n(&profile_recording, true, __ATOMIC_RELAXED);
+}
+
+
+void profile_end_capture()
+{
+    __atomic_store_n(&profile_recording, false, __ATOMIC_RELAXED);
+}
+
+
+void profile_set_thread_name(const char *name)
+{
+    ProfileThread *thread = get_profile_thread();
+    if (thread)
+    {
+        thread->name = name;
+    }
+}
+
+
+void profile_end_frame()
+{
+    profile_state.frame.fetch_add(1, std::memory_order_relaxed);
+    if (profile_state.gpu_available)
+    {
+        resolve_gpu_queries(false);
+    }
+}
+
+
+f64 trace_us(u64 time)
+{
+    return (f64)((i64)time - (i64)profile_state.origin) / 1000.0;
+}
+
+
+bool profile_dump(const char *path)
+{
+    if (profile_state.gpu_available)
+    {
+        resolve_gpu_queries(true);
+    }
+
+    FILE *file = fopen(path, "w");
+    if (file == NULL)
+    {
+        return false;
+    }
+
+    int pid = (int)getpid();
+    bool first = true;
+    fprintf(file, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+
+    u32 thread_count = profile_state.thread_count.load(std::memory_order_acquire);
+    for (u32 i = 0; i < thread_count && i < PROFILE_MAX_THREADS; ++i)
+    {
+        ProfileThread *thread = profile_state.threads[i].load(std::memory_order_acquire);
+        if (thread == NULL)
+        {
+            continue;
+        }
+
+        if (thread->name)
+        {
+            fprintf(file,
+                    "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":%d,\"tid\":%u,"
+                    "\"args\":{\"name\":\"%s\"}}",
+                    first ? "" : ",\n", pid, thread->tid, thread->name);
+            first = false;
+        }
+
+        u32 count = thread->count.load(std::memory_order_acquire);
+        for (u32 e = 0; e < count; ++e)
+        {
+            ProfileEvent *event = &thread->events[e];
+            fprintf(file,
+                    "%s{\"name\":\"%s\",\"ph\":\"X\",\"pid\":%d,\"tid\":%u,"
+                    "\"ts\":%.3f,\"dur\":%.3f,\"args\":{\"frame\":%u}}",
+                    first ? "" : ",\n",
+                    event->name, pid, thread->tid,
+                    trace_us(event->start),
+                    (f64)(event->end - event->start) / 1000.0,
+                    event->frame);
+            first = false;
+        }
+
+        u64 dropped = thread->dropped.load(std::memory_order_relaxed);
+        if (dropped)
+        {
+            fprintf(file,
+                    "%s{\"name\":\"dropped %llu events\",\"ph\":\"i\",\"s\":\"t\","
+                    "\"pid\":%d,\"tid\":%u,\"ts\":0}",
+                    first ? "" : ",\n", (unsigned long long)dropped, pid, thread->tid);
+            first = false;
+        }
+    }
+
+    fprintf(file, "\n]}\n");
+    return fclose(file) == 0;
+}
+
+
+const char *profile_gl_scope_name(u32 index)
+{
+    if (index >= profile_state.gl_scope_count)
+    {
+        return NULL;
+    }
+    return profile_state.gl_scope_names[index];
+}
+
+
+void shutdown_profile()
+{
+    profile_end_capture();
+    if (profile_state.gpu_available)
+    {
+        glDeleteQueries(PROFILE_GPU_QUERIES * 2, profile_state.gpu_queries);
+        profile_state.gpu_available = false;
+        profile_state.gpu_head = profile_state.gpu_tail = 0;
+    }
+
+    // The buffers go with the arena
+    for (u32 i = 0; i < PROFILE_MAX_THREADS; ++i)
+    {
+        profile_state.threads[i].store(NULL, std::memory_order_relaxed);
+    }
+    profile_state.thread_count.store(0, std::memory_order_relaxed);
+    profile_state.reserved = NULL;
+    profile_state.reserved_count = 0;
+    profile_state.gpu = NULL;
+    profile_state.gpu_checked = false;
+    thread_profile = NULL;
+}
+
+#endif
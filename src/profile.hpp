@@ -0,0 +1,138 @@
+#pragma once
+
+#include "platform.hpp"
+
+
+// Scope profiler writing Chrome trace JSON (chrome://tracing, ui.perfetto.dev).
+//
+// Built with PROFILER defined, PROFILE_SCOPE(name) records a complete event
+// on the calling thread's buffer while a capture is running. Outside a
+// capture a scope costs one relaxed load and a branch. PROFILE_GPU_SCOPE
+// additionally brackets the GL commands with timestamp queries, resolved a
+// few frames later in profile_end_frame(), and attributes GL calls to the
+// scope for the glad profiling interposer. Names must be string literals.
+
+
+#define PROFILE_CONCAT_(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_(a, b)
+
+
+#ifdef PROFILER
+
+extern bool profile_recording;
+
+
+struct ProfileScope
+{
+    const char *name;
+    u64         start;
+    u32         frame;
+
+    ProfileScope(const char *scope_name);
+    ~ProfileScope();
+};
+
+
+struct ProfileGPUScope
+{
+    ProfileScope cpu;
+    u32          query;
+    u32          previous_gl_scope;
+    bool         active;
+
+    ProfileGPUScope(const char *scope_name);
+    ~ProfileGPUScope();
+};
+
+
+void profile_begin(ProfileScope *scope);
+void profile_end(ProfileScope *scope);
+void profile_gpu_begin(ProfileGPUScope *scope);
+void profile_gpu_end(ProfileGPUScope *scope);
+
+
+inline ProfileScope::ProfileScope(const char *scope_name)
+{
+    name = scope_name;
+    start = 0;
+    if (__atomic_load_n(&profile_recording, __ATOMIC_RELAXED))
+    {
+        profile_begin(this);
+    }
+}
+
+
+inline ProfileScope::~ProfileScope()
+{
+    if (start)
+    {
+        profile_end(this);
+    }
+}
+
+
+inline ProfileGPUScope::ProfileGPUScope(const char *scope_name)
+    : cpu(scope_name)
+{
+    active = false;
+    profile_gpu_begin(this);
+}
+
+
+inline ProfileGPUScope::~ProfileGPUScope()
+{
+    if (active)
+    {
+        profile_gpu_end(this);
+    }
+}
+
+
+#define PROFILE_SCOPE(name) \
+    ProfileScope PROFILE_CONCAT(profile_scope_, __LINE__)(name)
+#define PROFILE_GPU_SCOPE(name) \
+    ProfileGPUScope PROFILE_CONCAT(profile_gpu_scope_, __LINE__)(name)
+
+
+// Pushes event buffers for `thread_count` threads (the GPU timeline counts
+// as one) onto `arena`, 2 MB each. Threads record nothing before, and
+// threads past the count nothing at all.
+bool init_profile(MemoryArena *arena, u32 thread_count);
+
+// Starts recording into the per-thread buffers, events from earlier
+// captures are kept.
+void profile_begin_capture();
+void profile_end_capture();
+
+// Names the calling thread in the trace.
+void profile_set_thread_name(const char *name);
+
+// Advances the frame index and resolves finished GPU queries. Call on the
+// GL thread after swapping.
+void profile_end_frame();
+
+// Writes everything recorded so far as Chrome trace JSON.
+bool profile_dump(const char *path);
+
+// Name of a glad profiling scope index (see gladProfileScope).
+const char *profile_gl_scope_name(u32 index);
+
+// Releases the GL queries and forgets the buffers, call while the context
+// is still current and before the arena goes.
+void shutdown_profile();
+
+#else
+
+#define PROFILE_SCOPE(name)
+#define PROFILE_GPU_SCOPE(name)
+
+inline bool init_profile(MemoryArena *, u32) { return true; }
+inline void profile_begin_capture() {}
+inline void profile_end_capture() {}
+inline void profile_set_thread_name(const char *) {}
+inline void profile_end_frame() {}
+inline bool profile_dump(const char *) { return false; }
+inline const char *profile_gl_scope_name(u32) { return 0; }
+inline void shutdown_profile() {}
+
+#endif
@@ -0,0 +1,167 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <SDL2/SDL.h>
+#include <glad/glad.h>
+#include <glad/glad_trace.h>
+
+#include "platform.hpp"
+
+
+struct Replay
+{
+    SDL_Window    *window;
+    SDL_GLContext  context;
+    const char    *trace_path;
+    int            loops;
+};
+
+
+bool init_replay(Replay *replay)
+{
+    if (SDL_Init(SDL_INIT_VIDEO) < 0)
+    {
+        fprintf(stderr, "Failed to initialize SDL video\n");
+        return false;
+    }
+
+    SDL_GL_SetAttribute(SDL_GL_CONTEXT_MAJOR_VERSION, 3);
+    SDL_GL_SetAttribute(SDL_GL_CONTEXT_MINOR_VERSION, 3);
+    SDL_GL_SetAttribute(
+        SDL_GL_CONTEXT_PROFILE_MASK,
+        SDL_GL_CONTEXT_PROFILE_CORE
+    );
+
+    replay->window = SDL_CreateWindow(
+        "GL Replay",
+        SDL_WINDOWPOS_CENTERED,
+        SDL_WINDOWPOS_CENTERED,
+        640, 480,
+        SDL_WINDOW_OPENGL | SDL_WINDOW_HIDDEN);
+    if (replay->window == NULL)
+    {
+        fprintf(stderr, "Failed to create replay window\n");
+        SDL_Quit();
+        return false;
+    }
+
+    replay->context = SDL_GL_CreateContext(replay->window);
+    if (replay->context == NULL)
+    {
+        fprintf(stderr, "Failed to create GL context\n");
+        SDL_DestroyWindow(replay->window);
+        SDL_Quit();
+        return false;
+    }
+
+    SDL_GL_SetSwapInterval(0);
+
+    if (!gladLoadGL())
+    {
+        fprintf(stderr, "Unable to initialize glad\n");
+        SDL_GL_DeleteContext(replay->context);
+        SDL_DestroyWindow(replay->window);
+        SDL_Quit();
+        return false;
+    }
+
+    return true;
+}
+
+
+void cleanup_replay(Replay *replay)
+{
+    SDL_GL_DeleteContext(replay->context);
+    SDL_DestroyWindow(replay->window);
+    SDL_Quit();
+}
+
+
+f64 elapsed_ms(u64 start, u64 end)
+{
+    return (f64)(end - start) * 1000.0 / (f64)SDL_GetPerformanceFrequency();
+}
+
+
+int main(int argc, char *argv[])
+{
+    Replay replay = {};
+    replay.loops = 1;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        if (strcmp(argv[i], "--loops") == 0 && i + 1 < argc)
+        {
+            replay.loops = atoi(argv[++i]);
+        }
+        else
+        {
+            replay.trace_path = argv[i];
+        }
+    }
+
+    if (replay.trace_path == NULL || replay.loops < 1)
+    {
+        fprintf(stderr, "usage: %s <trace> [--loops N]\n", argv[0]);
+        return 1;
+    }
+
+    if (!init_replay(&replay))
+    {
+        return 1;
+    }
+
+    gladTraceReplay *trace = gladTraceReplayOpen(replay.trace_path);
+    if (trace == NULL)
+    {
+        fprintf(stderr, "Failed to open trace %s\n", replay.trace_path);
+        cleanup_replay(&replay);
+        return 1;
+    }
+
+    // The first segment is setup and is not timed.
+    gladTraceReplayFrame(trace);
+    glFinish();
+
+    u32 frames = 0;
+    f64 total_ms = 0.0;
+    f64 min_ms = 1e30;
+    f64 max_ms = 0.0;
+    for (int loop = 0; loop < replay.loops; ++loop)
+    {
+        gladTraceReplayRewind(trace);
+        for (;;)
+        {
+            u64 start = SDL_GetPerformanceCounter();
+            bool more = gladTraceReplayFrame(trace) != 0;
+            glFinish();
+            u64 end = SDL_GetPerformanceCounter();
+            if (!more)
+            {
+                break;
+            }
+
+            f64 frame_ms = elapsed_ms(start, end);
+            total_ms += frame_ms;
+            min_ms = frame_ms < min_ms ? frame_ms : min_ms;
+            max_ms = frame_ms > max_ms ? frame_ms : max_ms;
+            ++frames;
+        }
+    }
+
+    gladTraceReplayStats stats = gladTraceReplayGetStats(trace);
+    printf("frames:  %u\n", frames);
+    printf("calls:   %llu (%llu skipped)\n", stats.calls, stats.skipped);
+    if (frames > 0)
+    {
+        printf("total:   %.3f ms\n", total_ms);
+        printf("frame:   %.3f ms mean, %.3f ms min, %.3f ms max\n",
+               total_ms / frames, min_ms, max_ms);
+    }
+
+    gladTraceReplayClose(trace);
+    cleanup_replay(&replay);
+
+    return 0;
+}
@@ -0,0 +1,706 @@
+#include <string.h>
+
+#include <glad/glad.h>
+
+#include "stream.hpp"
+#include "image.hpp"
+#include "cooked_mesh.hpp"
+#include "gl_vertex.hpp"
+#include "file_io.hpp"
+#include "log.hpp"
+#include "memory_tracking.hpp"
+#include "profile.hpp"
+
+
+enum StreamKind
+{
+    STREAM_TEXTURE,
+    STREAM_MESH,
+};
+
+
+// Mesh files: the size first, then the whole file
+enum StreamRead
+{
+    STREAM_SIZING,
+    STREAM_SIZED,               // waiting for room in the arena or file_io
+    STREAM_READING,
+    STREAM_READ,
+    STREAM_READ_FAILED,
+};
+
+
+struct StreamAsset
+{
+    u32        kind;            // StreamKind
+    u32        state;           // StreamState
+    char       path[STREAM_MAX_PATH];
+    Vec3       center;
+    f32        radius;
+    f32        priority;
+    u32        texture_flags;
+
+    GLuint     texture;
+
+    u32        read;            // StreamRead
+    u8        *file;
+    u64        file_size;
+    CookedMesh mesh;
+    u64        uploaded;        // vertex bytes, then index bytes
+    GLenum     index_type;
+    MeshLod    lods[MESH_MAX_LODS];
+    u32        lod_count;
+    Vec3       bounds_min;
+    Vec3       bounds_max;
+    u32        vertex_format;   // VertexFormat
+    VertexDequantization dequantization;
+    GLuint     vao;
+    GLuint     vbo;
+    GLuint     ebo;
+};
+
+
+struct Streaming
+{
+    bool        initialized;
+    u64         upload_budget;
+    f64         upload_ms;
+
+    StreamAsset assets[STREAM_MAX_ASSETS];
+    u32         asset_count;
+
+    // Binary max-heap on priority, rebuilt every update as the view moves
+    u32         queue[STREAM_MAX_ASSETS];
+    u32         queue_count;
+
+    u32         loading[STREAM_MAX_IN_FLIGHT];
+    u32         loading_count;
+
+    // Mesh files being read or uploaded, emptied whenever none are
+    MemoryArena files;
+    u32         file_count;
+
+    GLuint      placeholder_texture;
+    GLuint      placeholder_vao;
+    GLuint      placeholder_vbo;
+    GLuint      placeholder_ebo;
+
+    StreamStats stats;
+};
+
+
+global_variable Streaming streaming;
+
+
+// Float vertices with a normal and the whole texture on each face, so it
+// draws through the same shader as the mesh it stands in for
+internal void create_placeholder_cube(Streaming *stream)
+{
+    Vertex vertices[24];
+    u16 indices[36];
+    for (u32 face = 0; face < 6; ++face)
+    {
+        // Axes a, b, c with b x c = a, counter-clockwise seen from outside
+        u32 a = face / 2;
+        u32 b = (a + 1) % 3;
+        u32 c = (a + 2) % 3;
+        f32 side = face % 2 ? 1.0f : -1.0f;
+        for (u32 corner = 0; corner < 4; ++corner)
+        {
+            f32 u = corner == 1 || corner == 2 ? 1.0f : -1.0f;
+            f32 v = corner >= 2 ? 1.0f : -1.0f;
+            Vertex *vertex = &vertices[face * 4 + corner];
+            vertex->position.e[a] = side;
+            vertex->position.e[b] = u;
+            vertex->position.e[c] = v;
+            vertex->normal = vec3(0.0f, 0.0f, 0.0f);
+            vertex->normal.e[a] = side;
+            vertex->uv = vec2(0.5f + 0.5f * u, 0.5f + 0.5f * v);
+        }
+
+        local_persist const u16 outward[2][6] = {{0, 2, 1, 0, 3, 2}, {0, 1, 2, 0, 2, 3}};
+        for (u32 i = 0; i < 6; ++i)
+        {
+            indices[face * 6 + i] = (u16)(face * 4 + outward[face % 2][i]);
+        }
+    }
+
+    glGenVertexArrays(1, &stream->placeholder_vao);
+    glGenBuffers(1, &stream->placeholder_vbo);
+    glGenBuffers(1, &stream->placeholder_ebo);
+    glBindVertexArray(stream->placeholder_vao);
+    glBindBuffer(GL_ARRAY_BUFFER, stream->placeholder_vbo);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, stream->placeholder_ebo);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(indices), indices, GL_STATIC_DRAW);
+    bind_vertex_format(VERTEX_FORMAT_FLOAT);
+    glBindVertexArray(0);
+}
+
+
+bool init_streaming(u64 upload_budget, f64 upload_ms)
+{
+    MEMORY_TAG_SCOPE(MEMORY_TAG_DRIVER);
+    Streaming *stream = &streaming;
+    stream->upload_budget = upload_budget;
+    stream->upload_ms = upload_ms;
+
+    void *files = platform_reserve_memory(STREAM_FILE_ARENA);
+    if (!files)
+    {
+        log_error("Failed to reserve %llu MB for streamed files\n",
+                  (unsigned long long)(STREAM_FILE_ARENA / Megabytes(1)));
+        return false;
+    }
+    initialize_arena(&stream->files, STREAM_FILE_ARENA, files);
+    track_arena(&stream->files, MEMORY_TAG_ASSETS, "stream files");
+    bool registered = io_register_buffer(files, STREAM_FILE_ARENA);
+
+    local_persist const u8 white[4] = {255, 255, 255, 255};
+    glGenTextures(1, &stream->placeholder_texture);
+    glBindTexture(GL_TEXTURE_2D, stream->placeholder_texture);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, 1, 1, 0, GL_RGBA, GL_UNSIGNED_BYTE, white);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, 0);
+    glBindTexture(GL_TEXTURE_2D, 0);
+
+    create_placeholder_cube(stream);
+
+    stream->initialized = true;
+    log_info("Streaming: %u in flight, %.1f MB and %.2f ms of uploads per frame, files read into %s\n",
+             STREAM_MAX_IN_FLIGHT, (f64)upload_budget / Megabytes(1), upload_ms,
+             registered ? "registered buffers" : "plain memory (RLIMIT_MEMLOCK)");
+    return true;
+}
+
+
+void shutdown_streaming()
+{
+    Streaming *stream = &streaming;
+    if (!stream->initialized)
+    {
+        return;
+    }
+
+    while (io_pending())
+    {
+        io_complete(true);
+    }
+    for (u32 i = 0; i < stream->asset_count; ++i)
+    {
+        StreamAsset *asset = &stream->assets[i];
+        asset->file = NULL;
+        glDeleteTextures(1, &asset->texture);
+        glDeleteVertexArrays(1, &asset->vao);
+        glDeleteBuffers(1, &asset->vbo);
+        glDeleteBuffers(1, &asset->ebo);
+    }
+    stream->asset_count = 0;
+    stream->queue_count = 0;
+    stream->loading_count = 0;
+    io_unregister_buffer();
+    platform_release_memory(stream->files.base, stream->files.size);
+    stream->files = {};
+    stream->file_count = 0;
+
+    glDeleteTextures(1, &stream->placeholder_texture);
+    glDeleteVertexArrays(1, &stream->placeholder_vao);
+    glDeleteBuffers(1, &stream->placeholder_vbo);
+    glDeleteBuffers(1, &stream->placeholder_ebo);
+    stream->initialized = false;
+}
+
+
+internal StreamHandle request_asset(StreamKind kind, const char *path, Vec3 center, f32 radius)
+{
+    Streaming *stream = &streaming;
+    if (stream->asset_count == STREAM_MAX_ASSETS || strlen(path) >= STREAM_MAX_PATH)
+    {
+        return 0;
+    }
+
+    u32 index = stream->asset_count++;
+    StreamAsset *asset = &stream->assets[index];
+    asset->kind = kind;
+    asset->state = STREAM_QUEUED;
+    strcpy(asset->path, path);
+    asset->center = center;
+    asset->radius = radius;
+
+    // Heap order is restored in the next update
+    stream->queue[stream->queue_count++] = index;
+    ++stream->stats.queued;
+    return index + 1;
+}
+
+
+StreamHandle stream_texture(const char *path, Vec3 center, f32 radius, u32 flags)
+{
+    StreamHandle handle = request_asset(STREAM_TEXTURE, path, center, radius);
+    if (handle)
+    {
+        streaming.assets[handle - 1].texture_flags = flags;
+    }
+    return handle;
+}
+
+
+StreamHandle stream_mesh(const char *path, Vec3 center, f32 radius)
+{
+    return request_asset(STREAM_MESH, path, center, radius);
+}
+
+
+void set_stream_bounds(StreamHandle handle, Vec3 center, f32 radius)
+{
+    StreamAsset *asset = &streaming.assets[handle - 1];
+    asset->center = center;
+    asset->radius = radius;
+}
+
+
+StreamState stream_state(StreamHandle handle)
+{
+    return (StreamState)streaming.assets[handle - 1].state;
+}
+
+
+u32 streamed_texture(StreamHandle handle)
+{
+    StreamAsset *asset = &streaming.assets[handle - 1];
+    return asset->texture ? asset->texture : streaming.placeholder_texture;
+}
+
+
+StreamMesh streamed_placeholder_mesh()
+{
+    StreamMesh result;
+    result.vao = streaming.placeholder_vao;
+    result.index_type = GL_UNSIGNED_SHORT;
+    result.lods[0] = {0, 36, 0.0f};
+    result.lod_count = 1;
+    result.bounds_min = vec3(-1.0f, -1.0f, -1.0f);
+    result.bounds_max = vec3(1.0f, 1.0f, 1.0f);
+    result.vertex_format = VERTEX_FORMAT_FLOAT;
+    result.dequantization = vertex_dequantization(NULL, 0, VERTEX_FORMAT_FLOAT);
+    result.placeholder = true;
+    return result;
+}
+
+
+StreamMesh streamed_mesh(StreamHandle handle)
+{
+    StreamAsset *asset = &streaming.assets[handle - 1];
+    if (asset->state != STREAM_RESIDENT)
+    {
+        return streamed_placeholder_mesh();
+    }
+
+    StreamMesh result;
+    result.vao = asset->vao;
+    result.index_type = asset->index_type;
+    memcpy(result.lods, asset->lods, sizeof(result.lods));
+    result.lod_count = asset->lod_count;
+    result.bounds_min = asset->bounds_min;
+    result.bounds_max = asset->bounds_max;
+    result.vertex_format = (VertexFormat)asset->vertex_format;
+    result.dequantization = asset->dequantization;
+    result.placeholder = false;
+    return result;
+}
+
+
+const StreamStats *stream_stats()
+{
+    return &streaming.stats;
+}
+
+
+// PRIORITY ###################################################################
+
+
+// Projected radius in pixels. Inside the sphere it is as large as it gets.
+internal f32 stream_priority(const StreamView *view, const StreamAsset *asset)
+{
+    f32 distance = length(asset->center - view->eye);
+    return asset->radius * view->projection_scale / (distance > asset->radius ? distance : asset->radius);
+}
+
+
+internal void sift_down(Streaming *stream, u32 at)
+{
+    u32 *queue = stream->queue;
+    for (;;)
+    {
+        u32 largest = at;
+        u32 left = 2 * at + 1;
+        u32 right = left + 1;
+        if (left < stream->queue_count
+            && stream->assets[queue[left]].priority > stream->assets[queue[largest]].priority)
+        {
+            largest = left;
+        }
+        if (right < stream->queue_count
+            && stream->assets[queue[right]].priority > stream->assets[queue[largest]].priority)
+        {
+            largest = right;
+        }
+        if (largest == at)
+        {
+            return;
+        }
+
+        u32 swap = queue[at];
+        queue[at] = queue[largest];
+        queue[largest] = swap;
+        at = largest;
+    }
+}
+
+
+internal u32 pop_queue(Streaming *stream)
+{
+    u32 index = stream->queue[0];
+    stream->queue[0] = stream->queue[--stream->queue_count];
+    sift_down(stream, 0);
+    return index;
+}
+
+
+internal void prioritize(Streaming *stream, const StreamView *view)
+{
+    PROFILE_SCOPE("stream_prioritize");
+    for (u32 i = 0; i < stream->queue_count; ++i)
+    {
+        StreamAsset *asset = &stream->assets[stream->queue[i]];
+        asset->priority = stream_priority(view, asset);
+    }
+    for (u32 i = stream->queue_count / 2; i-- > 0;)
+    {
+        sift_down(stream, i);
+    }
+
+    // Few enough for insertion sort, the uploads go in this order
+    for (u32 i = 0; i < stream->loading_count; ++i)
+    {
+        StreamAsset *asset = &stream->assets[stream->loading[i]];
+        asset->priority = stream_priority(view, asset);
+    }
+    for (u32 i = 1; i < stream->loading_count; ++i)
+    {
+        u32 index = stream->loading[i];
+        u32 j = i;
+        for (; j > 0 && stream->assets[stream->loading[j - 1]].priority < stream->assets[index].priority; --j)
+        {
+            stream->loading[j] = stream->loading[j - 1];
+        }
+        stream->loading[j] = index;
+    }
+}
+
+
+// LOAD #######################################################################
+
+
+// The arena is a stack of files that only ever empties as a whole, so a
+// file waiting for room gets it once the ones ahead are uploaded
+internal void release_mesh_file(Streaming *stream, StreamAsset *asset)
+{
+    if (asset->file)
+    {
+        asset->file = NULL;
+        if (--stream->file_count == 0)
+        {
+            reset_arena(&stream->files);
+        }
+    }
+}
+
+
+internal void mesh_read(void *user, u8 *buffer, i64 result)
+{
+    StreamAsset *asset = (StreamAsset *)user;
+    if (result != (i64)asset->file_size || !view_cooked_mesh(buffer, asset->file_size, &asset->mesh))
+    {
+        release_mesh_file(&streaming, asset);
+        asset->read = STREAM_READ_FAILED;
+        return;
+    }
+    asset->read = STREAM_READ;
+}
+
+
+internal void queue_mesh_read(Streaming *stream, StreamAsset *asset)
+{
+    if (asset->file == NULL)
+    {
+        if (get_arena_size_remaining(&stream->files, STREAM_FILE_ALIGN) < asset->file_size)
+        {
+            return;
+        }
+        asset->file = (u8 *)push_size(&stream->files, asset->file_size, STREAM_FILE_ALIGN);
+        ++stream->file_count;
+    }
+    if (io_read_file(asset->path, asset->file, asset->file_size, mesh_read, asset))
+    {
+        asset->read = STREAM_READING;
+    }
+}
+
+
+internal void mesh_sized(void *user, u8 *buffer, i64 result)
+{
+    (void)buffer;
+
+    StreamAsset *asset = (StreamAsset *)user;
+    if (result > (i64)STREAM_FILE_ARENA)
+    {
+        log_error("Mesh %s is larger than the %llu MB streaming arena\n", asset->path,
+                  (unsigned long long)(STREAM_FILE_ARENA / Megabytes(1)));
+    }
+    if (result <= 0 || result > (i64)STREAM_FILE_ARENA)
+    {
+        asset->read = STREAM_READ_FAILED;
+        return;
+    }
+    asset->file_size = (u64)result;
+    asset->read = STREAM_SIZED;
+    queue_mesh_read(&streaming, asset);
+}
+
+
+// False when the texture loader or file_io is full, the request waits
+internal bool start_load(Streaming *stream, StreamAsset *asset)
+{
+    if (asset->kind == STREAM_TEXTURE)
+    {
+        asset->texture = load_texture(asset->path, asset->texture_flags);
+        if (asset->texture == 0)
+        {
+            return false;
+        }
+    }
+    else
+    {
+        if (!io_stat(asset->path, mesh_sized, asset))
+        {
+            return false;
+        }
+        asset->read = STREAM_SIZING;
+    }
+
+    asset->state = STREAM_LOADING;
+    --stream->stats.queued;
+    ++stream->stats.loading;
+    return true;
+}
+
+
+internal void start_loads(Streaming *stream)
+{
+    while (stream->queue_count > 0 && stream->loading_count < STREAM_MAX_IN_FLIGHT)
+    {
+        u32 index = stream->queue[0];
+        if (!start_load(stream, &stream->assets[index]))
+        {
+            return;
+        }
+        pop_queue(stream);
+        stream->loading[stream->loading_count++] = index;
+    }
+}
+
+
+// UPLOAD #####################################################################
+
+
+// Vertex data first, then the indices, as much as the budget allows. True
+// once the mesh is complete and its vertex array set up.
+internal bool upload_mesh_strips(Streaming *stream, StreamAsset *asset, UploadBudget *budget)
+{
+    const CookedMeshHeader *header = asset->mesh.header;
+    if (asset->vbo == 0)
+    {
+        if (upload_deadline_passed(budget))
+        {
+            return false;
+        }
+
+        // Through the copy target, the element binding belongs to a VAO
+        glGenBuffers(1, &asset->vbo);
+        glGenBuffers(1, &asset->ebo);
+        glBindBuffer(GL_COPY_WRITE_BUFFER, asset->vbo);
+        glBufferData(GL_COPY_WRITE_BUFFER, header->vertex_bytes, NULL, GL_STATIC_DRAW);
+        glBindBuffer(GL_COPY_WRITE_BUFFER, asset->ebo);
+        glBufferData(GL_COPY_WRITE_BUFFER, header->index_bytes, NULL, GL_STATIC_DRAW);
+    }
+
+    u64 total = header->vertex_bytes + header->index_bytes;
+    while (asset->uploaded < total)
+    {
+        u64 budget_left = budget->used < budget->bytes ? budget->bytes - budget->used : 0;
+        if (budget_left == 0 || upload_deadline_passed(budget))
+        {
+            return false;
+        }
+
+        bool vertices = asset->uploaded < header->vertex_bytes;
+        u64 offset = vertices ? asset->uploaded : asset->uploaded - header->vertex_bytes;
+        u64 left = (vertices ? header->vertex_bytes : header->index_bytes) - offset;
+        u64 bytes = budget_left < STREAM_MESH_STRIP ? budget_left : STREAM_MESH_STRIP;
+        bytes = bytes < left ? bytes : left;
+
+        const u8 *source = (const u8 *)(vertices ? asset->mesh.vertices : asset->mesh.indices);
+        glBindBuffer(GL_COPY_WRITE_BUFFER, vertices ? asset->vbo : asset->ebo);
+        glBufferSubData(GL_COPY_WRITE_BUFFER, offset, bytes, source + offset);
+        asset->uploaded += bytes;
+        budget->used += bytes;
+    }
+    glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+
+    glGenVertexArrays(1, &asset->vao);
+    glBindVertexArray(asset->vao);
+    glBindBuffer(GL_ARRAY_BUFFER, asset->vbo);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, asset->ebo);
+    bind_cooked_attributes(header);
+    glBindVertexArray(0);
+
+    const CookedSubmesh *submesh = &asset->mesh.submeshes[0];
+    asset->lod_count = submesh->lod_count < MESH_MAX_LODS ? submesh->lod_count : MESH_MAX_LODS;
+    for (u32 i = 0; i < asset->lod_count; ++i)
+    {
+        asset->lods[i] = {submesh->lods[i].first_index, submesh->lods[i].index_count, submesh->lods[i].error};
+    }
+    asset->index_type = header->index_size == 2 ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT;
+    asset->bounds_min = vec3(header->bounds_min[0], header->bounds_min[1], header->bounds_min[2]);
+    asset->bounds_max = vec3(header->bounds_max[0], header->bounds_max[1], header->bounds_max[2]);
+    asset->vertex_format = header->vertex_format;
+    asset->dequantization.position_offset = vec3(header->position_offset[0], header->position_offset[1],
+                                                 header->position_offset[2]);
+    asset->dequantization.position_scale = vec3(header->position_scale[0], header->position_scale[1],
+                                                header->position_scale[2]);
+    asset->dequantization.uv_offset = vec2(header->uv_offset[0], header->uv_offset[1]);
+    asset->dequantization.uv_scale = vec2(header->uv_scale[0], header->uv_scale[1]);
+    asset->mesh = {};
+    release_mesh_file(stream, asset);
+    return true;
+}
+
+
+// True once the asset is resident or has failed
+internal bool update_asset(Streaming *stream, StreamAsset *asset, UploadBudget *budget)
+{
+    if (asset->kind == STREAM_TEXTURE)
+    {
+        if (texture_loading(asset->texture))
+        {
+            return false;
+        }
+        asset->state = STREAM_RESIDENT;
+        return true;
+    }
+
+    if (asset->read == STREAM_SIZED)
+    {
+        queue_mesh_read(stream, asset);
+    }
+    if (asset->read != STREAM_READ && asset->read != STREAM_READ_FAILED)
+    {
+        return false;
+    }
+    if (asset->read == STREAM_READ_FAILED)
+    {
+        log_error("Failed to load mesh %s\n", asset->path);
+        asset->state = STREAM_FAILED;
+        return true;
+    }
+
+    u64 used = budget->used;
+    bool done = upload_mesh_strips(stream, asset, budget);
+    stream->stats.frame_bytes += budget->used - used;
+    if (done)
+    {
+        asset->state = STREAM_RESIDENT;
+    }
+    return done;
+}
+
+
+internal void upload_assets(Streaming *stream)
+{
+    PROFILE_GPU_SCOPE("stream_uploads");
+    MEMORY_TAG_SCOPE(MEMORY_TAG_DRIVER);
+
+    u64 start = platform_nanoseconds();
+    UploadBudget budget = {stream->upload_budget, 0, start + (u64)(stream->upload_ms * 1000000.0)};
+    stream->stats.frame_bytes = 0;
+
+    // The texture loader uploads its textures in request order, it gets the
+    // budget where its most important one comes
+    bool textures_updated = false;
+    u32 kept = 0;
+    for (u32 i = 0; i < stream->loading_count; ++i)
+    {
+        u32 index = stream->loading[i];
+        StreamAsset *asset = &stream->assets[index];
+        if (asset->kind == STREAM_TEXTURE && !textures_updated)
+        {
+            u64 used = budget.used;
+            update_texture_uploads(&budget);
+            stream->stats.frame_bytes += budget.used - used;
+            textures_updated = true;
+        }
+
+        if (update_asset(stream, asset, &budget))
+        {
+            --stream->stats.loading;
+            if (asset->state == STREAM_RESIDENT)
+            {
+                ++stream->stats.resident;
+            }
+            else
+            {
+                ++stream->stats.failed;
+            }
+        }
+        else
+        {
+            stream->loading[kept++] = index;
+        }
+    }
+    stream->loading_count = kept;
+
+    // Textures loaded outside streaming
+    if (!textures_updated)
+    {
+        u64 used = budget.used;
+        update_texture_uploads(&budget);
+        stream->stats.frame_bytes += budget.used - used;
+    }
+
+    StreamStats *stats = &stream->stats;
+    stats->frame_ms = (f64)(platform_nanoseconds() - start) / 1000000.0;
+    stats->total_bytes += stats->frame_bytes;
+    stats->peak_frame_bytes = stats->frame_bytes > stats->peak_frame_bytes ? stats->frame_bytes : stats->peak_frame_bytes;
+    stats->peak_frame_ms = stats->frame_ms > stats->peak_frame_ms ? stats->frame_ms : stats->peak_frame_ms;
+    if (stats->frame_ms > stream->upload_ms)
+    {
+        ++stats->over_budget_frames;
+    }
+}
+
+
+void update_streaming(const StreamView *view)
+{
+    Streaming *stream = &streaming;
+    prioritize(stream, view);
+    start_loads(stream);
+    io_complete();
+    upload_assets(stream);
+
+    // Room for the next ones as soon as this frame's are done, all their
+    // reads go out in one submit
+    start_loads(stream);
+    io_submit();
+}
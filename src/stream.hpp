@@ -0,0 +1,146 @@
+#pragma once
+
+#include "platform.hpp"
+#include "math.hpp"
+#include "texture.hpp"
+#include "mesh.hpp"
+#include "vertex_format.hpp"
+
+
+// Prioritized asset streaming.
+//
+// stream_texture() and stream_mesh() only queue a request, the handle's
+// placeholder can be drawn straight away. Once a frame, on the GL thread,
+// update_streaming():
+//
+//   1. prioritizes the queue by how large each asset's bounding sphere is
+//      on screen, which falls off with distance, and heapifies it
+//   2. starts the most important requests while fewer than
+//      STREAM_MAX_IN_FLIGHT are loading. Textures are read and decoded as
+//      background jobs (see jobs.hpp), meshes read in one batch a frame
+//      through file_io.hpp, which needs init_io() first.
+//   3. uploads what is ready, most important first, until the frame's byte
+//      or time budget is spent. Meshes go up STREAM_MESH_STRIP bytes at a
+//      time, textures in the texture loader's strips.
+//
+// Both budgets are checked before every strip, so the upload stage runs
+// over its time by at most one strip, however much is waiting. Textures
+// show a 1x1 white texel and meshes a unit cube (scale it to the bounds)
+// until they are resident, failed loads keep them. The texture loader
+// reports its failures itself, such textures count as resident here.
+//
+// Streamed meshes are cooked .cmesh files. Parsing an OBJ takes every core
+// and a scratch meant for one load at a time, that stays a startup thing.
+// They come with the LOD ranges of their first submesh, see mesh_lod.hpp
+// for picking one.
+//
+// Mesh files are read whole into an arena of STREAM_FILE_ARENA bytes,
+// registered with io_register_buffer(), and their strips uploaded from
+// there. Uploading straight from a mapping, as map_cooked_mesh() allows,
+// saves that one copy, but every page not yet in the page cache then
+// faults inside glBufferSubData(), on the GL thread and outside the time
+// budget; a read finishes in the background before the first strip goes
+// up. The mesh/stream benchmarks measure both. Files larger than the
+// arena fail.
+
+
+#define STREAM_MAX_ASSETS    4096
+#define STREAM_MAX_IN_FLIGHT 8                // reading, decoding or uploading
+#define STREAM_MAX_PATH      256
+#define STREAM_UPLOAD_BUDGET Megabytes(4)     // per frame
+#define STREAM_UPLOAD_MS     2.0              // per frame
+#define STREAM_MESH_STRIP    Kilobytes(256)   // most per glBufferSubData
+#define STREAM_FILE_ARENA    Megabytes(64)    // mesh files read, not uploaded yet
+#define STREAM_FILE_ALIGN    4096
+
+
+// 0 is none
+typedef u32 StreamHandle;
+
+
+enum StreamState
+{
+    STREAM_QUEUED,
+    STREAM_LOADING,
+    STREAM_RESIDENT,
+    STREAM_FAILED,
+};
+
+
+// Where the camera is, `projection_scale` turns a size at distance 1 into
+// pixels: viewport height / (2 tan(fov_y / 2)).
+struct StreamView
+{
+    Vec3 eye;
+    f32  projection_scale;
+};
+
+
+inline StreamView stream_view(Vec3 eye, f32 fov_y, f32 viewport_height)
+{
+    StreamView view;
+    view.eye = eye;
+    view.projection_scale = viewport_height / (2.0f * tanf(fov_y * 0.5f));
+    return view;
+}
+
+
+// What to draw for a mesh this frame
+struct StreamMesh
+{
+    u32                  vao;
+    u32                  index_type;    // GL_UNSIGNED_SHORT or GL_UNSIGNED_INT
+    MeshLod              lods[MESH_MAX_LODS];
+    u32                  lod_count;     // one for the placeholder
+    Vec3                 bounds_min;    // object space, -1 to 1 for the placeholder
+    Vec3                 bounds_max;
+    VertexFormat         vertex_format; // float for the placeholder
+    VertexDequantization dequantization;
+    bool                 placeholder;
+};
+
+
+struct StreamStats
+{
+    u32 queued;
+    u32 loading;
+    u32 resident;
+    u32 failed;
+    u64 frame_bytes;            // uploaded in the last update
+    f64 frame_ms;               // the last update's upload stage
+    u64 peak_frame_bytes;
+    f64 peak_frame_ms;
+    u32 over_budget_frames;     // upload stage longer than the time budget
+    u64 total_bytes;
+};
+
+
+// Needs a current GL context, the texture loader and init_io(). The
+// budgets also cover textures loaded outside streaming.
+bool init_streaming(u64 upload_budget = STREAM_UPLOAD_BUDGET, f64 upload_ms = STREAM_UPLOAD_MS);
+
+// Waits for running reads and deletes every streamed texture and mesh.
+void shutdown_streaming();
+
+// 0 when STREAM_MAX_ASSETS are requested already or the path is too long.
+// Requests last until shutdown_streaming().
+StreamHandle stream_texture(const char *path, Vec3 center, f32 radius,
+                            u32 flags = TEXTURE_SRGB | TEXTURE_MIPMAPS | TEXTURE_FLIP_Y);
+StreamHandle stream_mesh(const char *path, Vec3 center, f32 radius);
+
+// For assets that move, takes effect in the next update.
+void set_stream_bounds(StreamHandle handle, Vec3 center, f32 radius);
+
+// Once a frame on the GL thread, see the top.
+void update_streaming(const StreamView *view);
+
+StreamState stream_state(StreamHandle handle);
+
+// The texture name to bind this frame, the placeholder until it is up.
+u32 streamed_texture(StreamHandle handle);
+StreamMesh streamed_mesh(StreamHandle handle);
+// The cube streamed_mesh() returns until the mesh is up, with UVs over each
+// face, for drawing a texture on its own.
+StreamMesh streamed_placeholder_mesh();
+
+const StreamStats *stream_stats();
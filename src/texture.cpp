@@ -0,0 +1,642 @@
+#include <stdlib.h>
+#include <string.h>
+#include <atomic>
+
+#include <glad/glad.h>
+
+#include "texture.hpp"
+#include "image.hpp"
+#include "cooked_texture.hpp"
+#include "block_compression.hpp"
+#include "jobs.hpp"
+#include "log.hpp"
+#include "memory_tracking.hpp"
+#include "profile.hpp"
+
+
+enum TextureLoadState
+{
+    TEXTURE_LOAD_FREE,
+    TEXTURE_LOAD_DECODING,      // owned by a worker
+    TEXTURE_LOAD_DECODED,
+    TEXTURE_LOAD_FAILED,
+    TEXTURE_LOAD_UPLOADING,     // levels allocated, the ones before `level` are up
+};
+
+
+struct TextureLevel
+{
+    const u8 *data;
+    u32       width;
+    u32       height;
+    u32       rows;             // pixel rows, block rows when compressed
+    u64       row_bytes;
+    u64       size;
+};
+
+
+struct TextureLoad
+{
+    std::atomic<u32> state;
+    char             path[TEXTURE_MAX_PATH];
+    GLuint           texture;
+    u32              flags;
+
+    // Filled by the worker
+    u8              *memory;    // decoded pixels or the cooked file
+    GLenum           internal_format;
+    bool             compressed;
+    bool             flip_rows;
+    bool             generate_mipmaps;
+    TextureLevel     levels[COOKED_TEXTURE_MAX_LEVELS];
+    u32              level_count;
+
+    u32              level;     // being uploaded
+    u32              rows_uploaded;
+};
+
+
+struct TextureUploadFence
+{
+    GLsync fence;
+    u64    ring_end;            // ring_head when the fence went in
+};
+
+
+struct TextureLoader
+{
+    bool               initialized;
+    GLuint             ring;
+    u8                *ring_memory; // persistent mapping, NULL without buffer storage
+    u64                ring_head;   // bytes ever reserved, position is head % size
+    u64                ring_tail;   // the GPU may still read from here up to head
+    u64                budget;
+
+    // Cooked BC1/BC3 textures are decompressed on the workers without these
+    bool               has_s3tc;
+    bool               has_s3tc_srgb;
+
+    TextureUploadFence fences[TEXTURE_RING_FENCES];
+    u32                fence_first;
+    u32                fence_count;
+
+    TextureLoad        loads[TEXTURE_MAX_LOADS];
+    u32                active[TEXTURE_MAX_LOADS];   // load indices, oldest request first
+    u32                active_count;
+    JobCounter         decodes;
+
+    TextureUploadStats stats;
+};
+
+
+global_variable TextureLoader texture_loader;
+
+
+bool init_texture_loader(u64 upload_budget)
+{
+    TextureLoader *loader = &texture_loader;
+    loader->budget = upload_budget;
+    loader->has_s3tc = GLAD_GL_EXT_texture_compression_s3tc;
+    loader->has_s3tc_srgb = GLAD_GL_EXT_texture_compression_s3tc && GLAD_GL_EXT_texture_sRGB;
+
+    glGenBuffers(1, &loader->ring);
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, loader->ring);
+    if (GLAD_GL_ARB_buffer_storage)
+    {
+        GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+        glBufferStorage(GL_PIXEL_UNPACK_BUFFER, TEXTURE_RING_SIZE, NULL, flags);
+        loader->ring_memory = (u8 *)glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, TEXTURE_RING_SIZE, flags);
+    }
+    else
+    {
+        glBufferData(GL_PIXEL_UNPACK_BUFFER, TEXTURE_RING_SIZE, NULL, GL_STREAM_DRAW);
+    }
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+
+    if (GLAD_GL_ARB_buffer_storage && loader->ring_memory == NULL)
+    {
+        log_error("Failed to map the texture upload ring\n");
+        glDeleteBuffers(1, &loader->ring);
+        return false;
+    }
+
+    loader->initialized = true;
+    log_info("Texture uploads: %lld MB ring (%s), %.1f MB per frame\n",
+             (long long)(TEXTURE_RING_SIZE / Megabytes(1)),
+             loader->ring_memory ? "persistent" : "mapped per strip",
+             (f64)upload_budget / Megabytes(1));
+    return true;
+}
+
+
+void shutdown_texture_loader()
+{
+    TextureLoader *loader = &texture_loader;
+    if (!loader->initialized)
+    {
+        return;
+    }
+
+    jobs_wait(&loader->decodes);
+    for (u32 i = 0; i < loader->active_count; ++i)
+    {
+        TextureLoad *load = &loader->loads[loader->active[i]];
+        free(load->memory);
+        load->memory = NULL;
+        load->state.store(TEXTURE_LOAD_FREE, std::memory_order_relaxed);
+    }
+    loader->active_count = 0;
+
+    for (u32 i = 0; i < loader->fence_count; ++i)
+    {
+        glDeleteSync(loader->fences[(loader->fence_first + i) % TEXTURE_RING_FENCES].fence);
+    }
+    loader->fence_count = 0;
+
+    if (loader->ring_memory)
+    {
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, loader->ring);
+        glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+        loader->ring_memory = NULL;
+    }
+    glDeleteBuffers(1, &loader->ring);
+    loader->initialized = false;
+}
+
+
+// DECODE #####################################################################
+
+
+internal void set_uncompressed_level(TextureLoad *load, u32 index, const u8 *data, u32 width, u32 height)
+{
+    TextureLevel *level = &load->levels[index];
+    level->data = data;
+    level->width = width;
+    level->height = height;
+    level->rows = height;
+    level->row_bytes = (u64)width * 4;
+    level->size = level->row_bytes * height;
+}
+
+
+internal bool prepare_decoded_texture(TextureLoad *load, const u8 *data, memory_index size)
+{
+    Image image;
+    if (!decode_image(data, size, &image))
+    {
+        return false;
+    }
+
+    load->memory = image.pixels;
+    load->internal_format = (load->flags & TEXTURE_SRGB) ? GL_SRGB8_ALPHA8 : GL_RGBA8;
+    load->compressed = false;
+    load->flip_rows = load->flags & TEXTURE_FLIP_Y;
+    load->generate_mipmaps = load->flags & TEXTURE_MIPMAPS;
+    load->level_count = 1;
+    set_uncompressed_level(load, 0, image.pixels, image.width, image.height);
+    return true;
+}
+
+
+// Takes ownership of the file. Block compressed levels go up as they are
+// unless the GL lacks S3TC, then they are decompressed here.
+internal bool prepare_cooked_texture(TextureLoader *loader, TextureLoad *load, u8 *file)
+{
+    const CookedTextureHeader *header = (const CookedTextureHeader *)file;
+    bool srgb = header->flags & COOKED_TEXTURE_SRGB;
+    BlockFormat block_format = BLOCK_BC1;
+    switch (header->format)
+    {
+        case COOKED_TEXTURE_BC1:
+            load->internal_format = srgb ? GL_COMPRESSED_SRGB_S3TC_DXT1_EXT : GL_COMPRESSED_RGB_S3TC_DXT1_EXT;
+            block_format = BLOCK_BC1;
+            break;
+        case COOKED_TEXTURE_BC3:
+            load->internal_format = srgb ? GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT5_EXT : GL_COMPRESSED_RGBA_S3TC_DXT5_EXT;
+            block_format = BLOCK_BC3;
+            break;
+        case COOKED_TEXTURE_BC5:
+            // RGTC is core since GL 3.0
+            load->internal_format = GL_COMPRESSED_RG_RGTC2;
+            block_format = BLOCK_BC5;
+            break;
+        default:
+            load->internal_format = srgb ? GL_SRGB8_ALPHA8 : GL_RGBA8;
+            break;
+    }
+
+    load->compressed = header->format != COOKED_TEXTURE_RGBA8;
+    load->flip_rows = false;
+    load->generate_mipmaps = false;
+    load->level_count = header->level_count;
+
+    bool supported = header->format == COOKED_TEXTURE_BC5 || (srgb ? loader->has_s3tc_srgb : loader->has_s3tc);
+    if (load->compressed && !supported)
+    {
+        u64 total = 0;
+        for (u32 i = 0; i < header->level_count; ++i)
+        {
+            total += (u64)header->levels[i].width * header->levels[i].height * 4;
+        }
+
+        u8 *pixels = (u8 *)malloc(total);
+        if (pixels == NULL)
+        {
+            free(file);
+            return false;
+        }
+
+        u8 *level_pixels = pixels;
+        for (u32 i = 0; i < header->level_count; ++i)
+        {
+            const CookedTextureLevel *level = &header->levels[i];
+            decode_bc_image(block_format, file + level->offset, level->width, level->height, level_pixels);
+            set_uncompressed_level(load, i, level_pixels, level->width, level->height);
+            level_pixels += (u64)level->width * level->height * 4;
+        }
+        free(file);
+
+        load->memory = pixels;
+        load->internal_format = srgb ? GL_SRGB8_ALPHA8 : GL_RGBA8;
+        load->compressed = false;
+        return true;
+    }
+
+    load->memory = file;
+    for (u32 i = 0; i < header->level_count; ++i)
+    {
+        const CookedTextureLevel *level = &header->levels[i];
+        if (!load->compressed)
+        {
+            set_uncompressed_level(load, i, file + level->offset, level->width, level->height);
+            continue;
+        }
+
+        TextureLevel *entry = &load->levels[i];
+        entry->data = file + level->offset;
+        entry->width = level->width;
+        entry->height = level->height;
+        entry->rows = (level->height + BC_BLOCK_SIZE - 1) / BC_BLOCK_SIZE;
+        entry->row_bytes = (u64)((level->width + BC_BLOCK_SIZE - 1) / BC_BLOCK_SIZE) * bc_block_bytes(block_format);
+        entry->size = level->size;
+    }
+    return true;
+}
+
+
+internal void decode_texture_job(void *data)
+{
+    PROFILE_SCOPE("decode_texture");
+    MEMORY_TAG_SCOPE(MEMORY_TAG_ASSETS);
+
+    TextureLoad *load = (TextureLoad *)data;
+    u8 *file;
+    memory_index size;
+    bool decoded = false;
+    if (read_entire_file(load->path, &file, &size))
+    {
+        if (validate_cooked_texture(file, size))
+        {
+            decoded = prepare_cooked_texture(&texture_loader, load, file);
+        }
+        else
+        {
+            decoded = prepare_decoded_texture(load, file, size);
+            free(file);
+        }
+    }
+    load->state.store(decoded ? TEXTURE_LOAD_DECODED : TEXTURE_LOAD_FAILED, std::memory_order_release);
+}
+
+
+u32 load_texture(const char *path, u32 flags)
+{
+    TextureLoader *loader = &texture_loader;
+    if (loader->active_count == TEXTURE_MAX_LOADS || strlen(path) >= TEXTURE_MAX_PATH)
+    {
+        return 0;
+    }
+
+    u32 index = 0;
+    while (loader->loads[index].state.load(std::memory_order_relaxed) != TEXTURE_LOAD_FREE)
+    {
+        ++index;
+    }
+
+    TextureLoad *load = &loader->loads[index];
+    strcpy(load->path, path);
+    load->flags = flags;
+    load->memory = NULL;
+    load->level_count = 0;
+    load->level = 0;
+    load->rows_uploaded = 0;
+
+    local_persist const u8 placeholder[4] = {255, 255, 255, 255};
+    glGenTextures(1, &load->texture);
+    glBindTexture(GL_TEXTURE_2D, load->texture);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, 1, 1, 0, GL_RGBA, GL_UNSIGNED_BYTE, placeholder);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, 0);
+    glBindTexture(GL_TEXTURE_2D, 0);
+
+    loader->active[loader->active_count++] = index;
+    load->state.store(TEXTURE_LOAD_DECODING, std::memory_order_relaxed);
+    jobs_submit_background(decode_texture_job, load, &loader->decodes);
+    return load->texture;
+}
+
+
+u32 texture_loads_pending()
+{
+    return texture_loader.active_count;
+}
+
+
+bool texture_loading(u32 texture)
+{
+    TextureLoader *loader = &texture_loader;
+    for (u32 i = 0; i < loader->active_count; ++i)
+    {
+        if (loader->loads[loader->active[i]].texture == texture)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+
+const TextureUploadStats *texture_upload_stats()
+{
+    return &texture_loader.stats;
+}
+
+
+// UPLOAD #####################################################################
+
+
+internal void retire_upload_fences(TextureLoader *loader)
+{
+    while (loader->fence_count > 0)
+    {
+        TextureUploadFence *fence = &loader->fences[loader->fence_first];
+        GLenum status = glClientWaitSync(fence->fence, 0, 0);
+        if (status != GL_ALREADY_SIGNALED && status != GL_CONDITION_SATISFIED)
+        {
+            break;
+        }
+
+        glDeleteSync(fence->fence);
+        loader->ring_tail = fence->ring_end;
+        loader->fence_first = (loader->fence_first + 1) % TEXTURE_RING_FENCES;
+        --loader->fence_count;
+    }
+}
+
+
+// False when the GPU still reads the space, the strip waits for a later frame
+internal bool reserve_ring(TextureLoader *loader, u64 bytes, u64 *offset)
+{
+    u64 head = loader->ring_head;
+    u64 position = head % TEXTURE_RING_SIZE;
+    if (position + bytes > TEXTURE_RING_SIZE)
+    {
+        // Strips are contiguous, skip the end of the ring
+        head += TEXTURE_RING_SIZE - position;
+        position = 0;
+    }
+    if (head + bytes - loader->ring_tail > TEXTURE_RING_SIZE)
+    {
+        return false;
+    }
+
+    loader->ring_head = head + bytes;
+    *offset = position;
+    return true;
+}
+
+
+internal void begin_texture_upload(TextureLoad *load)
+{
+    glBindTexture(GL_TEXTURE_2D, load->texture);
+
+    // With the ring bound, NULL would mean its offset 0
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+    for (u32 i = 0; i < load->level_count; ++i)
+    {
+        TextureLevel *level = &load->levels[i];
+        if (load->compressed)
+        {
+            glCompressedTexImage2D(GL_TEXTURE_2D, i, load->internal_format, level->width, level->height, 0,
+                                   (GLsizei)level->size, NULL);
+        }
+        else
+        {
+            glTexImage2D(GL_TEXTURE_2D, i, load->internal_format, level->width, level->height, 0,
+                         GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+        }
+    }
+
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, load->level_count - 1);
+    if (load->level_count > 1)
+    {
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+    }
+    load->state.store(TEXTURE_LOAD_UPLOADING, std::memory_order_relaxed);
+}
+
+
+internal void finish_texture_upload(TextureLoad *load)
+{
+    if (load->generate_mipmaps)
+    {
+        glBindTexture(GL_TEXTURE_2D, load->texture);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, 1000);
+        glGenerateMipmap(GL_TEXTURE_2D);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+    }
+    free(load->memory);
+    load->memory = NULL;
+}
+
+
+// Copies as many strips of rows as the budget and the ring allow, level by
+// level, true once every level is up
+internal bool upload_texture_strips(TextureLoader *loader, TextureLoad *load, UploadBudget *budget)
+{
+    glBindTexture(GL_TEXTURE_2D, load->texture);
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, loader->ring);
+    for (; load->level < load->level_count; ++load->level, load->rows_uploaded = 0)
+    {
+        TextureLevel *level = &load->levels[load->level];
+        u64 row_bytes = level->row_bytes;
+        while (load->rows_uploaded < level->rows)
+        {
+            if (upload_deadline_passed(budget))
+            {
+                return false;
+            }
+
+            u64 budget_left = budget->used < budget->bytes ? budget->bytes - budget->used : 0;
+            u64 rows = (budget_left < TEXTURE_STRIP_SIZE ? budget_left : TEXTURE_STRIP_SIZE) / row_bytes;
+            if (rows == 0)
+            {
+                // Rows wider than a strip go up one at a time, wider than
+                // the budget one per frame
+                if (row_bytes > TEXTURE_RING_SIZE || (row_bytes > budget_left && budget->used > 0))
+                {
+                    return false;
+                }
+                rows = 1;
+            }
+            if (rows > level->rows - load->rows_uploaded)
+            {
+                rows = level->rows - load->rows_uploaded;
+            }
+
+            u64 bytes = rows * row_bytes;
+            u64 offset;
+            if (!reserve_ring(loader, bytes, &offset))
+            {
+                ++loader->stats.ring_full_frames;
+                return false;
+            }
+
+            u8 *destination = loader->ring_memory
+                ? loader->ring_memory + offset
+                : (u8 *)glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, offset, bytes,
+                                         GL_MAP_WRITE_BIT | GL_MAP_UNSYNCHRONIZED_BIT | GL_MAP_INVALIDATE_RANGE_BIT);
+            if (destination == NULL)
+            {
+                return false;
+            }
+
+            if (load->flip_rows)
+            {
+                for (u64 row = 0; row < rows; ++row)
+                {
+                    u64 source_row = level->rows - 1 - (load->rows_uploaded + row);
+                    memcpy(destination + row * row_bytes, level->data + source_row * row_bytes, row_bytes);
+                }
+            }
+            else
+            {
+                memcpy(destination, level->data + load->rows_uploaded * row_bytes, bytes);
+            }
+
+            if (!loader->ring_memory)
+            {
+                glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+            }
+
+            const void *source = (const void *)(uintptr_t)offset;
+            if (load->compressed)
+            {
+                // Whole blocks, the last strip may end past a non-multiple
+                // of 4 height
+                u32 y = load->rows_uploaded * BC_BLOCK_SIZE;
+                u32 height = (u32)rows * BC_BLOCK_SIZE;
+                height = y + height > level->height ? level->height - y : height;
+                glCompressedTexSubImage2D(GL_TEXTURE_2D, load->level, 0, y, level->width, height,
+                                          load->internal_format, (GLsizei)bytes, source);
+            }
+            else
+            {
+                glTexSubImage2D(GL_TEXTURE_2D, load->level, 0, load->rows_uploaded, level->width, (GLsizei)rows,
+                                GL_RGBA, GL_UNSIGNED_BYTE, source);
+            }
+            load->rows_uploaded += (u32)rows;
+            loader->stats.frame_bytes += bytes;
+            budget->used += bytes;
+        }
+    }
+    return true;
+}
+
+
+void update_texture_uploads(UploadBudget *budget)
+{
+    TextureLoader *loader = &texture_loader;
+    UploadBudget own_budget = {loader->budget, 0, 0};
+    budget = budget ? budget : &own_budget;
+    loader->stats.frame_bytes = 0;
+    if (loader->active_count == 0)
+    {
+        return;
+    }
+
+    retire_upload_fences(loader);
+    if (loader->fence_count == TEXTURE_RING_FENCES)
+    {
+        ++loader->stats.ring_full_frames;
+        return;
+    }
+
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+
+    u64 start_head = loader->ring_head;
+    u32 kept = 0;
+    bool out_of_budget = false;
+    for (u32 i = 0; i < loader->active_count; ++i)
+    {
+        u32 index = loader->active[i];
+        TextureLoad *load = &loader->loads[index];
+        u32 state = load->state.load(std::memory_order_acquire);
+
+        bool done = false;
+        if (state == TEXTURE_LOAD_FAILED)
+        {
+            log_error("Failed to load texture %s\n", load->path);
+            ++loader->stats.failed;
+            done = true;
+        }
+        else if (!out_of_budget && (state == TEXTURE_LOAD_DECODED || state == TEXTURE_LOAD_UPLOADING))
+        {
+            if (state == TEXTURE_LOAD_DECODED && !upload_deadline_passed(budget))
+            {
+                begin_texture_upload(load);
+                state = TEXTURE_LOAD_UPLOADING;
+            }
+
+            if (state == TEXTURE_LOAD_UPLOADING && upload_texture_strips(loader, load, budget))
+            {
+                finish_texture_upload(load);
+                ++loader->stats.loaded;
+                done = true;
+            }
+            else
+            {
+                out_of_budget = true;
+            }
+        }
+
+        if (done)
+        {
+            load->state.store(TEXTURE_LOAD_FREE, std::memory_order_relaxed);
+        }
+        else
+        {
+            loader->active[kept++] = index;
+        }
+    }
+    loader->active_count = kept;
+
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+    glBindTexture(GL_TEXTURE_2D, 0);
+
+    if (loader->ring_head != start_head)
+    {
+        u32 slot = (loader->fence_first + loader->fence_count) % TEXTURE_RING_FENCES;
+        loader->fences[slot].fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        loader->fences[slot].ring_end = loader->ring_head;
+        ++loader->fence_count;
+    }
+
+    loader->stats.total_bytes += loader->stats.frame_bytes;
+    if (loader->stats.frame_bytes > loader->stats.peak_frame_bytes)
+    {
+        loader->stats.peak_frame_bytes = loader->stats.frame_bytes;
+    }
+}
@@ -0,0 +1,95 @@
+#pragma once
+
+#include "platform.hpp"
+
+
+// Asynchronous texture loading in three stages.
+//
+//   1. load_texture() hands the file to the job system, a worker reads and
+//      decodes it (PNG or JPEG, see image.hpp). Cooked .ctex files (see
+//      cooked_texture.hpp) only need reading, their mips and BC blocks go
+//      up as they are.
+//   2. update_texture_uploads(), once a frame on the GL thread, copies
+//      decoded rows into a ring of pixel unpack buffers.
+//   3. glTexSubImage2D() sources them from the buffer, so the driver copies
+//      asynchronously instead of blocking on client memory.
+//
+// At most the byte budget goes into the ring per frame, and no new strip
+// starts past the budget's deadline. Images go up a strip of rows at a
+// time, over several frames when they are large, so a big texture never
+// costs one long frame. A fence per frame tells when the GPU is done with a
+// stretch of the ring. With ARB_buffer_storage the ring is mapped once,
+// persistently, otherwise every strip maps its range unsynchronized.
+//
+// Without S3TC support BC1/BC3 textures are decompressed on the worker.
+// The texture name is valid straight away and holds a 1x1 white texel until
+// its upload starts. Decodes run as background jobs, never on the GL thread.
+
+
+#define TEXTURE_MAX_LOADS     256        // in flight at once
+#define TEXTURE_MAX_PATH      256
+#define TEXTURE_RING_SIZE     Megabytes(32)
+#define TEXTURE_RING_FENCES   8          // frames of uploads in flight
+#define TEXTURE_UPLOAD_BUDGET Megabytes(4)
+#define TEXTURE_STRIP_SIZE    Kilobytes(256)   // most per glTexSubImage2D
+
+
+// For PNG and JPEG, cooked textures carry their own
+enum TextureFlags
+{
+    TEXTURE_SRGB    = 1 << 0,   // color data, sampled through sRGB decode
+    TEXTURE_MIPMAPS = 1 << 1,   // generated once the last strip is up
+    TEXTURE_FLIP_Y  = 1 << 2,   // first image row at t = 1, as GL expects
+};
+
+
+// What a frame may still spend on uploads, shared by everything uploading
+// in it (see stream.hpp)
+struct UploadBudget
+{
+    u64 bytes;
+    u64 used;
+    u64 deadline;               // platform_nanoseconds(), 0 for no limit
+};
+
+
+inline bool upload_deadline_passed(const UploadBudget *budget)
+{
+    return budget->deadline && platform_nanoseconds() >= budget->deadline;
+}
+
+
+struct TextureUploadStats
+{
+    u64 frame_bytes;            // copied into the ring in the last update
+    u64 total_bytes;
+    u64 peak_frame_bytes;
+    u32 loaded;
+    u32 failed;
+    u32 ring_full_frames;       // updates cut short by the ring, not the budget
+};
+
+
+// Needs a current GL context.
+bool init_texture_loader(u64 upload_budget = TEXTURE_UPLOAD_BUDGET);
+
+// Waits for running decodes and drops unfinished uploads. The textures
+// themselves belong to the callers.
+void shutdown_texture_loader();
+
+// 0 when TEXTURE_MAX_LOADS loads are already in flight.
+u32 load_texture(const char *path, u32 flags = TEXTURE_SRGB | TEXTURE_MIPMAPS | TEXTURE_FLIP_Y);
+
+// Starts and continues uploads within the per-frame budget, call once a
+// frame on the GL thread. Without `budget` it is the one given to
+// init_texture_loader() and no time limit.
+void update_texture_uploads(UploadBudget *budget = NULL);
+
+// Loads queued, decoding or uploading.
+u32 texture_loads_pending();
+
+// Whether a texture from load_texture() is still decoding or uploading.
+// Failed loads are done too, they keep the white texel.
+bool texture_loading(u32 texture);
+
+const TextureUploadStats *texture_upload_stats();
@@ -0,0 +1,471 @@
+#include <string.h>
+
+#include "transform.hpp"
+
+
+bool push_transform_hierarchy(TransformHierarchy *transforms, MemoryArena *arena, u32 capacity)
+{
+    transforms->parent = push_array(arena, capacity, u32);
+    transforms->first_child = push_array(arena, capacity, u32);
+    transforms->next_sibling = push_array(arena, capacity, u32);
+    transforms->depth = push_array(arena, capacity, u8);
+    transforms->flags = push_array(arena, capacity, u8);
+    transforms->handle = push_array(arena, capacity, u32);
+    transforms->position = push_array(arena, capacity, Vec3);
+    transforms->orientation = push_array(arena, capacity, Quat);
+    transforms->scale = push_array(arena, capacity, Vec3);
+    transforms->local = push_array(arena, capacity, Mat4);
+    transforms->world = push_array(arena, capacity, Mat4);
+    transforms->slot = push_array(arena, capacity, u32);
+    transforms->dirty = push_array(arena, capacity, u32);
+    transforms->frontier = push_array(arena, capacity, u32);
+    transforms->next_frontier = push_array(arena, capacity, u32);
+    transforms->batch_parents = push_array(arena, TRANSFORM_BATCH, Mat4);
+    transforms->batch_locals = push_array(arena, TRANSFORM_BATCH, Mat4);
+    if (transforms->batch_locals == NULL)
+    {
+        return false;
+    }
+
+    transforms->count = 0;
+    transforms->capacity = capacity;
+    transforms->free_slot = TRANSFORM_NONE;
+    transforms->free_handle = TRANSFORM_NONE;
+    transforms->handle_count = 0;
+    transforms->dirty_count = 0;
+    return true;
+}
+
+
+internal void mark_dirty(TransformHierarchy *transforms, u32 slot)
+{
+    if (!(transforms->flags[slot] & TRANSFORM_DIRTY))
+    {
+        transforms->flags[slot] |= TRANSFORM_DIRTY;
+        transforms->dirty[transforms->dirty_count++] = slot;
+    }
+}
+
+
+internal void link_child(TransformHierarchy *transforms, u32 slot, u32 parent)
+{
+    transforms->parent[slot] = parent;
+    transforms->next_sibling[slot] = TRANSFORM_NONE;
+    if (parent != TRANSFORM_NONE)
+    {
+        transforms->next_sibling[slot] = transforms->first_child[parent];
+        transforms->first_child[parent] = slot;
+    }
+}
+
+
+internal void unlink_child(TransformHierarchy *transforms, u32 slot)
+{
+    u32 parent = transforms->parent[slot];
+    if (parent == TRANSFORM_NONE)
+    {
+        return;
+    }
+
+    u32 *link = &transforms->first_child[parent];
+    while (*link != slot)
+    {
+        link = &transforms->next_sibling[*link];
+    }
+    *link = transforms->next_sibling[slot];
+}
+
+
+// Breadth first list of the subtree under `slot` (itself first) in
+// transforms->next_frontier, returns its size
+internal u32 collect_subtree(TransformHierarchy *transforms, u32 slot)
+{
+    u32 *nodes = transforms->next_frontier;
+    u32 count = 0;
+    nodes[count++] = slot;
+    for (u32 i = 0; i < count; ++i)
+    {
+        for (u32 child = transforms->first_child[nodes[i]];
+             child != TRANSFORM_NONE;
+             child = transforms->next_sibling[child])
+        {
+            nodes[count++] = child;
+        }
+    }
+    return count;
+}
+
+
+TransformHandle create_transform(TransformHierarchy *transforms, TransformHandle parent,
+                                 Vec3 position, Quat orientation, Vec3 scale)
+{
+    u32 parent_slot = parent == TRANSFORM_NONE ? TRANSFORM_NONE : transforms->slot[parent];
+    if (parent_slot != TRANSFORM_NONE && transforms->depth[parent_slot] == TRANSFORM_MAX_DEPTH)
+    {
+        return TRANSFORM_NONE;
+    }
+
+    u32 slot = transforms->free_slot;
+    if (slot != TRANSFORM_NONE)
+    {
+        transforms->free_slot = transforms->next_sibling[slot];
+    }
+    else if (transforms->count < transforms->capacity)
+    {
+        slot = transforms->count++;
+        transforms->flags[slot] = 0;
+    }
+    else
+    {
+        return TRANSFORM_NONE;
+    }
+
+    TransformHandle handle = transforms->free_handle;
+    if (handle != TRANSFORM_NONE)
+    {
+        transforms->free_handle = transforms->slot[handle];
+    }
+    else
+    {
+        handle = transforms->handle_count++;
+    }
+    transforms->slot[handle] = slot;
+    transforms->handle[slot] = handle;
+
+    // A reused slot may still be on the dirty list, keep its bit so it is
+    // not added twice
+    transforms->flags[slot] &= TRANSFORM_DIRTY;
+    transforms->first_child[slot] = TRANSFORM_NONE;
+    transforms->depth[slot] = parent_slot == TRANSFORM_NONE ? 0 : transforms->depth[parent_slot] + 1;
+    link_child(transforms, slot, parent_slot);
+
+    transforms->position[slot] = position;
+    transforms->orientation[slot] = orientation;
+    transforms->scale[slot] = scale;
+    transforms->local[slot] = compose_transform(position, orientation, scale);
+    transforms->world[slot] = transforms->local[slot];
+    mark_dirty(transforms, slot);
+    return handle;
+}
+
+
+void destroy_transform(TransformHierarchy *transforms, TransformHandle handle)
+{
+    u32 root = transforms->slot[handle];
+    unlink_child(transforms, root);
+
+    u32 count = collect_subtree(transforms, root);
+    for (u32 i = 0; i < count; ++i)
+    {
+        u32 slot = transforms->next_frontier[i];
+        u32 slot_handle = transforms->handle[slot];
+        transforms->slot[slot_handle] = transforms->free_handle;
+        transforms->free_handle = slot_handle;
+
+        transforms->flags[slot] = TRANSFORM_FREE | (transforms->flags[slot] & TRANSFORM_DIRTY);
+        transforms->parent[slot] = TRANSFORM_NONE;
+        transforms->next_sibling[slot] = transforms->free_slot;
+        transforms->free_slot = slot;
+    }
+}
+
+
+void set_local_transform(TransformHierarchy *transforms, TransformHandle handle,
+                         Vec3 position, Quat orientation, Vec3 scale)
+{
+    u32 slot = transforms->slot[handle];
+    transforms->position[slot] = position;
+    transforms->orientation[slot] = orientation;
+    transforms->scale[slot] = scale;
+    transforms->local[slot] = compose_transform(position, orientation, scale);
+    mark_dirty(transforms, slot);
+}
+
+
+bool move_transform(TransformHierarchy *transforms, TransformHandle handle, TransformHandle new_parent)
+{
+    u32 slot = transforms->slot[handle];
+    u32 parent = new_parent == TRANSFORM_NONE ? TRANSFORM_NONE : transforms->slot[new_parent];
+    for (u32 ancestor = parent; ancestor != TRANSFORM_NONE; ancestor = transforms->parent[ancestor])
+    {
+        if (ancestor == slot)
+        {
+            return false;
+        }
+    }
+
+    u32 count = collect_subtree(transforms, slot);
+    i32 depth = parent == TRANSFORM_NONE ? 0 : transforms->depth[parent] + 1;
+    i32 delta = depth - (i32)transforms->depth[slot];
+    if (transforms->depth[transforms->next_frontier[count - 1]] + delta > TRANSFORM_MAX_DEPTH)
+    {
+        return false;
+    }
+
+    unlink_child(transforms, slot);
+    link_child(transforms, slot, parent);
+    for (u32 i = 0; i < count; ++i)
+    {
+        transforms->depth[transforms->next_frontier[i]] += delta;
+    }
+    mark_dirty(transforms, slot);
+    return true;
+}
+
+
+internal void flush_batch(TransformHierarchy *transforms, const u32 *slots, u32 count)
+{
+    multiply_mat4_batch(transforms->batch_parents, transforms->batch_parents, transforms->batch_locals, count);
+    for (u32 i = 0; i < count; ++i)
+    {
+        transforms->world[slots[i]] = transforms->batch_parents[i];
+    }
+}
+
+
+// Consecutive slots, only the parents need gathering
+internal void compute_world_run(TransformHierarchy *transforms, u32 first, u32 count)
+{
+    local_persist const Mat4 identity = identity_mat4();
+    while (count > 0)
+    {
+        u32 batch_count = count < TRANSFORM_BATCH ? count : TRANSFORM_BATCH;
+        for (u32 i = 0; i < batch_count; ++i)
+        {
+            u32 parent = transforms->parent[first + i];
+            transforms->batch_parents[i] = parent == TRANSFORM_NONE ? identity : transforms->world[parent];
+        }
+        multiply_mat4_batch(transforms->world + first, transforms->batch_parents,
+                            transforms->local + first, batch_count);
+        first += batch_count;
+        count -= batch_count;
+    }
+}
+
+
+// world = parent world * local for every node in the list. Their parents
+// are all up to date. After a sort a level is one run of consecutive slots
+// and goes through the kernel in place, scattered nodes (from moves and
+// reused slots) are gathered into batches.
+internal void compute_world_transforms(TransformHierarchy *transforms, const u32 *slots, u32 count)
+{
+    local_persist const Mat4 identity = identity_mat4();
+    u32 batch_slots[TRANSFORM_BATCH];
+    u32 batch_count = 0;
+
+    u32 i = 0;
+    while (i < count)
+    {
+        u32 slot = slots[i];
+        u32 run = 1;
+        while (i + run < count && slots[i + run] == slot + run)
+        {
+            ++run;
+        }
+        if (run >= 8)
+        {
+            // Shares the batch buffers
+            if (batch_count > 0)
+            {
+                flush_batch(transforms, batch_slots, batch_count);
+                batch_count = 0;
+            }
+            compute_world_run(transforms, slot, run);
+            i += run;
+            continue;
+        }
+
+        u32 parent = transforms->parent[slot];
+        transforms->batch_parents[batch_count] = parent == TRANSFORM_NONE ? identity : transforms->world[parent];
+        transforms->batch_locals[batch_count] = transforms->local[slot];
+        batch_slots[batch_count++] = slot;
+        if (batch_count == TRANSFORM_BATCH)
+        {
+            flush_batch(transforms, batch_slots, batch_count);
+            batch_count = 0;
+        }
+        ++i;
+    }
+
+    if (batch_count > 0)
+    {
+        flush_batch(transforms, batch_slots, batch_count);
+    }
+}
+
+
+u32 update_transforms(TransformHierarchy *transforms)
+{
+    if (transforms->dirty_count == 0)
+    {
+        return 0;
+    }
+
+    // Counting sort of the dirty list by depth. After that the dirty array
+    // is free and serves as the second frontier buffer.
+    u32 level_start[TRANSFORM_MAX_DEPTH + 2] = {};
+    u32 dirty_count = transforms->dirty_count;
+    for (u32 i = 0; i < dirty_count; ++i)
+    {
+        ++level_start[transforms->depth[transforms->dirty[i]] + 1];
+    }
+    for (u32 level = 0; level <= TRANSFORM_MAX_DEPTH; ++level)
+    {
+        level_start[level + 1] += level_start[level];
+    }
+
+    u32 *sorted = transforms->frontier;
+    u32 *frontier = transforms->next_frontier;
+    u32 *next_frontier = transforms->dirty;
+    for (u32 i = 0; i < dirty_count; ++i)
+    {
+        u32 slot = transforms->dirty[i];
+        sorted[level_start[transforms->depth[slot]]++] = slot;
+    }
+
+    u32 updated = 0;
+    u32 next_dirty = 0;
+    u32 frontier_count = 0;
+    u32 level = transforms->depth[sorted[0]];
+    for (;;)
+    {
+        // Dirty nodes at this level that no dirty ancestor reached. Nodes
+        // a dirty ancestor reached had their bit cleared on the way.
+        while (next_dirty < dirty_count && transforms->depth[sorted[next_dirty]] == level)
+        {
+            u32 slot = sorted[next_dirty++];
+            u8 flags = transforms->flags[slot];
+            transforms->flags[slot] = flags & ~TRANSFORM_DIRTY;
+            if ((flags & (TRANSFORM_DIRTY | TRANSFORM_FREE)) == TRANSFORM_DIRTY)
+            {
+                frontier[frontier_count++] = slot;
+            }
+        }
+
+        if (frontier_count == 0)
+        {
+            if (next_dirty == dirty_count)
+            {
+                break;
+            }
+            level = transforms->depth[sorted[next_dirty]];
+            continue;
+        }
+
+        compute_world_transforms(transforms, frontier, frontier_count);
+        updated += frontier_count;
+
+        u32 next_count = 0;
+        for (u32 i = 0; i < frontier_count; ++i)
+        {
+            for (u32 child = transforms->first_child[frontier[i]];
+                 child != TRANSFORM_NONE;
+                 child = transforms->next_sibling[child])
+            {
+                transforms->flags[child] &= ~TRANSFORM_DIRTY;
+                next_frontier[next_count++] = child;
+            }
+        }
+
+        u32 *swap = frontier;
+        frontier = next_frontier;
+        next_frontier = swap;
+        frontier_count = next_count;
+        ++level;
+    }
+
+    transforms->dirty_count = 0;
+    return updated;
+}
+
+
+internal void permute_slots(void *array, memory_index size, const u32 *order, u32 count, u8 *copy)
+{
+    for (u32 i = 0; i < count; ++i)
+    {
+        memcpy(copy + i * size, (u8 *)array + order[i] * size, size);
+    }
+    memcpy(array, copy, count * size);
+}
+
+
+internal void remap_links(u32 *links, const u32 *new_slot, u32 count)
+{
+    for (u32 i = 0; i < count; ++i)
+    {
+        links[i] = links[i] == TRANSFORM_NONE ? TRANSFORM_NONE : new_slot[links[i]];
+    }
+}
+
+
+bool sort_transforms(TransformHierarchy *transforms, MemoryArena *scratch)
+{
+    TemporaryMemory temp = begin_temporary_memory(scratch);
+    u32 count = transforms->count;
+    u32 *order = push_array(scratch, count, u32);
+    u32 *new_slot = push_array(scratch, count, u32);
+    u8 *copy = (u8 *)push_size(scratch, count * sizeof(Mat4), 64);
+    if (order == NULL || new_slot == NULL || copy == NULL)
+    {
+        end_temporary_memory(temp);
+        return false;
+    }
+
+    // Roots in their current order, then level by level
+    u32 live = 0;
+    for (u32 slot = 0; slot < count; ++slot)
+    {
+        if (!(transforms->flags[slot] & TRANSFORM_FREE) && transforms->parent[slot] == TRANSFORM_NONE)
+        {
+            order[live++] = slot;
+        }
+    }
+    for (u32 i = 0; i < live; ++i)
+    {
+        for (u32 child = transforms->first_child[order[i]];
+             child != TRANSFORM_NONE;
+             child = transforms->next_sibling[child])
+        {
+            order[live++] = child;
+        }
+    }
+
+    for (u32 slot = 0; slot < count; ++slot)
+    {
+        new_slot[slot] = TRANSFORM_NONE;
+    }
+    for (u32 i = 0; i < live; ++i)
+    {
+        new_slot[order[i]] = i;
+    }
+
+    permute_slots(transforms->parent, sizeof(u32), order, live, copy);
+    permute_slots(transforms->first_child, sizeof(u32), order, live, copy);
+    permute_slots(transforms->next_sibling, sizeof(u32), order, live, copy);
+    permute_slots(transforms->depth, sizeof(u8), order, live, copy);
+    permute_slots(transforms->flags, sizeof(u8), order, live, copy);
+    permute_slots(transforms->handle, sizeof(u32), order, live, copy);
+    permute_slots(transforms->position, sizeof(Vec3), order, live, copy);
+    permute_slots(transforms->orientation, sizeof(Quat), order, live, copy);
+    permute_slots(transforms->scale, sizeof(Vec3), order, live, copy);
+    permute_slots(transforms->local, sizeof(Mat4), order, live, copy);
+    permute_slots(transforms->world, sizeof(Mat4), order, live, copy);
+    remap_links(transforms->parent, new_slot, live);
+    remap_links(transforms->first_child, new_slot, live);
+    remap_links(transforms->next_sibling, new_slot, live);
+
+    transforms->dirty_count = 0;
+    for (u32 slot = 0; slot < live; ++slot)
+    {
+        transforms->slot[transforms->handle[slot]] = slot;
+        if (transforms->flags[slot] & TRANSFORM_DIRTY)
+        {
+            transforms->dirty[transforms->dirty_count++] = slot;
+        }
+    }
+    transforms->count = live;
+    transforms->free_slot = TRANSFORM_NONE;
+
+    end_temporary_memory(temp);
+    return true;
+}
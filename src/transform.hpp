@@ -0,0 +1,105 @@
+#pragma once
+
+#include "platform.hpp"
+#include "math.hpp"
+
+
+// Parent/child transform hierarchy.
+//
+// Nodes live in structure of arrays slots. sort_transforms() orders the
+// slots breadth first, so each depth level is contiguous and siblings sit
+// next to each other. Creating and moving nodes later only relinks them (a
+// move re-levels the moved subtree and touches nothing else), the order
+// just gets less cache friendly until the next sort.
+//
+// Changing a local transform marks the node dirty. update_transforms()
+// walks down from the dirty nodes one depth level at a time and recomputes
+// only their subtrees, in batches through the SIMD matrix kernels. With no
+// dirty nodes it returns straight away, so static scenery costs nothing.
+//
+// Nodes are referred to by handles, which stay valid across sorts.
+
+
+#define TRANSFORM_NONE      0xFFFFFFFFu
+#define TRANSFORM_MAX_DEPTH 255
+#define TRANSFORM_BATCH     256
+
+
+typedef u32 TransformHandle;
+
+
+enum TransformFlags
+{
+    TRANSFORM_DIRTY = 1 << 0,       // on the dirty list, world needs updating
+    TRANSFORM_FREE  = 1 << 1,
+};
+
+
+struct TransformHierarchy
+{
+    // Per slot
+    u32        *parent;         // slot, TRANSFORM_NONE for roots
+    u32        *first_child;
+    u32        *next_sibling;   // next free slot for free slots
+    u8         *depth;
+    u8         *flags;
+    u32        *handle;         // owning handle
+    Vec3       *position;       // local
+    Quat       *orientation;
+    Vec3       *scale;
+    Mat4       *local;
+    Mat4       *world;
+
+    // Per handle, slot or next free handle
+    u32        *slot;
+
+    u32         count;          // slots in use, including free ones
+    u32         capacity;
+    u32         free_slot;
+    u32         free_handle;
+    u32         handle_count;
+
+    // update_transforms() state
+    u32        *dirty;
+    u32         dirty_count;
+    u32        *frontier;
+    u32        *next_frontier;
+    Mat4       *batch_parents;
+    Mat4       *batch_locals;
+};
+
+
+bool push_transform_hierarchy(TransformHierarchy *transforms, MemoryArena *arena, u32 capacity);
+
+// TRANSFORM_NONE when full or the parent is too deep. The world matrix is
+// valid after the next update_transforms().
+TransformHandle create_transform(TransformHierarchy *transforms, TransformHandle parent,
+                                 Vec3 position, Quat orientation, Vec3 scale);
+
+// Frees the node and all its descendants.
+void destroy_transform(TransformHierarchy *transforms, TransformHandle handle);
+
+void set_local_transform(TransformHierarchy *transforms, TransformHandle handle,
+                         Vec3 position, Quat orientation, Vec3 scale);
+
+// Reparents the subtree under new_parent (TRANSFORM_NONE makes it a root),
+// keeping local transforms. False if that would make a cycle or exceed
+// TRANSFORM_MAX_DEPTH.
+bool move_transform(TransformHierarchy *transforms, TransformHandle handle, TransformHandle new_parent);
+
+// Recomputes world matrices below every dirty node, returns how many.
+u32 update_transforms(TransformHierarchy *transforms);
+
+// Restores breadth first order and drops free slots. Needs temporary space
+// for one copy of the largest array.
+bool sort_transforms(TransformHierarchy *transforms, MemoryArena *scratch);
+
+inline const Mat4 *get_world_transform(TransformHierarchy *transforms, TransformHandle handle)
+{
+    return &transforms->world[transforms->slot[handle]];
+}
+
+inline bool is_transform_dirty(TransformHierarchy *transforms, TransformHandle handle)
+{
+    return transforms->flags[transforms->slot[handle]] & TRANSFORM_DIRTY;
+}
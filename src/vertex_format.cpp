@@ -0,0 +1,419 @@
+#include <math.h>
+#include <stddef.h>
+#include <string.h>
+
+#include "vertex_format.hpp"
+
+
+static_assert(sizeof(QuantizedVertex) == 16, "quantized vertices are 16 bytes");
+
+
+global_variable const CookedMeshAttribute float_attributes[] =
+{
+    {VERTEX_POSITION, COOKED_ATTRIBUTE_F32, 3, (u32)offsetof(Vertex, position)},
+    {VERTEX_NORMAL,   COOKED_ATTRIBUTE_F32, 3, (u32)offsetof(Vertex, normal)},
+    {VERTEX_UV,       COOKED_ATTRIBUTE_F32, 2, (u32)offsetof(Vertex, uv)},
+};
+
+global_variable const CookedMeshAttribute unorm16_attributes[] =
+{
+    {VERTEX_POSITION, COOKED_ATTRIBUTE_UNORM16,          3, (u32)offsetof(QuantizedVertex, position)},
+    {VERTEX_NORMAL,   COOKED_ATTRIBUTE_SNORM_10_10_10_2, 4, (u32)offsetof(QuantizedVertex, normal)},
+    {VERTEX_UV,       COOKED_ATTRIBUTE_UNORM16,          2, (u32)offsetof(QuantizedVertex, uv)},
+};
+
+global_variable const CookedMeshAttribute half_attributes[] =
+{
+    {VERTEX_POSITION, COOKED_ATTRIBUTE_F16,              3, (u32)offsetof(QuantizedVertex, position)},
+    {VERTEX_NORMAL,   COOKED_ATTRIBUTE_SNORM_10_10_10_2, 4, (u32)offsetof(QuantizedVertex, normal)},
+    {VERTEX_UV,       COOKED_ATTRIBUTE_UNORM16,          2, (u32)offsetof(QuantizedVertex, uv)},
+};
+
+
+global_variable const char *vertex_format_names[VERTEX_FORMAT_COUNT] = {"float", "unorm16", "half"};
+
+
+const CookedMeshAttribute *vertex_format_attributes(VertexFormat format, u32 *count)
+{
+    switch (format)
+    {
+        case VERTEX_FORMAT_UNORM16:
+            *count = sizeof(unorm16_attributes) / sizeof(unorm16_attributes[0]);
+            return unorm16_attributes;
+        case VERTEX_FORMAT_HALF:
+            *count = sizeof(half_attributes) / sizeof(half_attributes[0]);
+            return half_attributes;
+        default:
+            *count = sizeof(float_attributes) / sizeof(float_attributes[0]);
+            return float_attributes;
+    }
+}
+
+
+u32 vertex_format_stride(VertexFormat format)
+{
+    u32 count;
+    const CookedMeshAttribute *attributes = vertex_format_attributes(format, &count);
+    u32 stride = 0;
+    for (u32 i = 0; i < count; ++i)
+    {
+        u32 end = attributes[i].offset
+                + cooked_attribute_size((CookedAttributeFormat)attributes[i].format, attributes[i].components);
+        stride = end > stride ? end : stride;
+    }
+    return stride;
+}
+
+
+u32 describe_vertex_format(VertexFormat format, CookedMeshAttribute *attributes)
+{
+    u32 count;
+    const CookedMeshAttribute *table = vertex_format_attributes(format, &count);
+    memcpy(attributes, table, count * sizeof(CookedMeshAttribute));
+    return count;
+}
+
+
+bool parse_vertex_format(const char *name, VertexFormat *format)
+{
+    for (u32 i = 0; i < VERTEX_FORMAT_COUNT; ++i)
+    {
+        if (strcmp(name, vertex_format_names[i]) == 0)
+        {
+            *format = (VertexFormat)i;
+            return true;
+        }
+    }
+    return false;
+}
+
+
+const char *vertex_format_name(VertexFormat format)
+{
+    return format < VERTEX_FORMAT_COUNT ? vertex_format_names[format] : "unknown";
+}
+
+
+// Format the layout stores `location` in
+internal CookedAttributeFormat attribute_format(VertexFormat format, u32 location)
+{
+    u32 count;
+    const CookedMeshAttribute *attributes = vertex_format_attributes(format, &count);
+    for (u32 i = 0; i < count; ++i)
+    {
+        if (attributes[i].location == location)
+        {
+            return (CookedAttributeFormat)attributes[i].format;
+        }
+    }
+    return COOKED_ATTRIBUTE_F32;
+}
+
+
+// PACKING ####################################################################
+
+
+// Round to nearest even, out of range values become infinity
+internal u16 half_from_float(f32 value)
+{
+    u32 bits;
+    memcpy(&bits, &value, sizeof(bits));
+    u32 sign = (bits >> 16) & 0x8000;
+    bits &= 0x7FFFFFFF;
+
+    u32 result;
+    if (bits >= 0x47800000)
+    {
+        result = bits > 0x7F800000 ? 0x7E00 : 0x7C00;
+    }
+    else if (bits < 0x38800000)
+    {
+        // Below the smallest normal half, adding 0.5 lets the FPU round the
+        // denormal mantissa into the low bits
+        f32 magnitude;
+        memcpy(&magnitude, &bits, sizeof(magnitude));
+        magnitude += 0.5f;
+        memcpy(&result, &magnitude, sizeof(result));
+        result -= 0x3F000000;
+    }
+    else
+    {
+        u32 odd = (bits >> 13) & 1;
+        bits += 0xC8000FFF + odd;   // rebias the exponent, round
+        result = bits >> 13;
+    }
+    return (u16)(sign | result);
+}
+
+
+internal f32 float_from_half(u16 half)
+{
+    u32 sign = (u32)(half & 0x8000) << 16;
+    u32 exponent = (half >> 10) & 0x1F;
+    u32 mantissa = half & 0x3FF;
+
+    f32 magnitude;
+    if (exponent == 0)
+    {
+        magnitude = ldexpf((f32)mantissa, -24);
+    }
+    else if (exponent == 31)
+    {
+        magnitude = mantissa ? NAN : INFINITY;
+    }
+    else
+    {
+        magnitude = ldexpf((f32)(mantissa | 0x400), (i32)exponent - 25);
+    }
+    u32 bits;
+    memcpy(&bits, &magnitude, sizeof(bits));
+    bits |= sign;
+    memcpy(&magnitude, &bits, sizeof(magnitude));
+    return magnitude;
+}
+
+
+// GL 3.3 reads the 10 bit components as max(c / 511, -1) and w as
+// max(w, -1)
+internal u32 pack_snorm_10_10_10_2(const f32 *values)
+{
+    u32 bits = 0;
+    for (u32 c = 0; c < 3; ++c)
+    {
+        i32 component = (i32)lrintf(clamp(-1.0f, values[c], 1.0f) * 511.0f);
+        bits |= ((u32)component & 0x3FF) << (10 * c);
+    }
+    i32 w = (i32)lrintf(clamp(-1.0f, values[3], 1.0f));
+    return bits | ((u32)w & 0x3) << 30;
+}
+
+
+internal void unpack_snorm_10_10_10_2(u32 bits, f32 *values)
+{
+    for (u32 c = 0; c < 3; ++c)
+    {
+        i32 component = (i32)(bits << (22 - 10 * c)) >> 22;
+        values[c] = fmaxf((f32)component / 511.0f, -1.0f);
+    }
+    values[3] = fmaxf((f32)((i32)bits >> 30), -1.0f);
+}
+
+
+// One attribute's components from `values` into `destination`, unaligned
+internal void encode_attribute(u8 *destination, const CookedMeshAttribute *attribute, const f32 *values)
+{
+    for (u32 c = 0; c < attribute->components; ++c)
+    {
+        switch (attribute->format)
+        {
+            case COOKED_ATTRIBUTE_F32:
+            {
+                memcpy(destination + c * 4, &values[c], 4);
+            } break;
+
+            case COOKED_ATTRIBUTE_F16:
+            {
+                u16 half = half_from_float(values[c]);
+                memcpy(destination + c * 2, &half, 2);
+            } break;
+
+            case COOKED_ATTRIBUTE_UNORM16:
+            {
+                u16 value = (u16)(clamp(0.0f, values[c], 1.0f) * 65535.0f + 0.5f);
+                memcpy(destination + c * 2, &value, 2);
+            } break;
+        }
+    }
+    if (attribute->format == COOKED_ATTRIBUTE_SNORM_10_10_10_2)
+    {
+        u32 bits = pack_snorm_10_10_10_2(values);
+        memcpy(destination, &bits, 4);
+    }
+}
+
+
+internal void decode_attribute(const u8 *source, const CookedMeshAttribute *attribute, f32 *values)
+{
+    for (u32 c = 0; c < attribute->components; ++c)
+    {
+        switch (attribute->format)
+        {
+            case COOKED_ATTRIBUTE_F32:
+            {
+                memcpy(&values[c], source + c * 4, 4);
+            } break;
+
+            case COOKED_ATTRIBUTE_F16:
+            {
+                u16 half;
+                memcpy(&half, source + c * 2, 2);
+                values[c] = float_from_half(half);
+            } break;
+
+            case COOKED_ATTRIBUTE_UNORM16:
+            {
+                u16 value;
+                memcpy(&value, source + c * 2, 2);
+                values[c] = (f32)value / 65535.0f;
+            } break;
+        }
+    }
+    if (attribute->format == COOKED_ATTRIBUTE_SNORM_10_10_10_2)
+    {
+        u32 bits;
+        memcpy(&bits, source, 4);
+        unpack_snorm_10_10_10_2(bits, values);
+    }
+}
+
+
+// QUANTIZING #################################################################
+
+
+VertexDequantization vertex_dequantization(const Vertex *vertices, u32 vertex_count, VertexFormat format)
+{
+    VertexDequantization result;
+    result.position_offset = vec3(0.0f, 0.0f, 0.0f);
+    result.position_scale = vec3(1.0f, 1.0f, 1.0f);
+    result.uv_offset = vec2(0.0f, 0.0f);
+    result.uv_scale = vec2(1.0f, 1.0f);
+    if (vertex_count == 0)
+    {
+        return result;
+    }
+
+    Vec3 position_min = vertices[0].position;
+    Vec3 position_max = vertices[0].position;
+    Vec2 uv_min = vertices[0].uv;
+    Vec2 uv_max = vertices[0].uv;
+    for (u32 i = 1; i < vertex_count; ++i)
+    {
+        position_min = min(position_min, vertices[i].position);
+        position_max = max(position_max, vertices[i].position);
+        for (u32 c = 0; c < 2; ++c)
+        {
+            uv_min.e[c] = fminf(uv_min.e[c], vertices[i].uv.e[c]);
+            uv_max.e[c] = fmaxf(uv_max.e[c], vertices[i].uv.e[c]);
+        }
+    }
+
+    // unorm16 spans the bounds from 0 to 1, half the center from -1 to 1,
+    // floats stay as they are
+    CookedAttributeFormat position_format = attribute_format(format, VERTEX_POSITION);
+    if (position_format == COOKED_ATTRIBUTE_F16)
+    {
+        result.position_offset = 0.5f * (position_min + position_max);
+        result.position_scale = 0.5f * (position_max - position_min);
+    }
+    else if (position_format == COOKED_ATTRIBUTE_UNORM16)
+    {
+        result.position_offset = position_min;
+        result.position_scale = position_max - position_min;
+    }
+    if (attribute_format(format, VERTEX_UV) == COOKED_ATTRIBUTE_UNORM16)
+    {
+        result.uv_offset = uv_min;
+        result.uv_scale = vec2(uv_max.x - uv_min.x, uv_max.y - uv_min.y);
+    }
+    return result;
+}
+
+
+// Per location, what the shader adds and multiplies by. Normals go as is.
+internal void attribute_ranges(const VertexDequantization *dequantization,
+                               f32 offsets[VERTEX_ATTRIBUTE_COUNT][4], f32 scales[VERTEX_ATTRIBUTE_COUNT][4])
+{
+    for (u32 location = 0; location < VERTEX_ATTRIBUTE_COUNT; ++location)
+    {
+        for (u32 c = 0; c < 4; ++c)
+        {
+            offsets[location][c] = 0.0f;
+            scales[location][c] = 1.0f;
+        }
+    }
+    for (u32 c = 0; c < 3; ++c)
+    {
+        offsets[VERTEX_POSITION][c] = dequantization->position_offset.e[c];
+        scales[VERTEX_POSITION][c] = dequantization->position_scale.e[c];
+    }
+    for (u32 c = 0; c < 2; ++c)
+    {
+        offsets[VERTEX_UV][c] = dequantization->uv_offset.e[c];
+        scales[VERTEX_UV][c] = dequantization->uv_scale.e[c];
+    }
+}
+
+
+void quantize_vertices(void *output, const Vertex *vertices, u32 vertex_count, VertexFormat format,
+                       const VertexDequantization *dequantization)
+{
+    u32 attribute_count;
+    const CookedMeshAttribute *attributes = vertex_format_attributes(format, &attribute_count);
+    u32 stride = vertex_format_stride(format);
+
+    // Flat axes have a 0 scale, everything on them stores as 0
+    f32 offsets[VERTEX_ATTRIBUTE_COUNT][4];
+    f32 inverses[VERTEX_ATTRIBUTE_COUNT][4];
+    attribute_ranges(dequantization, offsets, inverses);
+    for (u32 location = 0; location < VERTEX_ATTRIBUTE_COUNT; ++location)
+    {
+        for (u32 c = 0; c < 4; ++c)
+        {
+            inverses[location][c] = inverses[location][c] > 0.0f ? 1.0f / inverses[location][c] : 0.0f;
+        }
+    }
+
+    u8 *destination = (u8 *)output;
+    memset(destination, 0, (memory_index)vertex_count * stride);
+    for (u32 i = 0; i < vertex_count; ++i, destination += stride)
+    {
+        const Vertex *vertex = &vertices[i];
+        f32 values[VERTEX_ATTRIBUTE_COUNT][4] =
+        {
+            {vertex->position.x, vertex->position.y, vertex->position.z, 0.0f},
+            {vertex->normal.x, vertex->normal.y, vertex->normal.z, 0.0f},
+            {vertex->uv.x, vertex->uv.y, 0.0f, 0.0f},
+        };
+        for (u32 a = 0; a < attribute_count; ++a)
+        {
+            const CookedMeshAttribute *attribute = &attributes[a];
+            f32 *value = values[attribute->location];
+            for (u32 c = 0; c < 4; ++c)
+            {
+                value[c] = (value[c] - offsets[attribute->location][c]) * inverses[attribute->location][c];
+            }
+            encode_attribute(destination + attribute->offset, attribute, value);
+        }
+    }
+}
+
+
+Vertex dequantize_vertex(const void *vertices, u32 index, VertexFormat format,
+                         const VertexDequantization *dequantization)
+{
+    u32 attribute_count;
+    const CookedMeshAttribute *attributes = vertex_format_attributes(format, &attribute_count);
+    const u8 *source = (const u8 *)vertices + (memory_index)index * vertex_format_stride(format);
+
+    f32 offsets[VERTEX_ATTRIBUTE_COUNT][4];
+    f32 scales[VERTEX_ATTRIBUTE_COUNT][4];
+    attribute_ranges(dequantization, offsets, scales);
+
+    f32 values[VERTEX_ATTRIBUTE_COUNT][4] = {};
+    for (u32 a = 0; a < attribute_count; ++a)
+    {
+        const CookedMeshAttribute *attribute = &attributes[a];
+        f32 *value = values[attribute->location];
+        decode_attribute(source + attribute->offset, attribute, value);
+        for (u32 c = 0; c < 4; ++c)
+        {
+            value[c] = offsets[attribute->location][c] + scales[attribute->location][c] * value[c];
+        }
+    }
+
+    Vertex result;
+    result.position = vec3(values[VERTEX_POSITION][0], values[VERTEX_POSITION][1], values[VERTEX_POSITION][2]);
+    result.normal = vec3(values[VERTEX_NORMAL][0], values[VERTEX_NORMAL][1], values[VERTEX_NORMAL][2]);
+    result.uv = vec2(values[VERTEX_UV][0], values[VERTEX_UV][1]);
+    return result;
+}
@@ -0,0 +1,85 @@
+#pragma once
+
+#include "platform.hpp"
+#include "math.hpp"
+#include "mesh.hpp"
+#include "cooked_mesh.hpp"
+
+
+// Quantized vertex layouts, chosen at import.
+//
+//   float:     Vertex as is, 32 bytes
+//   unorm16:   positions 16 bit normalized over the mesh's bounds, 16 bytes
+//   half:      positions half floats around the bounds' center, 16 bytes
+//
+// Both quantized layouts pack normals into GL_INT_2_10_10_10_REV (10 bits
+// signed normalized a component) and UVs into 16 bit normalized over their
+// range. The GPU normalizes when it fetches, the rest is
+//
+//   position = position_offset + position_scale * attribute 0
+//   uv       = uv_offset + uv_scale * attribute 2
+//
+// in the QUANTIZED permutation of the mesh shader, with the parameters from
+// VertexDequantization. A 16 bit position is off by at most 1/131070 of the
+// bounds' extent, a half one by 1/4096 of the half extent near the border,
+// a UV by 1/131070 of the UVs' range and a normal by 1/1022 a component.
+//
+// Each layout is one table of CookedMeshAttribute, the same entries a
+// .cmesh header carries. Quantizing, the stride and the attribute pointers
+// (see gl_vertex.hpp) all go by it.
+
+
+// Shader attribute locations, the same for every layout
+enum VertexAttributeLocation
+{
+    VERTEX_POSITION,
+    VERTEX_NORMAL,
+    VERTEX_UV,
+    VERTEX_ATTRIBUTE_COUNT
+};
+
+
+// Both quantized layouts, the position 16 bit normalized or half floats
+struct QuantizedVertex
+{
+    u16 position[3];
+    u16 padding;                // keeps the normal 4 byte aligned
+    u32 normal;                 // x in the low 10 bits, then y and z, w 0
+    u16 uv[2];
+};
+
+
+// Object space from what the shader reads, identity for VERTEX_FORMAT_FLOAT
+struct VertexDequantization
+{
+    Vec3 position_offset;
+    Vec3 position_scale;
+    Vec2 uv_offset;
+    Vec2 uv_scale;
+};
+
+
+// The layout's attribute table, `count` entries
+const CookedMeshAttribute *vertex_format_attributes(VertexFormat format, u32 *count);
+
+// Where the last attribute ends
+u32 vertex_format_stride(VertexFormat format);
+
+// Fills `attributes`, returns how many
+u32 describe_vertex_format(VertexFormat format, CookedMeshAttribute *attributes);
+
+// "float", "unorm16" or "half"
+bool parse_vertex_format(const char *name, VertexFormat *format);
+const char *vertex_format_name(VertexFormat format);
+
+// The ranges quantize_vertices() maps onto, from the vertices' bounds
+VertexDequantization vertex_dequantization(const Vertex *vertices, u32 vertex_count, VertexFormat format);
+
+// Writes vertex_count vertices of vertex_format_stride(format) bytes into
+// `output`.
+void quantize_vertices(void *output, const Vertex *vertices, u32 vertex_count, VertexFormat format,
+                       const VertexDequantization *dequantization);
+
+// Back to object space, for checking the error
+Vertex dequantize_vertex(const void *vertices, u32 index, VertexFormat format,
+                         const VertexDequantization *dequantization);